@@ -0,0 +1,246 @@
+#include <string>
+#include <chrono>
+#include <fstream>
+
+#include <benchmark/benchmark.h>
+
+#include <Kodgen/Misc/Filesystem.h>
+#include <Kodgen/Misc/DefaultLogger.h>
+#include <Kodgen/CodeGen/CodeGenManager.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+
+#include "RefurekuGenerator/Parsing/FileParser.h"
+#include "RefurekuGenerator/CodeGen/ReflectionCodeGenModule.h"
+#include "RefurekuGenerator/CodeGen/IncrementalGenerator.h"
+#include "RefurekuGenerator/Misc/ThreadSafeLogger.h"
+
+namespace generator_benchmarks
+{
+	/** Number of headers of the synthetic corpus. */
+	constexpr int headersCount		= 256;
+
+	/** Number of reflected classes per header. */
+	constexpr int classesPerHeader	= 4;
+
+	fs::path getCorpusDirectory()
+	{
+		return fs::temp_directory_path() / "RefurekuGeneratorBenchmarksCorpus";
+	}
+
+	void writeHeader(fs::path const& directory, int headerIndex)
+	{
+		std::string		fileName = "Header" + std::to_string(headerIndex);
+		std::ofstream	file(directory / (fileName + ".h"));
+
+		file << "#pragma once\n\n#include \"Generated/" << fileName << ".rfkh.h\"\n\n";
+
+		for (int i = 0; i < classesPerHeader; i++)
+		{
+			std::string className = fileName + "_Class" + std::to_string(i);
+
+			file << "class CLASS() " << className << "\n{\n"
+					"\tprivate:\n"
+					"\t\tFIELD() int _i = 0;\n"
+					"\t\tFIELD() float _f = 0.0f;\n\n"
+					"\tpublic:\n"
+					"\t\tMETHOD() int getI() const noexcept { return _i; }\n"
+					"\t\tMETHOD() void setF(float f) noexcept { _f = f; }\n\n"
+					"\t" << className << "_GENERATED\n"
+					"};\n\n";
+		}
+
+		file << "File_" << fileName << "_GENERATED";
+	}
+
+	void createCorpus(fs::path const& corpusDirectory)
+	{
+		fs::remove_all(corpusDirectory);
+		fs::create_directories(corpusDirectory / "Include" / "Generated");
+
+		for (int i = 0; i < headersCount; i++)
+		{
+			writeHeader(corpusDirectory / "Include", i);
+		}
+	}
+
+	bool loadSettings(kodgen::CodeGenManagerSettings& codeGenMgrSettings, kodgen::ParsingSettings& parsingSettings,
+					  kodgen::MacroCodeGenUnitSettings& codeGenUnitSettings, fs::path const& corpusDirectory)
+	{
+		bool result = true;
+
+		result &= codeGenMgrSettings.addSupportedFileExtension(".h");
+		codeGenMgrSettings.addToProcessDirectory(corpusDirectory / "Include");
+		codeGenMgrSettings.addIgnoredDirectory(corpusDirectory / "Include" / "Generated");
+
+		result &= codeGenUnitSettings.setOutputDirectory(corpusDirectory / "Include" / "Generated");
+		codeGenUnitSettings.setGeneratedHeaderFileNamePattern("##FILENAME##.rfkh.h");
+		codeGenUnitSettings.setGeneratedSourceFileNamePattern("##FILENAME##.rfks.h");
+		codeGenUnitSettings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
+		codeGenUnitSettings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
+
+		parsingSettings.cppVersion = kodgen::ECppVersion::Cpp17;
+		parsingSettings.shouldAbortParsingOnFirstError = true;
+
+		parsingSettings.addProjectIncludeDirectory(corpusDirectory / "Include");
+		parsingSettings.addProjectIncludeDirectory(RFK_PUBLIC_INCLUDE_DIRECTORY);
+		result &= parsingSettings.setCompilerExeName("clang++");
+
+		return result;
+	}
+
+	/**
+	*	Objects needed to run the generator, set up the same way the generator executable does.
+	*/
+	struct Generator
+	{
+		kodgen::DefaultLogger				defaultLogger;
+		rfk::ThreadSafeLogger				logger{defaultLogger};
+		rfk::FileParser						fileParser;
+		kodgen::CodeGenManager				codeGenMgr;
+		kodgen::MacroCodeGenUnitSettings	codeGenUnitSettings;
+		kodgen::MacroCodeGenUnit			codeGenUnit;
+		rfk::ReflectionCodeGenModule		reflectionCodeGenModule;
+		bool								isSettingsLoaded;
+
+		Generator(fs::path const& corpusDirectory, kodgen::uint32 threadCount):
+			codeGenMgr(threadCount)
+		{
+			//The file parser gets no logger so that each parsed file isn't logged, keeping the benchmark output readable
+			codeGenMgr.logger = &logger;
+
+			codeGenUnit.logger = &logger;
+			codeGenUnit.setSettings(codeGenUnitSettings);
+			codeGenUnit.addModule(reflectionCodeGenModule);
+
+			isSettingsLoaded = loadSettings(codeGenMgr.settings, fileParser.getSettings(), codeGenUnitSettings, corpusDirectory);
+		}
+	};
+
+	/**
+	*	Modify the content of the first header of the corpus, so that it must be regenerated.
+	*	The modification time is set explicitly so that consecutive modifications are always noticed.
+	*/
+	void modifyHeader(fs::path const& corpusDirectory, int modificationIndex)
+	{
+		fs::path header = corpusDirectory / "Include" / "Header0.h";
+
+		std::ofstream(header, std::ios::app) << "\n//Modification " << modificationIndex;
+
+		fs::last_write_time(header, fs::file_time_type::clock::now() + std::chrono::seconds(modificationIndex));
+	}
+}
+
+/**
+*	Regenerate the whole synthetic corpus with an increasing number of threads.
+*/
+static void GeneratorScaling(benchmark::State& state)
+{
+	fs::path corpusDirectory = generator_benchmarks::getCorpusDirectory();
+	generator_benchmarks::createCorpus(corpusDirectory);
+
+	generator_benchmarks::Generator generator(corpusDirectory, static_cast<kodgen::uint32>(state.range(0)));
+
+	if (!generator.isSettingsLoaded)
+	{
+		state.SkipWithError("Settings loading failed.");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		if (!generator.codeGenMgr.run(generator.fileParser, generator.codeGenUnit, true).completed)
+		{
+			state.SkipWithError("Generation failed to complete successfully.");
+			break;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * generator_benchmarks::headersCount);
+
+	fs::remove_all(corpusDirectory);
+}
+BENCHMARK(GeneratorScaling)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+*	Bring the corpus up-to-date after a single header change, the way a cold generator invocation does:
+*	the settings are loaded, the threads are started and the cache file is loaded again for each change.
+*/
+static void GeneratorSingleChangeCold(benchmark::State& state)
+{
+	fs::path corpusDirectory = generator_benchmarks::getCorpusDirectory();
+	generator_benchmarks::createCorpus(corpusDirectory);
+
+	int modificationIndex = 0;
+
+	{
+		//Generate the whole corpus once so that the cache file exists
+		generator_benchmarks::Generator generator(corpusDirectory, static_cast<kodgen::uint32>(state.range(0)));
+		rfk::IncrementalGenerator incrementalGenerator(generator.codeGenMgr.settings, generator.fileParser.getSettings(), generator.codeGenUnitSettings, 0u);
+
+		if (!generator.isSettingsLoaded || !incrementalGenerator.run(generator.logger, generator.codeGenMgr, generator.fileParser, generator.codeGenUnit).completed)
+		{
+			state.SkipWithError("Initial generation failed to complete successfully.");
+			return;
+		}
+	}
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		generator_benchmarks::modifyHeader(corpusDirectory, ++modificationIndex);
+		state.ResumeTiming();
+
+		generator_benchmarks::Generator generator(corpusDirectory, static_cast<kodgen::uint32>(state.range(0)));
+		rfk::IncrementalGenerator incrementalGenerator(generator.codeGenMgr.settings, generator.fileParser.getSettings(), generator.codeGenUnitSettings, 0u);
+		incrementalGenerator.loadCache();
+
+		if (!incrementalGenerator.run(generator.logger, generator.codeGenMgr, generator.fileParser, generator.codeGenUnit).completed)
+		{
+			state.SkipWithError("Generation failed to complete successfully.");
+			break;
+		}
+	}
+
+	fs::remove_all(corpusDirectory);
+}
+BENCHMARK(GeneratorSingleChangeCold)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+*	Bring the corpus up-to-date after a single header change, the way the generator daemon does:
+*	the settings, the threads and the hashes of the unchanged files are kept between changes.
+*/
+static void GeneratorSingleChangeWarm(benchmark::State& state)
+{
+	fs::path corpusDirectory = generator_benchmarks::getCorpusDirectory();
+	generator_benchmarks::createCorpus(corpusDirectory);
+
+	int modificationIndex = 0;
+
+	generator_benchmarks::Generator generator(corpusDirectory, static_cast<kodgen::uint32>(state.range(0)));
+	rfk::IncrementalGenerator incrementalGenerator(generator.codeGenMgr.settings, generator.fileParser.getSettings(), generator.codeGenUnitSettings, 0u);
+
+	if (!generator.isSettingsLoaded || !incrementalGenerator.run(generator.logger, generator.codeGenMgr, generator.fileParser, generator.codeGenUnit).completed)
+	{
+		state.SkipWithError("Initial generation failed to complete successfully.");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		generator_benchmarks::modifyHeader(corpusDirectory, ++modificationIndex);
+		state.ResumeTiming();
+
+		if (!incrementalGenerator.run(generator.logger, generator.codeGenMgr, generator.fileParser, generator.codeGenUnit).completed)
+		{
+			state.SkipWithError("Generation failed to complete successfully.");
+			break;
+		}
+	}
+
+	fs::remove_all(corpusDirectory);
+}
+BENCHMARK(GeneratorSingleChangeWarm)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
\ No newline at end of file
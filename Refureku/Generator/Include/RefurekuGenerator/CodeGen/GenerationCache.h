@@ -0,0 +1,272 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iterator>	//std::next
+#include <algorithm>	//std::sort
+#include <unordered_map>
+#include <unordered_set>
+
+#include <Kodgen/Misc/Filesystem.h>
+#include <Kodgen/Misc/FundamentalTypes.h>
+
+namespace rfk
+{
+	/**
+	*	Persistent cache of the content hash of each processed file, so that only the files whose
+	*	reflection-relevant content changed since the last generation are regenerated.
+	*	The hash of a file covers its content and the content of all the project files it includes,
+	*	ignoring comments and whitespaces, so that touching or reformatting a file doesn't trigger its regeneration.
+	*/
+	class GenerationCache
+	{
+		public:
+			using Hash = kodgen::uint64;
+
+			/** Generated file as it was before a regeneration. */
+			struct OutputSnapshot
+			{
+				/** Path to the generated file. */
+				fs::path			path;
+
+				/** Content of the generated file. */
+				std::string			content;
+
+				/** Last write time of the generated file. */
+				fs::file_time_type	lastWriteTime;
+			};
+
+		private:
+			/** Version of the cache file format. Must be bumped whenever the generated code changes so that all caches are invalidated. */
+			static constexpr kodgen::uint32	_version			= 1u;
+
+			/** FNV-1a offset basis, seed of all hashes. */
+			static constexpr Hash			_fnvOffsetBasis		= 14695981039346656037ull;
+
+			/** FNV-1a prime. */
+			static constexpr Hash			_fnvPrime			= 1099511628211ull;
+
+			/** File level data computed once per file. */
+			struct FileData
+			{
+				/** Hash of the normalized content of the file. */
+				Hash						contentHash;
+
+				/** Project files directly included by the file. */
+				std::vector<std::string>	includedFiles;
+
+				/** Last write time of the file when it was read. */
+				fs::file_time_type			lastWriteTime;
+			};
+
+			/** Path to the cache file. */
+			fs::path									_cacheFilePath;
+
+			/** Hash of the settings the cached files were generated with. */
+			Hash										_settingsHash;
+
+			/** Hash of each processed file indexed by canonical path. */
+			std::unordered_map<std::string, Hash>		_fileHashes;
+
+			/** Directories used to resolve the included files. */
+			std::vector<fs::path>						_includeDirectories;
+
+			/** Directories whose files are never part of a hash (generated files). */
+			std::vector<fs::path>						_ignoredDirectories;
+
+			/** Data of the files read since the cache creation, indexed by canonical path. */
+			std::unordered_map<std::string, FileData>	_filesData;
+
+			/**
+			*	@brief Get the canonical path of a file as a string.
+			*
+			*	@param path Path to the file.
+			*
+			*	@return The canonical path of the file.
+			*/
+			static inline std::string	getCanonicalPath(fs::path const& path)									noexcept;
+
+			/**
+			*	@brief Read the whole content of a file.
+			*
+			*	@param path			Path to the file.
+			*	@param out_content	String receiving the content of the file.
+			*
+			*	@return true if the file could be read, else false.
+			*/
+			static inline bool			readFile(fs::path const&	path,
+												 std::string&		out_content)								noexcept;
+
+			/**
+			*	@brief Check whether a path is located in one of the ignored directories.
+			*
+			*	@param path The checked path.
+			*
+			*	@return true if the path is ignored, else false.
+			*/
+			inline bool					isIgnored(fs::path const& path)								const	noexcept;
+
+			/**
+			*	@brief	Resolve a quoted include of a file against the directory of the file, then against the include directories.
+			*
+			*	@param includingFile	Canonical path of the file containing the include directive.
+			*	@param includedFile		Path written in the include directive.
+			*
+			*	@return The canonical path to the included file, or an empty string if it is not a project file.
+			*/
+			inline std::string			resolveInclude(std::string const&	includingFile,
+													   std::string const&	includedFile)			const	noexcept;
+
+			/**
+			*	@brief Get the data of a file, reading it the first time.
+			*
+			*	@param canonicalPath Canonical path of the file.
+			*
+			*	@return The data of the file, nullptr if the file can't be read.
+			*/
+			inline FileData const*		getFileData(std::string const& canonicalPath)						noexcept;
+
+		public:
+			/**
+			*	@param cacheFilePath	Path to the file the cache is loaded from and saved to.
+			*	@param settingsHash		Hash of the generation settings. The cache is invalidated when it changes.
+			*/
+			GenerationCache(fs::path cacheFilePath,
+							Hash	 settingsHash)	noexcept;
+
+			/**
+			*	@brief Hash some data with FNV-1a.
+			*
+			*	@param data	Pointer to the data.
+			*	@param size	Size of the data in bytes.
+			*	@param seed	Hash to continue, to hash several chunks of data together.
+			*
+			*	@return The hash of the data.
+			*/
+			static inline Hash			hash(void const*	data,
+											 std::size_t	size,
+											 Hash			seed = _fnvOffsetBasis)							noexcept;
+
+			/**
+			*	@brief	Strip the comments and the whitespaces which don't separate tokens from a source file content.
+			*			Line breaks are kept since they end preprocessor directives. String and character literals are left untouched.
+			*
+			*	@param content Content of a source file.
+			*
+			*	@return The normalized content.
+			*/
+			static inline std::string	normalizeContent(std::string const& content)						noexcept;
+
+			/**
+			*	@brief Add a directory used to resolve the files included by the processed files.
+			*
+			*	@param directory The include directory.
+			*/
+			inline void					addIncludeDirectory(fs::path const& directory)						noexcept;
+
+			/**
+			*	@brief Add a directory whose files are never part of a hash, typically the directory of the generated files.
+			*
+			*	@param directory The ignored directory.
+			*/
+			inline void					addIgnoredDirectory(fs::path const& directory)						noexcept;
+
+			/**
+			*	@brief	Forget the data of the files modified or removed since they were read, so that the next hash computations read them again.
+			*			The files are only read once otherwise, which lets a long-running generator keep the data of the unchanged files.
+			*/
+			inline void					refreshFilesData()													noexcept;
+
+			/**
+			*	@brief	Compute the hash of a file, covering its normalized content and the normalized content
+			*			of all the project files it includes directly or indirectly.
+			*
+			*	@param file Path to the file.
+			*
+			*	@return The hash of the file.
+			*/
+			inline Hash					computeFileHash(fs::path const& file)								noexcept;
+
+			/**
+			*	@brief Check whether a file was generated from content with the given hash.
+			*
+			*	@param file		Path to the file.
+			*	@param fileHash	Current hash of the file.
+			*
+			*	@return true if the cached hash of the file is the given hash, else false.
+			*/
+			inline bool					isUpToDate(fs::path const&	file,
+												   Hash				fileHash)							const	noexcept;
+
+			/**
+			*	@brief Set the hash a file has been generated from.
+			*
+			*	@param file		Path to the file.
+			*	@param fileHash	Hash of the file.
+			*/
+			inline void					update(fs::path const&	file,
+											   Hash				fileHash)									noexcept;
+
+			/**
+			*	@brief Remove a file from the cache so that it is regenerated next time.
+			*
+			*	@param file Path to the file.
+			*/
+			inline void					invalidate(fs::path const& file)									noexcept;
+
+			/**
+			*	@brief	Remove all the files which are not part of the given files from the cache.
+			*
+			*	@param files The files to keep.
+			*
+			*	@return The number of removed files.
+			*/
+			inline std::size_t			keepOnly(std::vector<fs::path> const& files)						noexcept;
+
+			/**
+			*	@brief	Load the cache file. If the file doesn't exist, or was saved by another version or with other settings,
+			*			the cache is left empty so that all files are regenerated.
+			*
+			*	@return true if the cache file was loaded, else false.
+			*/
+			inline bool					load()																noexcept;
+
+			/**
+			*	@brief Save the cache to the cache file.
+			*
+			*	@return true if the cache file was written, else false.
+			*/
+			inline bool					save()														const	noexcept;
+
+			/**
+			*	@brief	Record the content and last write time of a generated file before it is regenerated.
+			*			Nothing is recorded if the file doesn't exist yet.
+			*
+			*	@param path				Path to the generated file.
+			*	@param out_snapshots	Snapshots receiving the generated file.
+			*/
+			static inline void			snapshotOutput(fs::path const&				path,
+													   std::vector<OutputSnapshot>&	out_snapshots)				noexcept;
+
+			/**
+			*	@brief	Give back their previous last write time to the regenerated files whose content didn't change,
+			*			so that the build system doesn't recompile the files including them.
+			*
+			*	@param snapshots Snapshots of the generated files taken before their regeneration.
+			*
+			*	@return The number of regenerated files whose content didn't change.
+			*/
+			static inline std::size_t	restoreUnchangedOutputs(std::vector<OutputSnapshot> const& snapshots)	noexcept;
+	};
+
+	#include "RefurekuGenerator/CodeGen/GenerationCache.inl"
+}
\ No newline at end of file
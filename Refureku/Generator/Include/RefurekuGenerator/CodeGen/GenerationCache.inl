@@ -0,0 +1,419 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline GenerationCache::GenerationCache(fs::path cacheFilePath, Hash settingsHash) noexcept:
+	_cacheFilePath{std::move(cacheFilePath)},
+	_settingsHash{settingsHash}
+{
+}
+
+inline GenerationCache::Hash GenerationCache::hash(void const* data, std::size_t size, Hash seed) noexcept
+{
+	unsigned char const* bytes = static_cast<unsigned char const*>(data);
+
+	for (std::size_t i = 0u; i < size; i++)
+	{
+		seed = (seed ^ bytes[i]) * _fnvPrime;
+	}
+
+	return seed;
+}
+
+inline std::string GenerationCache::getCanonicalPath(fs::path const& path) noexcept
+{
+	std::error_code error;
+	fs::path		canonicalPath = fs::weakly_canonical(path, error);
+
+	return (error) ? path.lexically_normal().string() : canonicalPath.string();
+}
+
+inline bool GenerationCache::readFile(fs::path const& path, std::string& out_content) noexcept
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	out_content = stream.str();
+
+	return true;
+}
+
+inline std::string GenerationCache::normalizeContent(std::string const& content) noexcept
+{
+	std::string result;
+	result.reserve(content.size());
+
+	bool pendingSpace = false;
+
+	auto appendChar = [&result, &pendingSpace](char c)
+	{
+		//Whitespaces only matter between 2 tokens of the same line
+		if (pendingSpace && !result.empty() && result.back() != '\n')
+		{
+			result.push_back(' ');
+		}
+
+		pendingSpace = false;
+		result.push_back(c);
+	};
+
+	for (std::size_t i = 0u; i < content.size(); i++)
+	{
+		char c = content[i];
+
+		if (c == '/' && i + 1u < content.size() && content[i + 1u] == '/')
+		{
+			//Skip until the end of the line, the line break itself being handled on the next iteration
+			while (i + 1u < content.size() && content[i + 1u] != '\n')
+			{
+				i++;
+			}
+		}
+		else if (c == '/' && i + 1u < content.size() && content[i + 1u] == '*')
+		{
+			std::size_t commentEnd = content.find("*/", i + 2u);
+
+			i				= (commentEnd == std::string::npos) ? content.size() : commentEnd + 1u;
+			pendingSpace	= true;
+		}
+		else if (c == '"' || c == '\'')
+		{
+			appendChar(c);
+
+			//Copy the literal as is, until its closing quote or the end of the line
+			for (i++; i < content.size() && content[i] != '\n'; i++)
+			{
+				result.push_back(content[i]);
+
+				if (content[i] == '\\' && i + 1u < content.size())
+				{
+					result.push_back(content[++i]);
+				}
+				else if (content[i] == c)
+				{
+					break;
+				}
+			}
+
+			if (i < content.size() && content[i] == '\n')
+			{
+				i--;
+			}
+		}
+		else if (c == '\n')
+		{
+			if (!result.empty() && result.back() != '\n')
+			{
+				result.push_back('\n');
+			}
+
+			pendingSpace = false;
+		}
+		else if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v')
+		{
+			pendingSpace = true;
+		}
+		else
+		{
+			appendChar(c);
+		}
+	}
+
+	return result;
+}
+
+inline void GenerationCache::addIncludeDirectory(fs::path const& directory) noexcept
+{
+	_includeDirectories.emplace_back(getCanonicalPath(directory));
+}
+
+inline void GenerationCache::addIgnoredDirectory(fs::path const& directory) noexcept
+{
+	_ignoredDirectories.emplace_back(getCanonicalPath(directory));
+}
+
+inline bool GenerationCache::isIgnored(fs::path const& path) const noexcept
+{
+	for (fs::path const& ignoredDirectory : _ignoredDirectories)
+	{
+		fs::path relativePath = path.lexically_relative(ignoredDirectory);
+
+		if (!relativePath.empty() && *relativePath.begin() != "..")
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+inline std::string GenerationCache::resolveInclude(std::string const& includingFile, std::string const& includedFile) const noexcept
+{
+	std::error_code error;
+
+	auto resolveFrom = [this, &includedFile, &error](fs::path const& directory) -> std::string
+	{
+		fs::path path = directory / includedFile;
+
+		if (fs::is_regular_file(path, error))
+		{
+			std::string canonicalPath = getCanonicalPath(path);
+
+			return isIgnored(canonicalPath) ? std::string() : canonicalPath;
+		}
+
+		return std::string();
+	};
+
+	std::string result = resolveFrom(fs::path(includingFile).parent_path());
+
+	for (std::size_t i = 0u; result.empty() && i < _includeDirectories.size(); i++)
+	{
+		result = resolveFrom(_includeDirectories[i]);
+	}
+
+	return result;
+}
+
+inline GenerationCache::FileData const* GenerationCache::getFileData(std::string const& canonicalPath) noexcept
+{
+	auto it = _filesData.find(canonicalPath);
+
+	if (it != _filesData.end())
+	{
+		return &it->second;
+	}
+
+	std::string		content;
+	std::error_code	error;
+	FileData		fileData;
+
+	//Get the last write time before reading so that a modification during the read is caught by the next refresh
+	fileData.lastWriteTime = fs::last_write_time(canonicalPath, error);
+
+	if (error || !readFile(canonicalPath, content))
+	{
+		return nullptr;
+	}
+
+	content					= normalizeContent(content);
+	fileData.contentHash	= hash(content.data(), content.size());
+
+	//Collect the quoted includes, which are the only ones that can target project files
+	std::istringstream	stream(content);
+	std::string			line;
+
+	while (std::getline(stream, line))
+	{
+		if (line.empty() || line[0] != '#')
+		{
+			continue;
+		}
+
+		std::size_t directiveStart = line.find_first_not_of(' ', 1u);
+
+		if (directiveStart == std::string::npos || line.compare(directiveStart, 7u, "include") != 0)
+		{
+			continue;
+		}
+
+		std::size_t pathStart	= line.find('"', directiveStart + 7u);
+		std::size_t pathEnd		= (pathStart == std::string::npos) ? std::string::npos : line.find('"', pathStart + 1u);
+
+		if (pathEnd != std::string::npos)
+		{
+			std::string includedFile = resolveInclude(canonicalPath, line.substr(pathStart + 1u, pathEnd - pathStart - 1u));
+
+			if (!includedFile.empty())
+			{
+				fileData.includedFiles.push_back(std::move(includedFile));
+			}
+		}
+	}
+
+	return &_filesData.emplace(canonicalPath, std::move(fileData)).first->second;
+}
+
+inline void GenerationCache::refreshFilesData() noexcept
+{
+	std::error_code error;
+
+	for (auto it = _filesData.begin(); it != _filesData.end();)
+	{
+		fs::file_time_type lastWriteTime = fs::last_write_time(it->first, error);
+
+		it = (error || lastWriteTime != it->second.lastWriteTime) ? _filesData.erase(it) : std::next(it);
+	}
+}
+
+inline GenerationCache::Hash GenerationCache::computeFileHash(fs::path const& file) noexcept
+{
+	//Gather the file and all the files it includes, include cycles being possible thanks to include guards
+	std::vector<std::string>		toVisit{getCanonicalPath(file)};
+	std::unordered_set<std::string>	visited{toVisit.back()};
+	std::vector<std::string>		includedFiles;
+
+	while (!toVisit.empty())
+	{
+		std::string path = std::move(toVisit.back());
+		toVisit.pop_back();
+
+		if (FileData const* fileData = getFileData(path))
+		{
+			for (std::string const& includedFile : fileData->includedFiles)
+			{
+				if (visited.insert(includedFile).second)
+				{
+					toVisit.push_back(includedFile);
+					includedFiles.push_back(includedFile);
+				}
+			}
+		}
+	}
+
+	//Sort the included files so that the hash doesn't depend on the traversal order
+	std::sort(includedFiles.begin(), includedFiles.end());
+
+	FileData const* fileData	= getFileData(getCanonicalPath(file));
+	Hash			result		= (fileData != nullptr) ? fileData->contentHash : _fnvOffsetBasis;
+
+	for (std::string const& includedFile : includedFiles)
+	{
+		FileData const* includedFileData = getFileData(includedFile);
+
+		result = hash(includedFile.data(), includedFile.size(), result);
+
+		if (includedFileData != nullptr)
+		{
+			result = hash(&includedFileData->contentHash, sizeof(Hash), result);
+		}
+	}
+
+	return result;
+}
+
+inline bool GenerationCache::isUpToDate(fs::path const& file, Hash fileHash) const noexcept
+{
+	auto it = _fileHashes.find(getCanonicalPath(file));
+
+	return it != _fileHashes.end() && it->second == fileHash;
+}
+
+inline void GenerationCache::update(fs::path const& file, Hash fileHash) noexcept
+{
+	_fileHashes[getCanonicalPath(file)] = fileHash;
+}
+
+inline void GenerationCache::invalidate(fs::path const& file) noexcept
+{
+	_fileHashes.erase(getCanonicalPath(file));
+}
+
+inline std::size_t GenerationCache::keepOnly(std::vector<fs::path> const& files) noexcept
+{
+	std::unordered_map<std::string, Hash> fileHashes;
+
+	for (fs::path const& file : files)
+	{
+		auto it = _fileHashes.find(getCanonicalPath(file));
+
+		if (it != _fileHashes.end())
+		{
+			fileHashes.emplace(*it);
+		}
+	}
+
+	std::size_t removedFilesCount = _fileHashes.size() - fileHashes.size();
+
+	_fileHashes = std::move(fileHashes);
+
+	return removedFilesCount;
+}
+
+inline bool GenerationCache::load() noexcept
+{
+	_fileHashes.clear();
+
+	std::ifstream file(_cacheFilePath);
+
+	std::string		header;
+	kodgen::uint32	version			= 0u;
+	Hash			settingsHash	= 0u;
+
+	if (!(file >> header >> version >> settingsHash) || header != "RefurekuGeneratorCache" || version != _version || settingsHash != _settingsHash)
+	{
+		return false;
+	}
+
+	Hash		fileHash;
+	std::string	filePath;
+
+	//Each line is the hash of a file followed by its path, which may contain spaces
+	while (file >> fileHash && file.get() == ' ' && std::getline(file, filePath))
+	{
+		_fileHashes.emplace(std::move(filePath), fileHash);
+	}
+
+	return true;
+}
+
+inline bool GenerationCache::save() const noexcept
+{
+	std::ofstream file(_cacheFilePath, std::ios::trunc);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "RefurekuGeneratorCache " << _version << " " << _settingsHash << "\n";
+
+	for (auto const& [filePath, fileHash] : _fileHashes)
+	{
+		file << fileHash << " " << filePath << "\n";
+	}
+
+	return static_cast<bool>(file);
+}
+
+inline void GenerationCache::snapshotOutput(fs::path const& path, std::vector<OutputSnapshot>& out_snapshots) noexcept
+{
+	std::error_code	error;
+	OutputSnapshot	snapshot{path, std::string(), fs::last_write_time(path, error)};
+
+	if (!error && readFile(path, snapshot.content))
+	{
+		out_snapshots.push_back(std::move(snapshot));
+	}
+}
+
+inline std::size_t GenerationCache::restoreUnchangedOutputs(std::vector<OutputSnapshot> const& snapshots) noexcept
+{
+	std::size_t		unchangedOutputsCount = 0u;
+	std::string		content;
+	std::error_code	error;
+
+	for (OutputSnapshot const& snapshot : snapshots)
+	{
+		if (readFile(snapshot.path, content) && content == snapshot.content)
+		{
+			fs::last_write_time(snapshot.path, snapshot.lastWriteTime, error);
+
+			if (!error)
+			{
+				unchangedOutputsCount++;
+			}
+		}
+	}
+
+	return unchangedOutputsCount;
+}
\ No newline at end of file
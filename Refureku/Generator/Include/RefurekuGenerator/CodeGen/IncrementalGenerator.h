@@ -0,0 +1,121 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+#include <utility>	//std::pair
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+
+#include <Kodgen/Misc/ILogger.h>
+#include <Kodgen/Misc/FilesystemHelpers.h>
+#include <Kodgen/CodeGen/CodeGenManager.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+
+#include "RefurekuGenerator/Parsing/FileParser.h"
+#include "RefurekuGenerator/CodeGen/GenerationCache.h"
+
+namespace rfk
+{
+	/**
+	*	Run the code gen manager on the files whose content hash changed since their last generation only.
+	*	The generation cache is kept between runs, so that a long-running generator only reads the files modified since the previous run.
+	*/
+	class IncrementalGenerator
+	{
+		private:
+			/** Settings of the code gen manager as loaded, since the files to process are overwritten before each run. */
+			kodgen::CodeGenManagerSettings							_codeGenMgrSettings;
+
+			/** Settings of the code gen unit, used to find the generated files of a processed file. */
+			kodgen::MacroCodeGenUnitSettings const&					_codeGenUnitSettings;
+
+			/** Directory containing the generated files. */
+			fs::path												_outputDirectory;
+
+			/** Content hash of the processed files. */
+			GenerationCache											_cache;
+
+			/** Hash of the files whose last generation failed, so that they are not regenerated again until they change. */
+			std::unordered_map<std::string, GenerationCache::Hash>	_failedFileHashes;
+
+			/**
+			*	@brief List the files to process, the same way the code gen manager does.
+			*
+			*	@param settings Settings of the code gen manager.
+			*
+			*	@return The sanitized paths of the files to process.
+			*/
+			static inline std::vector<fs::path>	collectToProcessFiles(kodgen::CodeGenManagerSettings const& settings)	noexcept;
+
+			/**
+			*	@brief Check whether the last generation of a file failed and the file didn't change since then.
+			*
+			*	@param file		Path to the file.
+			*	@param fileHash	Current hash of the file.
+			*
+			*	@return true if the file failed to generate with the same content, else false.
+			*/
+			inline bool							isFailedFile(fs::path const&		file,
+															 GenerationCache::Hash	fileHash)					const	noexcept;
+
+		public:
+			/**
+			*	@param codeGenMgrSettings	Loaded settings of the code gen manager.
+			*	@param parsingSettings		Loaded settings of the file parser.
+			*	@param codeGenUnitSettings	Loaded settings of the code gen unit. Must outlive the incremental generator.
+			*	@param settingsHash			Hash of the settings. The cache is invalidated when it changes.
+			*/
+			inline IncrementalGenerator(kodgen::CodeGenManagerSettings const&	codeGenMgrSettings,
+										kodgen::ParsingSettings const&			parsingSettings,
+										kodgen::MacroCodeGenUnitSettings const&	codeGenUnitSettings,
+										GenerationCache::Hash					settingsHash)		noexcept;
+
+			/**
+			*	@brief Compute the hash of the generation settings.
+			*
+			*	@param settingsFilePath	Path to the settings file. Its content is hashed.
+			*	@param moduleName		Name of the module the generated entities are registered to.
+			*
+			*	@return The hash of the generation settings.
+			*/
+			static inline GenerationCache::Hash	computeSettingsHash(fs::path const&		settingsFilePath,
+																	std::string const&	moduleName)		noexcept;
+
+			/**
+			*	@brief	Load the cache file.
+			*
+			*	@return true if the cache file was loaded, false if all files must be regenerated.
+			*/
+			inline bool							loadCache()												noexcept;
+
+			/**
+			*	@brief	Regenerate the files whose content hash changed, and give back their previous last write time
+			*			to the regenerated files whose content didn't change. The cache file is saved afterwards.
+			*
+			*	@param logger				Logger used to issue logs.
+			*	@param codeGenMgr			Code gen manager running the generation. Its files to process are overwritten.
+			*	@param fileParser			Parser used to parse the dirty files.
+			*	@param codeGenUnit			Code gen unit used to generate the dirty files.
+			*	@param retryFailedFiles		Should the files whose previous generation failed be regenerated even if they didn't change.
+			*
+			*	@return The result of the generation. Files left untouched are reported as up-to-date.
+			*/
+			inline kodgen::CodeGenResult		run(kodgen::ILogger&			logger,
+													kodgen::CodeGenManager&		codeGenMgr,
+													rfk::FileParser&			fileParser,
+													kodgen::MacroCodeGenUnit&	codeGenUnit,
+													bool						retryFailedFiles = true)		noexcept;
+	};
+
+	#include "RefurekuGenerator/CodeGen/IncrementalGenerator.inl"
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline IncrementalGenerator::IncrementalGenerator(kodgen::CodeGenManagerSettings const& codeGenMgrSettings, kodgen::ParsingSettings const& parsingSettings,
+												  kodgen::MacroCodeGenUnitSettings const& codeGenUnitSettings, GenerationCache::Hash settingsHash) noexcept:
+	_codeGenMgrSettings{codeGenMgrSettings},
+	_codeGenUnitSettings{codeGenUnitSettings},
+	_outputDirectory{kodgen::FilesystemHelpers::sanitizePath(codeGenUnitSettings.getOutputDirectory())},
+	_cache{_outputDirectory / "RefurekuGenerator.cache", settingsHash}
+{
+	_cache.addIgnoredDirectory(_outputDirectory);
+
+	for (fs::path const& includeDirectory : parsingSettings.getProjectIncludeDirectories())
+	{
+		_cache.addIncludeDirectory(includeDirectory);
+	}
+}
+
+inline std::vector<fs::path> IncrementalGenerator::collectToProcessFiles(kodgen::CodeGenManagerSettings const& settings) noexcept
+{
+	auto isSupported = [&settings](fs::path const& file)
+	{
+		for (auto const& extension : settings.getSupportedFileExtensions())
+		{
+			if (file.extension() == extension)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	auto isIgnored = [&settings](fs::path const& file)
+	{
+		for (fs::path const& ignoredFile : settings.getIgnoredFiles())
+		{
+			if (kodgen::FilesystemHelpers::sanitizePath(ignoredFile) == file)
+			{
+				return true;
+			}
+		}
+
+		for (fs::path const& ignoredDirectory : settings.getIgnoredDirectories())
+		{
+			fs::path relativePath = file.lexically_relative(kodgen::FilesystemHelpers::sanitizePath(ignoredDirectory));
+
+			if (!relativePath.empty() && *relativePath.begin() != "..")
+			{
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	std::set<fs::path>	files;
+	std::error_code		error;
+
+	for (fs::path const& file : settings.getToProcessFiles())
+	{
+		fs::path sanitizedFile = kodgen::FilesystemHelpers::sanitizePath(file);
+
+		if (fs::is_regular_file(sanitizedFile, error) && !isIgnored(sanitizedFile))
+		{
+			files.insert(std::move(sanitizedFile));
+		}
+	}
+
+	for (fs::path const& directory : settings.getToProcessDirectories())
+	{
+		//Files may be removed while the directory is being iterated, so skip them instead of throwing
+		for (fs::recursive_directory_iterator directoryIt = fs::recursive_directory_iterator(kodgen::FilesystemHelpers::sanitizePath(directory), fs::directory_options::follow_directory_symlink, error);
+			 !error && directoryIt != fs::recursive_directory_iterator(); directoryIt.increment(error))
+		{
+			fs::path file = kodgen::FilesystemHelpers::sanitizePath(directoryIt->path());
+
+			if (directoryIt->is_regular_file(error) && isSupported(file) && !isIgnored(file))
+			{
+				files.insert(std::move(file));
+			}
+		}
+
+		error.clear();
+	}
+
+	return std::vector<fs::path>(files.begin(), files.end());
+}
+
+inline bool IncrementalGenerator::isFailedFile(fs::path const& file, GenerationCache::Hash fileHash) const noexcept
+{
+	auto it = _failedFileHashes.find(file.string());
+
+	return it != _failedFileHashes.end() && it->second == fileHash;
+}
+
+inline GenerationCache::Hash IncrementalGenerator::computeSettingsHash(fs::path const& settingsFilePath, std::string const& moduleName) noexcept
+{
+	std::ifstream		settingsFile(settingsFilePath, std::ios::binary);
+	std::ostringstream	settings;
+
+	if (settingsFile)
+	{
+		settings << settingsFile.rdbuf();
+	}
+
+	std::string settingsContent = settings.str();
+
+	GenerationCache::Hash result = GenerationCache::hash(settingsContent.data(), settingsContent.size());
+
+	return GenerationCache::hash(moduleName.data(), moduleName.size(), result);
+}
+
+inline bool IncrementalGenerator::loadCache() noexcept
+{
+	return _cache.load();
+}
+
+inline kodgen::CodeGenResult IncrementalGenerator::run(kodgen::ILogger& logger, kodgen::CodeGenManager& codeGenMgr, rfk::FileParser& fileParser, kodgen::MacroCodeGenUnit& codeGenUnit,
+															 bool retryFailedFiles) noexcept
+{
+	//Only the files modified since the previous run are read again
+	_cache.refreshFilesData();
+
+	std::vector<fs::path>									toProcessFiles = collectToProcessFiles(_codeGenMgrSettings);
+	std::vector<std::pair<fs::path, GenerationCache::Hash>>	dirtyFiles;
+	std::vector<GenerationCache::OutputSnapshot>			outputSnapshots;
+	kodgen::CodeGenResult									genResult;
+	std::error_code											error;
+
+	for (fs::path const& file : toProcessFiles)
+	{
+		GenerationCache::Hash	fileHash		= _cache.computeFileHash(file);
+		fs::path				generatedHeader	= _outputDirectory / _codeGenUnitSettings.getGeneratedHeaderFileName(file);
+		fs::path				generatedSource	= _outputDirectory / _codeGenUnitSettings.getGeneratedSourceFileName(file);
+
+		if (_cache.isUpToDate(file, fileHash) && fs::exists(generatedHeader, error) && fs::exists(generatedSource, error))
+		{
+			genResult.upToDateFiles.push_back(file);
+		}
+		else if (!retryFailedFiles && isFailedFile(file, fileHash))
+		{
+			continue;
+		}
+		else
+		{
+			dirtyFiles.emplace_back(file, fileHash);
+
+			GenerationCache::snapshotOutput(generatedHeader, outputSnapshots);
+			GenerationCache::snapshotOutput(generatedSource, outputSnapshots);
+		}
+	}
+
+	//Forget the files which are not processed anymore
+	bool isCacheModified = _cache.keepOnly(toProcessFiles) != 0u || !dirtyFiles.empty();
+
+	if (dirtyFiles.empty())
+	{
+		genResult.completed = true;
+	}
+	else
+	{
+		//Only process the dirty files, whatever their timestamp
+		codeGenMgr.settings = _codeGenMgrSettings;
+		codeGenMgr.settings.clearToProcessDirectories();
+		codeGenMgr.settings.clearToProcessFiles();
+
+		for (auto const& [file, fileHash] : dirtyFiles)
+		{
+			codeGenMgr.settings.addToProcessFile(file);
+		}
+
+		std::vector<fs::path> upToDateFiles = std::move(genResult.upToDateFiles);
+
+		genResult = codeGenMgr.run(fileParser, codeGenUnit, true);
+		genResult.upToDateFiles.insert(genResult.upToDateFiles.end(), upToDateFiles.begin(), upToDateFiles.end());
+
+		//A failed generation may have stopped anywhere, so retry all the dirty files next time
+		for (auto const& [file, fileHash] : dirtyFiles)
+		{
+			if (genResult.completed)
+			{
+				_cache.update(file, fileHash);
+				_failedFileHashes.erase(file.string());
+			}
+			else
+			{
+				_cache.invalidate(file);
+				_failedFileHashes[file.string()] = fileHash;
+			}
+		}
+
+		//Files including unchanged generated files don't need to be recompiled
+		std::size_t unchangedOutputsCount = GenerationCache::restoreUnchangedOutputs(outputSnapshots);
+
+		logger.log(std::to_string(unchangedOutputsCount) + " regenerated file(s) with unchanged content kept their modification time.", kodgen::ILogger::ELogSeverity::Info);
+	}
+
+	//Don't rewrite the cache file when nothing changed, a long-running generator checking for changes continuously
+	if (isCacheModified && !_cache.save())
+	{
+		logger.log("Failed to save the generation cache.", kodgen::ILogger::ELogSeverity::Warning);
+	}
+
+	return genResult;
+}
\ No newline at end of file
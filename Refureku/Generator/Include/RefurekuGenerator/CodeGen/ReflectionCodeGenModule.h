@@ -33,12 +33,21 @@ namespace rfk
 			/** Code generator for the PropertySettings property. */
 			PropertySettingsPropertyCodeGen				_propertySettingsProperty;
 
-			/** Dictionnary used to generate properties code. */
+			/** Dictionnary used to generate properties code. Per-file state, never copied to clones. */
 			std::unordered_map<std::string, int>		_propertiesCount;
 
-			/** Flag that determines whether the currently generated code is hidden from the parser or not. */
+			/**
+			*	Flag that determines whether the currently generated code is hidden from the parser or not.
+			*	Per-file state, never copied to clones.
+			*/
 			bool										_isGeneratingHiddenCode;
 
+			/**
+			*	Name of the module the file level entities are registered to.
+			*	If empty, each file level entity registers itself to the database.
+			*/
+			std::string									_moduleName;
+
 			/**
 			*	@brief Compute the unique id of an entity. The returned string contains an unsigned integer.
 			*
@@ -283,7 +292,7 @@ namespace rfk
 												   std::string&					inout_result)							noexcept;
 
 			/**
-			*	@brief Generate code for registering the default constructor of a struct or class.
+			*	@brief Generate code for registering the default constructor, the destructor, the copy / move functions, the traits and the alignment of a struct or class.
 			* 
 			*	@param structClass				Target struct/class.
 			*	@param env						Code generation environment.
@@ -456,6 +465,18 @@ namespace rfk
 														 kodgen::MacroCodeGenEnv&	env,
 														 std::string&				inout_result)	const	noexcept;
 
+			/**
+			*	@brief	Generate the rfk::EnumStringTable template specialization for the provided enum.
+			*			The table is only generated for non-empty enums declared at file or namespace level.
+			* 
+			*	@param enum_		Target enum.
+			*	@param env			Code generation environment.
+			*	@param inout_result	String to append the generated code.
+			*/
+			void	defineEnumStringTableTemplateSpecialization(kodgen::EnumInfo const&	enum_,
+																kodgen::MacroCodeGenEnv&	env,
+																std::string&				inout_result)	const	noexcept;
+
 			/**
 			*	TODO
 			*/
@@ -541,6 +562,29 @@ namespace rfk
 																 kodgen::MacroCodeGenEnv&		env,
 																 std::string&					inout_result)				noexcept;
 
+			/**
+			*	@brief Compute the string literal of the module the generated registration code is attributed to in the registration trace.
+			* 
+			*	@param env Code generation environment.
+			* 
+			*	@return The module name if set, else the parsed file name, as a string literal.
+			*/
+			std::string	computeTraceModuleLiteral(kodgen::MacroCodeGenEnv& env)										const	noexcept;
+
+			/**
+			*	@brief	Compute the declaration of the variable registering a file level entity.
+			*			If a module name is set, the entity is added to the module registration table instead of being registered directly.
+			* 
+			*	@param defaultRegistererType	Registerer type used when no module name is set.
+			*	@param variableName				Name of the registerer variable.
+			*	@param registeredEntity			Expression evaluating to the registered entity.
+			* 
+			*	@return The registerer variable declaration.
+			*/
+			std::string	computeRegistererVariableDeclaration(std::string const&	defaultRegistererType,
+															 std::string const&	variableName,
+															 std::string const&	registeredEntity)						const	noexcept;
+
 			/**
 			*	@brief Define the namespace fragment registerer variable for the provided namespace.
 			* 
@@ -596,7 +640,20 @@ namespace rfk
 
 		public:
 			ReflectionCodeGenModule()								noexcept;
+
+			/**
+			*	@brief	Copy the configuration of a module (its module name) without its per-file generation state.
+			*			The code gen manager generates each file with its own clone, so clones can run concurrently on different threads.
+			*/
 			ReflectionCodeGenModule(ReflectionCodeGenModule const&)	noexcept;
+
+			/**
+			*	@brief	Register the file level entities of the generated files to a module handle instead of the database directly.
+			*			The module handle must be defined in the module with RFK_DEFINE_MODULE_HANDLE(moduleName).
+			* 
+			*	@param moduleName Name of the module. An empty name disables module registration.
+			*/
+			void setModuleName(std::string moduleName)	noexcept;
 	};
 
 	#include "RefurekuGenerator/CodeGen/ReflectionCodeGenModule.inl"
@@ -17,9 +17,15 @@ ReflectionCodeGenModule::ReflectionCodeGenModule() noexcept:
 	addPropertyCodeGen(_propertySettingsProperty);
 }
 
-ReflectionCodeGenModule::ReflectionCodeGenModule(ReflectionCodeGenModule const&) noexcept:
+ReflectionCodeGenModule::ReflectionCodeGenModule(ReflectionCodeGenModule const& other) noexcept:
 	ReflectionCodeGenModule()
 {
+	_moduleName = other._moduleName;
+}
+
+void ReflectionCodeGenModule::setModuleName(std::string moduleName) noexcept
+{
+	_moduleName = std::move(moduleName);
 }
 
 ReflectionCodeGenModule* ReflectionCodeGenModule::clone() const noexcept
@@ -170,6 +176,7 @@ kodgen::ETraversalBehaviour ReflectionCodeGenModule::generateHeaderFileFooterCod
 
 		case kodgen::EEntityType::Enum:
 			declareGetEnumTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
+			defineEnumStringTableTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
 
 			result = kodgen::ETraversalBehaviour::Continue; //Go to next enum
 			break;
@@ -341,6 +348,7 @@ void ReflectionCodeGenModule::includeHeaderFileHeaders(kodgen::MacroCodeGenEnv&
 		"#include <Refureku/TypeInfo/Archetypes/Template/TypeTemplateArgument.h>" + env.getSeparator() +					//TODO: Only when there is a template class
 		"#include <Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h>" + env.getSeparator() +					//TODO: Only when there is a template class
 		"#include <Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h>" + env.getSeparator() +				//TODO: Only when there is a template class
+		"#include <Refureku/TypeInfo/RegistrationTrace.h>" + env.getSeparator() +
 		env.getSeparator();
 }
 
@@ -355,6 +363,35 @@ void ReflectionCodeGenModule::includeSourceFileHeaders(kodgen::MacroCodeGenEnv&
 		"#include <Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateParameter.h>" + env.getSeparator() +	//TODO: Only if there is a template class in the parsed data
 		"#include <Refureku/TypeInfo/Archetypes/Template/TemplateTemplateParameter.h>" + env.getSeparator() +	//TODO: Only if there is a template class in the parsed data
 		env.getSeparator();
+
+	//Attribute the registerers of this file to its module in the registration trace (no-op unless RFK_REGISTRATION_TRACING is enabled).
+	//RegistrationTrace.h is already included by the generated header
+	inout_result += "RFK_TRACE_REGISTRATION_MODULE(registrationTraceModule_" + std::to_string(_stringHasher(env.getFileParsingResult()->parsedFile.string())) + ", " + computeTraceModuleLiteral(env) + ")" + env.getSeparator() +
+		env.getSeparator();
+
+	if (!_moduleName.empty())
+	{
+		inout_result += "#include <Refureku/TypeInfo/Module/ModuleEntityRegisterer.h>" + env.getSeparator() +
+			"RFK_DECLARE_MODULE_HANDLE(" + _moduleName + ")" + env.getSeparator() +
+			env.getSeparator();
+	}
+}
+
+std::string ReflectionCodeGenModule::computeTraceModuleLiteral(kodgen::MacroCodeGenEnv& env) const noexcept
+{
+	return "\"" + (_moduleName.empty() ? env.getFileParsingResult()->parsedFile.filename().string() : _moduleName) + "\"";
+}
+
+std::string ReflectionCodeGenModule::computeRegistererVariableDeclaration(std::string const& defaultRegistererType, std::string const& variableName, std::string const& registeredEntity) const noexcept
+{
+	if (_moduleName.empty())
+	{
+		return "static " + defaultRegistererType + " const " + variableName + "(" + registeredEntity + ");";
+	}
+	else
+	{
+		return "static rfk::ModuleEntityRegisterer const " + variableName + "(RFK_MODULE_HANDLE(" + _moduleName + "), " + registeredEntity + ");";
+	}
 }
 
 void ReflectionCodeGenModule::declareFriendClasses(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
@@ -520,7 +557,8 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 		std::to_string(structClass.isClass()) +
 		");" + env.getSeparator() +
 		"if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+		"initialized = true;" + env.getSeparator() +
+		"RFK_TRACE_REGISTRATION_SCOPE(StaticGetArchetype, \"" + structClass.name + "\", " + computeTraceModuleLiteral(env) + ");" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
 	fillEntityProperties(structClass, env, "type.", inout_result);
@@ -604,6 +642,7 @@ void ReflectionCodeGenModule::endHiddenGeneratedCode(kodgen::MacroCodeGenEnv& en
 
 void ReflectionCodeGenModule::reset() noexcept
 {
+	_propertiesCount.clear();
 	_isGeneratingHiddenCode = false;
 }
 
@@ -697,6 +736,24 @@ void ReflectionCodeGenModule::setClassDefaultInstantiators(kodgen::StructClassIn
 		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
 
 	inout_result += generatedClassVarName + "addUniqueInstantiator(defaultUniqueInstantiator);" + env.getSeparator();
+
+	inout_result += "static rfk::StaticMethod defaultPlacementInstantiator(\"\", 0u, rfk::getType<void*>(),"
+		"new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<" + structClass.name + ">),"
+		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
+
+	inout_result += "defaultPlacementInstantiator.addParameter(\"memory\", 0u, rfk::getType<void*>());" + env.getSeparator();
+	inout_result += generatedClassVarName + "addPlacementInstantiator(defaultPlacementInstantiator);" + env.getSeparator();
+
+	//The destructor and alignment are used to construct instances in preallocated memory (makeInstanceAt, StructPool)
+	inout_result += generatedClassVarName + "setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<" + structClass.name + ">);" + env.getSeparator();
+	inout_result += generatedClassVarName + "setMemoryAlignment(alignof(" + structClass.name + "));" + env.getSeparator();
+
+	//Copy / move functions and traits are used to clone instances (copyConstructAt, StructPool::makeUniqueCopy), trivially copyable structs being memcpy'd
+	inout_result += generatedClassVarName + "setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<" + structClass.name + ">());" + env.getSeparator();
+	inout_result += generatedClassVarName + "setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<" + structClass.name + ">());" + env.getSeparator();
+	inout_result += generatedClassVarName + "setCopyAssignment(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<" + structClass.name + ">());" + env.getSeparator();
+	inout_result += generatedClassVarName + "setMoveAssignment(rfk::internal::CodeGenerationHelpers::getDefaultMoveAssignment<" + structClass.name + ">());" + env.getSeparator();
+	inout_result += generatedClassVarName + "setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<" + structClass.name + ">());" + env.getSeparator();
 }
 
 void ReflectionCodeGenModule::fillClassParents(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env,
@@ -1000,8 +1057,8 @@ void ReflectionCodeGenModule::declareAndDefineClassRegistererVariable(kodgen::St
 	//If there is an outer entity, it will register its nested entities to the database itself.
 	if (structClass.outerEntity == nullptr)
 	{
-		inout_result += "namespace rfk::generated { static rfk::ArchetypeRegisterer const registerer_" + getEntityId(structClass) + " = " +
-			structClass.getFullName() + "::staticGetArchetype(); }" + env.getSeparator() + env.getSeparator();
+		inout_result += "namespace rfk::generated { " + computeRegistererVariableDeclaration("rfk::ArchetypeRegisterer", "registerer_" + getEntityId(structClass),
+			structClass.getFullName() + "::staticGetArchetype()") + " }" + env.getSeparator() + env.getSeparator();
 	}
 }
 
@@ -1018,6 +1075,7 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMet
 	//Init content
 	inout_result += "if (!initialized) {" + env.getSeparator();
 	inout_result += "initialized = true;" + env.getSeparator();
+	inout_result += "RFK_TRACE_REGISTRATION_SCOPE(StaticGetArchetype, type.getName(), " + computeTraceModuleLiteral(env) + ");" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
 	fillClassTemplateArguments(structClass, "type.", env, inout_result);
@@ -1167,8 +1225,8 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateRegistererVariable(ko
 	//If there is an outer entity, it will register its nested entities to the database itself.
 	if (structClass.outerEntity == nullptr)
 	{
-		inout_result += "namespace rfk::generated { static rfk::ArchetypeRegisterer const register_" + getEntityId(structClass) +
-			" = *rfk::getArchetype<::" + structClass.type.getName(false, false, true) + ">(); }" + env.getSeparator() + env.getSeparator();
+		inout_result += "namespace rfk::generated { " + computeRegistererVariableDeclaration("rfk::ArchetypeRegisterer", "register_" + getEntityId(structClass),
+			"*rfk::getArchetype<::" + structClass.type.getName(false, false, true) + ">()") + " }" + env.getSeparator() + env.getSeparator();
 	}
 }
 
@@ -1316,6 +1374,26 @@ void ReflectionCodeGenModule::declareGetEnumTemplateSpecialization(kodgen::EnumI
 	inout_result += "template <> " + env.getExportSymbolMacro() + " rfk::Enum const* rfk::getEnum<" + enum_.type.getCanonicalName() + ">() noexcept;" + env.getSeparator();
 }
 
+void ReflectionCodeGenModule::defineEnumStringTableTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
+{
+	//Enum values of enums nested in a struct might not be accessible from the rfk namespace
+	if (enum_.enumValues.empty() || (enum_.outerEntity != nullptr && enum_.outerEntity->entityType != kodgen::EEntityType::Namespace))
+	{
+		return;
+	}
+
+	std::string typeName = enum_.type.getCanonicalName();
+
+	inout_result += "template <> struct rfk::EnumStringTable<" + typeName + "> { static constexpr rfk::EnumStringEntry<" + typeName + "> entries[] = {";
+
+	for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		inout_result += "{\"" + enumValue.name + "\", " + typeName + "::" + enumValue.name + "},";
+	}
+
+	inout_result += "}; };" + env.getSeparator();
+}
+
 void ReflectionCodeGenModule::defineGetEnumTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	//Don't generate template specialization code on non-public enums
@@ -1365,7 +1443,8 @@ void ReflectionCodeGenModule::declareAndDefineEnumRegistererVariable(kodgen::Enu
 {
 	if (enum_.outerEntity == nullptr)
 	{
-		inout_result += "namespace rfk::generated { static rfk::ArchetypeRegisterer const registerer_" + getEntityId(enum_) + " = *rfk::getEnum<" + enum_.type.getCanonicalName() + ">(); }" + env.getSeparator();
+		inout_result += "namespace rfk::generated { " + computeRegistererVariableDeclaration("rfk::ArchetypeRegisterer", "registerer_" + getEntityId(enum_),
+			"*rfk::getEnum<" + enum_.type.getCanonicalName() + ">()") + " }" + env.getSeparator();
 	}
 }
 
@@ -1407,8 +1486,8 @@ void ReflectionCodeGenModule::declareAndDefineVariableRegistererVariable(kodgen:
 {
 	if (variable.outerEntity == nullptr)
 	{
-		inout_result += "namespace rfk::generated { static rfk::DefaultEntityRegisterer const registerer_" + getEntityId(variable) +
-			" = *rfk::getVariable<&" + variable.getFullName() + ">(); }" + env.getSeparator();
+		inout_result += "namespace rfk::generated { " + computeRegistererVariableDeclaration("rfk::DefaultEntityRegisterer", "registerer_" + getEntityId(variable),
+			"*rfk::getVariable<&" + variable.getFullName() + ">()") + " }" + env.getSeparator();
 	}
 }
 
@@ -1473,8 +1552,8 @@ void ReflectionCodeGenModule::declareAndDefineFunctionRegistererVariable(kodgen:
 {
 	if (function.outerEntity == nullptr)
 	{
-		inout_result += "namespace rfk::generated { static rfk::DefaultEntityRegisterer const registerer" + getEntityId(function) +
-			" = *rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>(); }" + env.getSeparator();
+		inout_result += "namespace rfk::generated { " + computeRegistererVariableDeclaration("rfk::DefaultEntityRegisterer", "registerer" + getEntityId(function),
+			"*rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>()") + " }" + env.getSeparator();
 	}
 }
 
@@ -1518,45 +1597,49 @@ void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentFunction(kodge
 
 	if (nestedEntityCount > 0u)
 	{
-		//Reserve space first
-		inout_result += "fragment.setNestedEntitiesCapacity(" + std::to_string(nestedEntityCount) + "u);" + env.getSeparator();
+		//Gather all nested entities in a single table so that they are registered to the fragment
+		//and merged to the namespace in one bulk operation
+		inout_result += "rfk::Entity const* const nestedEntities[] = {" + env.getSeparator();
 
 		//Nested...
 		//Namespaces
 		for (kodgen::NamespaceInfo const& nestedNamespace : namespace_.namespaces)
 		{
-			inout_result += "fragment.addNestedEntity(rfk::generated::" + computeGetNamespaceFragmentFunctionName(nestedNamespace, env.getFileParsingResult()->parsedFile) + "());" + env.getSeparator();
+			inout_result += "&rfk::generated::" + computeGetNamespaceFragmentFunctionName(nestedNamespace, env.getFileParsingResult()->parsedFile) + "()," + env.getSeparator();
 		}
 
 		//Structs
 		for (kodgen::StructClassInfo const& nestedStruct : namespace_.structs)
 		{
-			inout_result += "fragment.addNestedEntity(*rfk::getArchetype<" + nestedStruct.type.getCanonicalName() + ">());" + env.getSeparator();
+			inout_result += "rfk::getArchetype<" + nestedStruct.type.getCanonicalName() + ">()," + env.getSeparator();
 		}
 
 		//Classes
 		for (kodgen::StructClassInfo const& nestedClass : namespace_.classes)
 		{
-			inout_result += "fragment.addNestedEntity(*rfk::getArchetype<" + nestedClass.type.getCanonicalName() + ">());" + env.getSeparator();
+			inout_result += "rfk::getArchetype<" + nestedClass.type.getCanonicalName() + ">()," + env.getSeparator();
 		}
 
 		//Enums
 		for (kodgen::EnumInfo const& nestedEnum : namespace_.enums)
 		{
-			inout_result += "fragment.addNestedEntity(*rfk::getEnum<" + nestedEnum.type.getCanonicalName() + ">());" + env.getSeparator();
+			inout_result += "rfk::getEnum<" + nestedEnum.type.getCanonicalName() + ">()," + env.getSeparator();
 		}
 
 		//Variables
 		for (kodgen::VariableInfo const& variable : namespace_.variables)
 		{
-			inout_result += "fragment.addNestedEntity(*rfk::getVariable<&" + variable.getFullName() + ">()); " + env.getSeparator();
+			inout_result += "rfk::getVariable<&" + variable.getFullName() + ">()," + env.getSeparator();
 		}
 
 		//Functions
 		for (kodgen::FunctionInfo const& function : namespace_.functions)
 		{
-			inout_result += "fragment.addNestedEntity(*rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>());" + env.getSeparator();
+			inout_result += "rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>()," + env.getSeparator();
 		}
+
+		inout_result += "};" + env.getSeparator() +
+			"fragment.addNestedEntities(nestedEntities, " + std::to_string(nestedEntityCount) + "u);" + env.getSeparator();
 	}
 
 	//End initialization if
@@ -1569,8 +1652,8 @@ void ReflectionCodeGenModule::declareAndDefineNamespaceFragmentRegistererVariabl
 {
 	assert(namespace_.outerEntity == nullptr);
 
-	inout_result += "static rfk::NamespaceFragmentRegisterer const " + computeNamespaceFragmentRegistererName(namespace_, env.getFileParsingResult()->parsedFile) +
-		"(rfk::generated::" + computeGetNamespaceFragmentFunctionName(namespace_, env.getFileParsingResult()->parsedFile) + "());" + env.getSeparator();
+	inout_result += computeRegistererVariableDeclaration("rfk::NamespaceFragmentRegisterer", computeNamespaceFragmentRegistererName(namespace_, env.getFileParsingResult()->parsedFile),
+		"rfk::generated::" + computeGetNamespaceFragmentFunctionName(namespace_, env.getFileParsingResult()->parsedFile) + "()") + env.getSeparator();
 }
 
 void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentAndRegistererRecursive(kodgen::NamespaceInfo const& namespace_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
@@ -0,0 +1,166 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <cstring>	//std::memset, std::memcpy
+#include <cstdlib>	//std::getenv
+#include <system_error>
+
+#if defined(_WIN32) || defined(_WIN64)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <winsock2.h>
+	#include <ws2tcpip.h>
+	#include <afunix.h>
+#else
+	#include <sys/types.h>
+	#include <sys/socket.h>
+	#include <sys/select.h>
+	#include <sys/stat.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+#include <Kodgen/Misc/Filesystem.h>
+
+namespace rfk
+{
+	/**
+	*	Unix domain socket bound to a file path, used by the generator daemon and its clients to exchange lines of text.
+	*	Only the users allowed to access the directory of the socket file can connect to it,
+	*	so the daemon socket is created in a directory only accessible by the current user (see getUserDirectory).
+	*/
+	class LocalSocket
+	{
+		private:
+#if defined(_WIN32) || defined(_WIN64)
+			using Handle = SOCKET;
+
+			static constexpr Handle	_invalidHandle = INVALID_SOCKET;
+#else
+			using Handle = int;
+
+			static constexpr Handle	_invalidHandle = -1;
+#endif
+
+			/** Handle of the socket. */
+			Handle		_handle = _invalidHandle;
+
+			/** Received bytes which don't make a complete line yet. */
+			std::string	_receivedData;
+
+			/** Path of the socket file of a listening socket, removed when the socket is closed. Empty if the socket doesn't listen. */
+			fs::path	_listenedPath;
+
+			explicit LocalSocket(Handle handle)	noexcept;
+
+			/**
+			*	@brief Initialize the socket API of the platform once per process.
+			*
+			*	@return true if sockets can be used, else false.
+			*/
+			static inline bool			initialize()							noexcept;
+
+			/**
+			*	@brief Make the address of a socket file.
+			*
+			*	@param path			Path of the socket file.
+			*	@param out_address	Address receiving the path.
+			*
+			*	@return true if the address could be made, false if the path is too long for a socket address.
+			*/
+			static inline bool			makeAddress(fs::path const&	path,
+													sockaddr_un&	out_address)			noexcept;
+
+			/**
+			*	@brief Close the socket if it is valid, and remove its socket file if it listens.
+			*/
+			inline void					close()									noexcept;
+
+		public:
+			inline LocalSocket()							noexcept = default;
+			LocalSocket(LocalSocket const&)					= delete;
+			inline LocalSocket(LocalSocket&& other)			noexcept;
+			inline ~LocalSocket()							noexcept;
+
+			/**
+			*	@brief	Get a directory only accessible by the current user, creating it if needed.
+			*			On Windows, it is a directory of the local application data of the user.
+			*
+			*	@return The directory, empty if it couldn't be created or if other users can access it.
+			*/
+			static inline fs::path		getUserDirectory()												noexcept;
+
+			/**
+			*	@brief	Create a socket listening for connections on a socket file.
+			*			A socket file left by a socket which wasn't closed is replaced, unless a socket still listens on it.
+			*
+			*	@param path Path of the socket file.
+			*
+			*	@return The listening socket, invalid if the socket file couldn't be created or if a socket already listens on it.
+			*/
+			static inline LocalSocket	listen(fs::path const& path)									noexcept;
+
+			/**
+			*	@brief Connect to a socket listening on a socket file.
+			*
+			*	@param path Path of the socket file.
+			*
+			*	@return The connected socket, invalid if nothing listens on the socket file.
+			*/
+			static inline LocalSocket	connect(fs::path const& path)									noexcept;
+
+			/**
+			*	@brief Check whether the socket could be created and bound or connected.
+			*
+			*	@return true if the socket is valid, else false.
+			*/
+			inline bool					isValid()												const	noexcept;
+
+			/**
+			*	@brief Wait until a client connects to a listening socket.
+			*
+			*	@param timeout Maximum waiting duration.
+			*
+			*	@return true if a connection can be accepted without blocking, false if the timeout expired.
+			*/
+			inline bool					waitForConnection(std::chrono::milliseconds timeout)	const	noexcept;
+
+			/**
+			*	@brief Accept a connection on a listening socket, blocking until a client connects.
+			*
+			*	@return The socket connected to the client, invalid if the connection failed.
+			*/
+			inline LocalSocket			accept()												const	noexcept;
+
+			/**
+			*	@brief Send a line of text. A line break is appended to the line.
+			*
+			*	@param line The line to send. Must not contain any line break.
+			*
+			*	@return true if the whole line was sent, else false.
+			*/
+			inline bool					sendLine(std::string const& line)								noexcept;
+
+			/**
+			*	@brief Receive a line of text, blocking until a complete line is received.
+			*
+			*	@param out_line String receiving the line, without its line break.
+			*
+			*	@return true if a line was received, false if the connection was closed or failed before.
+			*/
+			inline bool					receiveLine(std::string& out_line)								noexcept;
+
+			inline LocalSocket&			operator=(LocalSocket const&)									= delete;
+			inline LocalSocket&			operator=(LocalSocket&& other)									noexcept;
+	};
+
+	#include "RefurekuGenerator/Misc/LocalSocket.inl"
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline LocalSocket::LocalSocket(Handle handle) noexcept:
+	_handle{handle}
+{
+#if defined(SO_NOSIGPIPE)
+	//Writing to a socket closed by the peer must fail instead of killing the process
+	if (isValid())
+	{
+		int noSigPipe = 1;
+		setsockopt(_handle, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+	}
+#endif
+}
+
+inline LocalSocket::LocalSocket(LocalSocket&& other) noexcept:
+	_handle{other._handle},
+	_receivedData{std::move(other._receivedData)},
+	_listenedPath{std::move(other._listenedPath)}
+{
+	other._handle = _invalidHandle;
+	other._listenedPath.clear();
+}
+
+inline LocalSocket::~LocalSocket() noexcept
+{
+	close();
+}
+
+inline bool LocalSocket::initialize() noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+	static bool const isInitialized = []()
+	{
+		WSADATA wsaData;
+
+		return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+	}();
+
+	return isInitialized;
+#else
+	return true;
+#endif
+}
+
+inline bool LocalSocket::makeAddress(fs::path const& path, sockaddr_un& out_address) noexcept
+{
+	std::string pathString = path.string();
+
+	std::memset(&out_address, 0, sizeof(out_address));
+
+	//Keep the terminating null character
+	if (pathString.empty() || pathString.size() >= sizeof(out_address.sun_path))
+	{
+		return false;
+	}
+
+	out_address.sun_family = AF_UNIX;
+	std::memcpy(out_address.sun_path, pathString.c_str(), pathString.size());
+
+	return true;
+}
+
+inline void LocalSocket::close() noexcept
+{
+	if (_handle != _invalidHandle)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		closesocket(_handle);
+#else
+		::close(_handle);
+#endif
+
+		_handle = _invalidHandle;
+	}
+
+	if (!_listenedPath.empty())
+	{
+		std::error_code error;
+		fs::remove(_listenedPath, error);
+
+		_listenedPath.clear();
+	}
+}
+
+inline fs::path LocalSocket::getUserDirectory() noexcept
+{
+	std::error_code error;
+
+#if defined(_WIN32) || defined(_WIN64)
+	//The local application data of a user is only accessible by that user
+	char const* localAppData = std::getenv("LOCALAPPDATA");
+
+	if (localAppData == nullptr || *localAppData == '\0')
+	{
+		return fs::path();
+	}
+
+	fs::path directory = fs::path(localAppData) / "Refureku";
+
+	fs::create_directories(directory, error);
+
+	return fs::is_directory(directory, error) ? directory : fs::path();
+#else
+	//The runtime directory of a user is only accessible by that user, fall back on the shared temporary directory
+	char const*	runtimeDirectory	= std::getenv("XDG_RUNTIME_DIR");
+	fs::path	directory			= fs::path((runtimeDirectory != nullptr && *runtimeDirectory != '\0') ? runtimeDirectory : "/tmp") / ("refureku-" + std::to_string(::getuid()));
+
+	::mkdir(directory.c_str(), S_IRWXU);
+
+	//The directory might have been created beforehand by another user: it must be a real directory owned by the current user that nobody else can access
+	struct stat directoryStatus;
+
+	if (::lstat(directory.c_str(), &directoryStatus) != 0 || !S_ISDIR(directoryStatus.st_mode) ||
+		directoryStatus.st_uid != ::getuid() || (directoryStatus.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+	{
+		return fs::path();
+	}
+
+	return directory;
+#endif
+}
+
+inline LocalSocket LocalSocket::listen(fs::path const& path) noexcept
+{
+	sockaddr_un address;
+
+	if (!initialize() || !makeAddress(path, address))
+	{
+		return LocalSocket();
+	}
+
+	std::error_code error;
+
+	if (fs::exists(fs::symlink_status(path, error)))
+	{
+		//Don't steal the socket file of a socket still listening
+		if (connect(path).isValid())
+		{
+			return LocalSocket();
+		}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+		//Only replace socket files, not the files the path might point to by mistake
+		if (!fs::is_socket(fs::symlink_status(path, error)))
+		{
+			return LocalSocket();
+		}
+#endif
+
+		fs::remove(path, error);
+	}
+
+	LocalSocket result(::socket(AF_UNIX, SOCK_STREAM, 0));
+
+	if (!result.isValid() || ::bind(result._handle, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) != 0)
+	{
+		return LocalSocket();
+	}
+
+	//The socket file is created by bind, so remove it from now on
+	result._listenedPath = path;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	//Connecting requires the write permission on the socket file
+	::chmod(path.c_str(), S_IRUSR | S_IWUSR);
+#endif
+
+	if (::listen(result._handle, SOMAXCONN) != 0)
+	{
+		return LocalSocket();
+	}
+
+	return result;
+}
+
+inline LocalSocket LocalSocket::connect(fs::path const& path) noexcept
+{
+	sockaddr_un address;
+
+	if (!initialize() || !makeAddress(path, address))
+	{
+		return LocalSocket();
+	}
+
+	LocalSocket result(::socket(AF_UNIX, SOCK_STREAM, 0));
+
+	if (!result.isValid() || ::connect(result._handle, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) != 0)
+	{
+		return LocalSocket();
+	}
+
+	return result;
+}
+
+inline bool LocalSocket::isValid() const noexcept
+{
+	return _handle != _invalidHandle;
+}
+
+inline bool LocalSocket::waitForConnection(std::chrono::milliseconds timeout) const noexcept
+{
+	fd_set handles;
+	FD_ZERO(&handles);
+	FD_SET(_handle, &handles);
+
+	timeval selectTimeout;
+	selectTimeout.tv_sec	= static_cast<long>(timeout.count() / 1000);
+	selectTimeout.tv_usec	= static_cast<long>((timeout.count() % 1000) * 1000);
+
+	//The first parameter is ignored on Windows
+	return ::select(static_cast<int>(_handle + 1), &handles, nullptr, nullptr, &selectTimeout) > 0;
+}
+
+inline LocalSocket LocalSocket::accept() const noexcept
+{
+	return LocalSocket(::accept(_handle, nullptr, nullptr));
+}
+
+inline bool LocalSocket::sendLine(std::string const& line) noexcept
+{
+	std::string data		= line + "\n";
+	std::size_t sentSize	= 0u;
+
+	while (sentSize < data.size())
+	{
+#if defined(MSG_NOSIGNAL)
+		//Writing to a socket closed by the peer must fail instead of killing the process
+		auto result = ::send(_handle, data.data() + sentSize, static_cast<int>(data.size() - sentSize), MSG_NOSIGNAL);
+#else
+		auto result = ::send(_handle, data.data() + sentSize, static_cast<int>(data.size() - sentSize), 0);
+#endif
+
+		if (result <= 0)
+		{
+			return false;
+		}
+
+		sentSize += static_cast<std::size_t>(result);
+	}
+
+	return true;
+}
+
+inline bool LocalSocket::receiveLine(std::string& out_line) noexcept
+{
+	std::size_t lineEnd;
+
+	while ((lineEnd = _receivedData.find('\n')) == std::string::npos)
+	{
+		char buffer[256];
+		auto result = ::recv(_handle, buffer, static_cast<int>(sizeof(buffer)), 0);
+
+		if (result <= 0)
+		{
+			return false;
+		}
+
+		_receivedData.append(buffer, static_cast<std::size_t>(result));
+	}
+
+	out_line = _receivedData.substr(0u, lineEnd);
+	_receivedData.erase(0u, lineEnd + 1u);
+
+	return true;
+}
+
+inline LocalSocket& LocalSocket::operator=(LocalSocket&& other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+
+		_handle			= other._handle;
+		_receivedData	= std::move(other._receivedData);
+		_listenedPath	= std::move(other._listenedPath);
+		other._handle	= _invalidHandle;
+		other._listenedPath.clear();
+	}
+
+	return *this;
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <mutex>
+
+#include <Kodgen/Misc/ILogger.h>
+
+namespace rfk
+{
+	/**
+	*	Logger forwarding the logs to another logger one at a time.
+	*	Files are parsed and generated on several threads, so the logs of different files would interleave otherwise.
+	*/
+	class ThreadSafeLogger : public kodgen::ILogger
+	{
+		private:
+			/** Logger the logs are forwarded to. */
+			kodgen::ILogger&	_logger;
+
+			/** Mutex preventing concurrent logs. */
+			std::mutex			_mutex;
+
+		public:
+			ThreadSafeLogger(kodgen::ILogger& logger) noexcept:
+				_logger{logger}
+			{
+			}
+
+			virtual void log(std::string const& message, ELogSeverity logSeverity = ELogSeverity::Info) noexcept override
+			{
+				std::lock_guard lock(_mutex);
+
+				_logger.log(message, logSeverity);
+			}
+	};
+}
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "RefurekuGenerator/Parsing/FileParser.h"
 
 #include "RefurekuGenerator/CodeGen/ReflectionCodeGenModule.h"
+#include "RefurekuGenerator/Misc/ThreadSafeLogger.h"
 
 fs::path getLibraryDirectoryPath()
 {
@@ -145,7 +146,8 @@ void runForPublicDirectory(kodgen::ILogger& logger, kodgen::CodeGenManager& code
 
 int main()
 {
-	kodgen::DefaultLogger logger;
+	kodgen::DefaultLogger defaultLogger;
+	rfk::ThreadSafeLogger logger(defaultLogger);
 
 	rfk::FileParser fileParser;
 	fileParser.logger = &logger;
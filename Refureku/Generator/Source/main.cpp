@@ -1,4 +1,10 @@
-#include <utility>	//std::forward
+#include <utility>	//std::forward, std::move
+#include <string>
+#include <chrono>
+#include <thread>		//std::thread::hardware_concurrency
+#include <algorithm>	//std::max
+#include <limits>
+#include <stdexcept>	//std::out_of_range
 
 #include <Kodgen/Misc/DefaultLogger.h>
 #include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
@@ -7,6 +13,54 @@
 
 #include "RefurekuGenerator/Parsing/FileParser.h"
 #include "RefurekuGenerator/CodeGen/ReflectionCodeGenModule.h"
+#include "RefurekuGenerator/CodeGen/IncrementalGenerator.h"
+#include "RefurekuGenerator/Misc/ThreadSafeLogger.h"
+#include "RefurekuGenerator/Misc/LocalSocket.h"
+
+/**
+*	How the generator runs.
+*/
+enum class EGeneratorMode
+{
+	/** Generate the files once. */
+	Generate,
+
+	/** Keep running to regenerate the files as soon as they change, and answer the requests of the clients. */
+	Daemon,
+
+	/** Ask the daemon to bring the generated files up-to-date, or generate them in process if no daemon is running. */
+	Client,
+
+	/** Ask the daemon to stop. */
+	StopDaemon
+};
+
+/**
+*	Options provided on the command line.
+*/
+struct GeneratorOptions
+{
+	/** How the generator runs. */
+	EGeneratorMode				mode			= EGeneratorMode::Generate;
+
+	/** Path to the settings file. */
+	fs::path					settingsFilePath;
+
+	/** Name of the module the generated entities are registered to. */
+	std::string					moduleName;
+
+	/** Number of threads parsing and generating files concurrently. */
+	kodgen::uint32				threadCount		= std::max(std::thread::hardware_concurrency(), 1u);
+
+	/** Should the files to regenerate be found from their content hash rather than from their timestamp. */
+	bool						useCache		= true;
+
+	/** Path to the socket file the daemon listens on. */
+	fs::path					daemonSocketPath;
+
+	/** Interval between 2 checks for modified files in daemon mode. */
+	std::chrono::milliseconds	pollInterval	= std::chrono::milliseconds(250);
+};
 
 void printGenerationSetup(kodgen::ILogger& logger, kodgen::CodeGenManagerSettings const& codeGenMgrSettings, kodgen::ParsingSettings const& parsingSettings,
 						  kodgen::MacroCodeGenUnitSettings const& codeGenUnitSettings)
@@ -109,14 +163,197 @@ void printGenerationResult(kodgen::ILogger& logger, kodgen::CodeGenResult const&
 	}
 }
 
-void parseAndGenerate(fs::path&& settingsFilePath)
+bool parseIntegerOption(kodgen::ILogger& logger, std::string const& arg, std::string const& option, int minValue, int maxValue, int& out_value)
 {
-	kodgen::DefaultLogger logger;
+	try
+	{
+		out_value = std::stoi(arg.substr(option.size()));
+
+		if (out_value < minValue || out_value > maxValue)
+		{
+			throw std::out_of_range(arg);
+		}
+
+		return true;
+	}
+	catch (std::exception const&)
+	{
+		logger.log("Invalid value: " + arg, kodgen::ILogger::ELogSeverity::Error);
+
+		return false;
+	}
+}
+
+bool parseOptions(kodgen::ILogger& logger, int argc, char** argv, GeneratorOptions& out_options)
+{
+	std::string const	threadCountOption		= "--threads=";
+	std::string const	socketOption			= "--socket=";
+	std::string const	pollIntervalOption		= "--poll-interval=";
+	int					positionalArgsCount		= 0;
+	int					value;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+
+		if (arg.rfind(threadCountOption, 0) == 0)
+		{
+			if (!parseIntegerOption(logger, arg, threadCountOption, 1, std::numeric_limits<int>::max(), value))
+			{
+				return false;
+			}
+
+			out_options.threadCount = static_cast<kodgen::uint32>(value);
+		}
+		else if (arg.rfind(socketOption, 0) == 0 && arg.size() > socketOption.size())
+		{
+			out_options.daemonSocketPath = arg.substr(socketOption.size());
+		}
+		else if (arg.rfind(pollIntervalOption, 0) == 0)
+		{
+			if (!parseIntegerOption(logger, arg, pollIntervalOption, 1, std::numeric_limits<int>::max(), value))
+			{
+				return false;
+			}
+
+			out_options.pollInterval = std::chrono::milliseconds(value);
+		}
+		else if (arg == "--no-cache")
+		{
+			out_options.useCache = false;
+		}
+		else if (arg == "--daemon")
+		{
+			out_options.mode = EGeneratorMode::Daemon;
+		}
+		else if (arg == "--client")
+		{
+			out_options.mode = EGeneratorMode::Client;
+		}
+		else if (arg == "--stop-daemon")
+		{
+			out_options.mode = EGeneratorMode::StopDaemon;
+		}
+		else if (arg.rfind("--", 0) == 0)
+		{
+			logger.log("Unknown option: " + arg, kodgen::ILogger::ELogSeverity::Error);
+			return false;
+		}
+		else if (positionalArgsCount == 0)
+		{
+			out_options.settingsFilePath = arg;
+			positionalArgsCount++;
+		}
+		else if (positionalArgsCount == 1)
+		{
+			out_options.moduleName = std::move(arg);
+			positionalArgsCount++;
+		}
+		else
+		{
+			logger.log("Unexpected argument: " + arg, kodgen::ILogger::ELogSeverity::Error);
+			return false;
+		}
+	}
+
+	//The daemon finds the files to regenerate from their content hash
+	if (!out_options.useCache && out_options.mode == EGeneratorMode::Daemon)
+	{
+		logger.log("--no-cache can't be used with --daemon.", kodgen::ILogger::ELogSeverity::Error);
+		return false;
+	}
+
+	//Only the current user can access the default socket, so that other users can't request generations nor stop the daemon
+	if (out_options.mode != EGeneratorMode::Generate && out_options.daemonSocketPath.empty())
+	{
+		fs::path userDirectory = rfk::LocalSocket::getUserDirectory();
+
+		if (userDirectory.empty())
+		{
+			logger.log("Failed to create a directory only accessible by the current user for the daemon socket, use --socket=<path>.", kodgen::ILogger::ELogSeverity::Error);
+			return false;
+		}
+
+		out_options.daemonSocketPath = userDirectory / "generator.sock";
+	}
+
+	return true;
+}
+
+int runDaemon(kodgen::ILogger& logger, GeneratorOptions const& options, rfk::GenerationCache::Hash settingsHash, rfk::IncrementalGenerator& incrementalGenerator,
+			  kodgen::CodeGenManager& codeGenMgr, rfk::FileParser& fileParser, kodgen::MacroCodeGenUnit& codeGenUnit)
+{
+	rfk::LocalSocket server = rfk::LocalSocket::listen(options.daemonSocketPath);
+
+	if (!server.isValid())
+	{
+		logger.log("Failed to listen on " + options.daemonSocketPath.string() + ", another daemon might be running.", kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	logger.log("Daemon listening on " + options.daemonSocketPath.string() + ".", kodgen::ILogger::ELogSeverity::Info);
+
+	printGenerationResult(logger, incrementalGenerator.run(logger, codeGenMgr, fileParser, codeGenUnit));
+
+	std::string const generateRequest = "generate " + std::to_string(settingsHash);
+
+	while (true)
+	{
+		if (!server.waitForConnection(options.pollInterval))
+		{
+			//Regenerate the modified files as soon as they are saved so that the clients rarely wait.
+			//Files that failed are only retried when they change or when a client asks for them
+			kodgen::CodeGenResult genResult = incrementalGenerator.run(logger, codeGenMgr, fileParser, codeGenUnit, false);
+
+			if (!genResult.completed || !genResult.parsedFiles.empty())
+			{
+				printGenerationResult(logger, genResult);
+			}
+
+			continue;
+		}
+
+		rfk::LocalSocket	client = server.accept();
+		std::string			request;
+
+		if (!client.isValid() || !client.receiveLine(request))
+		{
+			continue;
+		}
+
+		if (request == generateRequest)
+		{
+			//Catch the modifications made since the last check
+			kodgen::CodeGenResult genResult = incrementalGenerator.run(logger, codeGenMgr, fileParser, codeGenUnit);
+
+			printGenerationResult(logger, genResult);
+			client.sendLine(genResult.completed ? "ok" : "failed");
+		}
+		else if (request == "stop")
+		{
+			client.sendLine("ok");
+			logger.log("Daemon stopped.", kodgen::ILogger::ELogSeverity::Info);
+
+			return EXIT_SUCCESS;
+		}
+		else
+		{
+			//The client runs with other settings
+			client.sendLine("mismatch");
+		}
+	}
+}
+
+int parseAndGenerate(kodgen::ILogger& logger, GeneratorOptions&& options)
+{
+	//Hash the settings before they are moved to the code generation objects
+	rfk::GenerationCache::Hash settingsHash = rfk::IncrementalGenerator::computeSettingsHash(options.settingsFilePath, options.moduleName);
 
 	rfk::FileParser fileParser;
 	fileParser.logger = &logger;
 
-	kodgen::CodeGenManager codeGenMgr;
+	//Files are parsed and generated by a pool of threads, each file getting its own copy of the parser and of the code gen unit
+	kodgen::CodeGenManager codeGenMgr(options.threadCount);
 	codeGenMgr.logger = &logger;
 
 	kodgen::MacroCodeGenUnitSettings codeGenUnitSettings;
@@ -125,25 +362,117 @@ void parseAndGenerate(fs::path&& settingsFilePath)
 	codeGenUnit.setSettings(codeGenUnitSettings);
 	
 	rfk::ReflectionCodeGenModule reflectionCodeGenModule;	
+	reflectionCodeGenModule.setModuleName(std::move(options.moduleName));
 	codeGenUnit.addModule(reflectionCodeGenModule);
 
 	//Load settings
 	logger.log("Working Directory: " + fs::current_path().string(), kodgen::ILogger::ELogSeverity::Info);
+	logger.log("Threads: " + std::to_string(options.threadCount), kodgen::ILogger::ELogSeverity::Info);
 	
 	//loadSettings(logger, codeGenMgr.settings, fileParser.getSettings(), codeGenUnitSettings, "RefurekuTestsSettings.toml"); //For tests
-	loadSettings(logger, codeGenMgr.settings, fileParser.getSettings(), codeGenUnitSettings, std::forward<fs::path>(settingsFilePath));
+	loadSettings(logger, codeGenMgr.settings, fileParser.getSettings(), codeGenUnitSettings, std::move(options.settingsFilePath));
+
+	if (!options.useCache)
+	{
+		printGenerationResult(logger, codeGenMgr.run(fileParser, codeGenUnit, false));
+
+		return EXIT_SUCCESS;
+	}
+
+	rfk::IncrementalGenerator incrementalGenerator(codeGenMgr.settings, fileParser.getSettings(), codeGenUnitSettings, settingsHash);
+
+	if (!incrementalGenerator.loadCache())
+	{
+		logger.log("No generation cache matching the current settings, regenerate all files.", kodgen::ILogger::ELogSeverity::Info);
+	}
+
+	if (options.mode == EGeneratorMode::Daemon)
+	{
+		return runDaemon(logger, options, settingsHash, incrementalGenerator, codeGenMgr, fileParser, codeGenUnit);
+	}
 
 	//Parse
-	kodgen::CodeGenResult genResult = codeGenMgr.run(fileParser, codeGenUnit, false);
+	kodgen::CodeGenResult genResult = incrementalGenerator.run(logger, codeGenMgr, fileParser, codeGenUnit);
 
 	//Result
 	printGenerationResult(logger, genResult);
+
+	return EXIT_SUCCESS;
+}
+
+int requestDaemon(kodgen::ILogger& logger, GeneratorOptions&& options)
+{
+	rfk::LocalSocket	daemon = rfk::LocalSocket::connect(options.daemonSocketPath);
+	std::string			request;
+	std::string			response;
+
+	if (options.mode == EGeneratorMode::StopDaemon)
+	{
+		request = "stop";
+	}
+	else
+	{
+		//The daemon only serves the clients using the same settings
+		request = "generate " + std::to_string(rfk::IncrementalGenerator::computeSettingsHash(options.settingsFilePath, options.moduleName));
+	}
+
+	if (!daemon.isValid() || !daemon.sendLine(request) || !daemon.receiveLine(response))
+	{
+		if (options.mode == EGeneratorMode::StopDaemon)
+		{
+			logger.log("No daemon listening on " + options.daemonSocketPath.string() + ".", kodgen::ILogger::ELogSeverity::Error);
+			return EXIT_FAILURE;
+		}
+
+		logger.log("No daemon listening on " + options.daemonSocketPath.string() + ", generate in process.", kodgen::ILogger::ELogSeverity::Info);
+	}
+	else if (response == "ok")
+	{
+		return EXIT_SUCCESS;
+	}
+	else if (response == "failed")
+	{
+		//Exit like a generation in process would
+		logger.log("Generation failed to complete successfully.", kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_SUCCESS;
+	}
+	else
+	{
+		logger.log("The daemon listening on " + options.daemonSocketPath.string() + " runs with other settings, generate in process.", kodgen::ILogger::ELogSeverity::Warning);
+	}
+
+	options.mode = EGeneratorMode::Generate;
+
+	return parseAndGenerate(logger, std::move(options));
 }
 
-/** Can provide the path to the settings file as 1st parameter */
+/**
+*	Can provide the path to the settings file as 1st parameter,
+*	and the name of the module the generated entities are registered to as 2nd parameter.
+*	Options:
+*		--threads=<count>		Number of threads parsing and generating files concurrently. Defaults to the number of hardware threads.
+*		--no-cache				Regenerate the files modified since their last generation instead of the files whose content changed.
+*		--daemon				Keep running, regenerate the files as soon as they change and answer the requests of the clients.
+*		--client				Ask the daemon to bring the generated files up-to-date. Generate in process if no daemon runs with the same settings.
+*		--stop-daemon			Ask the daemon to stop.
+*		--socket=<path>			Path to the socket file the daemon listens on. Defaults to generator.sock in a directory only accessible by the current user.
+*		--poll-interval=<ms>	Interval between 2 checks for modified files in daemon mode. Defaults to 250.
+*/
 int main(int argc, char** argv)
 {
-	parseAndGenerate((argc > 1) ? fs::path(argv[1]) : fs::path());
+	kodgen::DefaultLogger	defaultLogger;
+	rfk::ThreadSafeLogger	logger(defaultLogger);
+	GeneratorOptions		options;
 
-	return EXIT_SUCCESS;
+	if (!parseOptions(logger, argc, argv, options))
+	{
+		return EXIT_FAILURE;
+	}
+
+	if (options.mode == EGeneratorMode::Client || options.mode == EGeneratorMode::StopDaemon)
+	{
+		return requestDaemon(logger, std::move(options));
+	}
+
+	return parseAndGenerate(logger, std::move(options));
 }
\ No newline at end of file
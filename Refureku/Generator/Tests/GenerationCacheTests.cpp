@@ -0,0 +1,224 @@
+#include <chrono>
+#include <string>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "RefurekuGenerator/CodeGen/GenerationCache.h"
+
+namespace generation_cache_tests
+{
+	/** Temporary directory removed with its content at the end of a test. */
+	struct TemporaryDirectory
+	{
+		fs::path path;
+
+		TemporaryDirectory(std::string const& name):
+			path{fs::temp_directory_path() / ("RefurekuGeneratorTests_" + name)}
+		{
+			fs::remove_all(path);
+			fs::create_directories(path);
+		}
+
+		~TemporaryDirectory()
+		{
+			std::error_code error;
+			fs::remove_all(path, error);
+		}
+	};
+
+	void writeFile(fs::path const& path, std::string const& content)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << content;
+	}
+}
+
+//=========================================================
+//========== GenerationCache::normalizeContent ============
+//=========================================================
+
+TEST(RfkGen_GenerationCache_normalizeContent, IgnoresCommentsAndWhitespaces)
+{
+	std::string content		= "#pragma once\n\nclass CLASS() A\n{\n\t//Comment\n\tint   _i; /* Block\n comment */ int _j;\n};\n";
+	std::string reformatted	= "  #pragma once\r\n/** Doc */\r\nclass CLASS() A\r\n{\r\n    int _i;\r\n int _j;\r\n};";
+
+	EXPECT_EQ(rfk::GenerationCache::normalizeContent(content), "#pragma once\nclass CLASS() A\n{\nint _i; int _j;\n};\n");
+	EXPECT_EQ(rfk::GenerationCache::normalizeContent(reformatted), "#pragma once\nclass CLASS() A\n{\nint _i;\nint _j;\n};");
+}
+
+TEST(RfkGen_GenerationCache_normalizeContent, KeepsLiteralsUntouched)
+{
+	std::string content = "char const* s = \"a  // b /* c */  \\\" d\"; char c = '/';";
+
+	EXPECT_EQ(rfk::GenerationCache::normalizeContent(content), content);
+}
+
+TEST(RfkGen_GenerationCache_normalizeContent, KeepsTokensSeparated)
+{
+	EXPECT_EQ(rfk::GenerationCache::normalizeContent("unsigned/**/int\tvalue"), "unsigned int value");
+}
+
+//=========================================================
+//========== GenerationCache::computeFileHash =============
+//=========================================================
+
+TEST(RfkGen_GenerationCache_computeFileHash, IgnoresTouchAndReformat)
+{
+	generation_cache_tests::TemporaryDirectory directory("IgnoresTouchAndReformat");
+	fs::path file = directory.path / "A.h";
+
+	generation_cache_tests::writeFile(file, "struct STRUCT() A { int i; };");
+	rfk::GenerationCache::Hash hash = rfk::GenerationCache(directory.path / "Cache", 0u).computeFileHash(file);
+
+	generation_cache_tests::writeFile(file, "//A struct\n\nstruct  STRUCT()   A {\tint i; }; /* Trailing comment */");
+	EXPECT_EQ(rfk::GenerationCache(directory.path / "Cache", 0u).computeFileHash(file), hash);
+
+	generation_cache_tests::writeFile(file, "struct STRUCT() A { int j; };");
+	EXPECT_NE(rfk::GenerationCache(directory.path / "Cache", 0u).computeFileHash(file), hash);
+}
+
+TEST(RfkGen_GenerationCache_computeFileHash, CoversIncludedFiles)
+{
+	generation_cache_tests::TemporaryDirectory directory("CoversIncludedFiles");
+	fs::create_directories(directory.path / "Include" / "Generated");
+	fs::create_directories(directory.path / "Other");
+
+	fs::path file			= directory.path / "Include" / "A.h";
+	fs::path includedFile	= directory.path / "Other" / "B.h";
+	fs::path generatedFile	= directory.path / "Include" / "Generated" / "A.rfkh.h";
+
+	generation_cache_tests::writeFile(file, "#include \"Generated/A.rfkh.h\"\n#include \"B.h\"\n#include <vector>\nstruct STRUCT() A : B {};");
+	generation_cache_tests::writeFile(includedFile, "#include \"../Include/A.h\"\nstruct B {};");
+	generation_cache_tests::writeFile(generatedFile, "//Generated");
+
+	auto computeHash = [&]()
+	{
+		rfk::GenerationCache cache(directory.path / "Cache", 0u);
+		cache.addIncludeDirectory(directory.path / "Other");
+		cache.addIgnoredDirectory(directory.path / "Include" / "Generated");
+
+		return cache.computeFileHash(file);
+	};
+
+	rfk::GenerationCache::Hash hash = computeHash();
+
+	//Generated files don't make their source file dirty
+	generation_cache_tests::writeFile(generatedFile, "//Regenerated");
+	EXPECT_EQ(computeHash(), hash);
+
+	//Included files do, even when they include the file back
+	generation_cache_tests::writeFile(includedFile, "#include \"../Include/A.h\"\nstruct B { int i; };");
+	EXPECT_NE(computeHash(), hash);
+}
+
+//=========================================================
+//========== GenerationCache::refreshFilesData ============
+//=========================================================
+
+TEST(RfkGen_GenerationCache_refreshFilesData, ReadsModifiedFilesAgain)
+{
+	generation_cache_tests::TemporaryDirectory directory("ReadsModifiedFilesAgain");
+	fs::path file = directory.path / "A.h";
+
+	generation_cache_tests::writeFile(file, "struct STRUCT() A { int i; };");
+	fs::last_write_time(file, fs::file_time_type::clock::now() - std::chrono::hours(1));
+
+	rfk::GenerationCache		cache(directory.path / "Cache", 0u);
+	rfk::GenerationCache::Hash	hash = cache.computeFileHash(file);
+
+	//Files are read once until the data of the modified files is refreshed
+	generation_cache_tests::writeFile(file, "struct STRUCT() A { int j; };");
+	EXPECT_EQ(cache.computeFileHash(file), hash);
+
+	cache.refreshFilesData();
+	EXPECT_NE(cache.computeFileHash(file), hash);
+}
+
+//=========================================================
+//=========== GenerationCache::load / save ================
+//=========================================================
+
+TEST(RfkGen_GenerationCache_load, LoadsSavedHashes)
+{
+	generation_cache_tests::TemporaryDirectory directory("LoadsSavedHashes");
+	fs::path cacheFile	= directory.path / "Cache";
+	fs::path file		= directory.path / "A file.h";
+
+	rfk::GenerationCache cache(cacheFile, 42u);
+	EXPECT_FALSE(cache.load());
+
+	cache.update(file, 123u);
+	EXPECT_TRUE(cache.save());
+
+	rfk::GenerationCache loadedCache(cacheFile, 42u);
+	EXPECT_TRUE(loadedCache.load());
+	EXPECT_TRUE(loadedCache.isUpToDate(file, 123u));
+	EXPECT_FALSE(loadedCache.isUpToDate(file, 124u));
+	EXPECT_FALSE(loadedCache.isUpToDate(directory.path / "B.h", 123u));
+
+	loadedCache.invalidate(file);
+	EXPECT_FALSE(loadedCache.isUpToDate(file, 123u));
+}
+
+TEST(RfkGen_GenerationCache_load, InvalidatesOnSettingsChange)
+{
+	generation_cache_tests::TemporaryDirectory directory("InvalidatesOnSettingsChange");
+	fs::path cacheFile	= directory.path / "Cache";
+	fs::path file		= directory.path / "A.h";
+
+	rfk::GenerationCache cache(cacheFile, 42u);
+	cache.update(file, 123u);
+	EXPECT_TRUE(cache.save());
+
+	rfk::GenerationCache otherSettingsCache(cacheFile, 43u);
+	EXPECT_FALSE(otherSettingsCache.load());
+	EXPECT_FALSE(otherSettingsCache.isUpToDate(file, 123u));
+}
+
+TEST(RfkGen_GenerationCache_keepOnly, ForgetsRemovedFiles)
+{
+	rfk::GenerationCache cache("Cache", 0u);
+	cache.update("A.h", 1u);
+	cache.update("B.h", 2u);
+
+	cache.keepOnly({"B.h"});
+
+	EXPECT_FALSE(cache.isUpToDate("A.h", 1u));
+	EXPECT_TRUE(cache.isUpToDate("B.h", 2u));
+}
+
+//=========================================================
+//======= GenerationCache::restoreUnchangedOutputs ========
+//=========================================================
+
+TEST(RfkGen_GenerationCache_restoreUnchangedOutputs, UnchangedOutputsKeepTheirModificationTime)
+{
+	generation_cache_tests::TemporaryDirectory directory("UnchangedOutputsKeepTheirModificationTime");
+	fs::path unchangedOutput	= directory.path / "A.rfkh.h";
+	fs::path changedOutput		= directory.path / "B.rfkh.h";
+	fs::path newOutput			= directory.path / "C.rfkh.h";
+
+	//Date the existing outputs back so that a rewrite is always noticeable
+	fs::file_time_type previousTime = fs::file_time_type::clock::now() - std::chrono::hours(1);
+
+	generation_cache_tests::writeFile(unchangedOutput, "//A");
+	generation_cache_tests::writeFile(changedOutput, "//B");
+	fs::last_write_time(unchangedOutput, previousTime);
+	fs::last_write_time(changedOutput, previousTime);
+
+	std::vector<rfk::GenerationCache::OutputSnapshot> snapshots;
+	rfk::GenerationCache::snapshotOutput(unchangedOutput, snapshots);
+	rfk::GenerationCache::snapshotOutput(changedOutput, snapshots);
+	rfk::GenerationCache::snapshotOutput(newOutput, snapshots);
+	EXPECT_EQ(snapshots.size(), 2u);
+
+	//Regenerate
+	generation_cache_tests::writeFile(unchangedOutput, "//A");
+	generation_cache_tests::writeFile(changedOutput, "//B2");
+	generation_cache_tests::writeFile(newOutput, "//C");
+
+	EXPECT_EQ(rfk::GenerationCache::restoreUnchangedOutputs(snapshots), 1u);
+	EXPECT_EQ(fs::last_write_time(unchangedOutput), previousTime);
+	EXPECT_GT(fs::last_write_time(changedOutput), previousTime);
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <string>
+#include <thread>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "RefurekuGenerator/Misc/LocalSocket.h"
+
+namespace
+{
+	/**
+	*	@brief Get a socket path private to the current user and to a test.
+	*
+	*	@param name Name of the socket file.
+	*
+	*	@return The path to the socket file.
+	*/
+	fs::path getTestSocketPath(char const* name)
+	{
+		return rfk::LocalSocket::getUserDirectory() / name;
+	}
+}
+
+//=========================================================
+//=========== LocalSocket::getUserDirectory ===============
+//=========================================================
+
+TEST(RfkGen_LocalSocket_getUserDirectory, IsPrivate)
+{
+	fs::path directory = rfk::LocalSocket::getUserDirectory();
+
+	ASSERT_FALSE(directory.empty());
+	EXPECT_TRUE(fs::is_directory(directory));
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	EXPECT_EQ(fs::status(directory).permissions() & fs::perms::all, fs::perms::owner_all);
+#endif
+}
+
+//=========================================================
+//================ LocalSocket::listen ====================
+//=========================================================
+
+TEST(RfkGen_LocalSocket_listen, CreatesPrivateSocketFile)
+{
+	fs::path path = getTestSocketPath("listen.sock");
+
+	{
+		rfk::LocalSocket server = rfk::LocalSocket::listen(path);
+
+		EXPECT_TRUE(server.isValid());
+		EXPECT_TRUE(fs::exists(path));
+
+#if !defined(_WIN32) && !defined(_WIN64)
+		EXPECT_EQ(fs::status(path).permissions() & (fs::perms::group_all | fs::perms::others_all), fs::perms::none);
+#endif
+	}
+
+	//The socket file is removed with the socket
+	EXPECT_FALSE(fs::exists(path));
+}
+
+TEST(RfkGen_LocalSocket_listen, FailsOnListenedPath)
+{
+	fs::path			path	= getTestSocketPath("listened.sock");
+	rfk::LocalSocket	server	= rfk::LocalSocket::listen(path);
+
+	ASSERT_TRUE(server.isValid());
+	EXPECT_FALSE(rfk::LocalSocket::listen(path).isValid());
+
+	//The failed attempt must not remove the socket file of the listening socket
+	EXPECT_TRUE(rfk::LocalSocket::connect(path).isValid());
+}
+
+TEST(RfkGen_LocalSocket_listen, FailsOnRegularFile)
+{
+	fs::path path = getTestSocketPath("regular.sock");
+
+	std::ofstream(path) << "data";
+
+#if !defined(_WIN32) && !defined(_WIN64)
+	EXPECT_FALSE(rfk::LocalSocket::listen(path).isValid());
+	EXPECT_TRUE(fs::is_regular_file(path));
+#endif
+
+	fs::remove(path);
+}
+
+//=========================================================
+//================ LocalSocket::connect ===================
+//=========================================================
+
+TEST(RfkGen_LocalSocket_connect, FailsWithoutListener)
+{
+	fs::path path = getTestSocketPath("closed.sock");
+
+	{
+		rfk::LocalSocket server = rfk::LocalSocket::listen(path);
+		ASSERT_TRUE(server.isValid());
+	}
+
+	EXPECT_FALSE(rfk::LocalSocket::connect(path).isValid());
+}
+
+//=========================================================
+//========== LocalSocket::sendLine / receiveLine ==========
+//=========================================================
+
+TEST(RfkGen_LocalSocket_sendLine, ExchangesLines)
+{
+	fs::path			path	= getTestSocketPath("exchange.sock");
+	rfk::LocalSocket	server	= rfk::LocalSocket::listen(path);
+	ASSERT_TRUE(server.isValid());
+
+	EXPECT_FALSE(server.waitForConnection(std::chrono::milliseconds(10)));
+
+	std::thread clientThread([&path]()
+	{
+		rfk::LocalSocket client = rfk::LocalSocket::connect(path);
+		std::string line;
+
+		//Both lines are likely received at once, and must be split on reception
+		EXPECT_TRUE(client.sendLine("generate"));
+		EXPECT_TRUE(client.sendLine("stop"));
+		EXPECT_TRUE(client.receiveLine(line));
+		EXPECT_EQ(line, "ok");
+	});
+
+	ASSERT_TRUE(server.waitForConnection(std::chrono::seconds(10)));
+
+	rfk::LocalSocket connection = server.accept();
+	std::string line;
+
+	ASSERT_TRUE(connection.isValid());
+	EXPECT_TRUE(connection.receiveLine(line));
+	EXPECT_EQ(line, "generate");
+	EXPECT_TRUE(connection.receiveLine(line));
+	EXPECT_EQ(line, "stop");
+	EXPECT_TRUE(connection.sendLine("ok"));
+
+	clientThread.join();
+
+	//The client closed the connection
+	EXPECT_FALSE(connection.receiveLine(line));
+}
\ No newline at end of file
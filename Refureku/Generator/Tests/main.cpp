@@ -0,0 +1,11 @@
+#include <gtest/gtest.h>
+
+#include "GenerationCacheTests.cpp"
+#include "LocalSocketTests.cpp"
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+
+	return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Variables/Field.h>
+#include <Refureku/TypeInfo/Type.h>
+
+/**
+*	These benchmarks measure the per-call overhead of the most common accessors.
+*	Build them once with the default shared library and once with RFK_BUILD_STATIC (and RFK_ENABLE_LTO)
+*	to compare exported out-of-line calls with inlined hot getters.
+*/
+namespace accessor_benchmarks
+{
+	struct Fixture
+	{
+		rfk::Struct					base{"BenchmarkBase", 0u, 16u, false};
+		rfk::Struct					derived{"BenchmarkDerived", 0u, 16u, false};
+		rfk::Struct					unrelated{"BenchmarkUnrelated", 0u, 16u, false};
+		std::vector<std::string>	fieldNames;
+		std::vector<rfk::Field*>	fields;
+
+		Fixture(std::size_t fieldsCount)
+		{
+			base.addSubclass(derived, 0);
+			base.setFieldsCapacity(fieldsCount);
+
+			fieldNames.reserve(fieldsCount);
+			for (std::size_t i = 0u; i < fieldsCount; i++)
+			{
+				fieldNames.emplace_back("field" + std::to_string(i));
+				fields.push_back(base.addField(fieldNames.back().c_str(), i + 1u, rfk::getType<int const*>(), rfk::EFieldFlags::Public, i * sizeof(int*), &base));
+			}
+		}
+	};
+}
+
+static void Entity_getName(benchmark::State& state)
+{
+	accessor_benchmarks::Fixture fixture(1u);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.base.getName());
+	}
+}
+
+static void Entity_getId(benchmark::State& state)
+{
+	accessor_benchmarks::Fixture fixture(1u);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.base.getId());
+	}
+}
+
+static void Field_getMemoryOffset(benchmark::State& state)
+{
+	accessor_benchmarks::Fixture fixture(1u);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.fields.front()->getMemoryOffset());
+	}
+}
+
+static void Type_isPointer(benchmark::State& state)
+{
+	rfk::Type const& type = rfk::getType<int const*>();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(type.isPointer());
+	}
+}
+
+static void Struct_isBaseOf(benchmark::State& state)
+{
+	accessor_benchmarks::Fixture fixture(1u);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.base.isBaseOf(fixture.base));
+		benchmark::DoNotOptimize(fixture.base.isBaseOf(fixture.derived));
+		benchmark::DoNotOptimize(fixture.base.isBaseOf(fixture.unrelated));
+	}
+}
+
+static void Struct_getFieldByName(benchmark::State& state)
+{
+	accessor_benchmarks::Fixture fixture(static_cast<std::size_t>(state.range(0)));
+
+	std::size_t i = 0u;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.base.getFieldByName(fixture.fieldNames[i].c_str()));
+
+		i = (i + 1u) % fixture.fieldNames.size();
+	}
+}
+
+BENCHMARK(Entity_getName);
+BENCHMARK(Entity_getId);
+BENCHMARK(Field_getMemoryOffset);
+BENCHMARK(Type_isPointer);
+BENCHMARK(Struct_isBaseOf);
+BENCHMARK(Struct_getFieldByName)->Arg(8)->Arg(64);
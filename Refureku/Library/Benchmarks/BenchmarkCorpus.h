@@ -0,0 +1,173 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>	//std::size_t
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>	//std::forward
+#include <vector>
+
+#include <Refureku/TypeInfo/Entity/Entity.h>
+#include <Refureku/TypeInfo/Module/ModuleHandle.h>
+
+/**
+*	@brief	Generate a unique id for an entity reflected manually by a benchmark.
+*			Ids are generated far above the ids of the generated code so that they never collide.
+*
+*	@return A new entity id.
+*/
+inline std::size_t generateBenchmarkEntityId() noexcept
+{
+	static std::atomic<std::size_t> nextId{1u << 30};
+
+	return nextId.fetch_add(1u, std::memory_order_relaxed);
+}
+
+/**
+*	Entities reflected manually by a benchmark, with the names they point to.
+*	The corpus is built once, then registered to the database through a new module handle each time a benchmark loads it,
+*	so that the entities of a benchmark are not registered while other benchmarks run.
+*/
+class BenchmarkCorpus
+{
+	private:
+		/** Entity owned by the corpus, destroyed through its own type since entities don't have a virtual destructor. */
+		using OwnedEntity = std::unique_ptr<void, void(*)(void*)>;
+
+		/** Name of the module handles registering the corpus. */
+		std::string							_moduleName;
+
+		/** Names of the entities. A deque never moves its elements, so the entities can point to the names. */
+		std::deque<std::string>				_names;
+
+		/** Entities owned by the corpus. */
+		std::vector<OwnedEntity>			_entities;
+
+		/** File level entities registered when the corpus is loaded. */
+		std::vector<rfk::Entity const*>		_fileLevelEntities;
+
+		/** Module handle registering the corpus while it is loaded, nullptr otherwise. Destroyed before the entities it registers. */
+		std::unique_ptr<rfk::ModuleHandle>	_module;
+
+	public:
+		BenchmarkCorpus(char const* moduleName) noexcept:
+			_moduleName{moduleName}
+		{
+		}
+
+		/**
+		*	@brief Store a name in the corpus.
+		*
+		*	@param name The name to store.
+		*
+		*	@return The stored name, valid as long as the corpus.
+		*/
+		char const* addName(std::string name)
+		{
+			return _names.emplace_back(std::move(name)).c_str();
+		}
+
+		/**
+		*	@brief Construct an entity owned by the corpus.
+		*
+		*	@param args Arguments forwarded to the entity constructor.
+		*
+		*	@return The constructed entity.
+		*/
+		template <typename T, typename... ArgTypes>
+		T& make(ArgTypes&&... args)
+		{
+			T* entity = new T(std::forward<ArgTypes>(args)...);
+
+			_entities.emplace_back(entity, [](void* ownedEntity) { delete static_cast<T*>(ownedEntity); });
+
+			return *entity;
+		}
+
+		/**
+		*	@brief Add a file level entity registered when the corpus is loaded. The entity must outlive the corpus.
+		*
+		*	@param entity The entity to add.
+		*/
+		void add(rfk::Entity const& entity)
+		{
+			_fileLevelEntities.push_back(&entity);
+		}
+
+		/**
+		*	@brief Register all the file level entities of the corpus to the database through a new module handle.
+		*/
+		void load()
+		{
+			assert(_module == nullptr);
+
+			_module = std::make_unique<rfk::ModuleHandle>(_moduleName.c_str());
+			_module->reserve(_fileLevelEntities.size());
+			_module->addEntities(_fileLevelEntities.data(), _fileLevelEntities.size());
+			_module->load();
+		}
+
+		/**
+		*	@brief Unregister all the entities of the corpus from the database.
+		*/
+		void unload() noexcept
+		{
+			_module.reset();
+		}
+
+		/**
+		*	@brief Get the module handle registering the corpus. The corpus must be loaded.
+		*
+		*	@return The module handle registering the corpus.
+		*/
+		rfk::ModuleHandle const& getModule() const noexcept
+		{
+			assert(_module != nullptr);
+
+			return *_module;
+		}
+
+		/**
+		*	@brief Getter for the field _fileLevelEntities.
+		*
+		*	@return _fileLevelEntities.
+		*/
+		std::vector<rfk::Entity const*> const& getFileLevelEntities() const noexcept
+		{
+			return _fileLevelEntities;
+		}
+};
+
+/**
+*	Load a corpus for the lifetime of the object, so that a benchmark unloads its corpus when it finishes.
+*/
+class ScopedCorpusLoad
+{
+	private:
+		/** The loaded corpus. */
+		BenchmarkCorpus&	_corpus;
+
+	public:
+		ScopedCorpusLoad(BenchmarkCorpus& corpus):
+			_corpus{corpus}
+		{
+			_corpus.load();
+		}
+
+		ScopedCorpusLoad(ScopedCorpusLoad const&)	= delete;
+		ScopedCorpusLoad(ScopedCorpusLoad&&)		= delete;
+
+		~ScopedCorpusLoad() noexcept
+		{
+			_corpus.unload();
+		}
+};
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/StructPool.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks instantiate 100k copies of a prefab, comparing the reflected copy (Struct::copyConstructAt, StructPool::makeUniqueCopy)
+*	with hand-written virtual clone methods, for a trivially copyable prefab and for a prefab holding a std::string.
+*	Only the instantiation is timed, the copies being destroyed with the timer paused.
+*/
+namespace clone_benchmarks
+{
+	static constexpr std::size_t	instancesCount	= 100000u;
+
+	struct Cloneable
+	{
+		virtual ~Cloneable() = default;
+
+		virtual std::unique_ptr<Cloneable> clone() const = 0;
+	};
+
+	struct TrivialPrefab
+	{
+		float	position[3]	= {1.0f, 2.0f, 3.0f};
+		float	rotation[4]	= {0.0f, 0.0f, 0.0f, 1.0f};
+		int		health		= 100;
+	};
+
+	struct NamedPrefab
+	{
+		std::string	name		= "A prefab name too long for the small string optimization";
+		float		position[3]	= {1.0f, 2.0f, 3.0f};
+	};
+
+	template <typename T>
+	struct VirtualPrefab : public Cloneable, public T
+	{
+		std::unique_ptr<Cloneable> clone() const override
+		{
+			return std::make_unique<VirtualPrefab<T>>(*this);
+		}
+	};
+
+	template <typename T>
+	void registerCopyFunctions(rfk::Struct& archetype)
+	{
+		archetype.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<T>);
+		archetype.setMemoryAlignment(alignof(T));
+		archetype.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<T>());
+		archetype.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<T>());
+	}
+
+	struct Fixture
+	{
+		rfk::Struct							trivialArchetype{"CloneBenchmarkTrivialPrefab", generateBenchmarkEntityId(), sizeof(TrivialPrefab), false};
+		rfk::Struct							namedArchetype{"CloneBenchmarkNamedPrefab", generateBenchmarkEntityId(), sizeof(NamedPrefab), false};
+		std::unique_ptr<rfk::StructPool>	trivialPool;
+		std::unique_ptr<rfk::StructPool>	namedPool;
+
+		Fixture()
+		{
+			registerCopyFunctions<TrivialPrefab>(trivialArchetype);
+			registerCopyFunctions<NamedPrefab>(namedArchetype);
+
+			trivialPool	= std::make_unique<rfk::StructPool>(trivialArchetype, 1024u);
+			namedPool	= std::make_unique<rfk::StructPool>(namedArchetype, 1024u);
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+
+	/**
+	*	Instantiate the prefab instancesCount times by copying the prefab to each element of an uninitialized array.
+	*/
+	template <typename T>
+	void copyConstructPrefab(benchmark::State& state, rfk::Struct const& archetype)
+	{
+		T									prefab;
+		std::unique_ptr<unsigned char[]>	memory(new unsigned char[instancesCount * sizeof(T)]);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				benchmark::DoNotOptimize(archetype.copyConstructAt(memory.get() + i * sizeof(T), &prefab));
+			}
+
+			state.PauseTiming();
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				archetype.destroyInstanceAt(memory.get() + i * sizeof(T));
+			}
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * instancesCount);
+	}
+
+	/**
+	*	Instantiate instancesCount copies of the prefab with a single call from an array of prefabs.
+	*/
+	template <typename T>
+	void copyConstructPrefabArray(benchmark::State& state, rfk::Struct const& archetype)
+	{
+		std::vector<T>						prefabs(instancesCount);
+		std::unique_ptr<unsigned char[]>	memory(new unsigned char[instancesCount * sizeof(T)]);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(archetype.copyConstructAt(memory.get(), prefabs.data(), instancesCount));
+
+			state.PauseTiming();
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				archetype.destroyInstanceAt(memory.get() + i * sizeof(T));
+			}
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * instancesCount);
+	}
+
+	template <typename T>
+	void makePooledCopies(benchmark::State& state, rfk::StructPool& pool)
+	{
+		T										prefab;
+		std::vector<rfk::PooledPtr<T>>			instances;
+		instances.reserve(instancesCount);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				instances.push_back(pool.makeUniqueCopy<T>(&prefab));
+			}
+
+			state.PauseTiming();
+			instances.clear();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * instancesCount);
+	}
+
+	template <typename T>
+	void cloneVirtualPrefab(benchmark::State& state)
+	{
+		std::unique_ptr<Cloneable>				prefab = std::make_unique<VirtualPrefab<T>>();
+		std::vector<std::unique_ptr<Cloneable>>	instances;
+		instances.reserve(instancesCount);
+
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				instances.push_back(prefab->clone());
+			}
+
+			state.PauseTiming();
+			instances.clear();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed(state.iterations() * instancesCount);
+	}
+}
+
+static void Clone_Trivial_CopyConstructAt(benchmark::State& state)
+{
+	clone_benchmarks::copyConstructPrefab<clone_benchmarks::TrivialPrefab>(state, clone_benchmarks::getFixture().trivialArchetype);
+}
+
+static void Clone_Trivial_CopyConstructAtArray(benchmark::State& state)
+{
+	clone_benchmarks::copyConstructPrefabArray<clone_benchmarks::TrivialPrefab>(state, clone_benchmarks::getFixture().trivialArchetype);
+}
+
+static void Clone_Trivial_MakeUniqueCopy(benchmark::State& state)
+{
+	clone_benchmarks::makePooledCopies<clone_benchmarks::TrivialPrefab>(state, *clone_benchmarks::getFixture().trivialPool);
+}
+
+static void Clone_Trivial_VirtualClone(benchmark::State& state)
+{
+	clone_benchmarks::cloneVirtualPrefab<clone_benchmarks::TrivialPrefab>(state);
+}
+
+static void Clone_Named_CopyConstructAt(benchmark::State& state)
+{
+	clone_benchmarks::copyConstructPrefab<clone_benchmarks::NamedPrefab>(state, clone_benchmarks::getFixture().namedArchetype);
+}
+
+static void Clone_Named_CopyConstructAtArray(benchmark::State& state)
+{
+	clone_benchmarks::copyConstructPrefabArray<clone_benchmarks::NamedPrefab>(state, clone_benchmarks::getFixture().namedArchetype);
+}
+
+static void Clone_Named_MakeUniqueCopy(benchmark::State& state)
+{
+	clone_benchmarks::makePooledCopies<clone_benchmarks::NamedPrefab>(state, *clone_benchmarks::getFixture().namedPool);
+}
+
+static void Clone_Named_VirtualClone(benchmark::State& state)
+{
+	clone_benchmarks::cloneVirtualPrefab<clone_benchmarks::NamedPrefab>(state);
+}
+
+BENCHMARK(Clone_Trivial_CopyConstructAt)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Trivial_CopyConstructAtArray)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Trivial_MakeUniqueCopy)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Trivial_VirtualClone)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Named_CopyConstructAt)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Named_CopyConstructAtArray)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Named_MakeUniqueCopy)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Clone_Named_VirtualClone)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <cstring>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/ParentStruct.h>
+#include <Refureku/TypeInfo/Functions/Method.h>
+#include <Refureku/TypeInfo/Query/EntityQuery.h>
+#include <Refureku/TypeInfo/Type.h>
+#include <Refureku/Properties/Property.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks look for all the public methods named On* declared in classes deriving from a Component class
+*	and carrying an Exposed property, among 20k registered classes (2k of them deriving from Component) of 10 methods each,
+*	either with nested predicate loops over the database or with a compiled EntityQuery.
+*	The Exposed property is carried by one method every 50 classes.
+*/
+namespace entity_query_benchmarks
+{
+	static constexpr std::size_t classesCount		= 20000u;
+	static constexpr std::size_t componentsStride	= 10u;
+	static constexpr std::size_t methodsPerClass	= 10u;
+	static constexpr std::size_t exposedStride		= 50u;
+
+	class ExposedProperty : public rfk::Property
+	{
+		private:
+			rfk::Struct const& _archetype;
+
+		public:
+			ExposedProperty(rfk::Struct const& archetype) noexcept:
+				_archetype{archetype}
+			{
+			}
+
+			virtual rfk::Struct const& getArchetype() const noexcept override
+			{
+				return _archetype;
+			}
+	};
+
+	struct Fixture
+	{
+		BenchmarkCorpus		corpus{"EntityQueryBenchmarkModule"};
+		rfk::Struct&		exposed		= corpus.make<rfk::Struct>("BenchmarkExposed", generateBenchmarkEntityId(), 1u, true);
+		ExposedProperty		exposedProperty{exposed};
+		rfk::Struct&		component	= corpus.make<rfk::Struct>("BenchmarkComponent", generateBenchmarkEntityId(), 1u, true);
+
+		Fixture()
+		{
+			char const* methodNames[methodsPerClass];
+
+			for (std::size_t i = 0u; i < methodsPerClass; i++)
+			{
+				methodNames[i] = corpus.addName(((i % 2u == 0u) ? "On" : "Do") + std::to_string(i));
+			}
+
+			corpus.add(exposed);
+			corpus.add(component);
+
+			for (std::size_t i = 0u; i < classesCount; i++)
+			{
+				rfk::Struct& c = corpus.make<rfk::Struct>(corpus.addName("BenchmarkClass" + std::to_string(i)), generateBenchmarkEntityId(), 1u, true);
+
+				if (i % componentsStride == 0u)
+				{
+					c.addDirectParent(&component, rfk::EAccessSpecifier::Public);
+					component.addSubclass(c, 0);
+				}
+
+				c.setMethodsCapacity(methodsPerClass);
+				for (std::size_t j = 0u; j < methodsPerClass; j++)
+				{
+					rfk::Method* method = c.addMethod(methodNames[j], generateBenchmarkEntityId(), rfk::getType<void>(), nullptr, (j % 3u == 0u) ? rfk::EMethodFlags::Private : rfk::EMethodFlags::Public);
+
+					if (j == 0u && i % exposedStride == 0u)
+					{
+						method->addProperty(exposedProperty);
+					}
+				}
+
+				corpus.add(c);
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void EntityQuery_NestedPredicates(benchmark::State& state)
+{
+	entity_query_benchmarks::Fixture&	fixture = entity_query_benchmarks::getFixture();
+	ScopedCorpusLoad					corpusLoad(fixture.corpus);
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		rfk::getDatabase().foreachFileLevelClass([&fixture, &count](rfk::Class const& c)
+												 {
+													 if (c.isSubclassOf(fixture.component))
+													 {
+														 c.foreachMethod([&fixture, &count](rfk::Method const& method)
+																		 {
+																			 if (std::strncmp(method.getName(), "On", 2u) == 0 &&
+																				 method.getAccess() == rfk::EAccessSpecifier::Public &&
+																				 method.getProperty(fixture.exposed) != nullptr)
+																			 {
+																				 count++;
+																			 }
+
+																			 return true;
+																		 });
+													 }
+
+													 return true;
+												 });
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void EntityQuery_CompiledQuery(benchmark::State& state)
+{
+	entity_query_benchmarks::Fixture&	fixture = entity_query_benchmarks::getFixture();
+	ScopedCorpusLoad					corpusLoad(fixture.corpus);
+
+	rfk::CompiledQuery query = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method)
+												 .withNamePrefix("On")
+												 .derivedFrom(fixture.component)
+												 .withProperty(fixture.exposed)
+												 .withAccess(rfk::EAccessSpecifier::Public)
+												 .compile();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(query.count());
+	}
+
+	state.SetLabel(query.explain());
+}
+
+static void EntityQuery_CompiledQuery_SubclassTable(benchmark::State& state)
+{
+	entity_query_benchmarks::Fixture&	fixture = entity_query_benchmarks::getFixture();
+	ScopedCorpusLoad					corpusLoad(fixture.corpus);
+
+	//Without the property filter, the subclass table is the most selective index
+	rfk::CompiledQuery query = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method)
+												 .withNamePrefix("On")
+												 .derivedFrom(fixture.component)
+												 .withAccess(rfk::EAccessSpecifier::Public)
+												 .compile();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(query.count());
+	}
+}
+
+static void EntityQuery_Compile(benchmark::State& state)
+{
+	entity_query_benchmarks::Fixture&	fixture = entity_query_benchmarks::getFixture();
+	ScopedCorpusLoad					corpusLoad(fixture.corpus);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::EntityQuery().ofKind(rfk::EEntityKind::Method)
+												   .withNamePrefix("On")
+												   .derivedFrom(fixture.component)
+												   .withProperty(fixture.exposed)
+												   .withAccess(rfk::EAccessSpecifier::Public)
+												   .compile());
+	}
+}
+
+BENCHMARK(EntityQuery_NestedPredicates)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EntityQuery_CompiledQuery)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EntityQuery_CompiledQuery_SubclassTable)->Unit(benchmark::kMicrosecond);
+BENCHMARK(EntityQuery_Compile)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <string>
+#include <vector>
+#include <cstring>	//std::strcmp
+#include <memory>	//std::unique_ptr
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Enum.h>
+#include <Refureku/TypeInfo/Archetypes/EnumValue.h>
+#include <Refureku/TypeInfo/Archetypes/GetArchetype.h>
+
+namespace enum_benchmarks
+{
+	/**
+	*	@brief Build an enum containing valuesCount values.
+	* 
+	*	@param valuesCount	Number of values to add to the enum.
+	*	@param isDense		If true, values are contiguous, else they are spread over the whole int64 range.
+	*	@param out_names	Receives the names of the added enum values.
+	*/
+	inline std::unique_ptr<rfk::Enum> makeEnum(std::size_t valuesCount, bool isDense, std::vector<std::string>& out_names)
+	{
+		auto result = std::make_unique<rfk::Enum>("BenchmarkEnum", 0u, rfk::getArchetype<long long>());
+		result->setEnumValuesCapacity(valuesCount);
+
+		out_names.clear();
+		for (std::size_t i = 0u; i < valuesCount; i++)
+		{
+			out_names.emplace_back("EnumValueName_" + std::to_string(i));
+			result->addEnumValue(out_names.back().c_str(), i + 1u, isDense ? static_cast<rfk::int64>(i) : static_cast<rfk::int64>(i * 7919u * 104729u));
+		}
+
+		return result;
+	}
+
+	inline void enumGetValue(benchmark::State& state, bool isDense, bool useLinearScan)
+	{
+		std::vector<std::string> names;
+		std::size_t const valuesCount = static_cast<std::size_t>(state.range(0));
+		std::unique_ptr<rfk::Enum> e = makeEnum(valuesCount, isDense, names);
+
+		std::size_t i = 0u;
+		for (auto _ : state)
+		{
+			rfk::int64 value = e->getEnumValueAt(i).getValue();
+
+			if (useLinearScan)
+			{
+				benchmark::DoNotOptimize(e->getEnumValueByPredicate([](rfk::EnumValue const& ev, void* userData)
+																	{
+																		return ev.getValue() == *reinterpret_cast<rfk::int64*>(userData);
+																	}, &value));
+			}
+			else
+			{
+				benchmark::DoNotOptimize(e->getEnumValue(value));
+			}
+
+			i = (i + 1u) % valuesCount;
+		}
+	}
+
+	inline void enumGetValueByName(benchmark::State& state, bool useLinearScan)
+	{
+		std::vector<std::string> names;
+		std::size_t const valuesCount = static_cast<std::size_t>(state.range(0));
+		std::unique_ptr<rfk::Enum> e = makeEnum(valuesCount, true, names);
+
+		std::size_t i = 0u;
+		for (auto _ : state)
+		{
+			char const* name = names[i].c_str();
+
+			if (useLinearScan)
+			{
+				benchmark::DoNotOptimize(e->getEnumValueByPredicate([](rfk::EnumValue const& ev, void* userData)
+																	{
+																		return std::strcmp(ev.getName(), reinterpret_cast<char const*>(userData)) == 0;
+																	}, const_cast<char*>(name)));
+			}
+			else
+			{
+				benchmark::DoNotOptimize(e->getEnumValueByName(name));
+			}
+
+			i = (i + 1u) % valuesCount;
+		}
+	}
+}
+
+static void Enum_getEnumValue_Dense(benchmark::State& state)			{ enum_benchmarks::enumGetValue(state, true, false); }
+static void Enum_getEnumValue_Sparse(benchmark::State& state)			{ enum_benchmarks::enumGetValue(state, false, false); }
+static void Enum_getEnumValue_LinearScan(benchmark::State& state)		{ enum_benchmarks::enumGetValue(state, false, true); }
+static void Enum_getEnumValueByName(benchmark::State& state)			{ enum_benchmarks::enumGetValueByName(state, false); }
+static void Enum_getEnumValueByName_LinearScan(benchmark::State& state)	{ enum_benchmarks::enumGetValueByName(state, true); }
+
+BENCHMARK(Enum_getEnumValue_Dense)->Arg(8)->Arg(64)->Arg(512)->Arg(4096);
+BENCHMARK(Enum_getEnumValue_Sparse)->Arg(8)->Arg(64)->Arg(512)->Arg(4096);
+BENCHMARK(Enum_getEnumValue_LinearScan)->Arg(8)->Arg(64)->Arg(512)->Arg(4096);
+BENCHMARK(Enum_getEnumValueByName)->Arg(8)->Arg(64)->Arg(512)->Arg(4096);
+BENCHMARK(Enum_getEnumValueByName_LinearScan)->Arg(8)->Arg(64)->Arg(512)->Arg(4096);
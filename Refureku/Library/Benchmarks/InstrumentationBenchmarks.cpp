@@ -0,0 +1,112 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Instrumentation.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks measure the cost of the lookups counted by the instrumentation (compare builds with and without RFK_ENABLE_INSTRUMENTATION),
+*	and the cost of aggregating the counters of all threads.
+*/
+namespace instrumentation_benchmarks
+{
+	static constexpr std::size_t classesCount	= 1000u;
+	static constexpr std::size_t fieldsPerClass	= 8u;
+
+	struct Fixture
+	{
+		BenchmarkCorpus				corpus{"InstrumentationBenchmarkModule"};
+		std::vector<rfk::Struct*>	classes;
+
+		/** Ids of all the classes and fields of the corpus. */
+		std::vector<std::size_t>	ids;
+
+		Fixture()
+		{
+			classes.reserve(classesCount);
+			ids.reserve(classesCount * (fieldsPerClass + 1u));
+
+			for (std::size_t i = 0u; i < classesCount; i++)
+			{
+				rfk::Struct& c = *classes.emplace_back(&corpus.make<rfk::Struct>(corpus.addName("InstrumentationBenchmarkClass" + std::to_string(i)), ids.emplace_back(generateBenchmarkEntityId()), fieldsPerClass * sizeof(int), true));
+
+				c.setFieldsCapacity(fieldsPerClass);
+				for (std::size_t j = 0u; j < fieldsPerClass; j++)
+				{
+					c.addField(corpus.addName("field" + std::to_string(j)), ids.emplace_back(generateBenchmarkEntityId()), rfk::getType<int>(), rfk::EFieldFlags::Public, j * sizeof(int), &c);
+				}
+
+				corpus.add(c);
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void Instrumentation_FieldLookup(benchmark::State& state)
+{
+	//Field lookups don't go through the database, so the corpus is not loaded by this benchmark which also runs on several threads at once
+	instrumentation_benchmarks::Fixture const& fixture = instrumentation_benchmarks::getFixture();
+
+	std::size_t classIndex = 0u;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(fixture.classes[classIndex]->getFieldByName("field5"));
+
+		classIndex = (classIndex + 1u) % instrumentation_benchmarks::classesCount;
+	}
+}
+
+static void Instrumentation_IdLookup(benchmark::State& state)
+{
+	instrumentation_benchmarks::Fixture&	fixture = instrumentation_benchmarks::getFixture();
+	ScopedCorpusLoad						corpusLoad(fixture.corpus);
+
+	std::size_t idIndex = 0u;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::getDatabase().getEntityById(fixture.ids[idIndex]));
+
+		idIndex = (idIndex + 1u < fixture.ids.size()) ? idIndex + 1u : 0u;
+	}
+}
+
+static void Instrumentation_GetHottestLookups(benchmark::State& state)
+{
+	instrumentation_benchmarks::Fixture&	fixture = instrumentation_benchmarks::getFixture();
+	ScopedCorpusLoad						corpusLoad(fixture.corpus);
+
+	rfk::getDatabase().resetInstrumentationCounters();
+
+	//Count a lookup for every field so that all the fields are aggregated
+	for (rfk::Struct const* c : fixture.classes)
+	{
+		for (std::size_t j = 0u; j < instrumentation_benchmarks::fieldsPerClass; j++)
+		{
+			benchmark::DoNotOptimize(c->getFieldByName(("field" + std::to_string(j)).c_str()));
+		}
+	}
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::getDatabase().getHottestLookups(10u));
+	}
+}
+
+BENCHMARK(Instrumentation_FieldLookup);
+BENCHMARK(Instrumentation_FieldLookup)->Threads(4);
+BENCHMARK(Instrumentation_IdLookup);
+BENCHMARK(Instrumentation_GetHottestLookups)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
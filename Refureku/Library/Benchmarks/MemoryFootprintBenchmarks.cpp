@@ -0,0 +1,141 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/Enum.h>
+#include <Refureku/TypeInfo/Functions/Method.h>
+#include <Refureku/TypeInfo/MemoryFootprint.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks compute the memory footprint of a synthetic corpus of 10k classes
+*	(8 fields and 8 methods of 2 parameters each) and 1k enums of 16 values.
+*	The footprint report is printed as counters (bytes per category) so that reductions can be tracked over releases.
+*/
+namespace memory_footprint_benchmarks
+{
+	static constexpr std::size_t classesCount		= 10000u;
+	static constexpr std::size_t fieldsPerClass		= 8u;
+	static constexpr std::size_t methodsPerClass	= 8u;
+	static constexpr std::size_t enumsCount			= 1000u;
+	static constexpr std::size_t valuesPerEnum		= 16u;
+
+	struct Fixture
+	{
+		BenchmarkCorpus	corpus{"MemoryFootprintBenchmarkModule"};
+
+		Fixture()
+		{
+			for (std::size_t i = 0u; i < classesCount; i++)
+			{
+				rfk::Struct& c = corpus.make<rfk::Struct>(corpus.addName("MemoryFootprintBenchmarkClass" + std::to_string(i)), generateBenchmarkEntityId(), fieldsPerClass * sizeof(int), true);
+
+				c.setFieldsCapacity(fieldsPerClass);
+				for (std::size_t j = 0u; j < fieldsPerClass; j++)
+				{
+					c.addField(corpus.addName("field" + std::to_string(j)), generateBenchmarkEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, j * sizeof(int), &c);
+				}
+
+				c.setMethodsCapacity(methodsPerClass);
+				for (std::size_t j = 0u; j < methodsPerClass; j++)
+				{
+					rfk::Method* method = c.addMethod(corpus.addName("method" + std::to_string(j)), generateBenchmarkEntityId(), rfk::getType<int>(), nullptr, rfk::EMethodFlags::Public);
+					method->setParametersCapacity(2u);
+					method->addParameter("value", generateBenchmarkEntityId(), rfk::getType<float const&>());
+					method->addParameter("count", generateBenchmarkEntityId(), rfk::getType<int>());
+				}
+
+				corpus.add(c);
+			}
+
+			for (std::size_t i = 0u; i < enumsCount; i++)
+			{
+				rfk::Enum& e = corpus.make<rfk::Enum>(corpus.addName("MemoryFootprintBenchmarkEnum" + std::to_string(i)), generateBenchmarkEntityId(), rfk::getArchetype<int>());
+
+				e.setEnumValuesCapacity(valuesPerEnum);
+				for (std::size_t j = 0u; j < valuesPerEnum; j++)
+				{
+					e.addEnumValue(corpus.addName("Value" + std::to_string(j)), generateBenchmarkEntityId(), static_cast<rfk::int64>(j));
+				}
+
+				corpus.add(e);
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+
+	/**
+	*	@brief Report the bytes of each footprint category as benchmark counters.
+	*
+	*	@param state		The benchmark state.
+	*	@param footprint	The reported footprint.
+	*/
+	static void reportFootprint(benchmark::State& state, rfk::MemoryFootprint const& footprint)
+	{
+		auto report = [&state](char const* name, rfk::MemoryFootprintEntry const& entry)
+		{
+			state.counters[name] = benchmark::Counter(static_cast<double>(entry.bytes), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+		};
+
+		report("Namespaces", footprint.namespaces);
+		report("Structs", footprint.structs);
+		report("Enums", footprint.enums);
+		report("EnumValues", footprint.enumValues);
+		report("Fields", footprint.fields);
+		report("Methods", footprint.methods);
+		report("Parameters", footprint.parameters);
+		report("Names", footprint.names);
+		report("Properties", footprint.properties);
+		report("Types", footprint.types);
+		report("StructContainers", footprint.structContainers);
+		report("EnumContainers", footprint.enumContainers);
+		report("NamespaceContainers", footprint.namespaceContainers);
+		report("RegistrationTables", footprint.registrationTables);
+		report("HashBuckets", footprint.hashBuckets);
+
+		state.counters["Total"] = benchmark::Counter(static_cast<double>(footprint.getTotalBytes()), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+	}
+}
+
+static void MemoryFootprint_Database(benchmark::State& state)
+{
+	ScopedCorpusLoad corpusLoad(memory_footprint_benchmarks::getFixture().corpus);
+
+	rfk::MemoryFootprint footprint;
+
+	for (auto _ : state)
+	{
+		footprint = rfk::getDatabase().computeMemoryFootprint();
+		benchmark::DoNotOptimize(footprint);
+	}
+
+	memory_footprint_benchmarks::reportFootprint(state, footprint);
+}
+
+static void MemoryFootprint_Module(benchmark::State& state)
+{
+	memory_footprint_benchmarks::Fixture&	fixture = memory_footprint_benchmarks::getFixture();
+	ScopedCorpusLoad						corpusLoad(fixture.corpus);
+
+	rfk::MemoryFootprint footprint;
+
+	for (auto _ : state)
+	{
+		footprint = fixture.corpus.getModule().computeMemoryFootprint();
+		benchmark::DoNotOptimize(footprint);
+	}
+
+	memory_footprint_benchmarks::reportFootprint(state, footprint);
+}
+
+BENCHMARK(MemoryFootprint_Database)->Unit(benchmark::kMillisecond);
+BENCHMARK(MemoryFootprint_Module)->Unit(benchmark::kMillisecond);
\ No newline at end of file
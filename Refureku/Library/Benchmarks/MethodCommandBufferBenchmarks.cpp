@@ -0,0 +1,189 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Functions/MethodCommandBuffer.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks defer 100k calls to a reflected method and execute them, comparing MethodCommandBuffer
+*	with a queue of std::function, and with calling Method::invokeUnsafe immediately.
+*	The multi-producer benchmarks record the calls from 4 threads, the std::function queue being protected by a mutex.
+*/
+namespace method_command_buffer_benchmarks
+{
+	static constexpr std::size_t	callsCount		= 100000u;
+	static constexpr std::size_t	producersCount	= 4u;
+
+	struct Counter
+	{
+		int sum = 0;
+
+		void add(int value)
+		{
+			sum += value;
+		}
+	};
+
+	struct Fixture
+	{
+		rfk::Struct		counterArchetype{"CommandBufferBenchmarkCounter", generateBenchmarkEntityId(), sizeof(Counter), false};
+		rfk::Method*	add;
+
+		Fixture()
+		{
+			add = counterArchetype.addMethod("add", generateBenchmarkEntityId(), rfk::getType<void>(), new rfk::MemberFunction<Counter, void(int)>(&Counter::add), rfk::EMethodFlags::Public);
+			add->addParameter("value", 0u, rfk::getType<int>());
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void MethodCommandBuffer_ImmediateInvoke(benchmark::State& state)
+{
+	rfk::Method const&					add = *method_command_buffer_benchmarks::getFixture().add;
+	method_command_buffer_benchmarks::Counter	counter;
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < method_command_buffer_benchmarks::callsCount; i++)
+		{
+			add.invokeUnsafe(&counter, static_cast<int>(i));
+		}
+
+		benchmark::DoNotOptimize(counter.sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * method_command_buffer_benchmarks::callsCount);
+}
+
+static void MethodCommandBuffer_RecordAndExecute(benchmark::State& state)
+{
+	rfk::Method const&					add = *method_command_buffer_benchmarks::getFixture().add;
+	method_command_buffer_benchmarks::Counter	counter;
+	rfk::MethodCommandBuffer			buffer;
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < method_command_buffer_benchmarks::callsCount; i++)
+		{
+			buffer.recordUnsafe(add, &counter, static_cast<int>(i));
+		}
+
+		benchmark::DoNotOptimize(buffer.execute());
+	}
+
+	state.SetItemsProcessed(state.iterations() * method_command_buffer_benchmarks::callsCount);
+}
+
+static void MethodCommandBuffer_FunctionQueue(benchmark::State& state)
+{
+	rfk::Method const&					add = *method_command_buffer_benchmarks::getFixture().add;
+	method_command_buffer_benchmarks::Counter	counter;
+	std::vector<std::function<void()>>	queue;
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < method_command_buffer_benchmarks::callsCount; i++)
+		{
+			queue.emplace_back([&add, &counter, value = static_cast<int>(i)]() { add.invokeUnsafe(&counter, int{value}); });
+		}
+
+		for (std::function<void()>& call : queue)
+		{
+			call();
+		}
+
+		queue.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * method_command_buffer_benchmarks::callsCount);
+}
+
+static void MethodCommandBuffer_MultiProducerRecordAndExecute(benchmark::State& state)
+{
+	rfk::Method const&					add = *method_command_buffer_benchmarks::getFixture().add;
+	method_command_buffer_benchmarks::Counter	counter;
+	rfk::MethodCommandBuffer			buffer;
+
+	for (auto _ : state)
+	{
+		std::vector<std::thread> producers;
+
+		for (std::size_t p = 0u; p < method_command_buffer_benchmarks::producersCount; p++)
+		{
+			producers.emplace_back([&add, &counter, &buffer]()
+								   {
+									   for (std::size_t i = 0u; i < method_command_buffer_benchmarks::callsCount / method_command_buffer_benchmarks::producersCount; i++)
+									   {
+										   buffer.recordUnsafe(add, &counter, static_cast<int>(i));
+									   }
+								   });
+		}
+
+		for (std::thread& producer : producers)
+		{
+			producer.join();
+		}
+
+		benchmark::DoNotOptimize(buffer.execute());
+	}
+
+	state.SetItemsProcessed(state.iterations() * method_command_buffer_benchmarks::callsCount);
+}
+
+static void MethodCommandBuffer_MultiProducerFunctionQueue(benchmark::State& state)
+{
+	rfk::Method const&					add = *method_command_buffer_benchmarks::getFixture().add;
+	method_command_buffer_benchmarks::Counter	counter;
+	std::mutex							mutex;
+	std::vector<std::function<void()>>	queue;
+
+	for (auto _ : state)
+	{
+		std::vector<std::thread> producers;
+
+		for (std::size_t p = 0u; p < method_command_buffer_benchmarks::producersCount; p++)
+		{
+			producers.emplace_back([&add, &counter, &mutex, &queue]()
+								   {
+									   for (std::size_t i = 0u; i < method_command_buffer_benchmarks::callsCount / method_command_buffer_benchmarks::producersCount; i++)
+									   {
+										   std::lock_guard lock(mutex);
+
+										   queue.emplace_back([&add, &counter, value = static_cast<int>(i)]() { add.invokeUnsafe(&counter, int{value}); });
+									   }
+								   });
+		}
+
+		for (std::thread& producer : producers)
+		{
+			producer.join();
+		}
+
+		for (std::function<void()>& call : queue)
+		{
+			call();
+		}
+
+		queue.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * method_command_buffer_benchmarks::callsCount);
+}
+
+BENCHMARK(MethodCommandBuffer_ImmediateInvoke)->Unit(benchmark::kMicrosecond);
+BENCHMARK(MethodCommandBuffer_RecordAndExecute)->Unit(benchmark::kMicrosecond);
+BENCHMARK(MethodCommandBuffer_FunctionQueue)->Unit(benchmark::kMicrosecond);
+BENCHMARK(MethodCommandBuffer_MultiProducerRecordAndExecute)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(MethodCommandBuffer_MultiProducerFunctionQueue)->Unit(benchmark::kMicrosecond)->UseRealTime();
\ No newline at end of file
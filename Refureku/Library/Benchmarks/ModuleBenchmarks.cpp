@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/Enum.h>
+#include <Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h>
+#include <Refureku/TypeInfo/Module/ModuleHandle.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks load then unload a plugin of 20k file level entities (structs with 2 fields and enums with 2 values),
+*	either through one ArchetypeRegisterer per entity like the default generated code,
+*	or through a single ModuleHandle registration table.
+*/
+namespace module_benchmarks
+{
+	static constexpr std::size_t structsCount	= 15000u;
+	static constexpr std::size_t enumsCount		= 5000u;
+
+	struct Fixture
+	{
+		/** Registered by each benchmark itself, never loaded. */
+		BenchmarkCorpus	corpus{"ModuleBenchmarkModule"};
+
+		Fixture()
+		{
+			for (std::size_t i = 0u; i < structsCount; i++)
+			{
+				rfk::Struct& s = corpus.make<rfk::Struct>(corpus.addName("ModuleStruct" + std::to_string(i)), generateBenchmarkEntityId(), 2u * sizeof(int), false);
+				s.setFieldsCapacity(2u);
+				s.addField("field0", generateBenchmarkEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+				s.addField("field1", generateBenchmarkEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, sizeof(int), &s);
+
+				corpus.add(s);
+			}
+
+			for (std::size_t i = 0u; i < enumsCount; i++)
+			{
+				rfk::Enum& e = corpus.make<rfk::Enum>(corpus.addName("ModuleEnum" + std::to_string(i)), generateBenchmarkEntityId(), rfk::getArchetype<int>());
+				e.addEnumValue("Value0", generateBenchmarkEntityId(), 0);
+				e.addEnumValue("Value1", generateBenchmarkEntityId(), 1);
+
+				corpus.add(e);
+			}
+		}
+	};
+
+	static Fixture const& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void Module_LoadUnload_PerEntityRegisterers(benchmark::State& state)
+{
+	std::vector<rfk::Entity const*> const& entities = module_benchmarks::getFixture().corpus.getFileLevelEntities();
+
+	std::vector<std::unique_ptr<rfk::ArchetypeRegisterer>> registerers;
+	registerers.reserve(entities.size());
+
+	for (auto _ : state)
+	{
+		for (rfk::Entity const* entity : entities)
+		{
+			registerers.emplace_back(std::make_unique<rfk::ArchetypeRegisterer>(*static_cast<rfk::Archetype const*>(entity)));
+		}
+
+		//Registerers are destroyed in the reverse order, like static objects are
+		while (!registerers.empty())
+		{
+			registerers.pop_back();
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * entities.size());
+}
+
+static void Module_LoadUnload_ModuleHandle(benchmark::State& state)
+{
+	std::vector<rfk::Entity const*> const& entities = module_benchmarks::getFixture().corpus.getFileLevelEntities();
+
+	for (auto _ : state)
+	{
+		rfk::ModuleHandle module("BenchmarkModule");
+
+		module.addEntities(entities.data(), entities.size());
+		module.load();
+		module.unload();
+	}
+
+	state.SetItemsProcessed(state.iterations() * entities.size());
+}
+
+BENCHMARK(Module_LoadUnload_PerEntityRegisterers)->Unit(benchmark::kMillisecond);
+BENCHMARK(Module_LoadUnload_ModuleHandle)->Unit(benchmark::kMillisecond);
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cctype>	//std::tolower
+#include <limits>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Functions/Method.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks retrieve the first 20 entities in name order which name starts with a prefix (ignoring the case),
+*	among 20k registered classes of 10 methods each (220k names),
+*	either by scanning the database or with the database name index.
+*/
+namespace name_index_benchmarks
+{
+	static constexpr std::size_t classesCount		= 20000u;
+	static constexpr std::size_t methodsPerClass	= 10u;
+	static constexpr std::size_t resultsCount		= 20u;
+	static constexpr std::size_t moduleClassesCount	= 100u;
+
+	static constexpr char const* prefix				= "onspawn1";
+
+	/**
+	*	@brief Compare at most maxLength characters of two strings, ignoring the case.
+	*
+	*	@return A negative value if lhs is ordered before rhs, 0 if they are equal, else a positive value.
+	*/
+	static int compareIgnoringCase(char const* lhs, char const* rhs, std::size_t maxLength = std::numeric_limits<std::size_t>::max())
+	{
+		for (std::size_t i = 0u; i < maxLength; i++)
+		{
+			int diff = std::tolower(static_cast<unsigned char>(lhs[i])) - std::tolower(static_cast<unsigned char>(rhs[i]));
+
+			if (diff != 0 || lhs[i] == '\0')
+			{
+				return diff;
+			}
+		}
+
+		return 0;
+	}
+
+	struct Fixture
+	{
+		BenchmarkCorpus				corpus{"NameIndexBenchmarkModule"};
+		std::vector<rfk::Struct*>	classes;
+
+		/** Classes loaded and unloaded by the incremental update benchmark on top of the corpus. */
+		BenchmarkCorpus				moduleCorpus{"NameIndexBenchmarkIncrementalModule"};
+
+		Fixture()
+		{
+			static char const* const words[methodsPerClass] = { "Spawn", "Update", "Render", "Load", "Save", "Play", "Stop", "Open", "Close", "Reset" };
+
+			classes.reserve(classesCount);
+
+			for (std::size_t i = 0u; i < classesCount; i++)
+			{
+				rfk::Struct& c = *classes.emplace_back(&corpus.make<rfk::Struct>(corpus.addName("NameIndexBenchmarkClass" + std::to_string(i)), generateBenchmarkEntityId(), 1u, true));
+
+				c.setMethodsCapacity(methodsPerClass);
+				for (std::size_t j = 0u; j < methodsPerClass; j++)
+				{
+					c.addMethod(corpus.addName(std::string("On") + words[j] + std::to_string(i)), generateBenchmarkEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+				}
+
+				corpus.add(c);
+			}
+
+			for (std::size_t i = 0u; i < moduleClassesCount; i++)
+			{
+				moduleCorpus.add(moduleCorpus.make<rfk::Struct>(moduleCorpus.addName("NameIndexBenchmarkModuleClass" + std::to_string(i)), generateBenchmarkEntityId(), 1u, true));
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void NameIndex_FullScan(benchmark::State& state)
+{
+	ScopedCorpusLoad corpusLoad(name_index_benchmarks::getFixture().corpus);
+
+	std::size_t const prefixLength = std::char_traits<char>::length(name_index_benchmarks::prefix);
+
+	for (auto _ : state)
+	{
+		std::vector<rfk::Entity const*> matches;
+
+		rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Method, [&matches, prefixLength](rfk::Entity const& entity)
+												 {
+													 if (name_index_benchmarks::compareIgnoringCase(entity.getName(), name_index_benchmarks::prefix, prefixLength) == 0)
+													 {
+														 matches.push_back(&entity);
+													 }
+
+													 return true;
+												 }, 1u);
+
+		std::size_t count = std::min(matches.size(), name_index_benchmarks::resultsCount);
+
+		std::partial_sort(matches.begin(), matches.begin() + count, matches.end(), [](rfk::Entity const* lhs, rfk::Entity const* rhs)
+						  {
+							  return name_index_benchmarks::compareIgnoringCase(lhs->getName(), rhs->getName()) < 0;
+						  });
+
+		benchmark::DoNotOptimize(matches.data());
+	}
+}
+
+static void NameIndex_Prefix(benchmark::State& state)
+{
+	ScopedCorpusLoad corpusLoad(name_index_benchmarks::getFixture().corpus);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::getDatabase().getEntitiesByNamePrefix(name_index_benchmarks::prefix, rfk::EEntityKind::Method,
+																			name_index_benchmarks::resultsCount, false));
+	}
+}
+
+static void NameIndex_ScopedPrefix(benchmark::State& state)
+{
+	name_index_benchmarks::Fixture&	fixture = name_index_benchmarks::getFixture();
+	ScopedCorpusLoad				corpusLoad(fixture.corpus);
+
+	rfk::Struct const& outerEntity = *fixture.classes[name_index_benchmarks::classesCount / 2u];
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::getDatabase().getEntitiesByNamePrefix("onre", rfk::EEntityKind::Method,
+																			name_index_benchmarks::resultsCount, false, &outerEntity));
+	}
+}
+
+static void NameIndex_IncrementalUpdate(benchmark::State& state)
+{
+	name_index_benchmarks::Fixture&	fixture = name_index_benchmarks::getFixture();
+	ScopedCorpusLoad				corpusLoad(fixture.corpus);
+
+	//Load and unload a module of 100 classes then query the index, which merges the changes
+	for (auto _ : state)
+	{
+		fixture.moduleCorpus.load();
+
+		benchmark::DoNotOptimize(rfk::getDatabase().getEntitiesByNamePrefix(name_index_benchmarks::prefix, rfk::EEntityKind::Method,
+																			name_index_benchmarks::resultsCount, false));
+
+		fixture.moduleCorpus.unload();
+
+		benchmark::DoNotOptimize(rfk::getDatabase().getEntitiesByNamePrefix(name_index_benchmarks::prefix, rfk::EEntityKind::Method,
+																			name_index_benchmarks::resultsCount, false));
+	}
+}
+
+BENCHMARK(NameIndex_FullScan)->Unit(benchmark::kMicrosecond);
+BENCHMARK(NameIndex_Prefix)->Unit(benchmark::kMicrosecond);
+BENCHMARK(NameIndex_ScopedPrefix)->Unit(benchmark::kMicrosecond);
+BENCHMARK(NameIndex_IncrementalUpdate)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <atomic>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Variables/Field.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks run a tooling-like validation pass (hashing the name of every field of every struct)
+*	over 20k registered structs, with 1, 2, 4, 8 and 16 threads.
+*/
+namespace parallel_benchmarks
+{
+	static constexpr std::size_t structsCount	= 20000u;
+	static constexpr std::size_t fieldsCount	= 8u;
+
+	struct Fixture
+	{
+		BenchmarkCorpus	corpus{"ParallelBenchmarkModule"};
+
+		Fixture()
+		{
+			for (std::size_t i = 0u; i < structsCount; i++)
+			{
+				std::string structName = "ParallelStruct" + std::to_string(i);
+
+				rfk::Struct& s = corpus.make<rfk::Struct>(corpus.addName(structName), generateBenchmarkEntityId(), fieldsCount * sizeof(int), false);
+				s.setFieldsCapacity(fieldsCount);
+				for (std::size_t j = 0u; j < fieldsCount; j++)
+				{
+					s.addField(corpus.addName(structName + "_field" + std::to_string(j)), generateBenchmarkEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, j * sizeof(int), &s);
+				}
+
+				corpus.add(s);
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+
+	static std::size_t hashFields(rfk::Struct const& s) noexcept
+	{
+		std::size_t hash = 14695981039346656037u;
+
+		s.foreachField([&hash](rfk::Field const& field)
+					   {
+						   for (char const* c = field.getName(); *c != '\0'; c++)
+						   {
+							   hash = (hash ^ static_cast<std::size_t>(*c)) * 1099511628211u;
+						   }
+
+						   return true;
+					   });
+
+		return hash;
+	}
+}
+
+static void Parallel_ForeachEntity(benchmark::State& state)
+{
+	ScopedCorpusLoad corpusLoad(parallel_benchmarks::getFixture().corpus);
+
+	rfk::Database const& db = rfk::getDatabase();
+
+	for (auto _ : state)
+	{
+		std::atomic<std::size_t> visitedCount{0u};
+
+		db.parallelForeachEntity(rfk::EEntityKind::Struct, [&visitedCount](rfk::Entity const& entity)
+								 {
+									 benchmark::DoNotOptimize(parallel_benchmarks::hashFields(static_cast<rfk::Struct const&>(entity)));
+									 visitedCount.fetch_add(1u, std::memory_order_relaxed);
+
+									 return true;
+								 }, static_cast<std::size_t>(state.range(0)));
+
+		benchmark::DoNotOptimize(visitedCount.load());
+	}
+
+	state.SetItemsProcessed(state.iterations() * parallel_benchmarks::structsCount);
+}
+
+static void Parallel_ReduceEntities(benchmark::State& state)
+{
+	ScopedCorpusLoad corpusLoad(parallel_benchmarks::getFixture().corpus);
+
+	rfk::Database const& db = rfk::getDatabase();
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(db.parallelReduceEntities(rfk::EEntityKind::Struct, std::size_t(0u),
+															[](rfk::Entity const& entity) { return parallel_benchmarks::hashFields(static_cast<rfk::Struct const&>(entity)); },
+															[](std::size_t lhs, std::size_t rhs) { return lhs ^ rhs; },
+															static_cast<std::size_t>(state.range(0))));
+	}
+
+	state.SetItemsProcessed(state.iterations() * parallel_benchmarks::structsCount);
+}
+
+BENCHMARK(Parallel_ForeachEntity)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(Parallel_ReduceEntities)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime()->Unit(benchmark::kMicrosecond);
\ No newline at end of file
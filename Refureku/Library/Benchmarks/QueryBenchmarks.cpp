@@ -0,0 +1,299 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Variables/Field.h>
+#include <Refureku/TypeInfo/Functions/Method.h>
+#include <Refureku/TypeInfo/Type.h>
+#include <Refureku/Containers/SmallVector.h>
+#include <Refureku/Containers/ArenaAllocator.h>
+
+/**
+*	These benchmarks run the same field filter (count the fields stored past the first 16 bytes of their struct)
+*	over 10k structs through each shape of the query API:
+*	function pointer + userData, header-only callable, a raw loop over the exported span,
+*	and the lazy view / caller provided buffer / SmallVector / arena alternatives to the rfk::Vector returning queries.
+*/
+namespace query_benchmarks
+{
+	static constexpr std::size_t structsCount		= 10000u;
+	static constexpr std::size_t fieldsPerStruct	= 8u;
+	static constexpr std::size_t methodsPerStruct	= 2u;
+
+	struct Fixture
+	{
+		std::vector<std::string>					names;
+		std::vector<std::unique_ptr<rfk::Struct>>	structs;
+
+		Fixture()
+		{
+			names.reserve(structsCount + fieldsPerStruct);
+			for (std::size_t i = 0u; i < fieldsPerStruct; i++)
+			{
+				names.emplace_back("field" + std::to_string(i));
+			}
+
+			structs.reserve(structsCount);
+			for (std::size_t i = 0u; i < structsCount; i++)
+			{
+				names.emplace_back("Struct" + std::to_string(i));
+
+				rfk::Struct& s = *structs.emplace_back(std::make_unique<rfk::Struct>(names.back().c_str(), i + 1u, fieldsPerStruct * sizeof(int), false));
+				s.setFieldsCapacity(fieldsPerStruct);
+
+				for (std::size_t j = 0u; j < fieldsPerStruct; j++)
+				{
+					s.addField(names[j].c_str(), structsCount + i * fieldsPerStruct + j + 1u, rfk::getType<int>(), rfk::EFieldFlags::Public, j * sizeof(int), &s);
+				}
+
+				//Overloads sharing the same name
+				for (std::size_t j = 0u; j < methodsPerStruct; j++)
+				{
+					s.addMethod("method", structsCount * (fieldsPerStruct + 1u) + i * methodsPerStruct + j + 1u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+				}
+			}
+		}
+	};
+
+	static Fixture const& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void Struct_foreachField_FunctionPointer(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			s->foreachField([](rfk::Field const& field, void* data)
+							{
+								*reinterpret_cast<std::size_t*>(data) += (field.getMemoryOffset() >= 16u) ? 1u : 0u;
+								return true;
+							}, &count);
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_foreachField_Callable(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			s->foreachField([&count](rfk::Field const& field)
+							{
+								count += (field.getMemoryOffset() >= 16u) ? 1u : 0u;
+								return true;
+							});
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_getFieldsSpan_Loop(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			for (rfk::Field const* field : s->getFieldsSpan())
+			{
+				count += (field->getMemoryOffset() >= 16u) ? 1u : 0u;
+			}
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_getFieldsByPredicate_FunctionPointer(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getFieldsByPredicate([](rfk::Field const& field, void*)
+											 {
+												 return field.getMemoryOffset() >= 16u;
+											 }, nullptr).size();
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_getFieldsByPredicate_Callable(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getFieldsByPredicate([](rfk::Field const& field)
+											 {
+												 return field.getMemoryOffset() >= 16u;
+											 }).size();
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_queryFields_Count(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->queryFields([](rfk::Field const& field)
+									{
+										return field.getMemoryOffset() >= 16u;
+									}).count();
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_queryFields_CopyTo(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	rfk::Field const* fields[query_benchmarks::fieldsPerStruct];
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->queryFields([](rfk::Field const& field)
+									{
+										return field.getMemoryOffset() >= 16u;
+									}).copyTo(fields, query_benchmarks::fieldsPerStruct);
+		}
+
+		benchmark::DoNotOptimize(count);
+		benchmark::DoNotOptimize(fields);
+	}
+}
+
+static void Struct_getMethodsByName_Vector(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getMethodsByName("method").size();
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_getMethodsByName_Buffer(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	rfk::Method const* methods[query_benchmarks::methodsPerStruct];
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getMethodsByName("method", methods, query_benchmarks::methodsPerStruct);
+		}
+
+		benchmark::DoNotOptimize(count);
+		benchmark::DoNotOptimize(methods);
+	}
+}
+
+static void Struct_getMethodsByName_SmallVector(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getMethodsByName<query_benchmarks::methodsPerStruct>("method").size();
+		}
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+static void Struct_getMethodsByName_Arena(benchmark::State& state)
+{
+	query_benchmarks::Fixture const& fixture = query_benchmarks::getFixture();
+
+	rfk::MemoryArena arena;
+
+	for (auto _ : state)
+	{
+		std::size_t count = 0u;
+
+		for (auto const& s : fixture.structs)
+		{
+			count += s->getMethodsByName<0u>("method", rfk::EMethodFlags::Default, false, rfk::ArenaAllocator<rfk::Method const*>(arena)).size();
+		}
+
+		//Frame-scoped results: release them all at once
+		arena.reset();
+
+		benchmark::DoNotOptimize(count);
+	}
+}
+
+BENCHMARK(Struct_foreachField_FunctionPointer);
+BENCHMARK(Struct_foreachField_Callable);
+BENCHMARK(Struct_getFieldsSpan_Loop);
+BENCHMARK(Struct_getFieldsByPredicate_FunctionPointer);
+BENCHMARK(Struct_getFieldsByPredicate_Callable);
+BENCHMARK(Struct_queryFields_Count);
+BENCHMARK(Struct_queryFields_CopyTo);
+BENCHMARK(Struct_getMethodsByName_Vector);
+BENCHMARK(Struct_getMethodsByName_Buffer);
+BENCHMARK(Struct_getMethodsByName_SmallVector);
+BENCHMARK(Struct_getMethodsByName_Arena);
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Database.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Functions/Method.h>
+#include <Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks export 20k registered classes of 10 methods each to a snapshot,
+*	then load the snapshot and query it the way an external tool would.
+*/
+namespace snapshot_benchmarks
+{
+	static constexpr std::size_t classesCount		= 20000u;
+	static constexpr std::size_t methodsPerClass	= 10u;
+
+	struct Fixture
+	{
+		BenchmarkCorpus				corpus{"SnapshotBenchmarkModule"};
+		std::vector<rfk::Struct*>	classes;
+		rfk::Vector<rfk::uint8>		snapshotData;
+
+		Fixture()
+		{
+			char const* methodNames[methodsPerClass];
+
+			for (std::size_t j = 0u; j < methodsPerClass; j++)
+			{
+				methodNames[j] = corpus.addName("method" + std::to_string(j));
+			}
+
+			classes.reserve(classesCount);
+
+			for (std::size_t i = 0u; i < classesCount; i++)
+			{
+				rfk::Struct& c = *classes.emplace_back(&corpus.make<rfk::Struct>(corpus.addName("SnapshotBenchmarkClass" + std::to_string(i)), generateBenchmarkEntityId(), 1u, true));
+
+				c.setMethodsCapacity(methodsPerClass);
+				for (std::size_t j = 0u; j < methodsPerClass; j++)
+				{
+					c.addMethod(methodNames[j], generateBenchmarkEntityId(), rfk::getType<int>(), nullptr, rfk::EMethodFlags::Public)->addParameter("value", generateBenchmarkEntityId(), rfk::getType<float const&>());
+				}
+
+				corpus.add(c);
+			}
+
+			//The snapshot is taken once, only the export benchmark needs the corpus to be registered
+			ScopedCorpusLoad corpusLoad(corpus);
+
+			snapshotData = rfk::getDatabase().exportSnapshot();
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void Snapshot_Export(benchmark::State& state)
+{
+	snapshot_benchmarks::Fixture&	fixture = snapshot_benchmarks::getFixture();
+	ScopedCorpusLoad				corpusLoad(fixture.corpus);
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(rfk::getDatabase().exportSnapshot());
+	}
+
+	state.counters["Bytes"] = static_cast<double>(fixture.snapshotData.size());
+}
+
+static void Snapshot_Load(benchmark::State& state)
+{
+	snapshot_benchmarks::Fixture const& fixture = snapshot_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		rfk::DatabaseSnapshot snapshot;
+
+		benchmark::DoNotOptimize(snapshot.loadFromMemory(fixture.snapshotData.data(), fixture.snapshotData.size()));
+	}
+}
+
+static void Snapshot_GetEntityById(benchmark::State& state)
+{
+	snapshot_benchmarks::Fixture const& fixture = snapshot_benchmarks::getFixture();
+
+	rfk::DatabaseSnapshot snapshot;
+	snapshot.loadFromMemory(fixture.snapshotData.data(), fixture.snapshotData.size());
+
+	std::size_t i = 0u;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(snapshot.getEntityById(fixture.classes[i++ % snapshot_benchmarks::classesCount]->getId()));
+	}
+}
+
+static void Snapshot_GetFileLevelClassByName(benchmark::State& state)
+{
+	snapshot_benchmarks::Fixture const& fixture = snapshot_benchmarks::getFixture();
+
+	rfk::DatabaseSnapshot snapshot;
+	snapshot.loadFromMemory(fixture.snapshotData.data(), fixture.snapshotData.size());
+
+	std::size_t i = 0u;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(snapshot.getFileLevelClassByName(fixture.classes[i++ % snapshot_benchmarks::classesCount]->getName()));
+	}
+}
+
+BENCHMARK(Snapshot_Export)->Unit(benchmark::kMillisecond);
+BENCHMARK(Snapshot_Load)->Unit(benchmark::kMicrosecond);
+BENCHMARK(Snapshot_GetEntityById);
+BENCHMARK(Snapshot_GetFileLevelClassByName);
\ No newline at end of file
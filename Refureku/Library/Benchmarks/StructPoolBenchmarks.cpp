@@ -0,0 +1,123 @@
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/StructPool.h>
+#include <Refureku/TypeInfo/Functions/StaticMethod.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+#include <Refureku/TypeInfo/Type.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks compare the instantiation of a small struct through a StructPool, Struct::makeUniqueInstance and plain new/delete.
+*	Each iteration makes and destroys a batch of instances, single threaded and with several threads churning the same pool.
+*/
+namespace struct_pool_benchmarks
+{
+	static constexpr std::size_t	batchSize	= 64u;
+
+	struct Particle
+	{
+		float	position[3]	= {0.0f, 0.0f, 0.0f};
+		float	velocity[3]	= {0.0f, 0.0f, 0.0f};
+		int		lifetime	= 100;
+	};
+
+	struct Fixture
+	{
+		rfk::Struct			particle{"StructPoolBenchmarkParticle", generateBenchmarkEntityId(), sizeof(Particle), false};
+		rfk::StaticMethod	uniqueInstantiator{"", generateBenchmarkEntityId(), rfk::getType<rfk::UniquePtr<Particle>>(),
+											   new rfk::NonMemberFunction<rfk::UniquePtr<Particle>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<Particle>),
+											   rfk::EMethodFlags::Default, nullptr};
+		rfk::StaticMethod	placementInstantiator{"", generateBenchmarkEntityId(), rfk::getType<void*>(),
+												  new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Particle>),
+												  rfk::EMethodFlags::Default, nullptr};
+		std::unique_ptr<rfk::StructPool>	pool;
+
+		Fixture()
+		{
+			placementInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+
+			particle.addUniqueInstantiator(uniqueInstantiator);
+			particle.addPlacementInstantiator(placementInstantiator);
+			particle.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<Particle>);
+			particle.setMemoryAlignment(alignof(Particle));
+
+			pool = std::make_unique<rfk::StructPool>(particle);
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+}
+
+static void StructPool_MakeUniqueInstance(benchmark::State& state)
+{
+	struct_pool_benchmarks::Fixture& fixture = struct_pool_benchmarks::getFixture();
+
+	std::vector<rfk::PooledPtr<struct_pool_benchmarks::Particle>> instances;
+	instances.reserve(struct_pool_benchmarks::batchSize);
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < struct_pool_benchmarks::batchSize; i++)
+		{
+			instances.push_back(fixture.pool->makeUniqueInstance<struct_pool_benchmarks::Particle>());
+		}
+
+		benchmark::DoNotOptimize(instances.data());
+		instances.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * struct_pool_benchmarks::batchSize);
+}
+
+static void StructPool_StructMakeUniqueInstance(benchmark::State& state)
+{
+	struct_pool_benchmarks::Fixture& fixture = struct_pool_benchmarks::getFixture();
+
+	std::vector<rfk::UniquePtr<struct_pool_benchmarks::Particle>> instances;
+	instances.reserve(struct_pool_benchmarks::batchSize);
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < struct_pool_benchmarks::batchSize; i++)
+		{
+			instances.push_back(fixture.particle.makeUniqueInstance<struct_pool_benchmarks::Particle>());
+		}
+
+		benchmark::DoNotOptimize(instances.data());
+		instances.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * struct_pool_benchmarks::batchSize);
+}
+
+static void StructPool_NewDelete(benchmark::State& state)
+{
+	std::vector<std::unique_ptr<struct_pool_benchmarks::Particle>> instances;
+	instances.reserve(struct_pool_benchmarks::batchSize);
+
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0u; i < struct_pool_benchmarks::batchSize; i++)
+		{
+			instances.push_back(std::make_unique<struct_pool_benchmarks::Particle>());
+		}
+
+		benchmark::DoNotOptimize(instances.data());
+		instances.clear();
+	}
+
+	state.SetItemsProcessed(state.iterations() * struct_pool_benchmarks::batchSize);
+}
+
+BENCHMARK(StructPool_MakeUniqueInstance)->ThreadRange(1, 8);
+BENCHMARK(StructPool_StructMakeUniqueInstance)->ThreadRange(1, 8);
+BENCHMARK(StructPool_NewDelete)->ThreadRange(1, 8);
\ No newline at end of file
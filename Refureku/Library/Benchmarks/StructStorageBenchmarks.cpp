@@ -0,0 +1,192 @@
+#include <memory>
+#include <vector>
+#include <cstddef>	//offsetof
+
+#include <benchmark/benchmark.h>
+#include <Refureku/Object.h>
+#include <Refureku/TypeInfo/Archetypes/Struct.h>
+#include <Refureku/TypeInfo/Archetypes/StructStorage.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+#include <Refureku/Misc/DisableWarningMacros.h>
+
+#include "BenchmarkCorpus.h"
+
+/**
+*	These benchmarks sum a float field over 100k instances, comparing the per-chunk field spans of a StructStorage
+*	(contiguous in SoA, strided in AoS) with iterating rfk::Object pointers and reading the field with Field::get.
+*/
+namespace struct_storage_benchmarks
+{
+	static constexpr std::size_t	instancesCount	= 100000u;
+
+	struct Particle
+	{
+		float	position[3]	= {1.0f, 2.0f, 3.0f};
+		float	velocity[3]	= {0.0f, 0.0f, 0.0f};
+		float	speed		= 1.0f;
+		int		lifetime	= 100;
+	};
+
+	struct Fixture;
+
+	static Fixture& getFixture();
+
+	struct ObjectParticle : public rfk::Object
+	{
+		float	position[3]	= {1.0f, 2.0f, 3.0f};
+		float	velocity[3]	= {0.0f, 0.0f, 0.0f};
+		float	speed		= 1.0f;
+		int		lifetime	= 100;
+
+		static rfk::Struct const&	staticGetArchetype()			noexcept;
+		rfk::Struct const&			getArchetype()			const	noexcept override;
+	};
+
+	struct Fixture
+	{
+		rfk::Struct									particleArchetype{"StorageBenchmarkParticle", generateBenchmarkEntityId(), sizeof(Particle), false};
+		rfk::StaticMethod							particleInstantiator{"", generateBenchmarkEntityId(), rfk::getType<void*>(),
+																		 new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Particle>),
+																		 rfk::EMethodFlags::Default, nullptr};
+		rfk::Field const*							particleSpeed;
+
+		rfk::Struct									objectArchetype{"StorageBenchmarkObjectParticle", generateBenchmarkEntityId(), sizeof(ObjectParticle), false};
+		rfk::Field const*							objectSpeed;
+
+		std::unique_ptr<rfk::StructStorage>			aosStorage;
+		std::unique_ptr<rfk::StructStorage>			soaStorage;
+		std::vector<std::unique_ptr<rfk::Object>>	objects;
+
+		Fixture()
+		{
+			particleInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+
+			particleArchetype.addPlacementInstantiator(particleInstantiator);
+			particleArchetype.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<Particle>);
+			particleArchetype.setMemoryAlignment(alignof(Particle));
+			particleArchetype.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<Particle>());
+			particleArchetype.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<Particle>());
+			particleArchetype.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<Particle>());
+
+			particleArchetype.addField("position", generateBenchmarkEntityId(), rfk::getType<float[3]>(), rfk::EFieldFlags::Public, offsetof(Particle, position), &particleArchetype);
+			particleArchetype.addField("velocity", generateBenchmarkEntityId(), rfk::getType<float[3]>(), rfk::EFieldFlags::Public, offsetof(Particle, velocity), &particleArchetype);
+			particleSpeed = particleArchetype.addField("speed", generateBenchmarkEntityId(), rfk::getType<float>(), rfk::EFieldFlags::Public, offsetof(Particle, speed), &particleArchetype);
+			particleArchetype.addField("lifetime", generateBenchmarkEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(Particle, lifetime), &particleArchetype);
+
+__RFK_DISABLE_WARNING_PUSH
+__RFK_DISABLE_WARNING_OFFSETOF
+			objectSpeed = objectArchetype.addField("speed", generateBenchmarkEntityId(), rfk::getType<float>(), rfk::EFieldFlags::Public, offsetof(ObjectParticle, speed), &objectArchetype);
+__RFK_DISABLE_WARNING_POP
+
+			aosStorage = std::make_unique<rfk::StructStorage>(particleArchetype, rfk::EStructStorageLayout::AoS);
+			soaStorage = std::make_unique<rfk::StructStorage>(particleArchetype, rfk::EStructStorageLayout::SoA);
+
+			Particle prefab;
+
+			objects.reserve(instancesCount);
+			for (std::size_t i = 0u; i < instancesCount; i++)
+			{
+				aosStorage->pushBackCopies(&prefab);
+				soaStorage->pushBackCopies(&prefab);
+				objects.push_back(std::make_unique<ObjectParticle>());
+			}
+		}
+	};
+
+	static Fixture& getFixture()
+	{
+		static Fixture fixture;
+
+		return fixture;
+	}
+
+	rfk::Struct const& ObjectParticle::staticGetArchetype() noexcept
+	{
+		return getFixture().objectArchetype;
+	}
+
+	rfk::Struct const& ObjectParticle::getArchetype() const noexcept
+	{
+		return getFixture().objectArchetype;
+	}
+
+	void sumStorageSpeeds(benchmark::State& state, rfk::StructStorage const& storage, rfk::Field const& speedField)
+	{
+		for (auto _ : state)
+		{
+			float sum = 0.0f;
+
+			storage.foreachFieldSpan<float const>(speedField, [&sum](rfk::StridedSpan<float const> speeds)
+												  {
+													  for (float speed : speeds)
+													  {
+														  sum += speed;
+													  }
+												  });
+
+			benchmark::DoNotOptimize(sum);
+		}
+
+		state.SetItemsProcessed(state.iterations() * instancesCount);
+	}
+}
+
+static void StructStorage_SumField_SoA(benchmark::State& state)
+{
+	struct_storage_benchmarks::Fixture& fixture = struct_storage_benchmarks::getFixture();
+
+	struct_storage_benchmarks::sumStorageSpeeds(state, *fixture.soaStorage, *fixture.particleSpeed);
+}
+
+static void StructStorage_SumField_SoAContiguous(benchmark::State& state)
+{
+	struct_storage_benchmarks::Fixture& fixture = struct_storage_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		float sum = 0.0f;
+
+		fixture.soaStorage->foreachFieldSpan<float const>(*fixture.particleSpeed, [&sum](rfk::StridedSpan<float const> speeds)
+														  {
+															  for (float speed : speeds.toSpan())
+															  {
+																  sum += speed;
+															  }
+														  });
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * struct_storage_benchmarks::instancesCount);
+}
+
+static void StructStorage_SumField_AoS(benchmark::State& state)
+{
+	struct_storage_benchmarks::Fixture& fixture = struct_storage_benchmarks::getFixture();
+
+	struct_storage_benchmarks::sumStorageSpeeds(state, *fixture.aosStorage, *fixture.particleSpeed);
+}
+
+static void StructStorage_SumField_ObjectFieldGet(benchmark::State& state)
+{
+	struct_storage_benchmarks::Fixture& fixture = struct_storage_benchmarks::getFixture();
+
+	for (auto _ : state)
+	{
+		float sum = 0.0f;
+
+		for (std::unique_ptr<rfk::Object> const& object : fixture.objects)
+		{
+			sum += fixture.objectSpeed->get<float>(static_cast<struct_storage_benchmarks::ObjectParticle&>(*object));
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * struct_storage_benchmarks::instancesCount);
+}
+
+BENCHMARK(StructStorage_SumField_SoA)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StructStorage_SumField_SoAContiguous)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StructStorage_SumField_AoS)->Unit(benchmark::kMicrosecond);
+BENCHMARK(StructStorage_SumField_ObjectFieldGet)->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <vector>
+#include <memory>	//std::unique_ptr
+
+#include <benchmark/benchmark.h>
+#include <Refureku/TypeInfo/Type.h>
+#include <Refureku/TypeInfo/Functions/Function.h>
+#include <Refureku/TypeInfo/Functions/FunctionParameter.h>
+
+namespace type_benchmarks
+{
+	/**
+	*	@brief	Build a non-canonical type structurally identical to T const* (or T const** if isDoublePointer).
+	*			Non-canonical types are compared part by part, as all types were before type interning.
+	* 
+	*	@param out_type			The type to fill.
+	*	@param isDoublePointer	Should the type be a pointer to pointer?
+	*/
+	template <typename T>
+	void fillStructuralType(rfk::Type& out_type, bool isDoublePointer)
+	{
+		out_type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+
+		if (isDoublePointer)
+		{
+			out_type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+		}
+
+		rfk::TypePart& valuePart = out_type.addTypePart();
+		valuePart.addDescriptorFlag(rfk::ETypePartDescriptor::Const);
+		valuePart.addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+
+		out_type.setArchetype(rfk::getArchetype<T>());
+	}
+
+	/**
+	*	@brief Build a function taking paramsCount parameters of type int const*, double const**, int const*...
+	* 
+	*	@param paramsCount			Number of parameters of the function.
+	*	@param useCanonicalTypes	If true, parameters use canonical types, else structurally built types stored in out_types.
+	*	@param out_types			Storage for structurally built types. Must outlive the returned function.
+	*/
+	inline std::unique_ptr<rfk::Function> makeFunction(std::size_t paramsCount, bool useCanonicalTypes, std::vector<std::unique_ptr<rfk::Type>>& out_types)
+	{
+		auto result = std::make_unique<rfk::Function>("BenchmarkFunction", 0u, rfk::getType<void>(), nullptr, rfk::EFunctionFlags::Default);
+
+		for (std::size_t i = 0u; i < paramsCount; i++)
+		{
+			if (useCanonicalTypes)
+			{
+				result->addParameter("param", 0u, (i % 2u == 0u) ? rfk::getType<int const*>() : rfk::getType<double const**>());
+			}
+			else
+			{
+				out_types.emplace_back(std::make_unique<rfk::Type>());
+
+				if (i % 2u == 0u)
+				{
+					fillStructuralType<int>(*out_types.back(), false);
+				}
+				else
+				{
+					fillStructuralType<double>(*out_types.back(), true);
+				}
+
+				result->addParameter("param", 0u, *out_types.back());
+			}
+		}
+
+		return result;
+	}
+
+	inline void functionHasSameSignature(benchmark::State& state, bool useCanonicalTypes)
+	{
+		std::vector<std::unique_ptr<rfk::Type>> types;
+		std::size_t const paramsCount = static_cast<std::size_t>(state.range(0));
+		std::unique_ptr<rfk::Function> lhs = makeFunction(paramsCount, useCanonicalTypes, types);
+		std::unique_ptr<rfk::Function> rhs = makeFunction(paramsCount, useCanonicalTypes, types);
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(lhs->hasSameSignature(*rhs));
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(paramsCount));
+	}
+
+	inline void typeBuild(benchmark::State& state)
+	{
+		std::size_t const pointersCount = static_cast<std::size_t>(state.range(0));
+
+		for (auto _ : state)
+		{
+			rfk::Type type;
+
+			for (std::size_t i = 0u; i < pointersCount; i++)
+			{
+				type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+			}
+			type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+			type.setArchetype(rfk::getArchetype<int>());
+			type.optimizeMemory();
+
+			benchmark::DoNotOptimize(type.getTypePartsCount());
+		}
+	}
+
+	inline void typeQuery(benchmark::State& state)
+	{
+		rfk::Type const& type = rfk::getType<int const*>();
+
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(type.isPointer());
+			benchmark::DoNotOptimize(type.isConst());
+		}
+	}
+}
+
+static void Function_hasSameSignature_CanonicalTypes(benchmark::State& state)	{ type_benchmarks::functionHasSameSignature(state, true); }
+static void Function_hasSameSignature_StructuralTypes(benchmark::State& state)	{ type_benchmarks::functionHasSameSignature(state, false); }
+
+static void Type_build(benchmark::State& state)								{ type_benchmarks::typeBuild(state); }
+static void Type_query(benchmark::State& state)								{ type_benchmarks::typeQuery(state); }
+
+BENCHMARK(Type_build)->Arg(0)->Arg(2)->Arg(5);
+BENCHMARK(Type_query);
+BENCHMARK(Function_hasSameSignature_CanonicalTypes)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(Function_hasSameSignature_StructuralTypes)->Arg(1)->Arg(4)->Arg(16);
@@ -0,0 +1,20 @@
+#include <benchmark/benchmark.h>
+#include <Refureku/Refureku.h>
+
+#include "EnumBenchmarks.cpp"
+#include "TypeBenchmarks.cpp"
+#include "AccessorBenchmarks.cpp"
+#include "QueryBenchmarks.cpp"
+#include "ModuleBenchmarks.cpp"
+#include "ParallelBenchmarks.cpp"
+#include "EntityQueryBenchmarks.cpp"
+#include "NameIndexBenchmarks.cpp"
+#include "SnapshotBenchmarks.cpp"
+#include "MemoryFootprintBenchmarks.cpp"
+#include "InstrumentationBenchmarks.cpp"
+#include "StructPoolBenchmarks.cpp"
+#include "CloneBenchmarks.cpp"
+#include "StructStorageBenchmarks.cpp"
+#include "MethodCommandBufferBenchmarks.cpp"
+
+BENCHMARK_MAIN();
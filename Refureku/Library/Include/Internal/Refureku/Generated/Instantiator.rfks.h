@@ -31,6 +31,7 @@ static bool initialized = false;
 static rfk::Class type("Instantiator", 11099498566387530766u, sizeof(Instantiator), 1);
 if (!initialized) {
 initialized = true;
+RFK_TRACE_REGISTRATION_SCOPE(StaticGetArchetype, "Instantiator", "Instantiator.h");
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_11099498566387530766u_0{rfk::EEntityKind::Method};type.addProperty(property_11099498566387530766u_0);
 type.setDirectParentsCapacity(1);
@@ -40,6 +41,16 @@ static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::Sha
 type.addSharedInstantiator(defaultSharedInstantiator);
 static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<Instantiator>>(),new rfk::NonMemberFunction<rfk::UniquePtr<Instantiator>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<Instantiator>),rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
+static rfk::StaticMethod defaultPlacementInstantiator("", 0u, rfk::getType<void*>(),new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Instantiator>),rfk::EMethodFlags::Default, nullptr);
+defaultPlacementInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+type.addPlacementInstantiator(defaultPlacementInstantiator);
+type.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<Instantiator>);
+type.setMemoryAlignment(alignof(Instantiator));
+type.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<Instantiator>());
+type.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<Instantiator>());
+type.setCopyAssignment(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<Instantiator>());
+type.setMoveAssignment(rfk::internal::CodeGenerationHelpers::getDefaultMoveAssignment<Instantiator>());
+type.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<Instantiator>());
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
 }
 return type; }
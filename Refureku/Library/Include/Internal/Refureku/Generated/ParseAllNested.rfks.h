@@ -31,6 +31,7 @@ static bool initialized = false;
 static rfk::Class type("ParseAllNested", 1518429735798145968u, sizeof(ParseAllNested), 1);
 if (!initialized) {
 initialized = true;
+RFK_TRACE_REGISTRATION_SCOPE(StaticGetArchetype, "ParseAllNested", "ParseAllNested.h");
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_1518429735798145968u_0{rfk::EEntityKind::Namespace | rfk::EEntityKind::Class | rfk::EEntityKind::Struct};type.addProperty(property_1518429735798145968u_0);
 type.setDirectParentsCapacity(1);
@@ -40,6 +41,16 @@ static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::Sha
 type.addSharedInstantiator(defaultSharedInstantiator);
 static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::UniquePtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
+static rfk::StaticMethod defaultPlacementInstantiator("", 0u, rfk::getType<void*>(),new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
+defaultPlacementInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+type.addPlacementInstantiator(defaultPlacementInstantiator);
+type.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<ParseAllNested>);
+type.setMemoryAlignment(alignof(ParseAllNested));
+type.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<ParseAllNested>());
+type.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<ParseAllNested>());
+type.setCopyAssignment(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<ParseAllNested>());
+type.setMoveAssignment(rfk::internal::CodeGenerationHelpers::getDefaultMoveAssignment<ParseAllNested>());
+type.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<ParseAllNested>());
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
 }
 return type; }
@@ -31,6 +31,7 @@ static bool initialized = false;
 static rfk::Class type("PropertySettings", 9343641787758265814u, sizeof(PropertySettings), 1);
 if (!initialized) {
 initialized = true;
+RFK_TRACE_REGISTRATION_SCOPE(StaticGetArchetype, "PropertySettings", "PropertySettings.h");
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_9343641787758265814u_0{rfk::EEntityKind::Struct | rfk::EEntityKind::Class};type.addProperty(property_9343641787758265814u_0);
 type.setDirectParentsCapacity(1);
@@ -40,6 +41,16 @@ static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::Sha
 type.addSharedInstantiator(defaultSharedInstantiator);
 static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::UniquePtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
+static rfk::StaticMethod defaultPlacementInstantiator("", 0u, rfk::getType<void*>(),new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
+defaultPlacementInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+type.addPlacementInstantiator(defaultPlacementInstantiator);
+type.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<PropertySettings>);
+type.setMemoryAlignment(alignof(PropertySettings));
+type.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<PropertySettings>());
+type.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<PropertySettings>());
+type.setCopyAssignment(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<PropertySettings>());
+type.setMoveAssignment(rfk::internal::CodeGenerationHelpers::getDefaultMoveAssignment<PropertySettings>());
+type.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<PropertySettings>());
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
 }
 return type; }
@@ -99,6 +99,17 @@ namespace rfk
 																							  Predicate				predicate,
 																							  Compare				compare)	-> Vector<typename std::remove_pointer_t<typename ContainerType::value_type> const*>;
 
+			/**
+			*	@brief	Make sure an unordered container can receive the provided number of additional elements without rehashing.
+			*			Unlike a direct call to reserve, the container bucket array is never shrunk.
+			* 
+			*	@param container		Unordered_set like container implementing the "reserve" method.
+			*	@param additionalCount	Number of elements about to be added to the container.
+			*/
+			template <typename ContainerType>
+			static void												reserveAdditional(ContainerType&	container,
+																					  std::size_t		additionalCount)	noexcept;
+
 			/**
 			*	@brief Retrieve an entity with the given name.
 			* 
@@ -142,9 +153,9 @@ namespace rfk
 			/**
 			*	@brief Iterate over all entities named with the given name.
 			* 
-			*	@param container	Unordered_multiset like container containing entities and implementing the "equal_range" method.
+			*	@param container	Unordered_multiset like container containing entities (or entity pointers) and implementing the "equal_range" method.
 			*	@param name			Name of the entities to iterate on.
-			*	@param visitor		Visitor to call on each entity.
+			*	@param visitor		Visitor to call on each entity. It receives entity references even if the container stores pointers.
 			* 
 			*	@return The last visitor result before exiting the loop.
 			*/
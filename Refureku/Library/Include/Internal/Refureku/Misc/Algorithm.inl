@@ -252,18 +252,38 @@ bool Algorithm::foreachEntityNamed(ContainerType const& container, char const* n
 	Entity::EntityImpl	searchedImpl(name, 0u);
 	Entity				searchedEntity(&searchedImpl);
 
-	auto range = container.equal_range(static_cast<typename ContainerType::value_type const&>(searchedEntity));
+	if constexpr (std::is_pointer_v<typename ContainerType::value_type>)
+	{
+		auto range = container.equal_range(static_cast<typename ContainerType::value_type>(&searchedEntity));
 
-	//When deleted, the Entity will try to delete the implementation pointer.
-	//As the implementation was not dynamically newed (to save perf), it crashes here.
-	//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
-	searchedEntity._pimpl.uncheckedSet(nullptr);
+		//When deleted, the Entity will try to delete the implementation pointer.
+		//As the implementation was not dynamically newed (to save perf), it crashes here.
+		//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
+		searchedEntity._pimpl.uncheckedSet(nullptr);
 
-	for (auto it = range.first; it != range.second; it++)
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (!visitor(**it))
+			{
+				return false;
+			}
+		}
+	}
+	else
 	{
-		if (!visitor(*it))
+		auto range = container.equal_range(static_cast<typename ContainerType::value_type const&>(searchedEntity));
+
+		//When deleted, the Entity will try to delete the implementation pointer.
+		//As the implementation was not dynamically newed (to save perf), it crashes here.
+		//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
+		searchedEntity._pimpl.uncheckedSet(nullptr);
+
+		for (auto it = range.first; it != range.second; it++)
 		{
-			return false;
+			if (!visitor(*it))
+			{
+				return false;
+			}
 		}
 	}
 
@@ -286,6 +306,18 @@ typename ContainerType::value_type Algorithm::getEntityPtrById(ContainerType con
 	return (it != container.cend()) ? *it : nullptr;
 }
 
+template <typename ContainerType>
+void Algorithm::reserveAdditional(ContainerType& container, std::size_t additionalCount) noexcept
+{
+	std::size_t requiredCount = container.size() + additionalCount;
+
+	//reserve rehashes the container whenever the optimal bucket count differs, even when it is smaller than the current one
+	if (requiredCount > container.bucket_count() * container.max_load_factor())
+	{
+		container.reserve(requiredCount);
+	}
+}
+
 template <typename ContainerType, typename Compare, typename ElementType, typename>
 std::size_t Algorithm::getFirstGreaterElementIndex(ContainerType const& container, ElementType element, Compare compare) noexcept(noexcept(compare))
 {
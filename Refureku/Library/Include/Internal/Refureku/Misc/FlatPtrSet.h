@@ -0,0 +1,106 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "Refureku/Containers/Span.h"
+
+namespace rfk
+{
+	namespace internal
+	{
+		class MemoryFootprintCollector;
+	}
+
+	/**
+	*	Set of pointers stored contiguously so that it can be exposed as a Span.
+	*	Insertion and removal are O(1): removal swaps the removed pointer with the last one, so the order of the pointers is not stable.
+	*/
+	template <typename T>
+	class FlatPtrSet
+	{
+		private:
+			/** Contiguous storage of the pointers. */
+			std::vector<T const*>							_pointers;
+
+			/** Index of each pointer in _pointers. */
+			std::unordered_map<T const*, std::size_t>		_indices;
+
+		public:
+			/**
+			*	@brief Add a pointer to the set if it is not contained yet.
+			* 
+			*	@param pointer The pointer to add.
+			* 
+			*	@return true if the pointer was added, false if it was already in the set.
+			*/
+			inline bool						add(T const* pointer)				noexcept;
+
+			/**
+			*	@brief Remove a pointer from the set.
+			* 
+			*	@param pointer The pointer to remove.
+			* 
+			*	@return true if the pointer was removed, false if it was not in the set.
+			*/
+			inline bool						remove(T const* pointer)			noexcept;
+
+			/**
+			*	@brief Reserve memory for the provided number of pointers.
+			* 
+			*	@param capacity Number of pointers to reserve memory for.
+			*/
+			inline void						reserve(std::size_t capacity)		noexcept;
+
+			/**
+			*	@brief	Add a pointer to a hash set, and to this set if the hash set accepted it.
+			*			Used to keep this set in sync with a hash set indexing the same pointers.
+			* 
+			*	@param hashSet	The hash set to add the pointer to.
+			*	@param pointer	The pointer to add.
+			*/
+			template <typename HashSet>
+			inline void						addSynced(HashSet&	hashSet,
+													  T const*	pointer)				noexcept;
+
+			/**
+			*	@brief	Add a batch of pointers to a hash set, and to this set the ones the hash set accepted.
+			*			The accepted pointers are all appended first, then indexed and deduplicated in a single pass.
+			* 
+			*	@param hashSet			The hash set to add the pointers to.
+			*	@param pointers			Pointer to the first pointer of the batch.
+			*	@param pointersCount	Number of pointers in the batch.
+			*/
+			template <typename HashSet>
+			inline void						addSynced(HashSet&			hashSet,
+													  T const* const*	pointers,
+													  std::size_t		pointersCount)	noexcept;
+
+			/**
+			*	@brief	Remove from a hash set all pointers equivalent to the provided one, and remove them from this set as well.
+			*			Used to keep this set in sync with a hash set indexing the same pointers.
+			* 
+			*	@param hashSet	The hash set to remove the pointer from.
+			*	@param pointer	The pointer to remove.
+			*/
+			template <typename HashSet>
+			inline void						removeSynced(HashSet&	hashSet,
+														 T const*	pointer)				noexcept;
+
+			/**
+			*	@return A span over all the pointers of the set.
+			*/
+			inline Span<T const* const>		getSpan()					const	noexcept;
+
+		friend internal::MemoryFootprintCollector;
+	};
+
+	#include "Refureku/Misc/FlatPtrSet.inl"
+}
\ No newline at end of file
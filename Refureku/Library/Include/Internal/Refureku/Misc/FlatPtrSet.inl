@@ -0,0 +1,124 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+inline bool FlatPtrSet<T>::add(T const* pointer) noexcept
+{
+	if (_indices.emplace(pointer, _pointers.size()).second)
+	{
+		_pointers.push_back(pointer);
+
+		return true;
+	}
+
+	return false;
+}
+
+template <typename T>
+inline bool FlatPtrSet<T>::remove(T const* pointer) noexcept
+{
+	auto it = _indices.find(pointer);
+
+	if (it != _indices.end())
+	{
+		std::size_t index = it->second;
+
+		//Move the last pointer in the removed slot
+		if (index != _pointers.size() - 1u)
+		{
+			_pointers[index] = _pointers.back();
+			_indices[_pointers[index]] = index;
+		}
+
+		_pointers.pop_back();
+		_indices.erase(it);
+
+		return true;
+	}
+
+	return false;
+}
+
+template <typename T>
+inline void FlatPtrSet<T>::reserve(std::size_t capacity) noexcept
+{
+	_pointers.reserve(capacity);
+
+	//Never shrink the index bucket array, reserve would rehash it to the optimal smaller size
+	if (capacity > _indices.bucket_count() * _indices.max_load_factor())
+	{
+		_indices.reserve(capacity);
+	}
+}
+
+template <typename T>
+template <typename HashSet>
+inline void FlatPtrSet<T>::addSynced(HashSet& hashSet, T const* pointer) noexcept
+{
+	std::size_t previousSize = hashSet.size();
+
+	hashSet.emplace(pointer);
+
+	if (hashSet.size() != previousSize)
+	{
+		add(pointer);
+	}
+}
+
+template <typename T>
+template <typename HashSet>
+inline void FlatPtrSet<T>::addSynced(HashSet& hashSet, T const* const* pointers, std::size_t pointersCount) noexcept
+{
+	std::size_t firstAddedIndex = _pointers.size();
+
+	reserve(firstAddedIndex + pointersCount);
+
+	for (std::size_t i = 0u; i < pointersCount; i++)
+	{
+		std::size_t previousSize = hashSet.size();
+
+		hashSet.emplace(pointers[i]);
+
+		if (hashSet.size() != previousSize)
+		{
+			_pointers.push_back(pointers[i]);
+		}
+	}
+
+	//Index the appended pointers, compacting away the ones already in the set (a multiset accepts the same pointer twice)
+	std::size_t addedCount = firstAddedIndex;
+
+	for (std::size_t i = firstAddedIndex; i < _pointers.size(); i++)
+	{
+		if (_indices.emplace(_pointers[i], addedCount).second)
+		{
+			_pointers[addedCount++] = _pointers[i];
+		}
+	}
+
+	_pointers.resize(addedCount);
+}
+
+template <typename T>
+template <typename HashSet>
+inline void FlatPtrSet<T>::removeSynced(HashSet& hashSet, T const* pointer) noexcept
+{
+	auto range = hashSet.equal_range(pointer);
+
+	for (auto it = range.first; it != range.second; it++)
+	{
+		remove(*it);
+	}
+
+	hashSet.erase(range.first, range.second);
+}
+
+template <typename T>
+inline Span<T const* const> FlatPtrSet<T>::getSpan() const noexcept
+{
+	return Span<T const* const>(_pointers.data(), _pointers.size());
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>	//std::exception_ptr
+#include <algorithm>	//std::min, std::max
+
+namespace rfk::internal
+{
+	/**
+	*	Run a range of indexed tasks on a set of worker threads.
+	*	The task range is split evenly between the workers. When a worker runs out of tasks,
+	*	it steals the second half of the remaining tasks of another worker.
+	*	The calling thread is used as the first worker.
+	*/
+	class WorkStealingPool
+	{
+		private:
+			/** Range of task indices [begin, end) owned by a worker. */
+			struct WorkerQueue
+			{
+				std::mutex	mutex;
+				std::size_t	begin	= 0u;
+				std::size_t	end		= 0u;
+			};
+
+			/**
+			*	@brief Pop the first task of a worker queue.
+			* 
+			*	@param queue			The worker queue.
+			*	@param out_taskIndex	Index of the popped task.
+			* 
+			*	@return true if a task was popped, false if the queue was empty.
+			*/
+			static bool	popFront(WorkerQueue&	queue,
+								 std::size_t&	out_taskIndex)		noexcept;
+
+			/**
+			*	@brief	Steal the second half of the remaining tasks of another worker.
+			*			The first stolen task is returned, the others are moved to the thief queue.
+			* 
+			*	@param queues			All worker queues.
+			*	@param thiefIndex		Index of the stealing worker.
+			*	@param out_taskIndex	Index of the first stolen task.
+			* 
+			*	@return true if a task was stolen, false if all queues are empty.
+			*/
+			static bool	steal(std::vector<WorkerQueue>&	queues,
+							  std::size_t				thiefIndex,
+							  std::size_t&				out_taskIndex)		noexcept;
+
+		public:
+			WorkStealingPool()	= delete;
+			~WorkStealingPool()	= delete;
+
+			/**
+			*	@brief Get the number of worker threads used when the user doesn't specify it.
+			* 
+			*	@return The number of hardware threads, or 1 if it can't be determined.
+			*/
+			static std::size_t	getDefaultThreadsCount()	noexcept;
+
+			/**
+			*	@brief	Run the tasks [0, tasksCount) on threadsCount workers.
+			*			When a task returns false, the workers stop picking new tasks.
+			* 
+			*	@param tasksCount	Number of tasks to run.
+			*	@param threadsCount	Number of workers (including the calling thread). 0 uses getDefaultThreadsCount().
+			*	@param task			Callable with the signature bool(std::size_t taskIndex). It must be safe to call concurrently.
+			* 
+			*	@return true if all tasks returned true, else false.
+			* 
+			*	@exception The first exception thrown by a task, rethrown on the calling thread once all workers stopped.
+			*/
+			template <typename Task>
+			static bool			run(std::size_t	tasksCount,
+									std::size_t	threadsCount,
+									Task&&		task);
+	};
+
+	#include "Refureku/Misc/WorkStealingPool.inl"
+}
\ No newline at end of file
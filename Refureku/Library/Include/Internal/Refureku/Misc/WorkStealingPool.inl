@@ -0,0 +1,154 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::size_t WorkStealingPool::getDefaultThreadsCount() noexcept
+{
+	return std::max<std::size_t>(std::thread::hardware_concurrency(), 1u);
+}
+
+inline bool WorkStealingPool::popFront(WorkerQueue& queue, std::size_t& out_taskIndex) noexcept
+{
+	std::lock_guard<std::mutex> lock(queue.mutex);
+
+	if (queue.begin < queue.end)
+	{
+		out_taskIndex = queue.begin++;
+
+		return true;
+	}
+
+	return false;
+}
+
+inline bool WorkStealingPool::steal(std::vector<WorkerQueue>& queues, std::size_t thiefIndex, std::size_t& out_taskIndex) noexcept
+{
+	for (std::size_t i = 1u; i < queues.size(); i++)
+	{
+		WorkerQueue& victim = queues[(thiefIndex + i) % queues.size()];
+		std::size_t stolenBegin;
+		std::size_t stolenEnd;
+
+		{
+			std::lock_guard<std::mutex> lock(victim.mutex);
+
+			if (victim.begin >= victim.end)
+			{
+				continue;
+			}
+
+			//Take the second half of the remaining tasks, or the last task if there is only one left
+			stolenBegin	= victim.begin + (victim.end - victim.begin) / 2u;
+			stolenEnd	= victim.end;
+			victim.end	= stolenBegin;
+		}
+
+		//The thief queue is empty at this point: only its owner adds tasks to it
+		WorkerQueue& thief = queues[thiefIndex];
+		{
+			std::lock_guard<std::mutex> lock(thief.mutex);
+
+			thief.begin	= stolenBegin + 1u;
+			thief.end	= stolenEnd;
+		}
+
+		out_taskIndex = stolenBegin;
+
+		return true;
+	}
+
+	return false;
+}
+
+template <typename Task>
+bool WorkStealingPool::run(std::size_t tasksCount, std::size_t threadsCount, Task&& task)
+{
+	if (threadsCount == 0u)
+	{
+		threadsCount = getDefaultThreadsCount();
+	}
+
+	threadsCount = std::min(threadsCount, tasksCount);
+
+	if (threadsCount <= 1u)
+	{
+		for (std::size_t i = 0u; i < tasksCount; i++)
+		{
+			if (!task(i))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//Split the tasks evenly between the workers
+	std::vector<WorkerQueue> queues(threadsCount);
+
+	for (std::size_t i = 0u; i < threadsCount; i++)
+	{
+		queues[i].begin	= tasksCount * i / threadsCount;
+		queues[i].end	= tasksCount * (i + 1u) / threadsCount;
+	}
+
+	std::atomic<bool>	stop{false};
+	std::atomic<bool>	result{true};
+	std::mutex			exceptionMutex;
+	std::exception_ptr	exception;
+
+	auto worker = [&](std::size_t workerIndex)
+	{
+		std::size_t taskIndex;
+
+		while (!stop.load(std::memory_order_relaxed) &&
+			   (popFront(queues[workerIndex], taskIndex) || steal(queues, workerIndex, taskIndex)))
+		{
+			try
+			{
+				if (!task(taskIndex))
+				{
+					result.store(false, std::memory_order_relaxed);
+					stop.store(true, std::memory_order_relaxed);
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+
+				stop.store(true, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadsCount - 1u);
+
+	for (std::size_t i = 1u; i < threadsCount; i++)
+	{
+		threads.emplace_back(worker, i);
+	}
+
+	//The calling thread is the first worker
+	worker(0u);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+
+	return result.load();
+}
\ No newline at end of file
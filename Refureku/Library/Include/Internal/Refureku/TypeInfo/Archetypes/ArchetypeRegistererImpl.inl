@@ -11,6 +11,8 @@ inline internal::ArchetypeRegistererImpl::ArchetypeRegistererImpl(Archetype cons
 	//Archetypes which are not at file level should not be registered
 	assert(archetype.getOuterEntity() == nullptr);
 
+	RFK_TRACE_REGISTRATION_SCOPE(ArchetypeRegisterer, archetype.getName(), nullptr);
+
 	Database::getInstance()._pimpl->registerFileLevelEntityRecursive(archetype);
 }
 
@@ -8,6 +8,10 @@
 #pragma once
 
 #include <vector>
+#include <limits>		//std::numeric_limits
+#include <algorithm>	//std::lower_bound, std::upper_bound, std::max, std::copy
+#include <string_view>	//std::hash<std::string_view>
+#include <cstring>		//std::strcmp
 
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/ArchetypeImpl.h"
@@ -17,13 +21,104 @@ namespace rfk
 {
 	class Enum::EnumImpl final : public Archetype::ArchetypeImpl
 	{
+		public:
+			/** Index used in the lookup tables to represent an empty slot. */
+			static constexpr std::size_t invalidIndex = std::numeric_limits<std::size_t>::max();
+
 		private:
+			/** Entry of the sorted by-value lookup table. */
+			struct ValueSlot
+			{
+				/** Value of the enum value. */
+				int64		value;
+
+				/** Index of the enum value in _enumValues. */
+				std::size_t	valueIndex;
+			};
+
+			/** Slot of the open addressing name lookup table. */
+			struct NameSlot
+			{
+				/** Hash of the enum value name. */
+				std::size_t	nameHash	= 0u;
+
+				/** Index of the enum value in _enumValues, invalidIndex if the slot is empty. */
+				std::size_t	valueIndex	= invalidIndex;
+			};
+
+			/**
+			*	Maximum number of slots per enum value in the dense lookup table.
+			*	Past this ratio, values are considered sparse and are only looked up through _sortedValues.
+			*/
+			static constexpr std::size_t	_maxDenseSlotsPerValue = 2u;
+
 			/** Values contained in this enum. */
-			std::vector<EnumValue>	_enumValues;
+			std::vector<EnumValue>		_enumValues;
+
+			/** Enum values sorted by value. Enum values sharing the same value are kept in declaration order. */
+			std::vector<ValueSlot>		_sortedValues;
+
+			/**
+			*	Direct-index table of enum values: _denseValueIndices[value - _denseMinValue] is the index of the first declared enum value
+			*	holding value (or invalidIndex). This table is empty when the enum values are not dense enough.
+			*	The table can start below the smallest value, so that values added in decreasing order don't rebase it on each addition.
+			*/
+			std::vector<std::size_t>	_denseValueIndices;
+
+			/** Value of the first entry of _denseValueIndices. */
+			int64						_denseMinValue;
+
+			/**
+			*	Open addressing (linear probing) hash table indexing enum values by name. Its size is always 0 or a power of 2.
+			*	Enum values are registered one at a time, so a perfect hash would have to be recomputed on each addition:
+			*	a load factor <= 0.5 with cached hashes keeps lookups close to a single probe and a single strcmp instead.
+			*/
+			std::vector<NameSlot>		_nameTable;
 
 			/** Underlying type of this enum. */
 			Archetype const&			_underlyingArchetype;
 
+			/**
+			*	@brief Insert the enum value at the provided index in the by-value lookup tables.
+			* 
+			*	@param valueIndex Index of the enum value in _enumValues.
+			*/
+			inline void								indexEnumValueByValue(std::size_t valueIndex)	noexcept;
+
+			/**
+			*	@brief Insert the enum value at the provided index in the by-name lookup table, growing the table if necessary.
+			* 
+			*	@param valueIndex Index of the enum value in _enumValues.
+			*/
+			inline void								indexEnumValueByName(std::size_t valueIndex)	noexcept;
+
+			/**
+			*	@brief Insert a name slot in the name table. The table must contain at least 1 free slot.
+			* 
+			*	@param slot The slot to insert.
+			*/
+			inline void								insertNameSlot(NameSlot const& slot)			noexcept;
+
+			/**
+			*	@brief	Rebase the dense lookup table so that it starts at or below the provided value.
+			*			The table grows at least by its own size so that successive rebases are amortized.
+			* 
+			*	@param value The value the table must contain. Must be smaller than _denseMinValue.
+			*/
+			inline void								growDenseValueIndicesFront(int64 value)			noexcept;
+
+			/**
+			*	@brief Rebuild the dense lookup table from _sortedValues, or clear it if the values are too sparse.
+			*/
+			inline void								rebuildDenseValueIndices()						noexcept;
+
+			/**
+			*	@brief Compute the number of slots a dense table would need to index all the enum values.
+			* 
+			*	@return The number of slots needed by the dense table, or invalidIndex if the span doesn't fit in a std::size_t.
+			*/
+			inline std::size_t						computeValuesSpan()						const	noexcept;
+
 		public:
 			inline EnumImpl(char const*			name,
 							std::size_t			id,
@@ -54,6 +149,46 @@ namespace rfk
 			*/
 			inline void								setEnumValuesCapacity(std::size_t capacity)		noexcept;
 
+			/**
+			*	@brief Search an enum value by name.
+			* 
+			*	@param name Name of the enum value to look for. Must not be nullptr.
+			* 
+			*	@return The enum value named name if any, else nullptr.
+			*/
+			inline EnumValue const*					getEnumValueByName(char const* name)	const	noexcept;
+
+			/**
+			*	@brief Search the first declared enum value holding the provided value.
+			* 
+			*	@param value Value of the enum value to look for.
+			* 
+			*	@return The first declared enum value holding value if any, else nullptr.
+			*/
+			inline EnumValue const*					getEnumValue(int64 value)				const	noexcept;
+
+			/**
+			*	@brief Search all enum values holding the provided value.
+			* 
+			*	@param value Value of the enum values to look for.
+			* 
+			*	@return All the enum values holding value, in declaration order.
+			*/
+			inline Vector<EnumValue const*>			getEnumValues(int64 value)				const	noexcept;
+
+			/**
+			*	@brief Write all enum values holding the provided value in a caller provided buffer.
+			* 
+			*	@param value			Value of the enum values to look for.
+			*	@param outEnumValues	Buffer receiving the found enum values, in declaration order.
+			*	@param capacity			Number of enum values outEnumValues can hold.
+			* 
+			*	@return The total number of enum values holding value.
+			*/
+			inline std::size_t						getEnumValues(int64				value,
+																  EnumValue const**	outEnumValues,
+																  std::size_t		capacity)	const	noexcept;
+
 			/**
 			*	@brief Getter for the field _enumValues.
 			* 
@@ -67,6 +202,8 @@ namespace rfk
 			*	@return _underlyingArchetype.
 			*/
 			inline Archetype const&				getUnderlyingArchetype()				const	noexcept;
+
+		friend internal::MemoryFootprintCollector;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/EnumImpl.inl"
@@ -7,18 +7,245 @@
 
 inline Enum::EnumImpl::EnumImpl(char const* name, std::size_t id, Archetype const* underlyingArchetype, Entity const* outerEntity) noexcept:
 	ArchetypeImpl(name, id, EEntityKind::Enum, underlyingArchetype->getMemorySize(), outerEntity),
+	_denseMinValue{0},
 	_underlyingArchetype{*underlyingArchetype}
 {
 }
 
 inline EnumValue& Enum::EnumImpl::addEnumValue(char const* name, std::size_t id, int64 value, Enum const*	backRef) noexcept
 {
-	return _enumValues.emplace_back(name, id, value, backRef);
+	std::size_t valueIndex = _enumValues.size();
+
+	EnumValue& result = _enumValues.emplace_back(name, id, value, backRef);
+
+	indexEnumValueByValue(valueIndex);
+	indexEnumValueByName(valueIndex);
+
+	return result;
+}
+
+inline void Enum::EnumImpl::indexEnumValueByValue(std::size_t valueIndex) noexcept
+{
+	int64 value = _enumValues[valueIndex].getValue();
+
+	//Insert after all values <= value so that enum values sharing the same value stay in declaration order
+	auto it = std::upper_bound(_sortedValues.cbegin(), _sortedValues.cend(), value, [](int64 lhs, ValueSlot const& rhs) { return lhs < rhs.value; });
+	_sortedValues.insert(it, ValueSlot{value, valueIndex});
+
+	std::size_t span = computeValuesSpan();
+
+	//Values are too sparse, lookups will use the sorted table
+	if (span == invalidIndex || span > _enumValues.size() * _maxDenseSlotsPerValue)
+	{
+		_denseValueIndices.clear();
+		_denseValueIndices.shrink_to_fit();
+
+		return;
+	}
+
+	//Values just became dense enough
+	if (_denseValueIndices.empty())
+	{
+		rebuildDenseValueIndices();
+
+		return;
+	}
+
+	if (value < _denseMinValue)
+	{
+		growDenseValueIndicesFront(value);
+	}
+
+	std::size_t offset = static_cast<std::size_t>(static_cast<uint64>(value) - static_cast<uint64>(_denseMinValue));
+
+	//resize grows the capacity geometrically when the value extends the table at its end
+	if (offset >= _denseValueIndices.size())
+	{
+		_denseValueIndices.resize(offset + 1u, invalidIndex);
+	}
+
+	//Only the first declared enum value is referenced by the dense table
+	if (_denseValueIndices[offset] == invalidIndex)
+	{
+		_denseValueIndices[offset] = valueIndex;
+	}
+}
+
+inline void Enum::EnumImpl::growDenseValueIndicesFront(int64 value) noexcept
+{
+	uint64 missingCount	= static_cast<uint64>(_denseMinValue) - static_cast<uint64>(value);
+	uint64 growCount	= std::max(missingCount, static_cast<uint64>(_denseValueIndices.size()));
+
+	//Don't start the table below the smallest int64, and keep it within twice the size of the largest dense table
+	uint64 maxGrowCount = missingCount + (static_cast<uint64>(value) - static_cast<uint64>(std::numeric_limits<int64>::min()));
+
+	if (growCount > maxGrowCount ||
+		_denseValueIndices.size() + growCount > _enumValues.size() * _maxDenseSlotsPerValue * 2u)
+	{
+		growCount = missingCount;
+	}
+
+	std::vector<std::size_t> grownTable(_denseValueIndices.size() + static_cast<std::size_t>(growCount), invalidIndex);
+	std::copy(_denseValueIndices.cbegin(), _denseValueIndices.cend(), grownTable.begin() + static_cast<std::ptrdiff_t>(growCount));
+
+	_denseValueIndices	= std::move(grownTable);
+	_denseMinValue		= static_cast<int64>(static_cast<uint64>(_denseMinValue) - growCount);
+}
+
+inline void Enum::EnumImpl::indexEnumValueByName(std::size_t valueIndex) noexcept
+{
+	//Keep the load factor <= 0.5 so that probe sequences remain short and always end on an empty slot
+	if (_enumValues.size() * 2u > _nameTable.size())
+	{
+		std::vector<NameSlot> previousTable = std::move(_nameTable);
+
+		std::size_t newSize = (previousTable.empty()) ? 8u : previousTable.size() * 2u;
+		while (newSize < _enumValues.size() * 2u)
+		{
+			newSize *= 2u;
+		}
+
+		_nameTable = std::vector<NameSlot>(newSize);
+
+		for (NameSlot const& slot : previousTable)
+		{
+			if (slot.valueIndex != invalidIndex)
+			{
+				insertNameSlot(slot);
+			}
+		}
+	}
+
+	insertNameSlot(NameSlot{std::hash<std::string_view>()(_enumValues[valueIndex].getName()), valueIndex});
+}
+
+inline void Enum::EnumImpl::insertNameSlot(NameSlot const& slot) noexcept
+{
+	std::size_t mask = _nameTable.size() - 1u;
+	std::size_t i = slot.nameHash & mask;
+
+	while (_nameTable[i].valueIndex != invalidIndex)
+	{
+		i = (i + 1u) & mask;
+	}
+
+	_nameTable[i] = slot;
+}
+
+inline void Enum::EnumImpl::rebuildDenseValueIndices() noexcept
+{
+	_denseValueIndices.clear();
+
+	std::size_t span = computeValuesSpan();
+
+	//Values are too sparse, lookups will use the sorted table
+	if (span == invalidIndex || span > _enumValues.size() * _maxDenseSlotsPerValue)
+	{
+		return;
+	}
+
+	_denseMinValue = _sortedValues.front().value;
+	_denseValueIndices.resize(span, invalidIndex);
+
+	//_sortedValues keeps declaration order for identical values, so the first declared enum value wins
+	for (ValueSlot const& slot : _sortedValues)
+	{
+		std::size_t& denseSlot = _denseValueIndices[static_cast<std::size_t>(static_cast<uint64>(slot.value) - static_cast<uint64>(_denseMinValue))];
+
+		if (denseSlot == invalidIndex)
+		{
+			denseSlot = slot.valueIndex;
+		}
+	}
+}
+
+inline std::size_t Enum::EnumImpl::computeValuesSpan() const noexcept
+{
+	if (_sortedValues.empty())
+	{
+		return 0u;
+	}
+
+	uint64 distance = static_cast<uint64>(_sortedValues.back().value) - static_cast<uint64>(_sortedValues.front().value);
+
+	return (distance < static_cast<uint64>(invalidIndex)) ? static_cast<std::size_t>(distance) + 1u : invalidIndex;
 }
 
 inline void Enum::EnumImpl::setEnumValuesCapacity(std::size_t capacity) noexcept
 {
 	_enumValues.reserve(capacity);
+	_sortedValues.reserve(capacity);
+}
+
+inline EnumValue const* Enum::EnumImpl::getEnumValueByName(char const* name) const noexcept
+{
+	if (_nameTable.empty())
+	{
+		return nullptr;
+	}
+
+	std::size_t nameHash = std::hash<std::string_view>()(name);
+	std::size_t mask = _nameTable.size() - 1u;
+
+	for (std::size_t i = nameHash & mask; _nameTable[i].valueIndex != invalidIndex; i = (i + 1u) & mask)
+	{
+		if (_nameTable[i].nameHash == nameHash && std::strcmp(_enumValues[_nameTable[i].valueIndex].getName(), name) == 0)
+		{
+			return &_enumValues[_nameTable[i].valueIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+inline EnumValue const* Enum::EnumImpl::getEnumValue(int64 value) const noexcept
+{
+	if (!_denseValueIndices.empty())
+	{
+		if (value < _denseMinValue)
+		{
+			return nullptr;
+		}
+
+		uint64 offset = static_cast<uint64>(value) - static_cast<uint64>(_denseMinValue);
+
+		return (offset < _denseValueIndices.size() && _denseValueIndices[static_cast<std::size_t>(offset)] != invalidIndex) ?
+			&_enumValues[_denseValueIndices[static_cast<std::size_t>(offset)]] : nullptr;
+	}
+
+	auto it = std::lower_bound(_sortedValues.cbegin(), _sortedValues.cend(), value, [](ValueSlot const& lhs, int64 rhs) { return lhs.value < rhs; });
+
+	return (it != _sortedValues.cend() && it->value == value) ? &_enumValues[it->valueIndex] : nullptr;
+}
+
+inline Vector<EnumValue const*> Enum::EnumImpl::getEnumValues(int64 value) const noexcept
+{
+	auto first	= std::lower_bound(_sortedValues.cbegin(), _sortedValues.cend(), value, [](ValueSlot const& lhs, int64 rhs) { return lhs.value < rhs; });
+	auto last	= std::upper_bound(first, _sortedValues.cend(), value, [](int64 lhs, ValueSlot const& rhs) { return lhs < rhs.value; });
+
+	Vector<EnumValue const*> result(static_cast<std::size_t>(last - first));
+
+	for (; first != last; first++)
+	{
+		result.push_back(&_enumValues[first->valueIndex]);
+	}
+
+	return result;
+}
+
+inline std::size_t Enum::EnumImpl::getEnumValues(int64 value, EnumValue const** outEnumValues, std::size_t capacity) const noexcept
+{
+	auto first	= std::lower_bound(_sortedValues.cbegin(), _sortedValues.cend(), value, [](ValueSlot const& lhs, int64 rhs) { return lhs.value < rhs; });
+	auto last	= std::upper_bound(first, _sortedValues.cend(), value, [](int64 lhs, ValueSlot const& rhs) { return lhs < rhs.value; });
+
+	std::size_t found = static_cast<std::size_t>(last - first);
+
+	for (std::size_t i = 0u; i < found && i < capacity; i++)
+	{
+		outEnumValues[i] = &_enumValues[first[i].valueIndex];
+	}
+
+	return found;
 }
 
 inline std::vector<EnumValue> const& Enum::EnumImpl::getEnumValues() const noexcept
@@ -29,4 +256,4 @@ inline std::vector<EnumValue> const& Enum::EnumImpl::getEnumValues() const noexc
 inline Archetype const& Enum::EnumImpl::getUnderlyingArchetype() const noexcept
 {
 	return _underlyingArchetype;
-}
\ No newline at end of file
+}
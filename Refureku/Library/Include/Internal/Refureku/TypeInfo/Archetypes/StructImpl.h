@@ -36,6 +36,10 @@ namespace rfk
 			using Methods			= std::unordered_multiset<Method, EntityNameHash, EntityNameEqual>;
 			using StaticMethods		= std::unordered_multiset<StaticMethod, EntityNameHash, EntityNameEqual>;
 			using Instantiators		= std::vector<StaticMethod const*>;
+			using FlatFields		= std::vector<Field const*>;
+			using FlatStaticFields	= std::vector<StaticField const*>;
+			using FlatMethods		= std::vector<Method const*>;
+			using FlatStaticMethods	= std::vector<StaticMethod const*>;
 		
 		private:
 			/** Structs this struct inherits directly in its declaration. This list includes ONLY reflected parents. */
@@ -59,12 +63,48 @@ namespace rfk
 			/** All reflected static methods declared in this struct. */
 			StaticMethods		_staticMethods;
 
+			/** Pointers to the elements of _fields stored contiguously, in insertion order. */
+			FlatFields			_flatFields;
+
+			/** Pointers to the elements of _staticFields stored contiguously, in insertion order. */
+			FlatStaticFields	_flatStaticFields;
+
+			/** Pointers to the elements of _methods stored contiguously, in insertion order. */
+			FlatMethods			_flatMethods;
+
+			/** Pointers to the elements of _staticMethods stored contiguously, in insertion order. */
+			FlatStaticMethods	_flatStaticMethods;
+
 			/** List of all custom instantiators returning rfk::SharedPtr for this archetype. */
 			Instantiators		_sharedInstantiators;
 
 			/** List of all custom instantiators returning rfk::UniquePtr for this archetype. */
 			Instantiators		_uniqueInstantiators;
 
+			/** List of all instantiators constructing an instance of this archetype in provided memory. */
+			Instantiators		_placementInstantiators;
+
+			/** Function destroying instances of this archetype, nullptr if unknown. */
+			Destructor			_destructor;
+
+			/** Alignment requirement of this archetype instances. */
+			std::size_t			_memoryAlignment;
+
+			/** Function copy constructing instances of this archetype, nullptr if unknown. */
+			CopyConstructor		_copyConstructor;
+
+			/** Function move constructing instances of this archetype, nullptr if unknown. */
+			MoveConstructor		_moveConstructor;
+
+			/** Function copy assigning instances of this archetype, nullptr if unknown. */
+			CopyAssignment		_copyAssignment;
+
+			/** Function move assigning instances of this archetype, nullptr if unknown. */
+			MoveAssignment		_moveAssignment;
+
+			/** Traits of this archetype. */
+			EStructTraits		_traits;
+
 			/** Kind of a rfk::Struct or rfk::Class instance. */
 			EClassKind			_classKind;
 
@@ -271,6 +311,63 @@ namespace rfk
 			*/
 			inline void									addUniqueInstantiator(StaticMethod const& instantiator)			noexcept;
 
+			/**
+			*	@brief	Add a new way to instantiate this struct through the makeInstanceAt method.
+			*			If the provided static method takes only the memory parameter, it will override the default placement instantiator.
+			*	
+			*	@param instantiator Pointer to the static method.
+			*/
+			inline void									addPlacementInstantiator(StaticMethod const& instantiator)		noexcept;
+
+			/**
+			*	@brief Setter for the field _destructor.
+			* 
+			*	@param destructor The destructor of this struct.
+			*/
+			inline void									setDestructor(Destructor destructor)							noexcept;
+
+			/**
+			*	@brief Setter for the field _memoryAlignment.
+			* 
+			*	@param alignment The alignment of this struct in bytes.
+			*/
+			inline void									setMemoryAlignment(std::size_t alignment)						noexcept;
+
+			/**
+			*	@brief Setter for the field _copyConstructor.
+			* 
+			*	@param copyConstructor The copy constructor of this struct.
+			*/
+			inline void									setCopyConstructor(CopyConstructor copyConstructor)				noexcept;
+
+			/**
+			*	@brief Setter for the field _moveConstructor.
+			* 
+			*	@param moveConstructor The move constructor of this struct.
+			*/
+			inline void									setMoveConstructor(MoveConstructor moveConstructor)				noexcept;
+
+			/**
+			*	@brief Setter for the field _copyAssignment.
+			* 
+			*	@param copyAssignment The copy assignment operator of this struct.
+			*/
+			inline void									setCopyAssignment(CopyAssignment copyAssignment)				noexcept;
+
+			/**
+			*	@brief Setter for the field _moveAssignment.
+			* 
+			*	@param moveAssignment The move assignment operator of this struct.
+			*/
+			inline void									setMoveAssignment(MoveAssignment moveAssignment)				noexcept;
+
+			/**
+			*	@brief Setter for the field _traits.
+			* 
+			*	@param traits The traits of this struct.
+			*/
+			inline void									setTraits(EStructTraits traits)									noexcept;
+
 			/**
 			*	@brief Get a nested archetype by name / access specifier.
 			* 
@@ -343,6 +440,34 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline StaticMethods const&		getStaticMethods()									const	noexcept;
 
+			/**
+			*	@brief Getter for the field _flatFields.
+			* 
+			*	@return _flatFields.
+			*/
+			RFK_NODISCARD inline FlatFields const&			getFlatFields()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatStaticFields.
+			* 
+			*	@return _flatStaticFields.
+			*/
+			RFK_NODISCARD inline FlatStaticFields const&	getFlatStaticFields()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatMethods.
+			* 
+			*	@return _flatMethods.
+			*/
+			RFK_NODISCARD inline FlatMethods const&			getFlatMethods()									const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatStaticMethods.
+			* 
+			*	@return _flatStaticMethods.
+			*/
+			RFK_NODISCARD inline FlatStaticMethods const&	getFlatStaticMethods()								const	noexcept;
+
 			/**
 			*	@brief Getter for the field _sharedInstantiators.
 			* 
@@ -357,6 +482,62 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline Instantiators const&		getUniqueInstantiators()							const	noexcept;
 
+			/**
+			*	@brief Getter for the field _placementInstantiators.
+			* 
+			*	@return _placementInstantiators.
+			*/
+			RFK_NODISCARD inline Instantiators const&		getPlacementInstantiators()							const	noexcept;
+
+			/**
+			*	@brief Getter for the field _destructor.
+			* 
+			*	@return _destructor.
+			*/
+			RFK_NODISCARD inline Destructor					getDestructor()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _memoryAlignment.
+			* 
+			*	@return _memoryAlignment.
+			*/
+			RFK_NODISCARD inline std::size_t				getMemoryAlignment()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _copyConstructor.
+			* 
+			*	@return _copyConstructor.
+			*/
+			RFK_NODISCARD inline CopyConstructor			getCopyConstructor()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _moveConstructor.
+			* 
+			*	@return _moveConstructor.
+			*/
+			RFK_NODISCARD inline MoveConstructor			getMoveConstructor()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _copyAssignment.
+			* 
+			*	@return _copyAssignment.
+			*/
+			RFK_NODISCARD inline CopyAssignment			getCopyAssignment()									const	noexcept;
+
+			/**
+			*	@brief Getter for the field _moveAssignment.
+			* 
+			*	@return _moveAssignment.
+			*/
+			RFK_NODISCARD inline MoveAssignment			getMoveAssignment()									const	noexcept;
+
+			/**
+			*	@brief Getter for the field _traits.
+			* 
+			*	@return _traits.
+			*/
+			RFK_NODISCARD inline EStructTraits				getTraits()											const	noexcept;
+
 			/**
 			*	@brief Getter for the field _classKind.
 			* 
@@ -7,6 +7,13 @@
 
 inline Struct::StructImpl::StructImpl(char const* name, std::size_t	id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
 	ArchetypeImpl(name, id, isClass ? EEntityKind::Class : EEntityKind::Struct, memorySize, nullptr),
+	_destructor{nullptr},
+	_memoryAlignment{alignof(std::max_align_t)},
+	_copyConstructor{nullptr},
+	_moveConstructor{nullptr},
+	_copyAssignment{nullptr},
+	_moveAssignment{nullptr},
+	_traits{EStructTraits::Default},
 	_classKind{classKind}
 {
 }
@@ -56,7 +63,11 @@ inline Field* Struct::StructImpl::addField(char const* name, std::size_t id, Typ
 	assert((flags & EFieldFlags::Static) != EFieldFlags::Static);
 
 	//The hash is based on the field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<Field*>(&*_fields.emplace(name, id, type, flags, owner, memoryOffset, outerEntity));
+	Field* result = const_cast<Field*>(&*_fields.emplace(name, id, type, flags, owner, memoryOffset, outerEntity));
+
+	_flatFields.push_back(result);
+
+	return result;
 }
 
 inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
@@ -66,7 +77,11 @@ inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::si
 	assert((flags & EFieldFlags::Static) == EFieldFlags::Static);
 
 	//The hash is based on the static field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+	StaticField* result = const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+
+	_flatStaticFields.push_back(result);
+
+	return result;
 }
 
 inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
@@ -76,7 +91,11 @@ inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::si
 	assert((flags & EFieldFlags::Static) == EFieldFlags::Static);
 
 	//The hash is based on the static field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+	StaticField* result = const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+
+	_flatStaticFields.push_back(result);
+
+	return result;
 }
 
 inline Method* Struct::StructImpl::addMethod(char const* name, std::size_t id, Type const& returnType,
@@ -86,7 +105,11 @@ inline Method* Struct::StructImpl::addMethod(char const* name, std::size_t id, T
 	assert((flags & EMethodFlags::Static) != EMethodFlags::Static);
 
 	//The hash is based on the method name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<Method*>(&*_methods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+	Method* result = const_cast<Method*>(&*_methods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+
+	_flatMethods.push_back(result);
+
+	return result;
 }
 
 inline StaticMethod* Struct::StructImpl::addStaticMethod(char const* name, std::size_t id, Type const& returnType,
@@ -96,7 +119,11 @@ inline StaticMethod* Struct::StructImpl::addStaticMethod(char const* name, std::
 	assert((flags & EMethodFlags::Static) == EMethodFlags::Static);
 
 	//The hash is based on the static method name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticMethod*>(&*_staticMethods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+	StaticMethod* result = const_cast<StaticMethod*>(&*_staticMethods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+
+	_flatStaticMethods.push_back(result);
+
+	return result;
 }
 
 inline void Struct::StructImpl::addSharedInstantiator(StaticMethod const& instantiator) noexcept
@@ -169,6 +196,80 @@ inline void Struct::StructImpl::addUniqueInstantiator(StaticMethod const& instan
 	}
 }
 
+inline void Struct::StructImpl::addPlacementInstantiator(StaticMethod const& instantiator) noexcept
+{
+	//The first parameter is the memory the instance is constructed in
+	std::size_t parametersCount = instantiator.getParametersCount();
+
+	//If it only takes the memory, use it as the (unique) default placement instantiator
+	if (parametersCount == 1u)
+	{
+		if (!_placementInstantiators.empty() && _placementInstantiators[0]->getParametersCount() == 1u)
+		{
+			//There is already a default placement instantiator, so replace it
+			_placementInstantiators[0] = &instantiator;
+		}
+		else
+		{
+			//No default placement instantiator, add a new one
+			_placementInstantiators.insert(_placementInstantiators.cbegin(), &instantiator);
+		}
+	}
+	else
+	{
+		//Insert instantiators by ascendent parameters count
+		for (auto it = _placementInstantiators.cbegin(); it != _placementInstantiators.cend(); it++)
+		{
+			if ((*it)->getParametersCount() >= parametersCount)
+			{
+				_placementInstantiators.insert(it, &instantiator);
+				return;
+			}
+		}
+
+		//Couldn't insert the instantiator in-between elements, so add it at the end
+		_placementInstantiators.push_back(&instantiator);
+	}
+}
+
+inline void Struct::StructImpl::setDestructor(Destructor destructor) noexcept
+{
+	_destructor = destructor;
+}
+
+inline void Struct::StructImpl::setMemoryAlignment(std::size_t alignment) noexcept
+{
+	//Alignments are always powers of 2
+	assert(alignment != 0u && (alignment & (alignment - 1u)) == 0u);
+
+	_memoryAlignment = alignment;
+}
+
+inline void Struct::StructImpl::setCopyConstructor(CopyConstructor copyConstructor) noexcept
+{
+	_copyConstructor = copyConstructor;
+}
+
+inline void Struct::StructImpl::setMoveConstructor(MoveConstructor moveConstructor) noexcept
+{
+	_moveConstructor = moveConstructor;
+}
+
+inline void Struct::StructImpl::setCopyAssignment(CopyAssignment copyAssignment) noexcept
+{
+	_copyAssignment = copyAssignment;
+}
+
+inline void Struct::StructImpl::setMoveAssignment(MoveAssignment moveAssignment) noexcept
+{
+	_moveAssignment = moveAssignment;
+}
+
+inline void Struct::StructImpl::setTraits(EStructTraits traits) noexcept
+{
+	_traits = traits;
+}
+
 inline void Struct::StructImpl::setDirectParentsCapacity(std::size_t capacity) noexcept
 {
 	_directParents.reserve(capacity);
@@ -182,21 +283,25 @@ inline void Struct::StructImpl::setNestedArchetypesCapacity(std::size_t capacity
 inline void Struct::StructImpl::setFieldsCapacity(std::size_t capacity) noexcept
 {
 	_fields.reserve(capacity);
+	_flatFields.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setStaticFieldsCapacity(std::size_t capacity) noexcept
 {
 	_staticFields.reserve(capacity);
+	_flatStaticFields.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setMethodsCapacity(std::size_t capacity) noexcept
 {
 	_methods.reserve(capacity);
+	_flatMethods.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setStaticMethodsCapacity(std::size_t capacity) noexcept
 {
 	_staticMethods.reserve(capacity);
+	_flatStaticMethods.reserve(capacity);
 }
 
 inline Archetype const* Struct::StructImpl::getNestedArchetype(char const* name, EAccessSpecifier access) const noexcept
@@ -256,6 +361,26 @@ inline Struct::StructImpl::StaticMethods const& Struct::StructImpl::getStaticMet
 	return _staticMethods;
 }
 
+inline Struct::StructImpl::FlatFields const& Struct::StructImpl::getFlatFields() const noexcept
+{
+	return _flatFields;
+}
+
+inline Struct::StructImpl::FlatStaticFields const& Struct::StructImpl::getFlatStaticFields() const noexcept
+{
+	return _flatStaticFields;
+}
+
+inline Struct::StructImpl::FlatMethods const& Struct::StructImpl::getFlatMethods() const noexcept
+{
+	return _flatMethods;
+}
+
+inline Struct::StructImpl::FlatStaticMethods const& Struct::StructImpl::getFlatStaticMethods() const noexcept
+{
+	return _flatStaticMethods;
+}
+
 inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getSharedInstantiators() const noexcept
 {
 	return _sharedInstantiators;
@@ -266,6 +391,46 @@ inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getUniqueIns
 	return _uniqueInstantiators;
 }
 
+inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getPlacementInstantiators() const noexcept
+{
+	return _placementInstantiators;
+}
+
+inline Struct::Destructor Struct::StructImpl::getDestructor() const noexcept
+{
+	return _destructor;
+}
+
+inline std::size_t Struct::StructImpl::getMemoryAlignment() const noexcept
+{
+	return _memoryAlignment;
+}
+
+inline Struct::CopyConstructor Struct::StructImpl::getCopyConstructor() const noexcept
+{
+	return _copyConstructor;
+}
+
+inline Struct::MoveConstructor Struct::StructImpl::getMoveConstructor() const noexcept
+{
+	return _moveConstructor;
+}
+
+inline Struct::CopyAssignment Struct::StructImpl::getCopyAssignment() const noexcept
+{
+	return _copyAssignment;
+}
+
+inline Struct::MoveAssignment Struct::StructImpl::getMoveAssignment() const noexcept
+{
+	return _moveAssignment;
+}
+
+inline EStructTraits Struct::StructImpl::getTraits() const noexcept
+{
+	return _traits;
+}
+
 inline EClassKind Struct::StructImpl::getClassKind() const noexcept
 {
 	return _classKind;
@@ -0,0 +1,232 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>		//std::align_val_t, std::nothrow
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <algorithm>	//std::max
+#include <unordered_map>
+
+#include "Refureku/TypeInfo/Archetypes/StructPool.h"
+
+namespace rfk
+{
+	class internal::StructPoolImpl final
+	{
+		private:
+			/** Free slot, linked to the next free slot of the same list. */
+			struct FreeSlot
+			{
+				FreeSlot*	next;
+			};
+
+			/** Singly linked list of free slots. */
+			struct FreeList
+			{
+				FreeSlot*	head	= nullptr;
+				std::size_t	count	= 0u;
+			};
+
+			/** Free list of a pool cached by a thread. */
+			struct CachedFreeList
+			{
+				/** Id of the pool owning the slots of the list, 0 if none. */
+				uint64		poolId;
+
+				/** Free slots of the pool. */
+				FreeList	list;
+			};
+
+			/** Number of pool free lists cached by each thread. */
+			static constexpr std::size_t	_threadCachesSize = 8u;
+
+			/**
+			*	Free lists of the last pools used by the calling thread.
+			*	Its size is fixed so that the lists of destroyed pools are evicted instead of accumulating,
+			*	and the evicted lists of live pools are given back to their depot.
+			*	The lists are only accessed by their thread, so they don't need any synchronization.
+			*/
+			class ThreadCaches
+			{
+				public:
+					/** Cached free lists. Pool ids are never reused, so the lists of destroyed pools never match again. */
+					CachedFreeList	entries[_threadCachesSize]	= {};
+
+					/** Index of the next entry replaced by a missing free list. */
+					std::size_t		nextEntryIndex				= 0u;
+
+					ThreadCaches()	= default;
+					inline ~ThreadCaches()	noexcept;
+			};
+
+			/**
+			*	Free list of the last pool used by the calling thread.
+			*	Trivial so that its thread_local instance is accessed without any initialization guard.
+			*/
+			struct LastThreadCache
+			{
+				/** Id of the last pool used by the thread, 0 if none. */
+				uint64		poolId;
+
+				/** Free list of the last pool used by the thread. */
+				FreeList*	cache;
+			};
+
+			/** Struct of the pooled instances. */
+			Struct const&				_archetype;
+
+			/** Unique id of the pool, used to find the pool free list of each thread. */
+			uint64 const				_id;
+
+			/** Alignment of the slots. */
+			std::size_t const			_slotAlignment;
+
+			/** Size of a slot, multiple of _slotAlignment. */
+			std::size_t const			_slotSize;
+
+			/** Number of slots in a slab. */
+			std::size_t const			_slabInstancesCount;
+
+			/** Mutex protecting _slabs and _depot. */
+			mutable std::mutex			_mutex;
+
+			/** All the slabs allocated by the pool. */
+			std::vector<void*>			_slabs;
+
+			/** Free lists given back by the threads, waiting to be reused. */
+			std::vector<FreeList>		_depot;
+
+			/**
+			*	@brief Get the free lists of the calling thread.
+			*
+			*	@return The free lists of the calling thread.
+			*/
+			static inline ThreadCaches&		getThreadCaches()								noexcept;
+
+			/**
+			*	@brief Get the free list of the last pool used by the calling thread.
+			*
+			*	@return The free list of the last pool used by the calling thread.
+			*/
+			static inline LastThreadCache&	getLastThreadCache()							noexcept;
+
+			/**
+			*	@brief Get the mutex protecting the live pools.
+			*
+			*	@return The mutex protecting the live pools.
+			*/
+			static inline std::mutex&		getLivePoolsMutex()								noexcept;
+
+			/**
+			*	@brief	Get the live pools, indexed by id.
+			*			Free lists evicted from a thread cache or left by an exiting thread are given back to the live pools only.
+			*
+			*	@return The live pools.
+			*/
+			static inline std::unordered_map<uint64, StructPoolImpl*>&	getLivePools()		noexcept;
+
+			/**
+			*	@brief Give a free list back to the depot of its pool, unless the pool was destroyed.
+			*
+			*	@param cachedList The free list to give back.
+			*/
+			static inline void				giveToLivePool(CachedFreeList const& cachedList)	noexcept;
+
+			/**
+			*	@brief Get a new unique pool id.
+			*
+			*	@return A new pool id.
+			*/
+			static inline uint64			generateId()									noexcept;
+
+			/**
+			*	@brief Get the free list of this pool for the calling thread.
+			*
+			*	@return The free list of this pool for the calling thread.
+			*/
+			inline FreeList&				getThreadCache()						const	noexcept;
+
+			/**
+			*	@brief	Find the free list of this pool for the calling thread, and make it the last used one.
+			*			If the thread doesn't cache it, a new empty list replaces the oldest cached one.
+			*
+			*	@return The free list of this pool for the calling thread.
+			*/
+			inline FreeList&				findThreadCache()						const	noexcept;
+
+			/**
+			*	@brief	Refill an empty free list from the depot, or from a new slab if the depot is empty.
+			*
+			*	@param cache The free list to refill.
+			*
+			*	@return true if the free list was refilled, false if a new slab could not be allocated.
+			*/
+			inline bool						refill(FreeList& cache)							noexcept;
+
+			/**
+			*	@brief Give a free list to the depot.
+			*
+			*	@param list The free list to give. Must not be empty.
+			*/
+			inline void						giveToDepot(FreeList const& list)				noexcept;
+
+		public:
+			inline StructPoolImpl(Struct const&	archetype,
+								  std::size_t	slabInstancesCount)	noexcept;
+			StructPoolImpl(StructPoolImpl const&)					= delete;
+			StructPoolImpl(StructPoolImpl&&)						= delete;
+			inline ~StructPoolImpl()								noexcept;
+
+			/**
+			*	@brief Get the memory of a slot from the free list of the calling thread.
+			*
+			*	@return The slot memory, nullptr if a new slab could not be allocated.
+			*/
+			inline void*					allocate()										noexcept;
+
+			/**
+			*	@brief	Push a slot to the free list of the calling thread.
+			*			A slab worth of slots is given to the depot when the list reaches twice the slab size.
+			*
+			*	@param memory The slot memory.
+			*/
+			inline void						deallocate(void* memory)						noexcept;
+
+			/**
+			*	@brief Getter for the field _archetype.
+			*
+			*	@return _archetype.
+			*/
+			RFK_NODISCARD inline Struct const&	getArchetype()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _slotSize.
+			*
+			*	@return _slotSize.
+			*/
+			RFK_NODISCARD inline std::size_t	getSlotSize()						const	noexcept;
+
+			/**
+			*	@brief Get the number of allocated slabs.
+			*
+			*	@return The number of allocated slabs.
+			*/
+			RFK_NODISCARD inline std::size_t	getSlabsCount()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _slabInstancesCount.
+			*
+			*	@return _slabInstancesCount.
+			*/
+			RFK_NODISCARD inline std::size_t	getSlabInstancesCount()				const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Archetypes/StructPoolImpl.inl"
+}
\ No newline at end of file
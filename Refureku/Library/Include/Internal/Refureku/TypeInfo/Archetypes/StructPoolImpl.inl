@@ -0,0 +1,259 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline internal::StructPoolImpl::ThreadCaches::~ThreadCaches() noexcept
+{
+	//Give the free lists of the exiting thread back to their pool
+	for (CachedFreeList const& entry : entries)
+	{
+		giveToLivePool(entry);
+	}
+}
+
+inline internal::StructPoolImpl::StructPoolImpl(Struct const& archetype, std::size_t slabInstancesCount) noexcept:
+	_archetype{archetype},
+	_id{generateId()},
+	_slotAlignment{std::max(archetype.getMemoryAlignment(), alignof(FreeSlot))},
+	_slotSize{(std::max(archetype.getMemorySize(), sizeof(FreeSlot)) + _slotAlignment - 1u) / _slotAlignment * _slotAlignment},
+	_slabInstancesCount{std::max(slabInstancesCount, std::size_t(1u))}
+{
+	std::lock_guard lock(getLivePoolsMutex());
+
+	getLivePools().emplace(_id, this);
+}
+
+inline internal::StructPoolImpl::~StructPoolImpl() noexcept
+{
+	{
+		std::lock_guard lock(getLivePoolsMutex());
+
+		getLivePools().erase(_id);
+	}
+
+	//Free the cache entry of the calling thread right away since it points into the released slabs,
+	//the entries of other threads are evicted as they use other pools
+	for (CachedFreeList& entry : getThreadCaches().entries)
+	{
+		if (entry.poolId == _id)
+		{
+			entry = CachedFreeList{0u, FreeList{}};
+		}
+	}
+
+	LastThreadCache& lastThreadCache = getLastThreadCache();
+
+	if (lastThreadCache.poolId == _id)
+	{
+		lastThreadCache.poolId	= 0u;
+		lastThreadCache.cache	= nullptr;
+	}
+
+	for (void* slab : _slabs)
+	{
+		::operator delete(slab, std::align_val_t{_slotAlignment});
+	}
+}
+
+inline internal::StructPoolImpl::ThreadCaches& internal::StructPoolImpl::getThreadCaches() noexcept
+{
+	thread_local ThreadCaches threadCaches;
+
+	return threadCaches;
+}
+
+inline internal::StructPoolImpl::LastThreadCache& internal::StructPoolImpl::getLastThreadCache() noexcept
+{
+	thread_local LastThreadCache lastThreadCache{0u, nullptr};
+
+	return lastThreadCache;
+}
+
+inline std::mutex& internal::StructPoolImpl::getLivePoolsMutex() noexcept
+{
+	static std::mutex mutex;
+
+	return mutex;
+}
+
+inline std::unordered_map<uint64, internal::StructPoolImpl*>& internal::StructPoolImpl::getLivePools() noexcept
+{
+	static std::unordered_map<uint64, StructPoolImpl*> livePools;
+
+	return livePools;
+}
+
+inline void internal::StructPoolImpl::giveToLivePool(CachedFreeList const& cachedList) noexcept
+{
+	if (cachedList.list.count != 0u)
+	{
+		std::lock_guard lock(getLivePoolsMutex());
+
+		auto it = getLivePools().find(cachedList.poolId);
+
+		if (it != getLivePools().end())
+		{
+			it->second->giveToDepot(cachedList.list);
+		}
+	}
+}
+
+inline uint64 internal::StructPoolImpl::generateId() noexcept
+{
+	//0 is reserved for "no pool"
+	static std::atomic<uint64> nextId{1u};
+
+	return nextId.fetch_add(1u, std::memory_order_relaxed);
+}
+
+inline internal::StructPoolImpl::FreeList& internal::StructPoolImpl::getThreadCache() const noexcept
+{
+	LastThreadCache& lastThreadCache = getLastThreadCache();
+
+	//Fast path: the thread keeps using the same pool
+	return (lastThreadCache.poolId == _id) ? *lastThreadCache.cache : findThreadCache();
+}
+
+inline internal::StructPoolImpl::FreeList& internal::StructPoolImpl::findThreadCache() const noexcept
+{
+	LastThreadCache&	lastThreadCache	= getLastThreadCache();
+	ThreadCaches&		threadCaches	= getThreadCaches();
+
+	for (CachedFreeList& entry : threadCaches.entries)
+	{
+		if (entry.poolId == _id)
+		{
+			lastThreadCache = LastThreadCache{_id, &entry.list};
+
+			return entry.list;
+		}
+	}
+
+	//The list was evicted from the cache or was never created, replace the oldest entry
+	CachedFreeList& entry = threadCaches.entries[threadCaches.nextEntryIndex];
+
+	threadCaches.nextEntryIndex = (threadCaches.nextEntryIndex + 1u) % _threadCachesSize;
+
+	giveToLivePool(entry);
+
+	entry			= CachedFreeList{_id, FreeList{}};
+	lastThreadCache	= LastThreadCache{_id, &entry.list};
+
+	return entry.list;
+}
+
+inline bool internal::StructPoolImpl::refill(FreeList& cache) noexcept
+{
+	{
+		std::lock_guard lock(_mutex);
+
+		if (!_depot.empty())
+		{
+			cache = _depot.back();
+			_depot.pop_back();
+
+			return true;
+		}
+	}
+
+	//The depot is empty, allocate a new slab outside of the lock
+	char* slab = static_cast<char*>(::operator new(_slotSize * _slabInstancesCount, std::align_val_t{_slotAlignment}, std::nothrow));
+
+	if (slab == nullptr)
+	{
+		return false;
+	}
+
+	//Link the slots in address order so that consecutive allocations are contiguous
+	for (std::size_t i = 0u; i < _slabInstancesCount - 1u; i++)
+	{
+		reinterpret_cast<FreeSlot*>(slab + i * _slotSize)->next = reinterpret_cast<FreeSlot*>(slab + (i + 1u) * _slotSize);
+	}
+	reinterpret_cast<FreeSlot*>(slab + (_slabInstancesCount - 1u) * _slotSize)->next = nullptr;
+
+	cache.head	= reinterpret_cast<FreeSlot*>(slab);
+	cache.count	= _slabInstancesCount;
+
+	std::lock_guard lock(_mutex);
+
+	_slabs.push_back(slab);
+
+	return true;
+}
+
+inline void internal::StructPoolImpl::giveToDepot(FreeList const& list) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_depot.push_back(list);
+}
+
+inline void* internal::StructPoolImpl::allocate() noexcept
+{
+	FreeList& cache = getThreadCache();
+
+	if (cache.head == nullptr && !refill(cache))
+	{
+		return nullptr;
+	}
+
+	FreeSlot* slot = cache.head;
+
+	cache.head = slot->next;
+	cache.count--;
+
+	return slot;
+}
+
+inline void internal::StructPoolImpl::deallocate(void* memory) noexcept
+{
+	FreeList& cache = getThreadCache();
+	FreeSlot* slot	= static_cast<FreeSlot*>(memory);
+
+	slot->next	= cache.head;
+	cache.head	= slot;
+	cache.count++;
+
+	//Give a slab worth of slots to the depot so that threads freeing more than they allocate don't hoard memory
+	if (cache.count >= 2u * _slabInstancesCount)
+	{
+		FreeList	batch{cache.head, _slabInstancesCount};
+		FreeSlot*	batchTail = cache.head;
+
+		for (std::size_t i = 1u; i < _slabInstancesCount; i++)
+		{
+			batchTail = batchTail->next;
+		}
+
+		cache.head		= batchTail->next;
+		cache.count		-= _slabInstancesCount;
+		batchTail->next	= nullptr;
+
+		giveToDepot(batch);
+	}
+}
+
+inline Struct const& internal::StructPoolImpl::getArchetype() const noexcept
+{
+	return _archetype;
+}
+
+inline std::size_t internal::StructPoolImpl::getSlotSize() const noexcept
+{
+	return _slotSize;
+}
+
+inline std::size_t internal::StructPoolImpl::getSlabsCount() const noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	return _slabs.size();
+}
+
+inline std::size_t internal::StructPoolImpl::getSlabInstancesCount() const noexcept
+{
+	return _slabInstancesCount;
+}
\ No newline at end of file
@@ -0,0 +1,261 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>			//std::align_val_t, std::nothrow
+#include <cassert>
+#include <cstddef>		//std::max_align_t
+#include <vector>
+#include <cstring>		//std::memcpy
+#include <algorithm>	//std::max, std::sort, std::lower_bound
+
+#include "Refureku/TypeInfo/Archetypes/StructStorage.h"
+#include "Refureku/TypeInfo/Type.h"
+
+namespace rfk
+{
+	class internal::StructStorageImpl final
+	{
+		private:
+			/** Contiguous values of a field in a SoA chunk. */
+			struct Column
+			{
+				/** Field stored in the column. */
+				Field const*	field;
+
+				/** Memory offset of the field in an instance. */
+				std::size_t		memoryOffset;
+
+				/** Size of the field in bytes. */
+				std::size_t		size;
+
+				/** Offset of the column from the beginning of a chunk. */
+				std::size_t		chunkOffset;
+			};
+
+			/** Struct of the stored instances. */
+			Struct const&			_archetype;
+
+			/** Layout of the instances in the chunks. */
+			EStructStorageLayout	_layout;
+
+			/** Number of instances a chunk can store. */
+			std::size_t const		_chunkInstancesCount;
+
+			/** Alignment of the chunks and of the SoA columns. */
+			std::size_t const		_chunkAlignment;
+
+			/** Columns of a SoA chunk, sorted by memory offset. Empty in the AoS layout. */
+			std::vector<Column>		_columns;
+
+			/** Size of a chunk in bytes. */
+			std::size_t				_chunkSize;
+
+			/** All the allocated chunks, kept after a clear to be reused. */
+			std::vector<void*>		_chunks;
+
+			/** Number of stored instances. */
+			std::size_t				_instancesCount	= 0u;
+
+			/** Memory instances are constructed in before being scattered to the columns in the SoA layout. */
+			void*					_soaScratch		= nullptr;
+
+			/**
+			*	@brief Compute the size of a value of a type.
+			*
+			*	@param type The type.
+			*
+			*	@return The size of a value of the type in bytes, 0 if it is unknown (reference or unreflected type).
+			*/
+			static inline std::size_t	computeTypeSize(Type const& type)								noexcept;
+
+			/**
+			*	@brief Compute the SoA columns of a struct.
+			*
+			*	@param archetype	The struct.
+			*	@param out_columns	Columns of the struct reflected fields, sorted by memory offset.
+			*
+			*	@return true if the size of every reflected field is known, else false.
+			*/
+			static inline bool			computeColumns(Struct const&		archetype,
+													   std::vector<Column>&	out_columns)				noexcept;
+
+			/**
+			*	@brief Find the column of a field.
+			*
+			*	@param field The field.
+			*
+			*	@return The column of the field, nullptr if the field is not stored.
+			*/
+			inline Column const*		findColumn(Field const& field)							const	noexcept;
+
+			/**
+			*	@brief Get the memory of an instance in the AoS layout.
+			*
+			*	@param index Index of the instance.
+			*
+			*	@return The memory of the instance.
+			*/
+			inline unsigned char*		getAoSInstance(std::size_t index)						const	noexcept;
+
+			/**
+			*	@brief Get the value of a column for an instance in the SoA layout.
+			*
+			*	@param column	The column.
+			*	@param index	Index of the instance.
+			*
+			*	@return The value of the column for the instance.
+			*/
+			inline unsigned char*		getSoAValue(Column const&	column,
+													std::size_t		index)						const	noexcept;
+
+			/**
+			*	@brief Make sure a chunk is allocated.
+			*
+			*	@param chunkIndex Index of the chunk.
+			*
+			*	@return true if the chunk is allocated, false if the allocation failed.
+			*/
+			inline bool					ensureChunk(std::size_t chunkIndex)								noexcept;
+
+		public:
+			inline StructStorageImpl(Struct const&			archetype,
+									 EStructStorageLayout	layout,
+									 std::size_t			chunkInstancesCount)	noexcept;
+			StructStorageImpl(StructStorageImpl const&)								= delete;
+			StructStorageImpl(StructStorageImpl&&)									= delete;
+			inline ~StructStorageImpl()												noexcept;
+
+			/**
+			*	@brief Check whether instances of a struct can be stored with a layout.
+			*
+			*	@param archetype	The struct to check.
+			*	@param layout		The layout to check.
+			*
+			*	@return true if instances of archetype can be stored with layout, else false.
+			*/
+			static inline bool			isLayoutSupported(Struct const&			archetype,
+														  EStructStorageLayout	layout)			noexcept;
+
+			/**
+			*	@brief Get the memory receiving the next instance, allocating a new chunk if needed.
+			*
+			*	@return The memory receiving the next instance, nullptr if a chunk could not be allocated.
+			*/
+			inline void*				reserveBack()													noexcept;
+
+			/**
+			*	@brief Add the instance constructed in the memory returned by reserveBack to the storage.
+			*/
+			inline void					commitBack()													noexcept;
+
+			/**
+			*	@brief Copy contiguous instances of the struct at the end of the storage.
+			*
+			*	@param sources	The instances to copy.
+			*	@param count	Number of instances to copy.
+			*
+			*	@return true if the instances were copied, else false.
+			*/
+			inline bool					pushBackCopies(void const*	sources,
+													   std::size_t	count);
+
+			/**
+			*	@brief Destroy an instance and relocate the last instance in its place.
+			*
+			*	@param index Index of the instance to remove.
+			*
+			*	@return true if the instance was removed, else false.
+			*/
+			inline bool					swapRemove(std::size_t index);
+
+			/**
+			*	@brief Destroy all the instances.
+			*/
+			inline void					clear()															noexcept;
+
+			/**
+			*	@brief Get an instance stored in the AoS layout.
+			*
+			*	@param index Index of the instance.
+			*
+			*	@return A pointer to the instance, nullptr in the SoA layout.
+			*/
+			inline void*				getInstanceAt(std::size_t index)						const	noexcept;
+
+			/**
+			*	@brief Get the value of a field of an instance.
+			*
+			*	@param field	The field.
+			*	@param index	Index of the instance.
+			*
+			*	@return A pointer to the field value, nullptr if the field is not stored.
+			*/
+			inline void*				getFieldAt(Field const&	field,
+												   std::size_t	index)							const	noexcept;
+
+			/**
+			*	@brief Get the values of a field in a chunk.
+			*
+			*	@param field		The field.
+			*	@param chunkIndex	Index of the chunk.
+			*	@param out_stride	Number of bytes between the values of two consecutive instances.
+			*
+			*	@return A pointer to the value of the first instance of the chunk, nullptr if the field is not stored.
+			*/
+			inline void*				getFieldData(Field const&	field,
+													 std::size_t	chunkIndex,
+													 std::size_t&	out_stride)					const	noexcept;
+
+			/**
+			*	@brief Getter for the field _archetype.
+			*
+			*	@return _archetype.
+			*/
+			RFK_NODISCARD inline Struct const&			getArchetype()							const	noexcept;
+
+			/**
+			*	@brief Getter for the field _layout.
+			*
+			*	@return _layout.
+			*/
+			RFK_NODISCARD inline EStructStorageLayout	getLayout()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _instancesCount.
+			*
+			*	@return _instancesCount.
+			*/
+			RFK_NODISCARD inline std::size_t			getInstancesCount()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _chunkInstancesCount.
+			*
+			*	@return _chunkInstancesCount.
+			*/
+			RFK_NODISCARD inline std::size_t			getChunkInstancesCount()				const	noexcept;
+
+			/**
+			*	@brief Get the number of chunks storing at least one instance.
+			*
+			*	@return The number of chunks storing at least one instance.
+			*/
+			RFK_NODISCARD inline std::size_t			getChunksCount()						const	noexcept;
+
+			/**
+			*	@brief Get the number of instances stored in a chunk.
+			*
+			*	@param chunkIndex Index of the chunk.
+			*
+			*	@return The number of instances stored in the chunk.
+			*/
+			RFK_NODISCARD inline std::size_t			getChunkSize(std::size_t chunkIndex)	const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Archetypes/StructStorageImpl.inl"
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline internal::StructStorageImpl::StructStorageImpl(Struct const& archetype, EStructStorageLayout layout, std::size_t chunkInstancesCount) noexcept:
+	_archetype{archetype},
+	_layout{isLayoutSupported(archetype, layout) ? layout : EStructStorageLayout::AoS},
+	_chunkInstancesCount{std::max(chunkInstancesCount, std::size_t(1u))},
+	_chunkAlignment{std::max(archetype.getMemoryAlignment(), alignof(std::max_align_t))},
+	_chunkSize{0u}
+{
+	if (_layout == EStructStorageLayout::SoA)
+	{
+		computeColumns(_archetype, _columns);
+
+		//Each column starts on the chunk alignment, which is a multiple of the alignment of any field
+		for (Column& column : _columns)
+		{
+			column.chunkOffset	= (_chunkSize + _chunkAlignment - 1u) / _chunkAlignment * _chunkAlignment;
+			_chunkSize			= column.chunkOffset + column.size * _chunkInstancesCount;
+		}
+
+		_chunkSize = std::max(_chunkSize, std::size_t(1u));
+	}
+	else
+	{
+		_chunkSize = _archetype.getMemorySize() * _chunkInstancesCount;
+	}
+}
+
+inline internal::StructStorageImpl::~StructStorageImpl() noexcept
+{
+	clear();
+
+	for (void* chunk : _chunks)
+	{
+		::operator delete(chunk, std::align_val_t{_chunkAlignment});
+	}
+
+	if (_soaScratch != nullptr)
+	{
+		::operator delete(_soaScratch, std::align_val_t{_chunkAlignment});
+	}
+}
+
+inline std::size_t internal::StructStorageImpl::computeTypeSize(Type const& type) noexcept
+{
+	std::size_t elementsCount = 1u;
+
+	//Type parts are ordered from the outermost to the innermost, ex: int*[3] is CArray(3), Ptr, Value
+	for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+	{
+		TypePart const& typePart = type.getTypePartAt(i);
+
+		if (typePart.isCArray())
+		{
+			elementsCount *= typePart.getCArraySize();
+		}
+		else if (typePart.isPointer())
+		{
+			return elementsCount * sizeof(void*);
+		}
+		else if (typePart.isValue())
+		{
+			return (type.getArchetype() != nullptr) ? elementsCount * type.getArchetype()->getMemorySize() : 0u;
+		}
+		else
+		{
+			//References don't have a known storage
+			return 0u;
+		}
+	}
+
+	return 0u;
+}
+
+inline bool internal::StructStorageImpl::computeColumns(Struct const& archetype, std::vector<Column>& out_columns) noexcept
+{
+	Span<Field const* const> fields = archetype.getFieldsSpan();
+
+	out_columns.reserve(fields.size());
+
+	for (Field const* field : fields)
+	{
+		std::size_t fieldSize = computeTypeSize(field->getType());
+
+		if (fieldSize == 0u)
+		{
+			return false;
+		}
+
+		out_columns.push_back(Column{field, field->getMemoryOffset(), fieldSize, 0u});
+	}
+
+	std::sort(out_columns.begin(), out_columns.end(), [](Column const& lhs, Column const& rhs) { return lhs.memoryOffset < rhs.memoryOffset; });
+
+	return true;
+}
+
+inline bool internal::StructStorageImpl::isLayoutSupported(Struct const& archetype, EStructStorageLayout layout) noexcept
+{
+	if (layout == EStructStorageLayout::AoS)
+	{
+		return true;
+	}
+
+	//Instances are split in columns so they must be copyable and destructible bytewise
+	if ((archetype.getTraits() & EStructTraits::TriviallyCopyable) != EStructTraits::TriviallyCopyable)
+	{
+		return false;
+	}
+
+	std::vector<Column> columns;
+
+	return computeColumns(archetype, columns);
+}
+
+inline internal::StructStorageImpl::Column const* internal::StructStorageImpl::findColumn(Field const& field) const noexcept
+{
+	auto it = std::lower_bound(_columns.cbegin(), _columns.cend(), field.getMemoryOffset(),
+							   [](Column const& column, std::size_t memoryOffset) { return column.memoryOffset < memoryOffset; });
+
+	//Several fields can share the same memory offset (unions)
+	for (; it != _columns.cend() && it->memoryOffset == field.getMemoryOffset(); it++)
+	{
+		if (it->field == &field)
+		{
+			return &*it;
+		}
+	}
+
+	return nullptr;
+}
+
+inline unsigned char* internal::StructStorageImpl::getAoSInstance(std::size_t index) const noexcept
+{
+	return static_cast<unsigned char*>(_chunks[index / _chunkInstancesCount]) + (index % _chunkInstancesCount) * _archetype.getMemorySize();
+}
+
+inline unsigned char* internal::StructStorageImpl::getSoAValue(Column const& column, std::size_t index) const noexcept
+{
+	return static_cast<unsigned char*>(_chunks[index / _chunkInstancesCount]) + column.chunkOffset + (index % _chunkInstancesCount) * column.size;
+}
+
+inline bool internal::StructStorageImpl::ensureChunk(std::size_t chunkIndex) noexcept
+{
+	assert(chunkIndex <= _chunks.size());
+
+	if (chunkIndex == _chunks.size())
+	{
+		void* chunk = ::operator new(_chunkSize, std::align_val_t{_chunkAlignment}, std::nothrow);
+
+		if (chunk == nullptr)
+		{
+			return false;
+		}
+
+		_chunks.push_back(chunk);
+	}
+
+	return true;
+}
+
+inline void* internal::StructStorageImpl::reserveBack() noexcept
+{
+	if (!ensureChunk(_instancesCount / _chunkInstancesCount))
+	{
+		return nullptr;
+	}
+
+	if (_layout == EStructStorageLayout::AoS)
+	{
+		return getAoSInstance(_instancesCount);
+	}
+
+	//Instances are constructed in the scratch memory, then scattered to the columns by commitBack
+	if (_soaScratch == nullptr)
+	{
+		_soaScratch = ::operator new(_archetype.getMemorySize(), std::align_val_t{_chunkAlignment}, std::nothrow);
+	}
+
+	return _soaScratch;
+}
+
+inline void internal::StructStorageImpl::commitBack() noexcept
+{
+	if (_layout == EStructStorageLayout::SoA)
+	{
+		unsigned char const* instance = static_cast<unsigned char const*>(_soaScratch);
+
+		for (Column const& column : _columns)
+		{
+			std::memcpy(getSoAValue(column, _instancesCount), instance + column.memoryOffset, column.size);
+		}
+	}
+
+	_instancesCount++;
+}
+
+inline bool internal::StructStorageImpl::pushBackCopies(void const* sources, std::size_t count)
+{
+	if ((_archetype.getTraits() & EStructTraits::TriviallyCopyConstructible) != EStructTraits::TriviallyCopyConstructible &&
+		_archetype.getCopyConstructor() == nullptr)
+	{
+		return false;
+	}
+
+	unsigned char const*	source		= static_cast<unsigned char const*>(sources);
+	std::size_t				memorySize	= _archetype.getMemorySize();
+
+	while (count != 0u)
+	{
+		//Copy as many instances as possible in the current chunk at once
+		std::size_t copiesCount = std::min(count, _chunkInstancesCount - _instancesCount % _chunkInstancesCount);
+
+		if (!ensureChunk(_instancesCount / _chunkInstancesCount))
+		{
+			return false;
+		}
+
+		if (_layout == EStructStorageLayout::AoS)
+		{
+			_archetype.copyConstructAt(getAoSInstance(_instancesCount), source, copiesCount);
+		}
+		else
+		{
+			for (Column const& column : _columns)
+			{
+				unsigned char* destination = getSoAValue(column, _instancesCount);
+
+				for (std::size_t i = 0u; i < copiesCount; i++)
+				{
+					std::memcpy(destination + i * column.size, source + i * memorySize + column.memoryOffset, column.size);
+				}
+			}
+		}
+
+		_instancesCount	+= copiesCount;
+		source			+= copiesCount * memorySize;
+		count			-= copiesCount;
+	}
+
+	return true;
+}
+
+inline bool internal::StructStorageImpl::swapRemove(std::size_t index)
+{
+	assert(index < _instancesCount);
+
+	std::size_t lastIndex = _instancesCount - 1u;
+
+	if (_layout == EStructStorageLayout::AoS)
+	{
+		unsigned char* instance = getAoSInstance(index);
+
+		if (index != lastIndex)
+		{
+			if ((_archetype.getTraits() & EStructTraits::TriviallyRelocatable) != EStructTraits::TriviallyRelocatable &&
+				_archetype.getMoveConstructor() == nullptr)
+			{
+				return false;
+			}
+
+			_archetype.destroyInstanceAt(instance);
+			_archetype.relocateAt(instance, getAoSInstance(lastIndex));
+		}
+		else
+		{
+			_archetype.destroyInstanceAt(instance);
+		}
+	}
+	else if (index != lastIndex)
+	{
+		for (Column const& column : _columns)
+		{
+			std::memcpy(getSoAValue(column, index), getSoAValue(column, lastIndex), column.size);
+		}
+	}
+
+	_instancesCount--;
+
+	return true;
+}
+
+inline void internal::StructStorageImpl::clear() noexcept
+{
+	//SoA instances are trivially destructible
+	if (_layout == EStructStorageLayout::AoS &&
+		(_archetype.getTraits() & EStructTraits::TriviallyCopyable) != EStructTraits::TriviallyCopyable)
+	{
+		for (std::size_t i = 0u; i < _instancesCount; i++)
+		{
+			_archetype.destroyInstanceAt(getAoSInstance(i));
+		}
+	}
+
+	_instancesCount = 0u;
+}
+
+inline void* internal::StructStorageImpl::getInstanceAt(std::size_t index) const noexcept
+{
+	assert(index < _instancesCount);
+
+	return (_layout == EStructStorageLayout::AoS) ? getAoSInstance(index) : nullptr;
+}
+
+inline void* internal::StructStorageImpl::getFieldAt(Field const& field, std::size_t index) const noexcept
+{
+	assert(index < _instancesCount);
+
+	std::size_t	stride;
+	void*		data = getFieldData(field, index / _chunkInstancesCount, stride);
+
+	return (data != nullptr) ? static_cast<unsigned char*>(data) + (index % _chunkInstancesCount) * stride : nullptr;
+}
+
+inline void* internal::StructStorageImpl::getFieldData(Field const& field, std::size_t chunkIndex, std::size_t& out_stride) const noexcept
+{
+	if (chunkIndex >= _chunks.size())
+	{
+		return nullptr;
+	}
+
+	if (_layout == EStructStorageLayout::AoS)
+	{
+		//Same requirement as Field::get: the field offset must be relative to the stored struct
+		if (field.getOwner() != &_archetype)
+		{
+			return nullptr;
+		}
+
+		out_stride = _archetype.getMemorySize();
+
+		return static_cast<unsigned char*>(_chunks[chunkIndex]) + field.getMemoryOffset();
+	}
+	else
+	{
+		Column const* column = findColumn(field);
+
+		if (column == nullptr)
+		{
+			return nullptr;
+		}
+
+		out_stride = column->size;
+
+		return static_cast<unsigned char*>(_chunks[chunkIndex]) + column->chunkOffset;
+	}
+}
+
+inline Struct const& internal::StructStorageImpl::getArchetype() const noexcept
+{
+	return _archetype;
+}
+
+inline EStructStorageLayout internal::StructStorageImpl::getLayout() const noexcept
+{
+	return _layout;
+}
+
+inline std::size_t internal::StructStorageImpl::getInstancesCount() const noexcept
+{
+	return _instancesCount;
+}
+
+inline std::size_t internal::StructStorageImpl::getChunkInstancesCount() const noexcept
+{
+	return _chunkInstancesCount;
+}
+
+inline std::size_t internal::StructStorageImpl::getChunksCount() const noexcept
+{
+	return (_instancesCount + _chunkInstancesCount - 1u) / _chunkInstancesCount;
+}
+
+inline std::size_t internal::StructStorageImpl::getChunkSize(std::size_t chunkIndex) const noexcept
+{
+	return (chunkIndex < getChunksCount()) ? std::min(_chunkInstancesCount, _instancesCount - chunkIndex * _chunkInstancesCount) : 0u;
+}
\ No newline at end of file
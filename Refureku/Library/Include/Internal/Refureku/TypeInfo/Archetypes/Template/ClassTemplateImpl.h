@@ -9,11 +9,14 @@
 
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
 
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
 #include "Refureku/TypeInfo/Archetypes/StructImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateParameter.h"
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiation.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateArgumentHash.h"
 
 namespace rfk
 {
@@ -26,6 +29,12 @@ namespace rfk
 			/** All different instantiations of this class template in the program (with different template parameters). */
 			std::unordered_set<ClassTemplateInstantiation const*>	_templateInstantiations;
 
+			/** Instantiations with a complete template arguments list, indexed by the hash of their template arguments. */
+			std::unordered_multimap<std::size_t, ClassTemplateInstantiation const*>	_templateInstantiationsByArguments;
+
+			/** Template arguments hash of each instantiation contained in _templateInstantiationsByArguments. */
+			std::unordered_map<ClassTemplateInstantiation const*, std::size_t>			_templateArgumentsHashes;
+
 		public:
 			inline ClassTemplateImpl(char const*	name,
 									 std::size_t	id,
@@ -45,6 +54,32 @@ namespace rfk
 			*/
 			inline void																			removeTemplateInstantiation(ClassTemplateInstantiation const& instantiation)	noexcept;
 
+			/**
+			*	@brief	Index a template instantiation by its template arguments.
+			*			Must be called once all the instantiation template arguments have been added.
+			* 
+			*	@param instantiation Template instantiation to index.
+			*/
+			inline void																			indexTemplateInstantiation(ClassTemplateInstantiation const& instantiation)		noexcept;
+
+			/**
+			*	@brief Search an indexed template instantiation by its template arguments.
+			* 
+			*	@param args			Pointer to an array of argument pointers. None of the arguments can be nullptr.
+			*	@param argsCount	Number of template arguments.
+			* 
+			*	@return The indexed template instantiation matching all the provided arguments if any, else nullptr.
+			*/
+			RFK_NODISCARD inline ClassTemplateInstantiation const*								getIndexedTemplateInstantiation(TemplateArgument const**	args,
+																												std::size_t					argsCount)	const	noexcept;
+
+			/**
+			*	@brief Check whether all registered template instantiations are indexed by their template arguments.
+			* 
+			*	@return true if all registered template instantiations are indexed, else false.
+			*/
+			RFK_NODISCARD inline bool															areAllTemplateInstantiationsIndexed()									const	noexcept;
+
 			/**
 			*	@brief Append a template parameter to _templateParameters.
 			* 
@@ -65,6 +100,8 @@ namespace rfk
 			*	@return _templateInstantiations.
 			*/
 			RFK_NODISCARD inline std::unordered_set<ClassTemplateInstantiation const*> const&	getTemplateInstantiations()												const	noexcept;
+
+		friend internal::MemoryFootprintCollector;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.inl"
@@ -18,6 +18,74 @@ inline void ClassTemplate::ClassTemplateImpl::addTemplateInstantiation(ClassTemp
 inline void ClassTemplate::ClassTemplateImpl::removeTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
 {
 	_templateInstantiations.erase(&instantiation);
+
+	//The template arguments might already be destroyed at this point, so use the hash computed when the instantiation was indexed
+	auto hashIt = _templateArgumentsHashes.find(&instantiation);
+
+	if (hashIt != _templateArgumentsHashes.end())
+	{
+		auto range = _templateInstantiationsByArguments.equal_range(hashIt->second);
+
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second == &instantiation)
+			{
+				_templateInstantiationsByArguments.erase(it);
+				break;
+			}
+		}
+
+		_templateArgumentsHashes.erase(hashIt);
+	}
+}
+
+inline void ClassTemplate::ClassTemplateImpl::indexTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
+{
+	std::vector<TemplateArgument const*> args;
+	args.reserve(instantiation.getTemplateArgumentsCount());
+
+	for (std::size_t i = 0u; i < instantiation.getTemplateArgumentsCount(); i++)
+	{
+		args.push_back(&instantiation.getTemplateArgumentAt(i));
+	}
+
+	std::size_t hash = TemplateArgumentHash()(args.data(), args.size());
+
+	if (_templateArgumentsHashes.emplace(&instantiation, hash).second)
+	{
+		_templateInstantiationsByArguments.emplace(hash, &instantiation);
+	}
+}
+
+inline ClassTemplateInstantiation const* ClassTemplate::ClassTemplateImpl::getIndexedTemplateInstantiation(TemplateArgument const** args, std::size_t argsCount) const noexcept
+{
+	auto range = _templateInstantiationsByArguments.equal_range(TemplateArgumentHash()(args, argsCount));
+
+	for (auto it = range.first; it != range.second; it++)
+	{
+		ClassTemplateInstantiation const* instantiation = it->second;
+
+		if (instantiation->getTemplateArgumentsCount() == argsCount)
+		{
+			std::size_t i = 0u;
+			while (i < argsCount && instantiation->getTemplateArgumentAt(i) == *args[i])
+			{
+				i++;
+			}
+
+			if (i == argsCount)
+			{
+				return instantiation;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+inline bool ClassTemplate::ClassTemplateImpl::areAllTemplateInstantiationsIndexed() const noexcept
+{
+	return _templateArgumentsHashes.size() == _templateInstantiations.size();
 }
 
 inline void ClassTemplate::ClassTemplateImpl::addTemplateParameter(TemplateParameter const& param) noexcept
@@ -8,6 +8,8 @@
 inline internal::ClassTemplateInstantiationRegistererImpl::ClassTemplateInstantiationRegistererImpl(ClassTemplateInstantiation const& instantiation) noexcept:
 	_registeredClassTemplateInstantiation{instantiation}
 {
+	RFK_TRACE_REGISTRATION_SCOPE(ClassTemplateInstantiationRegisterer, instantiation.getName(), nullptr);
+
 	Database::getInstance()._pimpl->registerEntityIdRecursive(instantiation);
 }
 
@@ -0,0 +1,53 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+namespace rfk
+{
+	//Forward declaration
+	class TemplateArgument;
+
+	struct TemplateArgumentHash
+	{
+		private:
+			/**
+			*	@brief Mix a value into a hash.
+			* 
+			*	@param seed		The hash to mix the value into.
+			*	@param value	The value to mix.
+			* 
+			*	@return The mixed hash.
+			*/
+			static std::size_t combineHash(std::size_t seed,
+										   std::size_t value)	noexcept;
+
+		public:
+			/**
+			*	@brief	Compute the hash of a template argument.
+			*			2 template arguments comparing equal with TemplateArgument::operator== always have the same hash.
+			* 
+			*	@param argument The template argument to hash.
+			* 
+			*	@return The hash of the template argument.
+			*/
+			std::size_t operator()(TemplateArgument const& argument)	const	noexcept;
+
+			/**
+			*	@brief Compute the hash of a list of template arguments. None of the arguments can be nullptr.
+			* 
+			*	@param args			Pointer to the first argument pointer.
+			*	@param argsCount	Number of arguments in the list.
+			* 
+			*	@return The hash of the template arguments list.
+			*/
+			std::size_t operator()(TemplateArgument const* const*	args,
+								   std::size_t						argsCount)	const	noexcept;
+	};
+}
@@ -28,6 +28,10 @@
 #include "Refureku/TypeInfo/Functions/Method.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
+#include "Refureku/Misc/FlatPtrSet.h"
+#include "Refureku/Misc/Algorithm.h"
+#include "Refureku/TypeInfo/Query/EntityNameIndex.h"
+#include "Refureku/TypeInfo/InstrumentationRegistry.h"
 
 namespace rfk
 {
@@ -43,6 +47,10 @@ namespace rfk
 			using FunctionsByName				= std::unordered_multiset<Function const*, EntityPtrNameHash, EntityPtrNameEqual>;
 			using FundamentalArchetypesByName	= std::unordered_set<FundamentalArchetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
 			using GenNamespaces					= std::unordered_map<std::size_t, SharedPtr<Namespace>>;
+			using EntitiesByPropertyArchetype	= std::unordered_map<Struct const*, FlatPtrSet<Entity>>;
+
+			/** Number of consecutive _entitiesById buckets processed as a single chunk by the parallel traversals. */
+			static constexpr std::size_t		bucketsPerEntityChunk	= 256u;
 			
 		private:
 			/** Collection of all registered entities hashed by Id.  */
@@ -66,12 +74,40 @@ namespace rfk
 			/** Collection of all file level functions hashed by name. */
 			FunctionsByName				_fileLevelFunctionsByName;
 
+			/** Pointers contained in _fileLevelNamespacesByName stored contiguously. */
+			FlatPtrSet<Namespace>			_flatFileLevelNamespaces;
+
+			/** Pointers contained in _fileLevelStructsByName stored contiguously. */
+			FlatPtrSet<Struct>			_flatFileLevelStructs;
+
+			/** Pointers contained in _fileLevelClassesByName stored contiguously. */
+			FlatPtrSet<Struct>			_flatFileLevelClasses;
+
+			/** Pointers contained in _fileLevelEnumsByName stored contiguously. */
+			FlatPtrSet<Enum>			_flatFileLevelEnums;
+
+			/** Pointers contained in _fileLevelVariablesByName stored contiguously. */
+			FlatPtrSet<Variable>			_flatFileLevelVariables;
+
+			/** Pointers contained in _fileLevelFunctionsByName stored contiguously. */
+			FlatPtrSet<Function>			_flatFileLevelFunctions;
+
 			/** Collection of all fundamental archetypes hashed by name. */
 			FundamentalArchetypesByName	_fundamentalArchetypes;
 
 			/** Collection of namespace objects generated by the database. */
 			GenNamespaces				_generatedNamespaces;
 
+			/**
+			*	Registered entities indexed by the archetype of each property they carry.
+			*	Properties are indexed when the entity is registered, so properties added to an entity after its registration are not indexed.
+			*	Namespaces are never indexed since their properties are merged from their fragments after the namespace registration.
+			*/
+			EntitiesByPropertyArchetype	_entitiesByPropertyArchetype;
+
+			/** Name index of all registered entities, built by the first name prefix query. */
+			internal::EntityNameIndex	_nameIndex;
+
 			/**
 			*	@brief Register an entity to the database.
 			*	
@@ -79,6 +115,20 @@ namespace rfk
 			*/
 			inline void		registerEntityId(Entity const& entity)									noexcept;
 
+			/**
+			*	@brief Add an entity to the property index for each property it carries.
+			*	
+			*	@param entity The entity to index.
+			*/
+			inline void		registerEntityProperties(Entity const& entity)							noexcept;
+
+			/**
+			*	@brief Remove an entity from the property index.
+			*	
+			*	@param entity The entity to remove from the index.
+			*/
+			inline void		unregisterEntityProperties(Entity const& entity)						noexcept;
+
 			/**
 			*	@brief Register all sub entities of an entity to the database.
 			*	
@@ -128,6 +178,25 @@ namespace rfk
 			*/
 			inline void		unregisterEnumSubEntities(Enum const& e)								noexcept;
 
+			/**
+			*	@brief Compute the number of entries an entity and all its sub entities take in the _entitiesById set once registered.
+			*	
+			*	@param entity The root entity.
+			*	
+			*	@return The number of ids registered for the entity and its sub entities.
+			*/
+			RFK_NODISCARD inline static
+				std::size_t	computeRegisteredIdsCount(Entity const& entity)							noexcept;
+
+			/**
+			*	@brief Reserve all containers before registering the provided file level entities.
+			*	
+			*	@param entities			Pointer to the first file level entity of the batch.
+			*	@param entitiesCount	Number of file level entities in the batch.
+			*/
+			inline void		reserveFileLevelEntities(Entity const* const*	entities,
+													 std::size_t			entitiesCount)					noexcept;
+
 		public:
 			DatabaseImpl()	= default;
 			~DatabaseImpl()	= default;
@@ -162,6 +231,27 @@ namespace rfk
 			*/
 			inline void							unregisterEntityRecursive(Entity const&	entity)							noexcept;
 
+			/**
+			*	@brief	Register a batch of file level entities as well as all their sub entities.
+			*			All the database containers are reserved once for the whole batch before registering any entity.
+			*	
+			*	@param entities			Pointer to the first file level entity of the batch.
+			*	@param entitiesCount	Number of file level entities in the batch.
+			*/
+			inline void							registerFileLevelEntities(Entity const* const*	entities,
+																		  std::size_t			entitiesCount)				noexcept;
+
+			/**
+			*	@brief	Unregister a batch of file level entities as well as all their sub entities.
+			*			Entities are unregistered in the reverse order so that removing entities
+			*			registered by registerFileLevelEntities only pops the back of the flat containers.
+			*	
+			*	@param entities			Pointer to the first file level entity of the batch.
+			*	@param entitiesCount	Number of file level entities in the batch.
+			*/
+			inline void							unregisterFileLevelEntities(Entity const* const*	entities,
+																			std::size_t				entitiesCount)			noexcept;
+
 			/**
 			*	@brief	Remove a namespace from the database if it is not referenced by other namespace fragments.
 			*
@@ -192,7 +282,30 @@ namespace rfk
 			RFK_NODISCARD inline VariablesByName const&				getFileLevelVariablesByName()		const	noexcept;
 			RFK_NODISCARD inline FunctionsByName const&				getFileLevelFunctionsByName()		const	noexcept;
 			RFK_NODISCARD inline FundamentalArchetypesByName const&	getFundamentalArchetypesByName()	const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Namespace> const&		getFlatFileLevelNamespaces()		const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Struct> const&		getFlatFileLevelStructs()		const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Struct> const&		getFlatFileLevelClasses()		const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Enum> const&		getFlatFileLevelEnums()		const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Variable> const&		getFlatFileLevelVariables()		const	noexcept;
+			RFK_NODISCARD inline FlatPtrSet<Function> const&		getFlatFileLevelFunctions()		const	noexcept;
 			RFK_NODISCARD inline GenNamespaces const&				getGeneratedNamespaces()			const	noexcept;
+			RFK_NODISCARD inline EntitiesByPropertyArchetype const&	getEntitiesByPropertyArchetype()	const	noexcept;
+
+			/**
+			*	@brief Get the registered entities carrying a property of exactly the provided archetype.
+			* 
+			*	@param propertyArchetype Archetype of the property.
+			* 
+			*	@return The set of entities carrying such a property, nullptr if there is none.
+			*/
+			RFK_NODISCARD inline FlatPtrSet<Entity> const*			getEntitiesWithProperty(Struct const& propertyArchetype)	const	noexcept;
+
+			/**
+			*	@brief Get the name index of the registered entities.
+			* 
+			*	@return The name index.
+			*/
+			RFK_NODISCARD inline internal::EntityNameIndex const&	getNameIndex()										const	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/DatabaseImpl.inl"
@@ -13,29 +13,29 @@ inline void Database::DatabaseImpl::registerFileLevelEntityRecursive(Entity cons
 	switch (entity.getKind())
 	{
 		case EEntityKind::NamespaceFragment:
-			_fileLevelNamespacesByName.emplace(reinterpret_cast<Namespace const*>(&static_cast<NamespaceFragment const&>(entity).getMergedNamespace()));
+			_flatFileLevelNamespaces.addSynced(_fileLevelNamespacesByName, reinterpret_cast<Namespace const*>(&static_cast<NamespaceFragment const&>(entity).getMergedNamespace()));
 			
 			registerSubEntitesId(entity);
 			return;	
 
 		case EEntityKind::Struct:
-			_fileLevelStructsByName.emplace(reinterpret_cast<Struct const*>(&entity));
+			_flatFileLevelStructs.addSynced(_fileLevelStructsByName, reinterpret_cast<Struct const*>(&entity));
 			break;
 
 		case EEntityKind::Class:
-			_fileLevelClassesByName.emplace(reinterpret_cast<Class const*>(&entity));
+			_flatFileLevelClasses.addSynced(_fileLevelClassesByName, reinterpret_cast<Class const*>(&entity));
 			break;
 
 		case EEntityKind::Enum:
-			_fileLevelEnumsByName.emplace(reinterpret_cast<Enum const*>(&entity));
+			_flatFileLevelEnums.addSynced(_fileLevelEnumsByName, reinterpret_cast<Enum const*>(&entity));
 			break;
 
 		case EEntityKind::Variable:
-			_fileLevelVariablesByName.emplace(reinterpret_cast<Variable const*>(&entity));
+			_flatFileLevelVariables.addSynced(_fileLevelVariablesByName, reinterpret_cast<Variable const*>(&entity));
 			break;
 
 		case EEntityKind::Function:
-			_fileLevelFunctionsByName.emplace(reinterpret_cast<Function const*>(&entity));
+			_flatFileLevelFunctions.addSynced(_fileLevelFunctionsByName, reinterpret_cast<Function const*>(&entity));
 			break;
 
 		case EEntityKind::FundamentalArchetype:
@@ -114,7 +114,29 @@ inline void Database::DatabaseImpl::unregisterEntityRecursive(Entity const& enti
 inline void Database::DatabaseImpl::unregisterEntity(Entity const& entity) noexcept
 {
 	//Remove this entity from the list of registered entity ids
-	_entitiesById.erase(&entity);
+	auto it = _entitiesById.find(&entity);
+
+	if (it != _entitiesById.end())
+	{
+		//Entities are hashed by id, so the registered entity might be another instance with the same id
+		Entity const& registeredEntity = **it;
+
+		_entitiesById.erase(it);
+		unregisterEntityProperties(registeredEntity);
+		_nameIndex.onEntityUnregistered(registeredEntity);
+
+#if RFK_INSTRUMENTATION
+		if (&registeredEntity != &entity)
+		{
+			internal::InstrumentationRegistry::getInstance().forget(registeredEntity);
+		}
+#endif
+	}
+
+#if RFK_INSTRUMENTATION
+	//Unregistered entities might be destroyed, so their counters must not be reported anymore
+	internal::InstrumentationRegistry::getInstance().forget(entity);
+#endif
 
 	//Remove the entity from the suitable file level entities collection if applicable
 	if (entity.getOuterEntity() == nullptr)
@@ -122,27 +144,27 @@ inline void Database::DatabaseImpl::unregisterEntity(Entity const& entity) noexc
 		switch (entity.getKind())
 		{
 			case EEntityKind::Namespace:
-				_fileLevelNamespacesByName.erase(reinterpret_cast<Namespace const*>(&entity));
+				_flatFileLevelNamespaces.removeSynced(_fileLevelNamespacesByName, reinterpret_cast<Namespace const*>(&entity));
 				break;
 
 			case EEntityKind::Struct:
-				_fileLevelStructsByName.erase(reinterpret_cast<Struct const*>(&entity));
+				_flatFileLevelStructs.removeSynced(_fileLevelStructsByName, reinterpret_cast<Struct const*>(&entity));
 				break;
 
 			case EEntityKind::Class:
-				_fileLevelClassesByName.erase(reinterpret_cast<Class const*>(&entity));
+				_flatFileLevelClasses.removeSynced(_fileLevelClassesByName, reinterpret_cast<Class const*>(&entity));
 				break;
 
 			case EEntityKind::Enum:
-				_fileLevelEnumsByName.erase(reinterpret_cast<Enum const*>(&entity));
+				_flatFileLevelEnums.removeSynced(_fileLevelEnumsByName, reinterpret_cast<Enum const*>(&entity));
 				break;
 
 			case EEntityKind::Variable:
-				_fileLevelVariablesByName.erase(reinterpret_cast<Variable const*>(&entity));
+				_flatFileLevelVariables.removeSynced(_fileLevelVariablesByName, reinterpret_cast<Variable const*>(&entity));
 				break;
 
 			case EEntityKind::Function:
-				_fileLevelFunctionsByName.erase(reinterpret_cast<Function const*>(&entity));
+				_flatFileLevelFunctions.removeSynced(_fileLevelFunctionsByName, reinterpret_cast<Function const*>(&entity));
 				break;
 
 			case EEntityKind::FundamentalArchetype:
@@ -182,6 +204,47 @@ inline void Database::DatabaseImpl::registerEntityId(Entity const& entity) noexc
 		std::cout << "[Refureku] WARNING: Double registration detected: (" << entity.getId() << ", " << entity.getName() <<
 			") collides with entity: (" << foundEntity->getId() << ", " << foundEntity->getName() << ")" << std::endl;
 	}
+	else
+	{
+		registerEntityProperties(entity);
+		_nameIndex.onEntityRegistered(entity);
+	}
+}
+
+inline void Database::DatabaseImpl::registerEntityProperties(Entity const& entity) noexcept
+{
+	if (entity.getKind() == EEntityKind::Namespace)
+	{
+		return;
+	}
+
+	for (std::size_t i = 0u; i < entity.getPropertiesCount(); i++)
+	{
+		_entitiesByPropertyArchetype[&entity.getPropertyAt(i)->getArchetype()].add(&entity);
+	}
+}
+
+inline void Database::DatabaseImpl::unregisterEntityProperties(Entity const& entity) noexcept
+{
+	if (entity.getKind() == EEntityKind::Namespace)
+	{
+		return;
+	}
+
+	for (std::size_t i = 0u; i < entity.getPropertiesCount(); i++)
+	{
+		auto it = _entitiesByPropertyArchetype.find(&entity.getPropertyAt(i)->getArchetype());
+
+		if (it != _entitiesByPropertyArchetype.end())
+		{
+			it->second.remove(&entity);
+
+			if (it->second.getSpan().size() == 0u)
+			{
+				_entitiesByPropertyArchetype.erase(it);
+			}
+		}
+	}
 }
 
 inline void Database::DatabaseImpl::registerSubEntitesId(Entity const& entity) noexcept
@@ -365,6 +428,136 @@ inline void Database::DatabaseImpl::unregisterEnumSubEntities(Enum const& e) noe
 					   }, this);
 }
 
+inline std::size_t Database::DatabaseImpl::computeRegisteredIdsCount(Entity const& entity) noexcept
+{
+	std::size_t result = 0u;
+
+	switch (entity.getKind())
+	{
+		case EEntityKind::NamespaceFragment:
+			//Namespace fragments are not registered by id themselves, only their nested entities are
+			static_cast<NamespaceFragment const&>(entity).foreachNestedEntity([](Entity const& nestedEntity, void* userData)
+																			  {
+																				  *reinterpret_cast<std::size_t*>(userData) += computeRegisteredIdsCount(nestedEntity);
+
+																				  return true;
+																			  }, &result);
+			return result;
+
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+		{
+			Struct const& s = static_cast<Struct const&>(entity);
+
+			result = s.getFieldsCount() + s.getStaticFieldsCount() + s.getMethodsCount() + s.getStaticMethodsCount();
+
+			s.foreachNestedArchetype([](Archetype const& archetype, void* userData)
+									 {
+										 *reinterpret_cast<std::size_t*>(userData) += computeRegisteredIdsCount(archetype);
+
+										 return true;
+									 }, &result);
+			break;
+		}
+
+		case EEntityKind::Enum:
+			result = static_cast<Enum const&>(entity).getEnumValuesCount();
+			break;
+
+		default:
+			break;
+	}
+
+	//Count the entity itself
+	return result + 1u;
+}
+
+inline void Database::DatabaseImpl::reserveFileLevelEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	std::size_t idsCount		= 0u;
+	std::size_t namespacesCount	= 0u;
+	std::size_t structsCount	= 0u;
+	std::size_t classesCount	= 0u;
+	std::size_t enumsCount		= 0u;
+	std::size_t variablesCount	= 0u;
+	std::size_t functionsCount	= 0u;
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		idsCount += computeRegisteredIdsCount(*entities[i]);
+
+		switch (entities[i]->getKind())
+		{
+			case EEntityKind::NamespaceFragment:
+				namespacesCount++;
+				break;
+
+			case EEntityKind::Struct:
+				structsCount++;
+				break;
+
+			case EEntityKind::Class:
+				classesCount++;
+				break;
+
+			case EEntityKind::Enum:
+				enumsCount++;
+				break;
+
+			case EEntityKind::Variable:
+				variablesCount++;
+				break;
+
+			case EEntityKind::Function:
+				functionsCount++;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	//Hash sets and flat sets are kept in sync so the hash set size is also the flat set size
+	Algorithm::reserveAdditional(_entitiesById, idsCount);
+
+	Algorithm::reserveAdditional(_fileLevelNamespacesByName, namespacesCount);
+	_flatFileLevelNamespaces.reserve(_fileLevelNamespacesByName.size() + namespacesCount);
+
+	Algorithm::reserveAdditional(_fileLevelStructsByName, structsCount);
+	_flatFileLevelStructs.reserve(_fileLevelStructsByName.size() + structsCount);
+
+	Algorithm::reserveAdditional(_fileLevelClassesByName, classesCount);
+	_flatFileLevelClasses.reserve(_fileLevelClassesByName.size() + classesCount);
+
+	Algorithm::reserveAdditional(_fileLevelEnumsByName, enumsCount);
+	_flatFileLevelEnums.reserve(_fileLevelEnumsByName.size() + enumsCount);
+
+	Algorithm::reserveAdditional(_fileLevelVariablesByName, variablesCount);
+	_flatFileLevelVariables.reserve(_fileLevelVariablesByName.size() + variablesCount);
+
+	Algorithm::reserveAdditional(_fileLevelFunctionsByName, functionsCount);
+	_flatFileLevelFunctions.reserve(_fileLevelFunctionsByName.size() + functionsCount);
+}
+
+inline void Database::DatabaseImpl::registerFileLevelEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	reserveFileLevelEntities(entities, entitiesCount);
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		registerFileLevelEntityRecursive(*entities[i]);
+	}
+}
+
+inline void Database::DatabaseImpl::unregisterFileLevelEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	for (std::size_t i = entitiesCount; i > 0u; i--)
+	{
+		unregisterEntityRecursive(*entities[i - 1u]);
+	}
+}
+
 inline void Database::DatabaseImpl::releaseNamespaceIfUnreferenced(SharedPtr<Namespace> const& npPtr) noexcept
 {
 	assert(npPtr.use_count() >= 2);
@@ -446,4 +639,51 @@ inline Database::DatabaseImpl::FunctionsByName const& Database::DatabaseImpl::ge
 inline Database::DatabaseImpl::GenNamespaces const& Database::DatabaseImpl::getGeneratedNamespaces() const noexcept
 {
 	return _generatedNamespaces;
+}
+
+inline Database::DatabaseImpl::EntitiesByPropertyArchetype const& Database::DatabaseImpl::getEntitiesByPropertyArchetype() const noexcept
+{
+	return _entitiesByPropertyArchetype;
+}
+
+inline FlatPtrSet<Namespace> const& Database::DatabaseImpl::getFlatFileLevelNamespaces() const noexcept
+{
+	return _flatFileLevelNamespaces;
+}
+
+inline FlatPtrSet<Struct> const& Database::DatabaseImpl::getFlatFileLevelStructs() const noexcept
+{
+	return _flatFileLevelStructs;
+}
+
+inline FlatPtrSet<Struct> const& Database::DatabaseImpl::getFlatFileLevelClasses() const noexcept
+{
+	return _flatFileLevelClasses;
+}
+
+inline FlatPtrSet<Enum> const& Database::DatabaseImpl::getFlatFileLevelEnums() const noexcept
+{
+	return _flatFileLevelEnums;
+}
+
+inline FlatPtrSet<Variable> const& Database::DatabaseImpl::getFlatFileLevelVariables() const noexcept
+{
+	return _flatFileLevelVariables;
+}
+
+inline FlatPtrSet<Function> const& Database::DatabaseImpl::getFlatFileLevelFunctions() const noexcept
+{
+	return _flatFileLevelFunctions;
+}
+
+inline FlatPtrSet<Entity> const* Database::DatabaseImpl::getEntitiesWithProperty(Struct const& propertyArchetype) const noexcept
+{
+	auto it = _entitiesByPropertyArchetype.find(&propertyArchetype);
+
+	return (it != _entitiesByPropertyArchetype.cend()) ? &it->second : nullptr;
+}
+
+inline internal::EntityNameIndex const& Database::DatabaseImpl::getNameIndex() const noexcept
+{
+	return _nameIndex;
 }
\ No newline at end of file
@@ -11,6 +11,8 @@ inline internal::DefaultEntityRegistererImpl::DefaultEntityRegistererImpl(Entity
 	//Entities which are not at file level should not be registered
 	assert(entity.getOuterEntity() == nullptr);
 
+	RFK_TRACE_REGISTRATION_SCOPE(DefaultEntityRegisterer, entity.getName(), nullptr);
+
 	//Register to database
 	Database::getInstance()._pimpl->registerFileLevelEntityRecursive(_registeredEntity);
 }
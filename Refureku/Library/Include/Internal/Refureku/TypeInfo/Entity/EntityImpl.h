@@ -122,4 +122,8 @@ namespace rfk
 	};
 
 	#include "Refureku/TypeInfo/Entity/EntityImpl.inl"
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Entity/EntityHotGetters.inl"
+#endif
\ No newline at end of file
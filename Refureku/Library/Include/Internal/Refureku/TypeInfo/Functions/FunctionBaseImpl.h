@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "Refureku/TypeInfo/Functions/FunctionBase.h"
 #include "Refureku/TypeInfo/Entity/EntityImpl.h"
 #include "Refureku/Misc/UniquePtr.h"
@@ -22,6 +24,9 @@ namespace rfk
 			/** Handle pointing to the actual function in memory. */
 			UniquePtr<ICallable>			_internalFunction;
 
+			/** Function called when this function is invoked: _internalFunction, or the function of a hot reloaded module. */
+			std::atomic<ICallable*>			_calledFunction;
+
 			/** Parameters of this function. */
 			std::vector<FunctionParameter>	_parameters;
 
@@ -56,12 +61,25 @@ namespace rfk
 			RFK_NODISCARD inline Type const&							getReturnType()									const	noexcept;
 
 			/**
-			*	@brief Getter for the field _internalFunction.
+			*	@brief Getter for the field _calledFunction.
 			* 
-			*	@return _internalFunction.
+			*	@return _calledFunction.
 			*/
 			RFK_NODISCARD inline ICallable*								getInternalFunction()							const	noexcept;
 
+			/**
+			*	@brief	Atomically replace the function called when this function is invoked.
+			*			The provided function is not owned and must outlive the patch.
+			* 
+			*	@param function Function to call instead of _internalFunction.
+			*/
+			inline void													patchInternalFunction(ICallable* function)				noexcept;
+
+			/**
+			*	@brief Atomically restore _internalFunction as the function called when this function is invoked.
+			*/
+			inline void													restoreInternalFunction()								noexcept;
+
 			/**
 			*	@brief Getter for the field _parameters.
 			* 
@@ -9,7 +9,8 @@ inline FunctionBase::FunctionBaseImpl::FunctionBaseImpl(char const* name, std::s
 														   Type const& returnType, ICallable* internalFunction, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, kind, outerEntity),
 	_returnType{returnType},
-	_internalFunction{internalFunction}
+	_internalFunction{internalFunction},
+	_calledFunction{internalFunction}
 {
 }
 
@@ -25,7 +26,18 @@ inline Type const& FunctionBase::FunctionBaseImpl::getReturnType() const noexcep
 
 inline ICallable* FunctionBase::FunctionBaseImpl::getInternalFunction() const noexcept
 {
-	return _internalFunction.get();
+	//Acquire so that the callable of a hot reloaded module is fully visible to the invoking thread
+	return _calledFunction.load(std::memory_order_acquire);
+}
+
+inline void FunctionBase::FunctionBaseImpl::patchInternalFunction(ICallable* function) noexcept
+{
+	_calledFunction.store(function, std::memory_order_release);
+}
+
+inline void FunctionBase::FunctionBaseImpl::restoreInternalFunction() noexcept
+{
+	_calledFunction.store(_internalFunction.get(), std::memory_order_release);
 }
 
 inline std::vector<FunctionParameter> const& FunctionBase::FunctionBaseImpl::getParameters() const noexcept
@@ -21,17 +21,17 @@ namespace rfk
 			Type const&	_type;
 
 		public:
-			FunctionParameterImpl(char const*		name,
-								  std::size_t		id,
-								  Type const&	type,
-								  Entity const*	outerEntity)	noexcept;
+			inline FunctionParameterImpl(char const*		name,
+										 std::size_t		id,
+										 Type const&	type,
+										 Entity const*	outerEntity)	noexcept;
 
 			/**
 			*	@brief Getter for the field _type.
 			* 
 			*	@return _type;
 			*/
-			RFK_NODISCARD Type const& getType()	const	noexcept;
+			RFK_NODISCARD inline Type const& getType()	const	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/Functions/FunctionParameterImpl.inl"
@@ -5,13 +5,13 @@
 *	See the LICENSE.md file for full license details.
 */
 
-FunctionParameter::FunctionParameterImpl::FunctionParameterImpl(char const* name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
+inline FunctionParameter::FunctionParameterImpl::FunctionParameterImpl(char const* name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, EEntityKind::Undefined /* TODO: Add new entity kind for parameters */, outerEntity),
 	_type{type}
 {
 }
 
-Type const& FunctionParameter::FunctionParameterImpl::getType() const noexcept
+inline Type const& FunctionParameter::FunctionParameterImpl::getType() const noexcept
 {
 	return _type;
 }
\ No newline at end of file
@@ -0,0 +1,281 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>		//std::nothrow
+#include <mutex>
+#include <memory>	//std::unique_ptr
+#include <vector>
+#include <atomic>
+#include <thread>	//std::this_thread::get_id
+#include <cstddef>	//std::max_align_t
+#include <algorithm>	//std::max
+
+#include "Refureku/TypeInfo/Functions/MethodCommandBuffer.h"
+
+namespace rfk
+{
+	class internal::MethodCommandBufferImpl final
+	{
+		private:
+			/** Header of a group of consecutive commands calling the same function with the same argument types. */
+			struct GroupHeader
+			{
+				/** Function called by the commands. */
+				FunctionBase const*						function;
+
+				/** Replayer of the commands type. */
+				MethodCommandBuffer::Replayer			replayer;
+
+				/** Destroyer of the commands type. */
+				MethodCommandBuffer::Destroyer			destroyer;
+
+				/** Size of a command in bytes. */
+				std::size_t								commandSize;
+
+				/** Number of commands in the group. */
+				std::size_t								commandsCount;
+			};
+
+			/** Memory block of a byte stream, filled with groups. */
+			struct Block
+			{
+				/** Memory of the block, aligned to std::max_align_t. */
+				unsigned char*	memory;
+
+				/** Size of the memory in bytes. */
+				std::size_t		capacity;
+
+				/** Number of bytes used by the groups. */
+				std::size_t		size;
+			};
+
+			/** Commands recorded by a thread. */
+			struct ThreadStream
+			{
+				/** Id of the thread recording in the stream. */
+				std::thread::id		ownerThreadId;
+
+				/** Mutex protecting the stream from concurrent executions. */
+				std::mutex			mutex;
+
+				/** Blocks holding the recorded commands, in recording order. */
+				std::vector<Block>	blocks;
+
+				/** Empty blocks reused when the stream needs more memory. */
+				std::vector<Block>	spareBlocks;
+
+				/** Last group of the last block, nullptr if there is none. */
+				GroupHeader*		lastGroup		= nullptr;
+
+				/** Number of recorded commands. */
+				std::size_t			commandsCount	= 0u;
+			};
+
+			/** Stream of a buffer cached by a thread. */
+			struct CachedThreadStream
+			{
+				/** Id of the buffer owning the stream, 0 if none. */
+				uint64			bufferId;
+
+				/** Stream of the thread in the buffer. */
+				ThreadStream*	stream;
+			};
+
+			/** Number of buffer streams cached by each thread. */
+			static constexpr std::size_t			_threadStreamsCacheSize = 8u;
+
+			/**
+			*	Streams of the last buffers used by a thread.
+			*	Its size is fixed so that the entries of destroyed buffers are evicted instead of accumulating.
+			*	Trivial so that its thread_local instance is accessed without any initialization guard.
+			*/
+			struct ThreadStreamsCache
+			{
+				/** Cached streams. Buffer ids are never reused, so the entries of destroyed buffers never match again. */
+				CachedThreadStream	entries[_threadStreamsCacheSize];
+
+				/** Index of the entry of the last buffer used by the thread. */
+				std::size_t			lastEntryIndex;
+
+				/** Index of the next entry replaced by a missing stream. */
+				std::size_t			nextEntryIndex;
+			};
+
+			/** Size of a group header rounded up so that the commands following it are aligned. */
+			static constexpr std::size_t			_groupHeaderSize = (sizeof(GroupHeader) + alignof(std::max_align_t) - 1u) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+			/** Unique id of the buffer, used to find the buffer stream of each thread. */
+			uint64 const							_id;
+
+			/** Minimum size of a block in bytes. */
+			std::size_t const						_blockSize;
+
+			/** Mutex protecting _streams. */
+			mutable std::mutex						_streamsMutex;
+
+			/** Streams of all the threads which recorded commands in the buffer. */
+			std::vector<std::unique_ptr<ThreadStream>>	_streams;
+
+			/**
+			*	@brief Get the streams of the last buffers used by the calling thread.
+			*
+			*	@return The streams cache of the calling thread.
+			*/
+			static inline ThreadStreamsCache&	getThreadStreamsCache()						noexcept;
+
+			/**
+			*	@brief Get a new unique buffer id.
+			*
+			*	@return A new buffer id.
+			*/
+			static inline uint64			generateId()									noexcept;
+
+			/**
+			*	@brief Round a block offset up so that a group header can be written at that offset.
+			*
+			*	@param offset Offset in bytes in a block.
+			*
+			*	@return The aligned offset.
+			*/
+			static inline std::size_t		alignGroupOffset(std::size_t offset)			noexcept;
+
+			/**
+			*	@brief Destroy the commands of the groups of a block starting from an offset, without calling them.
+			*
+			*	@param block		Block holding the groups.
+			*	@param groupOffset	Offset of the first group to destroy in the block.
+			*/
+			static inline void				destroyGroups(Block const&	block,
+														  std::size_t	groupOffset)		noexcept;
+
+			/**
+			*	@brief Get the stream of this buffer for the calling thread.
+			*
+			*	@return The stream of this buffer for the calling thread.
+			*/
+			inline ThreadStream&			getThreadStream()								noexcept;
+
+			/**
+			*	@brief	Find or create the stream of this buffer for the calling thread, and make it the last used one.
+			*			The stream is looked up in the thread cache first, then among the streams of this buffer.
+			*
+			*	@return The stream of this buffer for the calling thread.
+			*/
+			inline ThreadStream&			findThreadStream()								noexcept;
+
+			/**
+			*	@brief	Append a block of at least minSize bytes to a stream, reusing a spare block if possible.
+			*			The stream must be locked.
+			*
+			*	@param stream	Stream receiving the block.
+			*	@param minSize	Minimum size of the block in bytes.
+			*
+			*	@return The appended block, nullptr if a new block could not be allocated.
+			*/
+			inline Block*					appendBlock(ThreadStream&	stream,
+														std::size_t		minSize)			noexcept;
+
+			/**
+			*	@brief	Take the blocks of a stream, leaving it empty.
+			*
+			*	@param stream			Stream to take the blocks from.
+			*	@param out_blocks		Blocks of the stream.
+			*	@param out_commandsCount	Number of commands in the blocks.
+			*/
+			static inline void				takeBlocks(ThreadStream&		stream,
+													   std::vector<Block>&	out_blocks,
+													   std::size_t&			out_commandsCount)	noexcept;
+
+			/**
+			*	@brief Give emptied blocks back to the spare blocks of a stream.
+			*
+			*	@param stream Stream the blocks were taken from.
+			*	@param blocks Blocks to give back. Their commands must already be destroyed.
+			*/
+			static inline void				giveBackBlocks(ThreadStream&		stream,
+														   std::vector<Block>&	blocks)		noexcept;
+
+			/**
+			*	@brief	Get the memory receiving the next command of a stream.
+			*			The command is appended to the last group of the stream if it calls the same function with the same replayer,
+			*			otherwise a new group is started once the signature is checked.
+			*			The stream must be locked.
+			*
+			*	@param stream			Stream receiving the command.
+			*	@param function			Function called by the command.
+			*	@param replayer			Replayer of the command type.
+			*	@param destroyer		Destroyer of the command type.
+			*	@param signatureChecker	Signature checker of the command type.
+			*	@param commandSize		Size of the command in bytes.
+			*
+			*	@return The memory receiving the command, nullptr if the signature doesn't match or if the memory could not be allocated.
+			*/
+			inline void*					reserveCommand(ThreadStream&							stream,
+														   FunctionBase const&					function,
+														   MethodCommandBuffer::Replayer		replayer,
+														   MethodCommandBuffer::Destroyer		destroyer,
+														   MethodCommandBuffer::SignatureChecker	signatureChecker,
+														   std::size_t							commandSize)	noexcept;
+
+			/**
+			*	@brief Get all the streams of the buffer.
+			*
+			*	@return All the streams of the buffer.
+			*/
+			inline std::vector<ThreadStream*>	getStreams()							const	noexcept;
+
+		public:
+			inline MethodCommandBufferImpl(std::size_t blockSize)	noexcept;
+			MethodCommandBufferImpl(MethodCommandBufferImpl const&)	= delete;
+			MethodCommandBufferImpl(MethodCommandBufferImpl&&)		= delete;
+			inline ~MethodCommandBufferImpl()						noexcept;
+
+			/**
+			*	@brief Construct a command in the stream of the calling thread.
+			*
+			*	@param function			Function called by the command.
+			*	@param replayer			Replayer of the command type.
+			*	@param destroyer		Destroyer of the command type.
+			*	@param signatureChecker	Signature checker of the command type.
+			*	@param commandSize		Size of the command in bytes.
+			*	@param constructor		Function constructing the command in the stream memory.
+			*	@param constructorData	Data forwarded to the constructor.
+			*
+			*	@return true if the command was constructed, false if the signature doesn't match or if the memory could not be allocated.
+			*/
+			inline bool						pushCommand(FunctionBase const&						function,
+														MethodCommandBuffer::Replayer			replayer,
+														MethodCommandBuffer::Destroyer			destroyer,
+														MethodCommandBuffer::SignatureChecker	signatureChecker,
+														std::size_t								commandSize,
+														MethodCommandBuffer::CommandConstructor	constructor,
+														void*									constructorData);
+
+			/**
+			*	@brief Execute and remove the commands of all the streams.
+			*
+			*	@return The number of executed commands.
+			*/
+			inline std::size_t				execute();
+
+			/**
+			*	@brief Destroy the commands of all the streams without executing them.
+			*/
+			inline void						clear()											noexcept;
+
+			/**
+			*	@brief Get the number of commands of all the streams.
+			*
+			*	@return The number of recorded commands.
+			*/
+			RFK_NODISCARD inline std::size_t	getCommandsCount()					const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Functions/MethodCommandBufferImpl.inl"
+}
\ No newline at end of file
@@ -0,0 +1,337 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline internal::MethodCommandBufferImpl::MethodCommandBufferImpl(std::size_t blockSize) noexcept:
+	_id{generateId()},
+	_blockSize{std::max(blockSize, _groupHeaderSize)}
+{
+}
+
+inline internal::MethodCommandBufferImpl::~MethodCommandBufferImpl() noexcept
+{
+	clear();
+
+	for (std::unique_ptr<ThreadStream> const& stream : _streams)
+	{
+		for (Block const& block : stream->spareBlocks)
+		{
+			::operator delete(block.memory);
+		}
+	}
+
+	//Free the cache entry of the calling thread right away, the entries of other threads are evicted as they use other buffers
+	for (CachedThreadStream& entry : getThreadStreamsCache().entries)
+	{
+		if (entry.bufferId == _id)
+		{
+			entry.bufferId	= 0u;
+			entry.stream	= nullptr;
+		}
+	}
+}
+
+inline internal::MethodCommandBufferImpl::ThreadStreamsCache& internal::MethodCommandBufferImpl::getThreadStreamsCache() noexcept
+{
+	thread_local ThreadStreamsCache threadStreamsCache{};
+
+	return threadStreamsCache;
+}
+
+inline uint64 internal::MethodCommandBufferImpl::generateId() noexcept
+{
+	//0 is reserved for "no buffer"
+	static std::atomic<uint64> nextId{1u};
+
+	return nextId.fetch_add(1u, std::memory_order_relaxed);
+}
+
+inline std::size_t internal::MethodCommandBufferImpl::alignGroupOffset(std::size_t offset) noexcept
+{
+	return (offset + alignof(std::max_align_t) - 1u) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+inline void internal::MethodCommandBufferImpl::destroyGroups(Block const& block, std::size_t groupOffset) noexcept
+{
+	while (groupOffset < block.size)
+	{
+		GroupHeader const* group = reinterpret_cast<GroupHeader const*>(block.memory + groupOffset);
+
+		group->destroyer(block.memory + groupOffset + _groupHeaderSize, group->commandsCount);
+
+		groupOffset = alignGroupOffset(groupOffset + _groupHeaderSize + group->commandsCount * group->commandSize);
+	}
+}
+
+inline internal::MethodCommandBufferImpl::ThreadStream& internal::MethodCommandBufferImpl::getThreadStream() noexcept
+{
+	ThreadStreamsCache&	threadStreamsCache	= getThreadStreamsCache();
+	CachedThreadStream&	lastEntry			= threadStreamsCache.entries[threadStreamsCache.lastEntryIndex];
+
+	//Fast path: the thread keeps recording in the same buffer
+	return (lastEntry.bufferId == _id) ? *lastEntry.stream : findThreadStream();
+}
+
+inline internal::MethodCommandBufferImpl::ThreadStream& internal::MethodCommandBufferImpl::findThreadStream() noexcept
+{
+	ThreadStreamsCache& threadStreamsCache = getThreadStreamsCache();
+
+	for (std::size_t i = 0u; i < _threadStreamsCacheSize; i++)
+	{
+		if (threadStreamsCache.entries[i].bufferId == _id)
+		{
+			threadStreamsCache.lastEntryIndex = i;
+
+			return *threadStreamsCache.entries[i].stream;
+		}
+	}
+
+	//The stream was evicted from the cache or was never created.
+	//A thread reusing the id of an exited thread records in the stream of the exited thread, which is not used anymore.
+	std::thread::id	threadId	= std::this_thread::get_id();
+	ThreadStream*	stream		= nullptr;
+
+	{
+		std::lock_guard lock(_streamsMutex);
+
+		for (std::unique_ptr<ThreadStream> const& threadStream : _streams)
+		{
+			if (threadStream->ownerThreadId == threadId)
+			{
+				stream = threadStream.get();
+				break;
+			}
+		}
+
+		if (stream == nullptr)
+		{
+			_streams.push_back(std::make_unique<ThreadStream>());
+
+			stream					= _streams.back().get();
+			stream->ownerThreadId	= threadId;
+		}
+	}
+
+	std::size_t entryIndex = threadStreamsCache.nextEntryIndex;
+
+	threadStreamsCache.entries[entryIndex]	= CachedThreadStream{_id, stream};
+	threadStreamsCache.lastEntryIndex		= entryIndex;
+	threadStreamsCache.nextEntryIndex		= (entryIndex + 1u) % _threadStreamsCacheSize;
+
+	return *stream;
+}
+
+inline internal::MethodCommandBufferImpl::Block* internal::MethodCommandBufferImpl::appendBlock(ThreadStream& stream, std::size_t minSize) noexcept
+{
+	if (!stream.spareBlocks.empty() && stream.spareBlocks.back().capacity >= minSize)
+	{
+		stream.blocks.push_back(stream.spareBlocks.back());
+		stream.spareBlocks.pop_back();
+	}
+	else
+	{
+		std::size_t		capacity	= std::max(_blockSize, minSize);
+		unsigned char*	memory		= static_cast<unsigned char*>(::operator new(capacity, std::nothrow));
+
+		if (memory == nullptr)
+		{
+			return nullptr;
+		}
+
+		stream.blocks.push_back(Block{memory, capacity, 0u});
+	}
+
+	return &stream.blocks.back();
+}
+
+inline void internal::MethodCommandBufferImpl::takeBlocks(ThreadStream& stream, std::vector<Block>& out_blocks, std::size_t& out_commandsCount) noexcept
+{
+	std::lock_guard lock(stream.mutex);
+
+	out_blocks.swap(stream.blocks);
+	out_commandsCount = stream.commandsCount;
+
+	stream.lastGroup		= nullptr;
+	stream.commandsCount	= 0u;
+}
+
+inline void internal::MethodCommandBufferImpl::giveBackBlocks(ThreadStream& stream, std::vector<Block>& blocks) noexcept
+{
+	std::lock_guard lock(stream.mutex);
+
+	for (Block& block : blocks)
+	{
+		block.size = 0u;
+		stream.spareBlocks.push_back(block);
+	}
+
+	blocks.clear();
+}
+
+inline std::vector<internal::MethodCommandBufferImpl::ThreadStream*> internal::MethodCommandBufferImpl::getStreams() const noexcept
+{
+	std::lock_guard lock(_streamsMutex);
+
+	std::vector<ThreadStream*> streams;
+	streams.reserve(_streams.size());
+
+	for (std::unique_ptr<ThreadStream> const& stream : _streams)
+	{
+		streams.push_back(stream.get());
+	}
+
+	return streams;
+}
+
+inline void* internal::MethodCommandBufferImpl::reserveCommand(ThreadStream& stream, FunctionBase const& function, MethodCommandBuffer::Replayer replayer,
+															   MethodCommandBuffer::Destroyer destroyer, MethodCommandBuffer::SignatureChecker signatureChecker,
+															   std::size_t commandSize) noexcept
+{
+	GroupHeader*	lastGroup	= stream.lastGroup;
+	Block*			block		= stream.blocks.empty() ? nullptr : &stream.blocks.back();
+
+	//Fast path: the command joins the last group, which ends the last block
+	if (lastGroup != nullptr && lastGroup->function == &function && lastGroup->replayer == replayer && block->size + commandSize <= block->capacity)
+	{
+		return block->memory + block->size;
+	}
+
+	//Signatures are only checked when starting a group since all the commands of a group have the same types
+	if (!signatureChecker(function))
+	{
+		return nullptr;
+	}
+
+	std::size_t groupOffset = (block != nullptr) ? alignGroupOffset(block->size) : 0u;
+
+	if (block == nullptr || groupOffset + _groupHeaderSize + commandSize > block->capacity)
+	{
+		block = appendBlock(stream, _groupHeaderSize + commandSize);
+
+		if (block == nullptr)
+		{
+			return nullptr;
+		}
+
+		groupOffset = 0u;
+	}
+
+	stream.lastGroup	= new (block->memory + groupOffset) GroupHeader{&function, replayer, destroyer, commandSize, 0u};
+	block->size			= groupOffset + _groupHeaderSize;
+
+	return block->memory + block->size;
+}
+
+inline bool internal::MethodCommandBufferImpl::pushCommand(FunctionBase const& function, MethodCommandBuffer::Replayer replayer,
+														   MethodCommandBuffer::Destroyer destroyer, MethodCommandBuffer::SignatureChecker signatureChecker,
+														   std::size_t commandSize, MethodCommandBuffer::CommandConstructor constructor, void* constructorData)
+{
+	ThreadStream& stream = getThreadStream();
+
+	//Lock the stream so that an execution doesn't take the blocks while the command is constructed
+	std::lock_guard lock(stream.mutex);
+
+	void* memory = reserveCommand(stream, function, replayer, destroyer, signatureChecker, commandSize);
+
+	if (memory == nullptr)
+	{
+		return false;
+	}
+
+	//If the constructor throws, a group started for the command is left empty and will be used by the next commands of the same type
+	constructor(memory, constructorData);
+
+	stream.lastGroup->commandsCount++;
+	stream.blocks.back().size += commandSize;
+	stream.commandsCount++;
+
+	return true;
+}
+
+inline std::size_t internal::MethodCommandBufferImpl::execute()
+{
+	std::size_t executedCommandsCount = 0u;
+
+	for (ThreadStream* stream : getStreams())
+	{
+		std::vector<Block>	blocks;
+		std::size_t			commandsCount;
+
+		//Take the stream blocks so that the thread can keep recording while the commands are executed
+		takeBlocks(*stream, blocks, commandsCount);
+
+		//Destroy the commands that were not executed if a call throws, then give the blocks back to the stream
+		struct BlocksGuard
+		{
+			ThreadStream&		stream;
+			std::vector<Block>&	blocks;
+			std::size_t			blockIndex;
+			std::size_t			groupOffset;
+
+			~BlocksGuard()
+			{
+				for (; blockIndex < blocks.size(); blockIndex++, groupOffset = 0u)
+				{
+					destroyGroups(blocks[blockIndex], groupOffset);
+				}
+
+				giveBackBlocks(stream, blocks);
+			}
+		} guard{*stream, blocks, 0u, 0u};
+
+		for (; guard.blockIndex < blocks.size(); guard.blockIndex++, guard.groupOffset = 0u)
+		{
+			Block const& block = blocks[guard.blockIndex];
+
+			while (guard.groupOffset < block.size)
+			{
+				GroupHeader const*	group		= reinterpret_cast<GroupHeader const*>(block.memory + guard.groupOffset);
+				unsigned char*		commands	= block.memory + guard.groupOffset + _groupHeaderSize;
+
+				//The replayer destroys the commands of its group, even if a call throws
+				guard.groupOffset = alignGroupOffset(guard.groupOffset + _groupHeaderSize + group->commandsCount * group->commandSize);
+
+				group->replayer(*group->function, commands, group->commandsCount);
+			}
+		}
+
+		executedCommandsCount += commandsCount;
+	}
+
+	return executedCommandsCount;
+}
+
+inline void internal::MethodCommandBufferImpl::clear() noexcept
+{
+	for (ThreadStream* stream : getStreams())
+	{
+		std::vector<Block>	blocks;
+		std::size_t			commandsCount;
+
+		takeBlocks(*stream, blocks, commandsCount);
+
+		for (Block const& block : blocks)
+		{
+			destroyGroups(block, 0u);
+		}
+
+		giveBackBlocks(*stream, blocks);
+	}
+}
+
+inline std::size_t internal::MethodCommandBufferImpl::getCommandsCount() const noexcept
+{
+	std::size_t commandsCount = 0u;
+
+	for (ThreadStream* stream : getStreams())
+	{
+		std::lock_guard lock(stream->mutex);
+
+		commandsCount += stream->commandsCount;
+	}
+
+	return commandsCount;
+}
\ No newline at end of file
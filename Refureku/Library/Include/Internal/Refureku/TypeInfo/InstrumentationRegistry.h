@@ -0,0 +1,135 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+#include "Refureku/TypeInfo/Instrumentation.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Registry of the instrumentation counters of all threads.
+	*	Each thread counts its events in its own block, only locked by the thread itself and by the aggregation,
+	*	so that recording an event never contends with other recording threads.
+	*	The blocks of exited threads are merged in a retired block.
+	*/
+	class InstrumentationRegistry
+	{
+		public:
+			/** Counters of a single entity, indexed by EInstrumentationEvent. */
+			using Counters			= std::array<std::size_t, static_cast<std::size_t>(EInstrumentationEvent::Count)>;
+
+			/** Counters of all entities an event was recorded for. */
+			using CountersByEntity	= std::unordered_map<Entity const*, Counters>;
+
+			/** Counters of a single thread. */
+			class ThreadBlock
+			{
+				private:
+					/** Registry the block is registered to. */
+					InstrumentationRegistry&	_registry;
+
+					/** Mutex protecting _counters. Only contended while the registry aggregates or resets the counters. */
+					std::mutex					_mutex;
+
+					/** Counters recorded by the thread. */
+					CountersByEntity			_counters;
+
+				public:
+					inline ThreadBlock(InstrumentationRegistry& registry)	noexcept;
+					ThreadBlock(ThreadBlock const&)							= delete;
+					ThreadBlock(ThreadBlock&&)								= delete;
+					inline ~ThreadBlock()									noexcept;
+
+					/**
+					*	@brief Count an event for an entity.
+					*
+					*	@param entity	The entity.
+					*	@param event	The event kind.
+					*/
+					inline void	record(Entity const*			entity,
+									   EInstrumentationEvent	event)			noexcept;
+
+				friend InstrumentationRegistry;
+			};
+
+		private:
+			/** Mutex protecting _threadBlocks and _retiredCounters. */
+			std::mutex					_mutex;
+
+			/** Blocks of the running threads. */
+			std::vector<ThreadBlock*>	_threadBlocks;
+
+			/** Counters of the exited threads. */
+			CountersByEntity			_retiredCounters;
+
+			/**
+			*	@brief Add counters to other counters, entity by entity.
+			*
+			*	@param from	Added counters.
+			*	@param to	Counters receiving the added counters.
+			*/
+			static inline void					mergeCounters(CountersByEntity const&	from,
+															  CountersByEntity&			to)			noexcept;
+
+			/**
+			*	@brief Add a thread block to the registry.
+			*
+			*	@param block The thread block.
+			*/
+			inline void							registerThreadBlock(ThreadBlock& block)				noexcept;
+
+			/**
+			*	@brief Merge the counters of a thread block in the retired counters and remove it from the registry.
+			*
+			*	@param block The thread block.
+			*/
+			inline void							unregisterThreadBlock(ThreadBlock& block)			noexcept;
+
+		public:
+			/**
+			*	@brief Get the registry singleton.
+			*
+			*	@return The registry singleton.
+			*/
+			static inline InstrumentationRegistry&	getInstance()									noexcept;
+
+			/**
+			*	@brief Get the block of the calling thread, creating it on the first call.
+			*
+			*	@return The block of the calling thread.
+			*/
+			static inline ThreadBlock&				getThreadBlock()								noexcept;
+
+			/**
+			*	@brief Sum the counters of all running and exited threads.
+			*
+			*	@return The counters of all threads, by entity.
+			*/
+			inline CountersByEntity					aggregate();
+
+			/**
+			*	@brief	Remove the counters of an entity from all running and exited threads.
+			*			Must be called when the entity is unregistered, since it might be destroyed right after.
+			*
+			*	@param entity The entity.
+			*/
+			inline void								forget(Entity const& entity)					noexcept;
+
+			/**
+			*	@brief Reset the counters of all running and exited threads.
+			*/
+			inline void								reset()											noexcept;
+	};
+
+	#include "Refureku/TypeInfo/InstrumentationRegistry.inl"
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline InstrumentationRegistry::ThreadBlock::ThreadBlock(InstrumentationRegistry& registry) noexcept:
+	_registry{registry}
+{
+	_registry.registerThreadBlock(*this);
+}
+
+inline InstrumentationRegistry::ThreadBlock::~ThreadBlock() noexcept
+{
+	_registry.unregisterThreadBlock(*this);
+}
+
+inline void InstrumentationRegistry::ThreadBlock::record(Entity const* entity, EInstrumentationEvent event) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_counters[entity][static_cast<std::size_t>(event)]++;
+}
+
+inline void InstrumentationRegistry::mergeCounters(CountersByEntity const& from, CountersByEntity& to) noexcept
+{
+	for (auto const& [entity, counters] : from)
+	{
+		Counters& target = to[entity];
+
+		for (std::size_t i = 0u; i < counters.size(); i++)
+		{
+			target[i] += counters[i];
+		}
+	}
+}
+
+inline void InstrumentationRegistry::registerThreadBlock(ThreadBlock& block) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_threadBlocks.push_back(&block);
+}
+
+inline void InstrumentationRegistry::unregisterThreadBlock(ThreadBlock& block) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	//The thread is exiting, so its block can't be modified anymore
+	mergeCounters(block._counters, _retiredCounters);
+
+	for (auto it = _threadBlocks.begin(); it != _threadBlocks.end(); it++)
+	{
+		if (*it == &block)
+		{
+			_threadBlocks.erase(it);
+			break;
+		}
+	}
+}
+
+inline InstrumentationRegistry& InstrumentationRegistry::getInstance() noexcept
+{
+	static InstrumentationRegistry registry;
+
+	return registry;
+}
+
+inline InstrumentationRegistry::ThreadBlock& InstrumentationRegistry::getThreadBlock() noexcept
+{
+	//The registry is constructed before the thread block, so it is destroyed after all thread blocks
+	thread_local ThreadBlock block(getInstance());
+
+	return block;
+}
+
+inline InstrumentationRegistry::CountersByEntity InstrumentationRegistry::aggregate()
+{
+	std::lock_guard lock(_mutex);
+
+	CountersByEntity result = _retiredCounters;
+
+	for (ThreadBlock* block : _threadBlocks)
+	{
+		std::lock_guard blockLock(block->_mutex);
+
+		mergeCounters(block->_counters, result);
+	}
+
+	return result;
+}
+
+inline void InstrumentationRegistry::forget(Entity const& entity) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_retiredCounters.erase(&entity);
+
+	for (ThreadBlock* block : _threadBlocks)
+	{
+		std::lock_guard blockLock(block->_mutex);
+
+		block->_counters.erase(&entity);
+	}
+}
+
+inline void InstrumentationRegistry::reset() noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	_retiredCounters.clear();
+
+	for (ThreadBlock* block : _threadBlocks)
+	{
+		std::lock_guard blockLock(block->_mutex);
+
+		block->_counters.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+#include "Refureku/TypeInfo/MemoryFootprint.h"
+#include "Refureku/TypeInfo/DatabaseImpl.h"
+#include "Refureku/TypeInfo/Module/ModuleHandleImpl.h"
+#include "Refureku/TypeInfo/Query/EntityNameIndex.h"
+#include "Refureku/TypeInfo/Entity/EntityImpl.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceImpl.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceFragmentImpl.h"
+#include "Refureku/TypeInfo/Archetypes/StructImpl.h"
+#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.h"
+#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiationImpl.h"
+#include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
+#include "Refureku/TypeInfo/Archetypes/EnumValueImpl.h"
+#include "Refureku/TypeInfo/Archetypes/FundamentalArchetypeImpl.h"
+#include "Refureku/TypeInfo/Variables/VariableImpl.h"
+#include "Refureku/TypeInfo/Variables/FieldImpl.h"
+#include "Refureku/TypeInfo/Variables/StaticFieldImpl.h"
+#include "Refureku/TypeInfo/Functions/FunctionImpl.h"
+#include "Refureku/TypeInfo/Functions/MethodImpl.h"
+#include "Refureku/TypeInfo/Functions/StaticMethodImpl.h"
+#include "Refureku/TypeInfo/Functions/FunctionParameterImpl.h"
+#include "Refureku/Misc/FlatPtrSet.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Accumulate the memory footprint of entities and registration tables into a MemoryFootprint.
+	*	Types referenced by several entities are accounted once per collector.
+	*/
+	class MemoryFootprintCollector
+	{
+		private:
+			/** Estimated number of bytes a hash table node adds to the stored value (next node pointer and cached hash). */
+			static constexpr std::size_t	hashNodeOverhead = sizeof(void*) + sizeof(std::size_t);
+
+			/** Accumulated footprint. */
+			MemoryFootprint					_footprint;
+
+			/** Types already accounted. */
+			std::unordered_set<Type const*>	_types;
+
+			/**
+			*	@brief Account the storage of a vector.
+			*
+			*	@param entry		Entry receiving the vector elements.
+			*	@param vector		The vector.
+			*	@param elementSize	Number of bytes accounted per allocated element.
+			*/
+			template <typename T>
+			static void							addVector(MemoryFootprintEntry&	entry,
+														  std::vector<T> const&	vector,
+														  std::size_t			elementSize = sizeof(T))	noexcept;
+
+			/**
+			*	@brief Account the nodes of a hash container in the provided entry, and its bucket array in the hash buckets entry.
+			*
+			*	@param entry			Entry receiving the container nodes.
+			*	@param container		The hash container.
+			*	@param nodeValueSize	Number of bytes of the value stored in each node that should be accounted in the entry.
+			*							Pass 0 when the stored values are entities accounted separately.
+			*/
+			template <typename HashContainer>
+			void								addHashContainer(MemoryFootprintEntry&	entry,
+																 HashContainer const&	container,
+																 std::size_t			nodeValueSize = sizeof(typename HashContainer::value_type))	noexcept;
+
+			/**
+			*	@brief Account the pointer list and the index table of a FlatPtrSet.
+			*
+			*	@param entry	Entry receiving the set storage.
+			*	@param set		The set.
+			*/
+			template <typename T>
+			void								addFlatPtrSet(MemoryFootprintEntry&	entry,
+															  FlatPtrSet<T> const&	set)												noexcept;
+
+			/**
+			*	@brief Account the heap buffer of a string if it doesn't fit in the small string buffer.
+			*
+			*	@param entry	Entry receiving the string.
+			*	@param string	The string.
+			*/
+			static inline void					addString(MemoryFootprintEntry&	entry,
+														  std::string const&	string)													noexcept;
+
+			/**
+			*	@brief Account a type and its heap-allocated parts if it was not accounted yet.
+			*
+			*	@param type The type.
+			*/
+			inline void							addType(Type const& type)																noexcept;
+
+			/**
+			*	@brief Account the object, the implementation, the name and the property list of an entity.
+			*
+			*	@param entry		Entry receiving the entity.
+			*	@param entity		The entity.
+			*	@param objectSize	Number of bytes of the entity object and of its implementation.
+			*/
+			inline void							addEntityBase(MemoryFootprintEntry&	entry,
+															  Entity const&			entity,
+															  std::size_t			objectSize)										noexcept;
+
+			/**
+			*	@brief Account the parameters and the return type of a function or method.
+			*
+			*	@param function The function or method implementation.
+			*/
+			inline void							addFunctionData(FunctionBase::FunctionBaseImpl const& function)						noexcept;
+
+			/**
+			*	@brief Account the containers of a struct, excluding the nested entities they store.
+			*
+			*	@param structImpl The struct implementation.
+			*/
+			inline void							addStructContainers(Struct::StructImpl const& structImpl)								noexcept;
+
+			/**
+			*	@brief Account a struct or class and its containers.
+			*
+			*	@param struct_ The struct.
+			*/
+			inline void							addStruct(Struct const& struct_)														noexcept;
+
+			/**
+			*	@brief Account an enum and its lookup tables.
+			*
+			*	@param enum_ The enum.
+			*/
+			inline void							addEnum(Enum const& enum_)																noexcept;
+
+			/**
+			*	@brief Account a namespace and its nested entity containers.
+			*
+			*	@param namespace_ The namespace.
+			*/
+			inline void							addNamespace(Namespace const& namespace_)												noexcept;
+
+			/**
+			*	@brief Account the entries, pending updates and bucket arrays of a name index.
+			*
+			*	@param nameIndex The name index.
+			*/
+			inline void							addNameIndex(EntityNameIndex const& nameIndex)											noexcept;
+
+		public:
+			/**
+			*	@brief Account a single entity, without the entities nested in it. Function and method parameters are accounted with their function.
+			*
+			*	@param entity The entity.
+			*/
+			inline void							addEntity(Entity const& entity)														noexcept;
+
+			/**
+			*	@brief Account an entity and all the entities it owns (nested archetypes, fields, methods, enum values, fragment entities).
+			*
+			*	@param entity The entity.
+			*/
+			inline void							addEntityRecursive(Entity const& entity)												noexcept;
+
+			/**
+			*	@brief Account the registration tables of the database and all the registered entities.
+			*
+			*	@param database The database implementation.
+			*/
+			inline void							addDatabase(Database::DatabaseImpl const& database)									noexcept;
+
+			/**
+			*	@brief Account the registration table of a module and all the entities it owns.
+			*
+			*	@param module The module handle implementation.
+			*/
+			inline void							addModule(ModuleHandleImpl const& module)												noexcept;
+
+			/**
+			*	@brief Getter for the field _footprint.
+			*
+			*	@return _footprint.
+			*/
+			RFK_NODISCARD inline MemoryFootprint const&	getFootprint()														const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/MemoryFootprintCollector.inl"
+}
\ No newline at end of file
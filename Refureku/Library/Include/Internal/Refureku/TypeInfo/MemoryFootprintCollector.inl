@@ -0,0 +1,378 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+void MemoryFootprintCollector::addVector(MemoryFootprintEntry& entry, std::vector<T> const& vector, std::size_t elementSize) noexcept
+{
+	entry.count += vector.size();
+	entry.bytes += vector.capacity() * elementSize;
+}
+
+template <typename HashContainer>
+void MemoryFootprintCollector::addHashContainer(MemoryFootprintEntry& entry, HashContainer const& container, std::size_t nodeValueSize) noexcept
+{
+	entry.count += container.size();
+	entry.bytes += container.size() * (hashNodeOverhead + nodeValueSize);
+
+	_footprint.hashBuckets.count += container.bucket_count();
+	_footprint.hashBuckets.bytes += container.bucket_count() * sizeof(void*);
+}
+
+template <typename T>
+void MemoryFootprintCollector::addFlatPtrSet(MemoryFootprintEntry& entry, FlatPtrSet<T> const& set) noexcept
+{
+	//Pointers are counted by the hash set the flat set mirrors, only count bytes
+	entry.bytes += set._pointers.capacity() * sizeof(T const*);
+
+	addHashContainer(entry, set._indices);
+	entry.count -= set._indices.size();
+}
+
+inline void MemoryFootprintCollector::addString(MemoryFootprintEntry& entry, std::string const& string) noexcept
+{
+	entry.count++;
+
+	if (string.capacity() > std::string().capacity())
+	{
+		entry.bytes += string.capacity() + 1u;
+	}
+}
+
+inline void MemoryFootprintCollector::addType(Type const& type) noexcept
+{
+	if (_types.emplace(&type).second)
+	{
+		_footprint.types.count++;
+		_footprint.types.bytes += sizeof(Type);
+
+		if (type._partsCapacity > Type::_inlinePartsCapacity)
+		{
+			_footprint.types.bytes += type._partsCapacity * sizeof(TypePart);
+		}
+	}
+}
+
+inline void MemoryFootprintCollector::addEntityBase(MemoryFootprintEntry& entry, Entity const& entity, std::size_t objectSize) noexcept
+{
+	Entity::EntityImpl const* entityImpl = entity.getPimpl();
+
+	entry.count++;
+	entry.bytes += objectSize;
+
+	addString(_footprint.names, entityImpl->getName());
+	addVector(_footprint.properties, entityImpl->getProperties());
+}
+
+inline void MemoryFootprintCollector::addFunctionData(FunctionBase::FunctionBaseImpl const& function) noexcept
+{
+	std::vector<FunctionParameter> const& parameters = function.getParameters();
+
+	addType(function.getReturnType());
+
+	//FunctionParameter objects are stored in the parameter list, and each of them allocates its implementation
+	_footprint.parameters.bytes += parameters.capacity() * sizeof(FunctionParameter);
+
+	for (FunctionParameter const& parameter : parameters)
+	{
+		addEntityBase(_footprint.parameters, parameter, sizeof(FunctionParameter::FunctionParameterImpl));
+		addType(parameter.getType());
+	}
+}
+
+inline void MemoryFootprintCollector::addStructContainers(Struct::StructImpl const& structImpl) noexcept
+{
+	MemoryFootprintEntry& containers = _footprint.structContainers;
+
+	addVector(containers, structImpl.getDirectParents());
+	addHashContainer(containers, structImpl.getSubclasses());
+	addHashContainer(containers, structImpl.getNestedArchetypes());
+
+	//Fields and methods are stored in the hash nodes and accounted as entities
+	addHashContainer(containers, structImpl.getFields(), 0u);
+	addHashContainer(containers, structImpl.getStaticFields(), 0u);
+	addHashContainer(containers, structImpl.getMethods(), 0u);
+	addHashContainer(containers, structImpl.getStaticMethods(), 0u);
+
+	addVector(containers, structImpl.getFlatFields());
+	addVector(containers, structImpl.getFlatStaticFields());
+	addVector(containers, structImpl.getFlatMethods());
+	addVector(containers, structImpl.getFlatStaticMethods());
+	addVector(containers, structImpl.getSharedInstantiators());
+	addVector(containers, structImpl.getUniqueInstantiators());
+	addVector(containers, structImpl.getPlacementInstantiators());
+}
+
+inline void MemoryFootprintCollector::addStruct(Struct const& struct_) noexcept
+{
+	switch (struct_.getClassKind())
+	{
+		case EClassKind::Template:
+		{
+			ClassTemplate const&					classTemplate		= static_cast<ClassTemplate const&>(struct_);
+			ClassTemplate::ClassTemplateImpl const*	classTemplateImpl	= classTemplate.getPimpl();
+
+			addEntityBase(_footprint.structs, struct_, sizeof(ClassTemplate) + sizeof(ClassTemplate::ClassTemplateImpl));
+
+			addVector(_footprint.structContainers, classTemplateImpl->getTemplateParameters());
+			addHashContainer(_footprint.structContainers, classTemplateImpl->getTemplateInstantiations());
+			addHashContainer(_footprint.structContainers, classTemplateImpl->_templateInstantiationsByArguments);
+			addHashContainer(_footprint.structContainers, classTemplateImpl->_templateArgumentsHashes);
+			break;
+		}
+
+		case EClassKind::TemplateInstantiation:
+			addEntityBase(_footprint.structs, struct_, sizeof(ClassTemplateInstantiation) + sizeof(ClassTemplateInstantiation::ClassTemplateInstantiationImpl));
+			addVector(_footprint.structContainers, static_cast<ClassTemplateInstantiation const&>(struct_).getPimpl()->getTemplateArguments());
+			break;
+
+		case EClassKind::Standard:
+			[[fallthrough]];
+		default:
+			addEntityBase(_footprint.structs, struct_, sizeof(Struct) + sizeof(Struct::StructImpl));
+			break;
+	}
+
+	addStructContainers(*struct_.getPimpl());
+}
+
+inline void MemoryFootprintCollector::addEnum(Enum const& enum_) noexcept
+{
+	Enum::EnumImpl const* enumImpl = enum_.getPimpl();
+
+	addEntityBase(_footprint.enums, enum_, sizeof(Enum) + sizeof(Enum::EnumImpl));
+
+	//EnumValue objects are stored in the value list and accounted as entities, only account the unused capacity
+	_footprint.enumContainers.bytes += (enumImpl->_enumValues.capacity() - enumImpl->_enumValues.size()) * sizeof(EnumValue);
+
+	addVector(_footprint.enumContainers, enumImpl->_sortedValues);
+	addVector(_footprint.enumContainers, enumImpl->_denseValueIndices);
+	addVector(_footprint.enumContainers, enumImpl->_nameTable);
+}
+
+inline void MemoryFootprintCollector::addNamespace(Namespace const& namespace_) noexcept
+{
+	Namespace::NamespaceImpl const*	namespaceImpl	= namespace_.getPimpl();
+	MemoryFootprintEntry&			containers		= _footprint.namespaceContainers;
+
+	addEntityBase(_footprint.namespaces, namespace_, sizeof(Namespace) + sizeof(Namespace::NamespaceImpl));
+
+	addHashContainer(containers, namespaceImpl->getNamespaces());
+	addHashContainer(containers, namespaceImpl->getArchetypes());
+	addHashContainer(containers, namespaceImpl->getVariables());
+	addHashContainer(containers, namespaceImpl->getFunctions());
+
+	addFlatPtrSet(containers, namespaceImpl->getFlatNamespaces());
+	addFlatPtrSet(containers, namespaceImpl->getFlatArchetypes());
+	addFlatPtrSet(containers, namespaceImpl->getFlatVariables());
+	addFlatPtrSet(containers, namespaceImpl->getFlatFunctions());
+}
+
+inline void MemoryFootprintCollector::addNameIndex(EntityNameIndex const& nameIndex) noexcept
+{
+	MemoryFootprintEntry& tables = _footprint.registrationTables;
+
+	addVector(tables, nameIndex._entries);
+
+	for (EntityNameIndex::Entry const& entry : nameIndex._entries)
+	{
+		//Folded names are copies of the entity names, don't count them as names
+		tables.bytes += (entry.foldedName.capacity() > std::string().capacity()) ? entry.foldedName.capacity() + 1u : 0u;
+	}
+
+	addVector(tables, nameIndex._entriesByOuter);
+	addHashContainer(tables, nameIndex._pendingInsertions);
+	addHashContainer(tables, nameIndex._pendingRemovals);
+}
+
+inline void MemoryFootprintCollector::addEntity(Entity const& entity) noexcept
+{
+	switch (entity.getKind())
+	{
+		case EEntityKind::Namespace:
+			addNamespace(static_cast<Namespace const&>(entity));
+			break;
+
+		case EEntityKind::NamespaceFragment:
+			addEntityBase(_footprint.namespaceFragments, entity, sizeof(NamespaceFragment) + sizeof(NamespaceFragment::NamespaceFragmentImpl));
+			addVector(_footprint.namespaceContainers, static_cast<NamespaceFragment const&>(entity).getPimpl()->getNestedEntities());
+			break;
+
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+			addStruct(static_cast<Struct const&>(entity));
+			break;
+
+		case EEntityKind::Enum:
+			addEnum(static_cast<Enum const&>(entity));
+			break;
+
+		case EEntityKind::EnumValue:
+			addEntityBase(_footprint.enumValues, entity, sizeof(EnumValue) + sizeof(EnumValue::EnumValueImpl));
+			break;
+
+		case EEntityKind::FundamentalArchetype:
+			addEntityBase(_footprint.fundamentalArchetypes, entity, sizeof(FundamentalArchetype) + sizeof(FundamentalArchetype::FundamentalArchetypeImpl));
+			break;
+
+		case EEntityKind::Variable:
+			addEntityBase(_footprint.variables, entity, sizeof(Variable) + sizeof(Variable::VariableImpl));
+			addType(static_cast<Variable const&>(entity).getType());
+			break;
+
+		case EEntityKind::Field:
+			if (static_cast<FieldBase const&>(entity).isStatic())
+			{
+				addEntityBase(_footprint.fields, entity, sizeof(StaticField) + sizeof(StaticField::StaticFieldImpl));
+			}
+			else
+			{
+				addEntityBase(_footprint.fields, entity, sizeof(Field) + sizeof(Field::FieldImpl));
+			}
+
+			addType(static_cast<FieldBase const&>(entity).getType());
+			break;
+
+		case EEntityKind::Function:
+			addEntityBase(_footprint.functions, entity, sizeof(Function) + sizeof(Function::FunctionImpl));
+			addFunctionData(*static_cast<Function const&>(entity).getPimpl());
+			break;
+
+		case EEntityKind::Method:
+			if (static_cast<MethodBase const&>(entity).isStatic())
+			{
+				addEntityBase(_footprint.methods, entity, sizeof(StaticMethod) + sizeof(StaticMethod::StaticMethodImpl));
+				addFunctionData(*static_cast<StaticMethod const&>(entity).getPimpl());
+			}
+			else
+			{
+				addEntityBase(_footprint.methods, entity, sizeof(Method) + sizeof(Method::MethodImpl));
+				addFunctionData(*static_cast<Method const&>(entity).getPimpl());
+			}
+			break;
+
+		case EEntityKind::Undefined:
+			[[fallthrough]];
+		default:
+			//Parameters are accounted with their function, other entities are never registered
+			break;
+	}
+}
+
+inline void MemoryFootprintCollector::addEntityRecursive(Entity const& entity) noexcept
+{
+	addEntity(entity);
+
+	switch (entity.getKind())
+	{
+		case EEntityKind::NamespaceFragment:
+			for (Entity const* nestedEntity : static_cast<NamespaceFragment const&>(entity).getPimpl()->getNestedEntities())
+			{
+				addEntityRecursive(*nestedEntity);
+			}
+			break;
+
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+		{
+			Struct::StructImpl const* structImpl = static_cast<Struct const&>(entity).getPimpl();
+
+			for (Archetype const* nestedArchetype : structImpl->getNestedArchetypes())
+			{
+				addEntityRecursive(*nestedArchetype);
+			}
+
+			for (Field const& field : structImpl->getFields())
+			{
+				addEntity(field);
+			}
+
+			for (StaticField const& staticField : structImpl->getStaticFields())
+			{
+				addEntity(staticField);
+			}
+
+			for (Method const& method : structImpl->getMethods())
+			{
+				addEntity(method);
+			}
+
+			for (StaticMethod const& staticMethod : structImpl->getStaticMethods())
+			{
+				addEntity(staticMethod);
+			}
+			break;
+		}
+
+		case EEntityKind::Enum:
+			for (EnumValue const& enumValue : static_cast<Enum const&>(entity).getPimpl()->getEnumValues())
+			{
+				addEntity(enumValue);
+			}
+			break;
+
+		default:
+			//Other entities don't own nested entities
+			break;
+	}
+}
+
+inline void MemoryFootprintCollector::addDatabase(Database::DatabaseImpl const& database) noexcept
+{
+	MemoryFootprintEntry& tables = _footprint.registrationTables;
+
+	addHashContainer(tables, database.getEntitiesById());
+	addHashContainer(tables, database.getFileLevelNamespacesByName());
+	addHashContainer(tables, database.getFileLevelStructsByName());
+	addHashContainer(tables, database.getFileLevelClassesByName());
+	addHashContainer(tables, database.getFileLevelEnumsByName());
+	addHashContainer(tables, database.getFileLevelVariablesByName());
+	addHashContainer(tables, database.getFileLevelFunctionsByName());
+	addHashContainer(tables, database.getFundamentalArchetypesByName());
+	addHashContainer(tables, database.getGeneratedNamespaces());
+
+	addFlatPtrSet(tables, database.getFlatFileLevelNamespaces());
+	addFlatPtrSet(tables, database.getFlatFileLevelStructs());
+	addFlatPtrSet(tables, database.getFlatFileLevelClasses());
+	addFlatPtrSet(tables, database.getFlatFileLevelEnums());
+	addFlatPtrSet(tables, database.getFlatFileLevelVariables());
+	addFlatPtrSet(tables, database.getFlatFileLevelFunctions());
+
+	addHashContainer(tables, database.getEntitiesByPropertyArchetype());
+
+	for (auto const& [propertyArchetype, entities] : database.getEntitiesByPropertyArchetype())
+	{
+		addFlatPtrSet(tables, entities);
+	}
+
+	addNameIndex(database.getNameIndex());
+
+	for (Entity const* entity : database.getEntitiesById())
+	{
+		addEntity(*entity);
+	}
+}
+
+inline void MemoryFootprintCollector::addModule(ModuleHandleImpl const& module) noexcept
+{
+	addVector(_footprint.registrationTables, module.getEntities());
+
+	//Entities are counted by the table the index mirrors, only count bytes
+	addHashContainer(_footprint.registrationTables, module.getEntitiesIndices());
+	_footprint.registrationTables.count -= module.getEntitiesIndices().size();
+
+	for (Entity const* entity : module.getEntities())
+	{
+		addEntityRecursive(*entity);
+	}
+}
+
+inline MemoryFootprint const& MemoryFootprintCollector::getFootprint() const noexcept
+{
+	return _footprint;
+}
\ No newline at end of file
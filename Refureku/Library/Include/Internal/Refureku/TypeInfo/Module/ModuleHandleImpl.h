@@ -0,0 +1,180 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cassert>
+
+#include "Refureku/TypeInfo/Module/ModuleHandle.h"
+#include "Refureku/TypeInfo/Entity/Entity.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceFragment.h"
+#include "Refureku/TypeInfo/DatabaseImpl.h"
+#include "Refureku/TypeInfo/Module/ModulePatcher.h"
+
+namespace rfk
+{
+	class internal::ModuleHandleImpl final
+	{
+		private:
+			/** Name of the module. */
+			std::string					_name;
+
+			/**
+			*	File level entities of the module.
+			*	Removed entities are replaced by the last entity of their range, so the order of the entities is not stable.
+			*/
+			std::vector<Entity const*>	_entities;
+
+			/** Index of each entity in _entities, so that entities are removed in constant time whatever the removal order. */
+			std::unordered_map<Entity const*, std::size_t>	_entitiesIndices;
+
+			/**
+			*	Number of entities at the beginning of _entities which have already been unloaded.
+			*	Those entities are neither registered to the database nor merged to their namespace anymore.
+			*/
+			std::size_t					_unloadedEntitiesCount;
+
+			/** Is the module currently registered to the database? */
+			bool						_isLoaded;
+
+			/** Patches applied to the entities of this module by the last reload. */
+			ModulePatcher				_patcher;
+
+			/** Module of the newer build this module is reloaded with, nullptr if the module is not reloaded. */
+			ModuleHandleImpl*			_reloadingModule;
+
+			/** Module this module is the newer build of, nullptr if the module doesn't patch any module. */
+			ModuleHandleImpl*			_reloadedModule;
+
+			/**
+			*	@brief Remove a single entity from the module registration table.
+			* 
+			*	@param entity The entity to remove.
+			*/
+			inline void						removeEntity(Entity const& entity)						noexcept;
+
+			/**
+			*	@brief Move an entity of the registration table to another index, overwriting the entity at that index.
+			* 
+			*	@param from	Index of the moved entity.
+			*	@param to	Index the entity is moved to.
+			*/
+			inline void						moveEntity(std::size_t from,
+													   std::size_t to)								noexcept;
+
+			/**
+			*	@brief Unmerge the namespace fragments contained in the provided range of the registration table.
+			* 
+			*	@param begin	Index of the first entity of the range.
+			*	@param end		Index past the last entity of the range.
+			*/
+			inline void						unmergeFragments(std::size_t begin,
+															 std::size_t end)				const	noexcept;
+
+			/**
+			*	@brief	Revert the reload involving this module, whether this module was reloaded or is the newer build of another module.
+			*			Called before the entities of this module are destroyed.
+			*/
+			inline void						stopReload()											noexcept;
+
+		public:
+			inline ModuleHandleImpl(char const* name)	noexcept;
+			inline ~ModuleHandleImpl()					noexcept;
+
+			/**
+			*	@brief Reserve the registration table.
+			* 
+			*	@param entitiesCount Number of entities to reserve memory for.
+			*/
+			inline void						reserve(std::size_t entitiesCount)						noexcept;
+
+			/**
+			*	@brief Add entities to the registration table, and register them to the database if the module is loaded.
+			* 
+			*	@param entities			Pointer to the first entity to add.
+			*	@param entitiesCount	Number of entities to add.
+			*/
+			inline void						addEntities(Entity const* const*	entities,
+														std::size_t				entitiesCount)		noexcept;
+
+			/**
+			*	@brief Remove entities from the registration table, and unregister them from the database if the module is loaded.
+			* 
+			*	@param entities			Pointer to the first entity to remove.
+			*	@param entitiesCount	Number of entities to remove.
+			*/
+			inline void						removeEntities(Entity const* const*	entities,
+														   std::size_t			entitiesCount)		noexcept;
+
+			/**
+			*	@brief Register all the entities of the registration table which were not unloaded yet.
+			*/
+			inline void						load()													noexcept;
+
+			/**
+			*	@brief Unregister all the registered entities of the registration table and unmerge its namespace fragments.
+			*/
+			inline void						unload()												noexcept;
+
+			/**
+			*	@brief Patch the entities of this module with the entities of a newer build of the same module.
+			* 
+			*	@param newModule Module of the newer build.
+			* 
+			*	@return The summary of the patched entities.
+			*/
+			inline ModuleReloadReport		reload(ModuleHandleImpl& newModule)						noexcept;
+
+			/**
+			*	@brief Restore the entities patched by the last reload of this module.
+			*/
+			inline void						revertReload()											noexcept;
+
+			/**
+			*	@brief Check whether the module is currently reloaded with a newer build.
+			* 
+			*	@return true if the module is reloaded, else false.
+			*/
+			RFK_NODISCARD inline bool		isReloaded()									const	noexcept;
+
+			/**
+			*	@brief Getter for the field _isLoaded.
+			* 
+			*	@return _isLoaded.
+			*/
+			RFK_NODISCARD inline bool		isLoaded()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _name.
+			* 
+			*	@return _name.
+			*/
+			RFK_NODISCARD inline
+				std::string const&			getName()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _entities.
+			* 
+			*	@return _entities.
+			*/
+			RFK_NODISCARD inline
+				std::vector<Entity const*> const&	getEntities()							const	noexcept;
+
+			/**
+			*	@brief Getter for the field _entitiesIndices.
+			* 
+			*	@return _entitiesIndices.
+			*/
+			RFK_NODISCARD inline
+				std::unordered_map<Entity const*, std::size_t> const&	getEntitiesIndices()	const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Module/ModuleHandleImpl.inl"
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline internal::ModuleHandleImpl::ModuleHandleImpl(char const* name) noexcept:
+	_name{name},
+	_entities(),
+	_entitiesIndices(),
+	_unloadedEntitiesCount{0u},
+	_isLoaded{false},
+	_patcher(),
+	_reloadingModule{nullptr},
+	_reloadedModule{nullptr}
+{
+}
+
+inline internal::ModuleHandleImpl::~ModuleHandleImpl() noexcept
+{
+	stopReload();
+	unload();
+}
+
+inline void internal::ModuleHandleImpl::reserve(std::size_t entitiesCount) noexcept
+{
+	_entities.reserve(entitiesCount);
+	_entitiesIndices.reserve(entitiesCount);
+}
+
+inline void internal::ModuleHandleImpl::addEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	std::size_t firstAddedEntityIndex = _entities.size();
+
+	_entities.insert(_entities.end(), entities, entities + entitiesCount);
+
+	for (std::size_t i = firstAddedEntityIndex; i < _entities.size(); i++)
+	{
+		_entitiesIndices.emplace(_entities[i], i);
+	}
+
+	//Entities added to a loaded module are registered right away
+	if (_isLoaded)
+	{
+		Database::getInstance()._pimpl->registerFileLevelEntities(_entities.data() + firstAddedEntityIndex, entitiesCount);
+	}
+}
+
+inline void internal::ModuleHandleImpl::removeEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	//Entities are removed right before they are destroyed, usually when the module is unloaded from memory: patches must not outlive them
+	stopReload();
+
+	for (std::size_t i = entitiesCount; i > 0u; i--)
+	{
+		removeEntity(*entities[i - 1u]);
+	}
+}
+
+inline void internal::ModuleHandleImpl::removeEntity(Entity const& entity) noexcept
+{
+	auto it = _entitiesIndices.find(&entity);
+
+	assert(it != _entitiesIndices.end());
+
+	if (it == _entitiesIndices.end())
+	{
+		return;
+	}
+
+	std::size_t index = it->second;
+
+	_entitiesIndices.erase(it);
+
+	//Entities which were unloaded have already been unregistered and unmerged
+	if (index >= _unloadedEntitiesCount)
+	{
+		if (_isLoaded)
+		{
+			Database::getInstance()._pimpl->unregisterEntityRecursive(entity);
+		}
+
+		if (entity.getKind() == EEntityKind::NamespaceFragment)
+		{
+			static_cast<NamespaceFragment const&>(entity).unmergeFragment();
+		}
+	}
+	else
+	{
+		//Keep the unloaded entities at the beginning of the table by filling the removed slot with the last unloaded entity
+		_unloadedEntitiesCount--;
+
+		moveEntity(_unloadedEntitiesCount, index);
+
+		index = _unloadedEntitiesCount;
+	}
+
+	moveEntity(_entities.size() - 1u, index);
+
+	_entities.pop_back();
+}
+
+inline void internal::ModuleHandleImpl::moveEntity(std::size_t from, std::size_t to) noexcept
+{
+	if (from != to)
+	{
+		_entities[to]						= _entities[from];
+		_entitiesIndices[_entities[to]]	= to;
+	}
+}
+
+inline void internal::ModuleHandleImpl::unmergeFragments(std::size_t begin, std::size_t end) const noexcept
+{
+	for (std::size_t i = end; i > begin; i--)
+	{
+		if (_entities[i - 1u]->getKind() == EEntityKind::NamespaceFragment)
+		{
+			static_cast<NamespaceFragment const*>(_entities[i - 1u])->unmergeFragment();
+		}
+	}
+}
+
+inline void internal::ModuleHandleImpl::load() noexcept
+{
+	if (!_isLoaded)
+	{
+		Database::getInstance()._pimpl->registerFileLevelEntities(_entities.data() + _unloadedEntitiesCount, _entities.size() - _unloadedEntitiesCount);
+
+		_isLoaded = true;
+	}
+}
+
+inline void internal::ModuleHandleImpl::unload() noexcept
+{
+	if (_isLoaded)
+	{
+		Database::getInstance()._pimpl->unregisterFileLevelEntities(_entities.data() + _unloadedEntitiesCount, _entities.size() - _unloadedEntitiesCount);
+
+		/**
+		*	Unmerge the fragments only once all the entities have been unregistered,
+		*	as unregistering a fragment walks through its nested entities.
+		*/
+		unmergeFragments(_unloadedEntitiesCount, _entities.size());
+
+		_unloadedEntitiesCount	= _entities.size();
+		_isLoaded				= false;
+	}
+}
+
+inline ModuleReloadReport internal::ModuleHandleImpl::reload(ModuleHandleImpl& newModule) noexcept
+{
+	//Entities of a loaded newer build would conflict with the entities of this module in the database
+	assert(!newModule._isLoaded);
+
+	//A module is patched by a single newer build at a time, and a newer build patches a single module
+	revertReload();
+	newModule.stopReload();
+
+	if (&newModule == this)
+	{
+		return ModuleReloadReport();
+	}
+
+	ModuleReloadReport report = _patcher.patch(_entities.data() + _unloadedEntitiesCount, _entities.size() - _unloadedEntitiesCount,
+											   newModule._entities.data() + newModule._unloadedEntitiesCount, newModule._entities.size() - newModule._unloadedEntitiesCount);
+
+	_reloadingModule			= &newModule;
+	newModule._reloadedModule	= this;
+
+	return report;
+}
+
+inline void internal::ModuleHandleImpl::revertReload() noexcept
+{
+	if (_reloadingModule != nullptr)
+	{
+		_patcher.revert();
+
+		_reloadingModule->_reloadedModule	= nullptr;
+		_reloadingModule					= nullptr;
+	}
+}
+
+inline void internal::ModuleHandleImpl::stopReload() noexcept
+{
+	revertReload();
+
+	if (_reloadedModule != nullptr)
+	{
+		_reloadedModule->revertReload();
+	}
+}
+
+inline bool internal::ModuleHandleImpl::isReloaded() const noexcept
+{
+	return _reloadingModule != nullptr;
+}
+
+inline bool internal::ModuleHandleImpl::isLoaded() const noexcept
+{
+	return _isLoaded;
+}
+
+inline std::string const& internal::ModuleHandleImpl::getName() const noexcept
+{
+	return _name;
+}
+
+inline std::vector<Entity const*> const& internal::ModuleHandleImpl::getEntities() const noexcept
+{
+	return _entities;
+}
+
+inline std::unordered_map<Entity const*, std::size_t> const& internal::ModuleHandleImpl::getEntitiesIndices() const noexcept
+{
+	return _entitiesIndices;
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <cstring>	//std::memcmp
+#include <algorithm>	//std::find
+#include <cassert>
+#include <vector>
+#include <unordered_map>
+
+#include "Refureku/TypeInfo/Module/ModuleReloadReport.h"
+#include "Refureku/TypeInfo/Entity/Entity.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceFragmentImpl.h"
+#include "Refureku/TypeInfo/Archetypes/StructImpl.h"
+#include "Refureku/TypeInfo/Functions/FunctionBaseImpl.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Patch the entities of a module with the entities of a newer build of the same module, matched by id.
+	*	Functions and methods are patched to call the code of the newer build, and fields of structs with an unchanged layout get its memory offsets.
+	*	Every patch is recorded so that the original entities can be restored.
+	*/
+	class ModulePatcher
+	{
+		private:
+			/** Entities indexed by id. */
+			using EntitiesById = std::unordered_map<std::size_t, Entity const*>;
+
+			/** Functions and methods calling the code of the newer build. */
+			std::vector<FunctionBase const*>	_patchedFunctions;
+
+			/** Structs of the original build whose layout is being compared, to stop on structs referencing themselves. */
+			std::vector<Struct const*>			_comparedStructs;
+
+			/** Summary of the last patch. */
+			ModuleReloadReport					_report;
+
+			/**
+			*	@brief	Index an entity by id. Namespace fragments are not indexed themselves,
+			*			their nested entities are since fragments of both builds are not necessarily split the same way.
+			*
+			*	@param entity		The entity to index.
+			*	@param out_entities	Index receiving the entity.
+			*/
+			static inline void	indexEntity(Entity const&	entity,
+											EntitiesById&	out_entities)							noexcept;
+
+			/**
+			*	@brief	Check whether 2 types are the same across both builds.
+			*			Reflected archetypes are compared by id since each build owns its own archetype objects,
+			*			and the archetypes of both builds must have the same size and, for structs and classes, the same layout.
+			*
+			*	@param type		Type of the original build.
+			*	@param newType	Type of the newer build.
+			*
+			*	@return true if both types are the same, else false.
+			*/
+			inline bool			isSameType(Type const&	type,
+										   Type const&	newType)									noexcept;
+
+			/**
+			*	@brief Check whether 2 functions have the same signature across both builds.
+			*
+			*	@param function		Function of the original build.
+			*	@param newFunction	Function of the newer build.
+			*
+			*	@return true if both functions have the same return and parameter types, else false.
+			*/
+			inline bool			hasSameSignature(FunctionBase const&	function,
+												 FunctionBase const&	newFunction)				noexcept;
+
+			/**
+			*	@brief	Check whether the instances of 2 structs are interchangeable:
+			*			same size, same alignment, and the same fields with the same types at the same memory offsets.
+			*
+			*	@param struct_		Struct of the original build.
+			*	@param newStruct	Struct of the newer build.
+			*
+			*	@return true if both structs have the same layout, else false.
+			*/
+			inline bool			hasSameLayout(Struct const&	struct_,
+											  Struct const&	newStruct)								noexcept;
+
+			/**
+			*	@brief Patch a function or method to call the code of the newer build, if both signatures match.
+			*
+			*	@param function		Function of the original build.
+			*	@param newFunction	Function of the newer build, nullptr if it doesn't exist anymore.
+			*/
+			inline void			patchFunction(FunctionBase const&	function,
+											  FunctionBase const*	newFunction)					noexcept;
+
+			/**
+			*	@brief	Patch the nested archetypes of a struct, then its methods if both layouts match.
+			*
+			*	@param struct_		Struct of the original build.
+			*	@param newStruct	Struct of the newer build.
+			*/
+			inline void			patchStruct(Struct const&	struct_,
+											Struct const&	newStruct)								noexcept;
+
+			/**
+			*	@brief Patch an entity with its counterpart of the newer build, recursing through namespace fragments.
+			*
+			*	@param entity		Entity of the original build.
+			*	@param newEntities	Entities of the newer build (or of the newer struct) indexed by id.
+			*/
+			inline void			patchEntity(Entity const&		entity,
+											EntitiesById const&	newEntities)						noexcept;
+
+		public:
+			/**
+			*	@brief	Patch file level entities with the file level entities of a newer build.
+			*			The previous patch must be reverted first.
+			*
+			*	@param entities			Pointer to the first file level entity of the original build.
+			*	@param entitiesCount	Number of file level entities of the original build.
+			*	@param newEntities		Pointer to the first file level entity of the newer build.
+			*	@param newEntitiesCount	Number of file level entities of the newer build.
+			*
+			*	@return The summary of the patch.
+			*/
+			inline ModuleReloadReport	patch(Entity const* const*	entities,
+											  std::size_t			entitiesCount,
+											  Entity const* const*	newEntities,
+											  std::size_t			newEntitiesCount)				noexcept;
+
+			/**
+			*	@brief Restore all the patched entities as they were before the patch.
+			*/
+			inline void					revert()												noexcept;
+
+			/**
+			*	@brief	Forget all the patched entities without restoring them.
+			*			Used when the original entities are being destroyed.
+			*/
+			inline void					clear()													noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Module/ModulePatcher.inl"
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline void ModulePatcher::indexEntity(Entity const& entity, EntitiesById& out_entities) noexcept
+{
+	if (entity.getKind() == EEntityKind::NamespaceFragment)
+	{
+		for (Entity const* nestedEntity : static_cast<NamespaceFragment const&>(entity).getPimpl()->getNestedEntities())
+		{
+			indexEntity(*nestedEntity, out_entities);
+		}
+	}
+	else
+	{
+		out_entities.emplace(entity.getId(), &entity);
+	}
+}
+
+inline bool ModulePatcher::isSameType(Type const& type, Type const& newType) noexcept
+{
+	Archetype const* archetype		= type.getArchetype();
+	Archetype const* newArchetype	= newType.getArchetype();
+
+	if (archetype != newArchetype)
+	{
+		if (archetype == nullptr || newArchetype == nullptr || archetype->getId() != newArchetype->getId() ||
+			archetype->getKind() != newArchetype->getKind() || archetype->getMemorySize() != newArchetype->getMemorySize())
+		{
+			return false;
+		}
+
+		//Code of the newer build would access instances of the original build through the newer layout, even through pointers or references
+		if ((archetype->getKind() == EEntityKind::Struct || archetype->getKind() == EEntityKind::Class) &&
+			!hasSameLayout(static_cast<Struct const&>(*archetype), static_cast<Struct const&>(*newArchetype)))
+		{
+			return false;
+		}
+	}
+
+	if (type.getTypePartsCount() != newType.getTypePartsCount())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+	{
+		if (std::memcmp(&type.getTypePartAt(i), &newType.getTypePartAt(i), sizeof(TypePart)) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool ModulePatcher::hasSameSignature(FunctionBase const& function, FunctionBase const& newFunction) noexcept
+{
+	if (!isSameType(function.getReturnType(), newFunction.getReturnType()) || function.getParametersCount() != newFunction.getParametersCount())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0u; i < function.getParametersCount(); i++)
+	{
+		if (!isSameType(function.getParameterAt(i).getType(), newFunction.getParameterAt(i).getType()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline bool ModulePatcher::hasSameLayout(Struct const& struct_, Struct const& newStruct) noexcept
+{
+	//A struct referencing itself is compared by the outer call
+	if (std::find(_comparedStructs.cbegin(), _comparedStructs.cend(), &struct_) != _comparedStructs.cend())
+	{
+		return true;
+	}
+
+	Struct::StructImpl::Fields const& fields		= struct_.getPimpl()->getFields();
+	Struct::StructImpl::Fields const& newFields	= newStruct.getPimpl()->getFields();
+
+	if (struct_.getMemorySize() != newStruct.getMemorySize() ||
+		struct_.getMemoryAlignment() != newStruct.getMemoryAlignment() ||
+		fields.size() != newFields.size())
+	{
+		return false;
+	}
+
+	EntitiesById newFieldsById;
+	newFieldsById.reserve(newFields.size());
+
+	for (Field const& newField : newFields)
+	{
+		newFieldsById.emplace(newField.getId(), &newField);
+	}
+
+	_comparedStructs.push_back(&struct_);
+
+	bool result = true;
+
+	for (Field const& field : fields)
+	{
+		auto it = newFieldsById.find(field.getId());
+
+		if (it == newFieldsById.end() ||
+			field.getMemoryOffset() != static_cast<Field const*>(it->second)->getMemoryOffset() ||
+			!isSameType(field.getType(), static_cast<Field const*>(it->second)->getType()))
+		{
+			result = false;
+			break;
+		}
+	}
+
+	_comparedStructs.pop_back();
+
+	return result;
+}
+
+inline void ModulePatcher::patchFunction(FunctionBase const& function, FunctionBase const* newFunction) noexcept
+{
+	if (newFunction == nullptr)
+	{
+		_report.missingEntitiesCount++;
+	}
+	else if (!hasSameSignature(function, *newFunction))
+	{
+		_report.incompatibleEntitiesCount++;
+	}
+	else
+	{
+		const_cast<FunctionBase&>(function).getPimpl()->patchInternalFunction(newFunction->getInternalFunction());
+
+		_patchedFunctions.push_back(&function);
+		_report.patchedFunctionsCount++;
+	}
+}
+
+inline void ModulePatcher::patchStruct(Struct const& struct_, Struct const& newStruct) noexcept
+{
+	Struct::StructImpl const* structImpl	= struct_.getPimpl();
+	Struct::StructImpl const* newStructImpl	= newStruct.getPimpl();
+
+	//Nested archetypes are patched even if the layout of their outer struct changed
+	EntitiesById newEntities;
+
+	for (Archetype const* newNestedArchetype : newStructImpl->getNestedArchetypes())
+	{
+		newEntities.emplace(newNestedArchetype->getId(), newNestedArchetype);
+	}
+
+	for (Archetype const* nestedArchetype : structImpl->getNestedArchetypes())
+	{
+		patchEntity(*nestedArchetype, newEntities);
+	}
+
+	//Methods of the newer build would read or write instances of the original build at the wrong offsets, so leave the whole struct unpatched
+	if (!hasSameLayout(struct_, newStruct))
+	{
+		_report.incompatibleEntitiesCount++;
+		return;
+	}
+
+	_report.patchedFieldsCount += structImpl->getFields().size();
+
+	newEntities.clear();
+
+	for (Method const& newMethod : newStructImpl->getMethods())
+	{
+		newEntities.emplace(newMethod.getId(), &newMethod);
+	}
+
+	for (Method const& method : structImpl->getMethods())
+	{
+		auto it = newEntities.find(method.getId());
+
+		patchFunction(method, (it != newEntities.end()) ? static_cast<Method const*>(it->second) : nullptr);
+	}
+
+	newEntities.clear();
+
+	for (StaticMethod const& newStaticMethod : newStructImpl->getStaticMethods())
+	{
+		newEntities.emplace(newStaticMethod.getId(), &newStaticMethod);
+	}
+
+	for (StaticMethod const& staticMethod : structImpl->getStaticMethods())
+	{
+		auto it = newEntities.find(staticMethod.getId());
+
+		patchFunction(staticMethod, (it != newEntities.end()) ? static_cast<StaticMethod const*>(it->second) : nullptr);
+	}
+}
+
+inline void ModulePatcher::patchEntity(Entity const& entity, EntitiesById const& newEntities) noexcept
+{
+	switch (entity.getKind())
+	{
+		case EEntityKind::NamespaceFragment:
+			for (Entity const* nestedEntity : static_cast<NamespaceFragment const&>(entity).getPimpl()->getNestedEntities())
+			{
+				patchEntity(*nestedEntity, newEntities);
+			}
+			break;
+
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+			[[fallthrough]];
+		case EEntityKind::Function:
+		{
+			auto it = newEntities.find(entity.getId());
+
+			if (it == newEntities.end())
+			{
+				_report.missingEntitiesCount++;
+			}
+			else if (it->second->getKind() != entity.getKind())
+			{
+				_report.incompatibleEntitiesCount++;
+			}
+			else if (entity.getKind() == EEntityKind::Function)
+			{
+				patchFunction(static_cast<FunctionBase const&>(entity), static_cast<FunctionBase const*>(it->second));
+			}
+			else
+			{
+				patchStruct(static_cast<Struct const&>(entity), *static_cast<Struct const*>(it->second));
+			}
+			break;
+		}
+
+		default:
+			//Variables keep their state in the original build, other entities don't hold any code or layout
+			break;
+	}
+}
+
+inline ModuleReloadReport ModulePatcher::patch(Entity const* const* entities, std::size_t entitiesCount, Entity const* const* newEntities, std::size_t newEntitiesCount) noexcept
+{
+	assert(_patchedFunctions.empty());
+
+	_report = ModuleReloadReport();
+
+	EntitiesById newEntitiesById;
+	newEntitiesById.reserve(newEntitiesCount);
+
+	for (std::size_t i = 0u; i < newEntitiesCount; i++)
+	{
+		indexEntity(*newEntities[i], newEntitiesById);
+	}
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		patchEntity(*entities[i], newEntitiesById);
+	}
+
+	return _report;
+}
+
+inline void ModulePatcher::revert() noexcept
+{
+	for (FunctionBase const* function : _patchedFunctions)
+	{
+		const_cast<FunctionBase*>(function)->getPimpl()->restoreInternalFunction();
+	}
+
+	clear();
+}
+
+inline void ModulePatcher::clear() noexcept
+{
+	_patchedFunctions.clear();
+}
\ No newline at end of file
@@ -37,6 +37,16 @@ namespace rfk
 			*/
 			inline void								addNestedEntity(Entity const& nestedEntity)			noexcept;
 
+			/**
+			*	@brief	Add a batch of nested entities to the fragment as well as the merged namespace.
+			*			Entities are grouped by kind and merged to the merged namespace in a single call.
+			*	
+			*	@param nestedEntities		Pointer to the first nested entity of the batch.
+			*	@param nestedEntitiesCount	Number of nested entities in the batch.
+			*/
+			inline void								addNestedEntities(Entity const* const*	nestedEntities,
+																	  std::size_t			nestedEntitiesCount)	noexcept;
+
 			/**
 			*	@brief	Add a property to this namespace fragment.
 			*			The property is immediately added to the merged namespace.
@@ -58,6 +58,53 @@ inline void NamespaceFragment::NamespaceFragmentImpl::addNestedEntity(Entity con
 	}
 }
 
+inline void NamespaceFragment::NamespaceFragmentImpl::addNestedEntities(Entity const* const* nestedEntities, std::size_t nestedEntitiesCount) noexcept
+{
+	std::vector<Namespace const*>	namespaces;
+	std::vector<Archetype const*>	archetypes;
+	std::vector<Variable const*>	variables;
+	std::vector<Function const*>	functions;
+
+	for (std::size_t i = 0u; i < nestedEntitiesCount; i++)
+	{
+		Entity const& nestedEntity = *nestedEntities[i];
+
+		switch (nestedEntity.getKind())
+		{
+			case EEntityKind::NamespaceFragment:
+				namespaces.push_back(&static_cast<NamespaceFragment const&>(nestedEntity).getMergedNamespace());
+				break;
+
+			case EEntityKind::Struct:
+				[[fallthrough]];
+			case EEntityKind::Class:
+				[[fallthrough]];
+			case EEntityKind::Enum:
+				archetypes.push_back(&static_cast<Archetype const&>(nestedEntity));
+				break;
+
+			case EEntityKind::Variable:
+				variables.push_back(&static_cast<Variable const&>(nestedEntity));
+				break;
+
+			case EEntityKind::Function:
+				functions.push_back(&static_cast<Function const&>(nestedEntity));
+				break;
+
+			default:
+				//None of these kind of entities should ever be a namespace nested entity
+				assert(false);
+				break;
+		}
+	}
+
+	_nestedEntities.insert(_nestedEntities.end(), nestedEntities, nestedEntities + nestedEntitiesCount);
+
+	//Merge each kind of entity in a single call rather than going through the merged namespace once per entity
+	_mergedNamespace->addNestedEntities(namespaces.data(), namespaces.size(), archetypes.data(), archetypes.size(),
+										variables.data(), variables.size(), functions.data(), functions.size());
+}
+
 inline bool	NamespaceFragment::NamespaceFragmentImpl::addProperty(Property const& property) noexcept
 {
 	_mergedNamespace->addProperty(property);
@@ -11,6 +11,8 @@ inline internal::NamespaceFragmentRegistererImpl::NamespaceFragmentRegistererImp
 	//Only register file level namespaces
 	assert(namespaceFragment.getOuterEntity() == nullptr);
 
+	RFK_TRACE_REGISTRATION_SCOPE(NamespaceFragmentRegisterer, namespaceFragment.getName(), nullptr);
+
 	Database::getInstance()._pimpl->registerFileLevelEntityRecursive(_registeredFragment);
 }
 
@@ -15,6 +15,8 @@
 #include "Refureku/TypeInfo/Variables/Variable.h"
 #include "Refureku/TypeInfo/Functions/Function.h"
 #include "Refureku/TypeInfo/Entity/EntityHash.h"
+#include "Refureku/Misc/FlatPtrSet.h"
+#include "Refureku/Misc/Algorithm.h"
 
 namespace rfk
 {
@@ -38,6 +40,18 @@ namespace rfk
 
 			/** Collection of all (non-member) functions contained in this namespace. */
 			FunctionHashSet		_functions;
+
+			/** Pointers contained in _namespaces stored contiguously. */
+			FlatPtrSet<Namespace>	_flatNamespaces;
+
+			/** Pointers contained in _archetypes stored contiguously. */
+			FlatPtrSet<Archetype>	_flatArchetypes;
+
+			/** Pointers contained in _variables stored contiguously. */
+			FlatPtrSet<Variable>	_flatVariables;
+
+			/** Pointers contained in _functions stored contiguously. */
+			FlatPtrSet<Function>	_flatFunctions;
 			
 		public:
 			inline NamespaceImpl(char const* name,
@@ -98,6 +112,28 @@ namespace rfk
 			*	@param function The function to remove.
 			*/
 			inline void										removeFunction(Function const& function)					noexcept;
+
+			/**
+			*	@brief	Add a batch of nested entities of each kind to this namespace.
+			*			Each hash set is reserved once, and each flat set indexes its new pointers in a single pass.
+			* 
+			*	@param namespaces		Pointer to the first namespace to add.
+			*	@param namespacesCount	Number of namespaces to add.
+			*	@param archetypes		Pointer to the first archetype to add.
+			*	@param archetypesCount	Number of archetypes to add.
+			*	@param variables		Pointer to the first variable to add.
+			*	@param variablesCount	Number of variables to add.
+			*	@param functions		Pointer to the first function to add.
+			*	@param functionsCount	Number of functions to add.
+			*/
+			inline void										addNestedEntities(Namespace const* const*	namespaces,
+																			  std::size_t				namespacesCount,
+																			  Archetype const* const*	archetypes,
+																			  std::size_t				archetypesCount,
+																			  Variable const* const*	variables,
+																			  std::size_t				variablesCount,
+																			  Function const* const*	functions,
+																			  std::size_t				functionsCount)	noexcept;
 			
 			/**
 			*	@brief Set the outer entity of the passed entity to the provided namespace backref.
@@ -135,6 +171,34 @@ namespace rfk
 			*	@return _functions.
 			*/
 			RFK_NODISCARD inline FunctionHashSet const&		getFunctions()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatNamespaces.
+			* 
+			*	@return _flatNamespaces.
+			*/
+			RFK_NODISCARD inline FlatPtrSet<Namespace> const&	getFlatNamespaces()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatArchetypes.
+			* 
+			*	@return _flatArchetypes.
+			*/
+			RFK_NODISCARD inline FlatPtrSet<Archetype> const&	getFlatArchetypes()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatVariables.
+			* 
+			*	@return _flatVariables.
+			*/
+			RFK_NODISCARD inline FlatPtrSet<Variable> const&	getFlatVariables()								const	noexcept;
+
+			/**
+			*	@brief Getter for the field _flatFunctions.
+			* 
+			*	@return _flatFunctions.
+			*/
+			RFK_NODISCARD inline FlatPtrSet<Function> const&	getFlatFunctions()								const	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/Namespace/NamespaceImpl.inl"
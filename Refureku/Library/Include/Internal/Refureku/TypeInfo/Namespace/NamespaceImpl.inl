@@ -12,42 +12,70 @@ inline Namespace::NamespaceImpl::NamespaceImpl(char const* name, std::size_t id)
 
 inline void Namespace::NamespaceImpl::addNamespace(Namespace const& nestedNamespace) noexcept
 {
-	_namespaces.emplace(&nestedNamespace);
+	_flatNamespaces.addSynced(_namespaces, &nestedNamespace);
 }
 
 inline void Namespace::NamespaceImpl::addArchetype(Archetype const& archetype) noexcept
 {
-	_archetypes.emplace(&archetype);
+	_flatArchetypes.addSynced(_archetypes, &archetype);
 }
 
 inline void Namespace::NamespaceImpl::addVariable(Variable const& variable) noexcept
 {
-	_variables.emplace(&variable);
+	_flatVariables.addSynced(_variables, &variable);
 }
 
 inline void Namespace::NamespaceImpl::addFunction(Function const& function) noexcept
 {
-	_functions.emplace(&function);
+	_flatFunctions.addSynced(_functions, &function);
 }
 
 inline void Namespace::NamespaceImpl::removeNamespace(Namespace const& nestedNamespace) noexcept
 {
-	_namespaces.erase(&nestedNamespace);
+	_flatNamespaces.removeSynced(_namespaces, &nestedNamespace);
 }
 
 inline void Namespace::NamespaceImpl::removeArchetype(Archetype const& archetype) noexcept
 {
-	_archetypes.erase(&archetype);
+	_flatArchetypes.removeSynced(_archetypes, &archetype);
 }
 
 inline void Namespace::NamespaceImpl::removeVariable(Variable const& variable) noexcept
 {
-	_variables.erase(&variable);
+	_flatVariables.removeSynced(_variables, &variable);
 }
 
 inline void Namespace::NamespaceImpl::removeFunction(Function const& function) noexcept
 {
-	_functions.erase(&function);
+	_flatFunctions.removeSynced(_functions, &function);
+}
+
+inline void Namespace::NamespaceImpl::addNestedEntities(Namespace const* const* namespaces, std::size_t namespacesCount, Archetype const* const* archetypes, std::size_t archetypesCount,
+															Variable const* const* variables, std::size_t variablesCount, Function const* const* functions, std::size_t functionsCount) noexcept
+{
+	if (namespacesCount != 0u)
+	{
+		Algorithm::reserveAdditional(_namespaces, namespacesCount);
+		_flatNamespaces.addSynced(_namespaces, namespaces, namespacesCount);
+	}
+
+	if (archetypesCount != 0u)
+	{
+		Algorithm::reserveAdditional(_archetypes, archetypesCount);
+		_flatArchetypes.addSynced(_archetypes, archetypes, archetypesCount);
+	}
+
+	if (variablesCount != 0u)
+	{
+		Algorithm::reserveAdditional(_variables, variablesCount);
+		_flatVariables.addSynced(_variables, variables, variablesCount);
+	}
+
+	if (functionsCount != 0u)
+	{
+		Algorithm::reserveAdditional(_functions, functionsCount);
+		_flatFunctions.addSynced(_functions, functions, functionsCount);
+	}
 }
 
 inline void Namespace::NamespaceImpl::setOuterEntity(Entity& entity, Namespace const& ref) const noexcept
@@ -73,4 +101,24 @@ inline Namespace::NamespaceImpl::VariableHashSet const& Namespace::NamespaceImpl
 inline Namespace::NamespaceImpl::FunctionHashSet const& Namespace::NamespaceImpl::getFunctions() const noexcept
 {
 	return _functions;
+}
+
+inline FlatPtrSet<Namespace> const& Namespace::NamespaceImpl::getFlatNamespaces() const noexcept
+{
+	return _flatNamespaces;
+}
+
+inline FlatPtrSet<Archetype> const& Namespace::NamespaceImpl::getFlatArchetypes() const noexcept
+{
+	return _flatArchetypes;
+}
+
+inline FlatPtrSet<Variable> const& Namespace::NamespaceImpl::getFlatVariables() const noexcept
+{
+	return _flatVariables;
+}
+
+inline FlatPtrSet<Function> const& Namespace::NamespaceImpl::getFlatFunctions() const noexcept
+{
+	return _flatFunctions;
 }
\ No newline at end of file
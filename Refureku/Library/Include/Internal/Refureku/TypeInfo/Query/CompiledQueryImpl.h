@@ -0,0 +1,193 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <cstring>	//std::strncmp
+#include <limits>	//std::numeric_limits
+
+#include "Refureku/TypeInfo/Query/CompiledQuery.h"
+#include "Refureku/TypeInfo/Query/EntityQueryImpl.h"
+#include "Refureku/TypeInfo/DatabaseImpl.h"
+#include "Refureku/Containers/SmallVector.h"
+
+namespace rfk
+{
+	class internal::CompiledQueryImpl final
+	{
+		private:
+			/** Estimated candidates count of an index that can't serve the query. */
+			static constexpr std::size_t	unavailableSource	= std::numeric_limits<std::size_t>::max();
+
+			/** Kinds of entities which can be registered at file level. */
+			static constexpr EEntityKind	fileLevelKinds		= EEntityKind::Namespace | EEntityKind::Struct | EEntityKind::Class | EEntityKind::Enum |
+																  EEntityKind::FundamentalArchetype | EEntityKind::Variable | EEntityKind::Function;
+
+			/** Filters of the query. */
+			EntityQueryImpl	_criteria;
+
+			/** Kinds of the matched entities, narrowed down by the filters implying a kind (flags, base struct, file level). */
+			EEntityKind		_kinds;
+
+			/** Index the candidate entities are drawn from. */
+			EQuerySource	_source;
+
+			/** Number of candidates the chosen index was estimated to provide at compilation. */
+			std::size_t		_estimatedCandidatesCount;
+
+			/** Human readable description of the plan. */
+			std::string		_explanation;
+
+			/**
+			*	@brief Check whether an entity passes all the filters of the query.
+			* 
+			*	@param entity					The checked entity.
+			*	@param isDerivedFromBaseChecked	Is the base struct filter already guaranteed by the index the entity is drawn from?
+			*	@param isPropertyChecked		Is the property filter already guaranteed by the index the entity is drawn from?
+			* 
+			*	@return true if the entity matches the query, else false.
+			*/
+			RFK_NODISCARD inline bool			matches(Entity const&	entity,
+														bool			isDerivedFromBaseChecked,
+														bool			isPropertyChecked)						const	noexcept;
+
+			/**
+			*	@brief Check whether a struct or the outer struct of a member inherits from the queried base struct.
+			* 
+			*	@param entity The checked entity.
+			* 
+			*	@return true if the entity passes the base struct filter, else false.
+			*/
+			RFK_NODISCARD inline bool			isDerivedFromBase(Entity const& entity)							const	noexcept;
+
+			/**
+			*	@brief Check whether an entity is registered to the database.
+			* 
+			*	@param entity The checked entity.
+			* 
+			*	@return true if entity is registered to the database, else false.
+			*/
+			RFK_NODISCARD inline static bool	isRegistered(Entity const& entity)										noexcept;
+
+			/**
+			*	@brief Get the access specifier of an entity.
+			* 
+			*	@param entity	The entity.
+			*	@param kind		The kind of the entity.
+			* 
+			*	@return The access specifier of the entity, EAccessSpecifier::Undefined if the entity kind has no access specifier.
+			*/
+			RFK_NODISCARD inline static EAccessSpecifier	getAccess(Entity const&	entity,
+																	  EEntityKind	kind)							noexcept;
+
+			/**
+			*	@brief Execute a callable on the queried base struct (if included) and all its subclasses.
+			* 
+			*	@param visitor Callable taking a Struct const&. Return false to abort the loop.
+			* 
+			*	@return The last visitor result before exiting the loop.
+			*/
+			template <typename Visitor>
+			inline bool							foreachBaseStructAndSubclass(Visitor&& visitor)					const;
+
+			/**
+			*	@brief Execute a callable on the property index entries the query draws its candidates from.
+			* 
+			*	@param visitor Callable taking the property archetype and the set of entities carrying a property of that archetype. Return false to abort the loop.
+			* 
+			*	@return The last visitor result before exiting the loop.
+			*/
+			template <typename Visitor>
+			inline bool							foreachPropertyIndexEntry(Visitor&& visitor)					const;
+
+			/**
+			*	@brief Estimate the number of candidates each index would provide. Unavailable indices are estimated to unavailableSource.
+			*/
+			RFK_NODISCARD inline std::size_t	estimateFullScan()												const	noexcept;
+			RFK_NODISCARD inline std::size_t	estimateFileLevelIndex()										const	noexcept;
+			RFK_NODISCARD inline std::size_t	estimateSubclassTable()											const	noexcept;
+			RFK_NODISCARD inline std::size_t	estimatePropertyIndex()											const	noexcept;
+
+			/**
+			*	@brief Execute a callable on all the candidates drawn from an index.
+			* 
+			*	@param visitor Callable taking an Entity const&. Return false to abort the loop.
+			* 
+			*	@return The last visitor result before exiting the loop.
+			*/
+			template <typename Visitor>
+			inline bool							foreachFullScanCandidate(Visitor&& visitor)						const;
+
+			template <typename Visitor>
+			inline bool							foreachFileLevelIndexCandidate(Visitor&& visitor)				const;
+
+			/** The subclass table visitor also receives the struct owning the candidate (the candidate itself for structs). */
+			template <typename Visitor>
+			inline bool							foreachSubclassTableCandidate(Visitor&& visitor)				const;
+
+			template <typename Visitor>
+			inline bool							foreachPropertyIndexCandidate(Visitor&& visitor)				const;
+
+			/**
+			*	@brief Choose the most selective index able to serve the query and describe the plan in _explanation.
+			*/
+			inline void							plan()																	noexcept;
+
+			/**
+			*	@brief Get a human readable name of an index.
+			* 
+			*	@param source The index.
+			* 
+			*	@return The name of the index, followed by the entity it is keyed by if any.
+			*/
+			RFK_NODISCARD inline std::string	getSourceName(EQuerySource source)								const	noexcept;
+
+			/**
+			*	@brief Get a human readable description of the filters of the query.
+			* 
+			*	@return The description of the filters.
+			*/
+			RFK_NODISCARD inline std::string	getFiltersDescription()											const	noexcept;
+
+		public:
+			inline CompiledQueryImpl(EntityQueryImpl const& criteria)	noexcept;
+
+			/**
+			*	@brief Execute a callable on all entities matching the query.
+			* 
+			*	@param visitor Callable taking an Entity const&. Return false to abort the loop.
+			* 
+			*	@return The last visitor result before exiting the loop.
+			*/
+			template <typename Visitor>
+			inline bool								foreach(Visitor&& visitor)								const;
+
+			/**
+			*	@brief Getter for the field _source.
+			* 
+			*	@return _source.
+			*/
+			RFK_NODISCARD inline EQuerySource		getSource()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _estimatedCandidatesCount.
+			* 
+			*	@return _estimatedCandidatesCount.
+			*/
+			RFK_NODISCARD inline std::size_t		getEstimatedCandidatesCount()					const	noexcept;
+
+			/**
+			*	@brief Getter for the field _explanation.
+			* 
+			*	@return _explanation.
+			*/
+			RFK_NODISCARD inline std::string const&	getExplanation()								const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Query/CompiledQueryImpl.inl"
+}
\ No newline at end of file
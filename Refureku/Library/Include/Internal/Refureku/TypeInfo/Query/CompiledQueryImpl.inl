@@ -0,0 +1,666 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline internal::CompiledQueryImpl::CompiledQueryImpl(EntityQueryImpl const& criteria) noexcept:
+	_criteria{criteria},
+	_kinds{criteria.kinds & EntityQueryImpl::queryableKinds},
+	_source{EQuerySource::FullScan},
+	_estimatedCandidatesCount{0u}
+{
+	//Narrow down the kinds so that the indices can rely on them
+	if (_criteria.hasFieldFlags)
+	{
+		_kinds = _kinds & EEntityKind::Field;
+	}
+
+	if (_criteria.hasMethodFlags)
+	{
+		_kinds = _kinds & EEntityKind::Method;
+	}
+
+	if (_criteria.baseStruct != nullptr)
+	{
+		_kinds = _kinds & (EEntityKind::Struct | EEntityKind::Class | EEntityKind::Field | EEntityKind::Method);
+	}
+
+	if (_criteria.isFileLevelOnly)
+	{
+		_kinds = _kinds & fileLevelKinds;
+	}
+
+	plan();
+}
+
+inline bool internal::CompiledQueryImpl::matches(Entity const& entity, bool isDerivedFromBaseChecked, bool isPropertyChecked) const noexcept
+{
+	EEntityKind kind = entity.getKind();
+
+	//Cheapest filters first
+	if ((kind & _kinds) == EEntityKind::Undefined)
+	{
+		return false;
+	}
+
+	if (_criteria.hasName && !entity.hasSameName(_criteria.name.c_str()))
+	{
+		return false;
+	}
+
+	if (!_criteria.namePrefix.empty() && std::strncmp(entity.getName(), _criteria.namePrefix.c_str(), _criteria.namePrefix.size()) != 0)
+	{
+		return false;
+	}
+
+	if (_criteria.isFileLevelOnly && entity.getOuterEntity() != nullptr)
+	{
+		return false;
+	}
+
+	if (_criteria.hasAccess && getAccess(entity, kind) != _criteria.access)
+	{
+		return false;
+	}
+
+	//Kinds have been narrowed down to fields / methods if field / method flags are queried
+	if (_criteria.hasFieldFlags && (static_cast<FieldBase const&>(entity).getFlags() & _criteria.fieldFlags) != _criteria.fieldFlags)
+	{
+		return false;
+	}
+
+	if (_criteria.hasMethodFlags && (static_cast<MethodBase const&>(entity).getFlags() & _criteria.methodFlags) != _criteria.methodFlags)
+	{
+		return false;
+	}
+
+	if (!isDerivedFromBaseChecked && _criteria.baseStruct != nullptr && !isDerivedFromBase(entity))
+	{
+		return false;
+	}
+
+	return isPropertyChecked || _criteria.propertyArchetype == nullptr || entity.getProperty(*_criteria.propertyArchetype, _criteria.isChildPropertyValid) != nullptr;
+}
+
+inline bool internal::CompiledQueryImpl::isDerivedFromBase(Entity const& entity) const noexcept
+{
+	Entity const* s = &entity;
+
+	if (entity.getKind() == EEntityKind::Field || entity.getKind() == EEntityKind::Method)
+	{
+		s = entity.getOuterEntity();
+
+		if (s == nullptr || (s->getKind() != EEntityKind::Struct && s->getKind() != EEntityKind::Class))
+		{
+			return false;
+		}
+	}
+	else if (entity.getKind() != EEntityKind::Struct && entity.getKind() != EEntityKind::Class)
+	{
+		return false;
+	}
+
+	return _criteria.includeBaseStruct ?
+		_criteria.baseStruct->isBaseOf(static_cast<Struct const&>(*s)) :
+		static_cast<Struct const*>(s)->isSubclassOf(*_criteria.baseStruct);
+}
+
+inline bool internal::CompiledQueryImpl::isRegistered(Entity const& entity) noexcept
+{
+	auto const& entitiesById = Database::getInstance()._pimpl->getEntitiesById();
+	auto		it			 = entitiesById.find(&entity);
+
+	return it != entitiesById.cend() && *it == &entity;
+}
+
+inline EAccessSpecifier internal::CompiledQueryImpl::getAccess(Entity const& entity, EEntityKind kind) noexcept
+{
+	switch (kind)
+	{
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+			[[fallthrough]];
+		case EEntityKind::Enum:
+			[[fallthrough]];
+		case EEntityKind::FundamentalArchetype:
+			return static_cast<Archetype const&>(entity).getAccessSpecifier();
+
+		case EEntityKind::Field:
+			return static_cast<FieldBase const&>(entity).getAccess();
+
+		case EEntityKind::Method:
+			return static_cast<MethodBase const&>(entity).getAccess();
+
+		default:
+			return EAccessSpecifier::Undefined;
+	}
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachBaseStructAndSubclass(Visitor&& visitor) const
+{
+	if (_criteria.includeBaseStruct && !visitor(*_criteria.baseStruct))
+	{
+		return false;
+	}
+
+	return _criteria.baseStruct->foreachSubclass(visitor);
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachPropertyIndexEntry(Visitor&& visitor) const
+{
+	Database::DatabaseImpl const& database = *Database::getInstance()._pimpl;
+
+	FlatPtrSet<Entity> const* entities = database.getEntitiesWithProperty(*_criteria.propertyArchetype);
+
+	if (entities != nullptr && !visitor(*_criteria.propertyArchetype, *entities))
+	{
+		return false;
+	}
+
+	if (_criteria.isChildPropertyValid)
+	{
+		return _criteria.propertyArchetype->foreachSubclass([&database, &visitor](Struct const& propertyArchetype)
+															{
+																FlatPtrSet<Entity> const* entities = database.getEntitiesWithProperty(propertyArchetype);
+
+																return entities == nullptr || visitor(propertyArchetype, *entities);
+															});
+	}
+
+	return true;
+}
+
+inline std::size_t internal::CompiledQueryImpl::estimateFullScan() const noexcept
+{
+	return Database::getInstance()._pimpl->getEntitiesById().size();
+}
+
+inline std::size_t internal::CompiledQueryImpl::estimateFileLevelIndex() const noexcept
+{
+	if (!_criteria.isFileLevelOnly)
+	{
+		return unavailableSource;
+	}
+
+	std::size_t result = 0u;
+
+	//By-name lookups are cheap enough to count the exact number of candidates
+	foreachFileLevelIndexCandidate([&result](Entity const&)
+								   {
+									   result++;
+
+									   return true;
+								   });
+
+	return result;
+}
+
+inline std::size_t internal::CompiledQueryImpl::estimateSubclassTable() const noexcept
+{
+	if (_criteria.baseStruct == nullptr)
+	{
+		return unavailableSource;
+	}
+
+	std::size_t result		= 0u;
+	EEntityKind	memberKinds	= _kinds & (EEntityKind::Field | EEntityKind::Method);
+	bool		hasName		= _criteria.hasName;
+
+	foreachBaseStructAndSubclass([&result, memberKinds, hasName](Struct const& s)
+								 {
+									 //The struct itself
+									 result++;
+
+									 //One lookup per member kind when a name is queried, else all the members of the queried kinds
+									 if ((memberKinds & EEntityKind::Field) != EEntityKind::Undefined)
+									 {
+										 result += hasName ? 2u : s.getFieldsCount() + s.getStaticFieldsCount();
+									 }
+
+									 if ((memberKinds & EEntityKind::Method) != EEntityKind::Undefined)
+									 {
+										 result += hasName ? 2u : s.getMethodsCount() + s.getStaticMethodsCount();
+									 }
+
+									 return true;
+								 });
+
+	return result;
+}
+
+inline std::size_t internal::CompiledQueryImpl::estimatePropertyIndex() const noexcept
+{
+	if (_criteria.propertyArchetype == nullptr)
+	{
+		return unavailableSource;
+	}
+
+	std::size_t result = 0u;
+
+	foreachPropertyIndexEntry([&result](Struct const&, FlatPtrSet<Entity> const& entities)
+							  {
+								  result += entities.getSpan().size();
+
+								  return true;
+							  });
+
+	//Namespaces are not indexed so they are all inspected
+	if ((_kinds & EEntityKind::Namespace) != EEntityKind::Undefined)
+	{
+		result += Database::getInstance()._pimpl->getGeneratedNamespaces().size();
+	}
+
+	return result;
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachFullScanCandidate(Visitor&& visitor) const
+{
+	for (Entity const* entity : Database::getInstance()._pimpl->getEntitiesById())
+	{
+		if (!visitor(*entity))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachFileLevelIndexCandidate(Visitor&& visitor) const
+{
+	Database::DatabaseImpl const& database = *Database::getInstance()._pimpl;
+
+	auto foreachInSet = [this, &visitor](auto const& byNameSet, auto const& flatSet)
+	{
+		if (_criteria.hasName)
+		{
+			return Algorithm::foreachEntityNamed(byNameSet, _criteria.name.c_str(), [&visitor](Entity const& entity) { return visitor(entity); });
+		}
+		else
+		{
+			for (Entity const* entity : flatSet.getSpan())
+			{
+				if (!visitor(*entity))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	if ((_kinds & EEntityKind::Namespace) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelNamespacesByName(), database.getFlatFileLevelNamespaces()))
+	{
+		return false;
+	}
+
+	if ((_kinds & EEntityKind::Struct) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelStructsByName(), database.getFlatFileLevelStructs()))
+	{
+		return false;
+	}
+
+	if ((_kinds & EEntityKind::Class) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelClassesByName(), database.getFlatFileLevelClasses()))
+	{
+		return false;
+	}
+
+	if ((_kinds & EEntityKind::Enum) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelEnumsByName(), database.getFlatFileLevelEnums()))
+	{
+		return false;
+	}
+
+	if ((_kinds & EEntityKind::Variable) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelVariablesByName(), database.getFlatFileLevelVariables()))
+	{
+		return false;
+	}
+
+	if ((_kinds & EEntityKind::Function) != EEntityKind::Undefined &&
+		!foreachInSet(database.getFileLevelFunctionsByName(), database.getFlatFileLevelFunctions()))
+	{
+		return false;
+	}
+
+	//Fundamental archetypes have no flat set
+	if ((_kinds & EEntityKind::FundamentalArchetype) != EEntityKind::Undefined)
+	{
+		if (_criteria.hasName)
+		{
+			return Algorithm::foreachEntityNamed(database.getFundamentalArchetypesByName(), _criteria.name.c_str(), [&visitor](Entity const& entity) { return visitor(entity); });
+		}
+
+		for (FundamentalArchetype const* archetype : database.getFundamentalArchetypesByName())
+		{
+			if (!visitor(*archetype))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachSubclassTableCandidate(Visitor&& visitor) const
+{
+	EEntityKind	structKinds	= _kinds & (EEntityKind::Struct | EEntityKind::Class);
+	EEntityKind	memberKinds	= _kinds & (EEntityKind::Field | EEntityKind::Method);
+
+	return foreachBaseStructAndSubclass([this, &visitor, structKinds, memberKinds](Struct const& s)
+										{
+											if ((s.getKind() & structKinds) != EEntityKind::Undefined && !visitor(s, s))
+											{
+												return false;
+											}
+
+											auto visitOwnMembers = [&s, &visitor](auto const& members)
+											{
+												for (Entity const* member : members)
+												{
+													//Member spans also contain the members inherited from parent structs
+													if (member->getOuterEntity() == &s && !visitor(*member, s))
+													{
+														return false;
+													}
+												}
+
+												return true;
+											};
+
+											if ((memberKinds & EEntityKind::Field) != EEntityKind::Undefined)
+											{
+												if (_criteria.hasName)
+												{
+													Field const*		field		= s.getFieldByName(_criteria.name.c_str());
+													StaticField const*	staticField	= s.getStaticFieldByName(_criteria.name.c_str());
+
+													if ((field != nullptr && !visitor(*field, s)) || (staticField != nullptr && !visitor(*staticField, s)))
+													{
+														return false;
+													}
+												}
+												else if (!visitOwnMembers(s.getFieldsSpan()) || !visitOwnMembers(s.getStaticFieldsSpan()))
+												{
+													return false;
+												}
+											}
+
+											if ((memberKinds & EEntityKind::Method) != EEntityKind::Undefined)
+											{
+												if (_criteria.hasName)
+												{
+													if (!visitOwnMembers(s.getMethodsByName<8u>(_criteria.name.c_str())) ||
+														!visitOwnMembers(s.getStaticMethodsByName<8u>(_criteria.name.c_str())))
+													{
+														return false;
+													}
+												}
+												else if (!visitOwnMembers(s.getMethodsSpan()) || !visitOwnMembers(s.getStaticMethodsSpan()))
+												{
+													return false;
+												}
+											}
+
+											return true;
+										});
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreachPropertyIndexCandidate(Visitor&& visitor) const
+{
+	bool result = foreachPropertyIndexEntry([this, &visitor](Struct const& propertyArchetype, FlatPtrSet<Entity> const& entities)
+											{
+												for (Entity const* entity : entities.getSpan())
+												{
+													//An entity carrying several matching properties is in several sets:
+													//only visit it from the set of its first matching property
+													if (_criteria.isChildPropertyValid &&
+														&entity->getProperty(*_criteria.propertyArchetype, true)->getArchetype() != &propertyArchetype)
+													{
+														continue;
+													}
+
+													if (!visitor(*entity))
+													{
+														return false;
+													}
+												}
+
+												return true;
+											});
+
+	if (result && (_kinds & EEntityKind::Namespace) != EEntityKind::Undefined)
+	{
+		for (auto const& [id, generatedNamespace] : Database::getInstance()._pimpl->getGeneratedNamespaces())
+		{
+			if (!visitor(*generatedNamespace))
+			{
+				return false;
+			}
+		}
+	}
+
+	return result;
+}
+
+template <typename Visitor>
+inline bool internal::CompiledQueryImpl::foreach(Visitor&& visitor) const
+{
+	//Filters guaranteed by the index are not checked again
+	switch (_source)
+	{
+		case EQuerySource::FileLevelIndex:
+			return foreachFileLevelIndexCandidate([this, &visitor](Entity const& entity) { return !matches(entity, false, false) || visitor(entity); });
+
+		case EQuerySource::SubclassTable:
+		{
+			//Subclass tables also reference reflected structs which are not registered to the database.
+			//The registration of the struct owning a match is checked once, since the members of a struct are visited in a row.
+			Entity const*	lastOwner				= nullptr;
+			bool			isLastOwnerRegistered	= false;
+
+			return foreachSubclassTableCandidate([this, &visitor, &lastOwner, &isLastOwnerRegistered](Entity const& entity, Struct const& owner)
+												 {
+													 if (!matches(entity, true, false))
+													 {
+														 return true;
+													 }
+
+													 if (&owner != lastOwner)
+													 {
+														 lastOwner				= &owner;
+														 isLastOwnerRegistered	= isRegistered(owner);
+													 }
+
+													 return !isLastOwnerRegistered || visitor(entity);
+												 });
+		}
+
+		case EQuerySource::PropertyIndex:
+			//Namespaces are not drawn from the property index so their properties must be checked
+			return foreachPropertyIndexCandidate([this, &visitor](Entity const& entity) { return !matches(entity, false, entity.getKind() != EEntityKind::Namespace) || visitor(entity); });
+
+		case EQuerySource::FullScan:
+			[[fallthrough]];
+		default:
+			return foreachFullScanCandidate([this, &visitor](Entity const& entity) { return !matches(entity, false, false) || visitor(entity); });
+	}
+}
+
+inline void internal::CompiledQueryImpl::plan() noexcept
+{
+	struct Candidate
+	{
+		EQuerySource	source;
+		std::size_t		estimatedCandidatesCount;
+	};
+
+	//Ordered by preference when estimations are equal
+	Candidate candidates[] =
+	{
+		{ EQuerySource::FileLevelIndex,	estimateFileLevelIndex() },
+		{ EQuerySource::PropertyIndex,	estimatePropertyIndex() },
+		{ EQuerySource::SubclassTable,	estimateSubclassTable() },
+		{ EQuerySource::FullScan,		estimateFullScan() }
+	};
+
+	Candidate const* chosen = &candidates[0];
+
+	for (Candidate const& candidate : candidates)
+	{
+		if (candidate.estimatedCandidatesCount < chosen->estimatedCandidatesCount)
+		{
+			chosen = &candidate;
+		}
+	}
+
+	_source						= chosen->source;
+	_estimatedCandidatesCount	= chosen->estimatedCandidatesCount;
+
+	//Describe the plan
+	_explanation = "Source: " + getSourceName(_source) + " (" + std::to_string(_estimatedCandidatesCount) + " candidate(s))\nOther indices:";
+
+	bool hasOtherIndex = false;
+
+	for (Candidate const& candidate : candidates)
+	{
+		if (&candidate != chosen && candidate.estimatedCandidatesCount != unavailableSource)
+		{
+			_explanation += (hasOtherIndex ? ", " : " ") + getSourceName(candidate.source) + " (" + std::to_string(candidate.estimatedCandidatesCount) + " candidate(s))";
+			hasOtherIndex = true;
+		}
+	}
+
+	if (!hasOtherIndex)
+	{
+		_explanation += " none";
+	}
+
+	_explanation += "\nFilters: " + getFiltersDescription();
+}
+
+inline std::string internal::CompiledQueryImpl::getSourceName(EQuerySource source) const noexcept
+{
+	switch (source)
+	{
+		case EQuerySource::FileLevelIndex:
+			return _criteria.hasName ? "file level by-name sets" : "file level sets";
+
+		case EQuerySource::SubclassTable:
+			return std::string("subclass table [") + _criteria.baseStruct->getName() + "]";
+
+		case EQuerySource::PropertyIndex:
+			return std::string("property index [") + _criteria.propertyArchetype->getName() + (_criteria.isChildPropertyValid ? " and subclasses]" : "]");
+
+		case EQuerySource::FullScan:
+			[[fallthrough]];
+		default:
+			return "full scan";
+	}
+}
+
+inline std::string internal::CompiledQueryImpl::getFiltersDescription() const noexcept
+{
+	static constexpr std::pair<EEntityKind, char const*> kindNames[] =
+	{
+		{ EEntityKind::Namespace, "Namespace" },
+		{ EEntityKind::Class, "Class" },
+		{ EEntityKind::Struct, "Struct" },
+		{ EEntityKind::Enum, "Enum" },
+		{ EEntityKind::FundamentalArchetype, "FundamentalArchetype" },
+		{ EEntityKind::Variable, "Variable" },
+		{ EEntityKind::Field, "Field" },
+		{ EEntityKind::Function, "Function" },
+		{ EEntityKind::Method, "Method" },
+		{ EEntityKind::EnumValue, "EnumValue" }
+	};
+
+	static constexpr char const* accessNames[] = { "Undefined", "Public", "Protected", "Private" };
+
+	std::string result = "kind ";
+	bool		hasKind = false;
+
+	for (auto const& [kind, kindName] : kindNames)
+	{
+		if ((_kinds & kind) != EEntityKind::Undefined)
+		{
+			result += (hasKind ? "|" : "") + std::string(kindName);
+			hasKind = true;
+		}
+	}
+
+	if (!hasKind)
+	{
+		result += "none";
+	}
+
+	if (_criteria.hasName)
+	{
+		result += ", name \"" + _criteria.name + "\"";
+	}
+
+	if (!_criteria.namePrefix.empty())
+	{
+		result += ", name prefix \"" + _criteria.namePrefix + "\"";
+	}
+
+	if (_criteria.isFileLevelOnly)
+	{
+		result += ", file level";
+	}
+
+	if (_criteria.baseStruct != nullptr)
+	{
+		result += std::string(", derived from ") + _criteria.baseStruct->getName() + (_criteria.includeBaseStruct ? " (included)" : "");
+	}
+
+	if (_criteria.propertyArchetype != nullptr)
+	{
+		result += std::string(", property ") + _criteria.propertyArchetype->getName() + (_criteria.isChildPropertyValid ? " (or child)" : "");
+	}
+
+	if (_criteria.hasAccess)
+	{
+		result += std::string(", access ") + accessNames[static_cast<std::size_t>(_criteria.access)];
+	}
+
+	if (_criteria.hasFieldFlags)
+	{
+		result += ", field flags " + std::to_string(static_cast<std::size_t>(_criteria.fieldFlags));
+	}
+
+	if (_criteria.hasMethodFlags)
+	{
+		result += ", method flags " + std::to_string(static_cast<std::size_t>(_criteria.methodFlags));
+	}
+
+	return result;
+}
+
+inline EQuerySource internal::CompiledQueryImpl::getSource() const noexcept
+{
+	return _source;
+}
+
+inline std::size_t internal::CompiledQueryImpl::getEstimatedCandidatesCount() const noexcept
+{
+	return _estimatedCandidatesCount;
+}
+
+inline std::string const& internal::CompiledQueryImpl::getExplanation() const noexcept
+{
+	return _explanation;
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>			//std::size_t
+#include <cstring>			//std::strncmp, std::strcmp, std::strlen
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_set>
+#include <mutex>
+#include <atomic>
+#include <algorithm>		//std::sort, std::lower_bound, std::inplace_merge, std::remove_if
+#include <functional>		//std::less
+
+#include "Refureku/TypeInfo/Entity/Entity.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Index of the registered entities sorted by name, answering name prefix queries.
+	*	The index is built from the registered entities the first time it is queried.
+	*	Once built, (un)registered entities are recorded and merged into the index by the next query,
+	*	so registering or unregistering a module never re-sorts the whole index.
+	*	Names are folded to ASCII lower case so that case sensitive and insensitive queries share the same order.
+	*
+	*	Queries can run concurrently. The database must not be modified during a query.
+	*/
+	class EntityNameIndex
+	{
+		private:
+			struct Entry
+			{
+				/** Name of the entity folded to lower case. */
+				std::string		foldedName;
+
+				/** The indexed entity. */
+				Entity const*	entity;
+
+				/** Outer entity of the indexed entity, read when the entity is indexed. */
+				Entity const*	outerEntity;
+
+				/** Kind of the indexed entity. */
+				EEntityKind		kind;
+			};
+
+			/** Entries sorted by folded name, then by name, then by id. */
+			mutable std::vector<Entry>					_entries;
+
+			/** Indices of _entries sorted by outer entity, then by index. Built by the first scoped query after each update. */
+			mutable std::vector<std::size_t>			_entriesByOuter;
+
+			/** Entities registered since the last update. They are only read once the index is updated. */
+			mutable std::unordered_set<Entity const*>	_pendingInsertions;
+
+			/** Entities unregistered since the last update. They are never read since they might have been destroyed. */
+			mutable std::unordered_set<Entity const*>	_pendingRemovals;
+
+			/** Is the index built? Registrations are not recorded before the index is queried for the first time. */
+			mutable bool								_isBuilt				= false;
+
+			/** Does _entries reflect the registered entities? */
+			mutable std::atomic<bool>					_isUpToDate				= false;
+
+			/** Does _entriesByOuter reflect _entries? */
+			mutable std::atomic<bool>					_isOuterOrderUpToDate	= false;
+
+			/** Mutex held while the index is updated. */
+			mutable std::mutex							_updateMutex;
+
+			/**
+			*	@brief Fold an ASCII character to lower case.
+			*
+			*	@param c The character to fold.
+			*
+			*	@return The lower case character.
+			*/
+			RFK_NODISCARD static inline char	foldCase(char c)										noexcept;
+
+			/**
+			*	@brief Fold a string to lower case.
+			*
+			*	@param str The string to fold.
+			*
+			*	@return The folded string.
+			*/
+			RFK_NODISCARD static inline std::string	foldCase(char const* str)							noexcept;
+
+			/**
+			*	@brief Make the index entry of a registered entity.
+			*
+			*	@param entity The entity to index.
+			*
+			*	@return The entry of the entity.
+			*/
+			RFK_NODISCARD static inline Entry	makeEntry(Entity const& entity)							noexcept;
+
+			/**
+			*	@brief Entries order: folded name, then name, then id so that the order doesn't depend on the registration order.
+			*
+			*	@return true if lhs is ordered before rhs.
+			*/
+			RFK_NODISCARD static inline bool	isOrderedBefore(Entry const&	lhs,
+																Entry const&	rhs)					noexcept;
+
+			/**
+			*	@brief	Bring _entries up to date with the registered entities.
+			*			The first call builds the index from the provided entities, the next ones merge the pending changes.
+			*
+			*	@param registeredEntities Container of all the entities registered to the database.
+			*/
+			template <typename EntitiesContainer>
+			void								update(EntitiesContainer const& registeredEntities)		const	noexcept;
+
+			/**
+			*	@brief Bring _entriesByOuter up to date with _entries.
+			*/
+			inline void							updateOuterOrder()										const	noexcept;
+
+			/**
+			*	@brief Execute the visitor on an entry if it matches the query.
+			*
+			*	@return false if the visitor returned false, else true.
+			*/
+			template <typename Visitor>
+			static bool							visitIfMatching(Entry const&	entry,
+																char const*		prefix,
+																std::size_t		prefixLength,
+																EEntityKind		kinds,
+																bool			isCaseSensitive,
+																Visitor&		visitor);
+
+		public:
+			EntityNameIndex()							= default;
+			EntityNameIndex(EntityNameIndex const&)		= delete;
+			EntityNameIndex(EntityNameIndex&&)			= delete;
+			~EntityNameIndex()							= default;
+
+			/**
+			*	@brief Record a newly registered entity. Does nothing if the index is not built yet.
+			*
+			*	@param entity The registered entity.
+			*/
+			inline void	onEntityRegistered(Entity const& entity)									noexcept;
+
+			/**
+			*	@brief Record an unregistered entity. Does nothing if the index is not built yet.
+			*
+			*	@param entity The unregistered entity. It is never dereferenced.
+			*/
+			inline void	onEntityUnregistered(Entity const& entity)									noexcept;
+
+			/**
+			*	@brief	Execute the visitor on all indexed entities which name starts with the provided prefix, in name order.
+			*			The index is updated first if entities have been (un)registered since the last query.
+			*
+			*	@param registeredEntities	Container of all the entities registered to the database.
+			*	@param prefix				Prefix of the names.
+			*	@param kinds				Bitmask of the kinds of the visited entities.
+			*	@param isCaseSensitive		Should the prefix be compared case sensitively?
+			*	@param outerEntity			If not nullptr, only the entities directly nested in this entity are visited.
+			*	@param visitor				Callable taking an Entity const& and returning false to abort the traversal.
+			*
+			*	@return false if the visitor returned false, else true.
+			*/
+			template <typename EntitiesContainer, typename Visitor>
+			bool		foreachEntityByNamePrefix(EntitiesContainer const&	registeredEntities,
+												  char const*				prefix,
+												  EEntityKind				kinds,
+												  bool						isCaseSensitive,
+												  Entity const*				outerEntity,
+												  Visitor&&					visitor)			const;
+
+		friend MemoryFootprintCollector;
+	};
+
+	#include "Refureku/TypeInfo/Query/EntityNameIndex.inl"
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline char EntityNameIndex::foldCase(char c) noexcept
+{
+	return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline std::string EntityNameIndex::foldCase(char const* str) noexcept
+{
+	std::string result(str);
+
+	for (char& c : result)
+	{
+		c = foldCase(c);
+	}
+
+	return result;
+}
+
+inline EntityNameIndex::Entry EntityNameIndex::makeEntry(Entity const& entity) noexcept
+{
+	return Entry{foldCase(entity.getName()), &entity, entity.getOuterEntity(), entity.getKind()};
+}
+
+inline bool EntityNameIndex::isOrderedBefore(Entry const& lhs, Entry const& rhs) noexcept
+{
+	int result = lhs.foldedName.compare(rhs.foldedName);
+
+	if (result == 0)
+	{
+		result = std::strcmp(lhs.entity->getName(), rhs.entity->getName());
+	}
+
+	return (result == 0) ? lhs.entity->getId() < rhs.entity->getId() : result < 0;
+}
+
+inline void EntityNameIndex::onEntityRegistered(Entity const& entity) noexcept
+{
+	if (_isBuilt)
+	{
+		_pendingInsertions.insert(&entity);
+		_isUpToDate.store(false, std::memory_order_release);
+	}
+}
+
+inline void EntityNameIndex::onEntityUnregistered(Entity const& entity) noexcept
+{
+	if (_isBuilt)
+	{
+		//An entity registered since the last update is not in the index yet
+		if (_pendingInsertions.erase(&entity) == 0u)
+		{
+			_pendingRemovals.insert(&entity);
+		}
+
+		_isUpToDate.store(false, std::memory_order_release);
+	}
+}
+
+template <typename EntitiesContainer>
+void EntityNameIndex::update(EntitiesContainer const& registeredEntities) const noexcept
+{
+	if (_isUpToDate.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_updateMutex);
+
+	//Another query might have updated the index while this thread was waiting for the lock
+	if (_isUpToDate.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	if (!_isBuilt)
+	{
+		_entries.reserve(registeredEntities.size());
+
+		for (Entity const* entity : registeredEntities)
+		{
+			_entries.push_back(makeEntry(*entity));
+		}
+
+		std::sort(_entries.begin(), _entries.end(), &EntityNameIndex::isOrderedBefore);
+
+		_isBuilt = true;
+	}
+	else
+	{
+		if (!_pendingRemovals.empty())
+		{
+			_entries.erase(std::remove_if(_entries.begin(), _entries.end(), [this](Entry const& entry)
+										  {
+											  return _pendingRemovals.find(entry.entity) != _pendingRemovals.cend();
+										  }), _entries.end());
+
+			_pendingRemovals.clear();
+		}
+
+		if (!_pendingInsertions.empty())
+		{
+			//Sort the new entries only, then merge them with the already sorted ones
+			std::size_t sortedEntriesCount = _entries.size();
+
+			_entries.reserve(sortedEntriesCount + _pendingInsertions.size());
+
+			for (Entity const* entity : _pendingInsertions)
+			{
+				_entries.push_back(makeEntry(*entity));
+			}
+
+			std::sort(_entries.begin() + sortedEntriesCount, _entries.end(), &EntityNameIndex::isOrderedBefore);
+			std::inplace_merge(_entries.begin(), _entries.begin() + sortedEntriesCount, _entries.end(), &EntityNameIndex::isOrderedBefore);
+
+			_pendingInsertions.clear();
+		}
+	}
+
+	_isOuterOrderUpToDate.store(false, std::memory_order_relaxed);
+	_isUpToDate.store(true, std::memory_order_release);
+}
+
+inline void EntityNameIndex::updateOuterOrder() const noexcept
+{
+	if (_isOuterOrderUpToDate.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_updateMutex);
+
+	if (_isOuterOrderUpToDate.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	_entriesByOuter.resize(_entries.size());
+
+	for (std::size_t i = 0u; i < _entriesByOuter.size(); i++)
+	{
+		_entriesByOuter[i] = i;
+	}
+
+	//Stable sort keeps the name order within each outer entity
+	std::stable_sort(_entriesByOuter.begin(), _entriesByOuter.end(), [this](std::size_t lhs, std::size_t rhs)
+					 {
+						 return std::less<Entity const*>()(_entries[lhs].outerEntity, _entries[rhs].outerEntity);
+					 });
+
+	_isOuterOrderUpToDate.store(true, std::memory_order_release);
+}
+
+template <typename Visitor>
+bool EntityNameIndex::visitIfMatching(Entry const& entry, char const* prefix, std::size_t prefixLength, EEntityKind kinds, bool isCaseSensitive, Visitor& visitor)
+{
+	if ((entry.kind & kinds) == EEntityKind::Undefined)
+	{
+		return true;
+	}
+
+	//The folded name matches, check the actual case
+	if (isCaseSensitive && std::strncmp(entry.entity->getName(), prefix, prefixLength) != 0)
+	{
+		return true;
+	}
+
+	return static_cast<bool>(visitor(*entry.entity));
+}
+
+template <typename EntitiesContainer, typename Visitor>
+bool EntityNameIndex::foreachEntityByNamePrefix(EntitiesContainer const& registeredEntities, char const* prefix, EEntityKind kinds,
+												bool isCaseSensitive, Entity const* outerEntity, Visitor&& visitor) const
+{
+	update(registeredEntities);
+
+	std::string const	foldedPrefix = foldCase(prefix);
+	std::size_t const	prefixLength = foldedPrefix.size();
+
+	auto hasPrefix = [&foldedPrefix, prefixLength](Entry const& entry)
+	{
+		return entry.foldedName.compare(0u, prefixLength, foldedPrefix) == 0;
+	};
+
+	if (outerEntity == nullptr)
+	{
+		auto it = std::lower_bound(_entries.cbegin(), _entries.cend(), foldedPrefix, [](Entry const& entry, std::string const& value)
+								   {
+									   return entry.foldedName < value;
+								   });
+
+		for (; it != _entries.cend() && hasPrefix(*it); ++it)
+		{
+			if (!visitIfMatching(*it, prefix, prefixLength, kinds, isCaseSensitive, visitor))
+			{
+				return false;
+			}
+		}
+	}
+	else
+	{
+		updateOuterOrder();
+
+		//Range of the entities nested in outerEntity
+		auto first = std::lower_bound(_entriesByOuter.cbegin(), _entriesByOuter.cend(), outerEntity, [this](std::size_t index, Entity const* value)
+									  {
+										  return std::less<Entity const*>()(_entries[index].outerEntity, value);
+									  });
+		auto last = std::upper_bound(first, _entriesByOuter.cend(), outerEntity, [this](Entity const* value, std::size_t index)
+									 {
+										 return std::less<Entity const*>()(value, _entries[index].outerEntity);
+									 });
+
+		//The range is sorted by name
+		auto it = std::lower_bound(first, last, foldedPrefix, [this](std::size_t index, std::string const& value)
+								   {
+									   return _entries[index].foldedName < value;
+								   });
+
+		for (; it != last && hasPrefix(_entries[*it]); ++it)
+		{
+			if (!visitIfMatching(_entries[*it], prefix, prefixLength, kinds, isCaseSensitive, visitor))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "Refureku/TypeInfo/Query/EntityQuery.h"
+
+namespace rfk
+{
+	/**
+	*	Filters of an EntityQuery.
+	*	The filters are plain data since they are read as is by the compiled query.
+	*/
+	class internal::EntityQueryImpl final
+	{
+		public:
+			/** All the kinds a query can match: namespace fragments are not registered to the database. */
+			static constexpr EEntityKind	queryableKinds	= EEntityKind::Namespace | EEntityKind::Class | EEntityKind::Struct | EEntityKind::Enum |
+															  EEntityKind::FundamentalArchetype | EEntityKind::Variable | EEntityKind::Field |
+															  EEntityKind::Function | EEntityKind::Method | EEntityKind::EnumValue;
+
+			/** Kinds of the matched entities. */
+			EEntityKind			kinds					= queryableKinds;
+
+			/** Name of the matched entities. Only relevant if hasName is true. */
+			std::string			name;
+
+			/** Should the matched entities be named name? */
+			bool				hasName					= false;
+
+			/** Prefix of the name of the matched entities. An empty prefix matches all entities. */
+			std::string			namePrefix;
+
+			/** Struct the matched structs (or the outer struct of the matched members) must inherit from. Can be nullptr. */
+			Struct const*		baseStruct				= nullptr;
+
+			/** Is baseStruct matched as well? */
+			bool				includeBaseStruct		= false;
+
+			/** Archetype of a property the matched entities must carry. Can be nullptr. */
+			Struct const*		propertyArchetype		= nullptr;
+
+			/** Are properties inheriting from propertyArchetype valid? */
+			bool				isChildPropertyValid	= true;
+
+			/** Access specifier of the matched entities. Only relevant if hasAccess is true. */
+			EAccessSpecifier	access					= EAccessSpecifier::Undefined;
+
+			/** Should the matched entities have the access specifier access? */
+			bool				hasAccess				= false;
+
+			/** Flags the matched fields must have. Only relevant if hasFieldFlags is true. */
+			EFieldFlags			fieldFlags				= EFieldFlags::Default;
+
+			/** Should only fields having fieldFlags be matched? */
+			bool				hasFieldFlags			= false;
+
+			/** Flags the matched methods must have. Only relevant if hasMethodFlags is true. */
+			EMethodFlags		methodFlags				= EMethodFlags::Default;
+
+			/** Should only methods having methodFlags be matched? */
+			bool				hasMethodFlags			= false;
+
+			/** Should only file level entities be matched? */
+			bool				isFileLevelOnly			= false;
+	};
+}
\ No newline at end of file
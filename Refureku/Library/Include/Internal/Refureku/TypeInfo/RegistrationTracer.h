@@ -0,0 +1,164 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <cstdio>	//std::snprintf
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+#include "Refureku/TypeInfo/RegistrationTrace.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Storage of the registration steps recorded by RegistrationTraceScope.
+	*	Names and modules are interned copies, so that the trace outlives the traced entities and the unloaded modules.
+	*/
+	class RegistrationTracer
+	{
+		private:
+			using Clock = std::chrono::steady_clock;
+
+			/** Recorded step. */
+			struct Event
+			{
+				/** Interned name of the traced entity or module. */
+				std::string const*			name;
+
+				/** Interned module the step is attributed to, nullptr if unknown. */
+				std::string const*			module;
+
+				/** Kind of the step. */
+				ERegistrationTraceCategory	category;
+
+				/** Index of the thread which ran the step. */
+				uint32						threadIndex;
+
+				/** Start of the step, in nanoseconds since _epoch. */
+				uint64						start;
+
+				/** End of the step, in nanoseconds since _epoch. Equals start while the step is running. */
+				uint64						end;
+			};
+
+			/** Mutex protecting all the fields except _epoch. */
+			mutable std::mutex				_mutex;
+
+			/** Time of the tracer creation, which happens on the first traced step. */
+			Clock::time_point const			_epoch;
+
+			/** Interned names and modules. Nodes are stable, so the events can point to them. */
+			std::unordered_set<std::string>	_strings;
+
+			/** Recorded steps, in start order. */
+			std::vector<Event>				_events;
+
+			/** Number of threads which recorded a step. */
+			uint32							_threadsCount	= 0u;
+
+			inline RegistrationTracer()													noexcept;
+
+			/**
+			*	@brief Intern a string. The caller must hold _mutex.
+			*
+			*	@param string The string to intern. Can be nullptr.
+			*
+			*	@return A pointer to the interned copy of the string, nullptr if string is nullptr.
+			*/
+			inline std::string const*		intern(char const* string)										noexcept;
+
+			/**
+			*	@brief Get the time elapsed since the tracer creation.
+			*
+			*	@return The elapsed time in nanoseconds.
+			*/
+			inline uint64					now()													const	noexcept;
+
+			/**
+			*	@brief Get the index of the calling thread, attributing a new one on its first call. The caller must hold _mutex.
+			*
+			*	@return The index of the calling thread.
+			*/
+			inline uint32					getThreadIndex()												noexcept;
+
+			/**
+			*	@brief Get the module the registerers running on the calling thread are attributed to.
+			*
+			*	@return A reference to the interned module of the calling thread.
+			*/
+			static inline std::string const*&	getCurrentModule()											noexcept;
+
+			/**
+			*	@brief Write a string as a JSON string literal.
+			*
+			*	@param string	The string to write.
+			*	@param out		The JSON string receiving the literal.
+			*/
+			static inline void				writeJsonString(std::string const&	string,
+															std::string&		out)							noexcept;
+
+		public:
+			/**
+			*	@brief Get the tracer singleton.
+			*
+			*	@return The tracer singleton.
+			*/
+			static inline RegistrationTracer&	getInstance()												noexcept;
+
+			/**
+			*	@brief Attribute the next registerers running on the calling thread to a module.
+			*
+			*	@param module The module name.
+			*/
+			inline void						setCurrentModule(char const* module)							noexcept;
+
+			/**
+			*	@brief Record the start of a step.
+			*
+			*	@param category	Kind of the step.
+			*	@param name		Name of the traced entity or module.
+			*	@param module	Module the step is attributed to. If nullptr, the current module of the calling thread is used.
+			*
+			*	@return The index of the recorded event, to pass to endEvent.
+			*/
+			inline std::size_t				beginEvent(ERegistrationTraceCategory	category,
+													   char const*					name,
+													   char const*					module)					noexcept;
+
+			/**
+			*	@brief Record the end of a step.
+			*
+			*	@param eventIndex Index returned by beginEvent.
+			*/
+			inline void						endEvent(std::size_t eventIndex)								noexcept;
+
+			/**
+			*	@brief Get a copy of the recorded steps.
+			*
+			*	@return The recorded steps in start order. The names and modules are interned and stay valid until the program exits.
+			*/
+			inline Vector<RegistrationTraceEvent>	getEvents()										const;
+
+			/**
+			*	@brief Write the recorded steps in the Chrome trace event format, readable by chrome://tracing and Perfetto.
+			*
+			*	@return The JSON trace.
+			*/
+			inline std::string				toChromeTrace()											const;
+
+			/**
+			*	@brief Remove all the recorded steps. Must not be called while a step is being recorded.
+			*/
+			inline void						clear()															noexcept;
+	};
+
+	#include "Refureku/TypeInfo/RegistrationTracer.inl"
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline RegistrationTracer::RegistrationTracer() noexcept:
+	_epoch{Clock::now()}
+{
+}
+
+inline std::string const* RegistrationTracer::intern(char const* string) noexcept
+{
+	return (string != nullptr) ? &*_strings.emplace(string).first : nullptr;
+}
+
+inline uint64 RegistrationTracer::now() const noexcept
+{
+	return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _epoch).count());
+}
+
+inline uint32 RegistrationTracer::getThreadIndex() noexcept
+{
+	thread_local uint32 threadIndex = _threadsCount++;
+
+	return threadIndex;
+}
+
+inline std::string const*& RegistrationTracer::getCurrentModule() noexcept
+{
+	thread_local std::string const* currentModule = nullptr;
+
+	return currentModule;
+}
+
+inline void RegistrationTracer::writeJsonString(std::string const& string, std::string& out) noexcept
+{
+	static constexpr char const hexDigits[] = "0123456789abcdef";
+
+	out += '"';
+
+	for (char c : string)
+	{
+		switch (c)
+		{
+			case '"':
+				out += "\\\"";
+				break;
+
+			case '\\':
+				out += "\\\\";
+				break;
+
+			default:
+				if (static_cast<unsigned char>(c) < 0x20u)
+				{
+					out += "\\u00";
+					out += hexDigits[(c >> 4) & 0xF];
+					out += hexDigits[c & 0xF];
+				}
+				else
+				{
+					out += c;
+				}
+				break;
+		}
+	}
+
+	out += '"';
+}
+
+inline RegistrationTracer& RegistrationTracer::getInstance() noexcept
+{
+	static RegistrationTracer tracer;
+
+	return tracer;
+}
+
+inline void RegistrationTracer::setCurrentModule(char const* module) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	getCurrentModule() = intern(module);
+}
+
+inline std::size_t RegistrationTracer::beginEvent(ERegistrationTraceCategory category, char const* name, char const* module) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	uint64 start = now();
+
+	_events.push_back(Event{intern(name), (module != nullptr) ? intern(module) : getCurrentModule(), category, getThreadIndex(), start, start});
+
+	return _events.size() - 1u;
+}
+
+inline void RegistrationTracer::endEvent(std::size_t eventIndex) noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	//The trace might have been cleared while the step was running
+	if (eventIndex < _events.size())
+	{
+		_events[eventIndex].end = now();
+	}
+}
+
+inline Vector<RegistrationTraceEvent> RegistrationTracer::getEvents() const
+{
+	std::lock_guard lock(_mutex);
+
+	Vector<RegistrationTraceEvent> result(_events.size());
+
+	for (Event const& event : _events)
+	{
+		RegistrationTraceEvent& traceEvent = result.emplace_back();
+
+		traceEvent.name			= (event.name != nullptr) ? event.name->c_str() : nullptr;
+		traceEvent.module		= (event.module != nullptr) ? event.module->c_str() : nullptr;
+		traceEvent.category		= event.category;
+		traceEvent.threadIndex	= event.threadIndex;
+		traceEvent.start		= event.start;
+		traceEvent.duration		= event.end - event.start;
+	}
+
+	return result;
+}
+
+inline std::string RegistrationTracer::toChromeTrace() const
+{
+	std::lock_guard lock(_mutex);
+
+	std::string result = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	//Chrome trace timestamps are in microseconds
+	char timeBuffer[32];
+	auto writeMicroseconds = [&result, &timeBuffer](uint64 nanoseconds)
+	{
+		std::snprintf(timeBuffer, sizeof(timeBuffer), "%llu.%03llu",
+					  static_cast<unsigned long long>(nanoseconds / 1000u),
+					  static_cast<unsigned long long>(nanoseconds % 1000u));
+		result += timeBuffer;
+	};
+
+	for (std::size_t i = 0u; i < _events.size(); i++)
+	{
+		Event const& event = _events[i];
+
+		if (i != 0u)
+		{
+			result += ',';
+		}
+
+		result += "{\"name\":";
+		writeJsonString((event.name != nullptr) ? *event.name : std::string(), result);
+		result += ",\"cat\":\"";
+		result += getRegistrationTraceCategoryName(event.category);
+		result += "\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+		result += std::to_string(event.threadIndex);
+		result += ",\"ts\":";
+		writeMicroseconds(event.start);
+		result += ",\"dur\":";
+		writeMicroseconds(event.end - event.start);
+		result += ",\"args\":{\"module\":";
+		writeJsonString((event.module != nullptr) ? *event.module : std::string(), result);
+		result += "}}";
+	}
+
+	result += "]}";
+
+	return result;
+}
+
+inline void RegistrationTracer::clear() noexcept
+{
+	std::lock_guard lock(_mutex);
+
+	//Interned strings are kept since the current modules of the threads may point to them
+	_events.clear();
+}
\ No newline at end of file
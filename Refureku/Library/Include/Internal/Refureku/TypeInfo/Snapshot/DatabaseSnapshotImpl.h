@@ -0,0 +1,117 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <cstring>		//std::strcmp
+#include <vector>
+#include <fstream>
+#include <utility>		//std::pair
+#include <algorithm>	//std::lower_bound, std::upper_bound
+
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+namespace rfk
+{
+	class internal::DatabaseSnapshotImpl final
+	{
+		private:
+			/** Snapshot read from a file. Stored as 8 bytes blocks to satisfy the snapshot alignment. */
+			std::vector<uint64>	_ownedData;
+
+			/** Pointer to the beginning of the loaded snapshot, nullptr if no snapshot is loaded. */
+			char const*			_data = nullptr;
+
+			/**
+			*	@brief Get the range of the file level entities of a single kind in the file level entities table.
+			*
+			*	@param kind The kind of the entities.
+			*
+			*	@return The range of the entities in the table, as [begin, end) indices.
+			*/
+			RFK_NODISCARD inline std::pair<std::size_t, std::size_t>	getFileLevelRange(EEntityKind kind)	const	noexcept;
+
+		public:
+			DatabaseSnapshotImpl()								= default;
+			DatabaseSnapshotImpl(DatabaseSnapshotImpl const&)	= delete;
+			DatabaseSnapshotImpl(DatabaseSnapshotImpl&&)		= delete;
+			~DatabaseSnapshotImpl()								= default;
+
+			/**
+			*	@brief Release the loaded snapshot, then use the snapshot stored in the provided memory if it is valid.
+			*
+			*	@param data	Pointer to the beginning of the snapshot.
+			*	@param size	Size in bytes of the memory block.
+			*
+			*	@return true if the snapshot is valid and was loaded, else false.
+			*/
+			inline bool										loadFromMemory(void const*	data,
+																		   std::size_t	size)						noexcept;
+
+			/**
+			*	@brief Release the loaded snapshot, then read and load a snapshot file.
+			*
+			*	@param filePath Path to the snapshot file.
+			*
+			*	@return true if the file could be read and the snapshot is valid, else false.
+			*/
+			inline bool										loadFromFile(char const* filePath)						noexcept;
+
+			/**
+			*	@brief Retrieve an entity by id with a binary search.
+			*
+			*	@param id The id of the entity.
+			*
+			*	@return The entity if it exists, else nullptr.
+			*/
+			RFK_NODISCARD inline SnapshotEntity const*		getEntityById(std::size_t id)					const	noexcept;
+
+			/**
+			*	@brief Retrieve a file level entity by kind and name with a binary search per kind.
+			*
+			*	@param name		The name of the entity.
+			*	@param kinds	Bitmask of the accepted kinds.
+			*
+			*	@return The first matching entity in kind order if any, else nullptr.
+			*/
+			RFK_NODISCARD inline SnapshotEntity const*		getFileLevelEntityByName(char const*	name,
+																					 EEntityKind	kinds)		const	noexcept;
+
+			/**
+			*	@brief Count the file level entities of the provided kinds.
+			*
+			*	@param kinds Bitmask of the counted kinds.
+			*
+			*	@return The number of file level entities of the provided kinds.
+			*/
+			RFK_NODISCARD inline std::size_t				getFileLevelEntitiesCount(EEntityKind kinds)	const	noexcept;
+
+			/**
+			*	@brief Execute the visitor on the file level entities of the provided kinds, sorted by kind then by name.
+			*
+			*	@param kinds	Bitmask of the visited kinds.
+			*	@param visitor	Visitor function to call. Return false to abort the traversal.
+			*	@param userData	Optional user data forwarded to the visitor.
+			*
+			*	@return false if a visitor returned false, else true.
+			*/
+			inline bool										foreachFileLevelEntity(EEntityKind				kinds,
+																				   Visitor<SnapshotEntity>	visitor,
+																				   void*					userData)	const;
+
+			/**
+			*	@brief Getter for the field _data.
+			*
+			*	@return _data.
+			*/
+			RFK_NODISCARD inline char const*				getData()										const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshotImpl.inl"
+}
\ No newline at end of file
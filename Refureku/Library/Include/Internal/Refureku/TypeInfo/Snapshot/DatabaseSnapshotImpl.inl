@@ -0,0 +1,168 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::pair<std::size_t, std::size_t> internal::DatabaseSnapshotImpl::getFileLevelRange(EEntityKind kind) const noexcept
+{
+	internal::SnapshotHeader const&	header	= internal::SnapshotFormat::getHeader(_data);
+	uint32 const*					begin	= &internal::SnapshotFormat::getElement<uint32>(_data, header.fileLevelEntities, 0u);
+	uint32 const*					end		= begin + header.fileLevelEntities.count;
+	char const*						data	= _data;
+
+	uint32 const* rangeBegin = std::lower_bound(begin, end, kind, [data](uint32 index, EEntityKind value)
+												{
+													return static_cast<uint16>(internal::SnapshotFormat::getEntity(data, index)->getKind()) < static_cast<uint16>(value);
+												});
+	uint32 const* rangeEnd = std::upper_bound(rangeBegin, end, kind, [data](EEntityKind value, uint32 index)
+											  {
+												  return static_cast<uint16>(value) < static_cast<uint16>(internal::SnapshotFormat::getEntity(data, index)->getKind());
+											  });
+
+	return { static_cast<std::size_t>(rangeBegin - begin), static_cast<std::size_t>(rangeEnd - begin) };
+}
+
+inline bool internal::DatabaseSnapshotImpl::loadFromMemory(void const* data, std::size_t size) noexcept
+{
+	_data = nullptr;
+	_ownedData.clear();
+	_ownedData.shrink_to_fit();
+
+	if (!internal::SnapshotFormat::validate(reinterpret_cast<char const*>(data), size))
+	{
+		return false;
+	}
+
+	_data = reinterpret_cast<char const*>(data);
+
+	return true;
+}
+
+inline bool internal::DatabaseSnapshotImpl::loadFromFile(char const* filePath) noexcept
+{
+	_data = nullptr;
+	_ownedData.clear();
+
+	std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	std::streamoff size = file.tellg();
+
+	if (size <= 0)
+	{
+		return false;
+	}
+
+	_ownedData.resize((static_cast<std::size_t>(size) + sizeof(uint64) - 1u) / sizeof(uint64));
+
+	file.seekg(0);
+
+	if (!file.read(reinterpret_cast<char*>(_ownedData.data()), size) ||
+		!internal::SnapshotFormat::validate(reinterpret_cast<char const*>(_ownedData.data()), static_cast<std::size_t>(size)))
+	{
+		_ownedData.clear();
+		_ownedData.shrink_to_fit();
+
+		return false;
+	}
+
+	_data = reinterpret_cast<char const*>(_ownedData.data());
+
+	return true;
+}
+
+inline SnapshotEntity const* internal::DatabaseSnapshotImpl::getEntityById(std::size_t id) const noexcept
+{
+	internal::SnapshotHeader const&	header	= internal::SnapshotFormat::getHeader(_data);
+	SnapshotEntity const*			begin	= &internal::SnapshotFormat::getElement<SnapshotEntity>(_data, header.entities, 0u);
+	SnapshotEntity const*			end		= begin + header.entities.count;
+
+	SnapshotEntity const* it = std::lower_bound(begin, end, id, [](SnapshotEntity const& entity, std::size_t value)
+												{
+													return entity.getId() < value;
+												});
+
+	return (it != end && it->getId() == id) ? it : nullptr;
+}
+
+inline SnapshotEntity const* internal::DatabaseSnapshotImpl::getFileLevelEntityByName(char const* name, EEntityKind kinds) const noexcept
+{
+	internal::SnapshotHeader const&	header	= internal::SnapshotFormat::getHeader(_data);
+	uint32 const*					indices	= &internal::SnapshotFormat::getElement<uint32>(_data, header.fileLevelEntities, 0u);
+	char const*						data	= _data;
+
+	for (uint16 kind = 1u; kind != 0u && kind <= static_cast<uint16>(kinds); kind <<= 1)
+	{
+		if ((static_cast<uint16>(kinds) & kind) == 0u)
+		{
+			continue;
+		}
+
+		std::pair<std::size_t, std::size_t> range = getFileLevelRange(static_cast<EEntityKind>(kind));
+
+		uint32 const* it = std::lower_bound(indices + range.first, indices + range.second, name, [data](uint32 index, char const* value)
+											{
+												return std::strcmp(internal::SnapshotFormat::getEntity(data, index)->getName(), value) < 0;
+											});
+
+		if (it != indices + range.second && std::strcmp(internal::SnapshotFormat::getEntity(data, *it)->getName(), name) == 0)
+		{
+			return internal::SnapshotFormat::getEntity(data, *it);
+		}
+	}
+
+	return nullptr;
+}
+
+inline std::size_t internal::DatabaseSnapshotImpl::getFileLevelEntitiesCount(EEntityKind kinds) const noexcept
+{
+	std::size_t result = 0u;
+
+	for (uint16 kind = 1u; kind != 0u && kind <= static_cast<uint16>(kinds); kind <<= 1)
+	{
+		if ((static_cast<uint16>(kinds) & kind) != 0u)
+		{
+			std::pair<std::size_t, std::size_t> range = getFileLevelRange(static_cast<EEntityKind>(kind));
+
+			result += range.second - range.first;
+		}
+	}
+
+	return result;
+}
+
+inline bool internal::DatabaseSnapshotImpl::foreachFileLevelEntity(EEntityKind kinds, Visitor<SnapshotEntity> visitor, void* userData) const
+{
+	internal::SnapshotHeader const& header = internal::SnapshotFormat::getHeader(_data);
+
+	for (uint16 kind = 1u; kind != 0u && kind <= static_cast<uint16>(kinds); kind <<= 1)
+	{
+		if ((static_cast<uint16>(kinds) & kind) == 0u)
+		{
+			continue;
+		}
+
+		std::pair<std::size_t, std::size_t> range = getFileLevelRange(static_cast<EEntityKind>(kind));
+
+		for (std::size_t i = range.first; i < range.second; i++)
+		{
+			if (!visitor(internal::SnapshotFormat::getIndexedEntity(_data, header.fileLevelEntities, i), userData))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+inline char const* internal::DatabaseSnapshotImpl::getData() const noexcept
+{
+	return _data;
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <cstring>	//std::memcmp
+#include <cstdint>	//std::uintptr_t
+
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h"
+
+namespace rfk::internal
+{
+	/** Location of a table in a snapshot. */
+	struct SnapshotTable
+	{
+		/** Offset of the first element from the beginning of the snapshot. */
+		uint32	offset;
+
+		/** Number of elements in the table. */
+		uint32	count;
+	};
+
+	/** Type part stored in a snapshot. */
+	struct SnapshotTypePart
+	{
+		/** ETypePartDescriptor of the part. */
+		uint16	descriptor;
+
+		uint16	padding;
+
+		/** Additional data of the part (c-style array size). */
+		uint32	additionalData;
+	};
+
+	/**
+	*	First bytes of a snapshot.
+	*	The tables follow the header in the declaration order. Each table is aligned on SnapshotFormat::alignment.
+	*	Offsets and indices are stored on 32 bits, so a snapshot can't exceed 4GB.
+	*/
+	struct SnapshotHeader
+	{
+		/** Identifies a snapshot, see SnapshotFormat::magic. */
+		char			magic[8];
+
+		/** Format version, see DatabaseSnapshot::formatVersion. */
+		uint32			version;
+
+		/** SnapshotFormat::endiannessMarker written with the endianness of the exporting program. */
+		uint32			endiannessMarker;
+
+		/** Total size of the snapshot in bytes. */
+		uint64			size;
+
+		/** SnapshotEntity records sorted by id. The table always starts right after the header. */
+		SnapshotTable	entities;
+
+		/** uint32 indices of the file level entities sorted by kind then by name. */
+		SnapshotTable	fileLevelEntities;
+
+		/** uint32 indices of the nested entities of each entity. */
+		SnapshotTable	nestedEntities;
+
+		/** SnapshotParentStruct records. */
+		SnapshotTable	directParents;
+
+		/** uint32 indices of the subclasses of each struct. */
+		SnapshotTable	subclasses;
+
+		/** SnapshotProperty records. */
+		SnapshotTable	properties;
+
+		/** SnapshotParameter records. */
+		SnapshotTable	parameters;
+
+		/** SnapshotType records. */
+		SnapshotTable	types;
+
+		/** SnapshotTypePart records. */
+		SnapshotTable	typeParts;
+
+		/** Null terminated strings. */
+		SnapshotTable	strings;
+	};
+
+	/**
+	*	Layout constants and accessors shared by the snapshot writer and the snapshot records.
+	*/
+	class SnapshotFormat
+	{
+		public:
+			/** Magic bytes at the beginning of any snapshot. */
+			static constexpr char			magic[8]			= { 'R', 'F', 'K', 'S', 'N', 'A', 'P', '\0' };
+
+			/** Value used to detect a snapshot exported with another endianness. */
+			static constexpr uint32			endiannessMarker	= 0x01020304u;
+
+			/** Alignment of the snapshot and of each of its tables. */
+			static constexpr std::size_t	alignment			= 8u;
+
+			/** Index stored when an entity is not in the snapshot. */
+			static constexpr uint32			invalidIndex		= ~0u;
+
+			SnapshotFormat()	= delete;
+			~SnapshotFormat()	= delete;
+
+			/**
+			*	@brief Align a size or offset on SnapshotFormat::alignment.
+			*
+			*	@param value The value to align.
+			*
+			*	@return The smallest aligned value greater or equal to value.
+			*/
+			RFK_NODISCARD static constexpr std::size_t		align(std::size_t value)											noexcept;
+
+			/**
+			*	@brief Get the header of a snapshot.
+			*
+			*	@param data Pointer to the beginning of the snapshot.
+			*
+			*	@return The snapshot header.
+			*/
+			RFK_NODISCARD static inline SnapshotHeader const&	getHeader(char const* data)										noexcept;
+
+			/**
+			*	@brief Get the beginning of the snapshot containing a record.
+			*
+			*	@param record A record of the snapshot.
+			*
+			*	@return Pointer to the beginning of the snapshot.
+			*/
+			template <typename T>
+			RFK_NODISCARD static char const*				getData(T const& record)										noexcept;
+
+			/**
+			*	@brief Get an element of a snapshot table.
+			*
+			*	@param data		Pointer to the beginning of the snapshot.
+			*	@param table	The table.
+			*	@param index	Index of the element in the table.
+			*
+			*	@return The element.
+			*/
+			template <typename T>
+			RFK_NODISCARD static T const&					getElement(char const*			data,
+																	   SnapshotTable const&	table,
+																	   std::size_t			index)								noexcept;
+
+			/**
+			*	@brief Get an entity of a snapshot.
+			*
+			*	@param data		Pointer to the beginning of the snapshot.
+			*	@param index	Index of the entity, or SnapshotFormat::invalidIndex.
+			*
+			*	@return The entity, nullptr if index is SnapshotFormat::invalidIndex.
+			*/
+			RFK_NODISCARD static inline SnapshotEntity const*	getEntity(char const*	data,
+																		  uint32		index)									noexcept;
+
+			/**
+			*	@brief Get the entity referenced by an element of a uint32 index table.
+			*
+			*	@param data		Pointer to the beginning of the snapshot.
+			*	@param table	The index table.
+			*	@param index	Index of the element in the table.
+			*
+			*	@return The referenced entity.
+			*/
+			RFK_NODISCARD static inline SnapshotEntity const&	getIndexedEntity(char const*			data,
+																				 SnapshotTable const&	table,
+																				 std::size_t			index)					noexcept;
+
+			/**
+			*	@brief Get a string of a snapshot.
+			*
+			*	@param data		Pointer to the beginning of the snapshot.
+			*	@param offset	Offset of the string from the beginning of the snapshot.
+			*
+			*	@return The null terminated string.
+			*/
+			RFK_NODISCARD static inline char const*			getString(char const*	data,
+																	  uint32		offset)										noexcept;
+
+			/**
+			*	@brief	Check that a memory block contains a snapshot this program can read:
+			*			magic, version, endianness, table bounds and all the indices and string offsets stored in the records.
+			*
+			*	@param data	Pointer to the beginning of the memory block.
+			*	@param size	Size of the memory block in bytes.
+			*
+			*	@return true if the snapshot is valid, else false.
+			*/
+			RFK_NODISCARD static inline bool				validate(char const*	data,
+																	 std::size_t	size)										noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.inl"
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr std::size_t SnapshotFormat::align(std::size_t value) noexcept
+{
+	return (value + alignment - 1u) & ~(alignment - 1u);
+}
+
+inline SnapshotHeader const& SnapshotFormat::getHeader(char const* data) noexcept
+{
+	return *reinterpret_cast<SnapshotHeader const*>(data);
+}
+
+template <typename T>
+char const* SnapshotFormat::getData(T const& record) noexcept
+{
+	return reinterpret_cast<char const*>(&record) - record._offset;
+}
+
+template <typename T>
+T const& SnapshotFormat::getElement(char const* data, SnapshotTable const& table, std::size_t index) noexcept
+{
+	return reinterpret_cast<T const*>(data + table.offset)[index];
+}
+
+inline SnapshotEntity const* SnapshotFormat::getEntity(char const* data, uint32 index) noexcept
+{
+	return (index == invalidIndex) ? nullptr : &getElement<SnapshotEntity>(data, getHeader(data).entities, index);
+}
+
+inline SnapshotEntity const& SnapshotFormat::getIndexedEntity(char const* data, SnapshotTable const& table, std::size_t index) noexcept
+{
+	return getElement<SnapshotEntity>(data, getHeader(data).entities, getElement<uint32>(data, table, index));
+}
+
+inline char const* SnapshotFormat::getString(char const* data, uint32 offset) noexcept
+{
+	return data + offset;
+}
+
+inline bool SnapshotFormat::validate(char const* data, std::size_t size) noexcept
+{
+	if (data == nullptr || reinterpret_cast<std::uintptr_t>(data) % alignment != 0u || size < sizeof(SnapshotHeader))
+	{
+		return false;
+	}
+
+	SnapshotHeader const& header = getHeader(data);
+
+	if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+		header.version != DatabaseSnapshot::formatVersion ||
+		header.endiannessMarker != endiannessMarker ||
+		header.size > size)
+	{
+		return false;
+	}
+
+	//Tables must be aligned and fit in the snapshot
+	auto isTableValid = [&header](SnapshotTable const& table, std::size_t elementSize)
+	{
+		return table.offset % alignment == 0u &&
+			table.offset >= sizeof(SnapshotHeader) &&
+			static_cast<uint64>(table.offset) + static_cast<uint64>(table.count) * elementSize <= header.size;
+	};
+
+	if (header.entities.offset != align(sizeof(SnapshotHeader)) ||
+		!isTableValid(header.entities, sizeof(SnapshotEntity)) ||
+		!isTableValid(header.fileLevelEntities, sizeof(uint32)) ||
+		!isTableValid(header.nestedEntities, sizeof(uint32)) ||
+		!isTableValid(header.directParents, sizeof(SnapshotParentStruct)) ||
+		!isTableValid(header.subclasses, sizeof(uint32)) ||
+		!isTableValid(header.properties, sizeof(SnapshotProperty)) ||
+		!isTableValid(header.parameters, sizeof(SnapshotParameter)) ||
+		!isTableValid(header.types, sizeof(SnapshotType)) ||
+		!isTableValid(header.typeParts, sizeof(SnapshotTypePart)) ||
+		!isTableValid(header.strings, sizeof(char)))
+	{
+		return false;
+	}
+
+	//The last string must be null terminated so that no string can overflow the strings table
+	if (header.strings.count == 0u || data[header.strings.offset + header.strings.count - 1u] != '\0')
+	{
+		return false;
+	}
+
+	auto isStringValid = [&header](uint32 offset)
+	{
+		return offset >= header.strings.offset && offset - header.strings.offset < header.strings.count;
+	};
+
+	auto isEntityIndexValid = [&header](uint32 index, bool isInvalidIndexAllowed)
+	{
+		return index < header.entities.count || (isInvalidIndexAllowed && index == invalidIndex);
+	};
+
+	auto isRangeValid = [](uint32 begin, uint32 count, SnapshotTable const& table)
+	{
+		return static_cast<uint64>(begin) + count <= table.count;
+	};
+
+	//Records store their own offset to find the beginning of the snapshot
+	auto isRecordOffsetValid = [](uint32 recordOffset, SnapshotTable const& table, std::size_t index, std::size_t recordSize)
+	{
+		return recordOffset == table.offset + index * recordSize;
+	};
+
+	auto isIndexTableValid = [data, &isEntityIndexValid](SnapshotTable const& table)
+	{
+		for (std::size_t i = 0u; i < table.count; i++)
+		{
+			if (!isEntityIndexValid(getElement<uint32>(data, table, i), false))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	if (!isIndexTableValid(header.fileLevelEntities) || !isIndexTableValid(header.nestedEntities) || !isIndexTableValid(header.subclasses))
+	{
+		return false;
+	}
+
+	constexpr uint16	typedKinds		= static_cast<uint16>(EEntityKind::Enum | EEntityKind::Variable | EEntityKind::Field | EEntityKind::Function | EEntityKind::Method);
+	constexpr uint16	exportedKinds	= static_cast<uint16>(EEntityKind::NamespaceFragment) - 1u;
+
+	for (std::size_t i = 0u; i < header.entities.count; i++)
+	{
+		SnapshotEntity const& entity = getElement<SnapshotEntity>(data, header.entities, i);
+
+		bool isKindValid	= entity._kind != 0u && (entity._kind & (entity._kind - 1u)) == 0u && (entity._kind & ~exportedKinds) == 0u;
+		bool isTypeValid	= ((entity._kind & typedKinds) != 0u) ? (entity._typeIndex < header.types.count) : (entity._typeIndex == invalidIndex);
+
+		//Entities are sorted by id to be searched by id
+		bool isIdValid		= (i == 0u) || getElement<SnapshotEntity>(data, header.entities, i - 1u)._id < entity._id;
+
+		if (!isRecordOffsetValid(entity._offset, header.entities, i, sizeof(SnapshotEntity)) ||
+			!isStringValid(entity._nameOffset) ||
+			!isEntityIndexValid(entity._outerIndex, true) ||
+			!isKindValid || !isTypeValid || !isIdValid ||
+			!isRangeValid(entity._nestedEntitiesBegin, entity._nestedEntitiesCount, header.nestedEntities) ||
+			!isRangeValid(entity._directParentsBegin, entity._directParentsCount, header.directParents) ||
+			!isRangeValid(entity._subclassesBegin, entity._subclassesCount, header.subclasses) ||
+			!isRangeValid(entity._propertiesBegin, entity._propertiesCount, header.properties) ||
+			!isRangeValid(entity._parametersBegin, entity._parametersCount, header.parameters))
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0u; i < header.directParents.count; i++)
+	{
+		SnapshotParentStruct const& parent = getElement<SnapshotParentStruct>(data, header.directParents, i);
+
+		if (!isRecordOffsetValid(parent._offset, header.directParents, i, sizeof(SnapshotParentStruct)) ||
+			!isEntityIndexValid(parent._archetypeIndex, false))
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0u; i < header.properties.count; i++)
+	{
+		SnapshotProperty const& property = getElement<SnapshotProperty>(data, header.properties, i);
+
+		if (!isRecordOffsetValid(property._offset, header.properties, i, sizeof(SnapshotProperty)) ||
+			!isEntityIndexValid(property._archetypeIndex, true) ||
+			!isStringValid(property._archetypeNameOffset))
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0u; i < header.parameters.count; i++)
+	{
+		SnapshotParameter const& parameter = getElement<SnapshotParameter>(data, header.parameters, i);
+
+		if (!isRecordOffsetValid(parameter._offset, header.parameters, i, sizeof(SnapshotParameter)) ||
+			!isStringValid(parameter._nameOffset) ||
+			parameter._typeIndex >= header.types.count)
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0u; i < header.types.count; i++)
+	{
+		SnapshotType const& type = getElement<SnapshotType>(data, header.types, i);
+
+		if (!isRecordOffsetValid(type._offset, header.types, i, sizeof(SnapshotType)) ||
+			!isEntityIndexValid(type._archetypeIndex, true) ||
+			!isStringValid(type._archetypeNameOffset) ||
+			!isRangeValid(type._partsBegin, type._partsCount, header.typeParts))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
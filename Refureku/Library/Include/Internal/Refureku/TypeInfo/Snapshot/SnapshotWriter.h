@@ -0,0 +1,229 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>			//std::size_t
+#include <cstring>			//std::memcpy, std::memset, std::strcmp
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>		//std::sort
+#include <cassert>
+
+#include "Refureku/Containers/Vector.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h"
+#include "Refureku/TypeInfo/Entity/Entity.h"
+#include "Refureku/TypeInfo/Type.h"
+#include "Refureku/TypeInfo/Namespace/Namespace.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
+#include "Refureku/TypeInfo/Archetypes/Enum.h"
+#include "Refureku/TypeInfo/Archetypes/EnumValue.h"
+#include "Refureku/TypeInfo/Variables/Variable.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+#include "Refureku/TypeInfo/Variables/StaticField.h"
+#include "Refureku/TypeInfo/Functions/Function.h"
+#include "Refureku/TypeInfo/Functions/Method.h"
+#include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/TypeInfo/Functions/FunctionParameter.h"
+#include "Refureku/Properties/Property.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Export the registered entities to a snapshot, see DatabaseSnapshot.
+	*	The records of each table are first staged in 8 bytes blocks, then the tables are laid out after the header
+	*	and the offsets stored in the records are made relative to the beginning of the snapshot.
+	*/
+	class SnapshotWriter
+	{
+		private:
+			/** Registered entities sorted by id. */
+			std::vector<Entity const*>						_entities;
+
+			/** Index of each exported entity, by id. */
+			std::unordered_map<std::size_t, uint32>			_entityIndices;
+
+			/** Index of each exported type, by canonical type. */
+			std::unordered_map<Type const*, uint32>			_typeIndices;
+
+			/** Index of each exported type made of an archetype only (enum underlying type), by archetype. */
+			std::unordered_map<Archetype const*, uint32>	_archetypeTypeIndices;
+
+			/** Offset in _strings of each exported string. The views reference the exported entities names. */
+			std::unordered_map<std::string_view, uint32>	_stringOffsets;
+
+			/** Exported null terminated strings. */
+			std::string										_strings;
+
+			/** Staged records of each table. */
+			std::vector<uint64>								_entityRecords;
+			std::vector<uint64>								_directParentRecords;
+			std::vector<uint64>								_propertyRecords;
+			std::vector<uint64>								_parameterRecords;
+			std::vector<uint64>								_typeRecords;
+			std::vector<uint64>								_typePartRecords;
+
+			/** Staged index tables. */
+			std::vector<uint32>								_fileLevelEntities;
+			std::vector<uint32>								_nestedEntities;
+			std::vector<uint32>								_subclasses;
+
+			template <typename EntitiesContainer>
+			explicit SnapshotWriter(EntitiesContainer const& registeredEntities)		noexcept;
+
+			/**
+			*	@brief Append a zeroed record to a staged table.
+			*
+			*	@param table The staged table.
+			*
+			*	@return The appended record. It is invalidated by the next append to the same table.
+			*/
+			template <typename T>
+			static T&						addRecord(std::vector<uint64>& table)		noexcept;
+
+			/**
+			*	@brief Get a record of a staged or laid out table.
+			*
+			*	@param tableData	Pointer to the first record of the table.
+			*	@param index		Index of the record.
+			*
+			*	@return The record.
+			*/
+			template <typename T>
+			static T&						getRecord(void*			tableData,
+													  std::size_t	index)				noexcept;
+
+			/**
+			*	@brief Get the number of records of a staged table.
+			*
+			*	@param table The staged table.
+			*
+			*	@return The number of records in the table.
+			*/
+			template <typename T>
+			RFK_NODISCARD static uint32		getRecordsCount(std::vector<uint64> const& table)	noexcept;
+
+			/**
+			*	@brief	Once a table is laid out, store the offset of each record in the record,
+			*			and make the string offsets stored in the records relative to the beginning of the snapshot.
+			*
+			*	@param data			Pointer to the beginning of the snapshot.
+			*	@param table		The laid out table.
+			*	@param stringOffset	Member of the records holding a string offset, or nullptr.
+			*	@param stringsTable	The laid out strings table.
+			*/
+			template <typename T>
+			static void						fixUpRecords(char*					data,
+														 SnapshotTable const&	table,
+														 uint32 T::*			stringOffset,
+														 SnapshotTable const&	stringsTable)	noexcept;
+
+			/**
+			*	@brief Visitor appending the index of a registered entity to _nestedEntities.
+			*
+			*	@param entity	The nested entity.
+			*	@param writer	The SnapshotWriter.
+			*
+			*	@return true.
+			*/
+			template <typename T>
+			static bool						addNestedEntity(T const&	entity,
+															void*		writer)			noexcept;
+
+			/**
+			*	@brief Export a string once.
+			*
+			*	@param str The null terminated string.
+			*
+			*	@return The offset of the string in _strings.
+			*/
+			inline uint32					addString(char const* str)					noexcept;
+
+			/**
+			*	@brief Get the index of an exported entity.
+			*
+			*	@param entity The entity, can be nullptr.
+			*
+			*	@return The index of the entity, SnapshotFormat::invalidIndex if it is nullptr or not registered.
+			*/
+			RFK_NODISCARD inline uint32		getEntityIndex(Entity const* entity)	const	noexcept;
+
+			/**
+			*	@brief Export a type once.
+			*
+			*	@param type The type.
+			*
+			*	@return The index of the type in the types table.
+			*/
+			inline uint32					addType(Type const& type)					noexcept;
+
+			/**
+			*	@brief Export once a type made of an archetype only.
+			*
+			*	@param archetype The archetype.
+			*
+			*	@return The index of the type in the types table.
+			*/
+			inline uint32					addArchetypeType(Archetype const& archetype)	noexcept;
+
+			/**
+			*	@brief Append a type record.
+			*
+			*	@param archetype	Archetype of the type, can be nullptr.
+			*	@param partsBegin	Index of the first type part.
+			*	@param partsCount	Number of type parts.
+			*
+			*	@return The index of the type in the types table.
+			*/
+			inline uint32					addTypeRecord(Archetype const*	archetype,
+														  uint32			partsBegin,
+														  uint32			partsCount)		noexcept;
+
+			/**
+			*	@brief Append the parameters of a function or method.
+			*
+			*	@param function		The function or method.
+			*	@param out_begin	Index of the first parameter in the parameters table.
+			*	@param out_count	Number of parameters.
+			*/
+			inline void						addParameters(FunctionBase const&	function,
+														  uint32&				out_begin,
+														  uint32&				out_count)	noexcept;
+
+			/**
+			*	@brief Fill the record of an entity.
+			*
+			*	@param index Index of the entity in _entities.
+			*/
+			inline void						writeEntity(uint32 index)					noexcept;
+
+			/**
+			*	@brief Lay out the staged tables after the snapshot header.
+			*
+			*	@return The snapshot, empty if it would exceed 4GB.
+			*/
+			RFK_NODISCARD inline Vector<uint8>	layOut()							const	noexcept;
+
+		public:
+			/**
+			*	@brief Export the registered entities to a snapshot.
+			*
+			*	@param registeredEntities Container of all the entities registered to the database.
+			*
+			*	@return The snapshot, empty if it would exceed 4GB.
+			*/
+			template <typename EntitiesContainer>
+			RFK_NODISCARD static Vector<uint8>	write(EntitiesContainer const& registeredEntities)	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Snapshot/SnapshotWriter.inl"
+}
\ No newline at end of file
@@ -0,0 +1,501 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename EntitiesContainer>
+SnapshotWriter::SnapshotWriter(EntitiesContainer const& registeredEntities) noexcept
+{
+	_entities.reserve(registeredEntities.size());
+	for (Entity const* entity : registeredEntities)
+	{
+		_entities.push_back(entity);
+	}
+
+	//Entities are sorted by id so that snapshots can be searched by id and don't depend on the registration order
+	std::sort(_entities.begin(), _entities.end(), [](Entity const* lhs, Entity const* rhs)
+			  {
+				  return lhs->getId() < rhs->getId();
+			  });
+
+	_entityIndices.reserve(_entities.size());
+	for (std::size_t i = 0u; i < _entities.size(); i++)
+	{
+		_entityIndices.emplace(_entities[i]->getId(), static_cast<uint32>(i));
+	}
+
+	//Entity records are filled in place so they are all staged upfront
+	_entityRecords.resize(_entities.size() * (sizeof(SnapshotEntity) / sizeof(uint64)), 0u);
+
+	//Offset 0 is the empty string
+	_strings.push_back('\0');
+	_stringOffsets.emplace(std::string_view(), 0u);
+}
+
+template <typename T>
+T& SnapshotWriter::addRecord(std::vector<uint64>& table) noexcept
+{
+	static_assert(sizeof(T) % sizeof(uint64) == 0u, "Snapshot records must be staged in complete 8 bytes blocks.");
+
+	table.resize(table.size() + sizeof(T) / sizeof(uint64), 0u);
+
+	return *reinterpret_cast<T*>(table.data() + table.size() - sizeof(T) / sizeof(uint64));
+}
+
+template <typename T>
+T& SnapshotWriter::getRecord(void* tableData, std::size_t index) noexcept
+{
+	return reinterpret_cast<T*>(tableData)[index];
+}
+
+template <typename T>
+uint32 SnapshotWriter::getRecordsCount(std::vector<uint64> const& table) noexcept
+{
+	return static_cast<uint32>(table.size() * sizeof(uint64) / sizeof(T));
+}
+
+template <typename T>
+void SnapshotWriter::fixUpRecords(char* data, SnapshotTable const& table, uint32 T::* stringOffset, SnapshotTable const& stringsTable) noexcept
+{
+	for (uint32 i = 0u; i < table.count; i++)
+	{
+		T& record = getRecord<T>(data + table.offset, i);
+
+		record._offset = table.offset + i * static_cast<uint32>(sizeof(T));
+
+		if (stringOffset != nullptr)
+		{
+			record.*stringOffset += stringsTable.offset;
+		}
+	}
+}
+
+template <typename T>
+bool SnapshotWriter::addNestedEntity(T const& entity, void* writer) noexcept
+{
+	SnapshotWriter& snapshotWriter	= *reinterpret_cast<SnapshotWriter*>(writer);
+	uint32			index			= snapshotWriter.getEntityIndex(&entity);
+
+	//Entities which are not registered to the database are not exported
+	if (index != SnapshotFormat::invalidIndex)
+	{
+		snapshotWriter._nestedEntities.push_back(index);
+	}
+
+	return true;
+}
+
+inline uint32 SnapshotWriter::addString(char const* str) noexcept
+{
+	if (str == nullptr)
+	{
+		return 0u;
+	}
+
+	std::string_view	view(str);
+	auto				[it, inserted] = _stringOffsets.try_emplace(view, static_cast<uint32>(_strings.size()));
+
+	if (inserted)
+	{
+		_strings.append(view);
+		_strings.push_back('\0');
+	}
+
+	return it->second;
+}
+
+inline uint32 SnapshotWriter::getEntityIndex(Entity const* entity) const noexcept
+{
+	if (entity == nullptr)
+	{
+		return SnapshotFormat::invalidIndex;
+	}
+
+	auto it = _entityIndices.find(entity->getId());
+
+	return (it != _entityIndices.end()) ? it->second : SnapshotFormat::invalidIndex;
+}
+
+inline uint32 SnapshotWriter::addType(Type const& type) noexcept
+{
+	//Identical types share the same canonical instance, so they are exported once
+	Type const& canonicalType = type.getCanonicalType();
+
+	auto it = _typeIndices.find(&canonicalType);
+
+	if (it != _typeIndices.end())
+	{
+		return it->second;
+	}
+
+	uint32 partsBegin = getRecordsCount<SnapshotTypePart>(_typePartRecords);
+
+	for (std::size_t i = 0u; i < canonicalType.getTypePartsCount(); i++)
+	{
+		TypePart const&		part	= canonicalType.getTypePartAt(i);
+		SnapshotTypePart&	record	= addRecord<SnapshotTypePart>(_typePartRecords);
+
+		//TypePart only exposes its descriptor through predicates
+		ETypePartDescriptor descriptor =	(part.isConst()				? ETypePartDescriptor::Const	: ETypePartDescriptor::Undefined) |
+											(part.isVolatile()			? ETypePartDescriptor::Volatile	: ETypePartDescriptor::Undefined) |
+											(part.isPointer()			? ETypePartDescriptor::Ptr		: ETypePartDescriptor::Undefined) |
+											(part.isLValueReference()	? ETypePartDescriptor::LRef		: ETypePartDescriptor::Undefined) |
+											(part.isRValueReference()	? ETypePartDescriptor::RRef		: ETypePartDescriptor::Undefined) |
+											(part.isCArray()			? ETypePartDescriptor::CArray	: ETypePartDescriptor::Undefined) |
+											(part.isValue()				? ETypePartDescriptor::Value	: ETypePartDescriptor::Undefined);
+
+		record.descriptor		= static_cast<uint16>(descriptor);
+		record.additionalData	= part.isCArray() ? part.getCArraySize() : 0u;
+	}
+
+	uint32 index = addTypeRecord(canonicalType.getArchetype(), partsBegin, getRecordsCount<SnapshotTypePart>(_typePartRecords) - partsBegin);
+
+	_typeIndices.emplace(&canonicalType, index);
+
+	return index;
+}
+
+inline uint32 SnapshotWriter::addArchetypeType(Archetype const& archetype) noexcept
+{
+	auto it = _archetypeTypeIndices.find(&archetype);
+
+	if (it != _archetypeTypeIndices.end())
+	{
+		return it->second;
+	}
+
+	uint32 index = addTypeRecord(&archetype, 0u, 0u);
+
+	_archetypeTypeIndices.emplace(&archetype, index);
+
+	return index;
+}
+
+inline uint32 SnapshotWriter::addTypeRecord(Archetype const* archetype, uint32 partsBegin, uint32 partsCount) noexcept
+{
+	uint32			index	= getRecordsCount<SnapshotType>(_typeRecords);
+	SnapshotType&	record	= addRecord<SnapshotType>(_typeRecords);
+
+	record._archetypeIndex		= getEntityIndex(archetype);
+	record._archetypeNameOffset	= (archetype != nullptr) ? addString(archetype->getName()) : 0u;
+	record._partsBegin			= partsBegin;
+	record._partsCount			= partsCount;
+
+	return index;
+}
+
+inline void SnapshotWriter::addParameters(FunctionBase const& function, uint32& out_begin, uint32& out_count) noexcept
+{
+	out_begin = getRecordsCount<SnapshotParameter>(_parameterRecords);
+	out_count = static_cast<uint32>(function.getParametersCount());
+
+	for (std::size_t i = 0u; i < function.getParametersCount(); i++)
+	{
+		FunctionParameter const&	parameter	= function.getParameterAt(i);
+		uint32						nameOffset	= addString(parameter.getName());
+		uint32						typeIndex	= addType(parameter.getType());
+
+		//addType appends to another table, so the record is appended last
+		SnapshotParameter& record = addRecord<SnapshotParameter>(_parameterRecords);
+
+		record._nameOffset	= nameOffset;
+		record._typeIndex	= typeIndex;
+	}
+}
+
+inline void SnapshotWriter::writeEntity(uint32 index) noexcept
+{
+	Entity const&	entity = *_entities[index];
+	SnapshotEntity&	record = getRecord<SnapshotEntity>(_entityRecords.data(), index);
+
+	record._id			= entity.getId();
+	record._nameOffset	= addString(entity.getName());
+	record._kind		= static_cast<uint16>(entity.getKind());
+	record._outerIndex	= getEntityIndex(entity.getOuterEntity());
+	record._typeIndex	= SnapshotFormat::invalidIndex;
+
+	if (entity.getOuterEntity() == nullptr)
+	{
+		_fileLevelEntities.push_back(index);
+	}
+
+	//Properties
+	record._propertiesBegin = getRecordsCount<SnapshotProperty>(_propertyRecords);
+	record._propertiesCount = static_cast<uint32>(entity.getPropertiesCount());
+
+	for (std::size_t i = 0u; i < entity.getPropertiesCount(); i++)
+	{
+		Property const&		property		= *entity.getPropertyAt(i);
+		Struct const&		archetype		= property.getArchetype();
+		SnapshotProperty&	propertyRecord	= addRecord<SnapshotProperty>(_propertyRecords);
+
+		propertyRecord._archetypeIndex		= getEntityIndex(&archetype);
+		propertyRecord._archetypeNameOffset	= addString(archetype.getName());
+		propertyRecord._archetypeId			= archetype.getId();
+		propertyRecord._shouldInherit		= property.getShouldInherit();
+		propertyRecord._allowMultiple		= property.getAllowMultiple();
+	}
+
+	//Nested entities are grouped by kind, in the order the reflected entity iterates them
+	record._nestedEntitiesBegin = static_cast<uint32>(_nestedEntities.size());
+
+	switch (entity.getKind())
+	{
+		case EEntityKind::Namespace:
+		{
+			Namespace const& n = static_cast<Namespace const&>(entity);
+
+			n.foreachNamespace(&SnapshotWriter::addNestedEntity<Namespace>, this);
+			n.foreachArchetype(&SnapshotWriter::addNestedEntity<Archetype>, this);
+			n.foreachVariable(&SnapshotWriter::addNestedEntity<Variable>, this);
+			n.foreachFunction(&SnapshotWriter::addNestedEntity<Function>, this);
+			break;
+		}
+
+		case EEntityKind::Struct:
+			[[fallthrough]];
+		case EEntityKind::Class:
+		{
+			Struct const& s = static_cast<Struct const&>(entity);
+
+			record._access	= static_cast<uint8>(s.getAccessSpecifier());
+			record._memory	= s.getMemorySize();
+			record._value	= static_cast<int64>(s.getClassKind());
+
+			//Parents which are not registered can't be referenced by the snapshot
+			record._directParentsBegin = getRecordsCount<SnapshotParentStruct>(_directParentRecords);
+
+			for (std::size_t i = 0u; i < s.getDirectParentsCount(); i++)
+			{
+				ParentStruct const&	parent		= s.getDirectParentAt(i);
+				uint32				parentIndex	= getEntityIndex(&parent.getArchetype());
+
+				if (parentIndex != SnapshotFormat::invalidIndex)
+				{
+					SnapshotParentStruct& parentRecord = addRecord<SnapshotParentStruct>(_directParentRecords);
+
+					parentRecord._archetypeIndex	= parentIndex;
+					parentRecord._inheritanceAccess	= static_cast<uint32>(parent.getInheritanceAccessSpecifier());
+				}
+			}
+
+			record._directParentsCount = getRecordsCount<SnapshotParentStruct>(_directParentRecords) - record._directParentsBegin;
+
+			//Subclasses are visited in no particular order, store them by id instead
+			record._subclassesBegin = static_cast<uint32>(_subclasses.size());
+
+			s.foreachSubclass([](Struct const& subclass, void* writer)
+							  {
+								  SnapshotWriter&	snapshotWriter	= *reinterpret_cast<SnapshotWriter*>(writer);
+								  uint32			subclassIndex	= snapshotWriter.getEntityIndex(&subclass);
+
+								  if (subclassIndex != SnapshotFormat::invalidIndex)
+								  {
+									  snapshotWriter._subclasses.push_back(subclassIndex);
+								  }
+
+								  return true;
+							  }, this);
+
+			std::sort(_subclasses.begin() + record._subclassesBegin, _subclasses.end());
+			record._subclassesCount = static_cast<uint32>(_subclasses.size()) - record._subclassesBegin;
+
+			s.foreachNestedArchetype(&SnapshotWriter::addNestedEntity<Archetype>, this);
+			s.foreachField(&SnapshotWriter::addNestedEntity<Field>, this);
+			s.foreachStaticField(&SnapshotWriter::addNestedEntity<StaticField>, this);
+			s.foreachMethod(&SnapshotWriter::addNestedEntity<Method>, this);
+			s.foreachStaticMethod(&SnapshotWriter::addNestedEntity<StaticMethod>, this);
+			break;
+		}
+
+		case EEntityKind::Enum:
+		{
+			Enum const& e = static_cast<Enum const&>(entity);
+
+			record._access		= static_cast<uint8>(e.getAccessSpecifier());
+			record._memory		= e.getMemorySize();
+			record._typeIndex	= addArchetypeType(e.getUnderlyingArchetype());
+
+			e.foreachEnumValue(&SnapshotWriter::addNestedEntity<EnumValue>, this);
+			break;
+		}
+
+		case EEntityKind::FundamentalArchetype:
+		{
+			Archetype const& archetype = static_cast<Archetype const&>(entity);
+
+			record._access	= static_cast<uint8>(archetype.getAccessSpecifier());
+			record._memory	= archetype.getMemorySize();
+			break;
+		}
+
+		case EEntityKind::Variable:
+		{
+			Variable const& variable = static_cast<Variable const&>(entity);
+
+			record._flags		= static_cast<uint32>(variable.getFlags());
+			record._typeIndex	= addType(variable.getType());
+			break;
+		}
+
+		case EEntityKind::Field:
+		{
+			FieldBase const& field = static_cast<FieldBase const&>(entity);
+
+			record._access		= static_cast<uint8>(field.getAccess());
+			record._flags		= static_cast<uint32>(field.getFlags());
+			record._typeIndex	= addType(field.getType());
+
+			if ((field.getFlags() & EFieldFlags::Static) == EFieldFlags::Default)
+			{
+				record._memory = static_cast<Field const&>(field).getMemoryOffset();
+			}
+			break;
+		}
+
+		case EEntityKind::Function:
+		{
+			Function const& function = static_cast<Function const&>(entity);
+
+			record._flags		= static_cast<uint32>(function.getFlags());
+			record._typeIndex	= addType(function.getReturnType());
+
+			addParameters(function, record._parametersBegin, record._parametersCount);
+			break;
+		}
+
+		case EEntityKind::Method:
+		{
+			MethodBase const& method = static_cast<MethodBase const&>(entity);
+
+			record._access		= static_cast<uint8>(method.getAccess());
+			record._flags		= static_cast<uint32>(method.getFlags());
+			record._typeIndex	= addType(method.getReturnType());
+
+			addParameters(method, record._parametersBegin, record._parametersCount);
+			break;
+		}
+
+		case EEntityKind::EnumValue:
+			record._value = static_cast<EnumValue const&>(entity).getValue();
+			break;
+
+		case EEntityKind::NamespaceFragment:
+			[[fallthrough]];
+		case EEntityKind::Undefined:
+			[[fallthrough]];
+		default:
+			//Namespace fragments are never registered by id
+			assert(false);
+			break;
+	}
+
+	record._nestedEntitiesCount = static_cast<uint32>(_nestedEntities.size()) - record._nestedEntitiesBegin;
+}
+
+inline Vector<uint8> SnapshotWriter::layOut() const noexcept
+{
+	SnapshotHeader header{};
+
+	std::memcpy(header.magic, SnapshotFormat::magic, sizeof(header.magic));
+	header.version			= DatabaseSnapshot::formatVersion;
+	header.endiannessMarker	= SnapshotFormat::endiannessMarker;
+
+	//Place each table after the header
+	uint64 size = sizeof(SnapshotHeader);
+
+	auto placeTable = [&size](SnapshotTable& table, std::size_t count, std::size_t elementSize)
+	{
+		size			= SnapshotFormat::align(static_cast<std::size_t>(size));
+		table.offset	= static_cast<uint32>(size);
+		table.count		= static_cast<uint32>(count);
+		size			+= static_cast<uint64>(count) * elementSize;
+	};
+
+	placeTable(header.entities,				_entities.size(),											sizeof(SnapshotEntity));
+	placeTable(header.fileLevelEntities,	_fileLevelEntities.size(),									sizeof(uint32));
+	placeTable(header.nestedEntities,		_nestedEntities.size(),										sizeof(uint32));
+	placeTable(header.directParents,		getRecordsCount<SnapshotParentStruct>(_directParentRecords),	sizeof(SnapshotParentStruct));
+	placeTable(header.subclasses,			_subclasses.size(),											sizeof(uint32));
+	placeTable(header.properties,			getRecordsCount<SnapshotProperty>(_propertyRecords),			sizeof(SnapshotProperty));
+	placeTable(header.parameters,			getRecordsCount<SnapshotParameter>(_parameterRecords),		sizeof(SnapshotParameter));
+	placeTable(header.types,				getRecordsCount<SnapshotType>(_typeRecords),					sizeof(SnapshotType));
+	placeTable(header.typeParts,			getRecordsCount<SnapshotTypePart>(_typePartRecords),			sizeof(SnapshotTypePart));
+	placeTable(header.strings,				_strings.size(),											sizeof(char));
+
+	size = SnapshotFormat::align(static_cast<std::size_t>(size));
+
+	//Offsets are stored on 32 bits
+	if (size > std::numeric_limits<uint32>::max())
+	{
+		return Vector<uint8>();
+	}
+
+	header.size = size;
+
+	Vector<uint8> snapshot;
+	snapshot.resize(static_cast<std::size_t>(size));
+
+	char* data = reinterpret_cast<char*>(snapshot.data());
+
+	std::memset(data, 0, static_cast<std::size_t>(size));
+	std::memcpy(data, &header, sizeof(header));
+
+	auto copyTable = [data](SnapshotTable const& table, void const* tableData, std::size_t elementSize)
+	{
+		if (table.count != 0u)
+		{
+			std::memcpy(data + table.offset, tableData, table.count * elementSize);
+		}
+	};
+
+	copyTable(header.entities,			_entityRecords.data(),			sizeof(SnapshotEntity));
+	copyTable(header.fileLevelEntities,	_fileLevelEntities.data(),		sizeof(uint32));
+	copyTable(header.nestedEntities,	_nestedEntities.data(),			sizeof(uint32));
+	copyTable(header.directParents,		_directParentRecords.data(),	sizeof(SnapshotParentStruct));
+	copyTable(header.subclasses,		_subclasses.data(),				sizeof(uint32));
+	copyTable(header.properties,		_propertyRecords.data(),		sizeof(SnapshotProperty));
+	copyTable(header.parameters,		_parameterRecords.data(),		sizeof(SnapshotParameter));
+	copyTable(header.types,				_typeRecords.data(),			sizeof(SnapshotType));
+	copyTable(header.typeParts,			_typePartRecords.data(),		sizeof(SnapshotTypePart));
+	copyTable(header.strings,			_strings.data(),				sizeof(char));
+
+	fixUpRecords<SnapshotEntity>(data, header.entities, &SnapshotEntity::_nameOffset, header.strings);
+	fixUpRecords<SnapshotParentStruct>(data, header.directParents, nullptr, header.strings);
+	fixUpRecords<SnapshotProperty>(data, header.properties, &SnapshotProperty::_archetypeNameOffset, header.strings);
+	fixUpRecords<SnapshotParameter>(data, header.parameters, &SnapshotParameter::_nameOffset, header.strings);
+	fixUpRecords<SnapshotType>(data, header.types, &SnapshotType::_archetypeNameOffset, header.strings);
+
+	return snapshot;
+}
+
+template <typename EntitiesContainer>
+Vector<uint8> SnapshotWriter::write(EntitiesContainer const& registeredEntities) noexcept
+{
+	SnapshotWriter writer(registeredEntities);
+
+	for (std::size_t i = 0u; i < writer._entities.size(); i++)
+	{
+		writer.writeEntity(static_cast<uint32>(i));
+	}
+
+	//File level entities are sorted by kind, then by name, then by id
+	std::sort(writer._fileLevelEntities.begin(), writer._fileLevelEntities.end(), [&writer](uint32 lhs, uint32 rhs)
+			  {
+				  Entity const& lhsEntity = *writer._entities[lhs];
+				  Entity const& rhsEntity = *writer._entities[rhs];
+
+				  if (lhsEntity.getKind() != rhsEntity.getKind())
+				  {
+					  return static_cast<uint16>(lhsEntity.getKind()) < static_cast<uint16>(rhsEntity.getKind());
+				  }
+
+				  int nameOrder = std::strcmp(lhsEntity.getName(), rhsEntity.getName());
+
+				  return (nameOrder != 0) ? (nameOrder < 0) : (lhs < rhs);
+			  });
+
+	return writer.layOut();
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>			//std::size_t
+#include <cstring>			//std::memcpy, std::memcmp
+#include <functional>		//std::hash
+#include <mutex>
+#include <unordered_set>
+
+#include "Refureku/TypeInfo/Type.h"
+#include "Refureku/TypeInfo/Archetypes/Archetype.h"
+
+namespace rfk
+{
+	class TypeInterner
+	{
+		private:
+			struct TypeHash
+			{
+				/**
+				*	@brief Compute the hash of a type from its archetype and its type parts.
+				* 
+				*	@param type The type to hash.
+				* 
+				*	@return The hash of the type.
+				*/
+				inline std::size_t operator()(Type const& type)	const	noexcept;
+			};
+
+			struct TypeEqual
+			{
+				/**
+				*	@brief	Structurally compare 2 types (archetype and type parts).
+				*			Canonical types are not involved in the comparison.
+				* 
+				*	@param lhs	The first type to compare.
+				*	@param rhs	The second type to compare.
+				* 
+				*	@return true if both types have the same archetype and type parts, else false.
+				*/
+				inline bool operator()(Type const& lhs,
+									   Type const& rhs)	const	noexcept;
+			};
+
+			/** Mutex protecting _canonicalTypes against concurrent interning. */
+			std::mutex										_mutex;
+
+			/** All canonical types. Nodes of an unordered_set are never relocated so canonical types keep the same address. */
+			std::unordered_set<Type, TypeHash, TypeEqual>	_canonicalTypes;
+
+		public:
+			/**
+			*	@brief	Get the canonical instance of the provided type.
+			*			If no canonical instance exists yet, a copy of the provided type becomes the canonical instance.
+			*			This method is thread-safe.
+			* 
+			*	@param type The type to intern.
+			* 
+			*	@return The canonical instance of the provided type.
+			*/
+			inline Type const&	intern(Type const& type)	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/TypeInterner.inl"
+}
@@ -0,0 +1,46 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::size_t TypeInterner::TypeHash::operator()(Type const& type) const noexcept
+{
+	std::size_t result = std::hash<Archetype const*>()(type.getArchetype());
+
+	for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+	{
+		uint64 rawPart;
+		std::memcpy(&rawPart, &type.getTypePartAt(i), sizeof(TypePart));
+
+		result ^= std::hash<uint64>()(rawPart) + 0x9e3779b9u + (result << 6) + (result >> 2);
+	}
+
+	return result;
+}
+
+inline bool TypeInterner::TypeEqual::operator()(Type const& lhs, Type const& rhs) const noexcept
+{
+	return	lhs.getArchetype() == rhs.getArchetype() &&
+			lhs.getTypePartsCount() == rhs.getTypePartsCount() &&
+			(lhs.getTypePartsCount() == 0u || std::memcmp(&lhs.getTypePartAt(0u), &rhs.getTypePartAt(0u), lhs.getTypePartsCount() * sizeof(TypePart)) == 0);
+}
+
+inline Type const& TypeInterner::intern(Type const& type) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto [it, inserted] = _canonicalTypes.emplace(type);
+
+	if (inserted)
+	{
+		//The canonical type is not part of the hash nor the equality so it can safely be modified in place
+		Type& canonicalType = const_cast<Type&>(*it);
+
+		canonicalType.optimizeMemory();
+		canonicalType._canonicalType = &canonicalType;
+	}
+
+	return *it;
+}
\ No newline at end of file
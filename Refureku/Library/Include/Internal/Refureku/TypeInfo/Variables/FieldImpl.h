@@ -36,4 +36,8 @@ namespace rfk
 	};
 
 	#include "Refureku/TypeInfo/Variables/FieldImpl.inl"
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Variables/FieldHotGetters.inl"
+#endif
\ No newline at end of file
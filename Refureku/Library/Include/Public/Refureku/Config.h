@@ -27,6 +27,36 @@
 	#define RFK_NON_PUBLIC_NESTED_CLASS_TEMPLATE_SUPPORT 0
 #endif
 
+/**
+*	RFK_INLINE_HOT_GETTERS: Hot getters (Entity::getName, Type::isPointer, Field::getMemoryOffset...) are defined in headers
+*							so that they can be inlined in user code.
+*							Only available when Refureku is built as a static library (REFUREKU_STATIC) since it exposes the library internal layout.
+*/
+#if defined(REFUREKU_STATIC)
+	#define RFK_INLINE_HOT_GETTERS 1
+#else
+	#define RFK_INLINE_HOT_GETTERS 0
+#endif
+
+/**
+*	RFK_INSTRUMENTATION:	Name lookups, id lookups, casts and invocations are counted per entity (see Refureku/TypeInfo/Instrumentation.h).
+*							Disabled by default, in which case the instrumentation has no cost at all.
+*							Must be defined to the same value when building Refureku and the code using it (RFK_ENABLE_INSTRUMENTATION CMake option).
+*/
+#ifndef RFK_INSTRUMENTATION
+	#define RFK_INSTRUMENTATION 0
+#endif
+
+/**
+*	RFK_REGISTRATION_TRACING:	Registerers, generated staticGetArchetype bodies, namespace merges and module loads are timed
+*								so that the static initialization cost of the reflection can be exported as a Chrome trace (see Refureku/TypeInfo/RegistrationTrace.h).
+*								Disabled by default, in which case the trace points compile to nothing.
+*								Must be defined to the same value when building Refureku and the code using it (RFK_ENABLE_REGISTRATION_TRACING CMake option).
+*/
+#ifndef RFK_REGISTRATION_TRACING
+	#define RFK_REGISTRATION_TRACING 0
+#endif
+
 //Debug / Release flags
 #ifndef NDEBUG
 
@@ -51,6 +81,13 @@
 	#define REFUREKU_INTERNAL
 	#define REFUREKU_TEMPLATE_API(...)
 
+#elif defined(REFUREKU_STATIC)
+
+	#define REFUREKU_API
+	#define REFUREKU_INTERNAL
+	#define REFUREKU_TEMPLATE_API_DEF
+	#define REFUREKU_TEMPLATE_API(...)
+
 #elif defined(_WIN32) || defined(__CYGWIN__)
 
 	#if defined(REFUREKU_EXPORT)
@@ -105,4 +142,11 @@
 
 	#endif
 
+#endif
+
+//Hot getters are either inlined in user code or exported from the library
+#if RFK_INLINE_HOT_GETTERS
+	#define REFUREKU_HOT_GETTER inline
+#else
+	#define REFUREKU_HOT_GETTER REFUREKU_API
 #endif
\ No newline at end of file
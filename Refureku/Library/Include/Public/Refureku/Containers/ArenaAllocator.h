@@ -0,0 +1,73 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <type_traits>	//std::true_type
+
+#include "Refureku/Misc/MemoryArena.h"
+
+namespace rfk
+{
+	/**
+	*	Stateful allocator allocating from a MemoryArena.
+	*	Deallocation is a no-op: the memory is released when the arena is reset.
+	*	Containers using this allocator must therefore not outlive the next reset of their arena.
+	*/
+	template <typename T>
+	class ArenaAllocator
+	{
+		template <typename U>
+		friend class ArenaAllocator;
+
+		private:
+			/** Arena the memory is allocated from. */
+			MemoryArena*	_arena;
+
+		public:
+			using value_type								= T;
+			using pointer									= T*;
+			using const_pointer								= T const*;
+			using reference									= T&;
+			using const_reference							= T const&;
+			using propagate_on_container_move_assignment	= std::true_type;
+
+			ArenaAllocator(MemoryArena& arena)						noexcept;
+
+			template <typename U>
+			ArenaAllocator(ArenaAllocator<U> const& other)			noexcept;
+
+			/**
+			*	@brief Allocate count * sizeof(T) bytes from the arena.
+			* 
+			*	@param count Number of elements T needed to fit in the allocated memory.
+			* 
+			*	@return A pointer to the allocated memory.
+			*/
+			RFK_NODISCARD T*	allocate(std::size_t count);
+
+			/**
+			*	@brief Does nothing, the memory is released when the arena is reset.
+			*/
+			void				deallocate(T*			allocatedMemory,
+										   std::size_t	count)			noexcept;
+
+			/**
+			*	@return The arena the memory is allocated from.
+			*/
+			MemoryArena&		getArena()						const	noexcept;
+
+			template <typename U>
+			bool				operator==(ArenaAllocator<U> const& other)	const	noexcept;
+
+			template <typename U>
+			bool				operator!=(ArenaAllocator<U> const& other)	const	noexcept;
+	};
+
+	#include "Refureku/Containers/ArenaAllocator.inl"
+}
\ No newline at end of file
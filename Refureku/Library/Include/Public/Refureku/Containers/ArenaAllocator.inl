@@ -0,0 +1,50 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+ArenaAllocator<T>::ArenaAllocator(MemoryArena& arena) noexcept:
+	_arena{&arena}
+{
+}
+
+template <typename T>
+template <typename U>
+ArenaAllocator<T>::ArenaAllocator(ArenaAllocator<U> const& other) noexcept:
+	_arena{other._arena}
+{
+}
+
+template <typename T>
+T* ArenaAllocator<T>::allocate(std::size_t count)
+{
+	return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+}
+
+template <typename T>
+void ArenaAllocator<T>::deallocate(T* /* allocatedMemory */, std::size_t /* count */) noexcept
+{
+}
+
+template <typename T>
+MemoryArena& ArenaAllocator<T>::getArena() const noexcept
+{
+	return *_arena;
+}
+
+template <typename T>
+template <typename U>
+bool ArenaAllocator<T>::operator==(ArenaAllocator<U> const& other) const noexcept
+{
+	return _arena == other._arena;
+}
+
+template <typename T>
+template <typename U>
+bool ArenaAllocator<T>::operator!=(ArenaAllocator<U> const& other) const noexcept
+{
+	return _arena != other._arena;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <iterator>		//std::forward_iterator_tag
+#include <utility>		//std::move
+
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
+
+namespace rfk
+{
+	/**
+	*	Lazy view over the items of a span satisfying a predicate.
+	*	The predicate is evaluated while iterating, so no memory is allocated and iteration can be stopped at any time.
+	*	The view is invalidated with the span it was built from.
+	* 
+	*	@tparam ResultType	Type the matching items are exposed as (static_cast from the span items).
+	*	@tparam ElementType	Type of the span elements, either the items themselves or pointers to them.
+	*	@tparam Predicate	Callable type returning true for matching items. It must be callable on a const instance.
+	*/
+	template <typename ResultType, typename ElementType, typename Predicate>
+	class FilteredView
+	{
+		public:
+			class Iterator
+			{
+				private:
+					/** Current element, always a matching one or _end. */
+					ElementType*		_current;
+
+					/** Element past the last element of the view span. */
+					ElementType*		_end;
+
+					/** Predicate of the view. */
+					Predicate const*	_predicate;
+
+					/**
+					*	@brief Move _current forward until it reaches a matching element or _end.
+					*/
+					void	skipNonMatching();
+
+				public:
+					using iterator_category	= std::forward_iterator_tag;
+					using value_type		= ResultType;
+					using difference_type	= std::ptrdiff_t;
+					using pointer			= ResultType const*;
+					using reference			= ResultType const&;
+
+					Iterator(ElementType*		current,
+							 ElementType*		end,
+							 Predicate const*	predicate);
+
+					ResultType const&	operator*()						const	noexcept;
+					ResultType const*	operator->()					const	noexcept;
+					Iterator&			operator++();
+					Iterator			operator++(int);
+					bool				operator==(Iterator const& other)	const	noexcept;
+					bool				operator!=(Iterator const& other)	const	noexcept;
+			};
+
+		private:
+			/** Span the items are filtered from. */
+			Span<ElementType>	_span;
+
+			/** Predicate returning true for the items exposed by the view. */
+			Predicate			_predicate;
+
+		public:
+			FilteredView(Span<ElementType>	span,
+						 Predicate			predicate);
+
+			/**
+			*	@return An iterator to the first matching item.
+			*/
+			Iterator			begin()									const;
+
+			/**
+			*	@return An iterator past the last matching item.
+			*/
+			Iterator			end()									const	noexcept;
+
+			/**
+			*	@brief Get the first matching item. The predicate is not evaluated past the first match.
+			* 
+			*	@return The first matching item if any, else nullptr.
+			*/
+			ResultType const*	first()									const;
+
+			/**
+			*	@return true if no item satisfies the predicate, else false.
+			*/
+			bool				empty()									const;
+
+			/**
+			*	@return The number of matching items.
+			*/
+			std::size_t			count()									const;
+
+			/**
+			*	@brief	Write the matching items in a caller provided buffer.
+			*			Iteration stops as soon as the buffer is full.
+			* 
+			*	@param outBuffer	Buffer receiving the matching items.
+			*	@param capacity		Number of items outBuffer can hold.
+			* 
+			*	@return The number of items written in outBuffer.
+			*/
+			std::size_t			copyTo(ResultType const**	outBuffer,
+									   std::size_t			capacity)	const;
+	};
+
+	#include "Refureku/Containers/FilteredView.inl"
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ResultType, typename ElementType, typename Predicate>
+FilteredView<ResultType, ElementType, Predicate>::Iterator::Iterator(ElementType* current, ElementType* end, Predicate const* predicate):
+	_current{current},
+	_end{end},
+	_predicate{predicate}
+{
+	skipNonMatching();
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+void FilteredView<ResultType, ElementType, Predicate>::Iterator::skipNonMatching()
+{
+	while (_current != _end && !(*_predicate)(internal::SpanAlgorithm::getItem(*_current)))
+	{
+		_current++;
+	}
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+ResultType const& FilteredView<ResultType, ElementType, Predicate>::Iterator::operator*() const noexcept
+{
+	return static_cast<ResultType const&>(internal::SpanAlgorithm::getItem(*_current));
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+ResultType const* FilteredView<ResultType, ElementType, Predicate>::Iterator::operator->() const noexcept
+{
+	return &**this;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+typename FilteredView<ResultType, ElementType, Predicate>::Iterator& FilteredView<ResultType, ElementType, Predicate>::Iterator::operator++()
+{
+	_current++;
+	skipNonMatching();
+
+	return *this;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+typename FilteredView<ResultType, ElementType, Predicate>::Iterator FilteredView<ResultType, ElementType, Predicate>::Iterator::operator++(int)
+{
+	Iterator result = *this;
+
+	++*this;
+
+	return result;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+bool FilteredView<ResultType, ElementType, Predicate>::Iterator::operator==(Iterator const& other) const noexcept
+{
+	return _current == other._current;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+bool FilteredView<ResultType, ElementType, Predicate>::Iterator::operator!=(Iterator const& other) const noexcept
+{
+	return _current != other._current;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+FilteredView<ResultType, ElementType, Predicate>::FilteredView(Span<ElementType> span, Predicate predicate):
+	_span{span},
+	_predicate{std::move(predicate)}
+{
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+typename FilteredView<ResultType, ElementType, Predicate>::Iterator FilteredView<ResultType, ElementType, Predicate>::begin() const
+{
+	return Iterator(_span.begin(), _span.end(), &_predicate);
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+typename FilteredView<ResultType, ElementType, Predicate>::Iterator FilteredView<ResultType, ElementType, Predicate>::end() const noexcept
+{
+	//The end iterator never evaluates the predicate since _current == _end
+	return Iterator(_span.end(), _span.end(), &_predicate);
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+ResultType const* FilteredView<ResultType, ElementType, Predicate>::first() const
+{
+	Iterator it = begin();
+
+	return (it != end()) ? &*it : nullptr;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+bool FilteredView<ResultType, ElementType, Predicate>::empty() const
+{
+	return begin() == end();
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+std::size_t FilteredView<ResultType, ElementType, Predicate>::count() const
+{
+	std::size_t result = 0u;
+
+	for (ElementType& element : _span)
+	{
+		if (_predicate(internal::SpanAlgorithm::getItem(element)))
+		{
+			result++;
+		}
+	}
+
+	return result;
+}
+
+template <typename ResultType, typename ElementType, typename Predicate>
+std::size_t FilteredView<ResultType, ElementType, Predicate>::copyTo(ResultType const** outBuffer, std::size_t capacity) const
+{
+	std::size_t written = 0u;
+
+	for (Iterator it = begin(); written < capacity && it != end(); it++)
+	{
+		outBuffer[written++] = &*it;
+	}
+
+	return written;
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>		//std::size_t
+#include <memory>		//std::allocator_traits
+#include <type_traits>	//std::is_move_constructible_v, std::is_copy_constructible_v
+
+#include "Refureku/Containers/Allocator.h"
+
+namespace rfk
+{
+	/**
+	*	Vector storing its first N elements inline.
+	*	The allocator is only used once the size exceeds the inline capacity,
+	*	so small collections (typically query results) don't allocate at all.
+	* 
+	*	@tparam T			Type of the stored elements.
+	*	@tparam N			Number of elements stored inline.
+	*	@tparam Allocator	Allocator used when the inline capacity is exceeded.
+	*/
+	template <typename T, std::size_t N, typename Allocator = rfk::Allocator<T>>
+	class SmallVector
+	{
+		private:
+			using AllocTraits = std::allocator_traits<Allocator>;
+
+			/** Factor used to compute new memory size when a reallocation occurs. */
+			static constexpr float const	_growthFactor = 2.0f;
+
+			/** Pointer to the storage in use, either _inlineStorage or allocated memory. */
+			T*			_data;
+
+			/** Number of currently constructed T objects in vector. */
+			std::size_t	_size;
+
+			/** Current capacity of the storage in use. */
+			std::size_t	_capacity;
+
+			/** Allocator used when the inline capacity is exceeded. */
+			Allocator	_allocator;
+
+			/** Inline storage for the first N elements. */
+			alignas(T) unsigned char	_inlineStorage[((N > 0u) ? N : 1u) * sizeof(T)];
+
+			/**
+			*	@return A pointer to the inline storage.
+			*/
+			T*			getInlineStorage()										noexcept;
+
+			/**
+			*	@brief Move or copy count elements from from into to, then destroy the source elements.
+			* 
+			*	@param from		Address of the source first element.
+			*	@param to		Address of the target first element.
+			*	@param count	Number of elements to relocate.
+			*/
+			void		relocateElements(T*				from,
+										 T*				to,
+										 std::size_t	count);
+
+			/**
+			*	@brief Destroy manually count elements from from.
+			* 
+			*	@param from		Address of the first element to destroy.
+			*	@param count	Number of elements to destroy.
+			*/
+			void		destroyElements(T*			from,
+										std::size_t count);
+
+			/**
+			*	@brief Destroy all elements and release the allocated memory, if any.
+			*/
+			void		release();
+
+			/**
+			*	@brief Compute the capacity to allocate when the vector grows.
+			* 
+			*	@param minCapacity The minimum capacity that should be allocated.
+			* 
+			*	@return The capacity to allocate.
+			*/
+			std::size_t	computeNewCapacity(std::size_t minCapacity)		const	noexcept;
+
+			/**
+			*	@brief	Reallocate the underlying memory if the container capacity is < the provided capacity.
+			* 
+			*	@param minCapacity The minimum capacity that should be allocated.
+			*/
+			void		reallocateIfNecessary(std::size_t minCapacity);
+
+			/**
+			*	@brief	Steal the allocated memory of other, or move its inline elements.
+			*			This vector must not hold any element, and its allocator must be able to release the memory of other.
+			* 
+			*	@param other The vector to move elements from.
+			*/
+			void		moveFrom(SmallVector& other);
+
+		public:
+			using value_type = T;
+			using allocator_type = Allocator;
+			using reference = value_type&;
+			using const_reference = value_type const&;
+
+			SmallVector(Allocator const& allocator = Allocator())	noexcept;
+			SmallVector(SmallVector const&);
+			SmallVector(SmallVector&&);
+			~SmallVector();
+
+			/**
+			*	@return true if the elements are stored in the inline storage, else false.
+			*/
+			bool		isInline()		const	noexcept;
+
+			/**
+			*	@return A copy of the allocator used by this vector.
+			*/
+			Allocator	get_allocator()	const	noexcept;
+
+			/**
+			*	@brief	Get a reference to the first element of the vector.
+			*			The behaviour is undefined if the vector is empty.
+			* 
+			*	@return A reference to the first element of the vector.
+			*/
+			T&			front()			noexcept;
+			T const&	front()	const	noexcept;
+
+			/**
+			*	@brief	Get a reference to the last element of the vector.
+			*			The behaviour is undefined if the vector is empty.
+			* 
+			*	@return A reference to the last element of the vector.
+			*/
+			T&			back()			noexcept;
+			T const&	back()	const	noexcept;
+
+			/**
+			*	@brief Get a pointer to the storage in use.
+			* 
+			*	@return A pointer to the storage in use.
+			*/
+			T*			data()			noexcept;
+			T const*	data()	const	noexcept;
+
+			/**
+			*	@brief	Reallocate the underlying memory to have enough space to fit capacity elements.
+			*			No reallocation happens if the provided capacity is equal or smaller than the current capacity.
+			* 
+			*	@param capacity New capacity.
+			*/
+			void		reserve(std::size_t capacity);
+
+			/**
+			*	@brief	Resize the vector so that it has exactly the specified size.
+			*			Reallocation occurs if the size is greater than the current capacity.
+			*			Objects are value initialized if the specified size is greater than the current size.
+			* 
+			*	@param size The new size.
+			*/
+			void		resize(std::size_t size);
+
+			/**
+			*	@brief Get the number of elements stored in the vector.
+			* 
+			*	@return The number of elements stored in the vector.
+			*/
+			std::size_t	size()			const	noexcept;
+
+			/**
+			*	@brief Get the maximum number of elements storable in the vector without reallocation.
+			* 
+			*	@return The maximum number of elements storable in the vector without reallocation.
+			*/
+			std::size_t capacity()		const	noexcept;
+
+			/**
+			*	@brief Check if the container contains no elements.
+			* 
+			*	@return true if there are no elements in the vector, else false.
+			*/
+			bool		empty()			const	noexcept;
+
+			/**
+			*	@brief Remove all elements from the vector. The storage in use is kept.
+			*/
+			void		clear();
+
+			/**
+			*	@brief Add an element to the vector.
+			* 
+			*	@param value The object to copy.
+			*/
+			void		push_back(T const& value);
+
+			/**
+			*	@brief Add an element to the vector.
+			* 
+			*	@param value The object to forward.
+			*/
+			void		push_back(T&& value);
+
+			/**
+			*	@brief Construct in place an element at the end of the vector with the provided arguments.
+			* 
+			*	@param... args Args forwarded to the object constructor.
+			* 
+			*	@return A reference to the constructed element.
+			*/
+			template <typename... Args>
+			T&			emplace_back(Args&&... args);
+
+			/**
+			*	@brief	Get a pointer to the first element.
+			*			If the vector is empty, the pointed memory is undefined.
+			* 
+			*	@return A pointer to the first element.
+			*/
+			T*			begin()				noexcept;
+			T const*	begin()		const	noexcept;
+			T const*	cbegin()	const	noexcept;
+
+			/**
+			*	@brief Get a pointer past the last element.
+			* 
+			*	@return A pointer past the last element.
+			*/
+			T*			end()				noexcept;
+			T const*	end()		const	noexcept;
+			T const*	cend()		const	noexcept;
+
+			/**
+			*	@brief Access the index(th) element in the vector.
+			* 
+			*	@param index Index of the element to access.
+			* 
+			*	@return A reference to the index(th) element in the vector.
+			*/
+			T&				operator[](std::size_t index)		noexcept;
+			T const&		operator[](std::size_t index) const	noexcept;
+
+			SmallVector&	operator=(SmallVector const&);
+			SmallVector&	operator=(SmallVector&&);
+	};
+
+	#include "Refureku/Containers/SmallVector.inl"
+}
\ No newline at end of file
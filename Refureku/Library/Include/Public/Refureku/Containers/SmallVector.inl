@@ -0,0 +1,426 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(Allocator const& allocator) noexcept:
+	_data{getInlineStorage()},
+	_size{0u},
+	_capacity{N},
+	_allocator{allocator}
+{
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SmallVector const& other):
+	_data{getInlineStorage()},
+	_size{0u},
+	_capacity{N},
+	_allocator{AllocTraits::select_on_container_copy_construction(other._allocator)}
+{
+	static_assert(std::is_copy_constructible_v<T>, "Can't copy a SmallVector of non-copyable type T.");
+
+	reserve(other._size);
+
+	for (T const& element : other)
+	{
+		AllocTraits::construct(_allocator, _data + _size, element);
+		_size++;
+	}
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SmallVector&& other):
+	_data{getInlineStorage()},
+	_size{0u},
+	_capacity{N},
+	_allocator{std::move(other._allocator)}
+{
+	moveFrom(other);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::~SmallVector()
+{
+	release();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T* SmallVector<T, N, Allocator>::getInlineStorage() noexcept
+{
+	return reinterpret_cast<T*>(_inlineStorage);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::relocateElements(T* from, T* to, std::size_t count)
+{
+	for (std::size_t i = 0u; i < count; i++)
+	{
+		//Move elements if possible, copy them otherwise
+		if constexpr (std::is_move_constructible_v<T>)
+		{
+			AllocTraits::construct(_allocator, to + i, std::move(*(from + i)));
+		}
+		else
+		{
+			AllocTraits::construct(_allocator, to + i, *(from + i));
+		}
+	}
+
+	destroyElements(from, count);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::destroyElements(T* from, std::size_t count)
+{
+	for (std::size_t i = 0u; i < count; i++)
+	{
+		AllocTraits::destroy(_allocator, from + i);
+	}
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::release()
+{
+	destroyElements(_data, _size);
+
+	if (!isInline())
+	{
+		_allocator.deallocate(_data, _capacity);
+	}
+
+	_data		= getInlineStorage();
+	_size		= 0u;
+	_capacity	= N;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+std::size_t SmallVector<T, N, Allocator>::computeNewCapacity(std::size_t minCapacity) const noexcept
+{
+	std::size_t newCapacity = static_cast<std::size_t>(_capacity * _growthFactor);
+
+	return (newCapacity > minCapacity) ? newCapacity : minCapacity;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::reallocateIfNecessary(std::size_t minCapacity)
+{
+	if (minCapacity > _capacity)
+	{
+		reserve(computeNewCapacity(minCapacity));
+	}
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::moveFrom(SmallVector& other)
+{
+	assert(_size == 0u);
+
+	if (other.isInline())
+	{
+		//Inline elements can't be stolen, move them one by one
+		relocateElements(other._data, _data, other._size);
+		_size = other._size;
+		other._size = 0u;
+	}
+	else
+	{
+		_data		= other._data;
+		_size		= other._size;
+		_capacity	= other._capacity;
+
+		other._data		= other.getInlineStorage();
+		other._size		= 0u;
+		other._capacity	= N;
+	}
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool SmallVector<T, N, Allocator>::isInline() const noexcept
+{
+	return _data == reinterpret_cast<T const*>(_inlineStorage);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+Allocator SmallVector<T, N, Allocator>::get_allocator() const noexcept
+{
+	return _allocator;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T& SmallVector<T, N, Allocator>::front() noexcept
+{
+	assert(!empty());
+
+	return *_data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const& SmallVector<T, N, Allocator>::front() const noexcept
+{
+	assert(!empty());
+
+	return *_data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T& SmallVector<T, N, Allocator>::back() noexcept
+{
+	assert(!empty());
+
+	return *(_data + _size - 1);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const& SmallVector<T, N, Allocator>::back() const noexcept
+{
+	assert(!empty());
+
+	return *(_data + _size - 1);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T* SmallVector<T, N, Allocator>::data() noexcept
+{
+	return _data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const* SmallVector<T, N, Allocator>::data() const noexcept
+{
+	return _data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::reserve(std::size_t capacity)
+{
+	if (capacity > _capacity)
+	{
+		T* newData = reinterpret_cast<T*>(_allocator.allocate(capacity));
+
+		relocateElements(_data, newData, _size);
+
+		if (!isInline())
+		{
+			_allocator.deallocate(_data, _capacity);
+		}
+
+		_data		= newData;
+		_capacity	= capacity;
+	}
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::resize(std::size_t size)
+{
+	if (size > _size)
+	{
+		reallocateIfNecessary(size);
+
+		for (std::size_t i = _size; i < size; i++)
+		{
+			AllocTraits::construct(_allocator, _data + i);
+		}
+	}
+	else if (size < _size)
+	{
+		destroyElements(_data + size, _size - size);
+	}
+
+	_size = size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+std::size_t SmallVector<T, N, Allocator>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+std::size_t SmallVector<T, N, Allocator>::capacity() const noexcept
+{
+	return _capacity;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+bool SmallVector<T, N, Allocator>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::clear()
+{
+	destroyElements(_data, _size);
+
+	_size = 0u;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::push_back(T const& value)
+{
+	emplace_back(value);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::push_back(T&& value)
+{
+	emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+T& SmallVector<T, N, Allocator>::emplace_back(Args&&... args)
+{
+	if (_size == _capacity)
+	{
+		std::size_t	newCapacity	= computeNewCapacity(_size + 1u);
+		T*			newData		= reinterpret_cast<T*>(_allocator.allocate(newCapacity));
+
+		//Construct the new element before relocating the others since args may reference one of them
+		AllocTraits::construct(_allocator, newData + _size, std::forward<Args>(args)...);
+		relocateElements(_data, newData, _size);
+
+		if (!isInline())
+		{
+			_allocator.deallocate(_data, _capacity);
+		}
+
+		_data		= newData;
+		_capacity	= newCapacity;
+	}
+	else
+	{
+		AllocTraits::construct(_allocator, _data + _size, std::forward<Args>(args)...);
+	}
+
+	_size++;
+
+	return back();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T* SmallVector<T, N, Allocator>::begin() noexcept
+{
+	return _data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const* SmallVector<T, N, Allocator>::begin() const noexcept
+{
+	return _data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const* SmallVector<T, N, Allocator>::cbegin() const noexcept
+{
+	return _data;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T* SmallVector<T, N, Allocator>::end() noexcept
+{
+	return _data + _size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const* SmallVector<T, N, Allocator>::end() const noexcept
+{
+	return _data + _size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const* SmallVector<T, N, Allocator>::cend() const noexcept
+{
+	return _data + _size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T& SmallVector<T, N, Allocator>::operator[](std::size_t index) noexcept
+{
+	return *(_data + index);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+T const& SmallVector<T, N, Allocator>::operator[](std::size_t index) const noexcept
+{
+	return *(_data + index);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(SmallVector const& other)
+{
+	if (this != &other)
+	{
+		if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+		{
+			//The current memory must be released by the allocator which allocated it
+			if constexpr (!AllocTraits::is_always_equal::value)
+			{
+				if (_allocator != other._allocator)
+				{
+					release();
+				}
+			}
+
+			_allocator = other._allocator;
+		}
+
+		clear();
+		reserve(other._size);
+
+		for (T const& element : other)
+		{
+			AllocTraits::construct(_allocator, _data + _size, element);
+			_size++;
+		}
+	}
+
+	return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(SmallVector&& other)
+{
+	if (this != &other)
+	{
+		//The stolen memory must be released by the allocator which allocated it
+		bool canStealMemory;
+
+		if constexpr (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+		{
+			canStealMemory = true;
+		}
+		else
+		{
+			canStealMemory = (_allocator == other._allocator);
+		}
+
+		if (canStealMemory)
+		{
+			release();
+
+			if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+			{
+				_allocator = std::move(other._allocator);
+			}
+
+			moveFrom(other);
+		}
+		else
+		{
+			//Move the elements one by one into memory allocated by our own allocator
+			clear();
+			reserve(other._size);
+
+			relocateElements(other._data, _data, other._size);
+			_size		= other._size;
+			other._size	= 0u;
+		}
+	}
+
+	return *this;
+}
\ No newline at end of file
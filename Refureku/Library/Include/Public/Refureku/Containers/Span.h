@@ -0,0 +1,79 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>	//std::size_t
+
+namespace rfk
+{
+	/**
+	*	Non-owning view over a contiguous sequence of T.
+	*	Spans returned by the reflection API remain valid until the viewed collection is modified (entity registration/unregistration).
+	*/
+	template <typename T>
+	class Span
+	{
+		private:
+			/** Pointer to the first viewed element. */
+			T*			_data;
+
+			/** Number of viewed elements. */
+			std::size_t	_size;
+
+		public:
+			using value_type = T;
+
+			constexpr Span()						noexcept;
+			constexpr Span(T*			data,
+						   std::size_t	size)		noexcept;
+			constexpr Span(Span const&)				= default;
+			constexpr Span(Span&&)					= default;
+
+			/**
+			*	@return A pointer to the first viewed element.
+			*/
+			constexpr T*			data()								const	noexcept;
+
+			/**
+			*	@return The number of viewed elements.
+			*/
+			constexpr std::size_t	size()								const	noexcept;
+
+			/**
+			*	@return true if the span doesn't view any element, else false.
+			*/
+			constexpr bool			empty()								const	noexcept;
+
+			/**
+			*	@return The first viewed element. The span must not be empty.
+			*/
+			constexpr T&			front()								const	noexcept;
+
+			/**
+			*	@return The last viewed element. The span must not be empty.
+			*/
+			constexpr T&			back()								const	noexcept;
+
+			/**
+			*	@return A pointer to the first viewed element.
+			*/
+			constexpr T*			begin()								const	noexcept;
+
+			/**
+			*	@return A pointer past the last viewed element.
+			*/
+			constexpr T*			end()								const	noexcept;
+
+			constexpr T&			operator[](std::size_t index)		const	noexcept;
+			constexpr Span&			operator=(Span const&)						= default;
+			constexpr Span&			operator=(Span&&)							= default;
+	};
+
+	#include "Refureku/Containers/Span.inl"
+}
\ No newline at end of file
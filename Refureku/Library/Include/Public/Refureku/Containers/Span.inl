@@ -0,0 +1,74 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+constexpr Span<T>::Span() noexcept:
+	_data{nullptr},
+	_size{0u}
+{
+}
+
+template <typename T>
+constexpr Span<T>::Span(T* data, std::size_t size) noexcept:
+	_data{data},
+	_size{size}
+{
+}
+
+template <typename T>
+constexpr T* Span<T>::data() const noexcept
+{
+	return _data;
+}
+
+template <typename T>
+constexpr std::size_t Span<T>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T>
+constexpr bool Span<T>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T>
+constexpr T& Span<T>::front() const noexcept
+{
+	assert(!empty());
+
+	return *_data;
+}
+
+template <typename T>
+constexpr T& Span<T>::back() const noexcept
+{
+	assert(!empty());
+
+	return *(_data + _size - 1);
+}
+
+template <typename T>
+constexpr T* Span<T>::begin() const noexcept
+{
+	return _data;
+}
+
+template <typename T>
+constexpr T* Span<T>::end() const noexcept
+{
+	return _data + _size;
+}
+
+template <typename T>
+constexpr T& Span<T>::operator[](std::size_t index) const noexcept
+{
+	assert(index < _size);
+
+	return *(_data + index);
+}
\ No newline at end of file
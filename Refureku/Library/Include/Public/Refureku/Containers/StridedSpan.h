@@ -0,0 +1,117 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>		//std::size_t, std::ptrdiff_t
+#include <type_traits>	//std::conditional_t, std::is_const_v
+
+#include "Refureku/Containers/Span.h"
+
+namespace rfk
+{
+	/**
+	*	Non-owning view over a sequence of T separated by a constant number of bytes,
+	*	like the same field of contiguous instances of a struct.
+	*/
+	template <typename T>
+	class StridedSpan
+	{
+		private:
+			using BytePointer = std::conditional_t<std::is_const_v<T>, unsigned char const*, unsigned char*>;
+
+			/** Pointer to the first viewed element. */
+			T*			_data;
+
+			/** Number of viewed elements. */
+			std::size_t	_size;
+
+			/** Number of bytes between two consecutive elements. */
+			std::size_t	_stride;
+
+		public:
+			class Iterator
+			{
+				private:
+					/** Pointer to the current element. */
+					BytePointer	_current;
+
+					/** Number of bytes between two consecutive elements. */
+					std::size_t	_stride;
+
+				public:
+					Iterator(BytePointer	current,
+							 std::size_t	stride)				noexcept;
+
+					T&			operator*()				const	noexcept;
+					T*			operator->()			const	noexcept;
+					Iterator&	operator++()					noexcept;
+					bool		operator==(Iterator const& other)	const	noexcept;
+					bool		operator!=(Iterator const& other)	const	noexcept;
+			};
+
+			using value_type = T;
+
+			constexpr StridedSpan()							noexcept;
+			constexpr StridedSpan(T*			data,
+								  std::size_t	size,
+								  std::size_t	stride)		noexcept;
+			constexpr StridedSpan(Span<T> span)				noexcept;
+			constexpr StridedSpan(StridedSpan const&)		= default;
+			constexpr StridedSpan(StridedSpan&&)			= default;
+
+			/**
+			*	@return A pointer to the first viewed element.
+			*/
+			constexpr T*			data()								const	noexcept;
+
+			/**
+			*	@return The number of viewed elements.
+			*/
+			constexpr std::size_t	size()								const	noexcept;
+
+			/**
+			*	@return The number of bytes between two consecutive elements.
+			*/
+			constexpr std::size_t	getStride()							const	noexcept;
+
+			/**
+			*	@return true if the span doesn't view any element, else false.
+			*/
+			constexpr bool			empty()								const	noexcept;
+
+			/**
+			*	@return true if the viewed elements are contiguous (the stride is sizeof(T)), else false.
+			*/
+			constexpr bool			isContiguous()						const	noexcept;
+
+			/**
+			*	@return A contiguous span viewing the same elements. The span must be contiguous.
+			*/
+			constexpr Span<T>		toSpan()							const	noexcept;
+
+			/**
+			*	@return An iterator to the first viewed element.
+			*/
+			Iterator				begin()								const	noexcept;
+
+			/**
+			*	@return An iterator past the last viewed element.
+			*/
+			Iterator				end()								const	noexcept;
+
+			/**
+			*	@return The element at the provided index. The index must be less than size().
+			*/
+			T&						operator[](std::size_t index)		const	noexcept;
+			constexpr StridedSpan&	operator=(StridedSpan const&)				= default;
+			constexpr StridedSpan&	operator=(StridedSpan&&)					= default;
+	};
+
+	#include "Refureku/Containers/StridedSpan.inl"
+}
\ No newline at end of file
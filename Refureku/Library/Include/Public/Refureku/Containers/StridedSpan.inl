@@ -0,0 +1,127 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+StridedSpan<T>::Iterator::Iterator(BytePointer current, std::size_t stride) noexcept:
+	_current{current},
+	_stride{stride}
+{
+}
+
+template <typename T>
+T& StridedSpan<T>::Iterator::operator*() const noexcept
+{
+	return *reinterpret_cast<T*>(_current);
+}
+
+template <typename T>
+T* StridedSpan<T>::Iterator::operator->() const noexcept
+{
+	return reinterpret_cast<T*>(_current);
+}
+
+template <typename T>
+typename StridedSpan<T>::Iterator& StridedSpan<T>::Iterator::operator++() noexcept
+{
+	_current += _stride;
+
+	return *this;
+}
+
+template <typename T>
+bool StridedSpan<T>::Iterator::operator==(Iterator const& other) const noexcept
+{
+	return _current == other._current;
+}
+
+template <typename T>
+bool StridedSpan<T>::Iterator::operator!=(Iterator const& other) const noexcept
+{
+	return _current != other._current;
+}
+
+template <typename T>
+constexpr StridedSpan<T>::StridedSpan() noexcept:
+	_data{nullptr},
+	_size{0u},
+	_stride{sizeof(T)}
+{
+}
+
+template <typename T>
+constexpr StridedSpan<T>::StridedSpan(T* data, std::size_t size, std::size_t stride) noexcept:
+	_data{data},
+	_size{size},
+	_stride{stride}
+{
+}
+
+template <typename T>
+constexpr StridedSpan<T>::StridedSpan(Span<T> span) noexcept:
+	_data{span.data()},
+	_size{span.size()},
+	_stride{sizeof(T)}
+{
+}
+
+template <typename T>
+constexpr T* StridedSpan<T>::data() const noexcept
+{
+	return _data;
+}
+
+template <typename T>
+constexpr std::size_t StridedSpan<T>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T>
+constexpr std::size_t StridedSpan<T>::getStride() const noexcept
+{
+	return _stride;
+}
+
+template <typename T>
+constexpr bool StridedSpan<T>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T>
+constexpr bool StridedSpan<T>::isContiguous() const noexcept
+{
+	return _stride == sizeof(T);
+}
+
+template <typename T>
+constexpr Span<T> StridedSpan<T>::toSpan() const noexcept
+{
+	assert(isContiguous());
+
+	return Span<T>(_data, _size);
+}
+
+template <typename T>
+typename StridedSpan<T>::Iterator StridedSpan<T>::begin() const noexcept
+{
+	return Iterator(reinterpret_cast<BytePointer>(_data), _stride);
+}
+
+template <typename T>
+typename StridedSpan<T>::Iterator StridedSpan<T>::end() const noexcept
+{
+	return Iterator(reinterpret_cast<BytePointer>(_data) + _size * _stride, _stride);
+}
+
+template <typename T>
+T& StridedSpan<T>::operator[](std::size_t index) const noexcept
+{
+	assert(index < _size);
+
+	return *reinterpret_cast<T*>(reinterpret_cast<BytePointer>(_data) + index * _stride);
+}
\ No newline at end of file
@@ -27,6 +27,9 @@ namespace rfk
 			/** Factor used to compute new memory size when a reallocation occurs. */
 			static constexpr float const _growthFactor = 2.0f;
 
+			/** Can the memory of a moved vector always be stolen, or must the elements be moved one by one when the allocators differ. */
+			static constexpr bool const _isMoveAssignmentNoexcept = AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value;
+
 			/** Pointer to the allocated space. */
 			T*			_data;
 
@@ -140,16 +143,22 @@ namespace rfk
 			using reference = value_type&;
 			using const_reference = value_type const&;
 			
-			Vector(std::size_t initialCapacity = 0u)	noexcept;
+			Vector(std::size_t		initialCapacity = 0u,
+				   Allocator const&	allocator = Allocator())	noexcept;
 
 			/** Retrieve data from another type U. NOT SAFE UNLESS YOU EXACTLY KNOW WHAT YOU DO. */
 			template <typename U, typename UAlloc>
-			Vector(Vector<U, UAlloc>&&)					noexcept;
+			Vector(Vector<U, UAlloc>&&)								noexcept;
 
 			Vector(Vector const&);
-			Vector(Vector&&)							noexcept;
+			Vector(Vector&&)										noexcept;
 			~Vector();
 
+			/**
+			*	@return A copy of the allocator used by this vector.
+			*/
+			Allocator	get_allocator()	const	noexcept;
+
 			/**
 			*	@brief	Get a reference to the first element of the vector.
 			*			The behaviour is undefined if the vector is empty.
@@ -299,7 +308,7 @@ namespace rfk
 			T const&		operator[](std::size_t index) const	noexcept;
 
 			Vector&			operator=(Vector const&);
-			Vector&			operator=(Vector&&)					noexcept;
+			Vector&			operator=(Vector&&)					noexcept(_isMoveAssignmentNoexcept);
 	};
 
 	#include "Refureku/Containers/Vector.inl"
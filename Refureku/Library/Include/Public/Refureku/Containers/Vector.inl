@@ -6,10 +6,11 @@
 */
 
 template <typename T, typename Allocator>
-Vector<T, Allocator>::Vector(std::size_t initialCapacity) noexcept:
+Vector<T, Allocator>::Vector(std::size_t initialCapacity, Allocator const& allocator) noexcept:
 	_data{nullptr},
 	_size{0u},
-	_capacity{0u}
+	_capacity{0u},
+	_allocator{allocator}
 {
 	reserve(computeNewCapacity(initialCapacity));
 }
@@ -30,7 +31,8 @@ template <typename T, typename Allocator>
 Vector<T, Allocator>::Vector(Vector const& other):
 	_data{nullptr},
 	_size{0u},
-	_capacity{0u}
+	_capacity{0u},
+	_allocator{AllocTraits::select_on_container_copy_construction(other._allocator)}
 {
 	resize(other._size);
 
@@ -41,7 +43,8 @@ template <typename T, typename Allocator>
 Vector<T, Allocator>::Vector(Vector&& other) noexcept:
 	_data{other._data},
 	_size{other._size},
-	_capacity{other._capacity}
+	_capacity{other._capacity},
+	_allocator{std::move(other._allocator)}
 {
 	other._data		= nullptr;
 	other._size		= 0u;
@@ -201,6 +204,12 @@ std::size_t	Vector<T, Allocator>::computeNewCapacity(std::size_t minCapacity) co
 	return (newCapacity > minCapacity) ? newCapacity : minCapacity;
 }
 
+template <typename T, typename Allocator>
+Allocator Vector<T, Allocator>::get_allocator() const noexcept
+{
+	return _allocator;
+}
+
 template <typename T, typename Allocator>
 T& Vector<T, Allocator>::front() noexcept
 {
@@ -443,26 +452,83 @@ T const& Vector<T, Allocator>::operator[](std::size_t index) const noexcept
 template <typename T, typename Allocator>
 Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector const& other)
 {
-	destroyElements(data(), _size);
+	if (this != &other)
+	{
+		if constexpr (AllocTraits::propagate_on_container_copy_assignment::value)
+		{
+			//The current memory must be released by the allocator which allocated it
+			if constexpr (!AllocTraits::is_always_equal::value)
+			{
+				if (_allocator != other._allocator)
+				{
+					checkedDelete();
+
+					_data		= nullptr;
+					_size		= 0u;
+					_capacity	= 0u;
+				}
+			}
 
-	reallocateIfNecessary(other.size());
+			_allocator = other._allocator;
+		}
+
+		//Clear first so that reallocation doesn't move destroyed elements
+		clear();
 
-	copyElements(other.data(), data(), other.size());
+		reallocateIfNecessary(other.size());
+
+		copyElements(other.data(), data(), other.size());
+		_size = other.size();
+	}
 
 	return *this;
 }
 
 template <typename T, typename Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& other) noexcept
+Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& other) noexcept(_isMoveAssignmentNoexcept)
 {
-	checkedDelete();
+	if (this != &other)
+	{
+		//The stolen memory must be released by the allocator which allocated it
+		bool canStealMemory;
 
-	_data			= other._data;
-	_size			= other._size;
-	_capacity		= other._capacity;
-	other._data		= nullptr;
-	other._size		= 0u;
-	other._capacity	= 0u;
+		if constexpr (_isMoveAssignmentNoexcept)
+		{
+			canStealMemory = true;
+		}
+		else
+		{
+			canStealMemory = (_allocator == other._allocator);
+		}
+
+		if (canStealMemory)
+		{
+			checkedDelete();
+
+			if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+			{
+				_allocator = std::move(other._allocator);
+			}
+
+			_data			= other._data;
+			_size			= other._size;
+			_capacity		= other._capacity;
+			other._data		= nullptr;
+			other._size		= 0u;
+			other._capacity	= 0u;
+		}
+		else
+		{
+			//Move the elements one by one into memory allocated by our own allocator
+			clear();
+			reallocateIfNecessary(other.size());
+
+			moveElements(other.data(), data(), other.size());
+			_size = other.size();
+
+			other.clear();
+		}
+	}
 
 	return *this;
 }
\ No newline at end of file
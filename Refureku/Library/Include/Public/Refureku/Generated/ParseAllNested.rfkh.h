@@ -20,6 +20,7 @@
 #include <Refureku/TypeInfo/Archetypes/Template/TypeTemplateArgument.h>
 #include <Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h>
 #include <Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h>
+#include <Refureku/TypeInfo/RegistrationTrace.h>
 
 
 #define kodgen_ParseAllNested_GENERATED	\
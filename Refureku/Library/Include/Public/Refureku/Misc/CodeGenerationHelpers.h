@@ -9,6 +9,9 @@
 
 #include <array>
 #include <cstddef>	//std::size_t, std::ptrdiff_t
+#include <new>		//placement new
+#include <memory>	//std::uninitialized_copy_n, std::uninitialized_move_n
+#include <algorithm>	//std::copy_n, std::move
 
 #include "Refureku/Config.h"
 #include "Refureku/Misc/TypeTraitsMacros.h"
@@ -109,6 +112,88 @@ namespace rfk::internal
 			template <typename T>
 			RFK_NODISCARD static rfk::UniquePtr<T>	defaultUniqueInstantiator() noexcept(!std::is_default_constructible_v<T> || std::is_nothrow_constructible_v<T>);
 #endif
+
+			/**
+			*	@brief	Construct a class in the provided memory if it is default constructible.
+			*			This is the default method used to instantiate classes through Struct::makeInstanceAt.
+			*	
+			*	@param memory Memory receiving the instance.
+			*
+			*	@return A pointer to the constructed instance if the class is default constructible, else nullptr.
+			* 
+			*	@exception Potential exception thrown by T constructor.
+			*/
+#if defined(__GNUC__) && !defined (__clang__) && __GNUC__ <= 9
+			//Handle pre GCC 9 internal compiler error when using type traits in noexcept
+			template <typename T>
+			RFK_NODISCARD static void*				defaultPlacementInstantiator(void* memory);
+#else
+			template <typename T>
+			RFK_NODISCARD static void*				defaultPlacementInstantiator(void* memory) noexcept(!std::is_default_constructible_v<T> || std::is_nothrow_constructible_v<T>);
+#endif
+
+			/**
+			*	@brief	Destroy an instance of a class without releasing its memory.
+			*			This is the destructor used by Struct::destroyInstanceAt.
+			*
+			*	@param instance Pointer to the instance to destroy.
+			*/
+			template <typename T>
+			static void								defaultDestructor(void* instance)	noexcept;
+
+			/**
+			*	@brief	Get the function copy constructing instances of a class, used by Struct::copyConstructAt.
+			*
+			*	@return A function copy constructing instances of T if T is copy constructible, else nullptr.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr Struct::CopyConstructor	getDefaultCopyConstructor()		noexcept;
+
+			/**
+			*	@brief	Get the function move constructing instances of a class, used by Struct::moveConstructAt and Struct::relocateAt.
+			*
+			*	@return A function move constructing instances of T if T is move constructible, else nullptr.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr Struct::MoveConstructor	getDefaultMoveConstructor()		noexcept;
+
+			/**
+			*	@brief	Get the function copy assigning instances of a class, used by Struct::copyAssign.
+			*
+			*	@return A function copy assigning instances of T if T is copy assignable, else nullptr.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr Struct::CopyAssignment	getDefaultCopyAssignment()		noexcept;
+
+			/**
+			*	@brief	Get the function move assigning instances of a class, used by Struct::moveAssign.
+			*
+			*	@return A function move assigning instances of T if T is move assignable, else nullptr.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr Struct::MoveAssignment	getDefaultMoveAssignment()		noexcept;
+
+			/**
+			*	@brief	Compute the traits of a class.
+			*			A class is considered trivially relocatable only if it is trivially move constructible and trivially destructible.
+			*
+			*	@return The traits of T.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr EStructTraits			computeStructTraits()			noexcept;
+
+		private:
+			template <typename T>
+			static void								copyConstruct(void* destination, void const* source, std::size_t count);
+
+			template <typename T>
+			static void								moveConstruct(void* destination, void* source, std::size_t count);
+
+			template <typename T>
+			static void								copyAssign(void* destination, void const* source, std::size_t count);
+
+			template <typename T>
+			static void								moveAssign(void* destination, void* source, std::size_t count);
 	};
 
 	template <auto>
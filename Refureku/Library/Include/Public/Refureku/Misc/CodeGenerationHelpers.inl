@@ -80,4 +80,117 @@ noexcept(!std::is_default_constructible_v<T> || std::is_nothrow_constructible_v<
 	{
 		return nullptr;
 	}
+}
+
+template <typename T>
+void* CodeGenerationHelpers::defaultPlacementInstantiator(void* memory)
+#if !defined(__GNUC__) || defined (__clang__) || __GNUC__ > 9
+noexcept(!std::is_default_constructible_v<T> || std::is_nothrow_constructible_v<T>)
+#endif
+{
+	if constexpr (std::is_default_constructible_v<T>)
+	{
+		return new (memory) T();
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+void CodeGenerationHelpers::defaultDestructor(void* instance) noexcept
+{
+	if constexpr (std::is_destructible_v<T>)
+	{
+		static_cast<T*>(instance)->~T();
+	}
+}
+
+template <typename T>
+constexpr Struct::CopyConstructor CodeGenerationHelpers::getDefaultCopyConstructor() noexcept
+{
+	if constexpr (std::is_copy_constructible_v<T>)
+	{
+		return &copyConstruct<T>;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+constexpr Struct::MoveConstructor CodeGenerationHelpers::getDefaultMoveConstructor() noexcept
+{
+	if constexpr (std::is_move_constructible_v<T>)
+	{
+		return &moveConstruct<T>;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+constexpr Struct::CopyAssignment CodeGenerationHelpers::getDefaultCopyAssignment() noexcept
+{
+	if constexpr (std::is_copy_assignable_v<T>)
+	{
+		return &copyAssign<T>;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+constexpr Struct::MoveAssignment CodeGenerationHelpers::getDefaultMoveAssignment() noexcept
+{
+	if constexpr (std::is_move_assignable_v<T>)
+	{
+		return &moveAssign<T>;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+constexpr EStructTraits CodeGenerationHelpers::computeStructTraits() noexcept
+{
+	return (std::is_trivially_copyable_v<T> ? EStructTraits::TriviallyCopyable : EStructTraits::Default) |
+			((std::is_trivially_move_constructible_v<T> && std::is_trivially_destructible_v<T>) ? EStructTraits::TriviallyRelocatable : EStructTraits::Default) |
+			(std::is_trivially_copy_constructible_v<T> ? EStructTraits::TriviallyCopyConstructible : EStructTraits::Default) |
+			(std::is_trivially_move_constructible_v<T> ? EStructTraits::TriviallyMoveConstructible : EStructTraits::Default) |
+			(std::is_trivially_copy_assignable_v<T> ? EStructTraits::TriviallyCopyAssignable : EStructTraits::Default) |
+			(std::is_trivially_move_assignable_v<T> ? EStructTraits::TriviallyMoveAssignable : EStructTraits::Default);
+}
+
+template <typename T>
+void CodeGenerationHelpers::copyConstruct(void* destination, void const* source, std::size_t count)
+{
+	//Destroys the already constructed instances if a copy throws
+	std::uninitialized_copy_n(static_cast<T const*>(source), count, static_cast<T*>(destination));
+}
+
+template <typename T>
+void CodeGenerationHelpers::moveConstruct(void* destination, void* source, std::size_t count)
+{
+	std::uninitialized_move_n(static_cast<T*>(source), count, static_cast<T*>(destination));
+}
+
+template <typename T>
+void CodeGenerationHelpers::copyAssign(void* destination, void const* source, std::size_t count)
+{
+	std::copy_n(static_cast<T const*>(source), count, static_cast<T*>(destination));
+}
+
+template <typename T>
+void CodeGenerationHelpers::moveAssign(void* destination, void* source, std::size_t count)
+{
+	std::move(static_cast<T*>(source), static_cast<T*>(source) + count, static_cast<T*>(destination));
 }
\ No newline at end of file
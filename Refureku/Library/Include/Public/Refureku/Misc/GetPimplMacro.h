@@ -9,7 +9,7 @@
 
 #include "Refureku/Config.h"
 
-#if defined(REFUREKU_EXPORT)
+#if defined(REFUREKU_EXPORT) || RFK_INLINE_HOT_GETTERS
 
 #include "Refureku/Misc/GetPimplMacroImpl.h"
 
@@ -0,0 +1,119 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t, std::max_align_t
+#include <cstdint>	//std::uintptr_t
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	/**
+	*	Monotonic allocator carving allocations out of big memory chunks.
+	*	Individual allocations are never released: all of them are released at once by reset(),
+	*	which makes the arena suitable for short-lived (e.g. frame-scoped) query results.
+	*	Chunks are kept on reset so that a steady workload stops allocating from the system after its first cycle.
+	*/
+	class MemoryArena
+	{
+		private:
+			struct Chunk
+			{
+				/** Next chunk in the chunks list. */
+				Chunk*		next;
+
+				/** Number of bytes usable in this chunk, not counting this header. */
+				std::size_t	capacity;
+			};
+
+			/** Default number of usable bytes in a chunk. */
+			static constexpr std::size_t	_defaultChunkSize = 4096u;
+
+			/** First chunk of the chunks list. */
+			Chunk*			_firstChunk;
+
+			/** Chunk the allocations are currently carved from. */
+			Chunk*			_currentChunk;
+
+			/** First free byte of the current chunk. */
+			std::uintptr_t	_cursor;
+
+			/** Byte past the last usable byte of the current chunk. */
+			std::uintptr_t	_end;
+
+			/** Minimum number of usable bytes in a newly allocated chunk. */
+			std::size_t		_chunkSize;
+
+			/**
+			*	@brief Get the address of the first usable byte of a chunk.
+			* 
+			*	@param chunk The chunk.
+			* 
+			*	@return The address of the first usable byte of the chunk.
+			*/
+			static std::uintptr_t	getChunkData(Chunk* chunk)					noexcept;
+
+			/**
+			*	@brief Make the provided chunk the current one.
+			* 
+			*	@param chunk The chunk to carve allocations from.
+			*/
+			void					setCurrentChunk(Chunk* chunk)				noexcept;
+
+			/**
+			*	@brief	Allocate memory when the current chunk can't fit the allocation.
+			*			The next chunk is reused if it is big enough, otherwise a new chunk is inserted after the current one.
+			* 
+			*	@param size			Number of bytes to allocate.
+			*	@param alignment	Alignment of the allocated memory.
+			* 
+			*	@return A pointer to the allocated memory.
+			* 
+			*	@exception std::bad_alloc if the system fails to allocate a new chunk.
+			*/
+			REFUREKU_API void*		allocateFromNextChunk(std::size_t	size,
+														  std::size_t	alignment);
+
+		public:
+			REFUREKU_API MemoryArena(std::size_t chunkSize = _defaultChunkSize)	noexcept;
+			MemoryArena(MemoryArena const&)										= delete;
+			MemoryArena(MemoryArena&&)											= delete;
+			REFUREKU_API ~MemoryArena();
+
+			/**
+			*	@brief Allocate memory from the arena.
+			* 
+			*	@param size			Number of bytes to allocate.
+			*	@param alignment	Alignment of the allocated memory. Must be a power of 2.
+			* 
+			*	@return A pointer to the allocated memory, valid until the next reset.
+			* 
+			*	@exception std::bad_alloc if the system fails to allocate a new chunk.
+			*/
+			RFK_NODISCARD inline void*	allocate(std::size_t	size,
+												 std::size_t	alignment = alignof(std::max_align_t));
+
+			/**
+			*	@brief	Release all the allocations made from this arena at once.
+			*			The memory chunks are kept to serve the next allocations.
+			*/
+			REFUREKU_API void			reset()								noexcept;
+
+			/**
+			*	@return The total number of bytes reserved from the system by this arena.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				std::size_t				getReservedBytes()					const	noexcept;
+
+			MemoryArena&				operator=(MemoryArena const&)		= delete;
+			MemoryArena&				operator=(MemoryArena&&)			= delete;
+	};
+
+	#include "Refureku/Misc/MemoryArena.inl"
+}
\ No newline at end of file
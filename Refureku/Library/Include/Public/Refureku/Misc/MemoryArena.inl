@@ -0,0 +1,21 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline void* MemoryArena::allocate(std::size_t size, std::size_t alignment)
+{
+	std::uintptr_t address = (_cursor + alignment - 1u) & ~static_cast<std::uintptr_t>(alignment - 1u);
+
+	//Fast path: bump the cursor of the current chunk
+	if (_currentChunk != nullptr && address + size <= _end)
+	{
+		_cursor = address + size;
+
+		return reinterpret_cast<void*>(address);
+	}
+
+	return allocateFromNextChunk(size, alignment);
+}
\ No newline at end of file
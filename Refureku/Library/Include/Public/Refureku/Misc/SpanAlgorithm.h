@@ -0,0 +1,83 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>	//std::enable_if_t, std::is_invocable_r_v, std::is_pointer_v
+
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Containers/Vector.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Enable a template overload only if Callable can be called with a T const& and returns a value convertible to bool.
+	*	Used to discriminate the header-only visitor/predicate overloads from the rfk::Visitor/rfk::Predicate ones.
+	*/
+	template <typename Callable, typename T>
+	using EnableIfCallableWith = std::enable_if_t<std::is_invocable_r_v<bool, Callable, T const&>>;
+
+	/**
+	*	Header-only algorithms iterating over the spans exposed by the reflection API.
+	*	Callables are forwarded and called directly so that they can be inlined in the caller code.
+	*/
+	class SpanAlgorithm
+	{
+		public:
+			/**
+			*	@brief Get a reference to the item designated by a span element.
+			* 
+			*	@param element The span element, either the item itself or a pointer to it.
+			* 
+			*	@return A reference to the designated item.
+			*/
+			template <typename T>
+			static constexpr auto&	getItem(T& element)	noexcept;
+
+			/**
+			*	@brief Call the visitor on each item of the span.
+			* 
+			*	@param span		The span to iterate over.
+			*	@param visitor	Callable returning false to abort the iteration.
+			* 
+			*	@return true if the whole span was visited, false if the visitor aborted the iteration.
+			*/
+			template <typename T, typename Visitor>
+			static bool				foreach(Span<T>		span,
+											Visitor&&	visitor);
+
+			/**
+			*	@brief Get the first item of the span satisfying the predicate.
+			* 
+			*	@tparam ResultType Type the found item is static_cast to.
+			* 
+			*	@param span			The span to iterate over.
+			*	@param predicate	Callable returning true for the searched item.
+			* 
+			*	@return The first item satisfying the predicate if any, else nullptr.
+			*/
+			template <typename ResultType, typename T, typename Predicate>
+			static ResultType const*			getItemByPredicate(Span<T>		span,
+																   Predicate&&	predicate);
+
+			/**
+			*	@brief Get all items of the span satisfying the predicate.
+			* 
+			*	@tparam ResultType Type the found items are static_cast to.
+			* 
+			*	@param span			The span to iterate over.
+			*	@param predicate	Callable returning true for searched items.
+			* 
+			*	@return All items satisfying the predicate.
+			*/
+			template <typename ResultType, typename T, typename Predicate>
+			static Vector<ResultType const*>	getItemsByPredicate(Span<T>		span,
+																	Predicate&&	predicate);
+	};
+
+	#include "Refureku/Misc/SpanAlgorithm.inl"
+}
\ No newline at end of file
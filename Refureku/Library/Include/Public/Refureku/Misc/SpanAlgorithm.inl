@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+constexpr auto& SpanAlgorithm::getItem(T& element) noexcept
+{
+	if constexpr (std::is_pointer_v<std::remove_cv_t<T>>)
+	{
+		return *element;
+	}
+	else
+	{
+		return element;
+	}
+}
+
+template <typename T, typename Visitor>
+bool SpanAlgorithm::foreach(Span<T> span, Visitor&& visitor)
+{
+	for (T& element : span)
+	{
+		if (!visitor(getItem(element)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename ResultType, typename T, typename Predicate>
+ResultType const* SpanAlgorithm::getItemByPredicate(Span<T> span, Predicate&& predicate)
+{
+	for (T& element : span)
+	{
+		if (predicate(getItem(element)))
+		{
+			return static_cast<ResultType const*>(&getItem(element));
+		}
+	}
+
+	return nullptr;
+}
+
+template <typename ResultType, typename T, typename Predicate>
+Vector<ResultType const*> SpanAlgorithm::getItemsByPredicate(Span<T> span, Predicate&& predicate)
+{
+	//When calling this method, we expect to have at least 2 results, so preallocate memory to avoid reallocations.
+	Vector<ResultType const*> result(2);
+
+	for (T& element : span)
+	{
+		if (predicate(getItem(element)))
+		{
+			result.push_back(static_cast<ResultType const*>(&getItem(element)));
+		}
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>	//std::size_t
+
 namespace rfk
 {
 	/**
@@ -19,4 +21,16 @@ namespace rfk
 	*/
 	template <typename T>
 	using Visitor = bool (*)(T const& value, void* userData);
+
+	/**
+	*	@brief Visitor function used by parallel traversals.
+	* 
+	*	@param value		The visited value.
+	*	@param chunkIndex	Index of the chunk the visited value belongs to.
+	*	@param userData		Data received from the user.
+	* 
+	*	@return true to make the visitor continue to the next value, else false (abort).
+	*/
+	template <typename T>
+	using ChunkVisitor = bool (*)(T const& value, std::size_t chunkIndex, void* userData);
 }
\ No newline at end of file
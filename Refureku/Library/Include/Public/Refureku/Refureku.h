@@ -9,6 +9,9 @@
 
 #include "Refureku/Config.h"
 
+#include "Refureku/Containers/SmallVector.h"
+#include "Refureku/Containers/ArenaAllocator.h"
+
 #include "Refureku/TypeInfo/Type.h"
 #include "Refureku/TypeInfo/Database.h"
 #include "Refureku/TypeInfo/Entity/Entity.h"
@@ -19,12 +22,18 @@
 #include "Refureku/TypeInfo/Functions/Function.h"
 #include "Refureku/TypeInfo/Functions/Method.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/TypeInfo/Functions/MethodCommandBuffer.h"
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
+#include "Refureku/TypeInfo/Module/ModuleHandle.h"
+#include "Refureku/TypeInfo/Query/EntityQuery.h"
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/EnumValue.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Archetypes/StructPool.h"
+#include "Refureku/TypeInfo/Archetypes/StructStorage.h"
 #include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
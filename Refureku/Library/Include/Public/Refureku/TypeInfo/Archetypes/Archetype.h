@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/EAccessSpecifier.h"
 
@@ -51,7 +52,4 @@ namespace rfk
 
 			RFK_GEN_GET_PIMPL(ArchetypeImpl, Entity::getPimpl())
 	};
-
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Archetype const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Archetype const*, rfk::Allocator<Archetype const*>>);
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Defines how a rfk::StructStorage lays out the instances in its chunks:
+	*			- AoS: Array of structures. The instances are stored contiguously, each field being strided by the struct size.
+	*			- SoA: Structure of arrays. The values of each reflected field are stored contiguously, instances are never materialized.
+	*/
+	enum class EStructStorageLayout : uint8
+	{
+		AoS,
+		SoA
+	};
+}
\ No newline at end of file
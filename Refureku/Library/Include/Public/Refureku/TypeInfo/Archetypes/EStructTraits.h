@@ -0,0 +1,43 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/Misc/EnumMacros.h"
+
+namespace rfk
+{
+	enum class EStructTraits : uint8
+	{
+		/** No trait. */
+		Default					= 0,
+
+		/**
+		*	The struct is trivially copyable: its instances can be duplicated bytewise and its destructor does nothing.
+		*	Some of its copy and move operations may still be deleted, so each memcpy path checks the trait of its own operation.
+		*/
+		TriviallyCopyable			= 1 << 0,
+
+		/** An instance can be moved to another memory location and its source memory released without calling any constructor or destructor. */
+		TriviallyRelocatable		= 1 << 1,
+
+		/** The copy constructor is accessible and trivial, so instances can be copy constructed with a memcpy. */
+		TriviallyCopyConstructible	= 1 << 2,
+
+		/** The move constructor is accessible and trivial, so instances can be move constructed with a memcpy. */
+		TriviallyMoveConstructible	= 1 << 3,
+
+		/** The copy assignment operator is accessible and trivial, so instances can be copy assigned with a memcpy. */
+		TriviallyCopyAssignable		= 1 << 4,
+
+		/** The move assignment operator is accessible and trivial, so instances can be move assigned with a memcpy. */
+		TriviallyMoveAssignable		= 1 << 5
+	};
+
+	RFK_GENERATE_ENUM_OPERATORS(EStructTraits)
+}
\ No newline at end of file
@@ -7,7 +7,13 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
+#include "Refureku/TypeInfo/Archetypes/EnumStringTable.h"
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Containers/FilteredView.h"
+#include "Refureku/Containers/SmallVector.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
 
 namespace rfk
 {
@@ -67,6 +73,37 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API
 				Vector<EnumValue const*>	getEnumValues(int64 value)									const	noexcept;
 
+			/**
+			*	@brief	Write all enum values in this enum holding the provided value in a caller provided buffer.
+			*			No result collection is allocated.
+			*
+			*	@param value			Numerical value of the EnumValues to look for.
+			*	@param outEnumValues	Buffer receiving the found enum values. Can be nullptr if capacity is 0.
+			*	@param capacity			Number of enum values outEnumValues can hold.
+			*
+			*	@return	The total number of EnumValues equal to the provided value.
+			*			Only the first capacity enum values are written, so a result greater than capacity means the buffer was too small.
+			*/
+			REFUREKU_API std::size_t		getEnumValues(int64				value,
+														  EnumValue const**	outEnumValues,
+														  std::size_t		capacity)						const	noexcept;
+
+			/**
+			*	@brief	Search all enum values in this enum holding the provided value and store them in a SmallVector.
+			*			Nothing is allocated as long as the result fits in the inline capacity.
+			*
+			*	@tparam N				Inline capacity of the result.
+			*	@tparam AllocatorType	Allocator used by the result if it doesn't fit inline.
+			*
+			*	@param value		Numerical value of the EnumValues to look for.
+			*	@param allocator	Allocator used by the result.
+			*
+			*	@return All the EnumValues equal to the provided value.
+			*/
+			template <std::size_t N, typename AllocatorType = Allocator<EnumValue const*>>
+			RFK_NODISCARD SmallVector<EnumValue const*, N, AllocatorType>	getEnumValues(int64					value,
+																							  AllocatorType const&	allocator = AllocatorType())	const;
+
 			/**
 			*	@brief Retrieve from this enum all enum values matching with a given predicate.
 			*
@@ -123,6 +160,66 @@ namespace rfk
 				bool						foreachEnumValue(Visitor<EnumValue>	visitor,
 															 void*				userData)				const;
 
+			/**
+			*	@brief	Get a span over the enum values of this enum, in declaration order.
+			*			The span is invalidated when an enum value is added to this enum.
+			* 
+			*	@return A span over the enum values of this enum.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<EnumValue const>		getEnumValuesSpan()											const	noexcept;
+
+			/**
+			*	@brief	Retrieve from this enum the first enum value matching with a given predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*
+			*	@param predicate Callable taking an EnumValue const& and returning true for any matching enum value.
+			*	
+			*	@return The first matching enum value if any is found, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, EnumValue>>
+			RFK_NODISCARD EnumValue const*			getEnumValueByPredicate(Predicate&& predicate)					const;
+
+			/**
+			*	@brief	Retrieve from this enum all enum values matching with a given predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*
+			*	@param predicate Callable taking an EnumValue const& and returning true for any matching enum value.
+			*	
+			*	@return All the enum values matching with the given predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, EnumValue>>
+			RFK_NODISCARD Vector<EnumValue const*>	getEnumValuesByPredicate(Predicate&& predicate)					const;
+
+			/**
+			*	@brief	Execute the given visitor on all enum values in this enum.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking an EnumValue const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, EnumValue>>
+			bool									foreachEnumValue(Visitor&& visitor)								const;
+
+			/**
+			*	@brief	Get a lazy view over the enum values satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when an enum value is added to this enum.
+			*
+			*	@param predicate Callable taking an EnumValue const& and returning true for a valid enum value.
+			*
+			*	@return A view over the enum values satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, EnumValue>>
+			RFK_NODISCARD auto						queryEnumValues(Predicate&& predicate)							const;
+
 			/**
 			*	@brief Add an enum value to this enum.
 			*	
@@ -153,14 +250,13 @@ namespace rfk
 			class EnumImpl;
 
 			RFK_GEN_GET_PIMPL(EnumImpl, Entity::getPimpl())
+
+		friend internal::MemoryFootprintCollector;
 	};
 
 	/** Base implementation of getEnum, specialized for each reflected enum. */
 	template <typename T>
 	Enum const* getEnum() noexcept;
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Enum const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Enum const*, rfk::Allocator<Enum const*>>);
-
 	#include "Refureku/TypeInfo/Archetypes/Enum.inl"
 }
\ No newline at end of file
@@ -9,4 +9,52 @@ template <typename T>
 rfk::Enum const* getEnum() noexcept
 {
 	return nullptr;
+}
+
+template <typename Predicate, typename>
+EnumValue const* Enum::getEnumValueByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<EnumValue>(getEnumValuesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<EnumValue const*> Enum::getEnumValuesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<EnumValue>(getEnumValuesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Enum::foreachEnumValue(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getEnumValuesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Enum::queryEnumValues(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<EnumValue, EnumValue const, PredicateType>(getEnumValuesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <std::size_t N, typename AllocatorType>
+SmallVector<EnumValue const*, N, AllocatorType> Enum::getEnumValues(int64 value, AllocatorType const& allocator) const
+{
+	SmallVector<EnumValue const*, N, AllocatorType> result(allocator);
+
+	//Query in the inline storage first (2 allocated slots without inline storage, most queries return few results),
+	//and query again only if it was too small
+	result.resize((N > 0u) ? N : 2u);
+
+	std::size_t found = getEnumValues(value, result.data(), result.size());
+
+	if (found > result.size())
+	{
+		result.resize(found);
+		getEnumValues(value, result.data(), found);
+	}
+
+	result.resize(found);
+
+	return result;
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <string_view>
+#include <type_traits>
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	/** Name / value pair of a single enum value known at compile time. */
+	template <typename EnumType>
+	struct EnumStringEntry
+	{
+		/** Name of the enum value. */
+		char const*	name;
+
+		/** Value of the enum value. */
+		EnumType	value;
+	};
+
+	/**
+	*	Compile-time table of all the values of a reflected enum.
+	*	The generator specializes this struct for each reflected enum declared at file or namespace level
+	*	with a static constexpr EnumStringEntry<EnumType> entries[] array, in declaration order.
+	*/
+	template <typename EnumType>
+	struct EnumStringTable;
+
+	/** Check whether a compile-time EnumStringTable is available for the provided enum type. */
+	template <typename EnumType, typename = void>
+	struct HasEnumStringTable : std::false_type {};
+
+	template <typename EnumType>
+	struct HasEnumStringTable<EnumType, std::void_t<decltype(EnumStringTable<EnumType>::entries)>> : std::true_type {};
+
+	template <typename EnumType>
+	inline constexpr bool hasEnumStringTable = HasEnumStringTable<EnumType>::value;
+
+	/**
+	*	@brief Get the name of the first declared enum value holding the provided value.
+	* 
+	*	@tparam EnumType Reflected enum type. It must have a generated EnumStringTable.
+	* 
+	*	@param value The value to convert.
+	* 
+	*	@return The name of the first declared enum value holding value if any, else nullptr.
+	*/
+	template <typename EnumType>
+	RFK_NODISCARD constexpr char const*	enumToString(EnumType value)			noexcept;
+
+	/**
+	*	@brief Get the value of the enum value named with the provided name.
+	* 
+	*	@tparam EnumType Reflected enum type. It must have a generated EnumStringTable.
+	* 
+	*	@param name				Name of the enum value to look for.
+	*	@param out_value		Receives the found value. It is left untouched if no enum value is named name.
+	* 
+	*	@return true if an enum value named name was found, else false.
+	*/
+	template <typename EnumType>
+	RFK_NODISCARD constexpr bool		enumFromString(std::string_view	name,
+													   EnumType&		out_value)	noexcept;
+
+	#include "Refureku/TypeInfo/Archetypes/EnumStringTable.inl"
+}
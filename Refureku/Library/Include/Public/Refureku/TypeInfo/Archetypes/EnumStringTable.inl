@@ -0,0 +1,40 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename EnumType>
+constexpr char const* enumToString(EnumType value) noexcept
+{
+	static_assert(hasEnumStringTable<EnumType>, "No EnumStringTable was generated for this enum type.");
+
+	for (EnumStringEntry<EnumType> const& entry : EnumStringTable<EnumType>::entries)
+	{
+		if (entry.value == value)
+		{
+			return entry.name;
+		}
+	}
+
+	return nullptr;
+}
+
+template <typename EnumType>
+constexpr bool enumFromString(std::string_view name, EnumType& out_value) noexcept
+{
+	static_assert(hasEnumStringTable<EnumType>, "No EnumStringTable was generated for this enum type.");
+
+	for (EnumStringEntry<EnumType> const& entry : EnumStringTable<EnumType>::entries)
+	{
+		if (name == entry.name)
+		{
+			out_value = entry.value;
+
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -9,6 +9,7 @@
 
 #include <type_traits>
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/Misc/FundamentalTypes.h"
 #include "Refureku/Containers/Vector.h"
@@ -47,10 +48,9 @@ namespace rfk
 			class EnumValueImpl;
 
 			RFK_GEN_GET_PIMPL(EnumValueImpl, Entity::getPimpl())
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<EnumValue const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<EnumValue const*, rfk::Allocator<EnumValue const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Archetypes/EnumValue.inl"
 }
\ No newline at end of file
@@ -22,5 +22,7 @@ namespace rfk
 		private:
 			//Forward declaration
 			class FundamentalArchetypeImpl;
+
+		friend internal::MemoryFootprintCollector;
 	};
 }
\ No newline at end of file
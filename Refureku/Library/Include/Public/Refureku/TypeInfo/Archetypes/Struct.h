@@ -8,16 +8,23 @@
 #pragma once
 
 #include <cstddef> //std::ptrdiff_t
+#include <algorithm> //std::sort
 #include <type_traits> //std::is_default_constructible_v, std::is_pointer_v, std::is_reference_v
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"	//make[Unique/Shared]Instance<> uses StaticMethod wrapper so must include
 #include "Refureku/TypeInfo/Archetypes/EClassKind.h"
+#include "Refureku/TypeInfo/Archetypes/EStructTraits.h"
 #include "Refureku/TypeInfo/Variables/EFieldFlags.h"
 #include "Refureku/TypeInfo/Functions/EMethodFlags.h"
 #include "Refureku/TypeInfo/Functions/MethodHelper.h"
 #include "Refureku/Containers/Vector.h"
+#include "Refureku/Containers/SmallVector.h"
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Containers/FilteredView.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
 #include "Refureku/Misc/SharedPtr.h"
 #include "Refureku/Misc/UniquePtr.h"
 
@@ -39,6 +46,21 @@ namespace rfk
 	class Struct : public Archetype
 	{
 		public:
+			/** Function destroying an instance of a struct without releasing its memory. */
+			using Destructor = void (*)(void* instance) noexcept;
+
+			/** Function copy constructing count contiguous instances of a struct in uninitialized memory. */
+			using CopyConstructor = void (*)(void* destination, void const* source, std::size_t count);
+
+			/** Function move constructing count contiguous instances of a struct in uninitialized memory. */
+			using MoveConstructor = void (*)(void* destination, void* source, std::size_t count);
+
+			/** Function copy assigning count contiguous instances of a struct to already constructed instances. */
+			using CopyAssignment = void (*)(void* destination, void const* source, std::size_t count);
+
+			/** Function move assigning count contiguous instances of a struct to already constructed instances. */
+			using MoveAssignment = void (*)(void* destination, void* source, std::size_t count);
+
 			REFUREKU_API Struct(char const*	name,
 								std::size_t	id,
 								std::size_t	memorySize,
@@ -73,6 +95,131 @@ namespace rfk
 			RFK_NODISCARD 
 				rfk::UniquePtr<ReturnType>			makeUniqueInstance(ArgTypes&&... args)												const;
 
+			/**
+			*	@brief	Construct an instance of the class represented by this archetype in the provided memory with the matching placement instantiator.
+			*			The memory must be at least getMemorySize() bytes large and aligned on getMemoryAlignment().
+			*			The constructed instance must be destroyed with destroyInstanceAt before the memory is reused or released.
+			*
+			*	@param memory Memory receiving the instance.
+			*
+			*	@return A pointer to the constructed instance if a suitable placement instantiator was found, else nullptr.
+			*			The pointer is adjusted to ReturnType, so it might be different from memory.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD 
+				ReturnType*							makeInstanceAt(void*		memory,
+															   ArgTypes&&...	args)											const;
+
+			/**
+			*	@brief	Construct an instance of the class represented by this archetype in the provided memory with the matching placement instantiator.
+			*			Unlike makeInstanceAt, the returned pointer is not adjusted, so this method can be used when the instance C++ type is unknown.
+			*
+			*	@param memory Memory receiving the instance. Same requirements as makeInstanceAt.
+			*
+			*	@return A pointer to the constructed instance of this struct if a suitable placement instantiator was found, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename... ArgTypes>
+			RFK_NODISCARD 
+				void*								makeRawInstanceAt(void*			memory,
+																  ArgTypes&&...	args)										const;
+
+			/**
+			*	@brief	Destroy an instance constructed by makeInstanceAt without releasing its memory.
+			*			Does nothing if this struct has no destructor.
+			*
+			*	@param instance Memory the instance was constructed in.
+			*/
+			REFUREKU_API void						destroyInstanceAt(void* instance)													const	noexcept;
+
+			/**
+			*	@brief	Copy construct count contiguous instances of this struct in uninitialized memory.
+			*			A single memcpy is used if the copy constructor of this struct is trivial, the registered copy constructor otherwise.
+			*			Both pointers must point to the memory of instances of this exact struct, not adjusted to a parent class.
+			*
+			*	@param destination	Uninitialized memory receiving the copies, large enough for count instances.
+			*	@param source		Instances to copy. Must not overlap destination.
+			*	@param count		Number of instances to copy.
+			*
+			*	@return true if the instances were copied, false if this struct has no registered copy constructor and its copy constructor is not trivial.
+			* 
+			*	@exception Any exception thrown by the copy constructor. The instances copied so far are destroyed in that case.
+			*/
+			REFUREKU_API bool						copyConstructAt(void*			destination,
+																	void const*		source,
+																	std::size_t		count = 1u)												const;
+
+			/**
+			*	@brief	Move construct count contiguous instances of this struct in uninitialized memory.
+			*			A single memcpy is used if the move constructor of this struct is trivial, the registered move constructor otherwise.
+			*			Both pointers must point to the memory of instances of this exact struct, not adjusted to a parent class.
+			*
+			*	@param destination	Uninitialized memory receiving the instances, large enough for count instances.
+			*	@param source		Instances to move from. They must still be destroyed. Must not overlap destination.
+			*	@param count		Number of instances to move.
+			*
+			*	@return true if the instances were moved, false if this struct has no registered move constructor and its move constructor is not trivial.
+			* 
+			*	@exception Any exception thrown by the move constructor. The instances moved so far are destroyed in that case.
+			*/
+			REFUREKU_API bool						moveConstructAt(void*			destination,
+																	void*			source,
+																	std::size_t		count = 1u)												const;
+
+			/**
+			*	@brief	Move count contiguous instances of this struct to uninitialized memory and destroy the source instances.
+			*			A single memcpy is used if this struct is trivially relocatable, the move constructor and the destructor otherwise.
+			*			Both pointers must point to the memory of instances of this exact struct, not adjusted to a parent class.
+			*
+			*	@param destination	Uninitialized memory receiving the instances, large enough for count instances.
+			*	@param source		Instances to relocate. The memory is left uninitialized. Must not overlap destination.
+			*	@param count		Number of instances to relocate.
+			*
+			*	@return true if the instances were relocated, false if this struct has no move constructor and is not trivially relocatable.
+			* 
+			*	@exception Any exception thrown by the move constructor. The source instances are not destroyed in that case.
+			*/
+			REFUREKU_API bool						relocateAt(void*				destination,
+															   void*				source,
+															   std::size_t			count = 1u)												const;
+
+			/**
+			*	@brief	Copy assign count contiguous instances of this struct to already constructed instances.
+			*			A single memcpy is used if the copy assignment operator of this struct is trivial, the registered copy assignment operator otherwise.
+			*			Both pointers must point to the memory of instances of this exact struct, not adjusted to a parent class.
+			*
+			*	@param destination	Instances receiving the copies.
+			*	@param source		Instances to copy. Must not overlap destination.
+			*	@param count		Number of instances to copy.
+			*
+			*	@return true if the instances were copied, false if this struct has no registered copy assignment operator and its copy assignment operator is not trivial.
+			* 
+			*	@exception Any exception thrown by the copy assignment operator.
+			*/
+			REFUREKU_API bool						copyAssign(void*				destination,
+															   void const*			source,
+															   std::size_t			count = 1u)												const;
+
+			/**
+			*	@brief	Move assign count contiguous instances of this struct to already constructed instances.
+			*			A single memcpy is used if the move assignment operator of this struct is trivial, the registered move assignment operator otherwise.
+			*			Both pointers must point to the memory of instances of this exact struct, not adjusted to a parent class.
+			*
+			*	@param destination	Instances receiving the moved instances.
+			*	@param source		Instances to move from. Must not overlap destination.
+			*	@param count		Number of instances to move.
+			*
+			*	@return true if the instances were moved, false if this struct has no registered move assignment operator and its move assignment operator is not trivial.
+			* 
+			*	@exception Any exception thrown by the move assignment operator.
+			*/
+			REFUREKU_API bool						moveAssign(void*				destination,
+															   void*				source,
+															   std::size_t			count = 1u)												const;
+
 			/**
 			*	@brief	Compute the list of all direct reflected subclasses of this struct.
 			*			Direct subclasses are computed by iterating over all subclasses (direct or not), so this method
@@ -83,6 +230,40 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API
 				Vector<Struct const*>				getDirectSubclasses()																const	noexcept;
 
+			/**
+			*	@brief Get the number of reflected subclasses of this struct, regardless of their inheritance depth.
+			* 
+			*	@return The number of reflected subclasses of this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t	getSubclassesCount()																const	noexcept;
+
+			/**
+			*	@brief	Execute the given visitor on all reflected subclasses of this struct, regardless of their inheritance depth.
+			*			Subclasses are visited in no particular order.
+			* 
+			*	@param visitor	Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData	Optional user data forwarded to the visitor.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API bool						foreachSubclass(Visitor<Struct>	visitor,
+																	void*			userData)											const;
+
+			/**
+			*	@brief Execute the given visitor on all reflected subclasses of this struct, regardless of their inheritance depth.
+			* 
+			*	@param visitor Callable taking a Struct const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Struct>>
+			bool									foreachSubclass(Visitor&& visitor)													const;
+
 			/**
 			*	@brief Check if this struct is a subclass of another struct/class.
 			* 
@@ -91,7 +272,7 @@ namespace rfk
 			*	@return true if this struct is a subclass of the provided archetype, else false.
 			*			Note that if the provided archetype is the same as this struct, false is returned.
 			*/
-			RFK_NODISCARD REFUREKU_API bool			isSubclassOf(Struct const& archetype)												const	noexcept;
+			RFK_NODISCARD REFUREKU_HOT_GETTER bool			isSubclassOf(Struct const& archetype)												const	noexcept;
 
 			/**
 			*	@brief Check if this struct is a base class of another struct/class.
@@ -101,7 +282,7 @@ namespace rfk
 			*	@return true if this struct is a base class of the provided archetype, else false.
 			*			Note that if the provided archetype is the same as this struct, true is returned.
 			*/
-			RFK_NODISCARD REFUREKU_API bool			isBaseOf(Struct const& archetype)													const	noexcept;
+			RFK_NODISCARD REFUREKU_HOT_GETTER bool			isBaseOf(Struct const& archetype)													const	noexcept;
 
 			/**
 			*	@brief	Get the index'th direct parent of this struct.
@@ -119,6 +300,14 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API std::size_t	getDirectParentsCount()																const	noexcept;
 
+			/**
+			*	@brief Get a span over the direct parents of this struct.
+			* 
+			*	@return A span over the direct parents of this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<ParentStruct const>			getDirectParentsSpan()																const	noexcept;
+
 			/**
 			*	@brief Execute the given visitor on all direct parents of this struct.
 			* 
@@ -345,6 +534,80 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t				getFieldsCount()																	const	noexcept;
 
+			/**
+			*	@brief	Get a span over the fields stored in this struct, including the inherited ones.
+			*			The span is invalidated when a field is added to this struct.
+			* 
+			*	@return A span over the fields stored in this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<Field const* const>			getFieldsSpan()																		const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first field satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a Field const& and returning true for a valid field.
+			*	@param shouldInspectInherited	Should inherited fields be considered as well in the search process?
+			*										If false, only fields introduced by this struct will be considered.
+			* 
+			*	@return The first found field satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Field>>
+			RFK_NODISCARD Field const*				getFieldByPredicate(Predicate&&	predicate,
+																		bool		shouldInspectInherited = false)						const;
+
+			/**
+			*	@brief	Retrieve all fields satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a Field const& and returning true for a valid field.
+			*	@param shouldInspectInherited	Should inherited fields be considered as well in the search process?
+			*										If false, only fields introduced by this struct will be considered.
+			*	@param orderedByDeclaration		Should fields be ordered by declaration order in the result collection?
+			* 
+			*	@return All fields satisfying the predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Field>>
+			RFK_NODISCARD Vector<Field const*>		getFieldsByPredicate(Predicate&&	predicate,
+																		 bool			shouldInspectInherited = false,
+																		 bool			orderedByDeclaration = false)					const;
+
+			/**
+			*	@brief	Execute the given visitor on all fields in this struct.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor					Callable taking a Field const&. Return false to abort the foreach loop.
+			*	@param shouldInspectInherited	Should inherited fields be considered as well in the search process?
+			*										If false, only fields introduced by this struct will be considered.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Field>>
+			bool									foreachField(Visitor&&	visitor,
+																 bool		shouldInspectInherited = false)								const;
+
+			/**
+			*	@brief	Get a lazy view over the fields satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a field is added to this struct.
+			*	
+			*	@param predicate				Callable taking a Field const& and returning true for a valid field.
+			*	@param shouldInspectInherited	Should inherited fields be considered as well in the search process?
+			*										If false, only fields introduced by this struct will be considered.
+			* 
+			*	@return A view over the fields satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Field>>
+			RFK_NODISCARD auto						queryFields(Predicate&&	predicate,
+																 bool		shouldInspectInherited = false)								const;
+
 			/**
 			*	@param name						Name of the static field to retrieve.
 			*	@param minFlags					Requirements the queried static field should fulfill.
@@ -421,6 +684,78 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t				getStaticFieldsCount()																const	noexcept;
 
+			/**
+			*	@brief	Get a span over the static fields stored in this struct, including the inherited ones.
+			*			The span is invalidated when a static field is added to this struct.
+			* 
+			*	@return A span over the static fields stored in this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<StaticField const* const>	getStaticFieldsSpan()																const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first static field satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a StaticField const& and returning true for a valid static field.
+			*	@param shouldInspectInherited	Should inherited static fields be considered as well in the search process?
+			*										If false, only static fields introduced by this struct will be considered.
+			* 
+			*	@return The first found static field satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticField>>
+			RFK_NODISCARD StaticField const*		getStaticFieldByPredicate(Predicate&&	predicate,
+																		bool		shouldInspectInherited = false)						const;
+
+			/**
+			*	@brief	Retrieve all static fields satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a StaticField const& and returning true for a valid static field.
+			*	@param shouldInspectInherited	Should inherited static fields be considered as well in the search process?
+			*										If false, only static fields introduced by this struct will be considered.
+			* 
+			*	@return All static fields satisfying the predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticField>>
+			RFK_NODISCARD Vector<StaticField const*>	getStaticFieldsByPredicate(Predicate&&	predicate,
+																		 bool			shouldInspectInherited = false)					const;
+
+			/**
+			*	@brief	Execute the given visitor on all static fields in this struct.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor					Callable taking a StaticField const&. Return false to abort the foreach loop.
+			*	@param shouldInspectInherited	Should inherited static fields be considered as well in the search process?
+			*										If false, only static fields introduced by this struct will be considered.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, StaticField>>
+			bool							foreachStaticField(Visitor&&	visitor,
+																 bool		shouldInspectInherited = false)								const;
+
+			/**
+			*	@brief	Get a lazy view over the static fields satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a static field is added to this struct.
+			*	
+			*	@param predicate				Callable taking a StaticField const& and returning true for a valid static field.
+			*	@param shouldInspectInherited	Should inherited static fields be considered as well in the search process?
+			*										If false, only static fields introduced by this struct will be considered.
+			* 
+			*	@return A view over the static fields satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticField>>
+			RFK_NODISCARD auto						queryStaticFields(Predicate&&	predicate,
+																 bool		shouldInspectInherited = false)								const;
+
 			/**
 			*	@brief	Get a method by name and signature. This template overload using signature comes handy when wanting to disambiguate
 			*			2 method overloads with and without const qualifier for example.
@@ -472,6 +807,49 @@ namespace rfk
 																	 EMethodFlags minFlags = EMethodFlags::Default,
 																	 bool		  shouldInspectInherited = false)						const	noexcept;
 
+			/**
+			*	@brief	Write the methods named name fulfilling all requirements in a caller provided buffer.
+			*			No result collection is allocated.
+			* 
+			*	@param name						Name of the methods to retrieve.
+			*	@param outMethods				Buffer receiving the found methods. Can be nullptr if capacity is 0.
+			*	@param capacity					Number of methods outMethods can hold.
+			*	@param minFlags					Requirements the queried methods should fulfill.
+			*										EMethodFlags::Default means no requirement.
+			*	@param shouldInspectInherited	Should inherited methods be considered as well in the search process?
+			*										If false, only methods introduced by this struct will be considered.
+			*
+			*	@return	The total number of methods named name fulfilling all requirements.
+			*			Only the first capacity methods are written, so a result greater than capacity means the buffer was too small.
+			*/
+			REFUREKU_API std::size_t				getMethodsByName(char const*		name,
+																	 Method const**	outMethods,
+																	 std::size_t		capacity,
+																	 EMethodFlags		minFlags = EMethodFlags::Default,
+																	 bool				shouldInspectInherited = false)		const	noexcept;
+
+			/**
+			*	@brief	Retrieve all methods named name fulfilling all requirements in a SmallVector.
+			*			Nothing is allocated as long as the result fits in the inline capacity.
+			* 
+			*	@tparam N				Inline capacity of the result.
+			*	@tparam AllocatorType	Allocator used by the result if it doesn't fit inline (ArenaAllocator for frame-scoped queries for example).
+			* 
+			*	@param name						Name of the methods to retrieve.
+			*	@param minFlags					Requirements the queried methods should fulfill.
+			*										EMethodFlags::Default means no requirement.
+			*	@param shouldInspectInherited	Should inherited methods be considered as well in the search process?
+			*										If false, only methods introduced by this struct will be considered.
+			*	@param allocator				Allocator used by the result.
+			*
+			*	@return All methods named name fulfilling all requirements.
+			*/
+			template <std::size_t N, typename AllocatorType = Allocator<Method const*>>
+			RFK_NODISCARD SmallVector<Method const*, N, AllocatorType>	getMethodsByName(char const*			name,
+																						 EMethodFlags			minFlags = EMethodFlags::Default,
+																						 bool					shouldInspectInherited = false,
+																						 AllocatorType const&	allocator = AllocatorType())	const;
+
 			/**
 			*	@brief Retrieve the first method satisfying the provided predicate.
 			*	
@@ -529,6 +907,76 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t				getMethodsCount()																	const	noexcept;
 
+			/**
+			*	@brief	Get a span over the methods stored in this struct (inherited methods are not included).
+			*			The span is invalidated when a method is added to this struct.
+			* 
+			*	@return A span over the methods stored in this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<Method const* const>	getMethodsSpan()																const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first method satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a Method const& and returning true for a valid method.
+			*	@param shouldInspectInherited	Should inherited methods be considered as well in the search process?
+			*										If false, only methods introduced by this struct will be considered.
+			* 
+			*	@return The first found method satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Method>>
+			RFK_NODISCARD Method const*		getMethodByPredicate(Predicate&&	predicate,
+																		bool		shouldInspectInherited = false)						const;
+
+			/**
+			*	@brief	Retrieve all methods satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a Method const& and returning true for a valid method.
+			*	@param shouldInspectInherited	Should inherited methods be considered as well in the search process?
+			*										If false, only methods introduced by this struct will be considered.
+			* 
+			*	@return All methods satisfying the predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Method>>
+			RFK_NODISCARD Vector<Method const*>	getMethodsByPredicate(Predicate&&	predicate,
+																		 bool			shouldInspectInherited = false)					const;
+
+			/**
+			*	@brief	Execute the given visitor on all methods in this struct.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor					Callable taking a Method const&. Return false to abort the foreach loop.
+			*	@param shouldInspectInherited	Should inherited methods be considered as well in the search process?
+			*										If false, only methods introduced by this struct will be considered.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Method>>
+			bool							foreachMethod(Visitor&&	visitor,
+																 bool		shouldInspectInherited = false)								const;
+
+			/**
+			*	@brief	Get a lazy view over the methods satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			Only the methods introduced by this struct are considered, use foreachMethod to inspect inherited ones.
+			*			The view is invalidated when a method is added to this struct.
+			*	
+			*	@param predicate				Callable taking a Method const& and returning true for a valid method.
+			* 
+			*	@return A view over the methods satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Method>>
+			RFK_NODISCARD auto						queryMethods(Predicate&&	predicate)								const;
+
 			/**
 			*	@param name						Name of the static method to retrieve.
 			*	@param minFlags					Requirements the queried static method should fulfill.
@@ -580,6 +1028,51 @@ namespace rfk
 																		   EMethodFlags minFlags = EMethodFlags::Default,
 																		   bool			shouldInspectInherited = false)					const	noexcept;
 
+			/**
+			*	@brief	Write the static methods named name fulfilling all requirements in a caller provided buffer.
+			*			No result collection is allocated.
+			* 
+			*	@param name						Name of the static methods to retrieve.
+			*	@param outStaticMethods				Buffer receiving the found static methods. Can be nullptr if capacity is 0.
+			*	@param capacity					Number of static methods outStaticMethods can hold.
+			*	@param minFlags					Requirements the queried static methods should fulfill.
+			*										EMethodFlags::Default means no requirement.
+			*										Note: It doesn't matter whether you set the Static flag or not.
+			*	@param shouldInspectInherited	Should inherited static methods be considered as well in the search process?
+			*										If false, only static methods introduced by this struct will be considered.
+			*
+			*	@return	The total number of static methods named name fulfilling all requirements.
+			*			Only the first capacity static methods are written, so a result greater than capacity means the buffer was too small.
+			*/
+			REFUREKU_API std::size_t				getStaticMethodsByName(char const*		name,
+																	 StaticMethod const**	outStaticMethods,
+																	 std::size_t		capacity,
+																	 EMethodFlags		minFlags = EMethodFlags::Default,
+																	 bool				shouldInspectInherited = false)		const	noexcept;
+
+			/**
+			*	@brief	Retrieve all static methods named name fulfilling all requirements in a SmallVector.
+			*			Nothing is allocated as long as the result fits in the inline capacity.
+			* 
+			*	@tparam N				Inline capacity of the result.
+			*	@tparam AllocatorType	Allocator used by the result if it doesn't fit inline (ArenaAllocator for frame-scoped queries for example).
+			* 
+			*	@param name						Name of the static methods to retrieve.
+			*	@param minFlags					Requirements the queried static methods should fulfill.
+			*										EMethodFlags::Default means no requirement.
+			*										Note: It doesn't matter whether you set the Static flag or not.
+			*	@param shouldInspectInherited	Should inherited static methods be considered as well in the search process?
+			*										If false, only static methods introduced by this struct will be considered.
+			*	@param allocator				Allocator used by the result.
+			*
+			*	@return All static methods named name fulfilling all requirements.
+			*/
+			template <std::size_t N, typename AllocatorType = Allocator<StaticMethod const*>>
+			RFK_NODISCARD SmallVector<StaticMethod const*, N, AllocatorType>	getStaticMethodsByName(char const*			name,
+																						 EMethodFlags			minFlags = EMethodFlags::Default,
+																						 bool					shouldInspectInherited = false,
+																						 AllocatorType const&	allocator = AllocatorType())	const;
+
 			/**
 			*	@brief Retrieve the first static method satisfying the provided predicate.
 			*	
@@ -637,6 +1130,76 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t				getStaticMethodsCount()																const	noexcept;
 
+			/**
+			*	@brief	Get a span over the static methods stored in this struct (inherited static methods are not included).
+			*			The span is invalidated when a static method is added to this struct.
+			* 
+			*	@return A span over the static methods stored in this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Span<StaticMethod const* const>	getStaticMethodsSpan()																const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first static method satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a StaticMethod const& and returning true for a valid static method.
+			*	@param shouldInspectInherited	Should inherited static methods be considered as well in the search process?
+			*										If false, only static methods introduced by this struct will be considered.
+			* 
+			*	@return The first found static method satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticMethod>>
+			RFK_NODISCARD StaticMethod const*		getStaticMethodByPredicate(Predicate&&	predicate,
+																		bool		shouldInspectInherited = false)						const;
+
+			/**
+			*	@brief	Retrieve all static methods satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate				Callable taking a StaticMethod const& and returning true for a valid static method.
+			*	@param shouldInspectInherited	Should inherited static methods be considered as well in the search process?
+			*										If false, only static methods introduced by this struct will be considered.
+			* 
+			*	@return All static methods satisfying the predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticMethod>>
+			RFK_NODISCARD Vector<StaticMethod const*>	getStaticMethodsByPredicate(Predicate&&	predicate,
+																		 bool			shouldInspectInherited = false)					const;
+
+			/**
+			*	@brief	Execute the given visitor on all static methods in this struct.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor					Callable taking a StaticMethod const&. Return false to abort the foreach loop.
+			*	@param shouldInspectInherited	Should inherited static methods be considered as well in the search process?
+			*										If false, only static methods introduced by this struct will be considered.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, StaticMethod>>
+			bool							foreachStaticMethod(Visitor&&	visitor,
+																 bool		shouldInspectInherited = false)								const;
+
+			/**
+			*	@brief	Get a lazy view over the static methods satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			Only the static methods introduced by this struct are considered, use foreachStaticMethod to inspect inherited ones.
+			*			The view is invalidated when a static method is added to this struct.
+			*	
+			*	@param predicate				Callable taking a StaticMethod const& and returning true for a valid static method.
+			* 
+			*	@return A view over the static methods satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, StaticMethod>>
+			RFK_NODISCARD auto						queryStaticMethods(Predicate&&	predicate)								const;
+
 			/**
 			*	@brief Get the class kind of this instance.
 			* 
@@ -644,6 +1207,55 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API EClassKind	getClassKind()																		const	noexcept;
 
+			/**
+			*	@brief Get the function destroying instances of this struct.
+			* 
+			*	@return The destructor of this struct, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API Destructor	getDestructor()																		const	noexcept;
+
+			/**
+			*	@brief Get the alignment requirement of this struct instances.
+			* 
+			*	@return The alignment of this struct in bytes. Defaults to alignof(std::max_align_t) if it was not provided.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t	getMemoryAlignment()																const	noexcept;
+
+			/**
+			*	@brief Get the function copy constructing instances of this struct.
+			* 
+			*	@return The copy constructor of this struct, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API CopyConstructor	getCopyConstructor()															const	noexcept;
+
+			/**
+			*	@brief Get the function move constructing instances of this struct.
+			* 
+			*	@return The move constructor of this struct, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API MoveConstructor	getMoveConstructor()															const	noexcept;
+
+			/**
+			*	@brief Get the function copy assigning instances of this struct.
+			* 
+			*	@return The copy assignment operator of this struct, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API CopyAssignment	getCopyAssignment()															const	noexcept;
+
+			/**
+			*	@brief Get the function move assigning instances of this struct.
+			* 
+			*	@return The move assignment operator of this struct, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API MoveAssignment	getMoveAssignment()															const	noexcept;
+
+			/**
+			*	@brief Get the traits of this struct.
+			* 
+			*	@return The traits of this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API EStructTraits	getTraits()																	const	noexcept;
+
 			/**
 			*	@brief	Get the pointer offset to transform an instance of this Struct pointer to a pointer of the provided Struct.
 			*			Search in both directions (whether to is a parent class or a child class).
@@ -844,6 +1456,66 @@ namespace rfk
 			*/
 			REFUREKU_API void						addUniqueInstantiator(StaticMethod const& instantiator)										noexcept;
 
+			/**
+			*	@brief	Add a new way to instantiate this struct through the makeInstanceAt method.
+			*			The passed static method MUST take the memory to construct the instance in (void*) as first parameter,
+			*			and return a void* to the constructed instance (or nullptr if it could not be constructed).
+			*			Otherwise, the behaviour is undefined when calling Struct::makeInstanceAt.
+			*	
+			*	@param instantiator Pointer to the static method.
+			*/
+			REFUREKU_API void						addPlacementInstantiator(StaticMethod const& instantiator)									noexcept;
+
+			/**
+			*	@brief Set the function destroying instances of this struct, used by destroyInstanceAt.
+			*	
+			*	@param destructor The destructor.
+			*/
+			REFUREKU_API void						setDestructor(Destructor destructor)														noexcept;
+
+			/**
+			*	@brief Set the alignment requirement of this struct instances.
+			*	
+			*	@param alignment Alignment in bytes. Must be a power of 2.
+			*/
+			REFUREKU_API void						setMemoryAlignment(std::size_t alignment)													noexcept;
+
+			/**
+			*	@brief Set the function copy constructing instances of this struct, used by copyConstructAt.
+			*	
+			*	@param copyConstructor The copy constructor.
+			*/
+			REFUREKU_API void						setCopyConstructor(CopyConstructor copyConstructor)											noexcept;
+
+			/**
+			*	@brief Set the function move constructing instances of this struct, used by moveConstructAt and relocateAt.
+			*	
+			*	@param moveConstructor The move constructor.
+			*/
+			REFUREKU_API void						setMoveConstructor(MoveConstructor moveConstructor)											noexcept;
+
+			/**
+			*	@brief Set the function copy assigning instances of this struct, used by copyAssign.
+			*	
+			*	@param copyAssignment The copy assignment operator.
+			*/
+			REFUREKU_API void						setCopyAssignment(CopyAssignment copyAssignment)											noexcept;
+
+			/**
+			*	@brief Set the function move assigning instances of this struct, used by moveAssign.
+			*	
+			*	@param moveAssignment The move assignment operator.
+			*/
+			REFUREKU_API void						setMoveAssignment(MoveAssignment moveAssignment)											noexcept;
+
+			/**
+			*	@brief	Set the traits of this struct.
+			*			TriviallyRelocatable can be set manually for structs that can be moved with a memcpy without being trivially copyable.
+			*	
+			*	@param traits The traits of this struct.
+			*/
+			REFUREKU_API void						setTraits(EStructTraits traits)																noexcept;
+
 		protected:
 			//Forward declaration
 			class StructImpl;
@@ -858,6 +1530,15 @@ namespace rfk
 			RFK_GEN_GET_PIMPL(StructImpl, Entity::getPimpl())
 
 		private:
+			/**
+			*	@brief Check whether the provided struct is a reflected subclass of this struct.
+			* 
+			*	@param archetype The struct to look for in this struct subclasses.
+			* 
+			*	@return true if archetype is a reflected subclass of this struct, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool	hasSubclass(Struct const& archetype)	const	noexcept;
+
 			/**
 			*	@brief Execute the given visitor on all shared instantiators taking a given number of parameters in this struct.
 			* 
@@ -889,10 +1570,30 @@ namespace rfk
 			REFUREKU_API bool	foreachUniqueInstantiator(std::size_t			argCount,
 														  Visitor<StaticMethod>	visitor,
 														  void*					userData)	const;
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Struct const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Struct const*, rfk::Allocator<Struct const*>>);
+			/**
+			*	@brief Execute the given visitor on all placement instantiators taking a given number of parameters in this struct.
+			* 
+			*	@param argCount	Number of arguments the instantiator takes, not counting the memory parameter.
+			*	@param visitor	Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData	Optional user data forwarded to the visitor.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API bool	foreachPlacementInstantiator(std::size_t			argCount,
+															 Visitor<StaticMethod>	visitor,
+															 void*					userData)	const;
+
+		friend internal::MemoryFootprintCollector;
+		friend internal::ModulePatcher;
+	};
 
 	#include "Refureku/TypeInfo/Archetypes/Struct.inl"
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Archetypes/StructHotGetters.inl"
+#endif
\ No newline at end of file
@@ -103,6 +103,53 @@ rfk::UniquePtr<ReturnType> Struct::makeUniqueInstance(ArgTypes&&... args) const
 	}
 }
 
+template <typename ReturnType, typename... ArgTypes>
+ReturnType* Struct::makeInstanceAt(void* memory, ArgTypes&&... args) const
+{
+	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeInstanceAt should not be a pointer or a reference.");
+
+	void* instance = makeRawInstanceAt<ArgTypes...>(memory, std::forward<ArgTypes>(args)...);
+
+	if (instance == nullptr)
+	{
+		return nullptr;
+	}
+
+	Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
+
+	//Adjust the pointer from this struct to ReturnType
+	return (returnTypeArchetype != nullptr) ? rfk::dynamicUpCast<ReturnType>(instance, *this, *returnTypeArchetype) :
+											  static_cast<ReturnType*>(instance);
+}
+
+template <typename... ArgTypes>
+void* Struct::makeRawInstanceAt(void* memory, ArgTypes&&... args) const
+{
+	StaticMethod const* instantiator;
+
+	if (!foreachPlacementInstantiator(sizeof...(args), [](StaticMethod const& instantiator, void* data)
+		{
+			//Find a placement instantiator with the same parameters after the memory parameter
+			if (instantiator.hasSameParameters<void*, ArgTypes...>())
+			{
+				*reinterpret_cast<StaticMethod const**>(data) = &instantiator;
+				return false;
+			}
+
+			return true;
+		}, &instantiator))
+	{
+		assert(instantiator != nullptr);
+
+		//Explicit argument types so that memory is not forwarded as an lvalue reference
+		return instantiator->invoke<void*, void*, ArgTypes...>(std::move(memory), std::forward<ArgTypes>(args)...);
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
 template <typename MethodSignature>
 Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
 {
@@ -141,4 +188,278 @@ StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags
 																methodBase.hasSameName(userData.name) &&
 																internal::MethodHelper<StaticMethodSignature>::hasSameSignature(methodBase);
 													}, &data, shouldInspectInherited) : nullptr;
+}
+
+template <std::size_t N, typename AllocatorType>
+SmallVector<Method const*, N, AllocatorType> Struct::getMethodsByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited, AllocatorType const& allocator) const
+{
+	SmallVector<Method const*, N, AllocatorType> result(allocator);
+
+	//Query in the inline storage first (2 allocated slots without inline storage, most queries return few results),
+	//and query again only if it was too small
+	result.resize((N > 0u) ? N : 2u);
+
+	std::size_t found = getMethodsByName(name, result.data(), result.size(), minFlags, shouldInspectInherited);
+
+	if (found > result.size())
+	{
+		result.resize(found);
+		getMethodsByName(name, result.data(), found, minFlags, shouldInspectInherited);
+	}
+
+	result.resize(found);
+
+	return result;
+}
+
+
+template <std::size_t N, typename AllocatorType>
+SmallVector<StaticMethod const*, N, AllocatorType> Struct::getStaticMethodsByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited, AllocatorType const& allocator) const
+{
+	SmallVector<StaticMethod const*, N, AllocatorType> result(allocator);
+
+	//Query in the inline storage first (2 allocated slots without inline storage, most queries return few results),
+	//and query again only if it was too small
+	result.resize((N > 0u) ? N : 2u);
+
+	std::size_t found = getStaticMethodsByName(name, result.data(), result.size(), minFlags, shouldInspectInherited);
+
+	if (found > result.size())
+	{
+		result.resize(found);
+		getStaticMethodsByName(name, result.data(), found, minFlags, shouldInspectInherited);
+	}
+
+	result.resize(found);
+
+	return result;
+}
+
+template <typename Predicate, typename>
+Field const* Struct::getFieldByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Field>(getFieldsSpan(),
+															  [this, &predicate, shouldInspectInherited](auto const& field)
+															  {
+																  return	field.getKind() == EEntityKind::Field &&
+																			(shouldInspectInherited || field.getOuterEntity() == this) &&
+																			predicate(field);
+															  });
+}
+
+template <typename Predicate, typename>
+Vector<Field const*> Struct::getFieldsByPredicate(Predicate&& predicate, bool shouldInspectInherited, bool orderedByDeclaration) const
+{
+	Vector<Field const*> result = internal::SpanAlgorithm::getItemsByPredicate<Field>(getFieldsSpan(),
+																					  [this, &predicate, shouldInspectInherited](auto const& field)
+																					  {
+																						  return	field.getKind() == EEntityKind::Field &&
+																									(shouldInspectInherited || field.getOuterEntity() == this) &&
+																									predicate(field);
+																					  });
+
+	if (orderedByDeclaration)
+	{
+		//Two fields contained in the same struct never have the same memory offset
+		std::sort(result.begin(), result.end(), [](auto const* a, auto const* b) { return a->getMemoryOffset() < b->getMemoryOffset(); });
+	}
+
+	return result;
+}
+
+template <typename Visitor, typename>
+bool Struct::foreachSubclass(Visitor&& visitor) const
+{
+	using VisitorType = std::remove_reference_t<Visitor>;
+
+	return foreachSubclass([](Struct const& subclass, void* userData)
+						   {
+							   return static_cast<bool>((*reinterpret_cast<VisitorType*>(userData))(subclass));
+						   }, &visitor);
+}
+
+template <typename Visitor, typename>
+bool Struct::foreachField(Visitor&& visitor, bool shouldInspectInherited) const
+{
+	return internal::SpanAlgorithm::foreach(getFieldsSpan(),
+											[this, &visitor, shouldInspectInherited](auto const& field)
+											{
+												return (field.getKind() == EEntityKind::Field && (shouldInspectInherited || field.getOuterEntity() == this)) ? visitor(field) : true;
+											});
+}
+
+template <typename Predicate, typename>
+auto Struct::queryFields(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	auto filter = [this, predicate = std::forward<Predicate>(predicate), shouldInspectInherited](auto const& field)
+	{
+		return	field.getKind() == EEntityKind::Field &&
+				(shouldInspectInherited || field.getOuterEntity() == this) &&
+				predicate(field);
+	};
+
+	return FilteredView<Field, Field const* const, decltype(filter)>(getFieldsSpan(), std::move(filter));
+}
+
+template <typename Predicate, typename>
+StaticField const* Struct::getStaticFieldByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<StaticField>(getStaticFieldsSpan(),
+																	[this, &predicate, shouldInspectInherited](auto const& staticField)
+																	{
+																		return (shouldInspectInherited || staticField.getOuterEntity() == this) && predicate(staticField);
+																	});
+}
+
+template <typename Predicate, typename>
+Vector<StaticField const*> Struct::getStaticFieldsByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<StaticField>(getStaticFieldsSpan(),
+																	 [this, &predicate, shouldInspectInherited](auto const& staticField)
+																	 {
+																		 return (shouldInspectInherited || staticField.getOuterEntity() == this) && predicate(staticField);
+																	 });
+}
+
+template <typename Visitor, typename>
+bool Struct::foreachStaticField(Visitor&& visitor, bool shouldInspectInherited) const
+{
+	return internal::SpanAlgorithm::foreach(getStaticFieldsSpan(),
+											[this, &visitor, shouldInspectInherited](auto const& staticField)
+											{
+												return (shouldInspectInherited || staticField.getOuterEntity() == this) ? visitor(staticField) : true;
+											});
+}
+
+template <typename Predicate, typename>
+auto Struct::queryStaticFields(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	auto filter = [this, predicate = std::forward<Predicate>(predicate), shouldInspectInherited](auto const& staticField)
+	{
+		return (shouldInspectInherited || staticField.getOuterEntity() == this) && predicate(staticField);
+	};
+
+	return FilteredView<StaticField, StaticField const* const, decltype(filter)>(getStaticFieldsSpan(), std::move(filter));
+}
+
+template <typename Predicate, typename>
+Method const* Struct::getMethodByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	Method const* result = internal::SpanAlgorithm::getItemByPredicate<Method>(getMethodsSpan(), predicate);
+
+	if (result == nullptr && shouldInspectInherited)
+	{
+		internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&result, &predicate](auto const& parent)
+										 {
+											 result = parent.getArchetype().getMethodByPredicate(predicate, true);
+
+											 return result == nullptr;
+										 });
+	}
+
+	return result;
+}
+
+template <typename Predicate, typename>
+Vector<Method const*> Struct::getMethodsByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	Vector<Method const*> result = internal::SpanAlgorithm::getItemsByPredicate<Method>(getMethodsSpan(), predicate);
+
+	if (shouldInspectInherited)
+	{
+		internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&result, &predicate](auto const& parent)
+										 {
+											 result.push_back(parent.getArchetype().getMethodsByPredicate(predicate, true));
+
+											 return true;
+										 });
+	}
+
+	return result;
+}
+
+template <typename Visitor, typename>
+bool Struct::foreachMethod(Visitor&& visitor, bool shouldInspectInherited) const
+{
+	bool result = internal::SpanAlgorithm::foreach(getMethodsSpan(), visitor);
+
+	//Iterate on parent methods if necessary
+	if (result && shouldInspectInherited)
+	{
+		result = internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&visitor](auto const& parent)
+												  {
+													  return parent.getArchetype().foreachMethod(visitor, true);
+												  });
+	}
+
+	return result;
+}
+
+template <typename Predicate, typename>
+auto Struct::queryMethods(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Method, Method const* const, PredicateType>(getMethodsSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+StaticMethod const* Struct::getStaticMethodByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	StaticMethod const* result = internal::SpanAlgorithm::getItemByPredicate<StaticMethod>(getStaticMethodsSpan(), predicate);
+
+	if (result == nullptr && shouldInspectInherited)
+	{
+		internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&result, &predicate](auto const& parent)
+										 {
+											 result = parent.getArchetype().getStaticMethodByPredicate(predicate, true);
+
+											 return result == nullptr;
+										 });
+	}
+
+	return result;
+}
+
+template <typename Predicate, typename>
+Vector<StaticMethod const*> Struct::getStaticMethodsByPredicate(Predicate&& predicate, bool shouldInspectInherited) const
+{
+	Vector<StaticMethod const*> result = internal::SpanAlgorithm::getItemsByPredicate<StaticMethod>(getStaticMethodsSpan(), predicate);
+
+	if (shouldInspectInherited)
+	{
+		internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&result, &predicate](auto const& parent)
+										 {
+											 result.push_back(parent.getArchetype().getStaticMethodsByPredicate(predicate, true));
+
+											 return true;
+										 });
+	}
+
+	return result;
+}
+
+template <typename Visitor, typename>
+bool Struct::foreachStaticMethod(Visitor&& visitor, bool shouldInspectInherited) const
+{
+	bool result = internal::SpanAlgorithm::foreach(getStaticMethodsSpan(), visitor);
+
+	//Iterate on parent static methods if necessary
+	if (result && shouldInspectInherited)
+	{
+		result = internal::SpanAlgorithm::foreach(getDirectParentsSpan(), [&visitor](auto const& parent)
+												  {
+													  return parent.getArchetype().foreachStaticMethod(visitor, true);
+												  });
+	}
+
+	return result;
+}
+
+template <typename Predicate, typename>
+auto Struct::queryStaticMethods(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<StaticMethod, StaticMethod const* const, PredicateType>(getStaticMethodsSpan(), PredicateType(std::forward<Predicate>(predicate)));
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+/*
+*	Struct hot getters.
+*	Included from Struct.h when RFK_INLINE_HOT_GETTERS is enabled, from Struct.cpp otherwise.
+*/
+
+namespace rfk
+{
+	bool Struct::isSubclassOf(Struct const& archetype) const noexcept
+	{
+		return &archetype != this && archetype.isBaseOf(*this);
+	}
+
+	bool Struct::isBaseOf(Struct const& archetype) const noexcept
+	{
+		return &archetype == this || hasSubclass(archetype);
+	}
+}
\ No newline at end of file
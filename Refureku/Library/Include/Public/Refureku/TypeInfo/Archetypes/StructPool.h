@@ -0,0 +1,188 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <utility>	//std::forward
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/Misc/UniquePtr.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class StructPool;
+
+	namespace internal
+	{
+		class StructPoolImpl;
+	}
+
+	/**
+	*	Deleter of the instances made by a StructPool, compatible with rfk::UniquePtr.
+	*	The instance is destroyed through the destructor of its struct and its memory is returned to the pool.
+	*/
+	class StructPoolDeleter final
+	{
+		private:
+			/** Pool the instance memory belongs to. */
+			StructPool*	_pool	= nullptr;
+
+			/** Memory the instance was constructed in. It can differ from the deleted pointer if the pointer was adjusted to a parent class. */
+			void*		_memory	= nullptr;
+
+		public:
+			StructPoolDeleter()										= default;
+			inline StructPoolDeleter(StructPool&	pool,
+									 void*			memory)	noexcept;
+
+			/**
+			*	@brief Destroy the instance and return its memory to the pool.
+			*/
+			template <typename T>
+			void						operator()(T* /* instance */)	const	noexcept;
+
+			/**
+			*	@brief Get the pool the instance memory belongs to.
+			*
+			*	@return The pool the instance memory belongs to, nullptr for a default constructed deleter.
+			*/
+			RFK_NODISCARD inline StructPool*	getPool()				const	noexcept;
+
+			/**
+			*	@brief Get the memory the instance was constructed in.
+			*
+			*	@return The memory the instance was constructed in, nullptr for a default constructed deleter.
+			*/
+			RFK_NODISCARD inline void*			getMemory()				const	noexcept;
+	};
+
+	/** Unique pointer to an instance made by a StructPool. */
+	template <typename T>
+	using PooledPtr = UniquePtr<T, StructPoolDeleter>;
+
+	/**
+	*	Pool of instances of a reflected struct.
+	*	Memory is allocated by slabs of slots sized and aligned from the struct getMemorySize() and getMemoryAlignment().
+	*	Each thread keeps its own free list of slots, so allocations and deallocations only synchronize
+	*	when a batch of slots is exchanged with the pool shared depot, or when a new slab is allocated.
+	*	Instances are constructed in the slots with the struct placement instantiators (see Struct::makeInstanceAt).
+	*	All the instances must be destroyed before the pool is destroyed.
+	*/
+	class StructPool final
+	{
+		public:
+			/**
+			*	@param archetype			Struct of the pooled instances. It must outlive the pool.
+			*	@param slabInstancesCount	Number of instances allocated at once when the pool runs out of memory.
+			*/
+			REFUREKU_API StructPool(Struct const&	archetype,
+									std::size_t		slabInstancesCount = 64u)	noexcept;
+			StructPool(StructPool const&)										= delete;
+			StructPool(StructPool&&)											= delete;
+			REFUREKU_API ~StructPool()											noexcept;
+
+			/**
+			*	@brief	Make an instance of the pooled struct with the matching placement instantiator.
+			*
+			*	@return An instance of the pooled struct if a suitable placement instantiator was found, else nullptr.
+			*
+			*	@exception Any exception potentially thrown by the used instantiator. The slot memory is returned to the pool in that case.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD
+				PooledPtr<ReturnType>	makeUniqueInstance(ArgTypes&&... args);
+
+			/**
+			*	@brief	Make a copy of an instance of the pooled struct with Struct::copyConstructAt.
+			*			Trivially copyable structs are copied with a memcpy.
+			*
+			*	@param source Pointer to the memory of the instance to copy, not adjusted to a parent class.
+			*
+			*	@return A copy of source if the pooled struct is copyable, else nullptr.
+			*
+			*	@exception Any exception potentially thrown by the copy constructor. The slot memory is returned to the pool in that case.
+			*/
+			template <typename ReturnType>
+			RFK_NODISCARD
+				PooledPtr<ReturnType>	makeUniqueCopy(void const* source);
+
+			/**
+			*	@brief	Get the memory of a slot. The memory is uninitialized.
+			*			The slot must be returned with deallocate.
+			*
+			*	@return The slot memory, or nullptr if a new slab was required and could not be allocated.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				void*					allocate()										noexcept;
+
+			/**
+			*	@brief	Return the memory of a slot to the pool. The slot can be deallocated from any thread.
+			*
+			*	@param memory Memory returned by allocate. Its instance, if any, must already be destroyed.
+			*/
+			REFUREKU_API void			deallocate(void* memory)						noexcept;
+
+			/**
+			*	@brief	Destroy the instance constructed in a slot with the struct destructor, and return the slot memory to the pool.
+			*
+			*	@param memory Memory returned by allocate.
+			*/
+			REFUREKU_API void			destroyInstance(void* memory)					noexcept;
+
+			/**
+			*	@brief Get the struct of the pooled instances.
+			*
+			*	@return The struct of the pooled instances.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				Struct const&			getArchetype()							const	noexcept;
+
+			/**
+			*	@brief Get the size of a slot, which is the struct memory size rounded up to the slot alignment.
+			*
+			*	@return The size of a slot in bytes.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t				getSlotSize()							const	noexcept;
+
+			/**
+			*	@brief Get the number of slabs allocated by the pool.
+			*
+			*	@return The number of slabs allocated by the pool.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t				getSlabsCount()							const	noexcept;
+
+			/**
+			*	@brief Get the number of slots allocated by the pool, may they be used or not.
+			*
+			*	@return The number of slots allocated by the pool.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t				getCapacity()							const	noexcept;
+
+		private:
+			/** Pointer to StructPool implementation. */
+			Pimpl<internal::StructPoolImpl> _pimpl;
+	};
+
+	/**
+	*	@brief	Get the pool shared by all the users of a struct, creating it on first use.
+	*			Shared pools are destroyed when the program exits, so the struct must be registered for the whole program lifetime.
+	*
+	*	@param archetype Struct of the pooled instances.
+	*
+	*	@return The pool shared by all the users of archetype.
+	*/
+	RFK_NODISCARD REFUREKU_API StructPool& getStructPool(Struct const& archetype);
+
+	#include "Refureku/TypeInfo/Archetypes/StructPool.inl"
+}
\ No newline at end of file
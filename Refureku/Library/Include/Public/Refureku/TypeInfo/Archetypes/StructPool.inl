@@ -0,0 +1,111 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline StructPoolDeleter::StructPoolDeleter(StructPool& pool, void* memory) noexcept:
+	_pool{&pool},
+	_memory{memory}
+{
+}
+
+template <typename T>
+void StructPoolDeleter::operator()(T* /* instance */) const noexcept
+{
+	//Destroy from the slot memory since the deleted pointer might have been adjusted to a parent class
+	_pool->destroyInstance(_memory);
+}
+
+inline StructPool* StructPoolDeleter::getPool() const noexcept
+{
+	return _pool;
+}
+
+inline void* StructPoolDeleter::getMemory() const noexcept
+{
+	return _memory;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+PooledPtr<ReturnType> StructPool::makeUniqueInstance(ArgTypes&&... args)
+{
+	void* memory = allocate();
+
+	if (memory == nullptr)
+	{
+		return nullptr;
+	}
+
+	//Return the slot to the pool if no instance is constructed, including when the instantiator throws
+	struct SlotGuard
+	{
+		StructPool&	pool;
+		void*		memory;
+
+		~SlotGuard()
+		{
+			if (memory != nullptr)
+			{
+				pool.deallocate(memory);
+			}
+		}
+	} guard{*this, memory};
+
+	ReturnType* instance = getArchetype().makeInstanceAt<ReturnType>(memory, std::forward<ArgTypes>(args)...);
+
+	if (instance == nullptr)
+	{
+		return nullptr;
+	}
+
+	guard.memory = nullptr;
+
+	return PooledPtr<ReturnType>(instance, StructPoolDeleter(*this, memory));
+}
+
+template <typename ReturnType>
+PooledPtr<ReturnType> StructPool::makeUniqueCopy(void const* source)
+{
+	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeUniqueCopy should not be a pointer or a reference.");
+
+	void* memory = allocate();
+
+	if (memory == nullptr)
+	{
+		return nullptr;
+	}
+
+	//Return the slot to the pool if no copy is constructed, including when the copy constructor throws
+	struct SlotGuard
+	{
+		StructPool&	pool;
+		void*		memory;
+
+		~SlotGuard()
+		{
+			if (memory != nullptr)
+			{
+				pool.deallocate(memory);
+			}
+		}
+	} guard{*this, memory};
+
+	Struct const& archetype = getArchetype();
+
+	if (!archetype.copyConstructAt(memory, source))
+	{
+		return nullptr;
+	}
+
+	guard.memory = nullptr;
+
+	Struct const* returnTypeArchetype = static_cast<Struct const*>(rfk::getArchetype<ReturnType>());
+
+	//Adjust the pointer from the pooled struct to ReturnType
+	ReturnType* instance = (returnTypeArchetype != nullptr) ? rfk::dynamicUpCast<ReturnType>(memory, archetype, *returnTypeArchetype) :
+															  static_cast<ReturnType*>(memory);
+
+	return PooledPtr<ReturnType>(instance, StructPoolDeleter(*this, memory));
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <utility>	//std::forward
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/Containers/StridedSpan.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Archetypes/EStructStorageLayout.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+
+namespace rfk
+{
+	//Forward declarations
+	namespace internal
+	{
+		class StructStorageImpl;
+	}
+
+	/**
+	*	Container of instances of a single reflected struct, stored in fixed-size chunks.
+	*	Instances are constructed, copied, relocated and destroyed through the struct reflected functions,
+	*	and the values of a field can be iterated chunk by chunk from its memory offset (see getFieldSpan).
+	*	Chunks are never moved, but removing an instance relocates the last instance in its place.
+	*	The container is not thread-safe.
+	*/
+	class StructStorage final
+	{
+		public:
+			/**
+			*	@param archetype			Struct of the stored instances. It must outlive the storage.
+			*	@param layout				Layout of the instances in the chunks. The AoS layout is used if the struct doesn't support the provided layout (see isLayoutSupported).
+			*	@param chunkInstancesCount	Number of instances stored in a chunk.
+			*/
+			REFUREKU_API StructStorage(Struct const&		archetype,
+									   EStructStorageLayout	layout				= EStructStorageLayout::AoS,
+									   std::size_t			chunkInstancesCount	= 1024u)	noexcept;
+			StructStorage(StructStorage const&)											= delete;
+			StructStorage(StructStorage&&)												= delete;
+			REFUREKU_API ~StructStorage()												noexcept;
+
+			/**
+			*	@brief	Check whether instances of a struct can be stored with a layout.
+			*			The SoA layout requires a trivially copyable struct whose reflected fields have a known size (value, pointer or c-style array fields).
+			*			Only the reflected fields of an instance are kept in the SoA layout.
+			*
+			*	@param archetype	The struct to check.
+			*	@param layout		The layout to check.
+			*
+			*	@return true if instances of archetype can be stored with layout, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API static bool	isLayoutSupported(Struct const&			archetype,
+																	  EStructStorageLayout	layout)		noexcept;
+
+			/**
+			*	@brief	Construct a new instance at the end of the storage with the matching placement instantiator of the struct.
+			*
+			*	@return true if the instance was constructed, false if no suitable placement instantiator was found or a chunk could not be allocated.
+			*
+			*	@exception Any exception potentially thrown by the used instantiator. The storage is left unchanged in that case.
+			*/
+			template <typename... ArgTypes>
+			bool									emplaceBack(ArgTypes&&... args);
+
+			/**
+			*	@brief	Copy contiguous instances of the struct at the end of the storage.
+			*			Trivially copyable structs are copied with a single memcpy per chunk in the AoS layout.
+			*
+			*	@param sources	Pointer to the memory of the instances to copy, not adjusted to a parent class.
+			*	@param count	Number of instances to copy.
+			*
+			*	@return true if the instances were copied, false if the struct is not copyable or a chunk could not be allocated.
+			*
+			*	@exception Any exception thrown by the copy constructor. The instances copied to the previous chunks are kept in that case.
+			*/
+			REFUREKU_API bool						pushBackCopies(void const*	sources,
+																   std::size_t	count = 1u);
+
+			/**
+			*	@brief	Destroy an instance and relocate the last instance in its place.
+			*
+			*	@param index Index of the instance to remove. Must be less than getInstancesCount().
+			*
+			*	@return true if the instance was removed, false if the last instance could not be relocated (the struct is not movable).
+			*
+			*	@exception Any exception thrown by the move constructor.
+			*/
+			REFUREKU_API bool						swapRemove(std::size_t index);
+
+			/**
+			*	@brief Destroy all the instances. The chunks are kept to be reused.
+			*/
+			REFUREKU_API void						clear()														noexcept;
+
+			/**
+			*	@brief Get an instance stored in the AoS layout.
+			*
+			*	@param index Index of the instance. Must be less than getInstancesCount().
+			*
+			*	@return A pointer to the instance, nullptr in the SoA layout since instances are not materialized.
+			*/
+			RFK_NODISCARD REFUREKU_API void*		getInstanceAt(std::size_t index)					const	noexcept;
+
+			/**
+			*	@brief Get the value of a field of an instance, in any layout.
+			*
+			*	@param field	Field of the stored struct.
+			*	@param index	Index of the instance. Must be less than getInstancesCount().
+			*
+			*	@return A pointer to the field value, nullptr if the field is not stored.
+			*/
+			RFK_NODISCARD REFUREKU_API void*		getFieldAt(Field const&	field,
+															   std::size_t	index)						const	noexcept;
+
+			/**
+			*	@brief	Get the values of a field of all the instances of a chunk.
+			*			The span is contiguous in the SoA layout, and strided by the struct size in the AoS layout.
+			*
+			*	@tparam FieldType	Type of the field. The behaviour is undefined if it doesn't match the field type.
+			*
+			*	@param field		Field of the stored struct.
+			*	@param chunkIndex	Index of the chunk. Must be less than getChunksCount().
+			*
+			*	@return The values of the field in the chunk, an empty span if the field is not stored.
+			*/
+			template <typename FieldType>
+			RFK_NODISCARD StridedSpan<FieldType>	getFieldSpan(Field const&	field,
+																 std::size_t	chunkIndex)				const	noexcept;
+
+			/**
+			*	@brief Call a visitor with the values of a field of each chunk.
+			*
+			*	@tparam FieldType	Type of the field. The behaviour is undefined if it doesn't match the field type.
+			*
+			*	@param field	Field of the stored struct.
+			*	@param visitor	Visitor called with the StridedSpan<FieldType> of each chunk.
+			*/
+			template <typename FieldType, typename Visitor>
+			void									foreachFieldSpan(Field const&	field,
+																	 Visitor&&		visitor)			const;
+
+			/**
+			*	@brief Get the struct of the stored instances.
+			*
+			*	@return The struct of the stored instances.
+			*/
+			RFK_NODISCARD REFUREKU_API Struct const&		getArchetype()								const	noexcept;
+
+			/**
+			*	@brief Get the layout of the instances in the chunks.
+			*
+			*	@return The layout of the instances.
+			*/
+			RFK_NODISCARD REFUREKU_API EStructStorageLayout	getLayout()									const	noexcept;
+
+			/**
+			*	@brief Get the number of stored instances.
+			*
+			*	@return The number of stored instances.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t			getInstancesCount()							const	noexcept;
+
+			/**
+			*	@brief Get the number of instances a chunk can store.
+			*
+			*	@return The number of instances a chunk can store.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t			getChunkInstancesCount()					const	noexcept;
+
+			/**
+			*	@brief Get the number of chunks storing at least one instance.
+			*
+			*	@return The number of chunks storing at least one instance.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t			getChunksCount()							const	noexcept;
+
+			/**
+			*	@brief Get the number of instances stored in a chunk.
+			*
+			*	@param chunkIndex Index of the chunk.
+			*
+			*	@return The number of instances stored in the chunk, 0 if chunkIndex is out of bounds.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t			getChunkSize(std::size_t chunkIndex)		const	noexcept;
+
+		private:
+			/** Pointer to StructStorage implementation. */
+			Pimpl<internal::StructStorageImpl> _pimpl;
+
+			/**
+			*	@brief Get the memory receiving the next instance, allocating a new chunk if needed.
+			*
+			*	@return The memory receiving the next instance, nullptr if a chunk could not be allocated.
+			*/
+			RFK_NODISCARD REFUREKU_API void*		reserveBack()												noexcept;
+
+			/**
+			*	@brief Add the instance constructed in the memory returned by reserveBack to the storage.
+			*/
+			REFUREKU_API void						commitBack()												noexcept;
+
+			/**
+			*	@brief Get the values of a field in a chunk.
+			*
+			*	@param field		Field of the stored struct.
+			*	@param chunkIndex	Index of the chunk.
+			*	@param out_stride	Number of bytes between the values of two consecutive instances.
+			*
+			*	@return A pointer to the value of the first instance of the chunk, nullptr if the field is not stored.
+			*/
+			RFK_NODISCARD REFUREKU_API void*		getFieldData(Field const&	field,
+																 std::size_t	chunkIndex,
+																 std::size_t&	out_stride)				const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Archetypes/StructStorage.inl"
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename... ArgTypes>
+bool StructStorage::emplaceBack(ArgTypes&&... args)
+{
+	void* memory = reserveBack();
+
+	if (memory == nullptr || getArchetype().makeRawInstanceAt<ArgTypes...>(memory, std::forward<ArgTypes>(args)...) == nullptr)
+	{
+		return false;
+	}
+
+	commitBack();
+
+	return true;
+}
+
+template <typename FieldType>
+StridedSpan<FieldType> StructStorage::getFieldSpan(Field const& field, std::size_t chunkIndex) const noexcept
+{
+	std::size_t	stride;
+	void*		data = getFieldData(field, chunkIndex, stride);
+
+	return (data != nullptr) ? StridedSpan<FieldType>(static_cast<FieldType*>(data), getChunkSize(chunkIndex), stride) :
+							   StridedSpan<FieldType>();
+}
+
+template <typename FieldType, typename Visitor>
+void StructStorage::foreachFieldSpan(Field const& field, Visitor&& visitor) const
+{
+	std::size_t chunksCount = getChunksCount();
+
+	for (std::size_t i = 0u; i < chunksCount; i++)
+	{
+		visitor(getFieldSpan<FieldType>(field, i));
+	}
+}
\ No newline at end of file
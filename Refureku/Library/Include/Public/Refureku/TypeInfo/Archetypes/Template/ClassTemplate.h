@@ -60,6 +60,8 @@ namespace rfk
 
 			/**
 			*	@brief	Get an existing template instantiation corresponding to the provided arguments.
+			*			nullptr arguments match any argument.
+			*			When all arguments are provided, the instantiation is retrieved in constant time from a template arguments index.
 			* 
 			*	@param args			Pointer to an array of argument pointers
 			*	@param argsCount	Number of template arguments.
@@ -118,6 +120,10 @@ namespace rfk
 			class ClassTemplateImpl;
 
 			RFK_GEN_GET_PIMPL(ClassTemplateImpl, Entity::getPimpl())
+
+		//ClassTemplateInstantiation indexes itself in its class template once all its template arguments are known
+		friend ClassTemplateInstantiation;
+		friend internal::MemoryFootprintCollector;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.inl"
@@ -79,5 +79,7 @@ namespace rfk
 			class ClassTemplateInstantiationImpl;
 
 			RFK_GEN_GET_PIMPL(ClassTemplateInstantiationImpl, Entity::getPimpl())
+
+		friend internal::MemoryFootprintCollector;
 	};
 }
\ No newline at end of file
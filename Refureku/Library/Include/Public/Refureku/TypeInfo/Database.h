@@ -7,14 +7,24 @@
 
 #pragma once
 
+#include <vector>
+#include <optional>
+
 #include "Refureku/Config.h"
 #include "Refureku/Misc/Pimpl.h"
 #include "Refureku/Misc/Visitor.h"
 #include "Refureku/Misc/Predicate.h"
 #include "Refureku/Containers/Vector.h"
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Containers/FilteredView.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
 #include "Refureku/TypeInfo/Variables/EVarFlags.h"
 #include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
 #include "Refureku/TypeInfo/Functions/FunctionHelper.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/MemoryFootprint.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
+#include "Refureku/TypeInfo/RegistrationTrace.h"
 
 namespace rfk
 {
@@ -41,6 +51,9 @@ namespace rfk
 		class ArchetypeRegistererImpl;
 		class NamespaceFragmentRegistererImpl;
 		class ClassTemplateInstantiationRegistererImpl;
+		class ModuleHandleImpl;
+		class CompiledQueryImpl;
+		class MemoryFootprintCollector;
 	}
 
 	class Database final
@@ -134,6 +147,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelNamespacesCount()													const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level namespaces.
+			*			The span is invalidated when a namespace is added to or removed from the database.
+			* 
+			*	@return A span over all file level namespaces.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Namespace const* const>	getFileLevelNamespacesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level namespace satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid namespace.
+			* 
+			*	@return The first found namespace satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD Namespace const*		getFileLevelNamespaceByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level namespaces satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid namespace.
+			* 
+			*	@return All file level namespaces satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD Vector<Namespace const*>	getFileLevelNamespacesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level namespaces.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Namespace const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Namespace>>
+			bool							foreachFileLevelNamespace(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level namespaces registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level namespace is added to the database.
+			*
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid file level namespace.
+			*
+			*	@return A view over the file level namespaces satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD auto				queryFileLevelNamespaces(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve an archetype by id.
 			*
@@ -239,6 +311,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelStructsCount()														const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level structs.
+			*			The span is invalidated when a struct is added to or removed from the database.
+			* 
+			*	@return A span over all file level structs.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Struct const* const>	getFileLevelStructsSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level struct satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Struct const& and returning true for a valid struct.
+			* 
+			*	@return The first found struct satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD Struct const*		getFileLevelStructByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level structs satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Struct const& and returning true for a valid struct.
+			* 
+			*	@return All file level structs satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD Vector<Struct const*>	getFileLevelStructsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level structs.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Struct const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Struct>>
+			bool							foreachFileLevelStruct(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level structs registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level struct is added to the database.
+			*
+			*	@param predicate Callable taking a Struct const& and returning true for a valid file level struct.
+			*
+			*	@return A view over the file level structs satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD auto				queryFileLevelStructs(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a class by id.
 			*
@@ -308,6 +439,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelClassesCount()														const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level classes.
+			*			The span is invalidated when a class is added to or removed from the database.
+			* 
+			*	@return A span over all file level classes.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Struct const* const>	getFileLevelClassesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level class satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Class const& and returning true for a valid class.
+			* 
+			*	@return The first found class satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD Class const*		getFileLevelClassByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level classes satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Class const& and returning true for a valid class.
+			* 
+			*	@return All file level classes satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD Vector<Class const*>	getFileLevelClassesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level classes.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Class const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Class>>
+			bool							foreachFileLevelClass(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level classs registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level class is added to the database.
+			*
+			*	@param predicate Callable taking a Class const& and returning true for a valid file level class.
+			*
+			*	@return A view over the file level classs satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD auto				queryFileLevelClasses(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve an enum by id.
 			*
@@ -377,6 +567,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelEnumsCount()														const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level enums.
+			*			The span is invalidated when an enum is added to or removed from the database.
+			* 
+			*	@return A span over all file level enums.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Enum const* const>	getFileLevelEnumsSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level enum satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking an Enum const& and returning true for a valid enum.
+			* 
+			*	@return The first found enum satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD Enum const*		getFileLevelEnumByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level enums satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking an Enum const& and returning true for a valid enum.
+			* 
+			*	@return All file level enums satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD Vector<Enum const*>	getFileLevelEnumsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level enums.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking an Enum const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Enum>>
+			bool							foreachFileLevelEnum(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level enums registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level enum is added to the database.
+			*
+			*	@param predicate Callable taking an Enum const& and returning true for a valid file level enum.
+			*
+			*	@return A view over the file level enums satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD auto				queryFileLevelEnums(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a fundamental archetype by id.
 			*
@@ -469,6 +718,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelVariablesCount()													const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level variables.
+			*			The span is invalidated when a variable is added to or removed from the database.
+			* 
+			*	@return A span over all file level variables.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Variable const* const>	getFileLevelVariablesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level variable satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Variable const& and returning true for a valid variable.
+			* 
+			*	@return The first found variable satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD Variable const*		getFileLevelVariableByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level variables satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Variable const& and returning true for a valid variable.
+			* 
+			*	@return All file level variables satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD Vector<Variable const*>	getFileLevelVariablesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level variables.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Variable const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Variable>>
+			bool							foreachFileLevelVariable(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level variables registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level variable is added to the database.
+			*
+			*	@param predicate Callable taking a Variable const& and returning true for a valid file level variable.
+			*
+			*	@return A view over the file level variables satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD auto				queryFileLevelVariables(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a function by id.
 			*
@@ -567,6 +875,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t			getFileLevelFunctionsCount()													const	noexcept;
 
+			/**
+			*	@brief	Get a span over all file level functions.
+			*			The span is invalidated when a function is added to or removed from the database.
+			* 
+			*	@return A span over all file level functions.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Function const* const>	getFileLevelFunctionsSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first file level function satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Function const& and returning true for a valid function.
+			* 
+			*	@return The first found function satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD Function const*		getFileLevelFunctionByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all file level functions satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Function const& and returning true for a valid function.
+			* 
+			*	@return All file level functions satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD Vector<Function const*>	getFileLevelFunctionsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all file level functions.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Function const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Function>>
+			bool							foreachFileLevelFunction(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the file level functions registered in the database satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a file level function is added to the database.
+			*
+			*	@param predicate Callable taking a Function const& and returning true for a valid file level function.
+			*
+			*	@return A view over the file level functions satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD auto				queryFileLevelFunctions(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a method by id.
 			*
@@ -617,6 +984,221 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API 
 				EnumValue const*				getEnumValueById(std::size_t id)												const	noexcept;
 
+			/**
+			*	@brief	Get the number of chunks the registered entities are partitioned into for the parallel traversals.
+			*			The partition only depends on the database content, not on the number of threads used for the traversal.
+			* 
+			*	@return The number of chunks of registered entities.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				std::size_t						getEntityChunksCount()															const	noexcept;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities matching the provided kinds, in parallel.
+			*			Entities are partitioned into getEntityChunksCount() chunks, processed by a work-stealing pool of threads.
+			*			Entities of a chunk are always visited in the same order by a single thread.
+			*			The database must not be modified during the traversal, but it can safely be read concurrently.
+			* 
+			*	@param kinds		Bitmask of the kinds of the visited entities.
+			*	@param visitor		Visitor function to call. It must be safe to call concurrently.
+			*						Return false to abort the traversal: the other threads stop once their current chunk is processed.
+			*	@param userData		Optional user data forwarded to the visitor.
+			*	@param threadsCount	Number of threads used for the traversal (including the calling thread). 0 uses all hardware threads.
+			* 
+			*	@return	false if a visitor returned false or the visitor is nullptr, else true.
+			* 
+			*	@exception The first exception thrown by the provided visitor, rethrown on the calling thread once all threads stopped.
+			*/
+			REFUREKU_API bool					parallelForeachEntityByChunk(EEntityKind				kinds,
+																			 ChunkVisitor<Entity>	visitor,
+																			 void*					userData,
+																			 std::size_t			threadsCount = 0u)				const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities matching the provided kinds, in parallel.
+			*			See parallelForeachEntityByChunk for the partitioning and thread-safety rules.
+			* 
+			*	@param kinds		Bitmask of the kinds of the visited entities.
+			*	@param visitor		Visitor function to call. It must be safe to call concurrently. Return false to abort the traversal.
+			*	@param userData		Optional user data forwarded to the visitor.
+			*	@param threadsCount	Number of threads used for the traversal (including the calling thread). 0 uses all hardware threads.
+			* 
+			*	@return	false if a visitor returned false or the visitor is nullptr, else true.
+			* 
+			*	@exception The first exception thrown by the provided visitor, rethrown on the calling thread once all threads stopped.
+			*/
+			REFUREKU_API bool					parallelForeachEntity(EEntityKind		kinds,
+																	  Visitor<Entity>	visitor,
+																	  void*				userData,
+																	  std::size_t		threadsCount = 0u)						const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities matching the provided kinds, in parallel.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param kinds		Bitmask of the kinds of the visited entities.
+			*	@param visitor		Callable taking an Entity const&. It must be safe to call concurrently. Return false to abort the traversal.
+			*	@param threadsCount	Number of threads used for the traversal (including the calling thread). 0 uses all hardware threads.
+			* 
+			*	@return	false if a visitor returned false, else true.
+			* 
+			*	@exception The first exception thrown by the provided visitor, rethrown on the calling thread once all threads stopped.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Entity>>
+			bool								parallelForeachEntity(EEntityKind	kinds,
+																	  Visitor&&		visitor,
+																	  std::size_t	threadsCount = 0u)							const;
+
+			/**
+			*	@brief	Map all registered entities matching the provided kinds to a value and reduce the values, in parallel.
+			*			Values are first reduced per chunk, then the chunk results are reduced in the chunk order,
+			*			so the result doesn't depend on the number of threads nor on the thread scheduling.
+			* 
+			*	@param kinds		Bitmask of the kinds of the reduced entities.
+			*	@param init			Initial value of the reduction.
+			*	@param map			Callable with the signature T(Entity const&). It must be safe to call concurrently.
+			*	@param reduce		Callable with the signature T(T const&, T const&). It must be safe to call concurrently.
+			*	@param threadsCount	Number of threads used for the traversal (including the calling thread). 0 uses all hardware threads.
+			* 
+			*	@return The reduction of init and all mapped entities.
+			* 
+			*	@exception The first exception thrown by map or reduce, rethrown on the calling thread once all threads stopped.
+			*/
+			template <typename T, typename Map, typename Reduce>
+			RFK_NODISCARD T						parallelReduceEntities(EEntityKind	kinds,
+																	   T			init,
+																	   Map&&		map,
+																	   Reduce&&		reduce,
+																	   std::size_t	threadsCount = 0u)							const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities which name starts with the provided prefix, in name order.
+			*			Names are ordered ignoring the ASCII case, so case sensitive and insensitive queries visit entities in the same order.
+			*			The name index is built by the first query, then updated incrementally when entities are registered or unregistered.
+			*			Queries can run concurrently, but the database must not be modified during a query.
+			* 
+			*	@param prefix			Prefix of the entity names.
+			*	@param kinds			Bitmask of the kinds of the visited entities.
+			*	@param visitor			Visitor function to call. Return false to abort the traversal.
+			*	@param userData			Optional user data forwarded to the visitor.
+			*	@param isCaseSensitive	Should the prefix be compared case sensitively?
+			*	@param outerEntity		If not nullptr, only the entities directly nested in this entity are visited
+			*							(members of a namespace, own members of a struct, values of an enum).
+			* 
+			*	@return	false if a visitor returned false or the visitor or the prefix is nullptr, else true.
+			*/
+			REFUREKU_API bool					foreachEntityByNamePrefix(char const*		prefix,
+																		  EEntityKind		kinds,
+																		  Visitor<Entity>	visitor,
+																		  void*				userData,
+																		  bool				isCaseSensitive = true,
+																		  Entity const*		outerEntity = nullptr)				const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities which name starts with the provided prefix, in name order.
+			*			See the function pointer overload for the ordering and thread-safety rules.
+			* 
+			*	@param prefix			Prefix of the entity names.
+			*	@param kinds			Bitmask of the kinds of the visited entities.
+			*	@param visitor			Callable taking an Entity const&. Return false to abort the traversal.
+			*	@param isCaseSensitive	Should the prefix be compared case sensitively?
+			*	@param outerEntity		If not nullptr, only the entities directly nested in this entity are visited.
+			* 
+			*	@return	false if a visitor returned false or the prefix is nullptr, else true.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Entity>>
+			bool								foreachEntityByNamePrefix(char const*	prefix,
+																		  EEntityKind	kinds,
+																		  Visitor&&		visitor,
+																		  bool			isCaseSensitive = true,
+																		  Entity const*	outerEntity = nullptr)					const;
+
+			/**
+			*	@brief	Retrieve the first registered entities in name order which name starts with the provided prefix.
+			*			See foreachEntityByNamePrefix for the ordering and thread-safety rules.
+			* 
+			*	@param prefix			Prefix of the entity names.
+			*	@param kinds			Bitmask of the kinds of the retrieved entities.
+			*	@param maxResults		Maximum number of retrieved entities. 0 retrieves all the matching entities.
+			*	@param isCaseSensitive	Should the prefix be compared case sensitively?
+			*	@param outerEntity		If not nullptr, only the entities directly nested in this entity are retrieved.
+			* 
+			*	@return The matching entities in name order.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Vector<Entity const*>			getEntitiesByNamePrefix(char const*		prefix,
+																		EEntityKind		kinds,
+																		std::size_t		maxResults = 0u,
+																		bool			isCaseSensitive = true,
+																		Entity const*	outerEntity = nullptr)					const;
+
+			/**
+			*	@brief	Export all registered entities to a binary snapshot which can be read with rfk::DatabaseSnapshot,
+			*			without loading nor initializing this program. The database must not be modified during the export.
+			* 
+			*	@return The snapshot, empty if it would exceed 4GB.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Vector<uint8>					exportSnapshot()																const;
+
+			/**
+			*	@brief Export all registered entities to a binary snapshot file. See exportSnapshot().
+			* 
+			*	@param filePath Path of the snapshot file to write.
+			* 
+			*	@return true if the snapshot file was written, else false.
+			*/
+			REFUREKU_API bool					exportSnapshot(char const* filePath)											const;
+
+			/**
+			*	@brief	Estimate the memory used by all registered entities and by the database registration tables, by category.
+			*			The database must not be modified during the computation.
+			* 
+			*	@return The memory footprint of the database.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				MemoryFootprint					computeMemoryFootprint()														const;
+
+			/**
+			*	@brief	Get the instrumentation counters of the most used entities, summed over all threads.
+			*			Counters are only recorded when Refureku is built with RFK_INSTRUMENTATION.
+			*
+			*	@param maxRecords Maximum number of retrieved records. 0 retrieves all the records.
+			*
+			*	@return The records sorted by decreasing total count, empty if the instrumentation is disabled.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				Vector<InstrumentationRecord>	getHottestLookups(std::size_t maxRecords)										const;
+
+			/**
+			*	@brief Reset the instrumentation counters of all threads. Does nothing if the instrumentation is disabled.
+			*/
+			REFUREKU_API void					resetInstrumentationCounters()													const	noexcept;
+
+			/**
+			*	@brief	Get the registration steps recorded since the program start or the last call to clearRegistrationTrace.
+			*			Steps are only recorded when Refureku is built with RFK_REGISTRATION_TRACING.
+			*
+			*	@return The recorded steps in start order, empty if the registration tracing is disabled.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				Vector<RegistrationTraceEvent>	getRegistrationTrace()															const;
+
+			/**
+			*	@brief	Write the recorded registration steps to a file in the Chrome trace event format, which can be opened in chrome://tracing or Perfetto.
+			*			Each step is a complete event whose category is the step kind and whose "module" argument is the module it is attributed to.
+			*
+			*	@param filePath Path of the trace file to write.
+			*
+			*	@return true if the trace file was written, else false. An empty trace is written if the registration tracing is disabled.
+			*/
+			REFUREKU_API bool					exportRegistrationTrace(char const* filePath)									const;
+
+			/**
+			*	@brief Remove the recorded registration steps. Does nothing if the registration tracing is disabled.
+			*/
+			REFUREKU_API void					clearRegistrationTrace()														const	noexcept;
+
 		private:
 			//Forward declaration
 			class DatabaseImpl;
@@ -637,6 +1219,9 @@ namespace rfk
 		friend internal::NamespaceFragmentRegistererImpl;
 		friend NamespaceFragment;
 		friend internal::ClassTemplateInstantiationRegistererImpl;
+		friend internal::ModuleHandleImpl;
+		friend internal::CompiledQueryImpl;
+		friend internal::MemoryFootprintCollector;
 		friend REFUREKU_API Database const& getDatabase() noexcept;
 	};
 
@@ -647,5 +1232,8 @@ namespace rfk
 	*/
 	REFUREKU_API Database const& getDatabase() noexcept;
 
+	REFUREKU_TEMPLATE_API(rfk::Allocator<uint8>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<uint8, rfk::Allocator<uint8>>);
+
 	#include "Refureku/TypeInfo/Database.inl"
 }
\ No newline at end of file
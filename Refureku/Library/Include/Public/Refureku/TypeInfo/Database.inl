@@ -22,4 +22,224 @@ Function const* Database::getFileLevelFunctionByName(char const* name, EFunction
 																func.hasSameName(userData.name) &&
 																internal::FunctionHelper<FunctionSignature>::hasSameSignature(func);
 													}, &data) : nullptr;
+}
+
+template <typename Predicate, typename>
+Namespace const* Database::getFileLevelNamespaceByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Namespace>(getFileLevelNamespacesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Namespace const*> Database::getFileLevelNamespacesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Namespace>(getFileLevelNamespacesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelNamespace(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelNamespacesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelNamespaces(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Namespace, Namespace const* const, PredicateType>(getFileLevelNamespacesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Struct const* Database::getFileLevelStructByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Struct>(getFileLevelStructsSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Struct const*> Database::getFileLevelStructsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Struct>(getFileLevelStructsSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelStruct(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelStructsSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelStructs(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Struct, Struct const* const, PredicateType>(getFileLevelStructsSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Class const* Database::getFileLevelClassByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Class>(getFileLevelClassesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Class const*> Database::getFileLevelClassesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Class>(getFileLevelClassesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelClass(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelClassesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelClasses(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Class, Struct const* const, PredicateType>(getFileLevelClassesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Enum const* Database::getFileLevelEnumByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Enum>(getFileLevelEnumsSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Enum const*> Database::getFileLevelEnumsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Enum>(getFileLevelEnumsSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelEnum(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelEnumsSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelEnums(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Enum, Enum const* const, PredicateType>(getFileLevelEnumsSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Variable const* Database::getFileLevelVariableByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Variable>(getFileLevelVariablesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Variable const*> Database::getFileLevelVariablesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Variable>(getFileLevelVariablesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelVariable(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelVariablesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelVariables(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Variable, Variable const* const, PredicateType>(getFileLevelVariablesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Function const* Database::getFileLevelFunctionByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Function>(getFileLevelFunctionsSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Function const*> Database::getFileLevelFunctionsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Function>(getFileLevelFunctionsSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Database::foreachFileLevelFunction(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFileLevelFunctionsSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Database::queryFileLevelFunctions(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Function, Function const* const, PredicateType>(getFileLevelFunctionsSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Visitor, typename>
+bool Database::parallelForeachEntity(EEntityKind kinds, Visitor&& visitor, std::size_t threadsCount) const
+{
+	using VisitorType = std::remove_reference_t<Visitor>;
+
+	return parallelForeachEntityByChunk(kinds, [](Entity const& entity, std::size_t /* chunkIndex */, void* userData)
+										{
+											return static_cast<bool>((*reinterpret_cast<VisitorType*>(userData))(entity));
+										}, &visitor, threadsCount);
+}
+
+template <typename T, typename Map, typename Reduce>
+T Database::parallelReduceEntities(EEntityKind kinds, T init, Map&& map, Reduce&& reduce, std::size_t threadsCount) const
+{
+	struct Data
+	{
+		std::remove_reference_t<Map>&		map;
+		std::remove_reference_t<Reduce>&	reduce;
+		std::vector<std::optional<T>>		chunkResults;
+	};
+
+	Data data{map, reduce, std::vector<std::optional<T>>(getEntityChunksCount())};
+
+	parallelForeachEntityByChunk(kinds, [](Entity const& entity, std::size_t chunkIndex, void* userData)
+								 {
+									 Data& data = *reinterpret_cast<Data*>(userData);
+
+									 //A chunk is only processed by a single thread at a time
+									 std::optional<T>& chunkResult = data.chunkResults[chunkIndex];
+
+									 if (chunkResult.has_value())
+									 {
+										 chunkResult = data.reduce(*chunkResult, data.map(entity));
+									 }
+									 else
+									 {
+										 chunkResult = data.map(entity);
+									 }
+
+									 return true;
+								 }, &data, threadsCount);
+
+	for (std::optional<T>& chunkResult : data.chunkResults)
+	{
+		if (chunkResult.has_value())
+		{
+			init = reduce(init, *chunkResult);
+		}
+	}
+
+	return init;
+}
+
+template <typename Visitor, typename>
+bool Database::foreachEntityByNamePrefix(char const* prefix, EEntityKind kinds, Visitor&& visitor, bool isCaseSensitive, Entity const* outerEntity) const
+{
+	using VisitorType = std::remove_reference_t<Visitor>;
+
+	return foreachEntityByNamePrefix(prefix, kinds, [](Entity const& entity, void* userData)
+									 {
+										 return static_cast<bool>((*reinterpret_cast<VisitorType*>(userData))(entity));
+									 }, &visitor, isCaseSensitive, outerEntity);
 }
\ No newline at end of file
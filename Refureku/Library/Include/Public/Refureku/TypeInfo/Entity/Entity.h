@@ -18,6 +18,7 @@
 #include "Refureku/Misc/Visitor.h"
 #include "Refureku/Misc/Predicate.h"
 #include "Refureku/Containers/Vector.h"
+#include "Refureku/Containers/SmallVector.h"
 
 namespace rfk
 {
@@ -25,6 +26,12 @@ namespace rfk
 	class Struct;
 	class Algorithm;
 
+	namespace internal
+	{
+		class MemoryFootprintCollector;
+		class ModulePatcher;
+	}
+
 	class Entity
 	{
 		public:
@@ -127,6 +134,37 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API
 				Vector<Property const*>		getPropertiesByName(char const* name)						const	noexcept;
 
+			/**
+			*	@brief	Write all properties named with the provided name in a caller provided buffer.
+			*			No result collection is allocated.
+			* 
+			*	@param name				Name of the properties to retrieve.
+			*	@param outProperties	Buffer receiving the found properties. Can be nullptr if capacity is 0.
+			*	@param capacity			Number of properties outProperties can hold.
+			* 
+			*	@return	The total number of properties named with the provided name.
+			*			Only the first capacity properties are written, so a result greater than capacity means the buffer was too small.
+			*/
+			REFUREKU_API std::size_t		getPropertiesByName(char const*		name,
+																Property const**	outProperties,
+																std::size_t			capacity)	const	noexcept;
+
+			/**
+			*	@brief	Retrieve all properties named with the provided name in a SmallVector.
+			*			Nothing is allocated as long as the result fits in the inline capacity.
+			* 
+			*	@tparam N				Inline capacity of the result.
+			*	@tparam AllocatorType	Allocator used by the result if it doesn't fit inline (ArenaAllocator for frame-scoped queries for example).
+			* 
+			*	@param name			Name of the properties to retrieve.
+			*	@param allocator	Allocator used by the result.
+			* 
+			*	@return A collection of all properties named with the provided name.
+			*/
+			template <std::size_t N, typename AllocatorType = Allocator<Property const*>>
+			RFK_NODISCARD SmallVector<Property const*, N, AllocatorType>	getPropertiesByName(char const*				name,
+																								AllocatorType const&	allocator = AllocatorType())	const;
+
 			/**
 			*	@brief Retrieve all properties matching with a predicate in this entity.
 			*	
@@ -168,7 +206,7 @@ namespace rfk
 			* 
 			*	@return The name of the entity.
 			*/
-			RFK_NODISCARD REFUREKU_API
+			RFK_NODISCARD REFUREKU_HOT_GETTER
 				char const*					getName()													const	noexcept;
 
 			/**
@@ -185,7 +223,7 @@ namespace rfk
 			* 
 			*	@return The program-unique id of the entity.
 			*/
-			RFK_NODISCARD REFUREKU_API
+			RFK_NODISCARD REFUREKU_HOT_GETTER
 				std::size_t					getId()														const	noexcept;
 
 			/**
@@ -195,7 +233,7 @@ namespace rfk
 			* 
 			*	@return The kind of the entity.
 			*/
-			RFK_NODISCARD REFUREKU_API
+			RFK_NODISCARD REFUREKU_HOT_GETTER
 				EEntityKind					getKind()													const	noexcept;
 
 			/**
@@ -205,7 +243,7 @@ namespace rfk
 			* 
 			*	@return The outer entity of the entity.
 			*/
-			RFK_NODISCARD REFUREKU_API
+			RFK_NODISCARD REFUREKU_HOT_GETTER
 				Entity const*				getOuterEntity()											const	noexcept;
 
 			/**
@@ -256,7 +294,12 @@ namespace rfk
 			Pimpl<EntityImpl> _pimpl;
 
 		friend Algorithm;
+		friend internal::MemoryFootprintCollector;
 	};
 
 	#include "Refureku/TypeInfo/Entity/Entity.inl"
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Entity/EntityImpl.h"
+#endif
\ No newline at end of file
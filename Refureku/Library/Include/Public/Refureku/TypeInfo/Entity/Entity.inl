@@ -21,4 +21,26 @@ Vector<PropertyType const*> Entity::getProperties(bool isChildClassValid) const
 	//Not safe if PropertyType inherits from multiple polymorphic types and rfk::Property is not the first inherited type
 	//Specified in method documentation.
 	return getProperties(PropertyType::staticGetArchetype(), isChildClassValid);
+}
+
+template <std::size_t N, typename AllocatorType>
+SmallVector<Property const*, N, AllocatorType> Entity::getPropertiesByName(char const* name, AllocatorType const& allocator) const
+{
+	SmallVector<Property const*, N, AllocatorType> result(allocator);
+
+	//Query in the inline storage first (2 allocated slots without inline storage, most queries return few results),
+	//and query again only if it was too small
+	result.resize((N > 0u) ? N : 2u);
+
+	std::size_t found = getPropertiesByName(name, result.data(), result.size());
+
+	if (found > result.size())
+	{
+		result.resize(found);
+		getPropertiesByName(name, result.data(), found);
+	}
+
+	result.resize(found);
+
+	return result;
 }
\ No newline at end of file
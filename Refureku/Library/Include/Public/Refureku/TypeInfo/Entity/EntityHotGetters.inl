@@ -0,0 +1,34 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+/*
+*	Entity hot getters.
+*	Included from EntityImpl.h when RFK_INLINE_HOT_GETTERS is enabled, from Entity.cpp otherwise.
+*/
+
+namespace rfk
+{
+	char const* Entity::getName() const noexcept
+	{
+		return _pimpl->getName().data();
+	}
+
+	std::size_t Entity::getId() const noexcept
+	{
+		return _pimpl->getId();
+	}
+
+	EEntityKind Entity::getKind() const noexcept
+	{
+		return _pimpl->getKind();
+	}
+
+	Entity const* Entity::getOuterEntity() const noexcept
+	{
+		return _pimpl->getOuterEntity();
+	}
+}
\ No newline at end of file
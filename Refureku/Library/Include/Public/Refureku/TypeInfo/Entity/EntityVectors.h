@@ -0,0 +1,54 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Config.h"
+#include "Refureku/Containers/Vector.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Archetype;
+	class Struct;
+	class Enum;
+	class EnumValue;
+	class Field;
+	class StaticField;
+	class Method;
+	class StaticMethod;
+	class Function;
+	class Variable;
+	class Namespace;
+
+	/*
+	*	Vectors of entity pointers are instantiated once in the library.
+	*	They are declared here, before any header template returns one of them, since the export attributes are ignored on an already instantiated class.
+	*/
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Archetype const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Archetype const*, rfk::Allocator<Archetype const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Struct const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Struct const*, rfk::Allocator<Struct const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Enum const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Enum const*, rfk::Allocator<Enum const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<EnumValue const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<EnumValue const*, rfk::Allocator<EnumValue const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Field const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Field const*, rfk::Allocator<Field const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<StaticField const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<StaticField const*, rfk::Allocator<StaticField const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Method const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Method const*, rfk::Allocator<Method const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<StaticMethod const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<StaticMethod const*, rfk::Allocator<StaticMethod const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Function const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Function const*, rfk::Allocator<Function const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Variable const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Variable const*, rfk::Allocator<Variable const*>>);
+	REFUREKU_TEMPLATE_API(rfk::Allocator<Namespace const*>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<Namespace const*, rfk::Allocator<Namespace const*>>);
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Functions/FunctionBase.h"
 #include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
 #include "Refureku/TypeInfo/Functions/NonMemberFunction.h"
@@ -107,14 +108,13 @@ namespace rfk
 			*/
 			template <typename ReturnType, typename... ArgTypes>
 			ReturnType	internalInvoke(ArgTypes&&... args)	const;
+
+		friend internal::MemoryFootprintCollector;
 	};
 
 	/** Base implementation of getFunction, specialized for each reflected function. */
 	template <auto FuncPtr>
 	Function const* getFunction() noexcept;
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Function const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Function const*, rfk::Allocator<Function const*>>);
-
 	#include "Refureku/TypeInfo/Functions/Function.inl"
 }
\ No newline at end of file
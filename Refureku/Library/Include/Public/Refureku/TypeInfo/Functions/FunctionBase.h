@@ -10,6 +10,7 @@
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Functions/FunctionParameter.h"
 #include "Refureku/TypeInfo/Functions/ICallable.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
 
 namespace rfk
 {
@@ -193,6 +194,9 @@ namespace rfk
 			*			/!\ This method is called from template methods so it must be exported.
 			*/
 			RFK_NORETURN REFUREKU_API void	throwReturnTypeMismatchException()						const;
+
+		friend internal::MemoryFootprintCollector;
+		friend internal::ModulePatcher;
 	};
 
 	#include "Refureku/TypeInfo/Functions/FunctionBase.inl"
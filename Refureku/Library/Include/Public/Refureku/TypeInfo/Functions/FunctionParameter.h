@@ -35,5 +35,7 @@ namespace rfk
 			class FunctionParameterImpl;
 
 			RFK_GEN_GET_PIMPL(FunctionParameterImpl, Entity::getPimpl())
+
+		friend internal::MemoryFootprintCollector;
 	};
 }
\ No newline at end of file
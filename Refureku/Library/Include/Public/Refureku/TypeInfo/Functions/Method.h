@@ -10,6 +10,7 @@
 #include <type_traits>	//std::enable_if_v, std::is_const_v
 #include <cassert>
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/MethodFieldHelpers.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
@@ -282,10 +283,9 @@ namespace rfk
 			*	@param message Message forwarded to the exception.
 			*/
 			RFK_NORETURN REFUREKU_API void	throwConstViolationException()										const;
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Method const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Method const*, rfk::Allocator<Method const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Functions/Method.inl"
 }
\ No newline at end of file
@@ -55,12 +55,16 @@ ReturnType Method::MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invok
 template <typename ReturnType, typename... ArgTypes>
 ReturnType Method::internalInvoke(void* caller, ArgTypes&&... args) const
 {
+	RFK_INSTRUMENT_EVENT(this, Invocation);
+
 	return MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(*getInternalFunction(), caller, std::forward<ArgTypes>(args)...);
 }
 
 template <typename ReturnType, typename... ArgTypes>
 ReturnType Method::internalInvoke(void const* caller, ArgTypes&&... args) const
 {
+	RFK_INSTRUMENT_EVENT(this, Invocation);
+
 	return MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(*getInternalFunction(), caller, std::forward<ArgTypes>(args)...);
 }
 
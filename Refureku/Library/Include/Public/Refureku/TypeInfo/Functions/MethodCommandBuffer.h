@@ -0,0 +1,263 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>			//placement new
+#include <tuple>
+#include <cstddef>		//std::size_t, std::max_align_t, std::nullptr_t
+#include <utility>		//std::forward
+#include <type_traits>	//std::decay_t, std::is_same_v
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/TypeInfo/Functions/Method.h"
+#include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/TypeInfo/Functions/Function.h"
+
+namespace rfk
+{
+	//Forward declarations
+	namespace internal
+	{
+		class MethodCommandBufferImpl;
+	}
+
+	/**
+	*	Buffer recording calls to reflected methods and functions to execute them later, usually in batches on a single thread.
+	*	Each recording thread writes its calls to its own byte stream: the called function, the caller and the arguments stored by value.
+	*	Consecutive calls to the same function with the same argument types are grouped so that they are dispatched with a single indirect call.
+	*	Calls can be recorded from any thread, including while the buffer is executed.
+	*/
+	class MethodCommandBuffer final
+	{
+		public:
+			/**
+			*	@brief Call the commands of a group, then destroy them.
+			*
+			*	@param function	Function called by the commands.
+			*	@param commands	Pointer to the first command of the group.
+			*	@param count	Number of commands in the group.
+			*/
+			using Replayer			= void(*)(FunctionBase const& function, void* commands, std::size_t count);
+
+			/**
+			*	@brief Destroy the commands of a group without calling them.
+			*
+			*	@param commands	Pointer to the first command of the group.
+			*	@param count	Number of commands in the group.
+			*/
+			using Destroyer			= void(*)(void* commands, std::size_t count);
+
+			/**
+			*	@brief Check that the recorded return and argument types match a function signature.
+			*
+			*	@param function Function to check.
+			*
+			*	@return true if the types match the function signature, else false.
+			*/
+			using SignatureChecker	= bool(*)(FunctionBase const& function);
+
+			/**
+			*	@brief Construct a command in the byte stream memory.
+			*
+			*	@param memory	Memory receiving the command.
+			*	@param data		Data used to construct the command.
+			*/
+			using CommandConstructor	= void(*)(void* memory, void* data);
+
+			/**
+			*	@param blockSize Number of bytes allocated at once when a recording thread runs out of memory.
+			*/
+			REFUREKU_API MethodCommandBuffer(std::size_t blockSize = 64u * 1024u)	noexcept;
+			MethodCommandBuffer(MethodCommandBuffer const&)							= delete;
+			MethodCommandBuffer(MethodCommandBuffer&&)								= delete;
+			REFUREKU_API ~MethodCommandBuffer()										noexcept;
+
+			/**
+			*	@brief	Record a call to a method. The caller pointer is adjusted when the call is executed, like Method::invoke does.
+			*			The arguments are stored by value, so reference parameters refer to the stored copy when the call is executed.
+			*			**WARNING**: Template type deduction might record wrong types (int& instead of int for lvalues for example),
+			*			so it is recommended to explicitly specify all template types when recording the call.
+			*
+			*	@tparam ReturnType	Return type of the method. The returned value is discarded.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments.
+			*
+			*	@param method	Method to call. It must outlive the recorded call.
+			*	@param caller	Object instance calling the method. It must outlive the recorded call.
+			*	@param args		Arguments stored in the buffer.
+			*
+			*	@return true if the call was recorded, false if ReturnType and ArgTypes don't match the method signature or if the memory could not be allocated.
+			*
+			*	@exception Any exception potentially thrown when storing the arguments.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			bool				record(Method const& method, CallerType& caller, ArgTypes&&... args);
+
+			/**
+			*	@brief	Record a call to a method. The caller pointer is not adjusted, like Method::invokeUnsafe.
+			*			The arguments are stored by value, so reference parameters refer to the stored copy when the call is executed.
+			*			**WARNING**: Template type deduction might record wrong types (int& instead of int for lvalues for example),
+			*			so it is recommended to explicitly specify all template types when recording the call.
+			*
+			*	@tparam ReturnType	Return type of the method. The returned value is discarded.
+			*	@tparam... ArgTypes	Type of all arguments.
+			*
+			*	@param method	Method to call. It must outlive the recorded call.
+			*	@param caller	Object instance calling the method. It must outlive the recorded call.
+			*	@param args		Arguments stored in the buffer.
+			*
+			*	@return true if the call was recorded, false if ReturnType and ArgTypes don't match the method signature or if the memory could not be allocated.
+			*
+			*	@exception Any exception potentially thrown when storing the arguments.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			bool				recordUnsafe(Method const& method, void* caller, ArgTypes&&... args);
+
+			/**
+			*	@brief	Record a call to a static method.
+			*			The arguments are stored by value, so reference parameters refer to the stored copy when the call is executed.
+			*			**WARNING**: Template type deduction might record wrong types (int& instead of int for lvalues for example),
+			*			so it is recommended to explicitly specify all template types when recording the call.
+			*
+			*	@tparam ReturnType	Return type of the method. The returned value is discarded.
+			*	@tparam... ArgTypes	Type of all arguments.
+			*
+			*	@param method	Static method to call. It must outlive the recorded call.
+			*	@param args		Arguments stored in the buffer.
+			*
+			*	@return true if the call was recorded, false if ReturnType and ArgTypes don't match the method signature or if the memory could not be allocated.
+			*
+			*	@exception Any exception potentially thrown when storing the arguments.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			bool				record(StaticMethod const& method, ArgTypes&&... args);
+
+			/**
+			*	@brief	Record a call to a function.
+			*			The arguments are stored by value, so reference parameters refer to the stored copy when the call is executed.
+			*			**WARNING**: Template type deduction might record wrong types (int& instead of int for lvalues for example),
+			*			so it is recommended to explicitly specify all template types when recording the call.
+			*
+			*	@tparam ReturnType	Return type of the function. The returned value is discarded.
+			*	@tparam... ArgTypes	Type of all arguments.
+			*
+			*	@param function	Function to call. It must outlive the recorded call.
+			*	@param args		Arguments stored in the buffer.
+			*
+			*	@return true if the call was recorded, false if ReturnType and ArgTypes don't match the function signature or if the memory could not be allocated.
+			*
+			*	@exception Any exception potentially thrown when storing the arguments.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			bool				record(Function const& function, ArgTypes&&... args);
+
+			/**
+			*	@brief	Execute and remove the recorded calls.
+			*			The calls recorded by a thread are executed in their recording order, one recording thread after the other.
+			*			Calls recorded during the execution are kept for the next execution.
+			*
+			*	@return The number of executed calls.
+			*
+			*	@exception Any exception thrown by an executed call. The calls recorded by the same thread that were not executed yet are discarded.
+			*/
+			REFUREKU_API std::size_t	execute();
+
+			/**
+			*	@brief Remove the recorded calls without executing them. The buffer keeps its memory to record the next calls.
+			*/
+			REFUREKU_API void			clear()								noexcept;
+
+			/**
+			*	@brief Get the number of recorded calls waiting to be executed.
+			*
+			*	@return The number of recorded calls.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t				getCommandsCount()			const	noexcept;
+
+		private:
+			/**
+			*	Recorded call to a function, followed by the next commands of its group in the byte stream.
+			*
+			*	@tparam FunctionType	Type of the called function (Method, StaticMethod or Function).
+			*	@tparam CallerPointer	Pointer to the caller, void* if the caller pointer is not adjusted, std::nullptr_t for non-member functions.
+			*	@tparam ReturnType		Return type of the called function.
+			*	@tparam... ArgTypes		Type of all arguments.
+			*/
+			template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+			struct Command
+			{
+				/** Object instance calling the method, if any. */
+				CallerPointer						caller;
+
+				/** Stored arguments. */
+				std::tuple<std::decay_t<ArgTypes>...>	args;
+
+				template <typename... ForwardedArgTypes>
+				Command(CallerPointer caller, ForwardedArgTypes&&... forwardedArgs);
+
+				/**
+				*	@brief Call the function with the stored arguments.
+				*
+				*	@param function Function to call.
+				*/
+				void		call(FunctionType const& function);
+
+				static void	replay(FunctionBase const& function, void* commands, std::size_t count);
+				static void	destroy(void* commands, std::size_t count)	noexcept;
+				static bool	checkSignature(FunctionBase const& function)	noexcept;
+			};
+
+			/** Pointer to MethodCommandBuffer implementation. */
+			Pimpl<internal::MethodCommandBufferImpl> _pimpl;
+
+			/**
+			*	@brief	Record a command in the byte stream of the calling thread.
+			*
+			*	@tparam CommandType Type of the recorded command.
+			*
+			*	@param function		Function called by the command.
+			*	@param caller		Object instance calling the function, if any.
+			*	@param args			Arguments stored in the command.
+			*
+			*	@return true if the command was recorded, else false.
+			*/
+			template <typename CommandType, typename CallerPointer, typename... ForwardedArgTypes>
+			bool						recordCommand(FunctionBase const&	function,
+													  CallerPointer			caller,
+													  ForwardedArgTypes&&...	args);
+
+			/**
+			*	@brief	Construct a command in the byte stream of the calling thread.
+			*			The command is appended to the last group of the stream if it calls the same function with the same replayer,
+			*			otherwise a new group is started once the signature is checked.
+			*
+			*	@param function			Function called by the command.
+			*	@param replayer			Replayer of the command type.
+			*	@param destroyer		Destroyer of the command type.
+			*	@param signatureChecker	Signature checker of the command type.
+			*	@param commandSize		Size of the command in bytes.
+			*	@param constructor		Function constructing the command in the stream memory.
+			*	@param constructorData	Data forwarded to the constructor.
+			*
+			*	@return true if the command was constructed, false if the signature doesn't match or if the memory could not be allocated.
+			*
+			*	@exception Any exception thrown by the constructor. The command is not added to the stream in that case.
+			*/
+			REFUREKU_API bool			pushCommand(FunctionBase const&	function,
+													Replayer			replayer,
+													Destroyer			destroyer,
+													SignatureChecker	signatureChecker,
+													std::size_t			commandSize,
+													CommandConstructor	constructor,
+													void*				constructorData);
+	};
+
+	#include "Refureku/TypeInfo/Functions/MethodCommandBuffer.inl"
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+////////////////// Command
+
+template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+template <typename... ForwardedArgTypes>
+MethodCommandBuffer::Command<FunctionType, CallerPointer, ReturnType, ArgTypes...>::Command(CallerPointer caller, ForwardedArgTypes&&... forwardedArgs):
+	caller{caller},
+	args{std::forward<ForwardedArgTypes>(forwardedArgs)...}
+{
+}
+
+template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+void MethodCommandBuffer::Command<FunctionType, CallerPointer, ReturnType, ArgTypes...>::call(FunctionType const& function)
+{
+	std::apply([this, &function](std::decay_t<ArgTypes>&... storedArgs)
+			   {
+				   if constexpr (std::is_same_v<CallerPointer, std::nullptr_t>)
+				   {
+					   function.template invoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(storedArgs)...);
+				   }
+				   else if constexpr (std::is_same_v<CallerPointer, void*>)
+				   {
+					   function.template invokeUnsafe<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(storedArgs)...);
+				   }
+				   else
+				   {
+					   function.template invoke<ReturnType, std::remove_pointer_t<CallerPointer>, ArgTypes...>(*caller, std::forward<ArgTypes>(storedArgs)...);
+				   }
+			   }, args);
+}
+
+template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+void MethodCommandBuffer::Command<FunctionType, CallerPointer, ReturnType, ArgTypes...>::replay(FunctionBase const& function, void* commands, std::size_t count)
+{
+	//Destroy the commands which were not called if a call throws, including the throwing one
+	struct RemainingCommandsGuard
+	{
+		Command*	current;
+		Command*	end;
+
+		~RemainingCommandsGuard()
+		{
+			for (; current != end; current++)
+			{
+				current->~Command();
+			}
+		}
+	} guard{static_cast<Command*>(commands), static_cast<Command*>(commands) + count};
+
+	FunctionType const& calledFunction = static_cast<FunctionType const&>(function);
+
+	for (; guard.current != guard.end; guard.current++)
+	{
+		guard.current->call(calledFunction);
+		guard.current->~Command();
+	}
+}
+
+template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+void MethodCommandBuffer::Command<FunctionType, CallerPointer, ReturnType, ArgTypes...>::destroy(void* commands, std::size_t count) noexcept
+{
+	Command* command = static_cast<Command*>(commands);
+
+	for (std::size_t i = 0u; i < count; i++)
+	{
+		command[i].~Command();
+	}
+}
+
+template <typename FunctionType, typename CallerPointer, typename ReturnType, typename... ArgTypes>
+bool MethodCommandBuffer::Command<FunctionType, CallerPointer, ReturnType, ArgTypes...>::checkSignature(FunctionBase const& function) noexcept
+{
+	return function.hasSameSignature<ReturnType, ArgTypes...>();
+}
+
+////////////////// MethodCommandBuffer
+
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+bool MethodCommandBuffer::record(Method const& method, CallerType& caller, ArgTypes&&... args)
+{
+	return recordCommand<Command<Method, CallerType*, ReturnType, ArgTypes...>>(method, &caller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool MethodCommandBuffer::recordUnsafe(Method const& method, void* caller, ArgTypes&&... args)
+{
+	return recordCommand<Command<Method, void*, ReturnType, ArgTypes...>>(method, caller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool MethodCommandBuffer::record(StaticMethod const& method, ArgTypes&&... args)
+{
+	return recordCommand<Command<StaticMethod, std::nullptr_t, ReturnType, ArgTypes...>>(method, nullptr, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool MethodCommandBuffer::record(Function const& function, ArgTypes&&... args)
+{
+	return recordCommand<Command<Function, std::nullptr_t, ReturnType, ArgTypes...>>(function, nullptr, std::forward<ArgTypes>(args)...);
+}
+
+template <typename CommandType, typename CallerPointer, typename... ForwardedArgTypes>
+bool MethodCommandBuffer::recordCommand(FunctionBase const& function, CallerPointer caller, ForwardedArgTypes&&... args)
+{
+	static_assert(alignof(CommandType) <= alignof(std::max_align_t), "Over-aligned arguments can't be recorded in a MethodCommandBuffer.");
+
+	//The arguments are forwarded as references until the command is constructed in the stream
+	auto forwardedArgs = std::forward_as_tuple(caller, std::forward<ForwardedArgTypes>(args)...);
+
+	return pushCommand(function, &CommandType::replay, &CommandType::destroy, &CommandType::checkSignature, sizeof(CommandType),
+					   [](void* memory, void* data)
+					   {
+						   std::apply([memory](auto&&... commandArgs)
+									  {
+										  new (memory) CommandType(std::forward<decltype(commandArgs)>(commandArgs)...);
+									  }, std::move(*static_cast<decltype(forwardedArgs)*>(data)));
+					   }, &forwardedArgs);
+}
\ No newline at end of file
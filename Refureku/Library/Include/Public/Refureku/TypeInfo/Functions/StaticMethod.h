@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Functions/MethodBase.h"
 #include "Refureku/TypeInfo/Functions/NonMemberFunction.h"
 
@@ -84,10 +85,9 @@ namespace rfk
 			*/
 			template <typename ReturnType, typename... ArgTypes>
 			ReturnType	internalInvoke(ArgTypes&&... args) const;
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<StaticMethod const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<StaticMethod const*, rfk::Allocator<StaticMethod const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Functions/StaticMethod.inl"
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 template <typename ReturnType, typename... ArgTypes>
 ReturnType StaticMethod::internalInvoke(ArgTypes&&... args) const
 {
+	RFK_INSTRUMENT_EVENT(this, Invocation);
+
 	return reinterpret_cast<NonMemberFunction<ReturnType(ArgTypes...)>*>(getInternalFunction())->operator()(std::forward<ArgTypes>(args)...);
 }
 
@@ -0,0 +1,131 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/Containers/Vector.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Entity;
+
+	/** Kinds of events counted by the instrumentation. */
+	enum class EInstrumentationEvent : uint8
+	{
+		/** An entity was found by name. */
+		NameLookup = 0u,
+
+		/** An entity was found by id. */
+		IdLookup,
+
+		/** An instance was cast to the entity (the entity is the target archetype). */
+		Cast,
+
+		/** The entity (a function, a method or a static method) was invoked with invoke or checkedInvoke. */
+		Invocation,
+
+		/** A lookup in the entity (or at file level if the entity is nullptr) didn't find anything. */
+		FailedLookup,
+
+		/** Number of event kinds. */
+		Count
+	};
+
+	/** Instrumentation counters of a single entity, retrieved with Database::getHottestLookups. */
+	struct InstrumentationRecord
+	{
+		/** Counted entity. nullptr accounts the failed file level and id lookups performed on the database. */
+		Entity const*	entity			= nullptr;
+
+		/** Number of times the entity was found by name. */
+		std::size_t		nameLookups		= 0u;
+
+		/** Number of times the entity was found by id. */
+		std::size_t		idLookups		= 0u;
+
+		/** Number of instance casts targeting the entity. */
+		std::size_t		casts			= 0u;
+
+		/** Number of invocations of the entity. */
+		std::size_t		invocations		= 0u;
+
+		/** Number of lookups performed in the entity which didn't find anything. */
+		std::size_t		failedLookups	= 0u;
+
+		/**
+		*	@brief Get the counter matching an event kind.
+		*
+		*	@param event The event kind. Must not be EInstrumentationEvent::Count.
+		*
+		*	@return The counter of the event kind.
+		*/
+		RFK_NODISCARD REFUREKU_API std::size_t&	getCounter(EInstrumentationEvent event)			noexcept;
+		RFK_NODISCARD REFUREKU_API std::size_t	getCounter(EInstrumentationEvent event)	const	noexcept;
+
+		/**
+		*	@brief Get the sum of all counters.
+		*
+		*	@return The total number of events counted for the entity.
+		*/
+		RFK_NODISCARD REFUREKU_API std::size_t	getTotal()								const	noexcept;
+	};
+
+	namespace internal
+	{
+		/**
+		*	@brief	Count an event for an entity in the counters of the calling thread.
+		*			Does nothing if Refureku was built without RFK_INSTRUMENTATION.
+		*
+		*	@param entity	The entity the event is counted for.
+		*	@param event	The event kind. Must not be EInstrumentationEvent::Count.
+		*/
+		REFUREKU_API void	recordInstrumentationEvent(Entity const*			entity,
+													   EInstrumentationEvent	event)	noexcept;
+
+		/**
+		*	@brief Count a lookup: a hit for the found entity, or a failed lookup for the inspected scope.
+		*
+		*	@param scope	The entity the lookup was performed in, nullptr for a file level or an id lookup.
+		*	@param event	The event counted if the lookup found an entity.
+		*	@param result	The result of the lookup.
+		*
+		*	@return result.
+		*/
+		template <typename EntityType>
+		EntityType const*	recordInstrumentedLookup(Entity const*			scope,
+													 EInstrumentationEvent	event,
+													 EntityType const*		result)	noexcept;
+	}
+
+	REFUREKU_TEMPLATE_API(rfk::Allocator<InstrumentationRecord>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<InstrumentationRecord, rfk::Allocator<InstrumentationRecord>>);
+
+	#include "Refureku/TypeInfo/Instrumentation.inl"
+}
+
+/**
+*	Instrumentation points used by the library and by the inline invocation code.
+*	They expand to the instrumented expression alone when RFK_INSTRUMENTATION is 0.
+*/
+#if RFK_INSTRUMENTATION
+
+	#define RFK_INSTRUMENT_NAME_LOOKUP(scope, result)	rfk::internal::recordInstrumentedLookup(scope, rfk::EInstrumentationEvent::NameLookup, result)
+	#define RFK_INSTRUMENT_ID_LOOKUP(result)			rfk::internal::recordInstrumentedLookup(nullptr, rfk::EInstrumentationEvent::IdLookup, result)
+	#define RFK_INSTRUMENT_EVENT(entity, event)			rfk::internal::recordInstrumentationEvent(entity, rfk::EInstrumentationEvent::event)
+
+#else
+
+	#define RFK_INSTRUMENT_NAME_LOOKUP(scope, result)	(result)
+	#define RFK_INSTRUMENT_ID_LOOKUP(result)			(result)
+	#define RFK_INSTRUMENT_EVENT(entity, event)			((void)0)
+
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename EntityType>
+EntityType const* internal::recordInstrumentedLookup(Entity const* scope, EInstrumentationEvent event, EntityType const* result) noexcept
+{
+	if (result != nullptr)
+	{
+		recordInstrumentationEvent(result, event);
+	}
+	else
+	{
+		recordInstrumentationEvent(scope, EInstrumentationEvent::FailedLookup);
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	/** Number of items and number of bytes accounted for a single category of reflection data. */
+	struct MemoryFootprintEntry
+	{
+		/** Number of accounted items. */
+		std::size_t	count	= 0u;
+
+		/** Number of bytes used by the accounted items. */
+		std::size_t	bytes	= 0u;
+	};
+
+	/**
+	*	Estimation of the memory used by reflection data, computed by Database::computeMemoryFootprint or ModuleHandle::computeMemoryFootprint.
+	*	Entries never account the same bytes twice, so the total footprint is the sum of all entries.
+	*	Dynamic allocations are estimated from the container capacities, allocator bookkeeping is not accounted.
+	*	Callables wrapped by functions and methods as well as property instances live in the generated code and are not accounted either.
+	*/
+	struct MemoryFootprint
+	{
+		/** Namespace objects and their implementation. */
+		MemoryFootprintEntry	namespaces;
+
+		/** Namespace fragment objects and their implementation. */
+		MemoryFootprintEntry	namespaceFragments;
+
+		/** Struct and class objects and their implementation, including class templates and class template instantiations. */
+		MemoryFootprintEntry	structs;
+
+		/** Enum objects and their implementation. */
+		MemoryFootprintEntry	enums;
+
+		/** Enum value objects and their implementation. */
+		MemoryFootprintEntry	enumValues;
+
+		/** Fundamental archetype objects and their implementation. */
+		MemoryFootprintEntry	fundamentalArchetypes;
+
+		/** Variable objects and their implementation. */
+		MemoryFootprintEntry	variables;
+
+		/** Field and static field objects and their implementation. */
+		MemoryFootprintEntry	fields;
+
+		/** Function objects and their implementation. */
+		MemoryFootprintEntry	functions;
+
+		/** Method and static method objects and their implementation. */
+		MemoryFootprintEntry	methods;
+
+		/** Function and method parameters, including the unused capacity of the parameter lists. */
+		MemoryFootprintEntry	parameters;
+
+		/** Entity names. All names are counted, but only the names too long for the small string buffer allocate bytes. */
+		MemoryFootprintEntry	names;
+
+		/** Property lists of the entities. The count is the number of attached properties. */
+		MemoryFootprintEntry	properties;
+
+		/** Distinct types referenced by variables, fields, functions, methods and parameters, including their heap-allocated type parts. */
+		MemoryFootprintEntry	types;
+
+		/** Struct containers (parents, subclasses, nested archetypes, fields, methods, flat lists, instantiators and template data) excluding hash buckets. */
+		MemoryFootprintEntry	structContainers;
+
+		/** Enum value lists and lookup tables. */
+		MemoryFootprintEntry	enumContainers;
+
+		/** Namespace and namespace fragment nested entity containers excluding hash buckets. */
+		MemoryFootprintEntry	namespaceContainers;
+
+		/** Database and module registration tables and the database name index, excluding hash buckets. */
+		MemoryFootprintEntry	registrationTables;
+
+		/** Bucket arrays of all the accounted hash tables. The count is the number of buckets. */
+		MemoryFootprintEntry	hashBuckets;
+
+		/**
+		*	@brief Get the sum of the bytes of all entries.
+		*
+		*	@return The total number of accounted bytes.
+		*/
+		RFK_NODISCARD REFUREKU_API std::size_t	getTotalBytes()								const	noexcept;
+
+		/**
+		*	@brief Add the counts and bytes of another footprint to this footprint, entry by entry.
+		*
+		*	@param other The footprint to add.
+		*
+		*	@return *this.
+		*/
+		REFUREKU_API MemoryFootprint&			operator+=(MemoryFootprint const& other)			noexcept;
+	};
+}
\ No newline at end of file
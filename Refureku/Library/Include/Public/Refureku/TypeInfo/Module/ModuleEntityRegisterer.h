@@ -0,0 +1,35 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/TypeInfo/Module/ModuleHandle.h"
+
+namespace rfk
+{
+	/**
+	*	Registerer used by the generated code instead of ArchetypeRegisterer, DefaultEntityRegisterer and NamespaceFragmentRegisterer
+	*	when the entities are registered through a module.
+	*	The entity is only added to the module registration table: the actual database registration happens when the module is loaded.
+	*/
+	class ModuleEntityRegisterer final
+	{
+		private:
+			/** Module the entity is registered to. */
+			ModuleHandle&	_module;
+
+			/** Registered file level entity. */
+			Entity const&	_registeredEntity;
+
+		public:
+			REFUREKU_API ModuleEntityRegisterer(ModuleHandle&	module,
+												Entity const&	entity)		noexcept;
+			ModuleEntityRegisterer(ModuleEntityRegisterer const&)			= delete;
+			ModuleEntityRegisterer(ModuleEntityRegisterer&&)				= delete;
+			REFUREKU_API ~ModuleEntityRegisterer()							noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/TypeInfo/MemoryFootprint.h"
+#include "Refureku/TypeInfo/Module/ModuleReloadReport.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Entity;
+
+	namespace internal
+	{
+		class ModuleHandleImpl;
+	}
+
+	/**
+	*	A module handle gathers all the file level entities of a module (typically a shared library / plugin)
+	*	in a single registration table.
+	*	The whole table is registered to the database in one pass when the module is loaded,
+	*	and unregistered in one pass when the module is unloaded.
+	*/
+	class ModuleHandle final
+	{
+		public:
+			REFUREKU_API ModuleHandle(char const* name)	noexcept;
+			ModuleHandle(ModuleHandle const&)			= delete;
+			ModuleHandle(ModuleHandle&&)				= delete;
+			REFUREKU_API ~ModuleHandle()				noexcept;
+
+			/**
+			*	@brief Reserve the module registration table to hold at least the provided number of entities.
+			* 
+			*	@param entitiesCount Number of file level entities to reserve memory for.
+			*/
+			REFUREKU_API void			reserve(std::size_t entitiesCount)						noexcept;
+
+			/**
+			*	@brief	Add file level entities to the module registration table.
+			*			If the module is already loaded, the entities are registered to the database right away.
+			* 
+			*	@param entities			Pointer to the first file level entity to add.
+			*	@param entitiesCount	Number of file level entities to add.
+			*/
+			REFUREKU_API void			addEntities(Entity const* const*	entities,
+													std::size_t				entitiesCount)		noexcept;
+
+			/**
+			*	@brief	Remove file level entities from the module registration table.
+			*			If the module is loaded, the entities are unregistered from the database.
+			*			Removing entities in the reverse order they were added is the cheapest.
+			* 
+			*	@param entities			Pointer to the first file level entity to remove.
+			*	@param entitiesCount	Number of file level entities to remove.
+			*/
+			REFUREKU_API void			removeEntities(Entity const* const*	entities,
+													   std::size_t			entitiesCount)		noexcept;
+
+			/**
+			*	@brief	Register all the entities of the module registration table to the database in a single pass.
+			*			The database is reserved once for the whole table.
+			*			Entities that were unloaded by a previous call to unload are not registered again.
+			*			If the module is already loaded, this method has no effect.
+			*/
+			REFUREKU_API void			load()													noexcept;
+
+			/**
+			*	@brief	Unregister all the entities of the module from the database in a single pass.
+			*			Namespace fragments of the module are unmerged from their namespace.
+			*			If the module is not loaded, this method has no effect.
+			*/
+			REFUREKU_API void			unload()												noexcept;
+
+			/**
+			*	@brief	Hot reload the module with a newer build of the same module, typically a copy of the rebuilt shared library loaded next to the original one.
+			*			The entities of this module are patched with the entities of the newer build with the same id, so handles to them remain valid:
+			*			functions, methods and static methods atomically switch to the code of the newer build if their signature didn't change.
+			*			A struct or class whose size, alignment, field types or field offsets changed is incompatible: its methods are not patched,
+			*			nor are the functions taking or returning it, since the newer code would access existing instances at the wrong offsets.
+			*			Variables and static fields keep their state in this module, and virtual methods keep dispatching through the virtual table of each instance.
+			*			The previous reload of this module is reverted first.
+			*			The patches are reverted when the entities of the newer build are removed, so the newer build can be unloaded from memory at any time
+			*			as long as no thread is running its code.
+			* 
+			*	@param newModule Module of the newer build. It must not be loaded since its entities have the same ids as the entities of this module.
+			* 
+			*	@return The summary of the patched entities.
+			*/
+			REFUREKU_API ModuleReloadReport	reload(ModuleHandle& newModule)					noexcept;
+
+			/**
+			*	@brief	Restore the entities patched by the last reload of this module, so that they run the code of this module again.
+			*			If the module is not reloaded, this method has no effect.
+			*/
+			REFUREKU_API void			revertReload()											noexcept;
+
+			/**
+			*	@brief Check whether the module is currently reloaded with a newer build.
+			* 
+			*	@return true if the module is reloaded, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				bool					isReloaded()									const	noexcept;
+
+			/**
+			*	@brief Check whether the module entities are currently registered to the database or not.
+			* 
+			*	@return true if the module is loaded, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				bool					isLoaded()										const	noexcept;
+
+			/**
+			*	@brief Get the name of the module.
+			* 
+			*	@return The name of the module.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				char const*				getName()										const	noexcept;
+
+			/**
+			*	@brief Get the number of file level entities in the module registration table.
+			* 
+			*	@return The number of file level entities in the module registration table.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t				getEntitiesCount()								const	noexcept;
+
+			/**
+			*	@brief	Estimate the memory used by the module registration table and by all the entities of the module, by category.
+			*			Entities owned by the database, like the namespaces the module fragments are merged to, are not accounted.
+			* 
+			*	@return The memory footprint of the module.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				MemoryFootprint			computeMemoryFootprint()						const;
+
+		private:
+			/** Pointer to ModuleHandle implementation. */
+			Pimpl<internal::ModuleHandleImpl> _pimpl;
+	};
+}
+
+/**
+*	Declare the accessor to the handle of a module.
+*	Generated code emits this declaration when entities are registered through a module.
+*/
+#define RFK_DECLARE_MODULE_HANDLE(ModuleName) rfk::ModuleHandle& rfk_getModuleHandle_##ModuleName() noexcept;
+
+/**
+*	Define the accessor to the handle of a module. Must be used in exactly one source file of the module.
+*	The handle is constructed the first time it is accessed, so it is always available to the module registerers.
+*/
+#define RFK_DEFINE_MODULE_HANDLE(ModuleName)										\
+	rfk::ModuleHandle& rfk_getModuleHandle_##ModuleName() noexcept					\
+	{																				\
+		static rfk::ModuleHandle handle(#ModuleName);								\
+		return handle;																\
+	}
+
+/**
+*	Get the handle of a module previously declared with RFK_DECLARE_MODULE_HANDLE or defined with RFK_DEFINE_MODULE_HANDLE.
+*/
+#define RFK_MODULE_HANDLE(ModuleName) rfk_getModuleHandle_##ModuleName()
\ No newline at end of file
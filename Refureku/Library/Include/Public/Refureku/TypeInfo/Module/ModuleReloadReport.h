@@ -0,0 +1,32 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+namespace rfk
+{
+	/** Summary of the entities patched by ModuleHandle::reload. */
+	struct ModuleReloadReport
+	{
+		/** Number of functions, methods and static methods now calling the code of the reloaded module. */
+		std::size_t	patchedFunctionsCount		= 0u;
+
+		/** Number of fields of the structs and classes found with the same layout in the reloaded module. */
+		std::size_t	patchedFieldsCount			= 0u;
+
+		/**
+		*	Number of entities left unpatched because their counterpart in the reloaded module is incompatible:
+		*	functions and methods with a different signature, structs and classes with a different layout.
+		*/
+		std::size_t	incompatibleEntitiesCount	= 0u;
+
+		/** Number of functions, methods, structs and classes left unpatched because the reloaded module doesn't contain them anymore. */
+		std::size_t	missingEntitiesCount		= 0u;
+	};
+}
\ No newline at end of file
@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Variables/EVarFlags.h"
 #include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
 #include "Refureku/TypeInfo/Functions/FunctionHelper.h"
+#include "Refureku/Containers/Span.h"
+#include "Refureku/Containers/FilteredView.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
 
 namespace rfk
 {
@@ -86,6 +90,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t								getNamespacesCount()												const	noexcept;
 
+			/**
+			*	@brief	Get a span over all nested namespaces.
+			*			The span is invalidated when a namespace is added to or removed from this namespace.
+			* 
+			*	@return A span over all nested namespaces.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Namespace const* const>	getNamespacesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first nested namespace satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid namespace.
+			* 
+			*	@return The first found namespace satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD Namespace const*		getNamespaceByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested namespaces satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid namespace.
+			* 
+			*	@return All nested namespaces satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD Vector<Namespace const*>	getNamespacesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested namespaces.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Namespace const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Namespace>>
+			bool							foreachNamespace(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the namespaces in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a namespace is added to this namespace.
+			*
+			*	@param predicate Callable taking a Namespace const& and returning true for a valid namespace.
+			*
+			*	@return A view over the namespaces satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Namespace>>
+			RFK_NODISCARD auto				queryNamespaces(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a struct from this namespace.
 			*	
@@ -135,6 +198,57 @@ namespace rfk
 			REFUREKU_API bool										foreachStruct(Visitor<Struct>	visitor,
 																				  void*				userData)							const;
 
+			/**
+			*	@brief	Retrieve the first nested struct satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Struct const& and returning true for a valid struct.
+			* 
+			*	@return The first found struct satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD Struct const*		getStructByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested structs satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Struct const& and returning true for a valid struct.
+			* 
+			*	@return All nested structs satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD Vector<Struct const*>	getStructsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested structs.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Struct const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Struct>>
+			bool							foreachStruct(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the structs in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a struct is added to this namespace.
+			*
+			*	@param predicate Callable taking a Struct const& and returning true for a valid struct.
+			*
+			*	@return A view over the structs satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Struct>>
+			RFK_NODISCARD auto				queryStructs(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a class from this namespace.
 			*	
@@ -184,6 +298,57 @@ namespace rfk
 			REFUREKU_API bool										foreachClass(Visitor<Class>	visitor,
 																				  void*			userData)								const;
 
+			/**
+			*	@brief	Retrieve the first nested class satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Class const& and returning true for a valid class.
+			* 
+			*	@return The first found class satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD Class const*		getClassByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested classes satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Class const& and returning true for a valid class.
+			* 
+			*	@return All nested classes satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD Vector<Class const*>	getClassesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested classes.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Class const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Class>>
+			bool							foreachClass(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the classs in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a class is added to this namespace.
+			*
+			*	@param predicate Callable taking a Class const& and returning true for a valid class.
+			*
+			*	@return A view over the classs satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Class>>
+			RFK_NODISCARD auto				queryClasses(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve an enum from this namespace.
 			*
@@ -233,6 +398,57 @@ namespace rfk
 			REFUREKU_API bool										foreachEnum(Visitor<Enum>	visitor,
 																				 void*			userData)								const;
 
+			/**
+			*	@brief	Retrieve the first nested enum satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking an Enum const& and returning true for a valid enum.
+			* 
+			*	@return The first found enum satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD Enum const*		getEnumByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested enums satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking an Enum const& and returning true for a valid enum.
+			* 
+			*	@return All nested enums satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD Vector<Enum const*>	getEnumsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested enums.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking an Enum const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Enum>>
+			bool							foreachEnum(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the enums in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when an enum is added to this namespace.
+			*
+			*	@param predicate Callable taking an Enum const& and returning true for a valid enum.
+			*
+			*	@return A view over the enums satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Enum>>
+			RFK_NODISCARD auto				queryEnums(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Execute the given visitor on all nested archetypes.
 			* 
@@ -254,6 +470,27 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t								getArchetypesCount()												const	noexcept;
 
+			/**
+			*	@brief	Get a span over all nested archetypes.
+			*			The span is invalidated when an archetype is added to or removed from this namespace.
+			* 
+			*	@return A span over all nested archetypes.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Archetype const* const>	getArchetypesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Execute the given visitor on all nested archetypes.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking an Archetype const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Archetype>>
+			bool							foreachArchetype(Visitor&& visitor)				const;
+
 			/**
 			*	@brief Retrieve a variable from this namespace.
 			*	
@@ -313,6 +550,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t								getVariablesCount()													const	noexcept;
 
+			/**
+			*	@brief	Get a span over all nested variables.
+			*			The span is invalidated when a variable is added to or removed from this namespace.
+			* 
+			*	@return A span over all nested variables.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Variable const* const>	getVariablesSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first nested variable satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Variable const& and returning true for a valid variable.
+			* 
+			*	@return The first found variable satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD Variable const*		getVariableByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested variables satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Variable const& and returning true for a valid variable.
+			* 
+			*	@return All nested variables satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD Vector<Variable const*>	getVariablesByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested variables.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Variable const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Variable>>
+			bool							foreachVariable(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the variables in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a variable is added to this namespace.
+			*
+			*	@param predicate Callable taking a Variable const& and returning true for a valid variable.
+			*
+			*	@return A view over the variables satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Variable>>
+			RFK_NODISCARD auto				queryVariables(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Retrieve a function with a given name and signature from this namespace.
 			*	
@@ -397,6 +693,65 @@ namespace rfk
 			*/
 			REFUREKU_API std::size_t								getFunctionsCount()													const	noexcept;
 
+			/**
+			*	@brief	Get a span over all nested functions.
+			*			The span is invalidated when a function is added to or removed from this namespace.
+			* 
+			*	@return A span over all nested functions.
+			*/
+			RFK_NODISCARD REFUREKU_API Span<Function const* const>	getFunctionsSpan()			const	noexcept;
+
+			/**
+			*	@brief	Retrieve the first nested function satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Function const& and returning true for a valid function.
+			* 
+			*	@return The first found function satisfying the predicate if any, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD Function const*		getFunctionByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Retrieve all nested functions satisfying the provided predicate.
+			*			Header-only overload: the predicate is called directly, so it can be inlined.
+			*	
+			*	@param predicate Callable taking a Function const& and returning true for a valid function.
+			* 
+			*	@return All nested functions satisfying the provided predicate.
+			* 
+			*	@exception Any exception potentially thrown from the provided predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD Vector<Function const*>	getFunctionsByPredicate(Predicate&& predicate)		const;
+
+			/**
+			*	@brief	Execute the given visitor on all nested functions.
+			*			Header-only overload: the visitor is called directly, so it can be inlined.
+			* 
+			*	@param visitor Callable taking a Function const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Function>>
+			bool							foreachFunction(Visitor&& visitor)				const;
+
+			/**
+			*	@brief	Get a lazy view over the functions in this namespace satisfying the provided predicate.
+			*			The predicate is evaluated while iterating on the view, so no memory is allocated.
+			*			The view is invalidated when a function is added to this namespace.
+			*
+			*	@param predicate Callable taking a Function const& and returning true for a valid function.
+			*
+			*	@return A view over the functions satisfying the predicate.
+			*/
+			template <typename Predicate, typename = internal::EnableIfCallableWith<Predicate, Function>>
+			RFK_NODISCARD auto				queryFunctions(Predicate&& predicate)				const;
+
 			/**
 			*	@brief Add a nested namespace to this namespace.
 			* 
@@ -453,15 +808,36 @@ namespace rfk
 			*/
 			REFUREKU_API void										removeFunction(Function const& function)									noexcept;
 
+			/**
+			*	@brief	Add a batch of nested entities of each kind to this namespace.
+			*			Used to register all the entities of a namespace fragment at once.
+			* 
+			*	@param namespaces		Pointer to the first namespace to add.
+			*	@param namespacesCount	Number of namespaces to add.
+			*	@param archetypes		Pointer to the first archetype to add.
+			*	@param archetypesCount	Number of archetypes to add.
+			*	@param variables		Pointer to the first variable to add.
+			*	@param variablesCount	Number of variables to add.
+			*	@param functions		Pointer to the first function to add.
+			*	@param functionsCount	Number of functions to add.
+			*/
+			REFUREKU_INTERNAL void									addNestedEntities(Namespace const* const*	namespaces,
+																					  std::size_t				namespacesCount,
+																					  Archetype const* const*	archetypes,
+																					  std::size_t				archetypesCount,
+																					  Variable const* const*	variables,
+																					  std::size_t				variablesCount,
+																					  Function const* const*	functions,
+																					  std::size_t				functionsCount)		noexcept;
+
 		private:
 			//Forward declaration
 			class NamespaceImpl;
 
 			RFK_GEN_GET_PIMPL(NamespaceImpl, Entity::getPimpl())
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Namespace const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Namespace const*, rfk::Allocator<Namespace const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Namespace/Namespace.inl"
 }
\ No newline at end of file
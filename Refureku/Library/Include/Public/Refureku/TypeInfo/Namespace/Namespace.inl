@@ -23,4 +23,202 @@ Function const* Namespace::getFunctionByName(char const* name, EFunctionFlags fl
 															  func.hasSameName(userData.name) &&
 															  internal::FunctionHelper<FunctionSignature>::hasSameSignature(func);
 													  }, &data) : nullptr;
+}
+
+template <typename Predicate, typename>
+Namespace const* Namespace::getNamespaceByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Namespace>(getNamespacesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Namespace const*> Namespace::getNamespacesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Namespace>(getNamespacesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachNamespace(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getNamespacesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryNamespaces(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Namespace, Namespace const* const, PredicateType>(getNamespacesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Struct const* Namespace::getStructByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Struct>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															{
+																return archetype.getKind() == EEntityKind::Struct && predicate(static_cast<Struct const&>(archetype));
+															});
+}
+
+template <typename Predicate, typename>
+Vector<Struct const*> Namespace::getStructsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Struct>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															 {
+																 return archetype.getKind() == EEntityKind::Struct && predicate(static_cast<Struct const&>(archetype));
+															 });
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachStruct(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getArchetypesSpan(), [&visitor](auto const& archetype)
+											{
+												return (archetype.getKind() == EEntityKind::Struct) ? visitor(static_cast<Struct const&>(archetype)) : true;
+											});
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryStructs(Predicate&& predicate) const
+{
+	auto filter = [predicate = std::forward<Predicate>(predicate)](auto const& archetype)
+	{
+		return archetype.getKind() == EEntityKind::Struct && predicate(static_cast<Struct const&>(archetype));
+	};
+
+	return FilteredView<Struct, Archetype const* const, decltype(filter)>(getArchetypesSpan(), std::move(filter));
+}
+
+template <typename Predicate, typename>
+Class const* Namespace::getClassByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Class>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															{
+																return archetype.getKind() == EEntityKind::Class && predicate(static_cast<Class const&>(archetype));
+															});
+}
+
+template <typename Predicate, typename>
+Vector<Class const*> Namespace::getClassesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Class>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															 {
+																 return archetype.getKind() == EEntityKind::Class && predicate(static_cast<Class const&>(archetype));
+															 });
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachClass(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getArchetypesSpan(), [&visitor](auto const& archetype)
+											{
+												return (archetype.getKind() == EEntityKind::Class) ? visitor(static_cast<Class const&>(archetype)) : true;
+											});
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryClasses(Predicate&& predicate) const
+{
+	auto filter = [predicate = std::forward<Predicate>(predicate)](auto const& archetype)
+	{
+		return archetype.getKind() == EEntityKind::Class && predicate(static_cast<Class const&>(archetype));
+	};
+
+	return FilteredView<Class, Archetype const* const, decltype(filter)>(getArchetypesSpan(), std::move(filter));
+}
+
+template <typename Predicate, typename>
+Enum const* Namespace::getEnumByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Enum>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															{
+																return archetype.getKind() == EEntityKind::Enum && predicate(static_cast<Enum const&>(archetype));
+															});
+}
+
+template <typename Predicate, typename>
+Vector<Enum const*> Namespace::getEnumsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Enum>(getArchetypesSpan(), [&predicate](auto const& archetype)
+															 {
+																 return archetype.getKind() == EEntityKind::Enum && predicate(static_cast<Enum const&>(archetype));
+															 });
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachEnum(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getArchetypesSpan(), [&visitor](auto const& archetype)
+											{
+												return (archetype.getKind() == EEntityKind::Enum) ? visitor(static_cast<Enum const&>(archetype)) : true;
+											});
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryEnums(Predicate&& predicate) const
+{
+	auto filter = [predicate = std::forward<Predicate>(predicate)](auto const& archetype)
+	{
+		return archetype.getKind() == EEntityKind::Enum && predicate(static_cast<Enum const&>(archetype));
+	};
+
+	return FilteredView<Enum, Archetype const* const, decltype(filter)>(getArchetypesSpan(), std::move(filter));
+}
+
+template <typename Predicate, typename>
+Variable const* Namespace::getVariableByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Variable>(getVariablesSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Variable const*> Namespace::getVariablesByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Variable>(getVariablesSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachVariable(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getVariablesSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryVariables(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Variable, Variable const* const, PredicateType>(getVariablesSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Predicate, typename>
+Function const* Namespace::getFunctionByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemByPredicate<Function>(getFunctionsSpan(), predicate);
+}
+
+template <typename Predicate, typename>
+Vector<Function const*> Namespace::getFunctionsByPredicate(Predicate&& predicate) const
+{
+	return internal::SpanAlgorithm::getItemsByPredicate<Function>(getFunctionsSpan(), predicate);
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachFunction(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getFunctionsSpan(), visitor);
+}
+
+template <typename Predicate, typename>
+auto Namespace::queryFunctions(Predicate&& predicate) const
+{
+	using PredicateType = std::decay_t<Predicate>;
+
+	return FilteredView<Function, Function const* const, PredicateType>(getFunctionsSpan(), PredicateType(std::forward<Predicate>(predicate)));
+}
+
+template <typename Visitor, typename>
+bool Namespace::foreachArchetype(Visitor&& visitor) const
+{
+	return internal::SpanAlgorithm::foreach(getArchetypesSpan(), visitor);
 }
\ No newline at end of file
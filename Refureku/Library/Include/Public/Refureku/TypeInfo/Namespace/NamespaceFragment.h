@@ -31,6 +31,17 @@ namespace rfk
 			*/
 			REFUREKU_API void						addNestedEntity(Entity const& nestedEntity)				noexcept;
 
+			/**
+			*	@brief	Add a batch of nested entities to the namespace.
+			*			The fragment and the merged namespace storage is reserved once for the whole batch,
+			*			so this should be preferred over multiple addNestedEntity calls.
+			*	
+			*	@param nestedEntities		Pointer to the first nested entity of the batch.
+			*	@param nestedEntitiesCount	Number of nested entities in the batch.
+			*/
+			REFUREKU_API void						addNestedEntities(Entity const* const*	nestedEntities,
+																	  std::size_t			nestedEntitiesCount)	noexcept;
+
 			/**
 			*	@brief	Set the number of nested entities for this entity.
 			*			Useful to avoid reallocations when adding a lot of entities.
@@ -82,5 +93,8 @@ namespace rfk
 			class NamespaceFragmentImpl;
 
 			RFK_GEN_GET_PIMPL(NamespaceFragmentImpl, Entity::getPimpl())
+
+		friend internal::MemoryFootprintCollector;
+		friend internal::ModulePatcher;
 	};
 }
\ No newline at end of file
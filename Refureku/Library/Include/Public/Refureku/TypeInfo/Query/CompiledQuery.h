@@ -0,0 +1,130 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/Misc/Visitor.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
+#include "Refureku/Containers/Vector.h"
+#include "Refureku/TypeInfo/Query/EQuerySource.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Entity;
+	class EntityQuery;
+
+	namespace internal
+	{
+		class CompiledQueryImpl;
+	}
+
+	/**
+	*	Execution plan of an EntityQuery.
+	*	Matching entities are streamed from the index chosen at compilation, in no particular order.
+	*	Running a compiled query doesn't allocate, except for getResults.
+	*/
+	class CompiledQuery final
+	{
+		public:
+			REFUREKU_API CompiledQuery(CompiledQuery const&)	noexcept;
+			REFUREKU_API CompiledQuery(CompiledQuery&&)			noexcept;
+			REFUREKU_API ~CompiledQuery()						noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all entities matching the query.
+			* 
+			*	@param visitor	Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData	Optional user data forwarded to the visitor.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API bool					foreach(Visitor<Entity>	visitor,
+														void*			userData)				const;
+
+			/**
+			*	@brief Execute the given visitor on all entities matching the query.
+			* 
+			*	@param visitor Callable taking an Entity const&. Return false to abort the foreach loop.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, Entity>>
+			bool								foreach(Visitor&& visitor)						const;
+
+			/**
+			*	@brief Get the first found entity matching the query.
+			* 
+			*	@return The first found entity matching the query, nullptr if there is none.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Entity const*					getFirst()								const	noexcept;
+
+			/**
+			*	@brief Get all the entities matching the query.
+			* 
+			*	@return All the entities matching the query.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Vector<Entity const*>			getResults()							const	noexcept;
+
+			/**
+			*	@brief Count the entities matching the query.
+			* 
+			*	@return The number of entities matching the query.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				std::size_t						count()									const	noexcept;
+
+			/**
+			*	@brief Get the index the candidate entities are drawn from.
+			* 
+			*	@return The index the candidate entities are drawn from.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				EQuerySource					getSource()								const	noexcept;
+
+			/**
+			*	@brief Get the number of candidate entities the chosen index was estimated to provide when the query was compiled.
+			* 
+			*	@return The estimated number of candidate entities.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				std::size_t						getEstimatedCandidatesCount()			const	noexcept;
+
+			/**
+			*	@brief	Describe the plan of this query: the chosen index, the other considered indices with their estimated candidates count
+			*			and the filters checked on each candidate.
+			* 
+			*	@return A human readable description of the plan. The string lives as long as this compiled query.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				char const*						explain()								const	noexcept;
+
+			REFUREKU_API CompiledQuery&			operator=(CompiledQuery const&)					noexcept;
+			REFUREKU_API CompiledQuery&			operator=(CompiledQuery&&)						noexcept;
+
+		private:
+			/** Pointer to the concrete CompiledQuery implementation. */
+			Pimpl<internal::CompiledQueryImpl>	_pimpl;
+
+			CompiledQuery(internal::CompiledQueryImpl* implementation)	noexcept;
+
+		friend EntityQuery;
+	};
+
+	#include "Refureku/TypeInfo/Query/CompiledQuery.inl"
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/**
+	*	Index a compiled query draws its candidate entities from.
+	*/
+	enum class EQuerySource : uint8
+	{
+		/** All the entities registered to the database are inspected. */
+		FullScan			= 0,
+
+		/** File level entities are drawn from the database file level by-name sets (or from the flat file level sets if no name is queried). */
+		FileLevelIndex,
+
+		/** Structs/classes and their members are drawn from the subclass table of the queried base struct. */
+		SubclassTable,
+
+		/** Entities are drawn from the database property index. */
+		PropertyIndex
+	};
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>	//std::is_base_of_v
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/EAccessSpecifier.h"
+#include "Refureku/TypeInfo/Variables/EFieldFlags.h"
+#include "Refureku/TypeInfo/Functions/EMethodFlags.h"
+#include "Refureku/TypeInfo/Query/CompiledQuery.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Struct;
+	class Property;
+
+	namespace internal
+	{
+		class EntityQueryImpl;
+	}
+
+	/**
+	*	Builder describing a set of registered entities by combining filters.
+	*	A query must be compiled before it is run: the compiled query picks the most selective database index
+	*	able to serve the query, then checks all the filters on the entities drawn from that index.
+	*
+	*	Example: all public methods named On* declared in classes deriving from Component and carrying the Exposed property:
+	*		rfk::EntityQuery().ofKind(rfk::EEntityKind::Method).withNamePrefix("On").derivedFrom(Component::staticGetArchetype())
+	*						  .withProperty<Exposed>().withAccess(rfk::EAccessSpecifier::Public).compile();
+	*/
+	class EntityQuery final
+	{
+		public:
+			REFUREKU_API EntityQuery()							noexcept;
+			REFUREKU_API EntityQuery(EntityQuery const&)		noexcept;
+			REFUREKU_API EntityQuery(EntityQuery&&)				noexcept;
+			REFUREKU_API ~EntityQuery()							noexcept;
+
+			/**
+			*	@brief	Only match entities of the provided kinds.
+			*			By default, all entity kinds except namespace fragments are matched.
+			* 
+			*	@param kinds Bitmask of the matched entity kinds.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	ofKind(EEntityKind kinds)									noexcept;
+
+			/**
+			*	@brief Only match entities named with the provided name.
+			* 
+			*	@param name Name of the matched entities. The string is copied.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	named(char const* name)										noexcept;
+
+			/**
+			*	@brief Only match entities whose name starts with the provided prefix.
+			* 
+			*	@param prefix Prefix of the name of the matched entities. The string is copied.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	withNamePrefix(char const* prefix)							noexcept;
+
+			/**
+			*	@brief	Only match structs/classes inheriting from the provided struct, and fields/methods declared in such structs/classes.
+			*			Any other entity kind is rejected.
+			* 
+			*	@param base			The base struct/class.
+			*	@param includeBase	Should the base struct (and the fields/methods it declares) be matched as well?
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	derivedFrom(Struct const&	base,
+													bool			includeBase = false)			noexcept;
+
+			/**
+			*	@brief Only match entities carrying a property of the provided archetype.
+			* 
+			*	@param propertyArchetype	Archetype of the property.
+			*	@param isChildClassValid	If true, properties inheriting from the provided archetype are valid as well.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	withProperty(Struct const&	propertyArchetype,
+													 bool			isChildClassValid = true)		noexcept;
+
+			/**
+			*	@brief Only match entities carrying a property of the provided type.
+			* 
+			*	@tparam PropertyType Type of the property. It must inherit from rfk::Property.
+			* 
+			*	@param isChildClassValid If true, properties inheriting from PropertyType are valid as well.
+			* 
+			*	@return This query.
+			*/
+			template <typename PropertyType, typename = std::enable_if_t<std::is_base_of_v<Property, PropertyType>>>
+			EntityQuery&				withProperty(bool isChildClassValid = true)					noexcept;
+
+			/**
+			*	@brief	Only match entities with the provided access specifier.
+			*			Only nested archetypes, fields and methods have an access specifier, other entities are considered EAccessSpecifier::Undefined.
+			* 
+			*	@param access Access specifier of the matched entities.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	withAccess(EAccessSpecifier access)							noexcept;
+
+			/**
+			*	@brief Only match fields (static or not) having at least all the provided flags. Any other entity kind is rejected.
+			* 
+			*	@param flags Flags the matched fields must have.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	withFieldFlags(EFieldFlags flags)							noexcept;
+
+			/**
+			*	@brief Only match methods (static or not) having at least all the provided flags. Any other entity kind is rejected.
+			* 
+			*	@param flags Flags the matched methods must have.
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	withMethodFlags(EMethodFlags flags)							noexcept;
+
+			/**
+			*	@brief Only match file level entities (entities without outer entity).
+			* 
+			*	@return This query.
+			*/
+			REFUREKU_API EntityQuery&	atFileLevel()												noexcept;
+
+			/**
+			*	@brief	Build the execution plan of this query against the current state of the database.
+			*			The plan keeps its index choice if entities are registered or unregistered afterwards,
+			*			but its results always reflect the database state at the time it is run.
+			* 
+			*	@return The compiled query.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				CompiledQuery			compile()											const	noexcept;
+
+			REFUREKU_API EntityQuery&	operator=(EntityQuery const&)								noexcept;
+			REFUREKU_API EntityQuery&	operator=(EntityQuery&&)									noexcept;
+
+		private:
+			/** Pointer to the concrete EntityQuery implementation. */
+			Pimpl<internal::EntityQueryImpl>	_pimpl;
+	};
+
+	#include "Refureku/TypeInfo/Query/EntityQuery.inl"
+}
\ No newline at end of file
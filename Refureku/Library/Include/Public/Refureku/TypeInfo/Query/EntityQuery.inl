@@ -0,0 +1,12 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename PropertyType, typename>
+EntityQuery& EntityQuery::withProperty(bool isChildClassValid) noexcept
+{
+	return withProperty(PropertyType::staticGetArchetype(), isChildClassValid);
+}
\ No newline at end of file
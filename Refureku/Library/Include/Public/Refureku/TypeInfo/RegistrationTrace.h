@@ -0,0 +1,138 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/Containers/Vector.h"
+
+namespace rfk
+{
+	/** Kinds of registration steps recorded by the registration tracer. */
+	enum class ERegistrationTraceCategory : uint8
+	{
+		/** Construction of an ArchetypeRegisterer (database registration of a file level struct, class or enum). */
+		ArchetypeRegisterer = 0u,
+
+		/** Construction of a DefaultEntityRegisterer (database registration of a file level variable or function). */
+		DefaultEntityRegisterer,
+
+		/** Construction of a NamespaceFragmentRegisterer (database registration of a file level namespace fragment). */
+		NamespaceFragmentRegisterer,
+
+		/** Construction of a ClassTemplateInstantiationRegisterer. */
+		ClassTemplateInstantiationRegisterer,
+
+		/** Construction of a ModuleEntityRegisterer (addition of an entity to a module registration table). */
+		ModuleEntityRegisterer,
+
+		/** ModuleHandle::load (database registration of all the module entities). */
+		ModuleLoad,
+
+		/** First call to a generated staticGetArchetype (creation and filling of the struct or class metadata). */
+		StaticGetArchetype,
+
+		/** Merge of the entities of a namespace fragment into its namespace. */
+		NamespaceMerge,
+
+		/** Number of categories. */
+		Count
+	};
+
+	/** Single registration step recorded by the registration tracer. */
+	struct RegistrationTraceEvent
+	{
+		/** Name of the traced entity or module. */
+		char const*					name		= nullptr;
+
+		/** Module the step is attributed to (module name or generated file name), nullptr if unknown. */
+		char const*					module		= nullptr;
+
+		/** Kind of the traced step. */
+		ERegistrationTraceCategory	category	= ERegistrationTraceCategory::Count;
+
+		/** Index of the thread which ran the step, in the order threads recorded their first event. */
+		uint32						threadIndex	= 0u;
+
+		/** Start of the step, in nanoseconds since the first traced step. */
+		uint64						start		= 0u;
+
+		/** Duration of the step in nanoseconds. Nested steps are included. */
+		uint64						duration	= 0u;
+	};
+
+	/**
+	*	@brief Get the name of a registration trace category, as written in the exported trace.
+	*
+	*	@param category The category.
+	*
+	*	@return The category name, or "Unknown" for ERegistrationTraceCategory::Count.
+	*/
+	RFK_NODISCARD REFUREKU_API char const* getRegistrationTraceCategoryName(ERegistrationTraceCategory category) noexcept;
+
+	namespace internal
+	{
+		/**
+		*	Record a registration step from construction to destruction.
+		*	Does nothing if Refureku was built without RFK_REGISTRATION_TRACING.
+		*/
+		class RegistrationTraceScope final
+		{
+			private:
+				/** Index of the recorded event. */
+				std::size_t	_eventIndex;
+
+			public:
+				/**
+				*	@param category	Kind of the traced step.
+				*	@param name		Name of the traced entity or module.
+				*	@param module	Module the step is attributed to. If nullptr, the step is attributed to the module
+				*					whose static initialization is running on this thread (see RegistrationTraceModule).
+				*/
+				REFUREKU_API RegistrationTraceScope(ERegistrationTraceCategory	category,
+													char const*					name,
+													char const*					module = nullptr)	noexcept;
+				RegistrationTraceScope(RegistrationTraceScope const&)								= delete;
+				RegistrationTraceScope(RegistrationTraceScope&&)									= delete;
+				REFUREKU_API ~RegistrationTraceScope()												noexcept;
+		};
+
+		/**
+		*	Static object emitted by the generator before the registerers of each generated file.
+		*	The registerers initialized after it on the same thread are attributed to its module.
+		*/
+		class RegistrationTraceModule final
+		{
+			public:
+				REFUREKU_API RegistrationTraceModule(char const* module)	noexcept;
+				RegistrationTraceModule(RegistrationTraceModule const&)		= delete;
+				RegistrationTraceModule(RegistrationTraceModule&&)			= delete;
+		};
+	}
+
+	REFUREKU_TEMPLATE_API(rfk::Allocator<RegistrationTraceEvent>);
+	REFUREKU_TEMPLATE_API(rfk::Vector<RegistrationTraceEvent, rfk::Allocator<RegistrationTraceEvent>>);
+}
+
+/**
+*	Trace points used by the library and by the generated code.
+*	They expand to nothing when RFK_REGISTRATION_TRACING is 0.
+*/
+#if RFK_REGISTRATION_TRACING
+
+	#define RFK_TRACE_REGISTRATION_SCOPE(category, name, module)	rfk::internal::RegistrationTraceScope const rfk_registrationTraceScope(rfk::ERegistrationTraceCategory::category, name, module)
+	#define RFK_TRACE_REGISTRATION_MODULE(variableName, module)		namespace rfk::generated { static rfk::internal::RegistrationTraceModule const variableName(module); }
+
+#else
+
+	#define RFK_TRACE_REGISTRATION_SCOPE(category, name, module)
+	#define RFK_TRACE_REGISTRATION_MODULE(variableName, module)
+
+#endif
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotEntity.h"
+
+namespace rfk
+{
+	namespace internal
+	{
+		class DatabaseSnapshotImpl;
+	}
+
+	/**
+	*	Read-only view over a binary snapshot of the database, exported with Database::exportSnapshot.
+	*	The snapshot can be used without initializing the program which exported it: it only contains plain data
+	*	(names, ids, kinds, types, sizes, offsets, flags, property archetypes and inheritance edges), no callable nor property instance.
+	*	The snapshot format is position independent, so it can be used in place from a memory mapped file.
+	*/
+	class DatabaseSnapshot final
+	{
+		public:
+			/** Version of the snapshot format. Snapshots exported with another version can't be loaded. */
+			static constexpr uint32	formatVersion = 1u;
+
+			REFUREKU_API DatabaseSnapshot()					noexcept;
+			DatabaseSnapshot(DatabaseSnapshot const&)		= delete;
+			DatabaseSnapshot(DatabaseSnapshot&&)			= delete;
+			REFUREKU_API ~DatabaseSnapshot()				noexcept;
+
+			/**
+			*	@brief	Use a snapshot stored in memory, typically a memory mapped snapshot file.
+			*			The memory is not copied, so it must outlive the snapshot use and must be aligned on 8 bytes.
+			*			The previously loaded snapshot, if any, is released.
+			*
+			*	@param data	Pointer to the beginning of the snapshot.
+			*	@param size	Size in bytes of the memory block.
+			*
+			*	@return true if the snapshot is valid and was loaded, else false.
+			*/
+			REFUREKU_API bool					loadFromMemory(void const*	data,
+															   std::size_t	size)									noexcept;
+
+			/**
+			*	@brief	Read a snapshot file and load it.
+			*			The previously loaded snapshot, if any, is released.
+			*
+			*	@param filePath Path to the snapshot file.
+			*
+			*	@return true if the file could be read and the snapshot is valid, else false.
+			*/
+			REFUREKU_API bool					loadFromFile(char const* filePath)									noexcept;
+
+			/**
+			*	@brief Check whether a valid snapshot is loaded.
+			*
+			*	@return true if a snapshot is loaded, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool		isLoaded()													const	noexcept;
+
+			/**
+			*	@brief Get the number of entities in the snapshot.
+			*
+			*	@return The number of entities in the snapshot, 0 if no snapshot is loaded.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t						getEntitiesCount()											const	noexcept;
+
+			/**
+			*	@brief	Get the entity at the given index. Entities are sorted by id.
+			*			If index is greater or equal to getEntitiesCount(), the behaviour is undefined.
+			*
+			*	@param index Index of the entity.
+			*
+			*	@return The entity at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				SnapshotEntity const&			getEntityAt(std::size_t index)								const	noexcept;
+
+			/**
+			*	@brief Retrieve an entity by id.
+			*
+			*	@param id The id of the entity.
+			*
+			*	@return A constant pointer to the queried entity if it exists, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				SnapshotEntity const*			getEntityById(std::size_t id)								const	noexcept;
+
+			/**
+			*	@brief Retrieve a file level entity by kind and name.
+			*
+			*	@param name		The name of the entity.
+			*	@param kinds	Bitmask of the accepted kinds.
+			*
+			*	@return A constant pointer to the first file level entity matching the name and kinds if any, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				SnapshotEntity const*			getFileLevelEntityByName(char const*	name,
+																		 EEntityKind	kinds)				const	noexcept;
+
+			/**
+			*	@brief Shorthands for getFileLevelEntityByName with a single kind, mirroring the Database API.
+			*
+			*	@param name The name of the entity.
+			*
+			*	@return A constant pointer to the queried entity if it exists, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelNamespaceByName(char const* name)		const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelStructByName(char const* name)			const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelClassByName(char const* name)			const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelEnumByName(char const* name)			const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelVariableByName(char const* name)		const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFileLevelFunctionByName(char const* name)		const	noexcept;
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getFundamentalArchetypeByName(char const* name)		const	noexcept;
+
+			/**
+			*	@brief Get the number of file level entities of the provided kinds.
+			*
+			*	@param kinds Bitmask of the counted kinds.
+			*
+			*	@return The number of file level entities of the provided kinds.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t						getFileLevelEntitiesCount(EEntityKind kinds)				const	noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all file level entities of the provided kinds, sorted by kind then by name.
+			*
+			*	@param kinds	Bitmask of the visited kinds.
+			*	@param visitor	Visitor function to call. Return false to abort the traversal.
+			*	@param userData	Optional user data forwarded to the visitor.
+			*
+			*	@return	false if a visitor returned false or the visitor is nullptr, else true.
+			*/
+			REFUREKU_API bool					foreachFileLevelEntity(EEntityKind				kinds,
+																	   Visitor<SnapshotEntity>	visitor,
+																	   void*					userData)				const;
+
+			/**
+			*	@brief Execute the given visitor on all file level entities of the provided kinds, sorted by kind then by name.
+			*
+			*	@param kinds	Bitmask of the visited kinds.
+			*	@param visitor	Callable taking a SnapshotEntity const&. Return false to abort the traversal.
+			*
+			*	@return	false if a visitor returned false, else true.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, SnapshotEntity>>
+			bool								foreachFileLevelEntity(EEntityKind	kinds,
+																	   Visitor&&	visitor)							const;
+
+		private:
+			/** Pointer to the DatabaseSnapshot implementation. */
+			Pimpl<internal::DatabaseSnapshotImpl>	_pimpl;
+	};
+
+	#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.inl"
+}
\ No newline at end of file
@@ -0,0 +1,345 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <type_traits>
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/Misc/Visitor.h"
+#include "Refureku/Misc/SpanAlgorithm.h"
+#include "Refureku/TypeInfo/EAccessSpecifier.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/Archetypes/EClassKind.h"
+#include "Refureku/TypeInfo/Variables/EFieldFlags.h"
+#include "Refureku/TypeInfo/Variables/EVarFlags.h"
+#include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
+#include "Refureku/TypeInfo/Functions/EMethodFlags.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotType.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotParentStruct.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotProperty.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotParameter.h"
+
+namespace rfk
+{
+	/**
+	*	Entity stored in a database snapshot.
+	*	A single class describes all entity kinds: the getters which don't apply to the entity kind return a default value.
+	*	Instances only live in the snapshot memory, and are valid as long as the snapshot is loaded.
+	*/
+	class SnapshotEntity final
+	{
+		public:
+			SnapshotEntity()						= delete;
+			SnapshotEntity(SnapshotEntity const&)	= delete;
+			SnapshotEntity(SnapshotEntity&&)		= delete;
+			~SnapshotEntity()						= delete;
+
+			/**
+			*	@brief Get the id of the entity.
+			*
+			*	@return The id of the entity.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getId()															const	noexcept;
+
+			/**
+			*	@brief Get the name of the entity.
+			*
+			*	@return The name of the entity.
+			*/
+			RFK_NODISCARD REFUREKU_API char const*				getName()														const	noexcept;
+
+			/**
+			*	@brief Get the kind of the entity.
+			*
+			*	@return The kind of the entity.
+			*/
+			RFK_NODISCARD REFUREKU_API EEntityKind				getKind()														const	noexcept;
+
+			/**
+			*	@brief Get the entity this entity is nested in.
+			*
+			*	@return The outer entity, or nullptr if the entity is at file level.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getOuterEntity()												const	noexcept;
+
+			/**
+			*	@brief Get the number of properties attached to the entity.
+			*
+			*	@return The number of properties attached to the entity.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getPropertiesCount()											const	noexcept;
+
+			/**
+			*	@brief	Get the property at the given index.
+			*			If index is greater or equal to getPropertiesCount(), the behaviour is undefined.
+			*
+			*	@param propertyIndex Index of the property to get.
+			*
+			*	@return The property at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotProperty const&	getPropertyAt(std::size_t propertyIndex)						const	noexcept;
+
+			/**
+			*	@brief Retrieve the first property which archetype has the given name.
+			*
+			*	@param name Name of the property archetype.
+			*
+			*	@return The first property which archetype has the given name if any, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotProperty const*	getPropertyByName(char const* name)								const	noexcept;
+
+			/**
+			*	@brief	Get the number of entities nested in this entity:
+			*			members of a namespace, own members of a struct, values of an enum.
+			*
+			*	@return The number of nested entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getNestedEntitiesCount()										const	noexcept;
+
+			/**
+			*	@brief	Get the nested entity at the given index. Nested entities are grouped by kind, in the order the reflected entity iterates them.
+			*			If index is greater or equal to getNestedEntitiesCount(), the behaviour is undefined.
+			*
+			*	@param index Index of the nested entity to get.
+			*
+			*	@return The nested entity at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const&	getNestedEntityAt(std::size_t index)							const	noexcept;
+
+			/**
+			*	@brief Retrieve the first nested entity with the given name and kind.
+			*
+			*	@param name						Name of the nested entity.
+			*	@param kinds					Bitmask of the accepted kinds.
+			*	@param shouldInspectInherited	Should the members of the parent structs be inspected as well?
+			*
+			*	@return The first matching nested entity if any, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getNestedEntityByName(char const*	name,
+																					  EEntityKind	kinds,
+																					  bool			shouldInspectInherited = false)	const	noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all nested entities, in the getNestedEntityAt order.
+			*
+			*	@param visitor	Visitor function to call. Return false to abort the traversal.
+			*	@param userData	Optional user data forwarded to the visitor.
+			*
+			*	@return	false if a visitor returned false or the visitor is nullptr, else true.
+			*/
+			REFUREKU_API bool									foreachNestedEntity(Visitor<SnapshotEntity>	visitor,
+																					void*					userData)		const;
+
+			/**
+			*	@brief Execute the given visitor on all nested entities, in the getNestedEntityAt order.
+			*
+			*	@param visitor Callable taking a SnapshotEntity const&. Return false to abort the traversal.
+			*
+			*	@return	false if a visitor returned false, else true.
+			*/
+			template <typename Visitor, typename = internal::EnableIfCallableWith<Visitor, SnapshotEntity>>
+			bool												foreachNestedEntity(Visitor&& visitor)							const;
+
+			/**
+			*	@brief Get the access specifier of a nested archetype, field or method.
+			*
+			*	@return The access specifier of the entity, EAccessSpecifier::Undefined for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API EAccessSpecifier			getAccess()														const	noexcept;
+
+			/**
+			*	@brief Get the memory size of an archetype.
+			*
+			*	@return The memory size of the archetype, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getMemorySize()													const	noexcept;
+
+			/**
+			*	@brief Get the kind of a struct or class.
+			*
+			*	@return The class kind of the struct or class, EClassKind::Standard for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API EClassKind				getClassKind()													const	noexcept;
+
+			/**
+			*	@brief Get the number of direct parents of a struct or class.
+			*
+			*	@return The number of direct parents, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getDirectParentsCount()											const	noexcept;
+
+			/**
+			*	@brief	Get the direct parent at the given index.
+			*			If index is greater or equal to getDirectParentsCount(), the behaviour is undefined.
+			*
+			*	@param index Index of the parent to get.
+			*
+			*	@return The direct parent at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotParentStruct const&	getDirectParentAt(std::size_t index)						const	noexcept;
+
+			/**
+			*	@brief Check if this struct is a subclass of another struct. A struct is not a subclass of itself.
+			*
+			*	@param archetype The potential parent struct.
+			*
+			*	@return true if this struct inherits from archetype, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool						isSubclassOf(SnapshotEntity const& archetype)					const	noexcept;
+
+			/**
+			*	@brief Get the number of registered subclasses of a struct or class (direct and indirect).
+			*
+			*	@return The number of subclasses, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getSubclassesCount()											const	noexcept;
+
+			/**
+			*	@brief	Get the subclass at the given index.
+			*			If index is greater or equal to getSubclassesCount(), the behaviour is undefined.
+			*
+			*	@param index Index of the subclass to get.
+			*
+			*	@return The subclass at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const&	getSubclassAt(std::size_t index)								const	noexcept;
+
+			/**
+			*	@brief Get the underlying archetype of an enum.
+			*
+			*	@return The underlying archetype of the enum, nullptr for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getUnderlyingArchetype()										const	noexcept;
+
+			/**
+			*	@brief Retrieve the first value of an enum equal to the provided value.
+			*
+			*	@param value The searched value.
+			*
+			*	@return The first enum value equal to value if any, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getEnumValue(int64 value)										const	noexcept;
+
+			/**
+			*	@brief Get the value of an enum value.
+			*
+			*	@return The value of the enum value, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API int64					getValue()														const	noexcept;
+
+			/**
+			*	@brief Get the memory offset of a non-static field in an instance of its owner struct.
+			*
+			*	@return The memory offset of the field, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getMemoryOffset()												const	noexcept;
+
+			/**
+			*	@brief Get the type of a variable or field.
+			*			If the entity is not a variable nor a field, the behaviour is undefined.
+			*
+			*	@return The type of the variable or field.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotType const&		getType()														const	noexcept;
+
+			/**
+			*	@brief	Get the return type of a function or method.
+			*			If the entity is not a function nor a method, the behaviour is undefined.
+			*
+			*	@return The return type of the function or method.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotType const&		getReturnType()													const	noexcept;
+
+			/**
+			*	@brief Get the number of parameters of a function or method.
+			*
+			*	@return The number of parameters, 0 for other entities.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getParametersCount()											const	noexcept;
+
+			/**
+			*	@brief	Get the parameter at the given index.
+			*			If index is greater or equal to getParametersCount(), the behaviour is undefined.
+			*
+			*	@param index Index of the parameter to get.
+			*
+			*	@return The parameter at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotParameter const&	getParameterAt(std::size_t index)								const	noexcept;
+
+			/**
+			*	@brief Getters for the flags of each entity kind.
+			*
+			*	@return The flags of the entity, the default flags if the entity kind doesn't match.
+			*/
+			RFK_NODISCARD REFUREKU_API EFieldFlags				getFieldFlags()													const	noexcept;
+			RFK_NODISCARD REFUREKU_API EVarFlags				getVarFlags()													const	noexcept;
+			RFK_NODISCARD REFUREKU_API EFunctionFlags			getFunctionFlags()												const	noexcept;
+			RFK_NODISCARD REFUREKU_API EMethodFlags				getMethodFlags()												const	noexcept;
+
+		private:
+			/** Offset of this record from the beginning of the snapshot. */
+			uint32	_offset;
+
+			/** Offset of the entity name from the beginning of the snapshot. */
+			uint32	_nameOffset;
+
+			/** Id of the entity. */
+			uint64	_id;
+
+			/** Index of the outer entity in the snapshot entities, or an invalid index. */
+			uint32	_outerIndex;
+
+			/** EEntityKind of the entity. */
+			uint16	_kind;
+
+			/** EAccessSpecifier of nested archetypes, fields and methods. */
+			uint8	_access;
+
+			uint8	_padding;
+
+			/** EFieldFlags, EVarFlags, EFunctionFlags or EMethodFlags depending on the entity kind. */
+			uint32	_flags;
+
+			/** Index in the snapshot types table of the variable/field type, function return type or enum underlying type. */
+			uint32	_typeIndex;
+
+			/** Memory size of an archetype, or memory offset of a field. */
+			uint64	_memory;
+
+			/** Value of an enum value, or EClassKind of a struct. */
+			int64	_value;
+
+			/** Range of the nested entities in the snapshot nested entities table. */
+			uint32	_nestedEntitiesBegin;
+			uint32	_nestedEntitiesCount;
+
+			/** Range of the direct parents in the snapshot direct parents table. */
+			uint32	_directParentsBegin;
+			uint32	_directParentsCount;
+
+			/** Range of the subclasses in the snapshot subclasses table. */
+			uint32	_subclassesBegin;
+			uint32	_subclassesCount;
+
+			/** Range of the properties in the snapshot properties table. */
+			uint32	_propertiesBegin;
+			uint32	_propertiesCount;
+
+			/** Range of the parameters in the snapshot parameters table. */
+			uint32	_parametersBegin;
+			uint32	_parametersCount;
+
+		friend internal::SnapshotWriter;
+		friend internal::SnapshotFormat;
+	};
+
+	#include "Refureku/TypeInfo/Snapshot/SnapshotEntity.inl"
+}
\ No newline at end of file
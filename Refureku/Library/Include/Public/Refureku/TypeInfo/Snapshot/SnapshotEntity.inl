@@ -0,0 +1,17 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Visitor, typename>
+bool SnapshotEntity::foreachNestedEntity(Visitor&& visitor) const
+{
+	using VisitorType = std::remove_reference_t<Visitor>;
+
+	return foreachNestedEntity([](SnapshotEntity const& entity, void* userData)
+							   {
+								   return static_cast<bool>((*reinterpret_cast<VisitorType*>(userData))(entity));
+							   }, &visitor);
+}
\ No newline at end of file
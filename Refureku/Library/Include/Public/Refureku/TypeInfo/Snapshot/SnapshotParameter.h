@@ -0,0 +1,65 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class SnapshotType;
+
+	namespace internal
+	{
+		class SnapshotWriter;
+		class SnapshotFormat;
+	}
+
+	/**
+	*	Parameter of a function or method stored in a database snapshot.
+	*	Instances only live in the snapshot memory.
+	*/
+	class SnapshotParameter final
+	{
+		public:
+			SnapshotParameter()							= delete;
+			SnapshotParameter(SnapshotParameter const&)	= delete;
+			SnapshotParameter(SnapshotParameter&&)		= delete;
+			~SnapshotParameter()						= delete;
+
+			/**
+			*	@brief Get the name of the parameter.
+			* 
+			*	@return The name of the parameter.
+			*/
+			RFK_NODISCARD REFUREKU_API char const*			getName()	const	noexcept;
+
+			/**
+			*	@brief Get the type of the parameter.
+			* 
+			*	@return The type of the parameter.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotType const&	getType()	const	noexcept;
+
+		private:
+			/** Offset of this record from the beginning of the snapshot. */
+			uint32	_offset;
+
+			/** Offset of the parameter name from the beginning of the snapshot. */
+			uint32	_nameOffset;
+
+			/** Index of the parameter type in the snapshot types table. */
+			uint32	_typeIndex;
+
+			uint32	_padding;
+
+		friend internal::SnapshotWriter;
+		friend internal::SnapshotFormat;
+	};
+}
\ No newline at end of file
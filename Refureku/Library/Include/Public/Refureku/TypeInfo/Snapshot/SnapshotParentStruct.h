@@ -0,0 +1,66 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/TypeInfo/EAccessSpecifier.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class SnapshotEntity;
+
+	namespace internal
+	{
+		class SnapshotWriter;
+		class SnapshotFormat;
+	}
+
+	/**
+	*	Direct parent of a struct stored in a database snapshot.
+	*	Instances only live in the snapshot memory.
+	*/
+	class SnapshotParentStruct final
+	{
+		public:
+			SnapshotParentStruct()								= delete;
+			SnapshotParentStruct(SnapshotParentStruct const&)	= delete;
+			SnapshotParentStruct(SnapshotParentStruct&&)		= delete;
+			~SnapshotParentStruct()								= delete;
+
+			/**
+			*	@brief Get the archetype of the parent struct.
+			* 
+			*	@return The archetype of the parent struct.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const&	getArchetype()					const	noexcept;
+
+			/**
+			*	@brief Get the inheritance access specifier used when inheriting this struct.
+			* 
+			*	@return The inheritance access specifier used when inheriting this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API EAccessSpecifier			getInheritanceAccessSpecifier()	const	noexcept;
+
+		private:
+			/** Offset of this record from the beginning of the snapshot. */
+			uint32	_offset;
+
+			/** Index of the parent struct in the snapshot entities. */
+			uint32	_archetypeIndex;
+
+			/** Inheritance access specifier. */
+			uint32	_inheritanceAccess;
+
+			uint32	_padding;
+
+		friend internal::SnapshotWriter;
+		friend internal::SnapshotFormat;
+	};
+}
\ No newline at end of file
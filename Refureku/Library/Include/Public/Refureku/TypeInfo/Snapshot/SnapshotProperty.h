@@ -0,0 +1,98 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class SnapshotEntity;
+
+	namespace internal
+	{
+		class SnapshotWriter;
+		class SnapshotFormat;
+	}
+
+	/**
+	*	Property attached to an entity stored in a database snapshot.
+	*	Only the property archetype and settings are stored, not the property data.
+	*	Instances only live in the snapshot memory.
+	*/
+	class SnapshotProperty final
+	{
+		public:
+			SnapshotProperty()							= delete;
+			SnapshotProperty(SnapshotProperty const&)	= delete;
+			SnapshotProperty(SnapshotProperty&&)		= delete;
+			~SnapshotProperty()							= delete;
+
+			/**
+			*	@brief Get the archetype of the property.
+			* 
+			*	@return The archetype of the property if it was registered to the exported database, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getArchetype()		const	noexcept;
+
+			/**
+			*	@brief Get the name of the archetype of the property, even if the archetype was not registered to the exported database.
+			* 
+			*	@return The name of the archetype of the property.
+			*/
+			RFK_NODISCARD REFUREKU_API char const*				getArchetypeName()	const	noexcept;
+
+			/**
+			*	@brief Get the id of the archetype of the property, even if the archetype was not registered to the exported database.
+			* 
+			*	@return The id of the archetype of the property.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getArchetypeId()	const	noexcept;
+
+			/**
+			*	@brief Getter for the shouldInherit setting of the property.
+			* 
+			*	@return shouldInherit.
+			*/
+			RFK_NODISCARD REFUREKU_API bool						getShouldInherit()	const	noexcept;
+
+			/**
+			*	@brief Getter for the allowMultiple setting of the property.
+			* 
+			*	@return allowMultiple.
+			*/
+			RFK_NODISCARD REFUREKU_API bool						getAllowMultiple()	const	noexcept;
+
+		private:
+			/** Offset of this record from the beginning of the snapshot. */
+			uint32	_offset;
+
+			/** Index of the property archetype in the snapshot entities, or an invalid index. */
+			uint32	_archetypeIndex;
+
+			/** Offset of the archetype name from the beginning of the snapshot. */
+			uint32	_archetypeNameOffset;
+
+			/** shouldInherit setting of the property. */
+			uint8	_shouldInherit;
+
+			/** allowMultiple setting of the property. */
+			uint8	_allowMultiple;
+
+			uint16	_padding;
+
+			/** Id of the property archetype. */
+			uint64	_archetypeId;
+
+		friend internal::SnapshotWriter;
+		friend internal::SnapshotFormat;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/TypeInfo/TypePart.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class SnapshotEntity;
+
+	namespace internal
+	{
+		class SnapshotWriter;
+		class SnapshotFormat;
+	}
+
+	/**
+	*	Type of a variable, field, function return value or parameter stored in a database snapshot.
+	*	Instances only live in the snapshot memory.
+	*/
+	class SnapshotType final
+	{
+		public:
+			SnapshotType()						= delete;
+			SnapshotType(SnapshotType const&)	= delete;
+			SnapshotType(SnapshotType&&)		= delete;
+			~SnapshotType()						= delete;
+
+			/**
+			*	@brief Get the archetype of the type.
+			* 
+			*	@return The archetype of the type if it was registered to the exported database, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API SnapshotEntity const*	getArchetype()						const	noexcept;
+
+			/**
+			*	@brief Get the name of the archetype of the type, even if the archetype was not registered to the exported database.
+			* 
+			*	@return The name of the archetype, or an empty string if the type had no archetype.
+			*/
+			RFK_NODISCARD REFUREKU_API char const*				getArchetypeName()					const	noexcept;
+
+			/**
+			*	@brief Get the number of type parts constituting this type.
+			* 
+			*	@return The number of type parts constituting this type.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t				getTypePartsCount()					const	noexcept;
+
+			/**
+			*	@brief	Get the type part at the given index.
+			*			If index is greater or equal to the type parts count, the behaviour is undefined.
+			* 
+			*	@param index Index of the part to get.
+			* 
+			*	@return The type part at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API TypePart					getTypePartAt(std::size_t index)	const	noexcept;
+
+		private:
+			/** Offset of this record from the beginning of the snapshot. */
+			uint32	_offset;
+
+			/** Index of the archetype in the snapshot entities, or an invalid index. */
+			uint32	_archetypeIndex;
+
+			/** Offset of the archetype name from the beginning of the snapshot. */
+			uint32	_archetypeNameOffset;
+
+			/** Index of the first type part in the snapshot type parts table. */
+			uint32	_partsBegin;
+
+			/** Number of type parts. */
+			uint32	_partsCount;
+
+			uint32	_padding;
+
+		friend internal::SnapshotWriter;
+		friend internal::SnapshotFormat;
+	};
+}
\ No newline at end of file
@@ -8,9 +8,9 @@
 #pragma once
 
 #include <cstddef>		//std::size_t
+#include <cstring>		//std::memcmp
 #include <type_traits>	//std::is_const_v, std::is_volatile_v, std::is_array_v, ...
 
-#include "Refureku/Misc/Pimpl.h"
 #include "Refureku/TypeInfo/TypePart.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 
@@ -19,6 +19,13 @@ namespace rfk
 	class Type
 	{
 		public:
+			/**
+			*	Version of the Type memory layout.
+			*	Type data members live in this header (no pimpl) so that the type parts can be stored inline,
+			*	so this version must be incremented whenever they are modified as it breaks the ABI.
+			*/
+			static constexpr uint32 layoutVersion = 2u;
+
 			REFUREKU_API Type()		noexcept;
 			Type(Type const&)		noexcept;
 			Type(Type&&)			noexcept;
@@ -32,62 +39,62 @@ namespace rfk
 			* 
 			*	@return The type part at the specified index.
 			*/
-			REFUREKU_API TypePart const&		getTypePartAt(std::size_t index)	const	noexcept;
+			REFUREKU_HOT_GETTER TypePart const&		getTypePartAt(std::size_t index)	const	noexcept;
 
 			/**
 			*	@brief Get the number of type parts constituting this type.
 			* 
 			*	@return The number of type parts constituting this type.
 			*/
-			REFUREKU_API std::size_t			getTypePartsCount()					const	noexcept;
+			REFUREKU_HOT_GETTER std::size_t			getTypePartsCount()					const	noexcept;
 
 			/**
 			*	@return true if this type is a pointer type (*), else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isPointer()							const	noexcept;
+			REFUREKU_HOT_GETTER bool					isPointer()							const	noexcept;
 
 			/**
 			*	@return true if this type is a left value reference type (&), else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isLValueReference()					const	noexcept;
+			REFUREKU_HOT_GETTER bool					isLValueReference()					const	noexcept;
 
 			/**
 			*	@return true if this type is a right value reference type (&&), else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isRValueReference()					const	noexcept;
+			REFUREKU_HOT_GETTER bool					isRValueReference()					const	noexcept;
 
 			/**
 			*	@return true if this type is a c-style array ([]), else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isCArray()							const	noexcept;
+			REFUREKU_HOT_GETTER bool					isCArray()							const	noexcept;
 
 			/**
 			*	@return true if this type is a value type (not a pointer, lvalue ref, rvalue ref, c-style array), else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isValue()							const	noexcept;
+			REFUREKU_HOT_GETTER bool					isValue()							const	noexcept;
 
 			/**
 			*	@return true if this type is const qualified, else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isConst()							const	noexcept;
+			REFUREKU_HOT_GETTER bool					isConst()							const	noexcept;
 
 			/**
 			*	@return true if this type is volatile qualified, else false.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API bool					isVolatile()						const	noexcept;
+			REFUREKU_HOT_GETTER bool					isVolatile()						const	noexcept;
 
 			/**
 			*	@return The size of the array if isCArray() is true, else 0.
 			*			The behaviour is undefined if getTypePartsCount() returns 0.
 			*/
-			REFUREKU_API uint32					getCArraySize()						const	noexcept;
+			REFUREKU_HOT_GETTER uint32					getCArraySize()						const	noexcept;
 
 			/**
 			*	@param other The other type to compare with.
@@ -102,7 +109,7 @@ namespace rfk
 			* 
 			*	@return This type's archetype.
 			*/
-			REFUREKU_API Archetype const*		getArchetype()						const	noexcept;
+			REFUREKU_HOT_GETTER Archetype const*		getArchetype()						const	noexcept;
 
 			/**
 			*	@brief Set this type's archetype.
@@ -123,34 +130,88 @@ namespace rfk
 			*/
 			REFUREKU_API void					optimizeMemory()							noexcept;
 
+			/**
+			*	@brief	Get the canonical instance of this type.
+			*			Each distinct type (archetype + type parts) has exactly one canonical instance in the program,
+			*			so canonical types (and their copies) are compared with a single pointer comparison.
+			*			This method is thread-safe.
+			* 
+			*	@return The canonical instance of this type.
+			*/
+			RFK_NODISCARD REFUREKU_API Type const&	getCanonicalType()					const	noexcept;
+
+			/**
+			*	@brief Check whether this type is the canonical instance of its type.
+			* 
+			*	@return true if this type is the canonical instance of its type, else false.
+			*/
+			RFK_NODISCARD REFUREKU_HOT_GETTER bool	isCanonical()						const	noexcept;
 
-			REFUREKU_API bool operator==(Type const&)	const	noexcept;
-			REFUREKU_API bool operator!=(Type const&)	const	noexcept;
 
-		protected:
-			//Forward declaration
-			class TypeImpl;
+			REFUREKU_HOT_GETTER bool operator==(Type const&)	const	noexcept;
+			REFUREKU_HOT_GETTER bool operator!=(Type const&)	const	noexcept;
 
 		private:
-			/** Concrete implementation of the Type class. */
-			Pimpl<TypeImpl> _pimpl;
+			/** Maximum number of type parts stored inline. Types with more parts (deeply nested pointers/arrays) spill to the heap. */
+			static constexpr uint32 _inlinePartsCapacity = 3u;
+
+			/** Archetype of this type. */
+			Archetype const*	_archetype		= nullptr;
+
+			/** Canonical instance of this type, or nullptr if it is not known yet. */
+			Type const*			_canonicalType	= nullptr;
+
+			/** Heap-allocated parts of this type. Only used when _partsCapacity is greater than _inlinePartsCapacity. */
+			TypePart*			_heapParts		= nullptr;
+
+			/** Number of parts of this type. */
+			uint32				_partsCount		= 0u;
+
+			/** Number of parts that can be stored without reallocation. */
+			uint32				_partsCapacity	= _inlinePartsCapacity;
+
+			/** Inline parts of this type. Only used when _partsCapacity is equal to _inlinePartsCapacity. */
+			TypePart			_inlineParts[_inlinePartsCapacity];
 
 			//The rfk::getType<T> method can access Type internal methods to fill the type
 			template <typename T>
 			friend Type const& getType() noexcept;
 
+			//The TypeInterner binds the canonical types it owns to themselves
+			friend class TypeInterner;
+
+			//The memory footprint collector reads the type parts capacity
+			friend internal::MemoryFootprintCollector;
+
 			/**
 			*	@brief Fill the provided Type according to template type T.
 			* 
 			*	@param out_type The Type object to fill.
 			*/
 			template <typename T>
-			static void	fillType(Type& out_type)	noexcept;
+			static void			fillType(Type& out_type)	noexcept;
+
+			/**
+			*	@brief Build the Type corresponding to template type T and get its canonical instance.
+			* 
+			*	@return The canonical instance of the Type corresponding to T.
+			*/
+			template <typename T>
+			static Type const&	makeCanonicalType()			noexcept;
+
+			/**
+			*	@brief Get a pointer to the first part of this type, wherever the parts are stored.
+			* 
+			*	@return A pointer to the first part of this type.
+			*/
+			REFUREKU_HOT_GETTER TypePart*			getPartsData()				noexcept;
+			REFUREKU_HOT_GETTER TypePart const*		getPartsData()		const	noexcept;
 	};
 
 	/**
 	*	@brief	Retrieve the Type object from a given type.
-	*			Identical types will return the same Type object (the returned object will have the same address in memory).
+	*			Identical types will return the same canonical Type object (the returned object will have the same address in memory),
+	*			even across different modules.
 	* 
 	*	@return The computed type.
 	*/
@@ -182,4 +243,8 @@ namespace rfk
 	template REFUREKU_API Type const& getType<float>()				noexcept;
 	template REFUREKU_API Type const& getType<double>()				noexcept;
 	template REFUREKU_API Type const& getType<long double>()		noexcept;
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/TypeHotGetters.inl"
+#endif
\ No newline at end of file
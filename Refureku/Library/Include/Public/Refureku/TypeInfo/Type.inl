@@ -53,18 +53,20 @@ void Type::fillType(Type& out_type) noexcept
 }
 
 template <typename T>
-Type const& getType() noexcept
+Type const& Type::makeCanonicalType() noexcept
 {
-	static Type	result;
-	static bool	initialized = false;
+	Type result;
 
-	if (!initialized)
-	{
-		initialized = true;
+	fillType<T>(result);
 
-		Type::fillType<T>(result);
-		result.optimizeMemory();
-	}
+	return result.getCanonicalType();
+}
+
+template <typename T>
+Type const& getType() noexcept
+{
+	//Function-local statics initialization is thread-safe, and so is the type interning
+	static Type const& result = Type::makeCanonicalType<T>();
 
 	return result;
 }
\ No newline at end of file
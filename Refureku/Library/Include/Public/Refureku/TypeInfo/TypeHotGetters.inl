@@ -0,0 +1,107 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+/*
+*	Type hot getters.
+*	Included from Type.h when RFK_INLINE_HOT_GETTERS is enabled, from Type.cpp otherwise.
+*/
+
+namespace rfk
+{
+	TypePart* Type::getPartsData() noexcept
+	{
+		return (_partsCapacity == _inlinePartsCapacity) ? _inlineParts : _heapParts;
+	}
+
+	TypePart const* Type::getPartsData() const noexcept
+	{
+		return (_partsCapacity == _inlinePartsCapacity) ? _inlineParts : _heapParts;
+	}
+
+	bool Type::isCanonical() const noexcept
+	{
+		return _canonicalType == this;
+	}
+
+	TypePart const& Type::getTypePartAt(std::size_t index) const noexcept
+	{
+		return getPartsData()[index];
+	}
+
+	std::size_t Type::getTypePartsCount() const noexcept
+	{
+		return _partsCount;
+	}
+
+	bool Type::isPointer() const noexcept
+	{
+		return getPartsData()->isPointer();
+	}
+
+	bool Type::isLValueReference() const	noexcept
+	{
+		return getPartsData()->isLValueReference();
+	}
+
+	bool Type::isRValueReference() const	noexcept
+	{
+		return getPartsData()->isRValueReference();
+	}
+
+	bool Type::isCArray() const noexcept
+	{
+		return getPartsData()->isCArray();
+	}
+
+	bool Type::isValue() const noexcept
+	{
+		return getPartsData()->isValue();
+	}
+
+	bool Type::isConst() const noexcept
+	{
+		return getPartsData()->isConst();
+	}
+
+	bool Type::isVolatile() const noexcept
+	{
+		return getPartsData()->isVolatile();
+	}
+
+	uint32 Type::getCArraySize() const noexcept
+	{
+		return getPartsData()->getCArraySize();
+	}
+
+	Archetype const* Type::getArchetype() const noexcept
+	{
+		return _archetype;
+	}
+
+	bool Type::operator==(Type const& type) const noexcept
+	{
+		if (this == &type)
+		{
+			return true;
+		}
+
+		//Types bound to a canonical type are equal only if they share the same canonical type
+		if (_canonicalType != nullptr && type._canonicalType != nullptr)
+		{
+			return _canonicalType == type._canonicalType;
+		}
+
+		return	_archetype == type._archetype &&
+				_partsCount == type._partsCount &&
+				std::memcmp(getPartsData(), type.getPartsData(), _partsCount * sizeof(TypePart)) == 0;
+	}
+
+	bool Type::operator!=(Type const& type) const noexcept
+	{
+		return !(*this == type);
+	}
+}
\ No newline at end of file
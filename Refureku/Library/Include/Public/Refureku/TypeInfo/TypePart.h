@@ -29,14 +29,15 @@ namespace rfk
 			*/
 			REFUREKU_API void				addDescriptorFlag(ETypePartDescriptor flag)	noexcept;
 
-			REFUREKU_API bool				isPointer()							const	noexcept;
-			REFUREKU_API bool				isLValueReference()					const	noexcept;
-			REFUREKU_API bool				isRValueReference()					const	noexcept;
-			REFUREKU_API bool				isCArray()							const	noexcept;
-			REFUREKU_API bool				isValue()							const	noexcept;
-			REFUREKU_API bool				isConst()							const	noexcept;
-			REFUREKU_API bool				isVolatile()						const	noexcept;
-			REFUREKU_API AdditionalDataType	getCArraySize()						const	noexcept;
+			REFUREKU_HOT_GETTER bool		isPointer()							const	noexcept;
+			REFUREKU_HOT_GETTER bool		isLValueReference()					const	noexcept;
+			REFUREKU_HOT_GETTER bool		isRValueReference()					const	noexcept;
+			REFUREKU_HOT_GETTER bool		isCArray()							const	noexcept;
+			REFUREKU_HOT_GETTER bool		isValue()							const	noexcept;
+			REFUREKU_HOT_GETTER bool		isConst()							const	noexcept;
+			REFUREKU_HOT_GETTER bool		isVolatile()						const	noexcept;
+			REFUREKU_HOT_GETTER AdditionalDataType
+											getCArraySize()						const	noexcept;
 
 			/**
 			*	@brief Setter for the field _additionalData.
@@ -65,4 +66,8 @@ __RFK_DISABLE_WARNING_POP
 	};
 
 	static_assert(sizeof(TypePart) == 8u, "TypePart must takes 8 bytes of fully initialized memory to allow the use of std::memcmp.");
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/TypePartHotGetters.inl"
+#endif
\ No newline at end of file
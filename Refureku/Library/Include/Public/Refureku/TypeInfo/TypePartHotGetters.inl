@@ -0,0 +1,54 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+/*
+*	TypePart hot getters.
+*	Included from TypePart.h when RFK_INLINE_HOT_GETTERS is enabled, from TypePart.cpp otherwise.
+*/
+
+namespace rfk
+{
+	bool TypePart::isPointer() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::Ptr) != 0u;
+	}
+
+	bool TypePart::isLValueReference() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::LRef) != 0u;
+	}
+
+	bool TypePart::isRValueReference() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::RRef) != 0u;
+	}
+
+	bool TypePart::isCArray() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::CArray) != 0u;
+	}
+
+	bool TypePart::isValue() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::Value) != 0u;
+	}
+
+	bool TypePart::isConst() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::Const) != 0u;
+	}
+
+	bool TypePart::isVolatile() const noexcept
+	{
+		return static_cast<std::underlying_type_t<ETypePartDescriptor>>(_descriptor & ETypePartDescriptor::Volatile) != 0u;
+	}
+
+	TypePart::AdditionalDataType TypePart::getCArraySize() const noexcept
+	{
+		return _additionalData;
+	}
+}
\ No newline at end of file
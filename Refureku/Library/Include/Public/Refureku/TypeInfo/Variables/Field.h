@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Variables/FieldBase.h"
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/MethodFieldHelpers.h"
@@ -224,7 +225,7 @@ namespace rfk
 			* 
 			*	@return The memory offset in bytes.
 			*/
-			RFK_NODISCARD REFUREKU_API std::size_t
+			RFK_NODISCARD REFUREKU_HOT_GETTER std::size_t
 										getMemoryOffset()								const	noexcept;
 
 		protected:
@@ -247,10 +248,13 @@ namespace rfk
 			*/
 			template <typename InstanceType>
 			RFK_NODISCARD InstanceType*	adjustInstancePointerAddress(InstanceType* instance) const;
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Field const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Field const*, rfk::Allocator<Field const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Variables/Field.inl"
-}
\ No newline at end of file
+}
+
+#if RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Variables/FieldImpl.h"
+#endif
\ No newline at end of file
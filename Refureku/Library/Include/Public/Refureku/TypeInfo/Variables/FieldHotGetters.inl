@@ -0,0 +1,19 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+/*
+*	Field hot getters.
+*	Included from FieldImpl.h when RFK_INLINE_HOT_GETTERS is enabled, from Field.cpp otherwise.
+*/
+
+namespace rfk
+{
+	std::size_t	Field::getMemoryOffset() const noexcept
+	{
+		return getPimpl()->getMemoryOffset();
+	}
+}
\ No newline at end of file
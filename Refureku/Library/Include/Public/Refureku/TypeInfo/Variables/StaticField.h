@@ -11,6 +11,7 @@
 #include <type_traits>	//std::is_rvalue_reference_v, std::is_lvalue_reference_v, std::is_const_v...
 #include <utility>		//std::forward, std::move
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Variables/FieldBase.h"
 
 namespace rfk
@@ -100,10 +101,9 @@ namespace rfk
 			class StaticFieldImpl;
 
 			RFK_GEN_GET_PIMPL(StaticFieldImpl, Entity::getPimpl())
-	};
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<StaticField const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<StaticField const*, rfk::Allocator<StaticField const*>>);
+		friend internal::MemoryFootprintCollector;
+	};
 
 	#include "Refureku/TypeInfo/Variables/StaticField.inl"
 }
\ No newline at end of file
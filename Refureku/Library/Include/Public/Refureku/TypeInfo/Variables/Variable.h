@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Refureku/TypeInfo/Entity/EntityVectors.h"
 #include "Refureku/TypeInfo/Variables/VariableBase.h"
 #include "Refureku/TypeInfo/Variables/EVarFlags.h"
 
@@ -106,14 +107,13 @@ namespace rfk
 			class VariableImpl;
 
 			RFK_GEN_GET_PIMPL(VariableImpl, Entity::getPimpl())
+
+		friend internal::MemoryFootprintCollector;
 	};
 
 	/** Base implementation of getVariable, specialized for each reflected variable. */
 	template <auto VarPtr>
 	Variable const* getVariable() noexcept;
 
-	REFUREKU_TEMPLATE_API(rfk::Allocator<Variable const*>);
-	REFUREKU_TEMPLATE_API(rfk::Vector<Variable const*, rfk::Allocator<Variable const*>>);
-
 	#include "Refureku/TypeInfo/Variables/Variable.inl"
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "Refureku/Misc/MemoryArena.h"
+
+#include <new>	//operator new, operator delete
+
+using namespace rfk;
+
+MemoryArena::MemoryArena(std::size_t chunkSize) noexcept:
+	_firstChunk{nullptr},
+	_currentChunk{nullptr},
+	_cursor{0u},
+	_end{0u},
+	_chunkSize{chunkSize}
+{
+}
+
+MemoryArena::~MemoryArena()
+{
+	Chunk* chunk = _firstChunk;
+
+	while (chunk != nullptr)
+	{
+		Chunk* next = chunk->next;
+
+		::operator delete(chunk);
+
+		chunk = next;
+	}
+}
+
+std::uintptr_t MemoryArena::getChunkData(Chunk* chunk) noexcept
+{
+	return reinterpret_cast<std::uintptr_t>(chunk + 1);
+}
+
+void MemoryArena::setCurrentChunk(Chunk* chunk) noexcept
+{
+	_currentChunk	= chunk;
+	_cursor			= getChunkData(chunk);
+	_end			= _cursor + chunk->capacity;
+}
+
+void* MemoryArena::allocateFromNextChunk(std::size_t size, std::size_t alignment)
+{
+	//Worst case padding to align the allocation at the beginning of a chunk
+	std::size_t	requiredCapacity = size + alignment - 1u;
+	Chunk*		next = (_currentChunk != nullptr) ? _currentChunk->next : _firstChunk;
+
+	if (next == nullptr || next->capacity < requiredCapacity)
+	{
+		std::size_t capacity	= (requiredCapacity > _chunkSize) ? requiredCapacity : _chunkSize;
+		Chunk*		newChunk	= static_cast<Chunk*>(::operator new(sizeof(Chunk) + capacity));
+
+		newChunk->next		= next;
+		newChunk->capacity	= capacity;
+
+		//Insert the new chunk after the current chunk so that the chunks following it are still reused
+		if (_currentChunk != nullptr)
+		{
+			_currentChunk->next = newChunk;
+		}
+		else
+		{
+			_firstChunk = newChunk;
+		}
+
+		next = newChunk;
+	}
+
+	setCurrentChunk(next);
+
+	return allocate(size, alignment);
+}
+
+void MemoryArena::reset() noexcept
+{
+	if (_firstChunk != nullptr)
+	{
+		setCurrentChunk(_firstChunk);
+	}
+}
+
+std::size_t MemoryArena::getReservedBytes() const noexcept
+{
+	std::size_t result = 0u;
+
+	for (Chunk* chunk = _firstChunk; chunk != nullptr; chunk = chunk->next)
+	{
+		result += sizeof(Chunk) + chunk->capacity;
+	}
+
+	return result;
+}
\ No newline at end of file
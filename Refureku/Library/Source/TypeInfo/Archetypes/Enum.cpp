@@ -1,9 +1,8 @@
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 
-#include <cstring> //std::strcmp
-
 #include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
 #include "Refureku/Misc/Algorithm.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
 
 using namespace rfk;
 
@@ -29,18 +28,12 @@ void Enum::setEnumValuesCapacity(std::size_t capacity) noexcept
 
 EnumValue const* Enum::getEnumValueByName(char const* name) const noexcept
 {
-	return (name != nullptr) ? Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [name](EnumValue const& ev)
-											   {
-												   return std::strcmp(ev.getName(), name) == 0;
-											   }) : nullptr;
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, (name != nullptr) ? getPimpl()->getEnumValueByName(name) : nullptr);
 }
 
 EnumValue const* Enum::getEnumValue(int64 value) const noexcept
 {
-	return Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-											   {
-												   return ev.getValue() == value;
-											   });
+	return getPimpl()->getEnumValue(value);
 }
 
 EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, void* userData) const
@@ -50,10 +43,12 @@ EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, v
 
 Vector<EnumValue const*> Enum::getEnumValues(int64 value) const noexcept
 {
-	return Algorithm::getItemsByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-												 {
-													 return ev.getValue() == value;
-												 });
+	return getPimpl()->getEnumValues(value);
+}
+
+std::size_t Enum::getEnumValues(int64 value, EnumValue const** outEnumValues, std::size_t capacity) const noexcept
+{
+	return getPimpl()->getEnumValues(value, outEnumValues, capacity);
 }
 
 Vector<EnumValue const*> Enum::getEnumValuesByPredicate(Predicate<EnumValue> predicate, void* userData) const
@@ -71,6 +66,13 @@ std::size_t Enum::getEnumValuesCount() const noexcept
 	return getPimpl()->getEnumValues().size();
 }
 
+Span<EnumValue const> Enum::getEnumValuesSpan() const noexcept
+{
+	auto const& enumValues = getPimpl()->getEnumValues();
+
+	return Span<EnumValue const>(enumValues.data(), enumValues.size());
+}
+
 Archetype const& Enum::getUnderlyingArchetype() const noexcept
 {
 	return getPimpl()->getUnderlyingArchetype();
@@ -1,8 +1,15 @@
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 
+#include <cstring>	//std::memcpy
+
 #include "Refureku/TypeInfo/Archetypes/StructImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/Misc/Algorithm.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
+
+#if !RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Archetypes/StructHotGetters.inl"
+#endif
 
 using namespace rfk;
 
@@ -83,16 +90,34 @@ rfk::Vector<Struct const*> Struct::getDirectSubclasses() const noexcept
 	return result;
 }
 
-bool Struct::isSubclassOf(Struct const& archetype) const noexcept
+std::size_t Struct::getSubclassesCount() const noexcept
+{
+	return getPimpl()->getSubclasses().size();
+}
+
+bool Struct::foreachSubclass(Visitor<Struct> visitor, void* userData) const
 {
-	return &archetype != this && archetype.isBaseOf(*this);
+	if (visitor != nullptr)
+	{
+		for (auto const& [subclass, subclassData] : getPimpl()->getSubclasses())
+		{
+			if (!visitor(*subclass, userData))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	return false;
 }
 
-bool Struct::isBaseOf(Struct const& archetype) const noexcept
+bool Struct::hasSubclass(Struct const& archetype) const noexcept
 {
 	auto const& subclasses = getPimpl()->getSubclasses();
 
-	return &archetype == this || subclasses.find(&archetype) != subclasses.cend();
+	return subclasses.find(&archetype) != subclasses.cend();
 }
 
 EClassKind Struct::getClassKind() const noexcept
@@ -100,6 +125,41 @@ EClassKind Struct::getClassKind() const noexcept
 	return getPimpl()->getClassKind();
 }
 
+Struct::Destructor Struct::getDestructor() const noexcept
+{
+	return getPimpl()->getDestructor();
+}
+
+std::size_t Struct::getMemoryAlignment() const noexcept
+{
+	return getPimpl()->getMemoryAlignment();
+}
+
+Struct::CopyConstructor Struct::getCopyConstructor() const noexcept
+{
+	return getPimpl()->getCopyConstructor();
+}
+
+Struct::MoveConstructor Struct::getMoveConstructor() const noexcept
+{
+	return getPimpl()->getMoveConstructor();
+}
+
+Struct::CopyAssignment Struct::getCopyAssignment() const noexcept
+{
+	return getPimpl()->getCopyAssignment();
+}
+
+Struct::MoveAssignment Struct::getMoveAssignment() const noexcept
+{
+	return getPimpl()->getMoveAssignment();
+}
+
+EStructTraits Struct::getTraits() const noexcept
+{
+	return getPimpl()->getTraits();
+}
+
 bool Struct::getPointerOffset(Struct const& to, std::ptrdiff_t& out_pointerOffset) const noexcept
 {
 	//This method is used for downcast in most cases, so search in the parent first.
@@ -139,6 +199,13 @@ std::size_t Struct::getDirectParentsCount() const noexcept
 	return getPimpl()->getDirectParents().size();
 }
 
+Span<ParentStruct const> Struct::getDirectParentsSpan() const noexcept
+{
+	auto const& directParents = getPimpl()->getDirectParents();
+
+	return Span<ParentStruct const>(directParents.data(), directParents.size());
+}
+
 bool Struct::foreachDirectParent(Visitor<ParentStruct> visitor, void* userData) const
 {
 	return Algorithm::foreach(getPimpl()->getDirectParents(), visitor, userData);
@@ -148,9 +215,9 @@ Struct const* Struct::getNestedStructByName(char const* name, EAccessSpecifier a
 {
 	Archetype const* foundArchetype = getPimpl()->getNestedArchetype(name, access);
 
-	return (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Struct) ?
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Struct) ?
 				reinterpret_cast<Struct const*>(foundArchetype) :
-				nullptr;
+				nullptr);
 }
 
 Struct const* Struct::getNestedStructByPredicate(Predicate<Struct> predicate, void* userData) const
@@ -184,9 +251,9 @@ Class const* Struct::getNestedClassByName(char const* name, EAccessSpecifier acc
 {
 	Archetype const* foundArchetype = getPimpl()->getNestedArchetype(name, access);
 
-	return (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Class) ?
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Class) ?
 				reinterpret_cast<Class const*>(foundArchetype) :
-				nullptr;
+				nullptr);
 }
 
 Class const* Struct::getNestedClassByPredicate(Predicate<Class> predicate, void* userData) const
@@ -220,9 +287,9 @@ Enum const* Struct::getNestedEnumByName(char const* name, EAccessSpecifier acces
 {
 	Archetype const* foundArchetype = getPimpl()->getNestedArchetype(name, access);
 
-	return (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Enum) ?
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, (foundArchetype != nullptr && foundArchetype->getKind() == EEntityKind::Enum) ?
 				reinterpret_cast<Enum const*>(foundArchetype) :
-				nullptr;
+				nullptr);
 }
 
 Enum const* Struct::getNestedEnumByPredicate(Predicate<Enum> predicate, void* userData) const
@@ -287,7 +354,7 @@ Field const* Struct::getFieldByName(char const* name, EFieldFlags minFlags, bool
 										  return true;
 									  });
 
-	return result;
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 }
 
 Field const* Struct::getFieldByPredicate(Predicate<Field> predicate, void* userData, bool shouldInspectInherited) const
@@ -354,6 +421,13 @@ std::size_t Struct::getFieldsCount() const noexcept
 	return getPimpl()->getFields().size();
 }
 
+Span<Field const* const> Struct::getFieldsSpan() const noexcept
+{
+	auto const& flatFields = getPimpl()->getFlatFields();
+
+	return Span<Field const* const>(flatFields.data(), flatFields.size());
+}
+
 StaticField const* Struct::getStaticFieldByName(char const* name, EFieldFlags minFlags, bool shouldInspectInherited) const noexcept
 {
 	StaticField const* result = nullptr;
@@ -379,7 +453,7 @@ StaticField const* Struct::getStaticFieldByName(char const* name, EFieldFlags mi
 										  return true;
 									  });
 
-	return result;
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 }
 
 StaticField const* Struct::getStaticFieldByPredicate(Predicate<StaticField> predicate, void* userData, bool shouldInspectInherited) const
@@ -422,6 +496,13 @@ std::size_t Struct::getStaticFieldsCount() const noexcept
 	return getPimpl()->getStaticFields().size();
 }
 
+Span<StaticField const* const> Struct::getStaticFieldsSpan() const noexcept
+{
+	auto const& flatStaticFields = getPimpl()->getFlatStaticFields();
+
+	return Span<StaticField const* const>(flatStaticFields.data(), flatStaticFields.size());
+}
+
 Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
 {
 	Method const* result = nullptr;
@@ -442,7 +523,7 @@ Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, b
 
 	if (foundMethod)
 	{
-		return result;
+		return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 	}
 	else
 	{
@@ -453,6 +534,7 @@ Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, b
 			{
 				result = parent.getArchetype().getMethodByName(name, minFlags, true);
 
+				//The parent lookup already accounted the found method
 				if (result != nullptr)
 				{
 					return result;
@@ -460,7 +542,8 @@ Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, b
 			}
 		}
 
-		return nullptr;
+		//result is nullptr here, so the lookup is accounted as failed
+		return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 	}
 }
 
@@ -493,6 +576,41 @@ Vector<Method const*> Struct::getMethodsByName(char const* name, EMethodFlags mi
 	return result;
 }
 
+std::size_t Struct::getMethodsByName(char const* name, Method const** outMethods, std::size_t capacity, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
+{
+	std::size_t found = 0u;
+
+	Algorithm::foreachEntityNamed(getPimpl()->getMethods(),
+									 name,
+									 [&found, outMethods, capacity, minFlags](Method const& method)
+									 {
+										 if ((method.getFlags() & minFlags) == minFlags)
+										 {
+											 //Keep counting methodss once the buffer is full so that the caller knows the required capacity
+											 if (found < capacity)
+											 {
+												 outMethods[found] = &method;
+											 }
+
+											 found++;
+										 }
+
+										 return true;
+									 });
+
+	if (shouldInspectInherited)
+	{
+		for (ParentStruct const& parent : getPimpl()->getDirectParents())
+		{
+			std::size_t written = (found < capacity) ? found : capacity;
+
+			found += parent.getArchetype().getMethodsByName(name, outMethods + written, capacity - written, minFlags, true);
+		}
+	}
+
+	return found;
+}
+
 Method const* Struct::getMethodByPredicate(Predicate<Method> predicate, void* userData, bool shouldInspectInherited) const
 {
 	if (predicate != nullptr)
@@ -569,6 +687,13 @@ std::size_t Struct::getMethodsCount() const noexcept
 	return getPimpl()->getMethods().size();
 }
 
+Span<Method const* const> Struct::getMethodsSpan() const noexcept
+{
+	auto const& flatMethods = getPimpl()->getFlatMethods();
+
+	return Span<Method const* const>(flatMethods.data(), flatMethods.size());
+}
+
 StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
 {
 	StaticMethod const*	result = nullptr;
@@ -589,7 +714,7 @@ StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags
 
 	if (foundMethod)
 	{
-		return result;
+		return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 	}
 	else
 	{
@@ -600,6 +725,7 @@ StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags
 			{
 				result = parent.getArchetype().getStaticMethodByName(name, minFlags, true);
 
+				//The parent lookup already accounted the found method
 				if (result != nullptr)
 				{
 					return result;
@@ -607,7 +733,8 @@ StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags
 			}
 		}
 
-		return nullptr;
+		//result is nullptr here, so the lookup is accounted as failed
+		return RFK_INSTRUMENT_NAME_LOOKUP(this, result);
 	}
 }
 
@@ -641,6 +768,41 @@ Vector<StaticMethod const*> Struct::getStaticMethodsByName(char const* name, EMe
 	return result;
 }
 
+std::size_t Struct::getStaticMethodsByName(char const* name, StaticMethod const** outStaticMethods, std::size_t capacity, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
+{
+	std::size_t found = 0u;
+
+	Algorithm::foreachEntityNamed(getPimpl()->getStaticMethods(),
+									 name,
+									 [&found, outStaticMethods, capacity, minFlags](StaticMethod const& staticMethod)
+									 {
+										 if ((staticMethod.getFlags() & minFlags) == minFlags)
+										 {
+											 //Keep counting static methodss once the buffer is full so that the caller knows the required capacity
+											 if (found < capacity)
+											 {
+												 outStaticMethods[found] = &staticMethod;
+											 }
+
+											 found++;
+										 }
+
+										 return true;
+									 });
+
+	if (shouldInspectInherited)
+	{
+		for (ParentStruct const& parent : getPimpl()->getDirectParents())
+		{
+			std::size_t written = (found < capacity) ? found : capacity;
+
+			found += parent.getArchetype().getStaticMethodsByName(name, outStaticMethods + written, capacity - written, minFlags, true);
+		}
+	}
+
+	return found;
+}
+
 StaticMethod const* Struct::getStaticMethodByPredicate(Predicate<StaticMethod> predicate, void* userData, bool shouldInspectInherited) const
 {
 	if (predicate != nullptr)
@@ -717,6 +879,13 @@ std::size_t Struct::getStaticMethodsCount() const noexcept
 	return getPimpl()->getStaticMethods().size();
 }
 
+Span<StaticMethod const* const> Struct::getStaticMethodsSpan() const noexcept
+{
+	auto const& flatStaticMethods = getPimpl()->getFlatStaticMethods();
+
+	return Span<StaticMethod const* const>(flatStaticMethods.data(), flatStaticMethods.size());
+}
+
 void Struct::addDirectParent(Archetype const* archetype, EAccessSpecifier inheritanceAccess) noexcept
 {
 	if (archetype != nullptr)
@@ -800,7 +969,6 @@ void Struct::setStaticMethodsCapacity(std::size_t capacity) noexcept
 	return getPimpl()->setStaticMethodsCapacity(capacity);
 }
 
-
 bool Struct::foreachSharedInstantiator(std::size_t argCount, Visitor<StaticMethod> visitor, void* userData) const
 {
 	bool result = true;
@@ -863,6 +1031,40 @@ bool Struct::foreachUniqueInstantiator(std::size_t argCount, Visitor<StaticMetho
 	return result;
 }
 
+bool Struct::foreachPlacementInstantiator(std::size_t argCount, Visitor<StaticMethod> visitor, void* userData) const
+{
+	bool result = true;
+
+	//Placement instantiators take the memory as an additional first parameter
+	std::size_t expectedParamCounts = argCount + 1u;
+
+	Algorithm::foreach(getPimpl()->getPlacementInstantiators(), [&result, expectedParamCounts, visitor, userData](StaticMethod const& instantiator)
+					   {
+						   std::size_t instantiatorParamCounts = instantiator.getParametersCount();
+
+						   //Instantiators are ordered by ascending param counts, so skip all
+						   //instantiators having less than the required arg count
+						   if (instantiatorParamCounts < expectedParamCounts)
+						   {
+							   return true;
+						   }
+						   else if (instantiatorParamCounts == expectedParamCounts)
+						   {
+							   //Run the visitor on each instantiator having the same arg count
+							   result = visitor(instantiator, userData);
+							   return result;
+						   }
+						   else //instantiatorParamCounts > expectedParamCounts
+						   {
+							   //Abort the foreach loop once we reach elements that have a greater
+							   //arg count
+							   return false;
+						   }
+					   });
+
+	return result;
+}
+
 void Struct::addSharedInstantiator(StaticMethod const& instantiator) noexcept
 {
 	getPimpl()->addSharedInstantiator(instantiator);
@@ -871,4 +1073,157 @@ void Struct::addSharedInstantiator(StaticMethod const& instantiator) noexcept
 void Struct::addUniqueInstantiator(StaticMethod const& instantiator) noexcept
 {
 	getPimpl()->addUniqueInstantiator(instantiator);
+}
+
+void Struct::addPlacementInstantiator(StaticMethod const& instantiator) noexcept
+{
+	getPimpl()->addPlacementInstantiator(instantiator);
+}
+
+void Struct::setDestructor(Destructor destructor) noexcept
+{
+	getPimpl()->setDestructor(destructor);
+}
+
+void Struct::setMemoryAlignment(std::size_t alignment) noexcept
+{
+	getPimpl()->setMemoryAlignment(alignment);
+}
+
+void Struct::setCopyConstructor(CopyConstructor copyConstructor) noexcept
+{
+	getPimpl()->setCopyConstructor(copyConstructor);
+}
+
+void Struct::setMoveConstructor(MoveConstructor moveConstructor) noexcept
+{
+	getPimpl()->setMoveConstructor(moveConstructor);
+}
+
+void Struct::setCopyAssignment(CopyAssignment copyAssignment) noexcept
+{
+	getPimpl()->setCopyAssignment(copyAssignment);
+}
+
+void Struct::setMoveAssignment(MoveAssignment moveAssignment) noexcept
+{
+	getPimpl()->setMoveAssignment(moveAssignment);
+}
+
+void Struct::setTraits(EStructTraits traits) noexcept
+{
+	getPimpl()->setTraits(traits);
+}
+
+void Struct::destroyInstanceAt(void* instance) const noexcept
+{
+	Destructor destructor = getPimpl()->getDestructor();
+
+	if (destructor != nullptr)
+	{
+		destructor(instance);
+	}
+}
+
+bool Struct::copyConstructAt(void* destination, void const* source, std::size_t count) const
+{
+	if ((getPimpl()->getTraits() & EStructTraits::TriviallyCopyConstructible) == EStructTraits::TriviallyCopyConstructible)
+	{
+		std::memcpy(destination, source, count * getMemorySize());
+	}
+	else if (getPimpl()->getCopyConstructor() != nullptr)
+	{
+		getPimpl()->getCopyConstructor()(destination, source, count);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool Struct::moveConstructAt(void* destination, void* source, std::size_t count) const
+{
+	if ((getPimpl()->getTraits() & EStructTraits::TriviallyMoveConstructible) == EStructTraits::TriviallyMoveConstructible)
+	{
+		std::memcpy(destination, source, count * getMemorySize());
+	}
+	else if (getPimpl()->getMoveConstructor() != nullptr)
+	{
+		getPimpl()->getMoveConstructor()(destination, source, count);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool Struct::relocateAt(void* destination, void* source, std::size_t count) const
+{
+	if ((getPimpl()->getTraits() & EStructTraits::TriviallyRelocatable) == EStructTraits::TriviallyRelocatable)
+	{
+		std::memcpy(destination, source, count * getMemorySize());
+	}
+	else if (getPimpl()->getMoveConstructor() != nullptr)
+	{
+		getPimpl()->getMoveConstructor()(destination, source, count);
+
+		//Destroy the moved-from instances
+		Destructor destructor = getPimpl()->getDestructor();
+
+		if (destructor != nullptr)
+		{
+			std::size_t memorySize = getMemorySize();
+
+			for (std::size_t i = 0u; i < count; i++)
+			{
+				destructor(static_cast<char*>(source) + i * memorySize);
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool Struct::copyAssign(void* destination, void const* source, std::size_t count) const
+{
+	if ((getPimpl()->getTraits() & EStructTraits::TriviallyCopyAssignable) == EStructTraits::TriviallyCopyAssignable)
+	{
+		std::memcpy(destination, source, count * getMemorySize());
+	}
+	else if (getPimpl()->getCopyAssignment() != nullptr)
+	{
+		getPimpl()->getCopyAssignment()(destination, source, count);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool Struct::moveAssign(void* destination, void* source, std::size_t count) const
+{
+	if ((getPimpl()->getTraits() & EStructTraits::TriviallyMoveAssignable) == EStructTraits::TriviallyMoveAssignable)
+	{
+		std::memcpy(destination, source, count * getMemorySize());
+	}
+	else if (getPimpl()->getMoveAssignment() != nullptr)
+	{
+		getPimpl()->getMoveAssignment()(destination, source, count);
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
 }
\ No newline at end of file
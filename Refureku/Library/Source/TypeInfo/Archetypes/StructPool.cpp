@@ -0,0 +1,73 @@
+#include "Refureku/TypeInfo/Archetypes/StructPool.h"
+
+#include <memory>	//std::unique_ptr
+
+#include "Refureku/TypeInfo/Archetypes/StructPoolImpl.h"
+
+using namespace rfk;
+
+StructPool::StructPool(Struct const& archetype, std::size_t slabInstancesCount) noexcept:
+	_pimpl(new internal::StructPoolImpl(archetype, slabInstancesCount))
+{
+}
+
+StructPool::~StructPool() noexcept = default;
+
+void* StructPool::allocate() noexcept
+{
+	return _pimpl->allocate();
+}
+
+void StructPool::deallocate(void* memory) noexcept
+{
+	if (memory != nullptr)
+	{
+		_pimpl->deallocate(memory);
+	}
+}
+
+void StructPool::destroyInstance(void* memory) noexcept
+{
+	if (memory != nullptr)
+	{
+		_pimpl->getArchetype().destroyInstanceAt(memory);
+		_pimpl->deallocate(memory);
+	}
+}
+
+Struct const& StructPool::getArchetype() const noexcept
+{
+	return _pimpl->getArchetype();
+}
+
+std::size_t StructPool::getSlotSize() const noexcept
+{
+	return _pimpl->getSlotSize();
+}
+
+std::size_t StructPool::getSlabsCount() const noexcept
+{
+	return _pimpl->getSlabsCount();
+}
+
+std::size_t StructPool::getCapacity() const noexcept
+{
+	return _pimpl->getSlabsCount() * _pimpl->getSlabInstancesCount();
+}
+
+StructPool& rfk::getStructPool(Struct const& archetype)
+{
+	static std::mutex															mutex;
+	static std::unordered_map<Struct const*, std::unique_ptr<StructPool>>	pools;
+
+	std::lock_guard lock(mutex);
+
+	std::unique_ptr<StructPool>& pool = pools[&archetype];
+
+	if (pool == nullptr)
+	{
+		pool = std::make_unique<StructPool>(archetype);
+	}
+
+	return *pool;
+}
\ No newline at end of file
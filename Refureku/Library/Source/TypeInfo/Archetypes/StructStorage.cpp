@@ -0,0 +1,87 @@
+#include "Refureku/TypeInfo/Archetypes/StructStorage.h"
+
+#include "Refureku/TypeInfo/Archetypes/StructStorageImpl.h"
+
+using namespace rfk;
+
+StructStorage::StructStorage(Struct const& archetype, EStructStorageLayout layout, std::size_t chunkInstancesCount) noexcept:
+	_pimpl(new internal::StructStorageImpl(archetype, layout, chunkInstancesCount))
+{
+}
+
+StructStorage::~StructStorage() noexcept = default;
+
+bool StructStorage::isLayoutSupported(Struct const& archetype, EStructStorageLayout layout) noexcept
+{
+	return internal::StructStorageImpl::isLayoutSupported(archetype, layout);
+}
+
+bool StructStorage::pushBackCopies(void const* sources, std::size_t count)
+{
+	return _pimpl->pushBackCopies(sources, count);
+}
+
+bool StructStorage::swapRemove(std::size_t index)
+{
+	return _pimpl->swapRemove(index);
+}
+
+void StructStorage::clear() noexcept
+{
+	_pimpl->clear();
+}
+
+void* StructStorage::getInstanceAt(std::size_t index) const noexcept
+{
+	return _pimpl->getInstanceAt(index);
+}
+
+void* StructStorage::getFieldAt(Field const& field, std::size_t index) const noexcept
+{
+	return _pimpl->getFieldAt(field, index);
+}
+
+Struct const& StructStorage::getArchetype() const noexcept
+{
+	return _pimpl->getArchetype();
+}
+
+EStructStorageLayout StructStorage::getLayout() const noexcept
+{
+	return _pimpl->getLayout();
+}
+
+std::size_t StructStorage::getInstancesCount() const noexcept
+{
+	return _pimpl->getInstancesCount();
+}
+
+std::size_t StructStorage::getChunkInstancesCount() const noexcept
+{
+	return _pimpl->getChunkInstancesCount();
+}
+
+std::size_t StructStorage::getChunksCount() const noexcept
+{
+	return _pimpl->getChunksCount();
+}
+
+std::size_t StructStorage::getChunkSize(std::size_t chunkIndex) const noexcept
+{
+	return _pimpl->getChunkSize(chunkIndex);
+}
+
+void* StructStorage::reserveBack() noexcept
+{
+	return _pimpl->reserveBack();
+}
+
+void StructStorage::commitBack() noexcept
+{
+	_pimpl->commitBack();
+}
+
+void* StructStorage::getFieldData(Field const& field, std::size_t chunkIndex, std::size_t& out_stride) const noexcept
+{
+	return _pimpl->getFieldData(field, chunkIndex, out_stride);
+}
\ No newline at end of file
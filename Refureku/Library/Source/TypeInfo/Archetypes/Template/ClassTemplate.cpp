@@ -1,5 +1,7 @@
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
 
+#include <algorithm>	//std::find
+
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateArgument.h"
 #include "Refureku/Misc/Algorithm.h"
@@ -30,8 +32,19 @@ std::size_t ClassTemplate::getTemplateInstantiationsCount() const noexcept
 
 ClassTemplateInstantiation const* ClassTemplate::getTemplateInstantiation(TemplateArgument const** firstArg, std::size_t argsCount) const noexcept
 {
-	if (firstArg != nullptr)
+	if (firstArg != nullptr && argsCount != 0u)
 	{
+		//Use the template arguments index when all arguments are provided (no wildcard)
+		if (argsCount == getTemplateParametersCount() && std::find(firstArg, firstArg + argsCount, nullptr) == firstArg + argsCount)
+		{
+			ClassTemplateInstantiation const* result = getPimpl()->getIndexedTemplateInstantiation(firstArg, argsCount);
+
+			if (result != nullptr || getPimpl()->areAllTemplateInstantiationsIndexed())
+			{
+				return result;
+			}
+		}
+
 		for (ClassTemplateInstantiation const* instantiation : getPimpl()->getTemplateInstantiations())
 		{
 			for (std::size_t i = 0u; i < argsCount; i++)
@@ -1,6 +1,7 @@
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiation.h"
 
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiationImpl.h"
+#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.h"
 #include "Refureku/Misc/Algorithm.h"
 
 using namespace rfk;
@@ -43,4 +44,12 @@ std::size_t ClassTemplateInstantiation::getTemplateArgumentsCount() const noexce
 void ClassTemplateInstantiation::addTemplateArgument(TemplateArgument const& argument) noexcept
 {
 	getPimpl()->addTemplateArgument(argument);
+
+	//Index this instantiation in its class template as soon as all its template arguments are known
+	ClassTemplate& classTemplate = const_cast<ClassTemplate&>(getPimpl()->getClassTemplate());
+
+	if (getPimpl()->getTemplateArguments().size() == classTemplate.getTemplateParametersCount())
+	{
+		classTemplate.getPimpl()->indexTemplateInstantiation(*this);
+	}
 }
\ No newline at end of file
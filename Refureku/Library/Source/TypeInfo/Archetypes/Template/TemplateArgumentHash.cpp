@@ -0,0 +1,76 @@
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateArgumentHash.h"
+
+#include <cstring>		//std::memcpy
+#include <string_view>	//std::hash<std::string_view>
+
+#include "Refureku/TypeInfo/Archetypes/Template/ETemplateParameterKind.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TypeTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Archetype.h"
+#include "Refureku/TypeInfo/Type.h"
+
+using namespace rfk;
+
+std::size_t TemplateArgumentHash::combineHash(std::size_t seed, std::size_t value) noexcept
+{
+	return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+std::size_t TemplateArgumentHash::operator()(TemplateArgument const& argument) const noexcept
+{
+	std::size_t result = static_cast<std::size_t>(argument.getKind());
+
+	switch (argument.getKind())
+	{
+		case ETemplateParameterKind::TypeTemplateParameter:
+		{
+			//Hash the archetype and the raw type parts, just like Type::operator== compares them
+			Type const& type = static_cast<TypeTemplateArgument const&>(argument).getType();
+			result = combineHash(result, std::hash<Archetype const*>()(type.getArchetype()));
+
+			for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+			{
+				uint64 rawPart;
+				std::memcpy(&rawPart, &type.getTypePartAt(i), sizeof(TypePart));
+
+				result = combineHash(result, std::hash<uint64>()(rawPart));
+			}
+
+			break;
+		}
+
+		case ETemplateParameterKind::NonTypeTemplateParameter:
+		{
+			//Hash the archetype and the raw value bytes, just like NonTypeTemplateArgument::operator== compares them
+			NonTypeTemplateArgument const& nonTypeArgument = static_cast<NonTypeTemplateArgument const&>(argument);
+			result = combineHash(result, std::hash<Archetype const*>()(nonTypeArgument.getArchetype()));
+
+			if (nonTypeArgument.getArchetype() != nullptr)
+			{
+				result = combineHash(result, std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(nonTypeArgument.getValuePtr()),
+																						   nonTypeArgument.getArchetype()->getMemorySize())));
+			}
+
+			break;
+		}
+
+		case ETemplateParameterKind::TemplateTemplateParameter:
+			result = combineHash(result, std::hash<ClassTemplate const*>()(static_cast<TemplateTemplateArgument const&>(argument).getClassTemplate()));
+			break;
+	}
+
+	return result;
+}
+
+std::size_t TemplateArgumentHash::operator()(TemplateArgument const* const* args, std::size_t argsCount) const noexcept
+{
+	std::size_t result = argsCount;
+
+	for (std::size_t i = 0u; i < argsCount; i++)
+	{
+		result = combineHash(result, (*this)(*args[i]));
+	}
+
+	return result;
+}
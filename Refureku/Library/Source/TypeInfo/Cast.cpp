@@ -1,34 +1,14 @@
 #include "Refureku/TypeInfo/Cast.h"
 
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
 
 using namespace rfk;
 
-void* internal::dynamicCast(void* instance, Struct const& instanceStaticArchetype,
-				  Struct const& instanceDynamicArchetype, Struct const& targetArchetype) noexcept
-{
-	return const_cast<void*>(internal::dynamicCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, instanceDynamicArchetype, targetArchetype));
-}
-
-void const* internal::dynamicCast(void const* instance, Struct const& instanceStaticArchetype,
-						Struct const& instanceDynamicArchetype, Struct const& targetArchetype) noexcept
-{
-	//TODO: Optimization if the concrete type has a single branch inheritance tree: don't perform this intermediate computation
-
-	void const* adjustedStaticToDynamicInstancePointer = internal::dynamicDownCast(instance, instanceStaticArchetype, instanceDynamicArchetype);
-
-	// --------------------------------------------------------------------
-
-	//Try to upcast the concrete type of instance to TargetClassType
-	return internal::dynamicUpCast(adjustedStaticToDynamicInstancePointer, instanceDynamicArchetype, targetArchetype);
-}
-
-void* internal::dynamicUpCast(void* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
-{
-	return const_cast<void*>(internal::dynamicUpCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, targetArchetype));
-}
-
-void const* internal::dynamicUpCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+/**
+*	@brief Uninstrumented upcast, shared by dynamicUpCast and dynamicCast so that each public cast is accounted once.
+*/
+static void const* upCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
 {
 	//If both both source and target types have the same archetype or instance is nullptr, there's no offset to perform
 	if (instance == nullptr || instanceStaticArchetype == targetArchetype)
@@ -48,12 +28,10 @@ void const* internal::dynamicUpCast(void const* instance, Struct const& instance
 	return nullptr;
 }
 
-void* internal::dynamicDownCast(void* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
-{
-	return const_cast<void*>(internal::dynamicDownCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, targetArchetype));
-}
-
-void const* internal::dynamicDownCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+/**
+*	@brief Uninstrumented downcast, shared by dynamicDownCast and dynamicCast so that each public cast is accounted once.
+*/
+static void const* downCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
 {
 	//If both both source and target types have the same archetype, there's no offset to perform
 	if (instance == nullptr || instanceStaticArchetype == targetArchetype)
@@ -71,4 +49,49 @@ void const* internal::dynamicDownCast(void const* instance, Struct const& instan
 	}
 
 	return nullptr;
+}
+
+void* internal::dynamicCast(void* instance, Struct const& instanceStaticArchetype,
+				  Struct const& instanceDynamicArchetype, Struct const& targetArchetype) noexcept
+{
+	return const_cast<void*>(internal::dynamicCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, instanceDynamicArchetype, targetArchetype));
+}
+
+void const* internal::dynamicCast(void const* instance, Struct const& instanceStaticArchetype,
+						Struct const& instanceDynamicArchetype, Struct const& targetArchetype) noexcept
+{
+	RFK_INSTRUMENT_EVENT(&targetArchetype, Cast);
+
+	//TODO: Optimization if the concrete type has a single branch inheritance tree: don't perform this intermediate computation
+
+	void const* adjustedStaticToDynamicInstancePointer = downCast(instance, instanceStaticArchetype, instanceDynamicArchetype);
+
+	// --------------------------------------------------------------------
+
+	//Try to upcast the concrete type of instance to TargetClassType
+	return upCast(adjustedStaticToDynamicInstancePointer, instanceDynamicArchetype, targetArchetype);
+}
+
+void* internal::dynamicUpCast(void* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+{
+	return const_cast<void*>(internal::dynamicUpCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, targetArchetype));
+}
+
+void const* internal::dynamicUpCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+{
+	RFK_INSTRUMENT_EVENT(&targetArchetype, Cast);
+
+	return upCast(instance, instanceStaticArchetype, targetArchetype);
+}
+
+void* internal::dynamicDownCast(void* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+{
+	return const_cast<void*>(internal::dynamicDownCast(reinterpret_cast<void const*>(instance), instanceStaticArchetype, targetArchetype));
+}
+
+void const* internal::dynamicDownCast(void const* instance, Struct const& instanceStaticArchetype, Struct const& targetArchetype) noexcept
+{
+	RFK_INSTRUMENT_EVENT(&targetArchetype, Cast);
+
+	return downCast(instance, instanceStaticArchetype, targetArchetype);
 }
\ No newline at end of file
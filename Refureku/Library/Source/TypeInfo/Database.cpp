@@ -1,14 +1,24 @@
 #include "Refureku/TypeInfo/Database.h"
 
 #include <string>
+#include <fstream>
+#include <algorithm>	//std::sort
 
 #include "Refureku/TypeInfo/DatabaseImpl.h"
 #include "Refureku/Misc/Algorithm.h"
+#include "Refureku/Misc/WorkStealingPool.h"
+#include "Refureku/TypeInfo/Snapshot/SnapshotWriter.h"
+#include "Refureku/TypeInfo/MemoryFootprintCollector.h"
+#include "Refureku/TypeInfo/InstrumentationRegistry.h"
+#include "Refureku/TypeInfo/RegistrationTracer.h"
 #include "Refureku/TypeInfo/Entity/EntityCast.h"
 #include "Refureku/Exceptions/BadNamespaceFormat.h"
 
 using namespace rfk;
 
+template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<uint8>;
+template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<uint8, rfk::Allocator<uint8>>;
+
 Database::Database() noexcept:
 	_pimpl(new DatabaseImpl())
 {
@@ -25,7 +35,7 @@ Database& Database::getInstance() noexcept
 
 Entity const* Database::getEntityById(std::size_t id) const noexcept
 {
-	return Algorithm::getEntityPtrById(_pimpl->getEntitiesById(), id);
+	return RFK_INSTRUMENT_ID_LOOKUP(Algorithm::getEntityPtrById(_pimpl->getEntitiesById(), id));
 }
 
 Namespace const* Database::getNamespaceById(std::size_t id) const noexcept
@@ -45,7 +55,8 @@ Namespace const* Database::getNamespaceByName(char const* name) const
 		throw BadNamespaceFormat("The provided namespace name is ill formed.");
 	}
 
-	Namespace const* result = Algorithm::getEntityByName(_pimpl->getFileLevelNamespacesByName(), namespaceName.substr(0u, index).data());
+	//Nested namespaces are accounted by Namespace::getNamespaceByName
+	Namespace const* result = RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByName(_pimpl->getFileLevelNamespacesByName(), namespaceName.substr(0u, index).data()));
 
 	//Couldn't find first namespace part, abort search
 	if (result == nullptr)
@@ -91,6 +102,11 @@ std::size_t Database::getFileLevelNamespacesCount() const noexcept
 	return _pimpl->getFileLevelNamespacesByName().size();
 }
 
+Span<Namespace const* const> Database::getFileLevelNamespacesSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelNamespaces().getSpan();
+}
+
 Archetype const* Database::getArchetypeById(std::size_t id) const noexcept
 {
 	return archetypeCast(getEntityById(id));
@@ -98,24 +114,25 @@ Archetype const* Database::getArchetypeById(std::size_t id) const noexcept
 
 Archetype const* Database::getFileLevelArchetypeByName(char const* name) const noexcept
 {
-	Archetype const* result = getFileLevelClassByName(name);
+	//Search the tables directly so that the intermediate misses are not accounted as failed lookups
+	Archetype const* result = Algorithm::getEntityByName(_pimpl->getFileLevelClassesByName(), name);
 
 	if (result == nullptr)
 	{
-		result = getFileLevelStructByName(name);
+		result = Algorithm::getEntityByName(_pimpl->getFileLevelStructsByName(), name);
 
 		if (result == nullptr)
 		{
-			result = getFileLevelEnumByName(name);
+			result = Algorithm::getEntityByName(_pimpl->getFileLevelEnumsByName(), name);
 
 			if (result == nullptr)
 			{
-				result = getFundamentalArchetypeByName(name);
+				result = Algorithm::getEntityByName(_pimpl->getFundamentalArchetypesByName(), name);
 			}
 		}
 	}
 
-	return result;
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, result);
 }
 
 Vector<Archetype const*> Database::getFileLevelArchetypesByPredicate(Predicate<Archetype> predicate, void* userData) const
@@ -137,7 +154,7 @@ Struct const* Database::getStructById(std::size_t id) const noexcept
 
 Struct const* Database::getFileLevelStructByName(char const* name) const noexcept
 {
-	return Algorithm::getEntityByName(_pimpl->getFileLevelStructsByName(), name);
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByName(_pimpl->getFileLevelStructsByName(), name));
 }
 
 Struct const* Database::getFileLevelStructByPredicate(Predicate<Struct>	predicate, void* userData) const
@@ -160,6 +177,11 @@ std::size_t Database::getFileLevelStructsCount() const noexcept
 	return _pimpl->getFileLevelStructsByName().size();
 }
 
+Span<Struct const* const> Database::getFileLevelStructsSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelStructs().getSpan();
+}
+
 Class const* Database::getClassById(std::size_t id) const noexcept
 {
 	return classCast(getEntityById(id));
@@ -167,7 +189,7 @@ Class const* Database::getClassById(std::size_t id) const noexcept
 
 Class const* Database::getFileLevelClassByName(char const* name) const noexcept
 {
-	return Algorithm::getEntityByName(_pimpl->getFileLevelClassesByName(), name);
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByName(_pimpl->getFileLevelClassesByName(), name));
 }
 
 Struct const* Database::getFileLevelClassByPredicate(Predicate<Struct>	predicate, void* userData) const
@@ -190,6 +212,11 @@ std::size_t Database::getFileLevelClassesCount() const noexcept
 	return _pimpl->getFileLevelClassesByName().size();
 }
 
+Span<Class const* const> Database::getFileLevelClassesSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelClasses().getSpan();
+}
+
 Enum const* Database::getEnumById(std::size_t id) const noexcept
 {
 	return enumCast(getEntityById(id));
@@ -197,7 +224,7 @@ Enum const* Database::getEnumById(std::size_t id) const noexcept
 
 Enum const* Database::getFileLevelEnumByName(char const* name) const noexcept
 {
-	return Algorithm::getEntityByName(_pimpl->getFileLevelEnumsByName(), name);
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByName(_pimpl->getFileLevelEnumsByName(), name));
 }
 
 Enum const* Database::getFileLevelEnumByPredicate(Predicate<Enum> predicate, void* userData) const
@@ -220,6 +247,11 @@ std::size_t Database::getFileLevelEnumsCount() const noexcept
 	return _pimpl->getFileLevelEnumsByName().size();
 }
 
+Span<Enum const* const> Database::getFileLevelEnumsSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelEnums().getSpan();
+}
+
 FundamentalArchetype const* Database::getFundamentalArchetypeById(std::size_t id) const noexcept
 {
 	return fundamentalArchetypeCast(getEntityById(id));
@@ -227,7 +259,7 @@ FundamentalArchetype const* Database::getFundamentalArchetypeById(std::size_t id
 
 FundamentalArchetype const* Database::getFundamentalArchetypeByName(char const* name) const noexcept
 {
-	return Algorithm::getEntityByName(_pimpl->getFundamentalArchetypesByName(), name);
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByName(_pimpl->getFundamentalArchetypesByName(), name));
 }
 
 Variable const* Database::getVariableById(std::size_t id) const noexcept
@@ -237,9 +269,9 @@ Variable const* Database::getVariableById(std::size_t id) const noexcept
 
 Variable const* Database::getFileLevelVariableByName(char const* name, EVarFlags flags) const noexcept
 {
-	return Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelVariablesByName(),
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelVariablesByName(),
 													  name,
-													  [flags](Variable const& var) { return (var.getFlags() & flags) == flags; });
+													  [flags](Variable const& var) { return (var.getFlags() & flags) == flags; }));
 }
 
 Variable const* Database::getFileLevelVariableByPredicate(Predicate<Variable> predicate, void* userData) const
@@ -262,6 +294,11 @@ std::size_t Database::getFileLevelVariablesCount() const noexcept
 	return _pimpl->getFileLevelVariablesByName().size();
 }
 
+Span<Variable const* const> Database::getFileLevelVariablesSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelVariables().getSpan();
+}
+
 Function const* Database::getFunctionById(std::size_t id) const noexcept
 {
 	return functionCast(getEntityById(id));
@@ -269,9 +306,9 @@ Function const* Database::getFunctionById(std::size_t id) const noexcept
 
 Function const* Database::getFileLevelFunctionByName(char const* name, EFunctionFlags flags) const noexcept
 {
-	return Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelFunctionsByName(),
+	return RFK_INSTRUMENT_NAME_LOOKUP(nullptr, Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelFunctionsByName(),
 													  name,
-													  [flags](Function const& func) { return (func.getFlags() & flags) == flags; });
+													  [flags](Function const& func) { return (func.getFlags() & flags) == flags; }));
 }
 
 Vector<Function const*> Database::getFileLevelFunctionsByName(char const* name, EFunctionFlags flags) const noexcept
@@ -301,6 +338,11 @@ std::size_t Database::getFileLevelFunctionsCount() const noexcept
 	return _pimpl->getFileLevelFunctionsByName().size();
 }
 
+Span<Function const* const> Database::getFileLevelFunctionsSpan() const noexcept
+{
+	return _pimpl->getFlatFileLevelFunctions().getSpan();
+}
+
 Method const* Database::getMethodById(std::size_t id) const noexcept
 {
 	return methodCast(getEntityById(id));
@@ -326,6 +368,211 @@ EnumValue const* Database::getEnumValueById(std::size_t id) const noexcept
 	return enumValueCast(getEntityById(id));
 }
 
+std::size_t Database::getEntityChunksCount() const noexcept
+{
+	return (_pimpl->getEntitiesById().bucket_count() + DatabaseImpl::bucketsPerEntityChunk - 1u) / DatabaseImpl::bucketsPerEntityChunk;
+}
+
+bool Database::parallelForeachEntityByChunk(EEntityKind kinds, ChunkVisitor<Entity> visitor, void* userData, std::size_t threadsCount) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	DatabaseImpl::EntitiesById const& entities = _pimpl->getEntitiesById();
+
+	//Chunks are ranges of buckets of the entities hash set, so that they can be iterated independently
+	return internal::WorkStealingPool::run(getEntityChunksCount(), threadsCount, [&entities, kinds, visitor, userData](std::size_t chunkIndex)
+										   {
+											   std::size_t firstBucket	= chunkIndex * DatabaseImpl::bucketsPerEntityChunk;
+											   std::size_t lastBucket	= std::min(firstBucket + DatabaseImpl::bucketsPerEntityChunk, entities.bucket_count());
+
+											   for (std::size_t bucket = firstBucket; bucket < lastBucket; bucket++)
+											   {
+												   for (auto it = entities.cbegin(bucket); it != entities.cend(bucket); it++)
+												   {
+													   if (((*it)->getKind() & kinds) != EEntityKind::Undefined && !visitor(**it, chunkIndex, userData))
+													   {
+														   return false;
+													   }
+												   }
+											   }
+
+											   return true;
+										   });
+}
+
+bool Database::parallelForeachEntity(EEntityKind kinds, Visitor<Entity> visitor, void* userData, std::size_t threadsCount) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	struct Data
+	{
+		Visitor<Entity>	visitor;
+		void*			userData;
+	};
+
+	Data data{visitor, userData};
+
+	return parallelForeachEntityByChunk(kinds, [](Entity const& entity, std::size_t /* chunkIndex */, void* userData)
+										{
+											Data const& data = *reinterpret_cast<Data const*>(userData);
+
+											return data.visitor(entity, data.userData);
+										}, &data, threadsCount);
+}
+
+bool Database::foreachEntityByNamePrefix(char const* prefix, EEntityKind kinds, Visitor<Entity> visitor, void* userData, bool isCaseSensitive, Entity const* outerEntity) const
+{
+	if (visitor == nullptr || prefix == nullptr)
+	{
+		return false;
+	}
+
+	return _pimpl->getNameIndex().foreachEntityByNamePrefix(_pimpl->getEntitiesById(), prefix, kinds, isCaseSensitive, outerEntity,
+															[visitor, userData](Entity const& entity)
+															{
+																return visitor(entity, userData);
+															});
+}
+
+Vector<Entity const*> Database::getEntitiesByNamePrefix(char const* prefix, EEntityKind kinds, std::size_t maxResults, bool isCaseSensitive, Entity const* outerEntity) const
+{
+	Vector<Entity const*> result;
+
+	if (prefix != nullptr)
+	{
+		_pimpl->getNameIndex().foreachEntityByNamePrefix(_pimpl->getEntitiesById(), prefix, kinds, isCaseSensitive, outerEntity,
+														 [&result, maxResults](Entity const& entity)
+														 {
+															 result.push_back(&entity);
+
+															 return result.size() != maxResults;
+														 });
+	}
+
+	return result;
+}
+
+Vector<uint8> Database::exportSnapshot() const
+{
+	return internal::SnapshotWriter::write(_pimpl->getEntitiesById());
+}
+
+bool Database::exportSnapshot(char const* filePath) const
+{
+	Vector<uint8> snapshot = exportSnapshot();
+
+	if (snapshot.empty())
+	{
+		return false;
+	}
+
+	std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+
+	return file.write(reinterpret_cast<char const*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size())) && file.flush();
+}
+
+MemoryFootprint Database::computeMemoryFootprint() const
+{
+	internal::MemoryFootprintCollector collector;
+
+	collector.addDatabase(*_pimpl);
+
+	return collector.getFootprint();
+}
+
+Vector<InstrumentationRecord> Database::getHottestLookups([[maybe_unused]] std::size_t maxRecords) const
+{
+	Vector<InstrumentationRecord> result;
+
+#if RFK_INSTRUMENTATION
+	internal::InstrumentationRegistry::CountersByEntity counters = internal::InstrumentationRegistry::getInstance().aggregate();
+
+	result.reserve(counters.size());
+
+	for (auto const& [entity, entityCounters] : counters)
+	{
+		InstrumentationRecord& record = result.emplace_back();
+
+		record.entity = entity;
+
+		for (std::size_t i = 0u; i < entityCounters.size(); i++)
+		{
+			record.getCounter(static_cast<EInstrumentationEvent>(i)) = entityCounters[i];
+		}
+	}
+
+	//Sort by id on equal totals so that the order doesn't depend on the hash map iteration order
+	std::sort(result.begin(), result.end(), [](InstrumentationRecord const& lhs, InstrumentationRecord const& rhs)
+			  {
+				  std::size_t lhsTotal = lhs.getTotal();
+				  std::size_t rhsTotal = rhs.getTotal();
+
+				  if (lhsTotal != rhsTotal)
+				  {
+					  return lhsTotal > rhsTotal;
+				  }
+
+				  return ((lhs.entity != nullptr) ? lhs.entity->getId() : 0u) < ((rhs.entity != nullptr) ? rhs.entity->getId() : 0u);
+			  });
+
+	if (maxRecords != 0u && result.size() > maxRecords)
+	{
+		result.resize(maxRecords);
+	}
+#endif
+
+	return result;
+}
+
+void Database::resetInstrumentationCounters() const noexcept
+{
+#if RFK_INSTRUMENTATION
+	internal::InstrumentationRegistry::getInstance().reset();
+#endif
+}
+
+Vector<RegistrationTraceEvent> Database::getRegistrationTrace() const
+{
+#if RFK_REGISTRATION_TRACING
+	return internal::RegistrationTracer::getInstance().getEvents();
+#else
+	return Vector<RegistrationTraceEvent>();
+#endif
+}
+
+bool Database::exportRegistrationTrace(char const* filePath) const
+{
+#if RFK_REGISTRATION_TRACING
+	std::string trace = internal::RegistrationTracer::getInstance().toChromeTrace();
+#else
+	std::string trace = "{\"traceEvents\":[]}";
+#endif
+
+	std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+
+	return file.good();
+}
+
+void Database::clearRegistrationTrace() const noexcept
+{
+#if RFK_REGISTRATION_TRACING
+	internal::RegistrationTracer::getInstance().clear();
+#endif
+}
+
 Database const& rfk::getDatabase() noexcept
 {
 	return Database::getInstance();
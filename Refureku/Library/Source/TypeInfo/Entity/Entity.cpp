@@ -6,6 +6,10 @@
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/Misc/Algorithm.h"
 
+#if !RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Entity/EntityHotGetters.inl"
+#endif
+
 using namespace rfk;
 
 Entity::Entity(EntityImpl* implementation) noexcept:
@@ -103,6 +107,27 @@ Vector<Property const*> Entity::getPropertiesByName(char const* name) const noex
 									}, &name);
 }
 
+std::size_t Entity::getPropertiesByName(char const* name, Property const** outProperties, std::size_t capacity) const noexcept
+{
+	std::size_t found = 0u;
+
+	for (Property const* property : _pimpl->getProperties())
+	{
+		if (property->getArchetype().hasSameName(name))
+		{
+			//Keep counting properties once the buffer is full so that the caller knows the required capacity
+			if (found < capacity)
+			{
+				outProperties[found] = property;
+			}
+
+			found++;
+		}
+	}
+
+	return found;
+}
+
 Vector<Property const*> Entity::getPropertiesByPredicate(Predicate<Property> predicate, void* userData) const
 {
 	return Algorithm::getItemsByPredicate(_pimpl->getProperties(), predicate, userData);
@@ -123,31 +148,11 @@ bool Entity::addProperty(Property const& property) noexcept
 	return _pimpl->addProperty(property);
 }
 
-char const* Entity::getName() const noexcept
-{
-	return _pimpl->getName().data();
-}
-
 bool Entity::hasSameName(char const* name) const noexcept
 {
 	return name != nullptr && std::strcmp(getName(), name) == 0;
 }
 
-std::size_t Entity::getId() const noexcept
-{
-	return _pimpl->getId();
-}
-
-EEntityKind Entity::getKind() const noexcept
-{
-	return _pimpl->getKind();
-}
-
-Entity const* Entity::getOuterEntity() const noexcept
-{
-	return _pimpl->getOuterEntity();
-}
-
 void Entity::setOuterEntity(Entity const* outerEntity) noexcept
 {
 	_pimpl->setOuterEntity(outerEntity);
@@ -0,0 +1,33 @@
+#include "Refureku/TypeInfo/Functions/MethodCommandBuffer.h"
+
+#include "Refureku/TypeInfo/Functions/MethodCommandBufferImpl.h"
+
+using namespace rfk;
+
+MethodCommandBuffer::MethodCommandBuffer(std::size_t blockSize) noexcept:
+	_pimpl(new internal::MethodCommandBufferImpl(blockSize))
+{
+}
+
+MethodCommandBuffer::~MethodCommandBuffer() noexcept = default;
+
+std::size_t MethodCommandBuffer::execute()
+{
+	return _pimpl->execute();
+}
+
+void MethodCommandBuffer::clear() noexcept
+{
+	_pimpl->clear();
+}
+
+std::size_t MethodCommandBuffer::getCommandsCount() const noexcept
+{
+	return _pimpl->getCommandsCount();
+}
+
+bool MethodCommandBuffer::pushCommand(FunctionBase const& function, Replayer replayer, Destroyer destroyer, SignatureChecker signatureChecker,
+									  std::size_t commandSize, CommandConstructor constructor, void* constructorData)
+{
+	return _pimpl->pushCommand(function, replayer, destroyer, signatureChecker, commandSize, constructor, constructorData);
+}
\ No newline at end of file
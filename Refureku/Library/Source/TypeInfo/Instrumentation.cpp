@@ -0,0 +1,42 @@
+#include "Refureku/TypeInfo/Instrumentation.h"
+
+#include "Refureku/TypeInfo/InstrumentationRegistry.h"
+
+using namespace rfk;
+
+template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<InstrumentationRecord>;
+template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<InstrumentationRecord, rfk::Allocator<InstrumentationRecord>>;
+
+std::size_t& InstrumentationRecord::getCounter(EInstrumentationEvent event) noexcept
+{
+	static constexpr std::size_t InstrumentationRecord::* counters[] =
+	{
+		&InstrumentationRecord::nameLookups,
+		&InstrumentationRecord::idLookups,
+		&InstrumentationRecord::casts,
+		&InstrumentationRecord::invocations,
+		&InstrumentationRecord::failedLookups
+	};
+
+	static_assert(sizeof(counters) / sizeof(counters[0]) == static_cast<std::size_t>(EInstrumentationEvent::Count),
+				  "All instrumentation events must have a counter.");
+
+	return this->*counters[static_cast<std::size_t>(event)];
+}
+
+std::size_t InstrumentationRecord::getCounter(EInstrumentationEvent event) const noexcept
+{
+	return const_cast<InstrumentationRecord*>(this)->getCounter(event);
+}
+
+std::size_t InstrumentationRecord::getTotal() const noexcept
+{
+	return nameLookups + idLookups + casts + invocations + failedLookups;
+}
+
+void internal::recordInstrumentationEvent([[maybe_unused]] Entity const* entity, [[maybe_unused]] EInstrumentationEvent event) noexcept
+{
+#if RFK_INSTRUMENTATION
+	InstrumentationRegistry::getThreadBlock().record(entity, event);
+#endif
+}
\ No newline at end of file
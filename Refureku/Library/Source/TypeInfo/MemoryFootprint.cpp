@@ -0,0 +1,52 @@
+#include "Refureku/TypeInfo/MemoryFootprint.h"
+
+using namespace rfk;
+
+/** All the entries of a MemoryFootprint. */
+static constexpr MemoryFootprintEntry MemoryFootprint::* footprintEntries[] =
+{
+	&MemoryFootprint::namespaces,
+	&MemoryFootprint::namespaceFragments,
+	&MemoryFootprint::structs,
+	&MemoryFootprint::enums,
+	&MemoryFootprint::enumValues,
+	&MemoryFootprint::fundamentalArchetypes,
+	&MemoryFootprint::variables,
+	&MemoryFootprint::fields,
+	&MemoryFootprint::functions,
+	&MemoryFootprint::methods,
+	&MemoryFootprint::parameters,
+	&MemoryFootprint::names,
+	&MemoryFootprint::properties,
+	&MemoryFootprint::types,
+	&MemoryFootprint::structContainers,
+	&MemoryFootprint::enumContainers,
+	&MemoryFootprint::namespaceContainers,
+	&MemoryFootprint::registrationTables,
+	&MemoryFootprint::hashBuckets
+};
+
+static_assert(sizeof(footprintEntries) / sizeof(footprintEntries[0]) * sizeof(MemoryFootprintEntry) == sizeof(MemoryFootprint), "Some MemoryFootprint entries are missing from footprintEntries.");
+
+std::size_t MemoryFootprint::getTotalBytes() const noexcept
+{
+	std::size_t result = 0u;
+
+	for (MemoryFootprintEntry MemoryFootprint::* entry : footprintEntries)
+	{
+		result += (this->*entry).bytes;
+	}
+
+	return result;
+}
+
+MemoryFootprint& MemoryFootprint::operator+=(MemoryFootprint const& other) noexcept
+{
+	for (MemoryFootprintEntry MemoryFootprint::* entry : footprintEntries)
+	{
+		(this->*entry).count += (other.*entry).count;
+		(this->*entry).bytes += (other.*entry).bytes;
+	}
+
+	return *this;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "Refureku/TypeInfo/Module/ModuleEntityRegisterer.h"
+
+#include <cassert>
+
+#include "Refureku/TypeInfo/Entity/Entity.h"
+#include "Refureku/TypeInfo/RegistrationTrace.h"
+
+using namespace rfk;
+
+ModuleEntityRegisterer::ModuleEntityRegisterer(ModuleHandle& module, Entity const& entity) noexcept:
+	_module{module},
+	_registeredEntity{entity}
+{
+	//Entities which are not at file level should not be registered
+	assert(entity.getOuterEntity() == nullptr);
+
+	RFK_TRACE_REGISTRATION_SCOPE(ModuleEntityRegisterer, entity.getName(), module.getName());
+
+	Entity const* registeredEntity = &_registeredEntity;
+
+	_module.addEntities(&registeredEntity, 1u);
+}
+
+ModuleEntityRegisterer::~ModuleEntityRegisterer() noexcept
+{
+	Entity const* registeredEntity = &_registeredEntity;
+
+	_module.removeEntities(&registeredEntity, 1u);
+}
\ No newline at end of file
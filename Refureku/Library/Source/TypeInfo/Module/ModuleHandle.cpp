@@ -0,0 +1,80 @@
+#include "Refureku/TypeInfo/Module/ModuleHandle.h"
+
+#include "Refureku/TypeInfo/Module/ModuleHandleImpl.h"
+#include "Refureku/TypeInfo/MemoryFootprintCollector.h"
+#include "Refureku/TypeInfo/RegistrationTrace.h"
+
+using namespace rfk;
+
+ModuleHandle::ModuleHandle(char const* name) noexcept:
+	_pimpl(new internal::ModuleHandleImpl(name))
+{
+}
+
+ModuleHandle::~ModuleHandle() noexcept = default;
+
+void ModuleHandle::reserve(std::size_t entitiesCount) noexcept
+{
+	_pimpl->reserve(entitiesCount);
+}
+
+void ModuleHandle::addEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	_pimpl->addEntities(entities, entitiesCount);
+}
+
+void ModuleHandle::removeEntities(Entity const* const* entities, std::size_t entitiesCount) noexcept
+{
+	_pimpl->removeEntities(entities, entitiesCount);
+}
+
+void ModuleHandle::load() noexcept
+{
+	RFK_TRACE_REGISTRATION_SCOPE(ModuleLoad, getName(), getName());
+
+	_pimpl->load();
+}
+
+void ModuleHandle::unload() noexcept
+{
+	_pimpl->unload();
+}
+
+ModuleReloadReport ModuleHandle::reload(ModuleHandle& newModule) noexcept
+{
+	return _pimpl->reload(*newModule._pimpl);
+}
+
+void ModuleHandle::revertReload() noexcept
+{
+	_pimpl->revertReload();
+}
+
+bool ModuleHandle::isReloaded() const noexcept
+{
+	return _pimpl->isReloaded();
+}
+
+bool ModuleHandle::isLoaded() const noexcept
+{
+	return _pimpl->isLoaded();
+}
+
+char const* ModuleHandle::getName() const noexcept
+{
+	return _pimpl->getName().c_str();
+}
+
+std::size_t ModuleHandle::getEntitiesCount() const noexcept
+{
+	return _pimpl->getEntities().size();
+}
+
+MemoryFootprint ModuleHandle::computeMemoryFootprint() const
+{
+	internal::MemoryFootprintCollector collector;
+
+	collector.addModule(*_pimpl);
+
+	return collector.getFootprint();
+}
\ No newline at end of file
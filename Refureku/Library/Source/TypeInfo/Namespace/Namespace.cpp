@@ -4,6 +4,7 @@
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/Misc/Algorithm.h"
+#include "Refureku/TypeInfo/Instrumentation.h"
 
 using namespace rfk;
 
@@ -19,7 +20,7 @@ Namespace::~Namespace() noexcept = default;
 
 Namespace const* Namespace::getNamespaceByName(char const* name) const noexcept
 {
-	return Algorithm::getEntityByName(getPimpl()->getNamespaces(), name);
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, Algorithm::getEntityByName(getPimpl()->getNamespaces(), name));
 }
 
 Namespace const* Namespace::getNamespaceByPredicate(Predicate<Namespace> predicate, void* userData) const
@@ -49,12 +50,17 @@ std::size_t Namespace::getNamespacesCount() const noexcept
 	return getPimpl()->getNamespaces().size();
 }
 
+Span<Namespace const* const> Namespace::getNamespacesSpan() const noexcept
+{
+	return getPimpl()->getFlatNamespaces().getSpan();
+}
+
 Struct const* Namespace::getStructByName(char const* name) const noexcept
 {
-	return reinterpret_cast<Struct const*>(
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, reinterpret_cast<Struct const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
-													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Struct; }));
+													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Struct; })));
 }
 
 Struct const* Namespace::getStructByPredicate(Predicate<Struct> predicate, void* userData) const
@@ -100,10 +106,10 @@ bool Namespace::foreachStruct(Visitor<Struct> visitor, void* userData) const
 
 Class const* Namespace::getClassByName(char const* name) const noexcept
 {
-	return reinterpret_cast<Class const*>(
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, reinterpret_cast<Class const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
-													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Class; }));
+													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Class; })));
 }
 
 Class const* Namespace::getClassByPredicate(Predicate<Class> predicate, void* userData) const
@@ -149,10 +155,10 @@ bool Namespace::foreachClass(Visitor<Class> visitor, void* userData) const
 
 Enum const* Namespace::getEnumByName(char const* name) const noexcept
 {
-	return reinterpret_cast<Enum const*>(
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, reinterpret_cast<Enum const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
-													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Enum; }));
+													[](Archetype const& arch) { return arch.getKind() == EEntityKind::Enum; })));
 }
 
 Enum const* Namespace::getEnumByPredicate(Predicate<Enum> predicate, void* userData) const
@@ -206,12 +212,17 @@ std::size_t Namespace::getArchetypesCount() const noexcept
 	return getPimpl()->getArchetypes().size();
 }
 
+Span<Archetype const* const> Namespace::getArchetypesSpan() const noexcept
+{
+	return getPimpl()->getFlatArchetypes().getSpan();
+}
+
 Variable const* Namespace::getVariableByName(char const* name, EVarFlags flags) const noexcept
 {
-	return reinterpret_cast<Variable const*>(
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, reinterpret_cast<Variable const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getVariables(),
 													name,
-													[flags](Variable const& var) { return (var.getFlags() & flags) == flags; }));
+													[flags](Variable const& var) { return (var.getFlags() & flags) == flags; })));
 }
 
 Variable const* Namespace::getVariableByPredicate(Predicate<Variable> predicate, void* userData) const
@@ -244,15 +255,20 @@ std::size_t Namespace::getVariablesCount() const noexcept
 	return getPimpl()->getVariables().size();
 }
 
+Span<Variable const* const> Namespace::getVariablesSpan() const noexcept
+{
+	return getPimpl()->getFlatVariables().getSpan();
+}
+
 Function const* Namespace::getFunctionByName(char const* name, EFunctionFlags flags) const noexcept
 {
-	return reinterpret_cast<Function const*>(
+	return RFK_INSTRUMENT_NAME_LOOKUP(this, reinterpret_cast<Function const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getFunctions(),
 													name,
 													[flags](Function const& func)
 													{
 														return (func.getFlags() & flags) == flags;
-													}));
+													})));
 }
 
 Vector<Function const*> Namespace::getFunctionsByName(char const* name, EFunctionFlags flags) const noexcept
@@ -295,6 +311,11 @@ std::size_t Namespace::getFunctionsCount() const noexcept
 	return getPimpl()->getFunctions().size();
 }
 
+Span<Function const* const> Namespace::getFunctionsSpan() const noexcept
+{
+	return getPimpl()->getFlatFunctions().getSpan();
+}
+
 void Namespace::addNamespace(Namespace const& nestedNamespace) noexcept
 {
 	//Don't tell anyone I actually wrote const_cast...
@@ -345,4 +366,26 @@ void Namespace::removeVariable(Variable const& variable) noexcept
 void Namespace::removeFunction(Function const& function) noexcept
 {
 	getPimpl()->removeFunction(function);
+}
+
+void Namespace::addNestedEntities(Namespace const* const* namespaces, std::size_t namespacesCount, Archetype const* const* archetypes, std::size_t archetypesCount,
+								  Variable const* const* variables, std::size_t variablesCount, Function const* const* functions, std::size_t functionsCount) noexcept
+{
+	//Don't tell anyone I actually wrote const_cast...
+	for (std::size_t i = 0u; i < archetypesCount; i++)
+	{
+		getPimpl()->setOuterEntity(const_cast<Archetype&>(*archetypes[i]), *this);
+	}
+
+	for (std::size_t i = 0u; i < variablesCount; i++)
+	{
+		getPimpl()->setOuterEntity(const_cast<Variable&>(*variables[i]), *this);
+	}
+
+	for (std::size_t i = 0u; i < functionsCount; i++)
+	{
+		getPimpl()->setOuterEntity(const_cast<Function&>(*functions[i]), *this);
+	}
+
+	getPimpl()->addNestedEntities(namespaces, namespacesCount, archetypes, archetypesCount, variables, variablesCount, functions, functionsCount);
 }
\ No newline at end of file
@@ -23,6 +23,13 @@ void NamespaceFragment::addNestedEntity(Entity const& nestedEntity) noexcept
 	getPimpl()->addNestedEntity(nestedEntity);
 }
 
+void NamespaceFragment::addNestedEntities(Entity const* const* nestedEntities, std::size_t nestedEntitiesCount) noexcept
+{
+	RFK_TRACE_REGISTRATION_SCOPE(NamespaceMerge, getName(), nullptr);
+
+	getPimpl()->addNestedEntities(nestedEntities, nestedEntitiesCount);
+}
+
 void NamespaceFragment::setNestedEntitiesCapacity(std::size_t capacity) noexcept
 {
 	getPimpl()->setNestedEntitiesCapacity(capacity);
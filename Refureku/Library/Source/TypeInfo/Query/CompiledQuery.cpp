@@ -0,0 +1,82 @@
+#include "Refureku/TypeInfo/Query/CompiledQuery.h"
+
+#include "Refureku/TypeInfo/Query/CompiledQueryImpl.h"
+
+using namespace rfk;
+
+CompiledQuery::CompiledQuery(internal::CompiledQueryImpl* implementation) noexcept:
+	_pimpl{implementation}
+{
+}
+
+CompiledQuery::CompiledQuery(CompiledQuery const&) noexcept = default;
+
+CompiledQuery::CompiledQuery(CompiledQuery&&) noexcept = default;
+
+CompiledQuery::~CompiledQuery() noexcept = default;
+
+bool CompiledQuery::foreach(Visitor<Entity> visitor, void* userData) const
+{
+	return (visitor != nullptr) ? _pimpl->foreach([visitor, userData](Entity const& entity) { return visitor(entity, userData); }) : false;
+}
+
+Entity const* CompiledQuery::getFirst() const noexcept
+{
+	Entity const* result = nullptr;
+
+	_pimpl->foreach([&result](Entity const& entity)
+					{
+						result = &entity;
+
+						return false;
+					});
+
+	return result;
+}
+
+Vector<Entity const*> CompiledQuery::getResults() const noexcept
+{
+	Vector<Entity const*> result;
+
+	_pimpl->foreach([&result](Entity const& entity)
+					{
+						result.push_back(&entity);
+
+						return true;
+					});
+
+	return result;
+}
+
+std::size_t CompiledQuery::count() const noexcept
+{
+	std::size_t result = 0u;
+
+	_pimpl->foreach([&result](Entity const&)
+					{
+						result++;
+
+						return true;
+					});
+
+	return result;
+}
+
+EQuerySource CompiledQuery::getSource() const noexcept
+{
+	return _pimpl->getSource();
+}
+
+std::size_t CompiledQuery::getEstimatedCandidatesCount() const noexcept
+{
+	return _pimpl->getEstimatedCandidatesCount();
+}
+
+char const* CompiledQuery::explain() const noexcept
+{
+	return _pimpl->getExplanation().c_str();
+}
+
+CompiledQuery& CompiledQuery::operator=(CompiledQuery const&) noexcept = default;
+
+CompiledQuery& CompiledQuery::operator=(CompiledQuery&&) noexcept = default;
\ No newline at end of file
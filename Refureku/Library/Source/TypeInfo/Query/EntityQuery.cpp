@@ -0,0 +1,95 @@
+#include "Refureku/TypeInfo/Query/EntityQuery.h"
+
+#include "Refureku/TypeInfo/Query/EntityQueryImpl.h"
+#include "Refureku/TypeInfo/Query/CompiledQueryImpl.h"
+
+using namespace rfk;
+
+EntityQuery::EntityQuery() noexcept:
+	_pimpl{new internal::EntityQueryImpl()}
+{
+}
+
+EntityQuery::EntityQuery(EntityQuery const&) noexcept = default;
+
+EntityQuery::EntityQuery(EntityQuery&&) noexcept = default;
+
+EntityQuery::~EntityQuery() noexcept = default;
+
+EntityQuery& EntityQuery::ofKind(EEntityKind kinds) noexcept
+{
+	_pimpl->kinds = kinds;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::named(char const* name) noexcept
+{
+	_pimpl->name	= (name != nullptr) ? name : "";
+	_pimpl->hasName	= true;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::withNamePrefix(char const* prefix) noexcept
+{
+	_pimpl->namePrefix = (prefix != nullptr) ? prefix : "";
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::derivedFrom(Struct const& base, bool includeBase) noexcept
+{
+	_pimpl->baseStruct			= &base;
+	_pimpl->includeBaseStruct	= includeBase;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::withProperty(Struct const& propertyArchetype, bool isChildClassValid) noexcept
+{
+	_pimpl->propertyArchetype		= &propertyArchetype;
+	_pimpl->isChildPropertyValid	= isChildClassValid;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::withAccess(EAccessSpecifier access) noexcept
+{
+	_pimpl->access		= access;
+	_pimpl->hasAccess	= true;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::withFieldFlags(EFieldFlags flags) noexcept
+{
+	_pimpl->fieldFlags		= flags;
+	_pimpl->hasFieldFlags	= true;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::withMethodFlags(EMethodFlags flags) noexcept
+{
+	_pimpl->methodFlags		= flags;
+	_pimpl->hasMethodFlags	= true;
+
+	return *this;
+}
+
+EntityQuery& EntityQuery::atFileLevel() noexcept
+{
+	_pimpl->isFileLevelOnly = true;
+
+	return *this;
+}
+
+CompiledQuery EntityQuery::compile() const noexcept
+{
+	return CompiledQuery(new internal::CompiledQueryImpl(*_pimpl));
+}
+
+EntityQuery& EntityQuery::operator=(EntityQuery const&) noexcept = default;
+
+EntityQuery& EntityQuery::operator=(EntityQuery&&) noexcept = default;
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "Refureku/TypeInfo/RegistrationTrace.h"
+
+#include "Refureku/TypeInfo/RegistrationTracer.h"
+
+using namespace rfk;
+
+template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<RegistrationTraceEvent>;
+template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<RegistrationTraceEvent, rfk::Allocator<RegistrationTraceEvent>>;
+
+char const* rfk::getRegistrationTraceCategoryName(ERegistrationTraceCategory category) noexcept
+{
+	static constexpr char const* categoryNames[] =
+	{
+		"ArchetypeRegisterer",
+		"DefaultEntityRegisterer",
+		"NamespaceFragmentRegisterer",
+		"ClassTemplateInstantiationRegisterer",
+		"ModuleEntityRegisterer",
+		"ModuleLoad",
+		"StaticGetArchetype",
+		"NamespaceMerge"
+	};
+
+	static_assert(sizeof(categoryNames) / sizeof(categoryNames[0]) == static_cast<std::size_t>(ERegistrationTraceCategory::Count),
+				  "All registration trace categories must have a name.");
+
+	return (category < ERegistrationTraceCategory::Count) ? categoryNames[static_cast<std::size_t>(category)] : "Unknown";
+}
+
+internal::RegistrationTraceScope::RegistrationTraceScope([[maybe_unused]] ERegistrationTraceCategory category, [[maybe_unused]] char const* name,
+														 [[maybe_unused]] char const* module) noexcept:
+	_eventIndex{0u}
+{
+#if RFK_REGISTRATION_TRACING
+	_eventIndex = RegistrationTracer::getInstance().beginEvent(category, name, module);
+#endif
+}
+
+internal::RegistrationTraceScope::~RegistrationTraceScope() noexcept
+{
+#if RFK_REGISTRATION_TRACING
+	RegistrationTracer::getInstance().endEvent(_eventIndex);
+#endif
+}
+
+internal::RegistrationTraceModule::RegistrationTraceModule([[maybe_unused]] char const* module) noexcept
+{
+#if RFK_REGISTRATION_TRACING
+	RegistrationTracer::getInstance().setCurrentModule(module);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshot.h"
+
+#include "Refureku/TypeInfo/Snapshot/DatabaseSnapshotImpl.h"
+
+using namespace rfk;
+
+DatabaseSnapshot::DatabaseSnapshot() noexcept:
+	_pimpl(new internal::DatabaseSnapshotImpl())
+{
+}
+
+DatabaseSnapshot::~DatabaseSnapshot() noexcept = default;
+
+bool DatabaseSnapshot::loadFromMemory(void const* data, std::size_t size) noexcept
+{
+	return _pimpl->loadFromMemory(data, size);
+}
+
+bool DatabaseSnapshot::loadFromFile(char const* filePath) noexcept
+{
+	return _pimpl->loadFromFile(filePath);
+}
+
+bool DatabaseSnapshot::isLoaded() const noexcept
+{
+	return _pimpl->getData() != nullptr;
+}
+
+std::size_t DatabaseSnapshot::getEntitiesCount() const noexcept
+{
+	return isLoaded() ? internal::SnapshotFormat::getHeader(_pimpl->getData()).entities.count : 0u;
+}
+
+SnapshotEntity const& DatabaseSnapshot::getEntityAt(std::size_t index) const noexcept
+{
+	char const* data = _pimpl->getData();
+
+	return internal::SnapshotFormat::getElement<SnapshotEntity>(data, internal::SnapshotFormat::getHeader(data).entities, index);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getEntityById(std::size_t id) const noexcept
+{
+	return isLoaded() ? _pimpl->getEntityById(id) : nullptr;
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelEntityByName(char const* name, EEntityKind kinds) const noexcept
+{
+	return (isLoaded() && name != nullptr) ? _pimpl->getFileLevelEntityByName(name, kinds) : nullptr;
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelNamespaceByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Namespace);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelStructByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Struct);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelClassByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Class);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelEnumByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Enum);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelVariableByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Variable);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFileLevelFunctionByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::Function);
+}
+
+SnapshotEntity const* DatabaseSnapshot::getFundamentalArchetypeByName(char const* name) const noexcept
+{
+	return getFileLevelEntityByName(name, EEntityKind::FundamentalArchetype);
+}
+
+std::size_t DatabaseSnapshot::getFileLevelEntitiesCount(EEntityKind kinds) const noexcept
+{
+	return isLoaded() ? _pimpl->getFileLevelEntitiesCount(kinds) : 0u;
+}
+
+bool DatabaseSnapshot::foreachFileLevelEntity(EEntityKind kinds, Visitor<SnapshotEntity> visitor, void* userData) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	return isLoaded() ? _pimpl->foreachFileLevelEntity(kinds, visitor, userData) : true;
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "Refureku/TypeInfo/Snapshot/SnapshotEntity.h"
+
+#include <cstring>	//std::strcmp
+
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+using namespace rfk;
+
+std::size_t SnapshotEntity::getId() const noexcept
+{
+	return static_cast<std::size_t>(_id);
+}
+
+char const* SnapshotEntity::getName() const noexcept
+{
+	return internal::SnapshotFormat::getString(internal::SnapshotFormat::getData(*this), _nameOffset);
+}
+
+EEntityKind SnapshotEntity::getKind() const noexcept
+{
+	return static_cast<EEntityKind>(_kind);
+}
+
+SnapshotEntity const* SnapshotEntity::getOuterEntity() const noexcept
+{
+	return internal::SnapshotFormat::getEntity(internal::SnapshotFormat::getData(*this), _outerIndex);
+}
+
+std::size_t SnapshotEntity::getPropertiesCount() const noexcept
+{
+	return _propertiesCount;
+}
+
+SnapshotProperty const& SnapshotEntity::getPropertyAt(std::size_t propertyIndex) const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getElement<SnapshotProperty>(data, internal::SnapshotFormat::getHeader(data).properties, _propertiesBegin + propertyIndex);
+}
+
+SnapshotProperty const* SnapshotEntity::getPropertyByName(char const* name) const noexcept
+{
+	for (std::size_t i = 0u; i < getPropertiesCount(); i++)
+	{
+		SnapshotProperty const& property = getPropertyAt(i);
+
+		if (std::strcmp(property.getArchetypeName(), name) == 0)
+		{
+			return &property;
+		}
+	}
+
+	return nullptr;
+}
+
+std::size_t SnapshotEntity::getNestedEntitiesCount() const noexcept
+{
+	return _nestedEntitiesCount;
+}
+
+SnapshotEntity const& SnapshotEntity::getNestedEntityAt(std::size_t index) const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getIndexedEntity(data, internal::SnapshotFormat::getHeader(data).nestedEntities, _nestedEntitiesBegin + index);
+}
+
+SnapshotEntity const* SnapshotEntity::getNestedEntityByName(char const* name, EEntityKind kinds, bool shouldInspectInherited) const noexcept
+{
+	for (std::size_t i = 0u; i < getNestedEntitiesCount(); i++)
+	{
+		SnapshotEntity const& entity = getNestedEntityAt(i);
+
+		if ((entity.getKind() & kinds) != EEntityKind::Undefined && std::strcmp(entity.getName(), name) == 0)
+		{
+			return &entity;
+		}
+	}
+
+	if (shouldInspectInherited)
+	{
+		for (std::size_t i = 0u; i < getDirectParentsCount(); i++)
+		{
+			SnapshotEntity const* result = getDirectParentAt(i).getArchetype().getNestedEntityByName(name, kinds, true);
+
+			if (result != nullptr)
+			{
+				return result;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool SnapshotEntity::foreachNestedEntity(Visitor<SnapshotEntity> visitor, void* userData) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0u; i < getNestedEntitiesCount(); i++)
+	{
+		if (!visitor(getNestedEntityAt(i), userData))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+EAccessSpecifier SnapshotEntity::getAccess() const noexcept
+{
+	return static_cast<EAccessSpecifier>(_access);
+}
+
+std::size_t SnapshotEntity::getMemorySize() const noexcept
+{
+	constexpr EEntityKind archetypeKinds = EEntityKind::Struct | EEntityKind::Class | EEntityKind::Enum | EEntityKind::FundamentalArchetype;
+
+	return ((getKind() & archetypeKinds) != EEntityKind::Undefined) ? static_cast<std::size_t>(_memory) : 0u;
+}
+
+EClassKind SnapshotEntity::getClassKind() const noexcept
+{
+	return ((getKind() & (EEntityKind::Struct | EEntityKind::Class)) != EEntityKind::Undefined) ? static_cast<EClassKind>(_value) : EClassKind::Standard;
+}
+
+std::size_t SnapshotEntity::getDirectParentsCount() const noexcept
+{
+	return _directParentsCount;
+}
+
+SnapshotParentStruct const& SnapshotEntity::getDirectParentAt(std::size_t index) const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getElement<SnapshotParentStruct>(data, internal::SnapshotFormat::getHeader(data).directParents, _directParentsBegin + index);
+}
+
+bool SnapshotEntity::isSubclassOf(SnapshotEntity const& archetype) const noexcept
+{
+	for (std::size_t i = 0u; i < getDirectParentsCount(); i++)
+	{
+		SnapshotEntity const& parent = getDirectParentAt(i).getArchetype();
+
+		if (&parent == &archetype || parent.isSubclassOf(archetype))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::size_t SnapshotEntity::getSubclassesCount() const noexcept
+{
+	return _subclassesCount;
+}
+
+SnapshotEntity const& SnapshotEntity::getSubclassAt(std::size_t index) const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getIndexedEntity(data, internal::SnapshotFormat::getHeader(data).subclasses, _subclassesBegin + index);
+}
+
+SnapshotEntity const* SnapshotEntity::getUnderlyingArchetype() const noexcept
+{
+	return (getKind() == EEntityKind::Enum) ? getType().getArchetype() : nullptr;
+}
+
+SnapshotEntity const* SnapshotEntity::getEnumValue(int64 value) const noexcept
+{
+	if (getKind() != EEntityKind::Enum)
+	{
+		return nullptr;
+	}
+
+	for (std::size_t i = 0u; i < getNestedEntitiesCount(); i++)
+	{
+		SnapshotEntity const& enumValue = getNestedEntityAt(i);
+
+		if (enumValue.getValue() == value)
+		{
+			return &enumValue;
+		}
+	}
+
+	return nullptr;
+}
+
+int64 SnapshotEntity::getValue() const noexcept
+{
+	return (getKind() == EEntityKind::EnumValue) ? _value : 0;
+}
+
+std::size_t SnapshotEntity::getMemoryOffset() const noexcept
+{
+	return (getKind() == EEntityKind::Field) ? static_cast<std::size_t>(_memory) : 0u;
+}
+
+SnapshotType const& SnapshotEntity::getType() const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getElement<SnapshotType>(data, internal::SnapshotFormat::getHeader(data).types, _typeIndex);
+}
+
+SnapshotType const& SnapshotEntity::getReturnType() const noexcept
+{
+	return getType();
+}
+
+std::size_t SnapshotEntity::getParametersCount() const noexcept
+{
+	return _parametersCount;
+}
+
+SnapshotParameter const& SnapshotEntity::getParameterAt(std::size_t index) const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getElement<SnapshotParameter>(data, internal::SnapshotFormat::getHeader(data).parameters, _parametersBegin + index);
+}
+
+EFieldFlags SnapshotEntity::getFieldFlags() const noexcept
+{
+	return (getKind() == EEntityKind::Field) ? static_cast<EFieldFlags>(_flags) : EFieldFlags::Default;
+}
+
+EVarFlags SnapshotEntity::getVarFlags() const noexcept
+{
+	return (getKind() == EEntityKind::Variable) ? static_cast<EVarFlags>(_flags) : EVarFlags::Default;
+}
+
+EFunctionFlags SnapshotEntity::getFunctionFlags() const noexcept
+{
+	return (getKind() == EEntityKind::Function) ? static_cast<EFunctionFlags>(_flags) : EFunctionFlags::Default;
+}
+
+EMethodFlags SnapshotEntity::getMethodFlags() const noexcept
+{
+	return (getKind() == EEntityKind::Method) ? static_cast<EMethodFlags>(_flags) : EMethodFlags::Default;
+}
\ No newline at end of file
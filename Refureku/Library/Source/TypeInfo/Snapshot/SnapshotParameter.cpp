@@ -0,0 +1,17 @@
+#include "Refureku/TypeInfo/Snapshot/SnapshotParameter.h"
+
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+using namespace rfk;
+
+char const* SnapshotParameter::getName() const noexcept
+{
+	return internal::SnapshotFormat::getString(internal::SnapshotFormat::getData(*this), _nameOffset);
+}
+
+SnapshotType const& SnapshotParameter::getType() const noexcept
+{
+	char const* data = internal::SnapshotFormat::getData(*this);
+
+	return internal::SnapshotFormat::getElement<SnapshotType>(data, internal::SnapshotFormat::getHeader(data).types, _typeIndex);
+}
\ No newline at end of file
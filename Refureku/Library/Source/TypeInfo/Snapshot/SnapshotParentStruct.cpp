@@ -0,0 +1,15 @@
+#include "Refureku/TypeInfo/Snapshot/SnapshotParentStruct.h"
+
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+using namespace rfk;
+
+SnapshotEntity const& SnapshotParentStruct::getArchetype() const noexcept
+{
+	return *internal::SnapshotFormat::getEntity(internal::SnapshotFormat::getData(*this), _archetypeIndex);
+}
+
+EAccessSpecifier SnapshotParentStruct::getInheritanceAccessSpecifier() const noexcept
+{
+	return static_cast<EAccessSpecifier>(_inheritanceAccess);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "Refureku/TypeInfo/Snapshot/SnapshotProperty.h"
+
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+using namespace rfk;
+
+SnapshotEntity const* SnapshotProperty::getArchetype() const noexcept
+{
+	return internal::SnapshotFormat::getEntity(internal::SnapshotFormat::getData(*this), _archetypeIndex);
+}
+
+char const* SnapshotProperty::getArchetypeName() const noexcept
+{
+	return internal::SnapshotFormat::getString(internal::SnapshotFormat::getData(*this), _archetypeNameOffset);
+}
+
+std::size_t SnapshotProperty::getArchetypeId() const noexcept
+{
+	return static_cast<std::size_t>(_archetypeId);
+}
+
+bool SnapshotProperty::getShouldInherit() const noexcept
+{
+	return _shouldInherit != 0u;
+}
+
+bool SnapshotProperty::getAllowMultiple() const noexcept
+{
+	return _allowMultiple != 0u;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "Refureku/TypeInfo/Snapshot/SnapshotType.h"
+
+#include "Refureku/TypeInfo/Snapshot/SnapshotFormat.h"
+
+using namespace rfk;
+
+SnapshotEntity const* SnapshotType::getArchetype() const noexcept
+{
+	return internal::SnapshotFormat::getEntity(internal::SnapshotFormat::getData(*this), _archetypeIndex);
+}
+
+char const* SnapshotType::getArchetypeName() const noexcept
+{
+	return internal::SnapshotFormat::getString(internal::SnapshotFormat::getData(*this), _archetypeNameOffset);
+}
+
+std::size_t SnapshotType::getTypePartsCount() const noexcept
+{
+	return _partsCount;
+}
+
+TypePart SnapshotType::getTypePartAt(std::size_t index) const noexcept
+{
+	char const*							data	= internal::SnapshotFormat::getData(*this);
+	internal::SnapshotTypePart const&	part	= internal::SnapshotFormat::getElement<internal::SnapshotTypePart>(data, internal::SnapshotFormat::getHeader(data).typeParts, _partsBegin + index);
+
+	return TypePart(static_cast<ETypePartDescriptor>(part.descriptor), part.additionalData);
+}
\ No newline at end of file
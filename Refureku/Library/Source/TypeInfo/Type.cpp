@@ -1,86 +1,114 @@
 #include "Refureku/TypeInfo/Type.h"
 
-#include <cstring>	//std::memcmp
+#include <cstring>	//std::memcpy
 
-#include "Refureku/TypeInfo/TypeImpl.h"
+#include "Refureku/TypeInfo/TypeInterner.h"
+
+#if !RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/TypeHotGetters.inl"
+#endif
 
 using namespace rfk;
 
-Type::Type() noexcept:
-	_pimpl{new TypeImpl()}
+static_assert(Type::layoutVersion == 2u && sizeof(Type) == 3u * sizeof(void*) + 2u * sizeof(uint32) + 3u * sizeof(TypePart),
+			  "The Type layout changed, increment Type::layoutVersion and update this assertion.");
+
+Type::Type() noexcept
 {
 }
 
 Type::Type(Type const& other) noexcept:
-	_pimpl{other._pimpl}
+	_archetype{other._archetype},
+	_canonicalType{other._canonicalType},
+	_partsCount{other._partsCount}
 {
+	if (_partsCount > _inlinePartsCapacity)
+	{
+		_heapParts		= new TypePart[_partsCount];
+		_partsCapacity	= _partsCount;
+	}
+
+	std::memcpy(getPartsData(), other.getPartsData(), _partsCount * sizeof(TypePart));
 }
 
 Type::Type(Type&& other) noexcept:
-	_pimpl{std::forward<Pimpl<TypeImpl>>(other._pimpl)}
+	_archetype{other._archetype},
+	_canonicalType{other._canonicalType},
+	_heapParts{other._heapParts},
+	_partsCount{other._partsCount},
+	_partsCapacity{other._partsCapacity}
 {
-}
-
-Type::~Type() noexcept = default;
+	//Heap-allocated parts are stolen, inline parts must be copied
+	if (_partsCapacity == _inlinePartsCapacity)
+	{
+		std::memcpy(_inlineParts, other._inlineParts, _partsCount * sizeof(TypePart));
+	}
 
-void Type::optimizeMemory() noexcept
-{
-	_pimpl->optimizeMemory();
+	other._canonicalType	= nullptr;
+	other._heapParts		= nullptr;
+	other._partsCount		= 0u;
+	other._partsCapacity	= _inlinePartsCapacity;
 }
 
-TypePart& Type::addTypePart() noexcept
+Type::~Type() noexcept
 {
-	return _pimpl->addTypePart();
+	delete[] _heapParts;
 }
 
-TypePart const& Type::getTypePartAt(std::size_t index) const noexcept
+void Type::optimizeMemory() noexcept
 {
-	return _pimpl->getParts()[index];
-}
+	if (_partsCapacity > _partsCount && _partsCapacity != _inlinePartsCapacity)
+	{
+		TypePart* newParts = nullptr;
 
-std::size_t Type::getTypePartsCount() const noexcept
-{
-	return _pimpl->getParts().size();
-}
+		if (_partsCount > _inlinePartsCapacity)
+		{
+			newParts		= new TypePart[_partsCount];
+			_partsCapacity	= _partsCount;
 
-bool Type::isPointer() const noexcept
-{
-	return _pimpl->getParts().front().isPointer();
-}
+			std::memcpy(newParts, _heapParts, _partsCount * sizeof(TypePart));
+		}
+		else
+		{
+			//All parts fit in the inline storage again
+			_partsCapacity = _inlinePartsCapacity;
 
-bool Type::isLValueReference() const	noexcept
-{
-	return _pimpl->getParts().front().isLValueReference();
-}
+			std::memcpy(_inlineParts, _heapParts, _partsCount * sizeof(TypePart));
+		}
 
-bool Type::isRValueReference() const	noexcept
-{
-	return _pimpl->getParts().front().isRValueReference();
+		delete[] _heapParts;
+		_heapParts = newParts;
+	}
 }
 
-bool Type::isCArray() const noexcept
+Type const& Type::getCanonicalType() const noexcept
 {
-	return _pimpl->getParts().front().isCArray();
-}
+	static TypeInterner interner;
 
-bool Type::isValue() const noexcept
-{
-	return _pimpl->getParts().front().isValue();
+	return (_canonicalType != nullptr) ? *_canonicalType : interner.intern(*this);
 }
 
-bool Type::isConst() const noexcept
+TypePart& Type::addTypePart() noexcept
 {
-	return _pimpl->getParts().front().isConst();
-}
+	if (_partsCount == _partsCapacity)
+	{
+		uint32		newCapacity = _partsCapacity * 2u;
+		TypePart*	newParts	= new TypePart[newCapacity];
 
-bool Type::isVolatile() const noexcept
-{
-	return _pimpl->getParts().front().isVolatile();
-}
+		std::memcpy(newParts, getPartsData(), _partsCount * sizeof(TypePart));
 
-uint32 Type::getCArraySize() const noexcept
-{
-	return _pimpl->getParts().front().getCArraySize();
+		delete[] _heapParts;
+		_heapParts		= newParts;
+		_partsCapacity	= newCapacity;
+	}
+
+	//The type is modified so it doesn't match its canonical type anymore
+	_canonicalType = nullptr;
+
+	TypePart& result = getPartsData()[_partsCount++];
+	result = TypePart();
+
+	return result;
 }
 
 bool Type::match(Type const& other) const noexcept
@@ -90,25 +118,8 @@ bool Type::match(Type const& other) const noexcept
 			(getArchetype() == rfk::getArchetype<std::nullptr_t>() && other.isPointer()));
 }
 
-Archetype const* Type::getArchetype() const noexcept
-{
-	return _pimpl->getArchetype();
-}
-
 void Type::setArchetype(Archetype const* archetype) noexcept
 {
-	_pimpl->setArchetype(archetype);
-}
-
-bool Type::operator==(Type const& type) const noexcept
-{
-	return	(this == &type) ||
-			(_pimpl->getArchetype() == type.getArchetype() &&
-			_pimpl->getParts().size() == type._pimpl->getParts().size() &&
-			std::memcmp(_pimpl->getParts().data(), type._pimpl->getParts().data(), _pimpl->getParts().size() * sizeof(TypePart)) == 0);
-}
-
-bool Type::operator!=(Type const& type) const noexcept
-{
-	return !(*this == type);
+	_canonicalType	= nullptr;
+	_archetype		= archetype;
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include "Refureku/TypeInfo/Variables/FieldImpl.h"
 
+#if !RFK_INLINE_HOT_GETTERS
+	#include "Refureku/TypeInfo/Variables/FieldHotGetters.inl"
+#endif
+
 using namespace rfk;
 
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Field const*>;
@@ -17,11 +21,6 @@ Field::Field(Field&&) noexcept = default;
 
 Field::~Field() noexcept = default;
 
-std::size_t	Field::getMemoryOffset() const noexcept
-{
-	return getPimpl()->getMemoryOffset();
-}
-
 void Field::setUnsafe(void* instance, void const* valuePtr, std::size_t valueSize) const
 {
 	FieldBase::set(getPtrUnsafe(instance), valuePtr, valueSize);
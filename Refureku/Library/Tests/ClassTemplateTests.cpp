@@ -308,6 +308,29 @@ TEST(Rfk_ClassTemplate_getTemplateInstantiation, NonExistingMixedTemplateInstant
 	EXPECT_EQ(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
 }
 
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, WildcardTemplateArgument)
+{
+	rfk::TypeTemplateArgument arg1(rfk::getType<float>());
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ &arg1, nullptr, nullptr };
+
+	EXPECT_NE(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, PartialTemplateArguments)
+{
+	rfk::TypeTemplateArgument arg1(rfk::getType<float>());
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ &arg1 };
+
+	EXPECT_NE(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, NoTemplateArgument)
+{
+	EXPECT_EQ(mixedTemplateClass2->getTemplateInstantiation(nullptr, 0u), nullptr);
+}
+
 //=========================================================
 //===== ClassTemplate::getTemplateInstantiationsCount =====
 //=========================================================
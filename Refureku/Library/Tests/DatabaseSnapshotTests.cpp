@@ -0,0 +1,421 @@
+#include <cstdio>	//std::remove
+#include <cstring>	//std::strcmp, std::memcpy
+#include <algorithm>	//std::min
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestDatabase.h"
+#include "TestFunctions.h"
+#include "TestModule.h"
+
+namespace database_snapshot_tests
+{
+	static constexpr rfk::EEntityKind allKinds = rfk::EEntityKind::Namespace | rfk::EEntityKind::Class | rfk::EEntityKind::Struct |
+		rfk::EEntityKind::Enum | rfk::EEntityKind::FundamentalArchetype | rfk::EEntityKind::Variable | rfk::EEntityKind::Field |
+		rfk::EEntityKind::Function | rfk::EEntityKind::Method | rfk::EEntityKind::EnumValue;
+
+	/**
+	*	Manually reflected structs with a controlled memory layout, access specifiers and parameter types:
+	*		SnapshotBase <- SnapshotDerived
+	*/
+	struct SnapshotStructs
+	{
+		rfk::Struct			base{"SnapshotBase", generateTestEntityId(), sizeof(int) * 2u, false};
+		rfk::Struct			derived{"SnapshotDerived", generateTestEntityId(), sizeof(int) * 3u, true};
+		rfk::Method*		compute;
+
+		TestModule			module{"SnapshotModule"};
+
+		SnapshotStructs()
+		{
+			base.addField("value", generateTestEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &base);
+			base.addField("ratio", generateTestEntityId(), rfk::getType<float>(), rfk::EFieldFlags::Protected, sizeof(int), &base);
+
+			compute = base.addMethod("compute", generateTestEntityId(), rfk::getType<int>(), nullptr, rfk::EMethodFlags::Public | rfk::EMethodFlags::Const);
+			compute->addParameter("factor", generateTestEntityId(), rfk::getType<int>());
+			compute->addParameter("input", generateTestEntityId(), rfk::getType<float const*>());
+
+			derived.addDirectParent(&base, rfk::EAccessSpecifier::Public);
+			derived.addField("extra", generateTestEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Private, sizeof(int) * 2u, &derived);
+			base.addSubclass(derived, 0);
+
+			module.load({ &base, &derived });
+		}
+	};
+
+	void expectSameType(rfk::Type const& type, rfk::SnapshotType const& snapshotType)
+	{
+		EXPECT_STREQ(snapshotType.getArchetypeName(), (type.getArchetype() != nullptr) ? type.getArchetype()->getName() : "");
+		ASSERT_EQ(snapshotType.getTypePartsCount(), type.getTypePartsCount());
+
+		for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+		{
+			rfk::TypePart const&	part			= type.getTypePartAt(i);
+			rfk::TypePart			snapshotPart	= snapshotType.getTypePartAt(i);
+
+			EXPECT_EQ(snapshotPart.isConst(), part.isConst());
+			EXPECT_EQ(snapshotPart.isVolatile(), part.isVolatile());
+			EXPECT_EQ(snapshotPart.isPointer(), part.isPointer());
+			EXPECT_EQ(snapshotPart.isLValueReference(), part.isLValueReference());
+			EXPECT_EQ(snapshotPart.isRValueReference(), part.isRValueReference());
+			EXPECT_EQ(snapshotPart.isCArray(), part.isCArray());
+			EXPECT_EQ(snapshotPart.isValue(), part.isValue());
+		}
+
+		if (type.getArchetype() != nullptr && snapshotType.getArchetype() != nullptr)
+		{
+			EXPECT_EQ(snapshotType.getArchetype()->getId(), type.getArchetype()->getId());
+		}
+	}
+
+	void expectSameParameters(rfk::FunctionBase const& function, rfk::SnapshotEntity const& snapshotFunction)
+	{
+		expectSameType(function.getReturnType(), snapshotFunction.getReturnType());
+		ASSERT_EQ(snapshotFunction.getParametersCount(), function.getParametersCount());
+
+		for (std::size_t i = 0u; i < function.getParametersCount(); i++)
+		{
+			EXPECT_STREQ(snapshotFunction.getParameterAt(i).getName(), function.getParameterAt(i).getName());
+			expectSameType(function.getParameterAt(i).getType(), snapshotFunction.getParameterAt(i).getType());
+		}
+	}
+
+	/**
+	*	@brief Expect the data specific to the kind of an entity (types, layout, inheritance, flags) to be the same in the snapshot.
+	*/
+	void expectSameKindData(rfk::Entity const& entity, rfk::SnapshotEntity const& snapshotEntity)
+	{
+		switch (entity.getKind())
+		{
+			case rfk::EEntityKind::Struct:
+				[[fallthrough]];
+			case rfk::EEntityKind::Class:
+			{
+				rfk::Struct const& s = static_cast<rfk::Struct const&>(entity);
+
+				EXPECT_EQ(snapshotEntity.getMemorySize(), s.getMemorySize());
+				EXPECT_EQ(snapshotEntity.getAccess(), s.getAccessSpecifier());
+				EXPECT_EQ(snapshotEntity.getClassKind(), s.getClassKind());
+				ASSERT_EQ(snapshotEntity.getDirectParentsCount(), s.getDirectParentsCount());
+
+				for (std::size_t i = 0u; i < s.getDirectParentsCount(); i++)
+				{
+					EXPECT_EQ(snapshotEntity.getDirectParentAt(i).getArchetype().getId(), s.getDirectParentAt(i).getArchetype().getId());
+					EXPECT_EQ(snapshotEntity.getDirectParentAt(i).getInheritanceAccessSpecifier(), s.getDirectParentAt(i).getInheritanceAccessSpecifier());
+				}
+
+				//Subclasses that are not registered by id are not stored
+				EXPECT_LE(snapshotEntity.getSubclassesCount(), s.getSubclassesCount());
+
+				for (std::size_t i = 0u; i < snapshotEntity.getSubclassesCount(); i++)
+				{
+					rfk::Entity const* subclass = rfk::getDatabase().getEntityById(snapshotEntity.getSubclassAt(i).getId());
+
+					ASSERT_NE(subclass, nullptr);
+					ASSERT_EQ(subclass->getKind(), snapshotEntity.getSubclassAt(i).getKind());
+					EXPECT_TRUE(static_cast<rfk::Struct const*>(subclass)->isSubclassOf(s));
+					EXPECT_TRUE(snapshotEntity.getSubclassAt(i).isSubclassOf(snapshotEntity));
+				}
+				break;
+			}
+
+			case rfk::EEntityKind::Enum:
+			{
+				rfk::Enum const& e = static_cast<rfk::Enum const&>(entity);
+
+				EXPECT_EQ(snapshotEntity.getMemorySize(), e.getMemorySize());
+				EXPECT_STREQ(snapshotEntity.getType().getArchetypeName(), e.getUnderlyingArchetype().getName());
+				EXPECT_EQ(snapshotEntity.getNestedEntitiesCount(), e.getEnumValuesCount());
+				break;
+			}
+
+			case rfk::EEntityKind::FundamentalArchetype:
+				EXPECT_EQ(snapshotEntity.getMemorySize(), static_cast<rfk::Archetype const&>(entity).getMemorySize());
+				break;
+
+			case rfk::EEntityKind::EnumValue:
+				EXPECT_EQ(snapshotEntity.getValue(), static_cast<rfk::EnumValue const&>(entity).getValue());
+				break;
+
+			case rfk::EEntityKind::Variable:
+				EXPECT_EQ(snapshotEntity.getVarFlags(), static_cast<rfk::Variable const&>(entity).getFlags());
+				expectSameType(static_cast<rfk::Variable const&>(entity).getType(), snapshotEntity.getType());
+				break;
+
+			case rfk::EEntityKind::Field:
+			{
+				rfk::FieldBase const& field = static_cast<rfk::FieldBase const&>(entity);
+
+				EXPECT_EQ(snapshotEntity.getFieldFlags(), field.getFlags());
+				EXPECT_EQ(snapshotEntity.getAccess(), field.getAccess());
+				expectSameType(field.getType(), snapshotEntity.getType());
+
+				if ((field.getFlags() & rfk::EFieldFlags::Static) == rfk::EFieldFlags::Default)
+				{
+					EXPECT_EQ(snapshotEntity.getMemoryOffset(), static_cast<rfk::Field const&>(field).getMemoryOffset());
+				}
+				break;
+			}
+
+			case rfk::EEntityKind::Function:
+				EXPECT_EQ(snapshotEntity.getFunctionFlags(), static_cast<rfk::Function const&>(entity).getFlags());
+				expectSameParameters(static_cast<rfk::Function const&>(entity), snapshotEntity);
+				break;
+
+			case rfk::EEntityKind::Method:
+				EXPECT_EQ(snapshotEntity.getMethodFlags(), static_cast<rfk::MethodBase const&>(entity).getFlags());
+				EXPECT_EQ(snapshotEntity.getAccess(), static_cast<rfk::MethodBase const&>(entity).getAccess());
+				expectSameParameters(static_cast<rfk::MethodBase const&>(entity), snapshotEntity);
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+//=========================================================
+//============ Database::exportSnapshot ===================
+//=========================================================
+
+TEST(Rfk_Database_exportSnapshot, RoundTripAllEntities)
+{
+	//Register manually reflected structs as well, whose fields, methods and inheritance are controlled by the test
+	database_snapshot_tests::SnapshotStructs m;
+
+	rfk::Vector<rfk::uint8>	data	= rfk::getDatabase().exportSnapshot();
+	rfk::DatabaseSnapshot	snapshot;
+	std::size_t				count	= 0u;
+
+	ASSERT_TRUE(snapshot.loadFromMemory(data.data(), data.size()));
+
+	rfk::getDatabase().parallelForeachEntity(database_snapshot_tests::allKinds, [&snapshot, &count](rfk::Entity const& entity)
+											 {
+												 count++;
+
+												 rfk::SnapshotEntity const* snapshotEntity = snapshot.getEntityById(entity.getId());
+
+												 EXPECT_NE(snapshotEntity, nullptr);
+												 if (snapshotEntity == nullptr)
+												 {
+													 return true;
+												 }
+
+												 EXPECT_STREQ(snapshotEntity->getName(), entity.getName());
+												 EXPECT_EQ(snapshotEntity->getKind(), entity.getKind());
+
+												 if (entity.getOuterEntity() == nullptr)
+												 {
+													 EXPECT_EQ(snapshotEntity->getOuterEntity(), nullptr);
+												 }
+												 else if (snapshotEntity->getOuterEntity() != nullptr)
+												 {
+													 EXPECT_EQ(snapshotEntity->getOuterEntity()->getId(), entity.getOuterEntity()->getId());
+												 }
+
+												 EXPECT_EQ(snapshotEntity->getPropertiesCount(), entity.getPropertiesCount());
+												 for (std::size_t i = 0u; i < std::min(snapshotEntity->getPropertiesCount(), entity.getPropertiesCount()); i++)
+												 {
+													 EXPECT_EQ(snapshotEntity->getPropertyAt(i).getArchetypeId(), entity.getPropertyAt(i)->getArchetype().getId());
+												 }
+
+												 database_snapshot_tests::expectSameKindData(entity, *snapshotEntity);
+
+												 return true;
+											 }, 1u);
+
+	EXPECT_EQ(snapshot.getEntitiesCount(), count);
+
+	//Entities are sorted by id
+	for (std::size_t i = 1u; i < snapshot.getEntitiesCount(); i++)
+	{
+		EXPECT_LT(snapshot.getEntityAt(i - 1u).getId(), snapshot.getEntityAt(i).getId());
+	}
+}
+
+TEST(Rfk_Database_exportSnapshot, FileLevelEntities)
+{
+	rfk::Database const&	db		= rfk::getDatabase();
+	rfk::Vector<rfk::uint8>	data	= db.exportSnapshot();
+	rfk::DatabaseSnapshot	snapshot;
+
+	ASSERT_TRUE(snapshot.loadFromMemory(data.data(), data.size()));
+
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Namespace), db.getFileLevelNamespacesCount());
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Struct), db.getFileLevelStructsCount());
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Class), db.getFileLevelClassesCount());
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Enum), db.getFileLevelEnumsCount());
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Variable), db.getFileLevelVariablesCount());
+	EXPECT_EQ(snapshot.getFileLevelEntitiesCount(rfk::EEntityKind::Function), db.getFileLevelFunctionsCount());
+
+	db.foreachFileLevelStruct([&snapshot](rfk::Struct const& s)
+							  {
+								  EXPECT_EQ(snapshot.getFileLevelStructByName(s.getName())->getId(), s.getId());
+
+								  return true;
+							  });
+
+	EXPECT_EQ(snapshot.getFileLevelClassByName("FileLevelClass")->getId(), FileLevelClass::staticGetArchetype().getId());
+	EXPECT_EQ(snapshot.getFileLevelEnumByName("FileLevelEnum")->getId(), rfk::getEnum<FileLevelEnum>()->getId());
+	EXPECT_EQ(snapshot.getFileLevelVariableByName("fileLevelVar")->getId(), db.getFileLevelVariableByName("fileLevelVar")->getId());
+	EXPECT_EQ(snapshot.getFileLevelFunctionByName("fileLevelFunc")->getId(), db.getFileLevelFunctionByName("fileLevelFunc")->getId());
+	EXPECT_EQ(snapshot.getFileLevelEntityByName("FileLevelClass", rfk::EEntityKind::Struct | rfk::EEntityKind::Class)->getId(), FileLevelClass::staticGetArchetype().getId());
+	EXPECT_EQ(snapshot.getFileLevelStructByName("FileLevelClass"), nullptr);
+	EXPECT_NE(snapshot.getFileLevelNamespaceByName("filelevel_namespace")->getNestedEntityByName("NamespaceStruct", rfk::EEntityKind::Struct), nullptr);
+	EXPECT_EQ(snapshot.getFundamentalArchetypeByName("int")->getId(), rfk::getArchetype<int>()->getId());
+
+	//File level entities are sorted by kind, then by name
+	rfk::SnapshotEntity const* previous = nullptr;
+
+	snapshot.foreachFileLevelEntity(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, [&previous](rfk::SnapshotEntity const& entity)
+									{
+										if (previous != nullptr && previous->getKind() == entity.getKind())
+										{
+											EXPECT_LT(std::strcmp(previous->getName(), entity.getName()), 0);
+										}
+										else if (previous != nullptr)
+										{
+											EXPECT_EQ(previous->getKind(), rfk::EEntityKind::Class);
+											EXPECT_EQ(entity.getKind(), rfk::EEntityKind::Struct);
+										}
+
+										previous = &entity;
+
+										return true;
+									});
+}
+
+TEST(Rfk_Database_exportSnapshot, StructsAndEnums)
+{
+	database_snapshot_tests::SnapshotStructs m;
+
+	rfk::Vector<rfk::uint8>	data	= rfk::getDatabase().exportSnapshot();
+	rfk::DatabaseSnapshot	snapshot;
+
+	ASSERT_TRUE(snapshot.loadFromMemory(data.data(), data.size()));
+
+	rfk::SnapshotEntity const& base		= *snapshot.getFileLevelStructByName("SnapshotBase");
+	rfk::SnapshotEntity const& derived	= *snapshot.getFileLevelClassByName("SnapshotDerived");
+
+	EXPECT_EQ(base.getMemorySize(), sizeof(int) * 2u);
+	EXPECT_EQ(base.getClassKind(), rfk::EClassKind::Standard);
+
+	//Nested entities
+	ASSERT_EQ(base.getNestedEntitiesCount(), 3u);
+
+	rfk::SnapshotEntity const& value = *base.getNestedEntityByName("value", rfk::EEntityKind::Field);
+	rfk::SnapshotEntity const& ratio = *base.getNestedEntityByName("ratio", rfk::EEntityKind::Field);
+
+	EXPECT_EQ(value.getMemoryOffset(), 0u);
+	EXPECT_EQ(ratio.getMemoryOffset(), sizeof(int));
+	EXPECT_EQ(ratio.getAccess(), rfk::EAccessSpecifier::Protected);
+	EXPECT_EQ(ratio.getFieldFlags(), rfk::EFieldFlags::Protected);
+	EXPECT_EQ(ratio.getOuterEntity(), &base);
+	EXPECT_EQ(base.getNestedEntityByName("ratio", rfk::EEntityKind::Method), nullptr);
+	database_snapshot_tests::expectSameType(rfk::getType<float>(), ratio.getType());
+
+	//Methods
+	rfk::SnapshotEntity const& compute = *base.getNestedEntityByName("compute", rfk::EEntityKind::Method);
+
+	EXPECT_EQ(compute.getMethodFlags(), m.compute->getFlags());
+	EXPECT_EQ(compute.getFieldFlags(), rfk::EFieldFlags::Default);
+	database_snapshot_tests::expectSameType(rfk::getType<int>(), compute.getReturnType());
+	ASSERT_EQ(compute.getParametersCount(), 2u);
+	EXPECT_STREQ(compute.getParameterAt(1u).getName(), "input");
+	database_snapshot_tests::expectSameType(rfk::getType<float const*>(), compute.getParameterAt(1u).getType());
+
+	//Inheritance
+	ASSERT_EQ(derived.getDirectParentsCount(), 1u);
+	EXPECT_EQ(&derived.getDirectParentAt(0u).getArchetype(), &base);
+	EXPECT_EQ(derived.getDirectParentAt(0u).getInheritanceAccessSpecifier(), rfk::EAccessSpecifier::Public);
+	EXPECT_TRUE(derived.isSubclassOf(base));
+	EXPECT_FALSE(base.isSubclassOf(derived));
+	EXPECT_FALSE(base.isSubclassOf(base));
+	ASSERT_EQ(base.getSubclassesCount(), 1u);
+	EXPECT_EQ(&base.getSubclassAt(0u), &derived);
+	EXPECT_EQ(derived.getNestedEntityByName("value", rfk::EEntityKind::Field), nullptr);
+	EXPECT_EQ(derived.getNestedEntityByName("value", rfk::EEntityKind::Field, true), &value);
+
+	//Enums
+	rfk::SnapshotEntity const& e = *snapshot.getFileLevelEnumByName("FileLevelEnum");
+
+	EXPECT_EQ(e.getMemorySize(), sizeof(FileLevelEnum));
+	EXPECT_STREQ(e.getType().getArchetypeName(), "int");
+	EXPECT_EQ(e.getType().getTypePartsCount(), 0u);
+	ASSERT_NE(e.getEnumValue(1), nullptr);
+	EXPECT_STREQ(e.getEnumValue(1)->getName(), "Value2");
+	EXPECT_EQ(e.getEnumValue(2), nullptr);
+
+	//Functions
+	rfk::SnapshotEntity const& function = *snapshot.getFileLevelFunctionByName("func_return_singleParam");
+
+	ASSERT_EQ(function.getParametersCount(), 1u);
+	database_snapshot_tests::expectSameType(rfk::getType<int>(), function.getParameterAt(0u).getType());
+	EXPECT_EQ(snapshot.getEntityById(m.compute->getId()), &compute);
+}
+
+TEST(Rfk_Database_exportSnapshot, ToFile)
+{
+	char const*				filePath	= "RefurekuTestsSnapshot.rfks";
+	rfk::Vector<rfk::uint8>	data		= rfk::getDatabase().exportSnapshot();
+	rfk::DatabaseSnapshot	memorySnapshot;
+	rfk::DatabaseSnapshot	snapshot;
+
+	ASSERT_TRUE(rfk::getDatabase().exportSnapshot(filePath));
+	ASSERT_TRUE(memorySnapshot.loadFromMemory(data.data(), data.size()));
+
+	EXPECT_TRUE(snapshot.loadFromFile(filePath));
+	EXPECT_EQ(snapshot.getEntitiesCount(), memorySnapshot.getEntitiesCount());
+	EXPECT_NE(snapshot.getFileLevelClassByName("FileLevelClass"), nullptr);
+	EXPECT_FALSE(snapshot.loadFromFile("MissingRefurekuTestsSnapshot.rfks"));
+	EXPECT_FALSE(snapshot.isLoaded());
+
+	std::remove(filePath);
+}
+
+//=========================================================
+//========== DatabaseSnapshot::loadFromMemory =============
+//=========================================================
+
+TEST(Rfk_DatabaseSnapshot_loadFromMemory, RejectsInvalidSnapshots)
+{
+	rfk::Vector<rfk::uint8>		data = rfk::getDatabase().exportSnapshot();
+	std::vector<rfk::uint64>	buffer(data.size() / sizeof(rfk::uint64) + 1u);
+	rfk::DatabaseSnapshot		snapshot;
+
+	EXPECT_FALSE(snapshot.isLoaded());
+	EXPECT_EQ(snapshot.getEntitiesCount(), 0u);
+	EXPECT_EQ(snapshot.getEntityById(FileLevelClass::staticGetArchetype().getId()), nullptr);
+
+	std::memcpy(buffer.data(), data.data(), data.size());
+	EXPECT_TRUE(snapshot.loadFromMemory(buffer.data(), data.size()));
+
+	//Truncated
+	EXPECT_FALSE(snapshot.loadFromMemory(buffer.data(), data.size() - 1u));
+	EXPECT_FALSE(snapshot.isLoaded());
+
+	//Misaligned
+	std::memcpy(reinterpret_cast<char*>(buffer.data()) + 1u, data.data(), data.size() - 1u);
+	EXPECT_FALSE(snapshot.loadFromMemory(reinterpret_cast<char*>(buffer.data()) + 1u, data.size() - 1u));
+
+	//Bad magic
+	std::memcpy(buffer.data(), data.data(), data.size());
+	reinterpret_cast<char*>(buffer.data())[0] = 'X';
+	EXPECT_FALSE(snapshot.loadFromMemory(buffer.data(), data.size()));
+
+	//Bad version
+	std::memcpy(buffer.data(), data.data(), data.size());
+	reinterpret_cast<char*>(buffer.data())[8] ^= 0x7f;
+	EXPECT_FALSE(snapshot.loadFromMemory(buffer.data(), data.size()));
+
+	//Not a snapshot
+	std::memset(buffer.data(), 0, data.size());
+	EXPECT_FALSE(snapshot.loadFromMemory(buffer.data(), data.size()));
+	EXPECT_FALSE(snapshot.loadFromMemory(data.data(), 16u));
+
+	EXPECT_FALSE(snapshot.loadFromMemory(nullptr, 0u));
+	EXPECT_EQ(snapshot.getFileLevelClassByName("FileLevelClass"), nullptr);
+}
\ No newline at end of file
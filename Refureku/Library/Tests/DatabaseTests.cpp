@@ -1,4 +1,7 @@
 #include <stdexcept>	//std::logic_error
+#include <atomic>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
@@ -777,6 +780,22 @@ TEST(Rfk_Database_foreachFileLevelClass_getFileLevelClasssCount, BreakingLoop)
 	EXPECT_EQ(counter, 1u);
 }
 
+
+TEST(Rfk_Database_foreachFileLevelClass_getFileLevelClasssCount, CompleteLoopCallable)
+{
+	std::size_t counter = 0u;
+
+	EXPECT_TRUE(rfk::getDatabase().foreachFileLevelClass([&counter](rfk::Class const&)
+														 {
+															 counter++;
+
+															 return true;
+														 }));
+
+	EXPECT_EQ(counter, rfk::getDatabase().getFileLevelClassesCount());
+	EXPECT_EQ(counter, rfk::getDatabase().getFileLevelClassesSpan().size());
+}
+
 //=========================================================
 //================ Database::getEnumById ==================
 //=========================================================
@@ -1410,4 +1429,229 @@ TEST(Rfk_Database_getEnumValueById, NonEnumValueEntityId)
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticFieldByName("_staticField")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getMethodByName("method")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticMethodByName("staticMethod")->getId()), nullptr);
+}
+
+//=========================================================
+//=========== Database::parallelForeachEntity =============
+//=========================================================
+
+TEST(Rfk_Database_parallelForeachEntity, SameEntitiesForAllThreadsCounts)
+{
+	rfk::Database const& db = rfk::getDatabase();
+
+	auto countEntities = [&db](rfk::EEntityKind kinds, std::size_t threadsCount)
+	{
+		std::atomic<std::size_t> count{0u};
+
+		EXPECT_TRUE(db.parallelForeachEntity(kinds, [&count](rfk::Entity const&) { count++; return true; }, threadsCount));
+
+		return count.load();
+	};
+
+	std::size_t structsCount = countEntities(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, 1u);
+
+	EXPECT_GT(structsCount, 0u);
+	EXPECT_EQ(countEntities(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, 4u), structsCount);
+	EXPECT_EQ(countEntities(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, 0u), structsCount);
+	EXPECT_EQ(countEntities(rfk::EEntityKind::Undefined, 4u), 0u);
+}
+
+TEST(Rfk_Database_parallelForeachEntity, KindFilter)
+{
+	std::atomic<bool> onlyFields{true};
+
+	rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Field, [&onlyFields](rfk::Entity const& entity)
+											 {
+												 if (entity.getKind() != rfk::EEntityKind::Field)
+												 {
+													 onlyFields = false;
+												 }
+
+												 return true;
+											 }, 4u);
+
+	EXPECT_TRUE(onlyFields);
+}
+
+TEST(Rfk_Database_parallelForeachEntity, FunctionPointerVisitor)
+{
+	std::atomic<std::size_t> count{0u};
+
+	EXPECT_TRUE(rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Enum, [](rfk::Entity const&, void* userData)
+														 {
+															 (*reinterpret_cast<std::atomic<std::size_t>*>(userData))++;
+
+															 return true;
+														 }, &count, 4u));
+
+	EXPECT_GT(count.load(), 0u);
+	EXPECT_FALSE(rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Enum, nullptr, nullptr, 4u));
+}
+
+TEST(Rfk_Database_parallelForeachEntity, AbortingVisitor)
+{
+	EXPECT_FALSE(rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, [](rfk::Entity const&) { return false; }, 4u));
+}
+
+TEST(Rfk_Database_parallelForeachEntity, ThrowingVisitor)
+{
+	auto visitor = [](rfk::Entity const&) -> bool
+	{
+		throw std::logic_error("Something wrong happened here!");
+	};
+
+	EXPECT_THROW(rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Struct | rfk::EEntityKind::Class, visitor, 4u), std::logic_error);
+}
+
+//=========================================================
+//=========== Database::parallelReduceEntities ============
+//=========================================================
+
+TEST(Rfk_Database_parallelReduceEntities, DeterministicOrder)
+{
+	auto concatenateNames = [](std::size_t threadsCount)
+	{
+		return rfk::getDatabase().parallelReduceEntities(rfk::EEntityKind::Struct | rfk::EEntityKind::Class | rfk::EEntityKind::Field, std::string(),
+														  [](rfk::Entity const& entity) { return std::string(entity.getName()); },
+														  [](std::string const& lhs, std::string const& rhs) { return lhs + "/" + rhs; },
+														  threadsCount);
+	};
+
+	std::string singleThreadResult = concatenateNames(1u);
+
+	EXPECT_FALSE(singleThreadResult.empty());
+	EXPECT_EQ(concatenateNames(2u), singleThreadResult);
+	EXPECT_EQ(concatenateNames(8u), singleThreadResult);
+}
+
+TEST(Rfk_Database_parallelReduceEntities, NoMatchingEntity)
+{
+	EXPECT_EQ(rfk::getDatabase().parallelReduceEntities(rfk::EEntityKind::Undefined, 42, [](rfk::Entity const&) { return 1; }, [](int lhs, int rhs) { return lhs + rhs; }, 4u), 42);
+}
+//=========================================================
+//========= Database::foreachEntityByNamePrefix ===========
+//=========================================================
+
+namespace database_tests
+{
+	/** Manually reflected structs registered for the duration of a name index test. */
+	struct NameIndexModule
+	{
+		rfk::Struct			alpha{"NameIndexAlpha", 5100001u, 1u, false};
+		rfk::Struct			beta{"nameindexBeta", 5100002u, 1u, false};
+		rfk::Struct			gamma{"NameIndexGamma", 5100003u, 1u, true};
+		rfk::Method*		alphaRun;
+		rfk::Method*		alphaReset;
+		rfk::Field*			alphaRate;
+		rfk::Method*		gammaRun;
+
+		rfk::ModuleHandle	module{"NameIndexModule"};
+
+		NameIndexModule()
+		{
+			alphaRun	= alpha.addMethod("Run", 5100011u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			alphaReset	= alpha.addMethod("Reset", 5100012u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			alphaRate	= alpha.addField("rate", 5100013u, rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &alpha);
+			gammaRun	= gamma.addMethod("Run", 5100031u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+
+			rfk::Entity const* const entities[] = { &gamma, &beta, &alpha };
+			module.addEntities(entities, std::size(entities));
+			module.load();
+		}
+	};
+
+	std::vector<rfk::Entity const*> toStdVector(rfk::Vector<rfk::Entity const*> const& entities)
+	{
+		return std::vector<rfk::Entity const*>(entities.cbegin(), entities.cend());
+	}
+}
+
+TEST(Rfk_Database_foreachEntityByNamePrefix, CaseSensitivity)
+{
+	database_tests::NameIndexModule m;
+	rfk::Database const& db = rfk::getDatabase();
+
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class)),
+			  (std::vector<rfk::Entity const*>{ &m.alpha, &m.gamma }));
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("NAMEINDEX", rfk::EEntityKind::Struct | rfk::EEntityKind::Class, 0u, false)),
+			  (std::vector<rfk::Entity const*>{ &m.alpha, &m.beta, &m.gamma }));
+	EXPECT_TRUE(db.getEntitiesByNamePrefix("NAMEINDEX", rfk::EEntityKind::Struct | rfk::EEntityKind::Class).empty());
+}
+
+TEST(Rfk_Database_foreachEntityByNamePrefix, KindsAndMaxResults)
+{
+	database_tests::NameIndexModule m;
+	rfk::Database const& db = rfk::getDatabase();
+
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Class, 0u, false)),
+			  (std::vector<rfk::Entity const*>{ &m.gamma }));
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("nameindex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class, 2u, false)),
+			  (std::vector<rfk::Entity const*>{ &m.alpha, &m.beta }));
+}
+
+TEST(Rfk_Database_foreachEntityByNamePrefix, OuterEntity)
+{
+	database_tests::NameIndexModule m;
+	rfk::Database const& db = rfk::getDatabase();
+
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("R", rfk::EEntityKind::Method | rfk::EEntityKind::Field, 0u, false, &m.alpha)),
+			  (std::vector<rfk::Entity const*>{ m.alphaRate, m.alphaReset, m.alphaRun }));
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("Run", rfk::EEntityKind::Method, 0u, true, &m.gamma)),
+			  (std::vector<rfk::Entity const*>{ m.gammaRun }));
+	EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("", rfk::EEntityKind::Method | rfk::EEntityKind::Field, 0u, true, &m.beta)),
+			  (std::vector<rfk::Entity const*>{}));
+}
+
+TEST(Rfk_Database_foreachEntityByNamePrefix, IncrementalUpdate)
+{
+	rfk::Database const& db = rfk::getDatabase();
+
+	//Build the index before the module is registered
+	EXPECT_TRUE(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class).empty());
+
+	{
+		database_tests::NameIndexModule m;
+
+		EXPECT_EQ(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class).size(), 2u);
+
+		rfk::Struct			delta{"NameIndexDelta", 5100004u, 1u, false};
+		rfk::ModuleHandle	otherModule{"NameIndexOtherModule"};
+		rfk::Entity const*	deltaEntity = &delta;
+
+		otherModule.addEntities(&deltaEntity, 1u);
+		otherModule.load();
+
+		EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class)),
+				  (std::vector<rfk::Entity const*>{ &m.alpha, &delta, &m.gamma }));
+
+		otherModule.unload();
+
+		EXPECT_EQ(database_tests::toStdVector(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class)),
+				  (std::vector<rfk::Entity const*>{ &m.alpha, &m.gamma }));
+	}
+
+	//The destroyed entities are removed from the index
+	EXPECT_TRUE(db.getEntitiesByNamePrefix("NameIndex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class).empty());
+	EXPECT_TRUE(db.getEntitiesByNamePrefix("Run", rfk::EEntityKind::Method).empty());
+}
+
+TEST(Rfk_Database_foreachEntityByNamePrefix, Visitors)
+{
+	database_tests::NameIndexModule m;
+	rfk::Database const& db = rfk::getDatabase();
+	std::size_t count = 0u;
+
+	EXPECT_FALSE(db.foreachEntityByNamePrefix("nameindex", rfk::EEntityKind::Struct | rfk::EEntityKind::Class, [&count](rfk::Entity const&) { return ++count != 2u; }, false));
+	EXPECT_EQ(count, 2u);
+
+	EXPECT_TRUE(db.foreachEntityByNamePrefix("NameIndex", rfk::EEntityKind::Struct, [](rfk::Entity const&, void* userData)
+											 {
+												 (*reinterpret_cast<std::size_t*>(userData))++;
+
+												 return true;
+											 }, &count));
+	EXPECT_EQ(count, 3u);
+
+	EXPECT_FALSE(db.foreachEntityByNamePrefix("NameIndex", rfk::EEntityKind::Struct, nullptr, nullptr));
+	EXPECT_FALSE(db.foreachEntityByNamePrefix(nullptr, rfk::EEntityKind::Struct, [](rfk::Entity const&) { return true; }));
 }
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Query/EntityQuery.h>
+
+#include "TestModule.h"
+
+namespace entity_query_tests
+{
+	/** Property with a manually reflected archetype. */
+	class QueryProperty : public rfk::Property
+	{
+		private:
+			rfk::Struct const& _archetype;
+
+		public:
+			QueryProperty(rfk::Struct const& archetype) noexcept:
+				_archetype{archetype}
+			{
+			}
+
+			virtual rfk::Struct const& getArchetype() const noexcept override
+			{
+				return _archetype;
+			}
+	};
+
+	/**
+	*	Manually reflected hierarchy registered for the duration of a test:
+	*		QueryComponent <- QueryDerived <- QueryDerivedDerived, QueryUnrelated
+	*/
+	struct Hierarchy
+	{
+		rfk::Struct			exposed{"QueryExposed", generateTestEntityId(), 1u, false};
+		rfk::Struct			exposedChild{"QueryExposedChild", generateTestEntityId(), 1u, false};
+		QueryProperty		exposedProperty{exposed};
+		QueryProperty		exposedChildProperty{exposedChild};
+
+		rfk::Struct			component{"QueryComponent", generateTestEntityId(), 1u, true};
+		rfk::Struct			derived{"QueryDerived", generateTestEntityId(), 1u, true};
+		rfk::Struct			derivedDerived{"QueryDerivedDerived", generateTestEntityId(), 1u, true};
+		rfk::Struct			unrelated{"QueryUnrelated", generateTestEntityId(), 1u, true};
+
+		rfk::Method*		componentOnUpdate;
+		rfk::Method*		derivedOnUpdate;
+		rfk::Method*		derivedOnDraw;
+		rfk::Method*		derivedOnHidden;
+		rfk::Method*		derivedTick;
+		rfk::Method*		derivedDerivedOnBoth;
+		rfk::Method*		unrelatedOnUpdate;
+		rfk::Field*			derivedField;
+
+		TestModule			module{"EntityQueryTestsModule"};
+
+		Hierarchy()
+		{
+			exposedChild.addDirectParent(&exposed, rfk::EAccessSpecifier::Public);
+			exposed.addSubclass(exposedChild, 0);
+
+			derived.addDirectParent(&component, rfk::EAccessSpecifier::Public);
+			component.addSubclass(derived, 0);
+			derivedDerived.addDirectParent(&derived, rfk::EAccessSpecifier::Public);
+			derived.addSubclass(derivedDerived, 0);
+			component.addSubclass(derivedDerived, 0);
+
+			componentOnUpdate		= component.addMethod("OnUpdate", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public | rfk::EMethodFlags::Virtual);
+			derivedOnUpdate			= derived.addMethod("OnUpdate", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public | rfk::EMethodFlags::Override);
+			derivedOnDraw			= derived.addMethod("OnDraw", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			derivedOnHidden			= derived.addMethod("OnHidden", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Private);
+			derivedTick				= derived.addMethod("Tick", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			derivedDerivedOnBoth	= derivedDerived.addMethod("OnBoth", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			unrelatedOnUpdate		= unrelated.addMethod("OnUpdate", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			derivedField			= derived.addField("OnField", generateTestEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &derived);
+
+			//Methods without property make the subclass table less selective than the property index
+			for (std::size_t i = 0u; i < 8u; i++)
+			{
+				derivedDerived.addMethod("Helper", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+			}
+
+			componentOnUpdate->addProperty(exposedProperty);
+			derivedOnUpdate->addProperty(exposedProperty);
+			derivedOnHidden->addProperty(exposedProperty);
+			derivedTick->addProperty(exposedProperty);
+			derivedDerivedOnBoth->addProperty(exposedProperty);
+			derivedDerivedOnBoth->addProperty(exposedChildProperty);
+			unrelatedOnUpdate->addProperty(exposedProperty);
+			derivedField->addProperty(exposedChildProperty);
+
+			module.load({ &exposed, &exposedChild, &component, &derived, &derivedDerived, &unrelated });
+		}
+	};
+
+	/**
+	*	@return The sorted results of the compiled query.
+	*/
+	std::vector<rfk::Entity const*> getSortedResults(rfk::CompiledQuery const& query)
+	{
+		rfk::Vector<rfk::Entity const*> results = query.getResults();
+		std::vector<rfk::Entity const*> sortedResults(results.cbegin(), results.cend());
+
+		std::sort(sortedResults.begin(), sortedResults.end());
+
+		return sortedResults;
+	}
+
+	/**
+	*	@return The sorted registered entities matching a predicate, found by visiting the whole database.
+	*/
+	template <typename Predicate>
+	std::vector<rfk::Entity const*> getSortedEntitiesByPredicate(Predicate predicate)
+	{
+		std::vector<rfk::Entity const*> result;
+
+		rfk::getDatabase().parallelForeachEntity(rfk::EEntityKind::Struct | rfk::EEntityKind::Class | rfk::EEntityKind::Field | rfk::EEntityKind::Method,
+												 [&result, &predicate](rfk::Entity const& entity)
+												 {
+													 if (predicate(entity))
+													 {
+														 result.push_back(&entity);
+													 }
+
+													 return true;
+												 }, 1u);
+
+		std::sort(result.begin(), result.end());
+
+		return result;
+	}
+}
+
+//=========================================================
+//================= EntityQuery::compile ==================
+//=========================================================
+
+TEST(Rfk_EntityQuery_compile, PropertyIndexIsTheMostSelective)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method)
+												 .withNamePrefix("On")
+												 .derivedFrom(h.component)
+												 .withProperty(h.exposed)
+												 .withAccess(rfk::EAccessSpecifier::Public)
+												 .compile();
+
+	EXPECT_EQ(query.getSource(), rfk::EQuerySource::PropertyIndex);
+	EXPECT_EQ(query.getEstimatedCandidatesCount(), 8u);
+
+	std::vector<rfk::Entity const*> expected = { h.derivedOnUpdate, h.derivedDerivedOnBoth };
+	std::sort(expected.begin(), expected.end());
+
+	EXPECT_EQ(entity_query_tests::getSortedResults(query), expected);
+	EXPECT_EQ(query.count(), 2u);
+	EXPECT_NE(std::string(query.explain()).find("Source: property index [QueryExposed and subclasses]"), std::string::npos);
+	EXPECT_NE(std::string(query.explain()).find("subclass table [QueryComponent]"), std::string::npos);
+}
+
+TEST(Rfk_EntityQuery_compile, SubclassTable)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method | rfk::EEntityKind::Class).derivedFrom(h.component, true).compile();
+
+	EXPECT_EQ(query.getSource(), rfk::EQuerySource::SubclassTable);
+
+	EXPECT_EQ(entity_query_tests::getSortedResults(query),
+			  entity_query_tests::getSortedEntitiesByPredicate([&h](rfk::Entity const& entity)
+															   {
+																   rfk::Entity const* s = (entity.getKind() == rfk::EEntityKind::Method) ? entity.getOuterEntity() : &entity;
+
+																   return entity.getKind() != rfk::EEntityKind::Field && h.component.isBaseOf(*static_cast<rfk::Struct const*>(s));
+															   }));
+
+	//3 classes, 6 methods and 8 helper methods
+	EXPECT_EQ(query.count(), 17u);
+
+	//By-name lookups in each subclass
+	rfk::CompiledQuery namedQuery = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method).named("OnUpdate").derivedFrom(h.component).compile();
+
+	EXPECT_EQ(namedQuery.getSource(), rfk::EQuerySource::SubclassTable);
+	EXPECT_EQ(namedQuery.getFirst(), h.derivedOnUpdate);
+	EXPECT_EQ(namedQuery.count(), 1u);
+}
+
+TEST(Rfk_EntityQuery_compile, FileLevelIndex)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().named("QueryDerived").atFileLevel().compile();
+
+	EXPECT_EQ(query.getSource(), rfk::EQuerySource::FileLevelIndex);
+	EXPECT_EQ(query.getEstimatedCandidatesCount(), 1u);
+	EXPECT_EQ(query.getFirst(), &h.derived);
+
+	EXPECT_EQ(rfk::EntityQuery().named("QueryDerived").ofKind(rfk::EEntityKind::Struct).atFileLevel().compile().getFirst(), nullptr);
+}
+
+TEST(Rfk_EntityQuery_compile, FullScan)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().withNamePrefix("QueryDerived").compile();
+
+	EXPECT_EQ(query.getSource(), rfk::EQuerySource::FullScan);
+	EXPECT_NE(std::string(query.explain()).find("Other indices: none"), std::string::npos);
+
+	std::vector<rfk::Entity const*> expected = { &h.derived, &h.derivedDerived };
+	std::sort(expected.begin(), expected.end());
+
+	EXPECT_EQ(entity_query_tests::getSortedResults(query), expected);
+}
+
+//=========================================================
+//================= CompiledQuery::foreach ================
+//=========================================================
+
+TEST(Rfk_CompiledQuery_foreach, SameResultsAsBruteForce)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().withNamePrefix("On").derivedFrom(h.component).withProperty(h.exposed).compile();
+
+	EXPECT_EQ(entity_query_tests::getSortedResults(query),
+			  entity_query_tests::getSortedEntitiesByPredicate([&h](rfk::Entity const& entity)
+															   {
+																   return std::string(entity.getName()).rfind("On", 0) == 0 &&
+																	   entity.getOuterEntity() != nullptr &&
+																	   (entity.getOuterEntity()->getKind() & (rfk::EEntityKind::Struct | rfk::EEntityKind::Class)) != rfk::EEntityKind::Undefined &&
+																	   static_cast<rfk::Struct const*>(entity.getOuterEntity())->isSubclassOf(h.component) &&
+																	   entity.getProperty(h.exposed) != nullptr;
+															   }));
+
+	//The field carries a child property only
+	EXPECT_EQ(query.count(), 4u);
+	EXPECT_EQ(rfk::EntityQuery().withProperty(h.exposed, false).derivedFrom(h.component).withNamePrefix("On").compile().count(), 3u);
+	EXPECT_EQ(rfk::EntityQuery().withProperty(h.exposedChild).compile().count(), 2u);
+}
+
+TEST(Rfk_CompiledQuery_foreach, FlagsFilters)
+{
+	entity_query_tests::Hierarchy h;
+
+	EXPECT_EQ(rfk::EntityQuery().derivedFrom(h.component, true).withMethodFlags(rfk::EMethodFlags::Virtual).compile().getFirst(), h.componentOnUpdate);
+	EXPECT_EQ(rfk::EntityQuery().derivedFrom(h.component).withFieldFlags(rfk::EFieldFlags::Public).compile().getFirst(), h.derivedField);
+	EXPECT_EQ(rfk::EntityQuery().derivedFrom(h.component).withAccess(rfk::EAccessSpecifier::Private).compile().getFirst(), h.derivedOnHidden);
+}
+
+TEST(Rfk_CompiledQuery_foreach, AbortAndCallable)
+{
+	entity_query_tests::Hierarchy h;
+
+	rfk::CompiledQuery query = rfk::EntityQuery().ofKind(rfk::EEntityKind::Method).derivedFrom(h.component).compile();
+
+	int count = 0;
+	EXPECT_FALSE(query.foreach([&count](rfk::Entity const&) { return ++count != 2; }));
+	EXPECT_EQ(count, 2);
+
+	EXPECT_TRUE(query.foreach([](rfk::Entity const&, void*) { return true; }, nullptr));
+	EXPECT_FALSE(query.foreach(nullptr, nullptr));
+}
+
+TEST(Rfk_CompiledQuery_foreach, ReflectsDatabaseState)
+{
+	rfk::CompiledQuery query = rfk::EntityQuery().withNamePrefix("QueryDerived").compile();
+
+	{
+		entity_query_tests::Hierarchy h;
+
+		EXPECT_EQ(query.count(), 2u);
+	}
+
+	EXPECT_EQ(query.count(), 0u);
+	EXPECT_EQ(query.getFirst(), nullptr);
+}
\ No newline at end of file
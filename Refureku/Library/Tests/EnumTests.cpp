@@ -1,4 +1,6 @@
 #include <stdexcept>	//std::logic_error
+#include <string>		//std::to_string
+#include <limits>		//std::numeric_limits
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
@@ -7,6 +9,7 @@
 #include "TestClass.h"
 #include "TestClass2.h"
 #include "TestEnum.h"
+#include "ManualEnumReflection.h"
 #include "TestNamespace.h"
 #include "TypeTemplateClassTemplate.h"
 
@@ -51,6 +54,90 @@ TEST(Rfk_Enum_getEnumValue, NonExistantValue)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValue(-1), nullptr);
 }
 
+TEST(Rfk_Enum_getEnumValue, FirstDeclaredValue)
+{
+	EXPECT_STREQ(rfk::getEnum<TestEnumClass>()->getEnumValue(1 << 2)->getName(), "Value3");
+}
+
+TEST(Rfk_Enum_getEnumValue, DenseValues)
+{
+	rfk::Enum denseEnum("DenseEnum", 0u, rfk::getArchetype<int>());
+
+	//Add values in non-sorted order to exercise both the in-place and rebuild paths of the dense table
+	for (int i = 0; i < 600; i++)
+	{
+		int value = (i % 2 == 0) ? i : -i;
+		denseEnum.addEnumValue(("Value" + std::to_string(value)).c_str(), static_cast<std::size_t>(i + 1), value);
+	}
+
+	for (int i = -599; i < 600; i++)
+	{
+		rfk::EnumValue const* enumValue = denseEnum.getEnumValue(i);
+
+		if ((i >= 0) ? (i % 2 == 0) : (i % 2 != 0))
+		{
+			ASSERT_NE(enumValue, nullptr);
+			EXPECT_EQ(enumValue->getValue(), i);
+			EXPECT_EQ(denseEnum.getEnumValueByName(("Value" + std::to_string(i)).c_str()), enumValue);
+		}
+		else
+		{
+			EXPECT_EQ(enumValue, nullptr);
+		}
+	}
+
+	EXPECT_EQ(denseEnum.getEnumValue(-600), nullptr);
+	EXPECT_EQ(denseEnum.getEnumValue(600), nullptr);
+}
+
+TEST(Rfk_Enum_getEnumValue, DecreasingValues)
+{
+	rfk::Enum decreasingEnum("DecreasingEnum", 0u, rfk::getArchetype<long long>());
+
+	//Values added in decreasing order down to the smallest int64 rebase the dense table below its first value
+	for (int i = 599; i >= 0; i--)
+	{
+		decreasingEnum.addEnumValue(("Value" + std::to_string(i)).c_str(), static_cast<std::size_t>(600 - i), std::numeric_limits<rfk::int64>::min() + i);
+	}
+
+	decreasingEnum.addEnumValue("Alias", 601u, std::numeric_limits<rfk::int64>::min() + 300);
+
+	for (int i = 0; i < 600; i++)
+	{
+		rfk::EnumValue const* enumValue = decreasingEnum.getEnumValue(std::numeric_limits<rfk::int64>::min() + i);
+
+		ASSERT_NE(enumValue, nullptr);
+		EXPECT_EQ(enumValue, decreasingEnum.getEnumValueByName(("Value" + std::to_string(i)).c_str()));
+	}
+
+	EXPECT_EQ(decreasingEnum.getEnumValue(std::numeric_limits<rfk::int64>::min() + 600), nullptr);
+	EXPECT_EQ(decreasingEnum.getEnumValues(std::numeric_limits<rfk::int64>::min() + 300).size(), 2u);
+}
+
+TEST(Rfk_Enum_getEnumValue, SparseValues)
+{
+	rfk::Enum sparseEnum("SparseEnum", 0u, rfk::getArchetype<long long>());
+
+	sparseEnum.addEnumValue("Max", 1u, std::numeric_limits<rfk::int64>::max());
+	sparseEnum.addEnumValue("Min", 2u, std::numeric_limits<rfk::int64>::min());
+
+	for (int i = 0; i < 62; i++)
+	{
+		sparseEnum.addEnumValue(("Flag" + std::to_string(i)).c_str(), static_cast<std::size_t>(i + 3), rfk::int64(1) << i);
+	}
+
+	sparseEnum.addEnumValue("FlagAlias", 65u, rfk::int64(1) << 10);
+
+	EXPECT_STREQ(sparseEnum.getEnumValue(std::numeric_limits<rfk::int64>::max())->getName(), "Max");
+	EXPECT_STREQ(sparseEnum.getEnumValue(std::numeric_limits<rfk::int64>::min())->getName(), "Min");
+	EXPECT_STREQ(sparseEnum.getEnumValue(rfk::int64(1) << 10)->getName(), "Flag10");
+	EXPECT_EQ(sparseEnum.getEnumValue(3), nullptr);
+	EXPECT_EQ(sparseEnum.getEnumValues(rfk::int64(1) << 10).size(), 2u);
+	EXPECT_STREQ(sparseEnum.getEnumValues(rfk::int64(1) << 10)[1]->getName(), "FlagAlias");
+	EXPECT_EQ(sparseEnum.getEnumValueByName("Flag61")->getValue(), rfk::int64(1) << 61);
+	EXPECT_EQ(sparseEnum.getEnumValueByName("Flag62"), nullptr);
+}
+
 //=========================================================
 //============ Enum::getEnumValueByPredicate ==============
 //=========================================================
@@ -91,6 +178,15 @@ TEST(Rfk_Enum_getEnumValueByPredicate, ThrowingPredicate)
 	EXPECT_THROW(rfk::getEnum<TestEnum>()->getEnumValueByPredicate(predicate, nullptr), std::logic_error);
 }
 
+
+TEST(Rfk_Enum_getEnumValueByPredicate, MatchingValueFoundCallable)
+{
+	rfk::EnumValue const* result = rfk::getEnum<TestEnumClass>()->getEnumValueByPredicate([](rfk::EnumValue const& ev) { return ev.getValue() == (1 << 2); });
+
+	ASSERT_NE(result, nullptr);
+	EXPECT_STREQ(result->getName(), "Value3");
+}
+
 //=========================================================
 //================= Enum::getEnumValues ===================
 //=========================================================
@@ -147,6 +243,14 @@ TEST(Rfk_Enum_getEnumValuesByPredicate, ThrowingPredicate)
 	EXPECT_THROW(rfk::getEnum<TestEnum>()->getEnumValuesByPredicate(predicate, nullptr), std::logic_error);
 }
 
+
+TEST(Rfk_Enum_getEnumValuesByPredicate, MatchingValuesFoundCallable)
+{
+	char firstLetter = 'V';
+
+	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValuesByPredicate([firstLetter](rfk::EnumValue const& ev) { return ev.getName()[0] == firstLetter; }).size(), 5u);
+}
+
 //=========================================================
 //================= Enum::getEnumValueAt ==================
 //=========================================================
@@ -238,4 +342,82 @@ TEST(Rfk_Enum_foreachEnumValue, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getEnum<TestEnumClass>()->foreachEnumValue(visitor, nullptr), std::logic_error);
+}
+
+
+TEST(Rfk_Enum_foreachEnumValue, BreakingLoopCallable)
+{
+	int counter = 0;
+
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->foreachEnumValue([&counter](rfk::EnumValue const&) { return ++counter != 2; }));
+
+	EXPECT_EQ(counter, 2);
+}
+
+//=========================================================
+//=============== Enum::getEnumValuesSpan =================
+//=========================================================
+
+TEST(Rfk_Enum_getEnumValuesSpan, DeclarationOrder)
+{
+	rfk::Span<rfk::EnumValue const> values = rfk::getEnum<TestEnumClass>()->getEnumValuesSpan();
+
+	ASSERT_EQ(values.size(), rfk::getEnum<TestEnumClass>()->getEnumValuesCount());
+
+	for (std::size_t i = 0u; i < values.size(); i++)
+	{
+		EXPECT_EQ(&values[i], &rfk::getEnum<TestEnumClass>()->getEnumValueAt(i));
+	}
+}
+
+//=========================================================
+//================== rfk::enumToString ====================
+//=========================================================
+
+TEST(Rfk_enumToString, ExistantValue)
+{
+	constexpr char const* name = rfk::enumToString(TestEnumValue2);
+
+	EXPECT_STREQ(name, "TestEnumValue2");
+	EXPECT_STREQ(rfk::enumToString(TestEnumClass::Value123), "Value123");
+}
+
+TEST(Rfk_enumToString, AliasValue)
+{
+	EXPECT_STREQ(rfk::enumToString(TestEnumClass::Value3Alias), "Value3");
+}
+
+TEST(Rfk_enumToString, NonExistantValue)
+{
+	EXPECT_EQ(rfk::enumToString(static_cast<TestEnumClass>(1 << 5)), nullptr);
+}
+
+//=========================================================
+//================= rfk::enumFromString ===================
+//=========================================================
+
+TEST(Rfk_enumFromString, ExistantValue)
+{
+	constexpr bool found = []()
+	{
+		TestEnumClass value = TestEnumClass::Value1;
+
+		return rfk::enumFromString("Value2", value) && value == TestEnumClass::Value2;
+	}();
+
+	EXPECT_TRUE(found);
+}
+
+TEST(Rfk_enumFromString, NonExistantValue)
+{
+	TestEnum value = TestEnumValue3;
+
+	EXPECT_FALSE(rfk::enumFromString("testEnumValue1", value));
+	EXPECT_EQ(value, TestEnumValue3);
+}
+
+TEST(Rfk_enumFromString, HasEnumStringTable)
+{
+	EXPECT_TRUE(rfk::hasEnumStringTable<TestEnum>);
+	EXPECT_FALSE(rfk::hasEnumStringTable<EManualEnumReflection>);
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "HotReloadModule.h"
+
+#include <cstddef>	//offsetof
+
+#include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Module/ModuleEntityRegisterer.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+	#define HOT_RELOAD_MODULE_API extern "C" __declspec(dllexport)
+#else
+	#define HOT_RELOAD_MODULE_API extern "C" __attribute__((visibility("default")))
+#endif
+
+RFK_DEFINE_MODULE_HANDLE(HotReloadModule)
+
+void HotReloadCounter::increment(int count)
+{
+#if HOT_RELOAD_MODULE_VERSION == 1
+	value += step * count;
+#else
+	value += step * count * 10;
+#endif
+}
+
+static int getHotReloadModuleVersion()
+{
+	return HOT_RELOAD_MODULE_VERSION;
+}
+
+static rfk::Struct const& getCounterArchetype() noexcept
+{
+	static rfk::Struct	archetype("HotReloadCounter", hot_reload_module::counterId, sizeof(HotReloadCounter), false);
+	static bool			initialized = false;
+
+	if (!initialized)
+	{
+		initialized = true;
+
+		archetype.addField("value", hot_reload_module::counterValueId, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(HotReloadCounter, value), &archetype);
+		archetype.addField("step", hot_reload_module::counterStepId, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(HotReloadCounter, step), &archetype);
+
+		rfk::Method* increment = archetype.addMethod("increment", hot_reload_module::counterIncrementId, rfk::getType<void>(),
+													 new rfk::MemberFunction<HotReloadCounter, void(int)>(&HotReloadCounter::increment), rfk::EMethodFlags::Public);
+		increment->addParameter("count", 0u, rfk::getType<int>());
+	}
+
+	return archetype;
+}
+
+static rfk::Function const& getVersionFunction() noexcept
+{
+	static rfk::Function function("getHotReloadModuleVersion", hot_reload_module::getVersionId, rfk::getType<int>(),
+								  new rfk::NonMemberFunction<int()>(&getHotReloadModuleVersion), rfk::EFunctionFlags::Static);
+
+	return function;
+}
+
+static rfk::ModuleEntityRegisterer const counterRegisterer(RFK_MODULE_HANDLE(HotReloadModule), getCounterArchetype());
+static rfk::ModuleEntityRegisterer const getVersionRegisterer(RFK_MODULE_HANDLE(HotReloadModule), getVersionFunction());
+
+HOT_RELOAD_MODULE_API rfk::ModuleHandle* getHotReloadModule()
+{
+	return &RFK_MODULE_HANDLE(HotReloadModule);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+/**
+*	Shared library built twice with different HOT_RELOAD_MODULE_VERSION values to test ModuleHandle::reload.
+*	Its entities are reflected manually with fixed ids so that both builds share the same ids.
+*/
+namespace hot_reload_module
+{
+	/** Name of the exported function returning the rfk::ModuleHandle* of the module. */
+	constexpr char const*	getModuleFunctionName	= "getHotReloadModule";
+
+	constexpr std::size_t	counterId				= 4000501u;
+	constexpr std::size_t	counterValueId			= 4000502u;
+	constexpr std::size_t	counterStepId			= 4000503u;
+	constexpr std::size_t	counterIncrementId		= 4000504u;
+	constexpr std::size_t	getVersionId			= 4000505u;
+}
+
+/** Struct with the same layout in both builds, only the body of its method changes. */
+struct HotReloadCounter
+{
+	int	value	= 0;
+	int	step	= 1;
+
+	/**
+	*	@brief Increment the value by step times the provided count in the first build, and by 10 times more in the second build.
+	*
+	*	@param count Number of steps to increment the value by.
+	*/
+	void increment(int count);
+};
\ No newline at end of file
@@ -0,0 +1,84 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>	//std::size_t
+#include <initializer_list>
+
+#include <Refureku/TypeInfo/Entity/Entity.h>
+#include <Refureku/TypeInfo/Module/ModuleHandle.h>
+
+/**
+*	@brief	Generate a unique id for an entity reflected manually by a test.
+*			Ids are generated above the ids hard-coded by the other tests so that they never collide.
+*
+*	@return A new entity id.
+*/
+inline std::size_t generateTestEntityId() noexcept
+{
+	static std::atomic<std::size_t> nextId{10000000u};
+
+	return nextId.fetch_add(1u, std::memory_order_relaxed);
+}
+
+/**
+*	Module registering the entities reflected manually by a test for the duration of the test.
+*	It must be declared after the entities it registers so that they are unregistered before being destroyed.
+*/
+class TestModule
+{
+	private:
+		/** Handle of the module. */
+		rfk::ModuleHandle	_handle;
+
+	public:
+		TestModule(char const* name) noexcept:
+			_handle{name}
+		{
+		}
+
+		/**
+		*	@brief Add file level entities to the module. They are registered to the database when the module is loaded.
+		*
+		*	@param entities File level entities to add.
+		*/
+		void add(std::initializer_list<rfk::Entity const*> entities) noexcept
+		{
+			_handle.addEntities(entities.begin(), entities.size());
+		}
+
+		/**
+		*	@brief Add file level entities to the module and register all the entities of the module to the database.
+		*
+		*	@param entities File level entities to add.
+		*/
+		void load(std::initializer_list<rfk::Entity const*> entities = {}) noexcept
+		{
+			add(entities);
+			_handle.load();
+		}
+
+		/**
+		*	@brief Unregister all the entities of the module from the database.
+		*/
+		void unload() noexcept
+		{
+			_handle.unload();
+		}
+
+		/**
+		*	@brief Getter for the field _handle.
+		*
+		*	@return _handle.
+		*/
+		rfk::ModuleHandle& getHandle() noexcept
+		{
+			return _handle;
+		}
+};
\ No newline at end of file
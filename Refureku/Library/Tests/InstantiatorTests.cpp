@@ -148,5 +148,41 @@ TEST(Rfk_Instantiators, UnalignedClassUniqueInstantiation)
 {
 	rfk::UniquePtr<VirtualClass2> ptr = rfk::getDatabase().getFileLevelClassByName("MultipleInheritanceInstantiator")->makeUniqueInstance<VirtualClass2>();
 
+	EXPECT_EQ(ptr->method22(), 3);
+}
+
+//=========================================================
+//================ Placement instantiation ================
+//=========================================================
+
+TEST(Rfk_Instantiators, DefaultPlacementInstantiator)
+{
+	rfk::Class const* c = rfk::getDatabase().getFileLevelClassByName("TestInstantiatorBase");
+
+	alignas(TestInstantiatorBase) unsigned char memory[sizeof(TestInstantiatorBase)];
+
+	EXPECT_EQ(c->getMemoryAlignment(), alignof(TestInstantiatorBase));
+
+	TestInstantiatorBase* instance = c->makeInstanceAt<TestInstantiatorBase>(memory);
+
+	ASSERT_NE(instance, nullptr);
+	EXPECT_EQ(static_cast<void*>(instance), static_cast<void*>(memory));
+	EXPECT_EQ(instance->value, 0);
+
+	c->destroyInstanceAt(memory);
+}
+
+TEST(Rfk_Instantiators, DefaultPlacementInstantiatorNoDefaultCtor)
+{
+	alignas(TestInstantiatorBase) unsigned char memory[sizeof(TestUniqueInstantiatorNotDefaultCtor)];
+
+	EXPECT_EQ(rfk::getDatabase().getFileLevelClassByName("TestUniqueInstantiatorNotDefaultCtor")->makeInstanceAt<TestInstantiatorBase>(memory), nullptr);
+}
+
+TEST(Rfk_Instantiators, UnalignedClassPooledInstantiation)
+{
+	rfk::PooledPtr<VirtualClass2> ptr = rfk::getStructPool(*rfk::getDatabase().getFileLevelClassByName("MultipleInheritanceInstantiator")).makeUniqueInstance<VirtualClass2>();
+
+	ASSERT_NE(ptr, nullptr);
 	EXPECT_EQ(ptr->method22(), 3);
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestClass.h"
+#include "TestFunctions.h"
+#include "TestModule.h"
+
+namespace instrumentation_tests
+{
+	/**
+	*	Manually reflected struct registered through a module which can be unloaded in the middle of a test.
+	*/
+	struct InstrumentedModule
+	{
+		rfk::Struct	s{"InstrumentedStruct", generateTestEntityId(), sizeof(int), true};
+
+		TestModule	module{"InstrumentedModule"};
+
+		InstrumentedModule()
+		{
+			s.addField("value", generateTestEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+
+			module.load({ &s });
+		}
+	};
+
+	rfk::InstrumentationRecord const* findRecord(rfk::Vector<rfk::InstrumentationRecord> const& records, rfk::Entity const* entity)
+	{
+		for (rfk::InstrumentationRecord const& record : records)
+		{
+			if (record.entity == entity)
+			{
+				return &record;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+//=========================================================
+//=========== InstrumentationRecord::getCounter ===========
+//=========================================================
+
+TEST(Rfk_InstrumentationRecord_getCounter, MatchesNamedCounters)
+{
+	rfk::InstrumentationRecord record;
+
+	record.getCounter(rfk::EInstrumentationEvent::NameLookup)	= 1u;
+	record.getCounter(rfk::EInstrumentationEvent::IdLookup)		= 2u;
+	record.getCounter(rfk::EInstrumentationEvent::Cast)			= 3u;
+	record.getCounter(rfk::EInstrumentationEvent::Invocation)	= 4u;
+	record.getCounter(rfk::EInstrumentationEvent::FailedLookup)	= 5u;
+
+	EXPECT_EQ(record.nameLookups, 1u);
+	EXPECT_EQ(record.idLookups, 2u);
+	EXPECT_EQ(record.casts, 3u);
+	EXPECT_EQ(record.invocations, 4u);
+	EXPECT_EQ(record.failedLookups, 5u);
+	EXPECT_EQ(record.getTotal(), 15u);
+}
+
+//=========================================================
+//============= Database::getHottestLookups ===============
+//=========================================================
+
+TEST(Rfk_Database_getHottestLookups, CountsLookupsAndInvocations)
+{
+	rfk::Database const&	database	= rfk::getDatabase();
+	rfk::Class const&		testClass	= TestClass::staticGetArchetype();
+
+	database.resetInstrumentationCounters();
+
+	for (int i = 0; i < 3; i++)
+	{
+		EXPECT_NE(testClass.getFieldByName("_intField"), nullptr);
+	}
+	EXPECT_EQ(testClass.getFieldByName("missing"), nullptr);
+	EXPECT_EQ(database.getEntityById(testClass.getId()), &testClass);
+	EXPECT_EQ(database.getFileLevelFunctionByName("func_return_singleParam")->invoke<int>(21), 21);
+
+	rfk::Vector<rfk::InstrumentationRecord> records = database.getHottestLookups(0u);
+
+#if RFK_INSTRUMENTATION
+	rfk::InstrumentationRecord const* fieldRecord		= instrumentation_tests::findRecord(records, testClass.getFieldByName("_intField"));
+	rfk::InstrumentationRecord const* structRecord		= instrumentation_tests::findRecord(records, &testClass);
+	rfk::InstrumentationRecord const* functionRecord	= instrumentation_tests::findRecord(records, database.getFileLevelFunctionByName("func_return_singleParam"));
+
+	ASSERT_NE(fieldRecord, nullptr);
+	ASSERT_NE(structRecord, nullptr);
+	ASSERT_NE(functionRecord, nullptr);
+
+	EXPECT_EQ(fieldRecord->nameLookups, 3u);
+	EXPECT_EQ(structRecord->failedLookups, 1u);
+	EXPECT_EQ(structRecord->idLookups, 1u);
+	EXPECT_EQ(functionRecord->nameLookups, 1u);
+	EXPECT_EQ(functionRecord->invocations, 1u);
+
+	//Records are sorted by decreasing total
+	for (std::size_t i = 1u; i < records.size(); i++)
+	{
+		EXPECT_GE(records[i - 1u].getTotal(), records[i].getTotal());
+	}
+
+	EXPECT_EQ(records[0].entity, fieldRecord->entity);
+#else
+	EXPECT_TRUE(records.empty());
+#endif
+}
+
+TEST(Rfk_Database_getHottestLookups, LimitsRecordsCount)
+{
+	rfk::Database const&	database	= rfk::getDatabase();
+	std::size_t				functionId	= database.getFileLevelFunctionByName("func_return_singleParam")->getId();
+
+	database.resetInstrumentationCounters();
+
+	(void)TestClass::staticGetArchetype().getFieldByName("_intField");
+	(void)database.getEntityById(functionId);
+	(void)database.getFileLevelStructByName("missing");
+
+#if RFK_INSTRUMENTATION
+	EXPECT_EQ(database.getHottestLookups(0u).size(), 3u);
+	EXPECT_EQ(database.getHottestLookups(2u).size(), 2u);
+#else
+	EXPECT_TRUE(database.getHottestLookups(2u).empty());
+#endif
+}
+
+TEST(Rfk_Database_getHottestLookups, AggregatesThreads)
+{
+	rfk::Database const&	database	= rfk::getDatabase();
+	rfk::Class const&		testClass	= TestClass::staticGetArchetype();
+
+	database.resetInstrumentationCounters();
+
+	std::thread thread([&testClass]()
+					   {
+						   for (int i = 0; i < 10; i++)
+						   {
+							   (void)testClass.getFieldByName("_intField");
+						   }
+					   });
+	thread.join();
+
+	(void)testClass.getFieldByName("_intField");
+
+#if RFK_INSTRUMENTATION
+	rfk::Vector<rfk::InstrumentationRecord> records = database.getHottestLookups(1u);
+
+	ASSERT_EQ(records.size(), 1u);
+	EXPECT_EQ(records[0].entity, testClass.getFieldByName("_intField"));
+	EXPECT_EQ(records[0].nameLookups, 11u);
+#else
+	EXPECT_TRUE(database.getHottestLookups(0u).empty());
+#endif
+}
+
+TEST(Rfk_Database_getHottestLookups, ForgetsUnloadedEntities)
+{
+	rfk::Database const& database = rfk::getDatabase();
+
+	std::size_t recordsCount = database.getHottestLookups(0u).size();
+
+	{
+		instrumentation_tests::InstrumentedModule m;
+
+		(void)m.s.getFieldByName("value");
+		(void)database.getEntityById(m.s.getId());
+
+#if RFK_INSTRUMENTATION
+		EXPECT_EQ(database.getHottestLookups(0u).size(), recordsCount + 2u);
+#endif
+	}
+
+	//The counters of the unloaded entities must be removed without resetting the counters
+	EXPECT_EQ(database.getHottestLookups(0u).size(), recordsCount);
+}
+
+//=========================================================
+//========= Database::resetInstrumentationCounters ========
+//=========================================================
+
+TEST(Rfk_Database_resetInstrumentationCounters, ClearsCounters)
+{
+	rfk::Database const& database = rfk::getDatabase();
+
+	(void)TestClass::staticGetArchetype().getFieldByName("_intField");
+
+	database.resetInstrumentationCounters();
+
+	EXPECT_TRUE(database.getHottestLookups(0u).empty());
+}
\ No newline at end of file
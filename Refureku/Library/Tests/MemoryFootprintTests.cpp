@@ -0,0 +1,167 @@
+#include <string>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
+
+#include "TestModule.h"
+
+namespace memory_footprint_tests
+{
+	static int footprintVariableValue = 0;
+
+	/**
+	*	Manually reflected entities added to a module but not loaded, so that the module footprint counts are known.
+	*/
+	struct FootprintModule
+	{
+		rfk::Struct				s{"FootprintStruct", generateTestEntityId(), sizeof(int) * 2u, true};
+		rfk::Enum				e{"FootprintEnum", generateTestEntityId(), rfk::getArchetype<int>()};
+		rfk::NamespaceFragment	fragment{"footprint_namespace", generateTestEntityId()};
+		rfk::Variable			variable{"footprintVariable", generateTestEntityId(), rfk::getType<int>(), &footprintVariableValue, rfk::EVarFlags::Default};
+		rfk::Function			function{"footprintFunction", generateTestEntityId(), rfk::getType<void>(), nullptr, rfk::EFunctionFlags::Default};
+
+		TestModule				module{"FootprintModule"};
+
+		FootprintModule()
+		{
+			s.addField("value", generateTestEntityId(), rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+			s.addField("ratio", generateTestEntityId(), rfk::getType<float>(), rfk::EFieldFlags::Public, sizeof(int), &s);
+
+			rfk::Method* method = s.addMethod("compute", generateTestEntityId(), rfk::getType<int>(), nullptr, rfk::EMethodFlags::Public);
+			method->addParameter("factor", generateTestEntityId(), rfk::getType<int>());
+			method->addParameter("input", generateTestEntityId(), rfk::getType<float const*>());
+
+			e.addEnumValue("First", generateTestEntityId(), 1);
+			e.addEnumValue("Second", generateTestEntityId(), 2);
+			e.addEnumValue("Third", generateTestEntityId(), 3);
+
+			function.addParameter("count", generateTestEntityId(), rfk::getType<int>());
+
+			rfk::Entity const* const nestedEntities[] = { &variable, &function };
+			fragment.addNestedEntities(nestedEntities, std::size(nestedEntities));
+
+			module.add({ &s, &e, &fragment });
+		}
+	};
+
+	std::size_t sumEntriesBytes(rfk::MemoryFootprint const& footprint)
+	{
+		return footprint.namespaces.bytes + footprint.namespaceFragments.bytes + footprint.structs.bytes + footprint.enums.bytes +
+			footprint.enumValues.bytes + footprint.fundamentalArchetypes.bytes + footprint.variables.bytes + footprint.fields.bytes +
+			footprint.functions.bytes + footprint.methods.bytes + footprint.parameters.bytes + footprint.names.bytes +
+			footprint.properties.bytes + footprint.types.bytes + footprint.structContainers.bytes + footprint.enumContainers.bytes +
+			footprint.namespaceContainers.bytes + footprint.registrationTables.bytes + footprint.hashBuckets.bytes;
+	}
+}
+
+//=========================================================
+//========== ModuleHandle::computeMemoryFootprint =========
+//=========================================================
+
+TEST(Rfk_ModuleHandle_computeMemoryFootprint, CountsModuleEntities)
+{
+	memory_footprint_tests::FootprintModule m;
+
+	rfk::MemoryFootprint footprint = m.module.getHandle().computeMemoryFootprint();
+
+	EXPECT_EQ(footprint.structs.count, 1u);
+	EXPECT_EQ(footprint.fields.count, 2u);
+	EXPECT_EQ(footprint.methods.count, 1u);
+	EXPECT_EQ(footprint.enums.count, 1u);
+	EXPECT_EQ(footprint.enumValues.count, 3u);
+	EXPECT_EQ(footprint.namespaceFragments.count, 1u);
+	EXPECT_EQ(footprint.variables.count, 1u);
+	EXPECT_EQ(footprint.functions.count, 1u);
+	EXPECT_EQ(footprint.parameters.count, 3u);
+	EXPECT_EQ(footprint.namespaces.count, 0u);
+
+	//Every entity and parameter has a name
+	EXPECT_EQ(footprint.names.count, 14u);
+
+	//int, float, void and float const*
+	EXPECT_EQ(footprint.types.count, 4u);
+	EXPECT_EQ(footprint.registrationTables.count, 3u);
+
+	EXPECT_GE(footprint.structs.bytes, sizeof(rfk::Struct));
+	EXPECT_GE(footprint.fields.bytes, 2u * sizeof(rfk::Field));
+	EXPECT_GE(footprint.parameters.bytes, 3u * sizeof(rfk::FunctionParameter));
+	EXPECT_GT(footprint.structContainers.bytes, 0u);
+	EXPECT_GT(footprint.enumContainers.bytes, 0u);
+	EXPECT_GT(footprint.hashBuckets.count, 0u);
+	EXPECT_EQ(footprint.hashBuckets.bytes, footprint.hashBuckets.count * sizeof(void*));
+	EXPECT_EQ(footprint.getTotalBytes(), memory_footprint_tests::sumEntriesBytes(footprint));
+}
+
+TEST(Rfk_ModuleHandle_computeMemoryFootprint, LongNamesAllocate)
+{
+	std::string const	longName(200u, 'a');
+	rfk::Struct			shortNamed("s", generateTestEntityId(), 1u, false);
+	rfk::Struct			longNamed(longName.c_str(), generateTestEntityId(), 1u, false);
+	TestModule			shortModule("ShortNamesModule");
+	TestModule			longModule("LongNamesModule");
+
+	shortModule.add({ &shortNamed });
+	longModule.add({ &longNamed });
+
+	EXPECT_EQ(shortModule.getHandle().computeMemoryFootprint().names.bytes, 0u);
+	EXPECT_GT(longModule.getHandle().computeMemoryFootprint().names.bytes, longName.size());
+}
+
+//=========================================================
+//============ Database::computeMemoryFootprint ===========
+//=========================================================
+
+TEST(Rfk_Database_computeMemoryFootprint, AccountsLoadedModules)
+{
+	rfk::MemoryFootprint before = rfk::getDatabase().computeMemoryFootprint();
+
+	{
+		memory_footprint_tests::FootprintModule m;
+
+		m.module.load();
+
+		rfk::MemoryFootprint loaded = rfk::getDatabase().computeMemoryFootprint();
+
+		EXPECT_EQ(loaded.structs.count, before.structs.count + 1u);
+		EXPECT_EQ(loaded.fields.count, before.fields.count + 2u);
+		EXPECT_EQ(loaded.methods.count, before.methods.count + 1u);
+		EXPECT_EQ(loaded.enumValues.count, before.enumValues.count + 3u);
+		EXPECT_EQ(loaded.parameters.count, before.parameters.count + 3u);
+		EXPECT_EQ(loaded.namespaces.count, before.namespaces.count + 1u);
+		EXPECT_GT(loaded.registrationTables.count, before.registrationTables.count);
+
+		//Fragments are owned by modules and never registered to the database
+		EXPECT_EQ(loaded.namespaceFragments.count, 0u);
+
+		m.module.unload();
+	}
+
+	rfk::MemoryFootprint after = rfk::getDatabase().computeMemoryFootprint();
+
+	EXPECT_EQ(after.structs.count, before.structs.count);
+	EXPECT_EQ(after.fields.count, before.fields.count);
+	EXPECT_EQ(after.namespaces.count, before.namespaces.count);
+	EXPECT_EQ(after.getTotalBytes(), memory_footprint_tests::sumEntriesBytes(after));
+}
+
+//=========================================================
+//============== MemoryFootprint::operator+= ==============
+//=========================================================
+
+TEST(Rfk_MemoryFootprint_operatorPlusEqual, AddsAllEntries)
+{
+	memory_footprint_tests::FootprintModule m;
+
+	rfk::MemoryFootprint footprint = m.module.getHandle().computeMemoryFootprint();
+	rfk::MemoryFootprint sum;
+
+	EXPECT_EQ(sum.getTotalBytes(), 0u);
+
+	sum += footprint;
+	sum += footprint;
+
+	EXPECT_EQ(sum.getTotalBytes(), 2u * footprint.getTotalBytes());
+	EXPECT_EQ(sum.enumValues.count, 2u * footprint.enumValues.count);
+	EXPECT_EQ(sum.hashBuckets.bytes, 2u * footprint.hashBuckets.bytes);
+}
\ No newline at end of file
@@ -0,0 +1,438 @@
+#include <atomic>
+#include <memory>	//std::unique_ptr
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>	//std::runtime_error
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+namespace method_command_buffer_tests
+{
+	struct Tracked
+	{
+		static inline int	liveInstancesCount = 0;
+
+		int value;
+
+		Tracked(int v) noexcept:
+			value{v}
+		{
+			liveInstancesCount++;
+		}
+
+		Tracked(Tracked const& other) noexcept:
+			value{other.value}
+		{
+			liveInstancesCount++;
+		}
+
+		~Tracked() noexcept
+		{
+			liveInstancesCount--;
+		}
+	};
+
+	struct Recorder : public rfk::Object
+	{
+		static inline rfk::Struct const* archetype = nullptr;
+
+		std::vector<std::string>	log;
+		int							sum = 0;
+
+		void add(int value)
+		{
+			sum += value;
+			log.push_back("add" + std::to_string(value));
+		}
+
+		void rename(std::string const& name)
+		{
+			log.push_back("rename" + name);
+		}
+
+		int addAndGet(int value)
+		{
+			sum += value;
+
+			return sum;
+		}
+
+		void addTracked(Tracked tracked)
+		{
+			if (tracked.value < 0)
+			{
+				throw std::runtime_error("Negative value");
+			}
+
+			add(tracked.value);
+		}
+
+		static rfk::Struct const& staticGetArchetype() noexcept
+		{
+			return *archetype;
+		}
+
+		rfk::Struct const& getArchetype() const noexcept override
+		{
+			return *archetype;
+		}
+	};
+
+	static int staticSum = 0;
+
+	void addToStaticSum(int value)
+	{
+		staticSum += value;
+	}
+
+	struct RecordedFunctions
+	{
+		rfk::Struct			recorder{"CommandRecorder", 5900001u, sizeof(Recorder), true};
+		rfk::Method*		add;
+		rfk::Method*		rename;
+		rfk::Method*		addAndGet;
+		rfk::Method*		addTracked;
+		rfk::StaticMethod*	staticAdd;
+		rfk::Function		functionAdd{"addToStaticSum", 5900010u, rfk::getType<void>(),
+										new rfk::NonMemberFunction<void(int)>(&addToStaticSum), rfk::EFunctionFlags::Default};
+
+		RecordedFunctions()
+		{
+			Recorder::archetype	= &recorder;
+			staticSum			= 0;
+
+			add = recorder.addMethod("add", 5900002u, rfk::getType<void>(), new rfk::MemberFunction<Recorder, void(int)>(&Recorder::add), rfk::EMethodFlags::Public);
+			add->addParameter("value", 0u, rfk::getType<int>());
+
+			rename = recorder.addMethod("rename", 5900003u, rfk::getType<void>(), new rfk::MemberFunction<Recorder, void(std::string const&)>(&Recorder::rename), rfk::EMethodFlags::Public);
+			rename->addParameter("name", 0u, rfk::getType<std::string const&>());
+
+			addAndGet = recorder.addMethod("addAndGet", 5900004u, rfk::getType<int>(), new rfk::MemberFunction<Recorder, int(int)>(&Recorder::addAndGet), rfk::EMethodFlags::Public);
+			addAndGet->addParameter("value", 0u, rfk::getType<int>());
+
+			addTracked = recorder.addMethod("addTracked", 5900005u, rfk::getType<void>(), new rfk::MemberFunction<Recorder, void(Tracked)>(&Recorder::addTracked), rfk::EMethodFlags::Public);
+			addTracked->addParameter("tracked", 0u, rfk::getType<Tracked>());
+
+			staticAdd = recorder.addStaticMethod("staticAdd", 5900006u, rfk::getType<void>(), new rfk::NonMemberFunction<void(int)>(&addToStaticSum), rfk::EMethodFlags::Public | rfk::EMethodFlags::Static);
+			staticAdd->addParameter("value", 0u, rfk::getType<int>());
+
+			functionAdd.addParameter("value", 0u, rfk::getType<int>());
+		}
+	};
+}
+
+//=========================================================
+//============ MethodCommandBuffer::recordUnsafe ==========
+//=========================================================
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, ExecutesInRecordingOrder)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+
+	for (int i = 0; i < 5; i++)
+	{
+		EXPECT_TRUE(buffer.recordUnsafe(*functions.add, &recorder, int{i}));
+	}
+
+	EXPECT_TRUE(recorder.log.empty());
+	EXPECT_EQ(buffer.getCommandsCount(), 5u);
+
+	EXPECT_EQ(buffer.execute(), 5u);
+	EXPECT_EQ(recorder.log, (std::vector<std::string>{"add0", "add1", "add2", "add3", "add4"}));
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+
+	//Executed commands are removed
+	EXPECT_EQ(buffer.execute(), 0u);
+	EXPECT_EQ(recorder.sum, 10);
+}
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, InterleavedMethods)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+
+	buffer.recordUnsafe(*functions.add, &recorder, 1);
+	buffer.recordUnsafe(*functions.add, &recorder, 2);
+	buffer.recordUnsafe<void, std::string const&>(*functions.rename, &recorder, "a");
+	buffer.recordUnsafe(*functions.add, &recorder, 3);
+
+	EXPECT_EQ(buffer.execute(), 4u);
+	EXPECT_EQ(recorder.log, (std::vector<std::string>{"add1", "add2", "renamea", "add3"}));
+}
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, MismatchingSignature)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+	int												value = 1;
+
+	EXPECT_FALSE(buffer.recordUnsafe(*functions.add, &recorder, 1.0f));
+	EXPECT_FALSE(buffer.recordUnsafe(*functions.add, &recorder, value));	//Deduced as int&
+	EXPECT_FALSE(buffer.recordUnsafe<int>(*functions.add, &recorder, 1));
+	EXPECT_FALSE(buffer.recordUnsafe(*functions.add, &recorder));
+
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+
+	EXPECT_TRUE(buffer.recordUnsafe(*functions.add, &recorder, int{value}));
+	EXPECT_EQ(buffer.execute(), 1u);
+}
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, StoresArgumentsByValue)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+	std::string										name = "first";
+
+	EXPECT_TRUE((buffer.recordUnsafe<void, std::string const&>(*functions.rename, &recorder, name)));
+	name = "second";
+
+	buffer.execute();
+
+	EXPECT_EQ(recorder.log, (std::vector<std::string>{"renamefirst"}));
+}
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, DiscardsReturnedValue)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+
+	EXPECT_TRUE(buffer.recordUnsafe<int>(*functions.addAndGet, &recorder, 4));
+	EXPECT_TRUE(buffer.recordUnsafe<int>(*functions.addAndGet, &recorder, 5));
+
+	EXPECT_EQ(buffer.execute(), 2u);
+	EXPECT_EQ(recorder.sum, 9);
+}
+
+TEST(Rfk_MethodCommandBuffer_recordUnsafe, SpansMultipleBlocks)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer(128u);
+
+	for (int round = 0; round < 2; round++)
+	{
+		for (int i = 0; i < 500; i++)
+		{
+			ASSERT_TRUE(buffer.recordUnsafe(*functions.add, &recorder, int{i}));
+			ASSERT_TRUE((buffer.recordUnsafe<void, std::string const&>(*functions.rename, &recorder, std::to_string(i))));
+		}
+
+		EXPECT_EQ(buffer.execute(), 1000u);
+	}
+
+	ASSERT_EQ(recorder.log.size(), 2000u);
+	EXPECT_EQ(recorder.log[998], "add499");
+	EXPECT_EQ(recorder.log[999], "rename499");
+	EXPECT_EQ(recorder.sum, 2 * 499 * 500 / 2);
+}
+
+//=========================================================
+//=============== MethodCommandBuffer::record =============
+//=========================================================
+
+TEST(Rfk_MethodCommandBuffer_record, AdjustableCaller)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+
+	EXPECT_TRUE(buffer.record(*functions.add, recorder, 7));
+	EXPECT_EQ(buffer.execute(), 1u);
+	EXPECT_EQ(recorder.sum, 7);
+}
+
+TEST(Rfk_MethodCommandBuffer_record, StaticMethodAndFunction)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	rfk::MethodCommandBuffer						buffer;
+
+	EXPECT_TRUE(buffer.record(*functions.staticAdd, 1));
+	EXPECT_TRUE(buffer.record(functions.functionAdd, 10));
+	EXPECT_FALSE(buffer.record(functions.functionAdd, 'c'));
+
+	EXPECT_EQ(method_command_buffer_tests::staticSum, 0);
+	EXPECT_EQ(buffer.execute(), 2u);
+	EXPECT_EQ(method_command_buffer_tests::staticSum, 11);
+}
+
+//=========================================================
+//=========== MethodCommandBuffer::execute / clear ========
+//=========================================================
+
+TEST(Rfk_MethodCommandBuffer_clear, DestroysArgumentsWithoutCalling)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+
+	{
+		rfk::MethodCommandBuffer buffer;
+
+		for (int i = 0; i < 3; i++)
+		{
+			buffer.recordUnsafe(*functions.addTracked, &recorder, method_command_buffer_tests::Tracked(i));
+		}
+
+		EXPECT_EQ(method_command_buffer_tests::Tracked::liveInstancesCount, 3);
+
+		buffer.clear();
+
+		EXPECT_EQ(method_command_buffer_tests::Tracked::liveInstancesCount, 0);
+		EXPECT_EQ(buffer.getCommandsCount(), 0u);
+		EXPECT_EQ(buffer.execute(), 0u);
+		EXPECT_TRUE(recorder.log.empty());
+
+		//Commands still recorded when the buffer is destroyed are destroyed too
+		buffer.recordUnsafe(*functions.addTracked, &recorder, method_command_buffer_tests::Tracked(1));
+	}
+
+	EXPECT_EQ(method_command_buffer_tests::Tracked::liveInstancesCount, 0);
+	EXPECT_TRUE(recorder.log.empty());
+}
+
+TEST(Rfk_MethodCommandBuffer_execute, ThrowingCall)
+{
+	method_command_buffer_tests::RecordedFunctions	functions;
+	method_command_buffer_tests::Recorder			recorder;
+	rfk::MethodCommandBuffer						buffer;
+
+	buffer.recordUnsafe(*functions.addTracked, &recorder, method_command_buffer_tests::Tracked(1));
+	buffer.recordUnsafe(*functions.addTracked, &recorder, method_command_buffer_tests::Tracked(-1));
+	buffer.recordUnsafe(*functions.addTracked, &recorder, method_command_buffer_tests::Tracked(2));
+	buffer.recordUnsafe(*functions.add, &recorder, 3);
+
+	EXPECT_THROW(buffer.execute(), std::runtime_error);
+
+	//The commands following the throwing one are discarded
+	EXPECT_EQ(recorder.log, (std::vector<std::string>{"add1"}));
+	EXPECT_EQ(method_command_buffer_tests::Tracked::liveInstancesCount, 0);
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+
+	//The buffer is still usable
+	buffer.recordUnsafe(*functions.add, &recorder, 4);
+	EXPECT_EQ(buffer.execute(), 1u);
+	EXPECT_EQ(recorder.sum, 5);
+}
+
+TEST(Rfk_MethodCommandBuffer_execute, MultipleProducers)
+{
+	constexpr int producersCount		= 8;
+	constexpr int commandsPerProducer	= 20000;
+
+	method_command_buffer_tests::RecordedFunctions	functions;
+	std::vector<method_command_buffer_tests::Recorder>	recorders(producersCount);
+	rfk::MethodCommandBuffer						buffer(1024u);
+	std::atomic<int>								runningProducersCount{producersCount};
+	std::vector<std::thread>						producers;
+
+	for (int p = 0; p < producersCount; p++)
+	{
+		producers.emplace_back([&functions, &recorders, &buffer, &runningProducersCount, p]()
+							   {
+								   for (int i = 0; i < commandsPerProducer; i++)
+								   {
+									   ASSERT_TRUE(buffer.recordUnsafe(*functions.add, &recorders[p], int{i}));
+								   }
+
+								   runningProducersCount--;
+							   });
+	}
+
+	//Execute on the owning thread while the producers are recording
+	std::size_t executedCommandsCount = 0u;
+
+	while (runningProducersCount != 0)
+	{
+		executedCommandsCount += buffer.execute();
+	}
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	executedCommandsCount += buffer.execute();
+
+	EXPECT_EQ(executedCommandsCount, static_cast<std::size_t>(producersCount * commandsPerProducer));
+
+	//The calls of each producer are executed in their recording order
+	for (method_command_buffer_tests::Recorder const& recorder : recorders)
+	{
+		ASSERT_EQ(recorder.log.size(), static_cast<std::size_t>(commandsPerProducer));
+
+		for (int i = 0; i < commandsPerProducer; i++)
+		{
+			ASSERT_EQ(recorder.log[i], "add" + std::to_string(i));
+		}
+	}
+}
+
+TEST(Rfk_MethodCommandBuffer_execute, MoreBuffersThanCachedStreams)
+{
+	constexpr int buffersCount		= 20;
+	constexpr int commandsPerBuffer	= 50;
+
+	method_command_buffer_tests::RecordedFunctions		functions;
+	std::vector<method_command_buffer_tests::Recorder>	recorders(buffersCount);
+	std::vector<std::unique_ptr<rfk::MethodCommandBuffer>>	buffers;
+
+	for (int b = 0; b < buffersCount; b++)
+	{
+		buffers.push_back(std::make_unique<rfk::MethodCommandBuffer>(128u));
+	}
+
+	//Alternate between the buffers so that their streams are evicted from the thread cache and found again
+	for (int i = 0; i < commandsPerBuffer; i++)
+	{
+		for (int b = 0; b < buffersCount; b++)
+		{
+			ASSERT_TRUE(buffers[b]->recordUnsafe(*functions.add, &recorders[b], int{i}));
+		}
+	}
+
+	//Buffers recorded from other threads are destroyed while these threads keep recording in new buffers
+	std::thread producer([&functions, &buffers, &recorders]()
+						 {
+							 for (int b = 0; b < buffersCount; b++)
+							 {
+								 ASSERT_TRUE(buffers[b]->recordUnsafe(*functions.add, &recorders[b], int{commandsPerBuffer}));
+							 }
+
+							 for (int b = 0; b < buffersCount; b++)
+							 {
+								 rfk::MethodCommandBuffer buffer;
+
+								 ASSERT_TRUE(buffer.recordUnsafe(*functions.add, &recorders[b], 0));
+							 }
+						 });
+	producer.join();
+
+	for (int b = 0; b < buffersCount; b++)
+	{
+		EXPECT_EQ(buffers[b]->getCommandsCount(), static_cast<std::size_t>(commandsPerBuffer + 1));
+		EXPECT_EQ(buffers[b]->execute(), static_cast<std::size_t>(commandsPerBuffer + 1));
+
+		ASSERT_EQ(recorders[b].log.size(), static_cast<std::size_t>(commandsPerBuffer + 1));
+
+		for (int i = 0; i <= commandsPerBuffer; i++)
+		{
+			ASSERT_EQ(recorders[b].log[i], "add" + std::to_string(i));
+		}
+	}
+
+	buffers.clear();
+
+	//A new buffer used by the threads of the destroyed ones gets its own streams
+	rfk::MethodCommandBuffer buffer;
+
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+	EXPECT_TRUE(buffer.recordUnsafe(*functions.add, &recorders[0], 1));
+	EXPECT_EQ(buffer.execute(), 1u);
+}
\ No newline at end of file
@@ -0,0 +1,559 @@
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
+#include <Refureku/TypeInfo/Module/ModuleEntityRegisterer.h>
+
+#include "TestModule.h"
+
+#if defined(HOT_RELOAD_MODULE_V1_PATH) && defined(HOT_RELOAD_MODULE_V2_PATH)
+	#if defined(_WIN32) || defined(_WIN64)
+		#define WIN32_LEAN_AND_MEAN
+		#define NOMINMAX
+		#include <Windows.h>
+	#else
+		#include <dlfcn.h>
+	#endif
+
+	#include "HotReload/HotReloadModule.h"
+#endif
+
+RFK_DEFINE_MODULE_HANDLE(TestsModule)
+
+//=========================================================
+//================ ModuleHandle::load =====================
+//=========================================================
+
+TEST(Rfk_ModuleHandle_load, RegistersOnlyOnLoad)
+{
+	rfk::ModuleHandle& module = RFK_MODULE_HANDLE(TestsModule);
+
+	rfk::Struct s("ModuleStruct", 4000001u, sizeof(int), false);
+	s.addField("field", 4000002u, rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+
+	rfk::Enum e("ModuleEnum", 4000003u, rfk::getArchetype<int>());
+	e.addEnumValue("Value", 4000004u, 1);
+
+	rfk::Struct nestedStruct("ModuleNestedStruct", 4000005u, sizeof(int), false);
+	rfk::NamespaceFragment fragment("module_namespace", 4000006u);
+	rfk::Entity const* const nestedEntities[] = { &nestedStruct };
+	fragment.addNestedEntities(nestedEntities, 1u);
+
+	{
+		rfk::ModuleEntityRegisterer structRegisterer(module, s);
+		rfk::ModuleEntityRegisterer enumRegisterer(module, e);
+		rfk::ModuleEntityRegisterer fragmentRegisterer(module, fragment);
+
+		EXPECT_EQ(module.getEntitiesCount(), 3u);
+		EXPECT_FALSE(module.isLoaded());
+		EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("ModuleStruct"), nullptr);
+
+		module.load();
+
+		EXPECT_TRUE(module.isLoaded());
+		EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("ModuleStruct"), &s);
+		EXPECT_EQ(rfk::getDatabase().getFileLevelEnumByName("ModuleEnum"), &e);
+		EXPECT_EQ(rfk::getDatabase().getEntityById(4000002u), s.getFieldByName("field"));
+		EXPECT_NE(rfk::getDatabase().getEnumValueById(4000004u), nullptr);
+		EXPECT_EQ(rfk::getDatabase().getStructById(4000005u), &nestedStruct);
+		EXPECT_NE(rfk::getDatabase().getNamespaceByName("module_namespace"), nullptr);
+
+		module.unload();
+	}
+
+	EXPECT_EQ(module.getEntitiesCount(), 0u);
+}
+
+TEST(Rfk_ModuleHandle_load, AddToLoadedModule)
+{
+	rfk::ModuleHandle module("LoadedModule");
+	rfk::Struct s("LoadedModuleStruct", 4000101u, sizeof(int), false);
+
+	module.load();
+
+	{
+		rfk::ModuleEntityRegisterer registerer(module, s);
+
+		EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("LoadedModuleStruct"), &s);
+	}
+
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("LoadedModuleStruct"), nullptr);
+}
+
+//=========================================================
+//================ ModuleHandle::unload ===================
+//=========================================================
+
+TEST(Rfk_ModuleHandle_unload, UnregistersAllEntities)
+{
+	rfk::ModuleHandle module("UnloadedModule");
+
+	rfk::Struct s("UnloadedModuleStruct", 4000201u, sizeof(int), false);
+	s.addField("field", 4000202u, rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+
+	rfk::Struct nestedStruct("UnloadedModuleNestedStruct", 4000203u, sizeof(int), false);
+	rfk::NamespaceFragment fragment("unloaded_module_namespace", 4000204u);
+	rfk::Entity const* const nestedEntities[] = { &nestedStruct };
+	fragment.addNestedEntities(nestedEntities, 1u);
+
+	rfk::Entity const* const entities[] = { &s, &fragment };
+	module.addEntities(entities, 2u);
+	module.load();
+	module.unload();
+
+	EXPECT_FALSE(module.isLoaded());
+	EXPECT_EQ(module.getEntitiesCount(), 2u);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("UnloadedModuleStruct"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityById(4000202u), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getStructById(4000203u), nullptr);
+	EXPECT_EQ(fragment.getMergedNamespace().getArchetypesCount(), 0u);
+
+	module.removeEntities(entities, 2u);
+
+	EXPECT_EQ(module.getEntitiesCount(), 0u);
+}
+
+TEST(Rfk_ModuleHandle_unload, NotLoadedModule)
+{
+	rfk::ModuleHandle module("NotLoadedModule");
+	rfk::Struct s("NotLoadedModuleStruct", 4000301u, sizeof(int), false);
+	rfk::Entity const* const entities[] = { &s };
+
+	module.addEntities(entities, 1u);
+	module.unload();
+
+	EXPECT_FALSE(module.isLoaded());
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("NotLoadedModuleStruct"), nullptr);
+
+	module.removeEntities(entities, 1u);
+}
+
+//=========================================================
+//============= ModuleHandle::removeEntities ==============
+//=========================================================
+
+TEST(Rfk_ModuleHandle_removeEntities, OutOfOrderRemoval)
+{
+	rfk::ModuleHandle module("OutOfOrderRemovalModule");
+
+	rfk::Struct unloaded1("OutOfOrderUnloaded1", generateTestEntityId(), sizeof(int), false);
+	rfk::Struct unloaded2("OutOfOrderUnloaded2", generateTestEntityId(), sizeof(int), false);
+	rfk::Struct unloaded3("OutOfOrderUnloaded3", generateTestEntityId(), sizeof(int), false);
+	rfk::Struct loaded1("OutOfOrderLoaded1", generateTestEntityId(), sizeof(int), false);
+	rfk::Struct loaded2("OutOfOrderLoaded2", generateTestEntityId(), sizeof(int), false);
+
+	rfk::Entity const* const unloadedEntities[] = { &unloaded1, &unloaded2, &unloaded3 };
+	module.addEntities(unloadedEntities, 3u);
+	module.load();
+	module.unload();
+
+	rfk::Entity const* const loadedEntities[] = { &loaded1, &loaded2 };
+	module.addEntities(loadedEntities, 2u);
+	module.load();
+
+	//Remove the first unloaded and the first loaded entities, which are not at the end of their range
+	rfk::Entity const* const removedEntities[] = { &unloaded1, &loaded1 };
+	module.removeEntities(removedEntities, 2u);
+
+	EXPECT_EQ(module.getEntitiesCount(), 3u);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("OutOfOrderLoaded1"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("OutOfOrderLoaded2"), &loaded2);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("OutOfOrderUnloaded2"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("OutOfOrderUnloaded3"), nullptr);
+
+	//The remaining loaded entity is still unregistered by unload
+	module.unload();
+
+	EXPECT_EQ(rfk::getDatabase().getFileLevelStructByName("OutOfOrderLoaded2"), nullptr);
+
+	rfk::Entity const* const remainingEntities[] = { &unloaded3, &loaded2, &unloaded2 };
+	module.removeEntities(remainingEntities, 3u);
+
+	EXPECT_EQ(module.getEntitiesCount(), 0u);
+}
+
+//=========================================================
+//================ ModuleHandle::reload ===================
+//=========================================================
+
+namespace module_reload
+{
+	struct Counter
+	{
+		int	value	= 0;
+		int	step	= 1;
+
+		void	increment(int count)		{ value += step * count; }
+		void	incrementTwice(int count)	{ value += 2 * step * count; }
+		void	reset(float)				{ value = 0; }
+	};
+
+	static int getVersion1() { return 1; }
+	static int getVersion2() { return 2; }
+
+	static int getStep1(Counter* counter) { return counter->step; }
+	static int getStep2(Counter* counter) { return 2 * counter->step; }
+
+	/** Ids shared by the entities of all the builds of a module, like a shared library built twice. */
+	struct BuildIds
+	{
+		std::size_t	counter		= generateTestEntityId();
+		std::size_t	getVersion	= generateTestEntityId();
+		std::size_t	value		= generateTestEntityId();
+		std::size_t	step		= generateTestEntityId();
+		std::size_t	increment	= generateTestEntityId();
+	};
+
+	/**
+	*	Build of a module containing a Counter struct and a getVersion function.
+	*/
+	struct Build
+	{
+		rfk::Struct		counter;
+		rfk::Function	getVersion;
+		rfk::Method*	increment;
+
+		Build(BuildIds const& ids, std::size_t counterSize, bool swapFields, void (Counter::*incrementFunction)(int), int (*getVersionFunction)()):
+			counter("ReloadedCounter", ids.counter, counterSize, false),
+			getVersion("reloadedGetVersion", ids.getVersion, rfk::getType<int>(), new rfk::NonMemberFunction<int()>(getVersionFunction), rfk::EFunctionFlags::Default)
+		{
+			counter.addField("value", ids.value, rfk::getType<int>(), rfk::EFieldFlags::Public, swapFields ? offsetof(Counter, step) : offsetof(Counter, value), &counter);
+			counter.addField("step", ids.step, rfk::getType<int>(), rfk::EFieldFlags::Public, swapFields ? offsetof(Counter, value) : offsetof(Counter, step), &counter);
+
+			increment = counter.addMethod("increment", ids.increment, rfk::getType<void>(), new rfk::MemberFunction<Counter, void(int)>(incrementFunction), rfk::EMethodFlags::Public);
+			increment->addParameter("count", 0u, rfk::getType<int>());
+		}
+	};
+}
+
+TEST(Rfk_ModuleHandle_reload, CachedHandlesRunNewerBuildCode)
+{
+	module_reload::BuildIds ids;
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+	module_reload::Build rebuilt(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::incrementTwice, &module_reload::getVersion2);
+
+	rfk::Entity const* const originalEntities[] = { &original.counter, &original.getVersion };
+	rfk::Entity const* const rebuiltEntities[] = { &rebuilt.counter, &rebuilt.getVersion };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	rfk::ModuleHandle rebuiltModule("RebuiltModule");
+	originalModule.addEntities(originalEntities, 2u);
+	rebuiltModule.addEntities(rebuiltEntities, 2u);
+	originalModule.load();
+
+	rfk::Method const*		increment	= rfk::getDatabase().getStructById(ids.counter)->getMethodByName("increment");
+	rfk::Function const*	getVersion	= rfk::getDatabase().getFunctionById(ids.getVersion);
+	module_reload::Counter	counter;
+
+	rfk::ModuleReloadReport report = originalModule.reload(rebuiltModule);
+
+	EXPECT_TRUE(originalModule.isReloaded());
+	EXPECT_EQ(report.patchedFunctionsCount, 2u);
+	EXPECT_EQ(report.patchedFieldsCount, 2u);
+	EXPECT_EQ(report.incompatibleEntitiesCount, 0u);
+	EXPECT_EQ(report.missingEntitiesCount, 0u);
+
+	//Handles cached before the reload still point to the original entities, which run the rebuilt code
+	EXPECT_EQ(rfk::getDatabase().getFunctionById(ids.getVersion), getVersion);
+	EXPECT_EQ(getVersion->invoke<int>(), 2);
+
+	increment->invokeUnsafe<void>(&counter, 3);
+	EXPECT_EQ(counter.value, 6);
+
+	originalModule.revertReload();
+
+	EXPECT_FALSE(originalModule.isReloaded());
+	EXPECT_EQ(getVersion->invoke<int>(), 1);
+
+	increment->invokeUnsafe<void>(&counter, 3);
+	EXPECT_EQ(counter.value, 9);
+
+	originalModule.unload();
+	rebuiltModule.removeEntities(rebuiltEntities, 2u);
+	originalModule.removeEntities(originalEntities, 2u);
+}
+
+TEST(Rfk_ModuleHandle_reload, ReorderedFieldsAreNotPatched)
+{
+	module_reload::BuildIds ids;
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+	module_reload::Build rebuilt(ids, sizeof(module_reload::Counter), true, &module_reload::Counter::incrementTwice, &module_reload::getVersion1);
+
+	rfk::Entity const* const originalEntities[] = { &original.counter };
+	rfk::Entity const* const rebuiltEntities[] = { &rebuilt.counter };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	rfk::ModuleHandle rebuiltModule("RebuiltModule");
+	originalModule.addEntities(originalEntities, 1u);
+	rebuiltModule.addEntities(rebuiltEntities, 1u);
+
+	rfk::ModuleReloadReport report = originalModule.reload(rebuiltModule);
+
+	//Same size, alignment and field types, but the fields moved: the struct is incompatible
+	EXPECT_EQ(report.patchedFunctionsCount, 0u);
+	EXPECT_EQ(report.patchedFieldsCount, 0u);
+	EXPECT_EQ(report.incompatibleEntitiesCount, 1u);
+	EXPECT_EQ(original.counter.getFieldByName("value")->getMemoryOffset(), offsetof(module_reload::Counter, value));
+	EXPECT_EQ(original.counter.getFieldByName("step")->getMemoryOffset(), offsetof(module_reload::Counter, step));
+
+	module_reload::Counter counter;
+	original.increment->invokeUnsafe<void>(&counter, 3);
+
+	EXPECT_EQ(counter.value, 3);
+
+	rebuiltModule.removeEntities(rebuiltEntities, 1u);
+	originalModule.removeEntities(originalEntities, 1u);
+}
+
+TEST(Rfk_ModuleHandle_reload, FunctionsAccessingChangedLayoutAreNotPatched)
+{
+	module_reload::BuildIds ids;
+	std::size_t const		getStepId = generateTestEntityId();
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+	module_reload::Build rebuilt(ids, sizeof(module_reload::Counter), true, &module_reload::Counter::increment, &module_reload::getVersion2);
+
+	//Counter* of each build
+	rfk::Type counterPointer;
+	counterPointer.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+	counterPointer.setArchetype(&original.counter);
+
+	rfk::Type rebuiltCounterPointer;
+	rebuiltCounterPointer.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+	rebuiltCounterPointer.setArchetype(&rebuilt.counter);
+
+	rfk::Function getStep("reloadedGetStep", getStepId, rfk::getType<int>(), new rfk::NonMemberFunction<int(module_reload::Counter*)>(&module_reload::getStep1), rfk::EFunctionFlags::Default);
+	getStep.addParameter("counter", 0u, counterPointer);
+
+	rfk::Function rebuiltGetStep("reloadedGetStep", getStepId, rfk::getType<int>(), new rfk::NonMemberFunction<int(module_reload::Counter*)>(&module_reload::getStep2), rfk::EFunctionFlags::Default);
+	rebuiltGetStep.addParameter("counter", 0u, rebuiltCounterPointer);
+
+	rfk::Entity const* const originalEntities[] = { &original.counter, &original.getVersion, &getStep };
+	rfk::Entity const* const rebuiltEntities[] = { &rebuilt.counter, &rebuilt.getVersion, &rebuiltGetStep };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	rfk::ModuleHandle rebuiltModule("RebuiltModule");
+	originalModule.addEntities(originalEntities, 3u);
+	rebuiltModule.addEntities(rebuiltEntities, 3u);
+
+	rfk::ModuleReloadReport report = originalModule.reload(rebuiltModule);
+
+	//The function taking a Counter* would read the rebuilt offsets, only getVersion is patched
+	EXPECT_EQ(report.patchedFunctionsCount, 1u);
+	EXPECT_EQ(report.incompatibleEntitiesCount, 2u);
+
+	module_reload::Counter counter;
+
+	EXPECT_EQ(getStep.invoke<int>(&counter), 1);
+	EXPECT_EQ(original.getVersion.invoke<int>(), 2);
+
+	rebuiltModule.removeEntities(rebuiltEntities, 3u);
+	originalModule.removeEntities(originalEntities, 3u);
+}
+
+TEST(Rfk_ModuleHandle_reload, ChangedLayoutIsNotPatched)
+{
+	module_reload::BuildIds ids;
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+	module_reload::Build rebuilt(ids, sizeof(module_reload::Counter) * 2u, false, &module_reload::Counter::incrementTwice, &module_reload::getVersion2);
+
+	rfk::Entity const* const originalEntities[] = { &original.counter, &original.getVersion };
+	rfk::Entity const* const rebuiltEntities[] = { &rebuilt.counter, &rebuilt.getVersion };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	rfk::ModuleHandle rebuiltModule("RebuiltModule");
+	originalModule.addEntities(originalEntities, 2u);
+	rebuiltModule.addEntities(rebuiltEntities, 2u);
+
+	rfk::ModuleReloadReport report = originalModule.reload(rebuiltModule);
+
+	//The struct methods are left unpatched, but the function still is
+	EXPECT_EQ(report.patchedFunctionsCount, 1u);
+	EXPECT_EQ(report.patchedFieldsCount, 0u);
+	EXPECT_EQ(report.incompatibleEntitiesCount, 1u);
+
+	module_reload::Counter counter;
+	original.increment->invokeUnsafe<void>(&counter, 3);
+
+	EXPECT_EQ(counter.value, 3);
+	EXPECT_EQ(original.getVersion.invoke<int>(), 2);
+
+	rebuiltModule.removeEntities(rebuiltEntities, 2u);
+	originalModule.removeEntities(originalEntities, 2u);
+}
+
+TEST(Rfk_ModuleHandle_reload, ChangedSignatureAndMissingEntitiesAreNotPatched)
+{
+	module_reload::BuildIds ids;
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+
+	rfk::Struct rebuiltCounter("ReloadedCounter", ids.counter, sizeof(module_reload::Counter), false);
+	rebuiltCounter.addField("value", ids.value, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(module_reload::Counter, value), &rebuiltCounter);
+	rebuiltCounter.addField("step", ids.step, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(module_reload::Counter, step), &rebuiltCounter);
+	rebuiltCounter.addMethod("increment", ids.increment, rfk::getType<void>(), new rfk::MemberFunction<module_reload::Counter, void(float)>(&module_reload::Counter::reset), rfk::EMethodFlags::Public)
+		->addParameter("count", 0u, rfk::getType<float>());
+
+	rfk::Entity const* const originalEntities[] = { &original.counter, &original.getVersion };
+	rfk::Entity const* const rebuiltEntities[] = { &rebuiltCounter };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	rfk::ModuleHandle rebuiltModule("RebuiltModule");
+	originalModule.addEntities(originalEntities, 2u);
+	rebuiltModule.addEntities(rebuiltEntities, 1u);
+
+	rfk::ModuleReloadReport report = originalModule.reload(rebuiltModule);
+
+	EXPECT_EQ(report.patchedFunctionsCount, 0u);
+	EXPECT_EQ(report.patchedFieldsCount, 2u);
+	EXPECT_EQ(report.incompatibleEntitiesCount, 1u);
+	EXPECT_EQ(report.missingEntitiesCount, 1u);
+
+	module_reload::Counter counter;
+	original.increment->invokeUnsafe<void>(&counter, 3);
+
+	EXPECT_EQ(counter.value, 3);
+
+	rebuiltModule.removeEntities(rebuiltEntities, 1u);
+	originalModule.removeEntities(originalEntities, 2u);
+}
+
+TEST(Rfk_ModuleHandle_reload, RemovingNewerBuildRevertsPatches)
+{
+	module_reload::BuildIds ids;
+
+	module_reload::Build original(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion1);
+	rfk::Entity const* const originalEntities[] = { &original.getVersion };
+
+	rfk::ModuleHandle originalModule("OriginalModule");
+	originalModule.addEntities(originalEntities, 1u);
+
+	{
+		module_reload::Build		rebuilt(ids, sizeof(module_reload::Counter), false, &module_reload::Counter::increment, &module_reload::getVersion2);
+		rfk::ModuleHandle			rebuiltModule("RebuiltModule");
+		rfk::ModuleEntityRegisterer	registerer(rebuiltModule, rebuilt.getVersion);
+
+		originalModule.reload(rebuiltModule);
+
+		EXPECT_EQ(original.getVersion.invoke<int>(), 2);
+	}
+
+	//The rebuilt entities were removed from their module before being destroyed
+	EXPECT_FALSE(originalModule.isReloaded());
+	EXPECT_EQ(original.getVersion.invoke<int>(), 1);
+
+	originalModule.removeEntities(originalEntities, 1u);
+}
+
+#if defined(HOT_RELOAD_MODULE_V1_PATH) && defined(HOT_RELOAD_MODULE_V2_PATH)
+
+namespace module_reload
+{
+	/** Shared library loaded for the duration of its lifetime. */
+	class SharedLibrary
+	{
+		private:
+	#if defined(_WIN32) || defined(_WIN64)
+			HMODULE _handle;
+	#else
+			void*	_handle;
+	#endif
+
+		public:
+			SharedLibrary(char const* path):
+	#if defined(_WIN32) || defined(_WIN64)
+				_handle{LoadLibraryA(path)}
+	#else
+				_handle{dlopen(path, RTLD_NOW | RTLD_LOCAL)}
+	#endif
+			{
+			}
+
+			~SharedLibrary()
+			{
+				if (_handle != nullptr)
+				{
+	#if defined(_WIN32) || defined(_WIN64)
+					FreeLibrary(_handle);
+	#else
+					dlclose(_handle);
+	#endif
+				}
+			}
+
+			bool isLoaded() const noexcept
+			{
+				return _handle != nullptr;
+			}
+
+			rfk::ModuleHandle& getModule() const
+			{
+				using GetModuleFunction = rfk::ModuleHandle* (*)();
+
+	#if defined(_WIN32) || defined(_WIN64)
+				GetModuleFunction getModuleFunction = reinterpret_cast<GetModuleFunction>(GetProcAddress(_handle, hot_reload_module::getModuleFunctionName));
+	#else
+				GetModuleFunction getModuleFunction = reinterpret_cast<GetModuleFunction>(dlsym(_handle, hot_reload_module::getModuleFunctionName));
+	#endif
+
+				return *getModuleFunction();
+			}
+	};
+}
+
+TEST(Rfk_ModuleHandle_reload, SharedLibraryBuiltTwice)
+{
+	module_reload::SharedLibrary originalLibrary(HOT_RELOAD_MODULE_V1_PATH);
+	ASSERT_TRUE(originalLibrary.isLoaded());
+
+	rfk::ModuleHandle& originalModule = originalLibrary.getModule();
+	originalModule.load();
+
+	rfk::Struct const*		counterArchetype	= rfk::getDatabase().getStructById(hot_reload_module::counterId);
+	rfk::Function const*	getVersion			= rfk::getDatabase().getFunctionById(hot_reload_module::getVersionId);
+	ASSERT_NE(counterArchetype, nullptr);
+	ASSERT_NE(getVersion, nullptr);
+
+	rfk::Method const*	increment = counterArchetype->getMethodByName("increment");
+	HotReloadCounter	counter;
+	ASSERT_NE(increment, nullptr);
+
+	increment->invokeUnsafe<void>(&counter, 2);
+
+	EXPECT_EQ(counter.value, 2);
+	EXPECT_EQ(getVersion->invoke<int>(), 1);
+
+	{
+		module_reload::SharedLibrary rebuiltLibrary(HOT_RELOAD_MODULE_V2_PATH);
+		ASSERT_TRUE(rebuiltLibrary.isLoaded());
+
+		rfk::ModuleReloadReport report = originalModule.reload(rebuiltLibrary.getModule());
+
+		EXPECT_EQ(report.patchedFunctionsCount, 2u);
+		EXPECT_EQ(report.patchedFieldsCount, 2u);
+		EXPECT_EQ(report.incompatibleEntitiesCount, 0u);
+		EXPECT_EQ(report.missingEntitiesCount, 0u);
+
+		//The handles cached from the original library run the code of the rebuilt library
+		increment->invokeUnsafe<void>(&counter, 2);
+
+		EXPECT_EQ(counter.value, 22);
+		EXPECT_EQ(getVersion->invoke<int>(), 2);
+		EXPECT_EQ(counterArchetype->getFieldByName("step")->getUnsafe<int>(&counter), 1);
+		EXPECT_EQ(rfk::getDatabase().getStructById(hot_reload_module::counterId), counterArchetype);
+	}
+
+	//Unloading the rebuilt library from memory reverted the patches
+	EXPECT_FALSE(originalModule.isReloaded());
+
+	increment->invokeUnsafe<void>(&counter, 2);
+
+	EXPECT_EQ(counter.value, 24);
+	EXPECT_EQ(getVersion->invoke<int>(), 1);
+
+	originalModule.unload();
+}
+
+#endif
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
+
+#include "TestModule.h"
 
 //=========================================================
 //============ Namespace::getNamespaceByName ==============
@@ -246,6 +249,17 @@ TEST(Rfk_Namespace_getStructsByPredicate, ThrowingPredicate)
 	EXPECT_THROW(rfk::getDatabase().getNamespaceByName("test_namespace")->getStructsByPredicate(predicate, nullptr), std::logic_error);
 }
 
+
+TEST(Rfk_Namespace_getStructsByPredicate, FindingCallable)
+{
+	char firstLetter = 'T';
+
+	EXPECT_EQ(rfk::getDatabase().getNamespaceByName("test_namespace")->getStructsByPredicate([firstLetter](rfk::Struct const& struct_)
+			  {
+				  return struct_.getName()[0] == firstLetter;
+			  }).size(), 2u);
+}
+
 //=========================================================
 //================ Namespace::foreachStruct ===============
 //=========================================================
@@ -1008,4 +1022,64 @@ TEST(Rfk_Namespace_foreachFunction, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getDatabase().getNamespaceByName("test_namespace")->foreachFunction(visitor, nullptr), std::logic_error);
+}
+
+//=========================================================
+//========= NamespaceFragment::addNestedEntities ==========
+//=========================================================
+
+TEST(Rfk_NamespaceFragment_addNestedEntities, MergesAllEntityKinds)
+{
+	rfk::Struct		s("BulkStruct", generateTestEntityId(), 4u, false);
+	rfk::Enum		e("BulkEnum", generateTestEntityId(), rfk::getArchetype<int>());
+	rfk::Variable	v("bulkVariable", generateTestEntityId(), rfk::getType<int>(), static_cast<void*>(nullptr), rfk::EVarFlags::Default);
+
+	rfk::NamespaceFragment nestedFragment("bulk_nested_namespace", generateTestEntityId());
+	rfk::NamespaceFragment fragment("bulk_namespace", generateTestEntityId());
+
+	rfk::Entity const* const nestedEntities[] = { &nestedFragment, &s, &e, &v };
+	fragment.addNestedEntities(nestedEntities, 4u);
+
+	rfk::Namespace const& np = fragment.getMergedNamespace();
+
+	EXPECT_EQ(np.getNamespacesCount(), 1u);
+	EXPECT_EQ(np.getArchetypesCount(), 2u);
+	EXPECT_EQ(np.getVariablesCount(), 1u);
+	EXPECT_EQ(np.getFunctionsCount(), 0u);
+	EXPECT_EQ(np.getNamespaceByName("bulk_nested_namespace"), &nestedFragment.getMergedNamespace());
+	EXPECT_EQ(np.getStructByName("BulkStruct"), &s);
+	EXPECT_EQ(np.getEnumByName("BulkEnum"), &e);
+	EXPECT_EQ(s.getOuterEntity(), &np);
+}
+
+TEST(Rfk_NamespaceFragment_addNestedEntities, EmptyBatch)
+{
+	rfk::NamespaceFragment fragment("bulk_empty_namespace", generateTestEntityId());
+
+	fragment.addNestedEntities(nullptr, 0u);
+
+	EXPECT_EQ(fragment.getMergedNamespace().getNamespacesCount(), 0u);
+	EXPECT_EQ(fragment.getMergedNamespace().getArchetypesCount(), 0u);
+}
+
+TEST(Rfk_NamespaceFragment_addNestedEntities, SkipsMergedEntities)
+{
+	rfk::Variable	v1("bulkMergedVariable1", generateTestEntityId(), rfk::getType<int>(), static_cast<void*>(nullptr), rfk::EVarFlags::Default);
+	rfk::Variable	v2("bulkMergedVariable2", generateTestEntityId(), rfk::getType<int>(), static_cast<void*>(nullptr), rfk::EVarFlags::Default);
+
+	rfk::NamespaceFragment fragment("bulk_merged_namespace", generateTestEntityId());
+	fragment.addNestedEntity(v1);
+
+	//v1 is already merged, and v2 is in the batch twice
+	rfk::Entity const* const nestedEntities[] = { &v2, &v1, &v2 };
+	fragment.addNestedEntities(nestedEntities, 3u);
+
+	rfk::Namespace const&				np			= fragment.getMergedNamespace();
+	rfk::Span<rfk::Variable const* const>	variables	= np.getVariablesSpan();
+
+	EXPECT_EQ(np.getVariablesCount(), 2u);
+	ASSERT_EQ(variables.size(), 2u);
+	EXPECT_EQ(variables[0], &v1);
+	EXPECT_EQ(variables[1], &v2);
+	EXPECT_EQ(np.getVariableByName("bulkMergedVariable2"), &v2);
 }
\ No newline at end of file
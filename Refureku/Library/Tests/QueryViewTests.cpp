@@ -0,0 +1,224 @@
+#include <cstdlib>	//std::malloc, std::free
+#include <new>		//std::bad_alloc
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestClass.h"
+#include "TestClass2.h"
+#include "TestEnum.h"
+
+//Count the global allocations to check that views and buffer overloads don't allocate.
+//The replaced operator new is shared by the whole test binary, including the threads started by other tests,
+//so each thread counts its own allocations
+static thread_local std::size_t allocationsCount = 0u;
+
+void* operator new(std::size_t size)
+{
+	allocationsCount++;
+
+	if (void* ptr = std::malloc((size != 0u) ? size : 1u))
+	{
+		return ptr;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+//=========================================================
+//================== Struct::queryFields ==================
+//=========================================================
+
+TEST(Rfk_Struct_queryFields, FindingCallable)
+{
+	auto view = TestClass::staticGetArchetype().queryFields([](rfk::Field const& field) { return field.hasSameName("_intField"); });
+
+	ASSERT_FALSE(view.empty());
+	EXPECT_EQ(view.count(), 1u);
+	EXPECT_STREQ(view.first()->getName(), "_intField");
+}
+
+TEST(Rfk_Struct_queryFields, NonFindingCallable)
+{
+	auto view = TestClass::staticGetArchetype().queryFields([](rfk::Field const& field) { return field.hasSameName("inexistantField"); });
+
+	EXPECT_TRUE(view.empty());
+	EXPECT_EQ(view.first(), nullptr);
+	EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(Rfk_Struct_queryFields, SameResultAsGetFieldsByPredicate)
+{
+	auto predicate = [](rfk::Field const& field) { return field.getMemoryOffset() % 2u == 0u; };
+
+	rfk::Vector<rfk::Field const*>	fields = TestClass2::staticGetArchetype().getFieldsByPredicate(predicate, true);
+	std::size_t						index = 0u;
+
+	for (rfk::Field const& field : TestClass2::staticGetArchetype().queryFields(predicate, true))
+	{
+		ASSERT_LT(index, fields.size());
+		EXPECT_EQ(&field, fields[index++]);
+	}
+
+	EXPECT_EQ(index, fields.size());
+}
+
+TEST(Rfk_Struct_queryFields, CopyToStopsWhenBufferIsFull)
+{
+	rfk::Field const* fields[1];
+
+	auto view = TestClass2::staticGetArchetype().queryFields([](rfk::Field const&) { return true; }, true);
+
+	ASSERT_GT(view.count(), 1u);
+	EXPECT_EQ(view.copyTo(fields, 1u), 1u);
+	EXPECT_EQ(fields[0], view.first());
+}
+
+TEST(Rfk_Struct_queryFields, NoAllocation)
+{
+	std::size_t allocationsBefore = allocationsCount;
+
+	auto view = TestClass2::staticGetArchetype().queryFields([](rfk::Field const&) { return true; }, true);
+
+	std::size_t count = 0u;
+	for (rfk::Field const& field : view)
+	{
+		(void)field;
+		count++;
+	}
+
+	EXPECT_EQ(allocationsCount, allocationsBefore);
+	EXPECT_EQ(count, view.count());
+}
+
+//=========================================================
+//================= Struct::queryMethods ==================
+//=========================================================
+
+TEST(Rfk_Struct_queryMethods, OnlyOwnMethods)
+{
+	EXPECT_EQ(TestClass::staticGetArchetype().queryMethods([](rfk::Method const& method) { return method.hasSameName("getIntField"); }).count(), 2u);
+	EXPECT_TRUE(TestClass2::staticGetArchetype().queryMethods([](rfk::Method const& method) { return method.hasSameName("getIntField"); }).empty());
+}
+
+//=========================================================
+//========= Struct::getMethodsByName (out buffer) =========
+//=========================================================
+
+TEST(Rfk_Struct_getMethodsByNameBuffer, SameResultAsVectorOverload)
+{
+	rfk::Method const* methods[4];
+
+	rfk::Vector<rfk::Method const*> expected = TestClass2::staticGetArchetype().getMethodsByName("getIntField", rfk::EMethodFlags::Default, true);
+
+	ASSERT_EQ(TestClass2::staticGetArchetype().getMethodsByName("getIntField", methods, 4u, rfk::EMethodFlags::Default, true), expected.size());
+
+	for (std::size_t i = 0u; i < expected.size(); i++)
+	{
+		EXPECT_EQ(methods[i], expected[i]);
+	}
+}
+
+TEST(Rfk_Struct_getMethodsByNameBuffer, TooSmallBuffer)
+{
+	rfk::Method const* methods[1] = { nullptr };
+
+	EXPECT_EQ(TestClass::staticGetArchetype().getMethodsByName("getIntField", methods, 1u), 2u);
+	EXPECT_NE(methods[0], nullptr);
+	EXPECT_EQ(TestClass::staticGetArchetype().getMethodsByName("getIntField", nullptr, 0u), 2u);
+}
+
+TEST(Rfk_Struct_getMethodsByNameBuffer, InvalidFlags)
+{
+	EXPECT_EQ(TestClass::staticGetArchetype().getMethodsByName("getIntField", nullptr, 0u, rfk::EMethodFlags::Private), 0u);
+}
+
+TEST(Rfk_Struct_getMethodsByNameBuffer, NoAllocation)
+{
+	rfk::Method const* methods[4];
+
+	std::size_t allocationsBefore = allocationsCount;
+
+	std::size_t found = TestClass2::staticGetArchetype().getMethodsByName("getIntField", methods, 4u, rfk::EMethodFlags::Default, true);
+
+	EXPECT_EQ(allocationsCount, allocationsBefore);
+	EXPECT_EQ(found, 2u);
+}
+
+//=========================================================
+//========== Enum::getEnumValues (out buffer) =============
+//=========================================================
+
+TEST(Rfk_Enum_getEnumValuesBuffer, MultipleValues)
+{
+	rfk::EnumValue const* enumValues[2];
+
+	rfk::Vector<rfk::EnumValue const*> expected = rfk::getEnum<TestEnumClass>()->getEnumValues(1 << 2);
+
+	ASSERT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValues(1 << 2, enumValues, 2u), 2u);
+	EXPECT_EQ(enumValues[0], expected[0]);
+	EXPECT_EQ(enumValues[1], expected[1]);
+}
+
+TEST(Rfk_Enum_getEnumValuesBuffer, NoValue)
+{
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getEnumValues(-1, nullptr, 0u), 0u);
+}
+
+TEST(Rfk_Enum_getEnumValuesBuffer, NoAllocation)
+{
+	rfk::EnumValue const* enumValues[1];
+
+	std::size_t allocationsBefore = allocationsCount;
+
+	std::size_t found = rfk::getEnum<TestEnumClass>()->getEnumValues(1 << 2, enumValues, 1u);
+
+	EXPECT_EQ(allocationsCount, allocationsBefore);
+	EXPECT_EQ(found, 2u);
+}
+
+//=========================================================
+//================ Enum::queryEnumValues ==================
+//=========================================================
+
+TEST(Rfk_Enum_queryEnumValues, MultipleValues)
+{
+	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->queryEnumValues([](rfk::EnumValue const& enumValue) { return enumValue.getValue() == 1 << 2; }).count(), 2u);
+}
+
+//=========================================================
+//=========== Database::queryFileLevelStructs =============
+//=========================================================
+
+TEST(Rfk_Database_queryFileLevelStructs, CompleteLoop)
+{
+	std::size_t allocationsBefore = allocationsCount;
+
+	std::size_t count = rfk::getDatabase().queryFileLevelStructs([](rfk::Struct const&) { return true; }).count();
+
+	EXPECT_EQ(allocationsCount, allocationsBefore);
+	EXPECT_EQ(count, rfk::getDatabase().getFileLevelStructsCount());
+}
+
+//=========================================================
+//=============== Namespace::queryStructs =================
+//=========================================================
+
+TEST(Rfk_Namespace_queryStructs, SameResultAsGetStructsByPredicate)
+{
+	EXPECT_TRUE(rfk::getDatabase().foreachFileLevelNamespace([](rfk::Namespace const& namespace_)
+	{
+		return namespace_.queryStructs([](rfk::Struct const&) { return true; }).count() ==
+				namespace_.getStructsByPredicate([](rfk::Struct const&) { return true; }).size();
+	}));
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestModule.h"
+
+namespace registration_trace_tests
+{
+	rfk::RegistrationTraceEvent const* findEvent(rfk::Vector<rfk::RegistrationTraceEvent> const& events, rfk::ERegistrationTraceCategory category, char const* name)
+	{
+		for (rfk::RegistrationTraceEvent const& event : events)
+		{
+			if (event.category == category && event.name != nullptr && std::strcmp(event.name, name) == 0)
+			{
+				return &event;
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::size_t countOccurrences(std::string const& string, char const* pattern)
+	{
+		std::size_t count = 0u;
+
+		for (std::size_t pos = string.find(pattern); pos != std::string::npos; pos = string.find(pattern, pos + 1u))
+		{
+			count++;
+		}
+
+		return count;
+	}
+
+	/**
+	*	Check that the braces and brackets of a JSON document are balanced outside of the string literals.
+	*/
+	bool isBalancedJson(std::string const& json)
+	{
+		std::string	stack;
+		bool		inString = false;
+
+		for (std::size_t i = 0u; i < json.size(); i++)
+		{
+			char c = json[i];
+
+			if (inString)
+			{
+				if (c == '\\')
+				{
+					i++;
+				}
+				else if (c == '"')
+				{
+					inString = false;
+				}
+			}
+			else if (c == '"')
+			{
+				inString = true;
+			}
+			else if (c == '{' || c == '[')
+			{
+				stack.push_back(c);
+			}
+			else if (c == '}' || c == ']')
+			{
+				if (stack.empty() || stack.back() != ((c == '}') ? '{' : '['))
+				{
+					return false;
+				}
+
+				stack.pop_back();
+			}
+		}
+
+		return stack.empty() && !inString;
+	}
+}
+
+//=========================================================
+//========== getRegistrationTraceCategoryName =============
+//=========================================================
+
+TEST(Rfk_getRegistrationTraceCategoryName, NamesAllCategories)
+{
+	EXPECT_STREQ(rfk::getRegistrationTraceCategoryName(rfk::ERegistrationTraceCategory::ArchetypeRegisterer), "ArchetypeRegisterer");
+	EXPECT_STREQ(rfk::getRegistrationTraceCategoryName(rfk::ERegistrationTraceCategory::StaticGetArchetype), "StaticGetArchetype");
+	EXPECT_STREQ(rfk::getRegistrationTraceCategoryName(rfk::ERegistrationTraceCategory::NamespaceMerge), "NamespaceMerge");
+	EXPECT_STREQ(rfk::getRegistrationTraceCategoryName(rfk::ERegistrationTraceCategory::Count), "Unknown");
+}
+
+//=========================================================
+//=========== Database::getRegistrationTrace ==============
+//=========================================================
+
+TEST(Rfk_Database_getRegistrationTrace, RecordsCorpusRegistration)
+{
+	rfk::Vector<rfk::RegistrationTraceEvent> events = rfk::getDatabase().getRegistrationTrace();
+
+#if RFK_REGISTRATION_TRACING
+	rfk::RegistrationTraceEvent const* registererEvent	= registration_trace_tests::findEvent(events, rfk::ERegistrationTraceCategory::ArchetypeRegisterer, "TestClass");
+	rfk::RegistrationTraceEvent const* archetypeEvent	= registration_trace_tests::findEvent(events, rfk::ERegistrationTraceCategory::StaticGetArchetype, "TestClass");
+	rfk::RegistrationTraceEvent const* mergeEvent		= registration_trace_tests::findEvent(events, rfk::ERegistrationTraceCategory::NamespaceMerge, "test_namespace");
+
+	ASSERT_NE(registererEvent, nullptr);
+	ASSERT_NE(archetypeEvent, nullptr);
+	ASSERT_NE(mergeEvent, nullptr);
+
+	//Registerers are attributed to the file which generated them
+	ASSERT_NE(registererEvent->module, nullptr);
+	ASSERT_NE(archetypeEvent->module, nullptr);
+	EXPECT_STREQ(registererEvent->module, "TestClass.h");
+	EXPECT_STREQ(archetypeEvent->module, "TestClass.h");
+
+	//The metadata is built when the registerer argument is evaluated, so before the registration
+	EXPECT_LE(archetypeEvent->start + archetypeEvent->duration, registererEvent->start);
+
+	//Events are stored in start order
+	for (std::size_t i = 1u; i < events.size(); i++)
+	{
+		EXPECT_LE(events[i - 1u].start, events[i].start);
+	}
+#else
+	EXPECT_TRUE(events.empty());
+#endif
+}
+
+TEST(Rfk_Database_getRegistrationTrace, RecordsModuleLoad)
+{
+	rfk::Struct	s("TracedStruct", generateTestEntityId(), sizeof(int), false);
+	TestModule	module("TracedModule");
+
+	module.load({ &s });
+
+	rfk::Vector<rfk::RegistrationTraceEvent> events = rfk::getDatabase().getRegistrationTrace();
+
+#if RFK_REGISTRATION_TRACING
+	rfk::RegistrationTraceEvent const* loadEvent = registration_trace_tests::findEvent(events, rfk::ERegistrationTraceCategory::ModuleLoad, "TracedModule");
+
+	ASSERT_NE(loadEvent, nullptr);
+	ASSERT_NE(loadEvent->module, nullptr);
+	EXPECT_STREQ(loadEvent->module, "TracedModule");
+#else
+	EXPECT_TRUE(events.empty());
+#endif
+}
+
+TEST(Rfk_Database_getRegistrationTrace, NestsScopes)
+{
+	rfk::getDatabase().clearRegistrationTrace();
+
+	{
+		rfk::internal::RegistrationTraceScope outer(rfk::ERegistrationTraceCategory::ModuleLoad, "Outer", "TraceTests");
+		rfk::internal::RegistrationTraceScope inner(rfk::ERegistrationTraceCategory::ArchetypeRegisterer, "Inner");
+	}
+
+	rfk::Vector<rfk::RegistrationTraceEvent> events = rfk::getDatabase().getRegistrationTrace();
+
+#if RFK_REGISTRATION_TRACING
+	ASSERT_EQ(events.size(), 2u);
+	EXPECT_STREQ(events[0].name, "Outer");
+	EXPECT_STREQ(events[1].name, "Inner");
+	EXPECT_EQ(events[0].threadIndex, events[1].threadIndex);
+	EXPECT_LE(events[0].start, events[1].start);
+	EXPECT_GE(events[0].start + events[0].duration, events[1].start + events[1].duration);
+#else
+	EXPECT_TRUE(events.empty());
+#endif
+}
+
+//=========================================================
+//========== Database::exportRegistrationTrace ============
+//=========================================================
+
+TEST(Rfk_Database_exportRegistrationTrace, WritesChromeTrace)
+{
+	rfk::Database const& database = rfk::getDatabase();
+
+	database.clearRegistrationTrace();
+
+	{
+		rfk::internal::RegistrationTraceScope scope(rfk::ERegistrationTraceCategory::NamespaceMerge, "quoted \"namespace\"", "Trace\\Tests");
+	}
+
+	char const* filePath = "RegistrationTraceTests.json";
+
+	ASSERT_TRUE(database.exportRegistrationTrace(filePath));
+
+	std::ifstream	file(filePath, std::ios::binary);
+	std::string		trace((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	file.close();
+	std::remove(filePath);
+
+	EXPECT_TRUE(registration_trace_tests::isBalancedJson(trace));
+	EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+
+#if RFK_REGISTRATION_TRACING
+	EXPECT_EQ(registration_trace_tests::countOccurrences(trace, "\"ph\":\"X\""), database.getRegistrationTrace().size());
+	EXPECT_NE(trace.find("\"name\":\"quoted \\\"namespace\\\"\""), std::string::npos);
+	EXPECT_NE(trace.find("\"cat\":\"NamespaceMerge\""), std::string::npos);
+	EXPECT_NE(trace.find("\"args\":{\"module\":\"Trace\\\\Tests\"}"), std::string::npos);
+#else
+	EXPECT_EQ(registration_trace_tests::countOccurrences(trace, "\"ph\":\"X\""), 0u);
+#endif
+}
+
+//=========================================================
+//========== Database::clearRegistrationTrace =============
+//=========================================================
+
+TEST(Rfk_Database_clearRegistrationTrace, RemovesEvents)
+{
+	rfk::Database const& database = rfk::getDatabase();
+
+	{
+		rfk::internal::RegistrationTraceScope scope(rfk::ERegistrationTraceCategory::ModuleLoad, "Cleared");
+	}
+
+	database.clearRegistrationTrace();
+
+	EXPECT_TRUE(database.getRegistrationTrace().empty());
+}
\ No newline at end of file
@@ -0,0 +1,349 @@
+#include <string>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "ConstructionTrackedClass.h"
+#include "TestClass.h"
+#include "TestClass2.h"
+#include "TestEnum.h"
+
+//=========================================================
+//================= SmallVector::ctor =====================
+//=========================================================
+
+TEST(Rfk_SmallVector_ctor, DefaultCtor)
+{
+	rfk::SmallVector<int, 4> vec;
+
+	EXPECT_TRUE(vec.empty());
+	EXPECT_TRUE(vec.isInline());
+	EXPECT_EQ(vec.capacity(), 4u);
+}
+
+TEST(Rfk_SmallVector_ctor, CopyCtor)
+{
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec1;
+
+	for (int i = 0; i < 4; i++)
+	{
+		vec1.emplace_back(i);
+	}
+
+	rfk::SmallVector<ConstructionTrackedClass, 2> vecCopy = vec1;
+
+	ASSERT_EQ(vecCopy.size(), vec1.size());
+	for (std::size_t i = 0u; i < vecCopy.size(); i++)
+	{
+		EXPECT_TRUE(vecCopy[i].getCopyConstructed());
+		EXPECT_EQ(vecCopy[i].getValue(), i);
+	}
+}
+
+TEST(Rfk_SmallVector_ctor, MoveCtorInline)
+{
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec1;
+
+	vec1.emplace_back(1);
+
+	rfk::SmallVector<ConstructionTrackedClass, 2> vecMove = std::move(vec1);
+
+	EXPECT_TRUE(vec1.empty());
+	ASSERT_EQ(vecMove.size(), 1u);
+	EXPECT_TRUE(vecMove.isInline());
+	EXPECT_TRUE(vecMove.front().getMoveConstructed());
+	EXPECT_EQ(vecMove.front().getValue(), 1);
+}
+
+TEST(Rfk_SmallVector_ctor, MoveCtorAllocated)
+{
+	rfk::SmallVector<ConstructionTrackedClass, 1> vec1;
+
+	vec1.emplace_back(1);
+	vec1.emplace_back(2);
+
+	ConstructionTrackedClass const* data = vec1.data();
+
+	rfk::SmallVector<ConstructionTrackedClass, 1> vecMove = std::move(vec1);
+
+	EXPECT_TRUE(vec1.empty());
+	EXPECT_TRUE(vec1.isInline());
+	EXPECT_EQ(vecMove.data(), data);
+	EXPECT_EQ(vecMove.size(), 2u);
+}
+
+//=========================================================
+//=============== SmallVector::push_back ==================
+//=========================================================
+
+TEST(Rfk_SmallVector_push_back, StaysInlineUntilFull)
+{
+	rfk::SmallVector<std::string, 2> vec;
+
+	vec.push_back("a");
+	vec.push_back("b");
+
+	EXPECT_TRUE(vec.isInline());
+
+	vec.push_back("c");
+
+	EXPECT_FALSE(vec.isInline());
+	ASSERT_EQ(vec.size(), 3u);
+	EXPECT_EQ(vec[0], "a");
+	EXPECT_EQ(vec[1], "b");
+	EXPECT_EQ(vec[2], "c");
+}
+
+TEST(Rfk_SmallVector_push_back, NoInlineCapacity)
+{
+	rfk::SmallVector<int, 0> vec;
+
+	EXPECT_EQ(vec.capacity(), 0u);
+
+	vec.push_back(1);
+
+	EXPECT_FALSE(vec.isInline());
+	EXPECT_EQ(vec.back(), 1);
+}
+
+TEST(Rfk_SmallVector_push_back, OwnElementWhenFull)
+{
+	rfk::SmallVector<std::string, 2> vec;
+
+	vec.push_back("A string too long to be stored inline by std::string");
+	vec.push_back("b");
+
+	//The pushed element must be copied before the elements are relocated
+	vec.push_back(vec[0]);
+
+	ASSERT_EQ(vec.size(), 3u);
+	EXPECT_EQ(vec[2], vec[0]);
+
+	vec.emplace_back(vec[2]);
+
+	ASSERT_EQ(vec.size(), 4u);
+	EXPECT_EQ(vec[3], vec[0]);
+}
+
+//=========================================================
+//================ SmallVector::resize ====================
+//=========================================================
+
+TEST(Rfk_SmallVector_resize, GrowAndShrink)
+{
+	rfk::SmallVector<int, 2> vec;
+
+	vec.resize(4);
+
+	ASSERT_EQ(vec.size(), 4u);
+	EXPECT_EQ(vec[3], 0);
+
+	vec.resize(1);
+
+	EXPECT_EQ(vec.size(), 1u);
+	EXPECT_GE(vec.capacity(), 4u);
+}
+
+//=========================================================
+//============== SmallVector::operator= ===================
+//=========================================================
+
+TEST(Rfk_SmallVector_assignmentOperator, CopyAssignment)
+{
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec1;
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec2;
+
+	for (int i = 0; i < 3; i++)
+	{
+		vec1.emplace_back(i);
+	}
+	vec2.emplace_back(10);
+
+	vec2 = vec1;
+
+	ASSERT_EQ(vec2.size(), 3u);
+	EXPECT_EQ(vec2[2].getValue(), 2);
+}
+
+TEST(Rfk_SmallVector_assignmentOperator, MoveAssignment)
+{
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec1;
+	rfk::SmallVector<ConstructionTrackedClass, 2> vec2;
+
+	vec1.emplace_back(1);
+	for (int i = 0; i < 3; i++)
+	{
+		vec2.emplace_back(i);
+	}
+
+	vec2 = std::move(vec1);
+
+	EXPECT_TRUE(vec1.empty());
+	ASSERT_EQ(vec2.size(), 1u);
+	EXPECT_TRUE(vec2.isInline());
+	EXPECT_EQ(vec2.front().getValue(), 1);
+}
+
+TEST(Rfk_SmallVector_assignmentOperator, MoveAssignmentNonPropagatingAllocator)
+{
+	using Allocator = vector_tests::TrackingAllocator<int, false>;
+
+	int liveAllocations1 = 0;
+	int liveAllocations2 = 0;
+
+	{
+		rfk::SmallVector<int, 1, Allocator> vec1{Allocator(liveAllocations1)};
+		rfk::SmallVector<int, 1, Allocator> vec2{Allocator(liveAllocations2)};
+
+		for (int i = 0; i < 3; i++)
+		{
+			vec1.push_back(i);
+		}
+
+		vec2 = std::move(vec1);
+
+		//The memory of vec1 can't be stolen since vec2 keeps its own allocator
+		EXPECT_TRUE(vec2.get_allocator() == Allocator(liveAllocations2));
+		EXPECT_EQ(liveAllocations2, 1);
+		ASSERT_EQ(vec2.size(), 3u);
+		EXPECT_EQ(vec2[2], 2);
+		EXPECT_TRUE(vec1.empty());
+	}
+
+	EXPECT_EQ(liveAllocations1, 0);
+	EXPECT_EQ(liveAllocations2, 0);
+}
+
+TEST(Rfk_SmallVector_assignmentOperator, CopyAssignmentPropagatingAllocator)
+{
+	using Allocator = vector_tests::TrackingAllocator<int, true>;
+
+	int liveAllocations1 = 0;
+	int liveAllocations2 = 0;
+
+	{
+		rfk::SmallVector<int, 1, Allocator> vec1{Allocator(liveAllocations1)};
+		rfk::SmallVector<int, 1, Allocator> vec2{Allocator(liveAllocations2)};
+
+		for (int i = 0; i < 3; i++)
+		{
+			vec1.push_back(i);
+			vec2.push_back(i + 10);
+		}
+
+		vec2 = vec1;
+
+		EXPECT_TRUE(vec2.get_allocator() == Allocator(liveAllocations1));
+		EXPECT_EQ(liveAllocations1, 2);
+		EXPECT_EQ(liveAllocations2, 0);
+		ASSERT_EQ(vec2.size(), 3u);
+		EXPECT_EQ(vec2[2], 2);
+	}
+
+	EXPECT_EQ(liveAllocations1, 0);
+	EXPECT_EQ(liveAllocations2, 0);
+}
+
+//=========================================================
+//================= MemoryArena::reset ====================
+//=========================================================
+
+TEST(Rfk_MemoryArena_reset, ReuseChunks)
+{
+	rfk::MemoryArena arena(256u);
+
+	for (int i = 0; i < 64; i++)
+	{
+		(void)arena.allocate(sizeof(int) * 4, alignof(int));
+	}
+
+	std::size_t reservedBytes = arena.getReservedBytes();
+
+	for (int cycle = 0; cycle < 4; cycle++)
+	{
+		arena.reset();
+
+		for (int i = 0; i < 64; i++)
+		{
+			(void)arena.allocate(sizeof(int) * 4, alignof(int));
+		}
+	}
+
+	EXPECT_EQ(arena.getReservedBytes(), reservedBytes);
+}
+
+TEST(Rfk_MemoryArena_allocate, Alignment)
+{
+	rfk::MemoryArena arena(64u);
+
+	(void)arena.allocate(1u, 1u);
+
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arena.allocate(8u, 32u)) % 32u, 0u);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arena.allocate(1024u, 64u)) % 64u, 0u);
+}
+
+//=========================================================
+//============== ArenaAllocator::allocate =================
+//=========================================================
+
+TEST(Rfk_ArenaAllocator_allocate, SmallVectorSpill)
+{
+	rfk::MemoryArena arena;
+
+	rfk::SmallVector<int, 2, rfk::ArenaAllocator<int>> vec{rfk::ArenaAllocator<int>(arena)};
+
+	for (int i = 0; i < 32; i++)
+	{
+		vec.push_back(i);
+	}
+
+	EXPECT_FALSE(vec.isInline());
+	EXPECT_EQ(vec.back(), 31);
+	EXPECT_GT(arena.getReservedBytes(), 0u);
+}
+
+//=========================================================
+//========= Struct::getMethodsByName<N> (SmallVector) =====
+//=========================================================
+
+TEST(Rfk_Struct_getMethodsByNameSmallVector, FitsInline)
+{
+	rfk::SmallVector<rfk::Method const*, 2> methods = TestClass2::staticGetArchetype().getMethodsByName<2>("getIntField", rfk::EMethodFlags::Default, true);
+
+	EXPECT_TRUE(methods.isInline());
+	EXPECT_EQ(methods.size(), 2u);
+}
+
+TEST(Rfk_Struct_getMethodsByNameSmallVector, Spills)
+{
+	rfk::Vector<rfk::Method const*>			expected	= TestClass2::staticGetArchetype().getMethodsByName("getIntField", rfk::EMethodFlags::Default, true);
+	rfk::SmallVector<rfk::Method const*, 1>	methods		= TestClass2::staticGetArchetype().getMethodsByName<1>("getIntField", rfk::EMethodFlags::Default, true);
+
+	ASSERT_EQ(methods.size(), expected.size());
+	for (std::size_t i = 0u; i < expected.size(); i++)
+	{
+		EXPECT_EQ(methods[i], expected[i]);
+	}
+}
+
+TEST(Rfk_Struct_getMethodsByNameSmallVector, ArenaAllocator)
+{
+	rfk::MemoryArena arena;
+
+	auto methods = TestClass::staticGetArchetype().getMethodsByName<0>("getIntField", rfk::EMethodFlags::Default, false, rfk::ArenaAllocator<rfk::Method const*>(arena));
+
+	EXPECT_EQ(methods.size(), 2u);
+	EXPECT_GT(arena.getReservedBytes(), 0u);
+}
+
+//=========================================================
+//========== Enum::getEnumValues<N> (SmallVector) =========
+//=========================================================
+
+TEST(Rfk_Enum_getEnumValuesSmallVector, MultipleValues)
+{
+	auto enumValues = rfk::getEnum<TestEnumClass>()->getEnumValues<2>(1 << 2);
+
+	EXPECT_TRUE(enumValues.isInline());
+	EXPECT_EQ(enumValues.size(), 2u);
+}
\ No newline at end of file
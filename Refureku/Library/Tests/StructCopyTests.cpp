@@ -0,0 +1,408 @@
+#include <string>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+
+#include "TestModule.h"
+
+namespace struct_copy_tests
+{
+	struct Trivial
+	{
+		int		i;
+		float	f;
+	};
+
+	struct NonTrivial
+	{
+		static inline int	liveInstancesCount		= 0;
+		static inline int	throwAfterCopiesCount	= -1;
+
+		std::string	name = "default";
+
+		NonTrivial() noexcept
+		{
+			liveInstancesCount++;
+		}
+
+		NonTrivial(NonTrivial const& other):
+			name{other.name}
+		{
+			if (throwAfterCopiesCount == 0)
+			{
+				throw std::runtime_error("Copy failed");
+			}
+
+			throwAfterCopiesCount--;
+			liveInstancesCount++;
+		}
+
+		NonTrivial(NonTrivial&& other) noexcept:
+			name{std::move(other.name)}
+		{
+			liveInstancesCount++;
+		}
+
+		NonTrivial& operator=(NonTrivial const&)	= default;
+		NonTrivial& operator=(NonTrivial&&)			= default;
+
+		~NonTrivial() noexcept
+		{
+			liveInstancesCount--;
+		}
+	};
+
+	struct MoveOnly
+	{
+		std::unique_ptr<int> value;
+	};
+
+	/** Trivially copyable, but only movable. */
+	struct DeletedCopy
+	{
+		int	value = 0;
+
+		DeletedCopy()										= default;
+		DeletedCopy(DeletedCopy const&)						= delete;
+		DeletedCopy(DeletedCopy&&)							= default;
+		DeletedCopy& operator=(DeletedCopy const&)			= delete;
+		DeletedCopy& operator=(DeletedCopy&&)				= default;
+	};
+
+	template <typename T>
+	void registerCopyFunctions(rfk::Struct& archetype)
+	{
+		archetype.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<T>);
+		archetype.setMemoryAlignment(alignof(T));
+		archetype.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<T>());
+		archetype.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<T>());
+		archetype.setCopyAssignment(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<T>());
+		archetype.setMoveAssignment(rfk::internal::CodeGenerationHelpers::getDefaultMoveAssignment<T>());
+		archetype.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<T>());
+	}
+
+	struct CopyableStructs
+	{
+		rfk::Struct	trivial{"CopyTrivial", 5700001u, sizeof(Trivial), false};
+		rfk::Struct	nonTrivial{"CopyNonTrivial", 5700002u, sizeof(NonTrivial), false};
+		rfk::Struct	moveOnly{"CopyMoveOnly", 5700003u, sizeof(MoveOnly), false};
+
+		CopyableStructs()
+		{
+			registerCopyFunctions<Trivial>(trivial);
+			registerCopyFunctions<NonTrivial>(nonTrivial);
+			registerCopyFunctions<MoveOnly>(moveOnly);
+		}
+	};
+}
+
+//=========================================================
+//============ CodeGenerationHelpers traits ===============
+//=========================================================
+
+TEST(Rfk_CodeGenerationHelpers_computeStructTraits, ComputesTraits)
+{
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::computeStructTraits<struct_copy_tests::Trivial>(),
+			  rfk::EStructTraits::TriviallyCopyable | rfk::EStructTraits::TriviallyRelocatable |
+			  rfk::EStructTraits::TriviallyCopyConstructible | rfk::EStructTraits::TriviallyMoveConstructible |
+			  rfk::EStructTraits::TriviallyCopyAssignable | rfk::EStructTraits::TriviallyMoveAssignable);
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::computeStructTraits<struct_copy_tests::NonTrivial>(), rfk::EStructTraits::Default);
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::computeStructTraits<struct_copy_tests::MoveOnly>(), rfk::EStructTraits::Default);
+}
+
+TEST(Rfk_CodeGenerationHelpers_computeStructTraits, DeletedOperationsAreNotTrivial)
+{
+	static_assert(std::is_trivially_copyable_v<struct_copy_tests::DeletedCopy>);
+
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::computeStructTraits<struct_copy_tests::DeletedCopy>(),
+			  rfk::EStructTraits::TriviallyCopyable | rfk::EStructTraits::TriviallyRelocatable |
+			  rfk::EStructTraits::TriviallyMoveConstructible | rfk::EStructTraits::TriviallyMoveAssignable);
+}
+
+TEST(Rfk_CodeGenerationHelpers_getDefaultCopyConstructor, NullptrForNonCopyableClass)
+{
+	EXPECT_NE(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<struct_copy_tests::NonTrivial>(), nullptr);
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<struct_copy_tests::MoveOnly>(), nullptr);
+	EXPECT_EQ(rfk::internal::CodeGenerationHelpers::getDefaultCopyAssignment<struct_copy_tests::MoveOnly>(), nullptr);
+	EXPECT_NE(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<struct_copy_tests::MoveOnly>(), nullptr);
+}
+
+//=========================================================
+//================= Struct::copyConstructAt ===============
+//=========================================================
+
+TEST(Rfk_Struct_copyConstructAt, TriviallyCopyableStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	struct_copy_tests::Trivial source[3] = {{1, 1.0f}, {2, 2.0f}, {3, 3.0f}};
+	struct_copy_tests::Trivial destination[3];
+
+	//No copy constructor is needed for trivially copyable structs
+	structs.trivial.setCopyConstructor(nullptr);
+
+	EXPECT_TRUE(structs.trivial.copyConstructAt(destination, source, 3u));
+
+	for (int i = 0; i < 3; i++)
+	{
+		EXPECT_EQ(destination[i].i, i + 1);
+		EXPECT_EQ(destination[i].f, static_cast<float>(i + 1));
+	}
+}
+
+TEST(Rfk_Struct_copyConstructAt, NonTrivialStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	{
+		std::vector<struct_copy_tests::NonTrivial> source(4u);
+		source[2].name = "copied";
+
+		alignas(struct_copy_tests::NonTrivial) unsigned char destination[4u * sizeof(struct_copy_tests::NonTrivial)];
+
+		EXPECT_TRUE(structs.nonTrivial.copyConstructAt(destination, source.data(), 4u));
+		EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 8);
+		EXPECT_EQ(reinterpret_cast<struct_copy_tests::NonTrivial*>(destination)[2].name, "copied");
+		EXPECT_EQ(source[2].name, "copied");
+
+		for (std::size_t i = 0u; i < 4u; i++)
+		{
+			structs.nonTrivial.destroyInstanceAt(destination + i * sizeof(struct_copy_tests::NonTrivial));
+		}
+	}
+
+	EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 0);
+}
+
+TEST(Rfk_Struct_copyConstructAt, ThrowingCopyDestroysCopies)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	{
+		std::vector<struct_copy_tests::NonTrivial> source(4u);
+
+		alignas(struct_copy_tests::NonTrivial) unsigned char destination[4u * sizeof(struct_copy_tests::NonTrivial)];
+
+		struct_copy_tests::NonTrivial::throwAfterCopiesCount = 2;
+
+		EXPECT_THROW(static_cast<void>(structs.nonTrivial.copyConstructAt(destination, source.data(), 4u)), std::runtime_error);
+
+		struct_copy_tests::NonTrivial::throwAfterCopiesCount = -1;
+
+		//Only the source instances are alive
+		EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 4);
+	}
+
+	EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 0);
+}
+
+TEST(Rfk_Struct_copyConstructAt, NonCopyableStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	struct_copy_tests::MoveOnly source;
+
+	alignas(struct_copy_tests::MoveOnly) unsigned char destination[sizeof(struct_copy_tests::MoveOnly)];
+
+	EXPECT_FALSE(structs.moveOnly.copyConstructAt(destination, &source));
+}
+
+TEST(Rfk_Struct_copyConstructAt, LibraryProperty)
+{
+	rfk::Class const& propertySettingsArchetype = rfk::PropertySettings::staticGetArchetype();
+
+	rfk::PropertySettings source(rfk::EEntityKind::Field);
+
+	alignas(rfk::PropertySettings) unsigned char destination[sizeof(rfk::PropertySettings)];
+
+	//Polymorphic properties are not trivially copyable, so the copy relies on the registered copy constructor
+	EXPECT_EQ(propertySettingsArchetype.getTraits(), rfk::EStructTraits::Default);
+	EXPECT_EQ(propertySettingsArchetype.getMemoryAlignment(), alignof(rfk::PropertySettings));
+	ASSERT_TRUE(propertySettingsArchetype.copyConstructAt(destination, &source));
+	EXPECT_EQ(&reinterpret_cast<rfk::PropertySettings*>(destination)->getArchetype(), &propertySettingsArchetype);
+
+	propertySettingsArchetype.destroyInstanceAt(destination);
+}
+
+TEST(Rfk_Struct_copyConstructAt, TriviallyCopyableStructWithDeletedCopy)
+{
+	rfk::Struct archetype("CopyDeletedCopy", generateTestEntityId(), sizeof(struct_copy_tests::DeletedCopy), false);
+	struct_copy_tests::registerCopyFunctions<struct_copy_tests::DeletedCopy>(archetype);
+
+	struct_copy_tests::DeletedCopy source[2];
+	struct_copy_tests::DeletedCopy destination[2];
+	source[0].value = 1;
+	source[1].value = 2;
+
+	//The struct is trivially copyable, but copying it is still forbidden
+	EXPECT_FALSE(archetype.copyConstructAt(destination, source, 2u));
+	EXPECT_FALSE(archetype.copyAssign(destination, source, 2u));
+	EXPECT_EQ(destination[0].value, 0);
+
+	EXPECT_TRUE(archetype.moveConstructAt(destination, source, 2u));
+	EXPECT_EQ(destination[1].value, 2);
+
+	source[1].value = 3;
+
+	EXPECT_TRUE(archetype.moveAssign(destination, source, 2u));
+	EXPECT_EQ(destination[1].value, 3);
+}
+
+//=========================================================
+//================= Struct::moveConstructAt ===============
+//=========================================================
+
+TEST(Rfk_Struct_moveConstructAt, MoveOnlyStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	struct_copy_tests::MoveOnly source{std::make_unique<int>(42)};
+
+	alignas(struct_copy_tests::MoveOnly) unsigned char destination[sizeof(struct_copy_tests::MoveOnly)];
+
+	ASSERT_TRUE(structs.moveOnly.moveConstructAt(destination, &source));
+
+	struct_copy_tests::MoveOnly* moved = reinterpret_cast<struct_copy_tests::MoveOnly*>(destination);
+
+	EXPECT_EQ(*moved->value, 42);
+	EXPECT_EQ(source.value, nullptr);
+
+	structs.moveOnly.destroyInstanceAt(destination);
+}
+
+//=========================================================
+//==================== Struct::relocateAt =================
+//=========================================================
+
+TEST(Rfk_Struct_relocateAt, NonTrivialStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	alignas(struct_copy_tests::NonTrivial) unsigned char source[2u * sizeof(struct_copy_tests::NonTrivial)];
+	alignas(struct_copy_tests::NonTrivial) unsigned char destination[2u * sizeof(struct_copy_tests::NonTrivial)];
+
+	new (source) struct_copy_tests::NonTrivial();
+	new (source + sizeof(struct_copy_tests::NonTrivial)) struct_copy_tests::NonTrivial();
+	reinterpret_cast<struct_copy_tests::NonTrivial*>(source)[1].name = "relocated";
+
+	ASSERT_TRUE(structs.nonTrivial.relocateAt(destination, source, 2u));
+
+	//The source instances were destroyed
+	EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 2);
+	EXPECT_EQ(reinterpret_cast<struct_copy_tests::NonTrivial*>(destination)[1].name, "relocated");
+
+	structs.nonTrivial.destroyInstanceAt(destination);
+	structs.nonTrivial.destroyInstanceAt(destination + sizeof(struct_copy_tests::NonTrivial));
+
+	EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 0);
+}
+
+TEST(Rfk_Struct_relocateAt, ManuallyTriviallyRelocatableStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	//std::unique_ptr can be relocated with a memcpy
+	structs.moveOnly.setTraits(rfk::EStructTraits::TriviallyRelocatable);
+	structs.moveOnly.setMoveConstructor(nullptr);
+
+	alignas(struct_copy_tests::MoveOnly) unsigned char source[sizeof(struct_copy_tests::MoveOnly)];
+	alignas(struct_copy_tests::MoveOnly) unsigned char destination[sizeof(struct_copy_tests::MoveOnly)];
+
+	new (source) struct_copy_tests::MoveOnly{std::make_unique<int>(7)};
+
+	ASSERT_TRUE(structs.moveOnly.relocateAt(destination, source));
+	EXPECT_EQ(*reinterpret_cast<struct_copy_tests::MoveOnly*>(destination)->value, 7);
+
+	structs.moveOnly.destroyInstanceAt(destination);
+}
+
+TEST(Rfk_Struct_relocateAt, NonMovableStruct)
+{
+	rfk::Struct archetype("CopyNonMovable", 5700010u, sizeof(int), false);
+
+	int source		= 0;
+	int destination	= 0;
+
+	EXPECT_FALSE(archetype.relocateAt(&destination, &source));
+}
+
+//=========================================================
+//============= Struct::copyAssign / moveAssign ===========
+//=========================================================
+
+TEST(Rfk_Struct_copyAssign, NonTrivialStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	std::vector<struct_copy_tests::NonTrivial> source(2u);
+	std::vector<struct_copy_tests::NonTrivial> destination(2u);
+
+	source[0].name = "first";
+	source[1].name = "second";
+
+	ASSERT_TRUE(structs.nonTrivial.copyAssign(destination.data(), source.data(), 2u));
+
+	EXPECT_EQ(destination[0].name, "first");
+	EXPECT_EQ(destination[1].name, "second");
+	EXPECT_EQ(source[1].name, "second");
+}
+
+TEST(Rfk_Struct_moveAssign, MoveOnlyStruct)
+{
+	struct_copy_tests::CopyableStructs structs;
+
+	struct_copy_tests::MoveOnly source{std::make_unique<int>(3)};
+	struct_copy_tests::MoveOnly destination;
+
+	EXPECT_FALSE(structs.moveOnly.copyAssign(&destination, &source));
+	ASSERT_TRUE(structs.moveOnly.moveAssign(&destination, &source));
+
+	EXPECT_EQ(*destination.value, 3);
+	EXPECT_EQ(source.value, nullptr);
+}
+
+//=========================================================
+//=============== StructPool::makeUniqueCopy ==============
+//=========================================================
+
+TEST(Rfk_StructPool_makeUniqueCopy, CopiesInstance)
+{
+	struct_copy_tests::CopyableStructs	structs;
+	rfk::StructPool						pool(structs.nonTrivial, 4u);
+
+	{
+		struct_copy_tests::NonTrivial prefab;
+		prefab.name = "prefab";
+
+		rfk::PooledPtr<struct_copy_tests::NonTrivial> copy = pool.makeUniqueCopy<struct_copy_tests::NonTrivial>(&prefab);
+
+		ASSERT_NE(copy, nullptr);
+		EXPECT_EQ(copy->name, "prefab");
+		EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 2);
+	}
+
+	EXPECT_EQ(struct_copy_tests::NonTrivial::liveInstancesCount, 0);
+}
+
+TEST(Rfk_StructPool_makeUniqueCopy, NonCopyableStruct)
+{
+	struct_copy_tests::CopyableStructs	structs;
+	rfk::StructPool						pool(structs.moveOnly, 4u);
+
+	struct_copy_tests::MoveOnly prefab;
+
+	void* slot = pool.allocate();
+	pool.deallocate(slot);
+
+	EXPECT_EQ(pool.makeUniqueCopy<struct_copy_tests::MoveOnly>(&prefab), nullptr);
+
+	//The slot was given back to the pool
+	EXPECT_EQ(pool.allocate(), slot);
+
+	pool.deallocate(slot);
+}
\ No newline at end of file
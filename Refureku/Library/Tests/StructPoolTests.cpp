@@ -0,0 +1,361 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstdint>	//std::uintptr_t
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+
+#include "ConstructionTrackedClass.h"
+#include "TestClass.h"
+#include "TestModule.h"
+
+namespace struct_pool_tests
+{
+	struct Counted
+	{
+		static inline std::atomic<int>	liveInstancesCount{0};
+
+		int value = 42;
+
+		Counted() noexcept
+		{
+			liveInstancesCount++;
+		}
+
+		Counted(int v) noexcept:
+			value{v}
+		{
+			liveInstancesCount++;
+		}
+
+		~Counted() noexcept
+		{
+			liveInstancesCount--;
+		}
+	};
+
+	struct alignas(64) Aligned
+	{
+		char c = 'a';
+	};
+
+	void* makeCountedWithValue(void* memory, int value)
+	{
+		return new (memory) Counted(value);
+	}
+
+	/**
+	*	Manually reflected structs counting their live instances, with a placement instantiator taking arguments and an over-aligned struct.
+	*/
+	struct PooledStructs
+	{
+		rfk::Struct			counted{"PooledCounted", generateTestEntityId(), sizeof(Counted), false};
+		rfk::StaticMethod	countedDefaultInstantiator{"", generateTestEntityId(), rfk::getType<void*>(),
+													   new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Counted>),
+													   rfk::EMethodFlags::Default, nullptr};
+		rfk::StaticMethod	countedValueInstantiator{"", generateTestEntityId(), rfk::getType<void*>(),
+													 new rfk::NonMemberFunction<void*(void*, int)>(&makeCountedWithValue),
+													 rfk::EMethodFlags::Default, nullptr};
+
+		rfk::Struct			aligned{"PooledAligned", generateTestEntityId(), sizeof(Aligned), false};
+		rfk::StaticMethod	alignedDefaultInstantiator{"", generateTestEntityId(), rfk::getType<void*>(),
+													   new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Aligned>),
+													   rfk::EMethodFlags::Default, nullptr};
+
+		PooledStructs()
+		{
+			countedDefaultInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+			countedValueInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+			countedValueInstantiator.addParameter("value", 0u, rfk::getType<int>());
+
+			counted.addPlacementInstantiator(countedValueInstantiator);
+			counted.addPlacementInstantiator(countedDefaultInstantiator);
+			counted.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<Counted>);
+			counted.setMemoryAlignment(alignof(Counted));
+
+			alignedDefaultInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+
+			aligned.addPlacementInstantiator(alignedDefaultInstantiator);
+			aligned.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<Aligned>);
+			aligned.setMemoryAlignment(alignof(Aligned));
+		}
+	};
+}
+
+//=========================================================
+//================ Struct::makeInstanceAt =================
+//=========================================================
+
+TEST(Rfk_Struct_makeInstanceAt, DefaultPlacementInstantiator)
+{
+	rfk::Class const& archetype = ConstructionTrackedClass::staticGetArchetype();
+
+	alignas(ConstructionTrackedClass) unsigned char memory[sizeof(ConstructionTrackedClass)];
+
+	ConstructionTrackedClass* instance = archetype.makeInstanceAt<ConstructionTrackedClass>(memory);
+
+	ASSERT_NE(instance, nullptr);
+	EXPECT_EQ(static_cast<void*>(instance), static_cast<void*>(memory));
+	EXPECT_TRUE(instance->getDefaultConstructed());
+	EXPECT_EQ(instance->getValue(), 0);
+	EXPECT_EQ(archetype.getMemoryAlignment(), alignof(ConstructionTrackedClass));
+
+	archetype.destroyInstanceAt(memory);
+}
+
+TEST(Rfk_Struct_makeInstanceAt, DestroysInstance)
+{
+	struct_pool_tests::PooledStructs structs;
+
+	alignas(struct_pool_tests::Counted) unsigned char memory[sizeof(struct_pool_tests::Counted)];
+
+	struct_pool_tests::Counted* instance = structs.counted.makeInstanceAt<struct_pool_tests::Counted>(memory);
+
+	ASSERT_NE(instance, nullptr);
+	EXPECT_EQ(instance->value, 42);
+	EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 1);
+
+	structs.counted.destroyInstanceAt(memory);
+
+	EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 0);
+}
+
+TEST(Rfk_Struct_makeInstanceAt, PlacementInstantiatorWithArgs)
+{
+	struct_pool_tests::PooledStructs structs;
+
+	alignas(struct_pool_tests::Counted) unsigned char memory[sizeof(struct_pool_tests::Counted)];
+
+	struct_pool_tests::Counted* instance = structs.counted.makeInstanceAt<struct_pool_tests::Counted>(memory, 7);
+
+	ASSERT_NE(instance, nullptr);
+	EXPECT_EQ(instance->value, 7);
+
+	structs.counted.destroyInstanceAt(memory);
+}
+
+TEST(Rfk_Struct_makeInstanceAt, InexistantPlacementInstantiator)
+{
+	struct_pool_tests::PooledStructs structs;
+
+	alignas(struct_pool_tests::Counted) unsigned char memory[sizeof(struct_pool_tests::Counted)];
+
+	EXPECT_EQ(structs.counted.makeInstanceAt<struct_pool_tests::Counted>(memory, 3.14f), nullptr);
+	EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 0);
+}
+
+//=========================================================
+//============== StructPool::makeUniqueInstance ===========
+//=========================================================
+
+TEST(Rfk_StructPool_makeUniqueInstance, ConstructsAndDestroysInstances)
+{
+	struct_pool_tests::PooledStructs	structs;
+	rfk::StructPool						pool(structs.counted, 4u);
+
+	{
+		rfk::PooledPtr<struct_pool_tests::Counted> instance = pool.makeUniqueInstance<struct_pool_tests::Counted>(5);
+
+		ASSERT_NE(instance, nullptr);
+		EXPECT_EQ(instance->value, 5);
+		EXPECT_EQ(instance.get_deleter().getPool(), &pool);
+		EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 1);
+	}
+
+	EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 0);
+}
+
+TEST(Rfk_StructPool_makeUniqueInstance, ReusesSlots)
+{
+	rfk::StructPool pool(ConstructionTrackedClass::staticGetArchetype(), 4u);
+
+	void* firstSlot = pool.makeUniqueInstance<ConstructionTrackedClass>().get();
+
+	//The slot released by the first instance is the first to be reused
+	EXPECT_EQ(pool.makeUniqueInstance<ConstructionTrackedClass>().get(), firstSlot);
+	EXPECT_EQ(pool.getSlabsCount(), 1u);
+	EXPECT_EQ(pool.getCapacity(), 4u);
+}
+
+TEST(Rfk_StructPool_makeUniqueInstance, GrowsBySlabs)
+{
+	struct_pool_tests::PooledStructs							structs;
+	rfk::StructPool												pool(structs.counted, 4u);
+	std::vector<rfk::PooledPtr<struct_pool_tests::Counted>>	instances;
+
+	for (int i = 0; i < 10; i++)
+	{
+		instances.push_back(pool.makeUniqueInstance<struct_pool_tests::Counted>(int{i}));
+	}
+
+	EXPECT_EQ(pool.getSlabsCount(), 3u);
+	EXPECT_EQ(pool.getCapacity(), 12u);
+
+	for (int i = 0; i < 10; i++)
+	{
+		EXPECT_EQ(instances[i]->value, i);
+	}
+}
+
+TEST(Rfk_StructPool_makeUniqueInstance, ReusesSlotsAfterUsingManyPools)
+{
+	struct_pool_tests::PooledStructs	structs;
+	rfk::StructPool						pool(structs.counted, 4u);
+
+	EXPECT_NE(pool.makeUniqueInstance<struct_pool_tests::Counted>(), nullptr);
+
+	//Use more pools than a thread caches so that the free list of the first pool is evicted
+	std::vector<std::unique_ptr<rfk::StructPool>> otherPools;
+
+	for (int i = 0; i < 16; i++)
+	{
+		otherPools.push_back(std::make_unique<rfk::StructPool>(structs.counted, 4u));
+		EXPECT_NE(otherPools.back()->makeUniqueInstance<struct_pool_tests::Counted>(), nullptr);
+	}
+
+	//The evicted free list was given back to the pool depot
+	std::vector<rfk::PooledPtr<struct_pool_tests::Counted>> instances;
+
+	for (int i = 0; i < 4; i++)
+	{
+		instances.push_back(pool.makeUniqueInstance<struct_pool_tests::Counted>(int{i}));
+	}
+
+	EXPECT_EQ(pool.getSlabsCount(), 1u);
+}
+
+TEST(Rfk_StructPool_makeUniqueInstance, InexistantPlacementInstantiator)
+{
+	struct_pool_tests::PooledStructs	structs;
+	rfk::StructPool						pool(structs.counted, 4u);
+
+	void* slot = pool.allocate();
+	pool.deallocate(slot);
+
+	EXPECT_EQ(pool.makeUniqueInstance<struct_pool_tests::Counted>(3.14f), nullptr);
+
+	//The slot was given back to the pool
+	EXPECT_EQ(pool.allocate(), slot);
+
+	pool.deallocate(slot);
+}
+
+//=========================================================
+//================ StructPool::getSlotSize ================
+//=========================================================
+
+TEST(Rfk_StructPool_getSlotSize, RespectsAlignment)
+{
+	struct_pool_tests::PooledStructs	structs;
+	rfk::StructPool						pool(structs.aligned, 4u);
+
+	EXPECT_EQ(pool.getSlotSize(), 64u);
+
+	std::vector<rfk::PooledPtr<struct_pool_tests::Aligned>> instances;
+
+	for (int i = 0; i < 6; i++)
+	{
+		instances.push_back(pool.makeUniqueInstance<struct_pool_tests::Aligned>());
+
+		ASSERT_NE(instances.back(), nullptr);
+		EXPECT_EQ(reinterpret_cast<std::uintptr_t>(instances.back().get()) % alignof(struct_pool_tests::Aligned), 0u);
+		EXPECT_EQ(instances.back()->c, 'a');
+	}
+}
+
+TEST(Rfk_StructPool_getSlotSize, HoldsAFreeListLink)
+{
+	rfk::Struct		tiny("PooledTiny", generateTestEntityId(), 1u, false);
+	rfk::StructPool	pool(tiny, 4u);
+
+	EXPECT_GE(pool.getSlotSize(), sizeof(void*));
+}
+
+//=========================================================
+//=================== Multithreaded churn =================
+//=========================================================
+
+TEST(Rfk_StructPool, MultithreadedChurn)
+{
+	struct_pool_tests::PooledStructs	structs;
+	rfk::StructPool						pool(structs.counted, 16u);
+
+	constexpr int threadsCount			= 4;
+	constexpr int iterationsCount		= 2000;
+	constexpr int instancesPerIteration	= 8;
+
+	//Instances made by each thread are destroyed by the next thread to exercise cross-thread deallocations
+	std::vector<std::vector<rfk::PooledPtr<struct_pool_tests::Counted>>> handOff(threadsCount);
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < threadsCount; t++)
+	{
+		threads.emplace_back([&pool, &handOff, t]()
+							 {
+								 for (int i = 0; i < iterationsCount; i++)
+								 {
+									 for (int j = 0; j < instancesPerIteration; j++)
+									 {
+										 rfk::PooledPtr<struct_pool_tests::Counted> instance = pool.makeUniqueInstance<struct_pool_tests::Counted>(int{t});
+
+										 ASSERT_NE(instance, nullptr);
+										 ASSERT_EQ(instance->value, t);
+									 }
+								 }
+
+								 for (int j = 0; j < instancesPerIteration * 4; j++)
+								 {
+									 handOff[t].push_back(pool.makeUniqueInstance<struct_pool_tests::Counted>(int{t}));
+								 }
+							 });
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	threads.clear();
+
+	for (int t = 0; t < threadsCount; t++)
+	{
+		threads.emplace_back([&handOff, t]()
+							 {
+								 handOff[(t + 1) % threadsCount].clear();
+							 });
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(struct_pool_tests::Counted::liveInstancesCount, 0);
+
+	//Slots given back by the exited threads are reused instead of allocating new slabs
+	std::size_t capacity = pool.getCapacity();
+
+	std::vector<rfk::PooledPtr<struct_pool_tests::Counted>> instances;
+	for (std::size_t i = 0u; i < capacity; i++)
+	{
+		instances.push_back(pool.makeUniqueInstance<struct_pool_tests::Counted>());
+	}
+
+	EXPECT_EQ(pool.getCapacity(), capacity);
+}
+
+//=========================================================
+//==================== getStructPool ======================
+//=========================================================
+
+TEST(Rfk_getStructPool, ReturnsSharedPool)
+{
+	//Shared pools live until the program exits, so must their struct
+	rfk::Class const& archetype = TestClass::staticGetArchetype();
+
+	EXPECT_EQ(&rfk::getStructPool(archetype), &rfk::getStructPool(archetype));
+	EXPECT_EQ(&rfk::getStructPool(archetype).getArchetype(), &archetype);
+}
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+#include <Refureku/Misc/CodeGenerationHelpers.h>
+
+namespace struct_storage_tests
+{
+	struct Particle
+	{
+		float	position[3]	= {0.0f, 0.0f, 0.0f};
+		float	speed		= 1.0f;
+		int		lifetime	= 100;
+	};
+
+	struct Named
+	{
+		static inline int	liveInstancesCount = 0;
+
+		std::string	name	= "default";
+		int			value	= 0;
+
+		Named() noexcept
+		{
+			liveInstancesCount++;
+		}
+
+		Named(Named const& other):
+			name{other.name},
+			value{other.value}
+		{
+			liveInstancesCount++;
+		}
+
+		Named(Named&& other) noexcept:
+			name{std::move(other.name)},
+			value{other.value}
+		{
+			liveInstancesCount++;
+		}
+
+		~Named() noexcept
+		{
+			liveInstancesCount--;
+		}
+	};
+
+	void* makeParticleWithSpeed(void* memory, float speed)
+	{
+		Particle* particle = new (memory) Particle();
+		particle->speed = speed;
+
+		return particle;
+	}
+
+	template <typename T>
+	void registerLifetimeFunctions(rfk::Struct& archetype, rfk::StaticMethod& defaultInstantiator)
+	{
+		defaultInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+
+		archetype.addPlacementInstantiator(defaultInstantiator);
+		archetype.setDestructor(&rfk::internal::CodeGenerationHelpers::defaultDestructor<T>);
+		archetype.setMemoryAlignment(alignof(T));
+		archetype.setCopyConstructor(rfk::internal::CodeGenerationHelpers::getDefaultCopyConstructor<T>());
+		archetype.setMoveConstructor(rfk::internal::CodeGenerationHelpers::getDefaultMoveConstructor<T>());
+		archetype.setTraits(rfk::internal::CodeGenerationHelpers::computeStructTraits<T>());
+	}
+
+	struct StoredStructs
+	{
+		rfk::Struct			particle{"StoredParticle", 5800001u, sizeof(Particle), false};
+		rfk::StaticMethod	particleDefaultInstantiator{"", 5800002u, rfk::getType<void*>(),
+														new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Particle>),
+														rfk::EMethodFlags::Default, nullptr};
+		rfk::StaticMethod	particleSpeedInstantiator{"", 5800003u, rfk::getType<void*>(),
+													  new rfk::NonMemberFunction<void*(void*, float)>(&makeParticleWithSpeed),
+													  rfk::EMethodFlags::Default, nullptr};
+		rfk::Field const*	position;
+		rfk::Field const*	speed;
+		rfk::Field const*	lifetime;
+
+		rfk::Struct			named{"StoredNamed", 5800010u, sizeof(Named), false};
+		rfk::StaticMethod	namedDefaultInstantiator{"", 5800011u, rfk::getType<void*>(),
+													 new rfk::NonMemberFunction<void*(void*)>(&rfk::internal::CodeGenerationHelpers::defaultPlacementInstantiator<Named>),
+													 rfk::EMethodFlags::Default, nullptr};
+		rfk::Field const*	name;
+		rfk::Field const*	value;
+
+		StoredStructs()
+		{
+			registerLifetimeFunctions<Particle>(particle, particleDefaultInstantiator);
+
+			particleSpeedInstantiator.addParameter("memory", 0u, rfk::getType<void*>());
+			particleSpeedInstantiator.addParameter("speed", 0u, rfk::getType<float>());
+			particle.addPlacementInstantiator(particleSpeedInstantiator);
+
+			//Add the fields out of order to check that the SoA columns don't depend on the registration order
+			lifetime	= particle.addField("lifetime", 5800004u, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(Particle, lifetime), &particle);
+			position	= particle.addField("position", 5800005u, rfk::getType<float[3]>(), rfk::EFieldFlags::Public, offsetof(Particle, position), &particle);
+			speed		= particle.addField("speed", 5800006u, rfk::getType<float>(), rfk::EFieldFlags::Public, offsetof(Particle, speed), &particle);
+
+			registerLifetimeFunctions<Named>(named, namedDefaultInstantiator);
+
+			name	= named.addField("name", 5800012u, rfk::getType<std::string>(), rfk::EFieldFlags::Public, offsetof(Named, name), &named);
+			value	= named.addField("value", 5800013u, rfk::getType<int>(), rfk::EFieldFlags::Public, offsetof(Named, value), &named);
+		}
+	};
+}
+
+//=========================================================
+//============ StructStorage::isLayoutSupported ===========
+//=========================================================
+
+TEST(Rfk_StructStorage_isLayoutSupported, AoSAlwaysSupported)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	EXPECT_TRUE(rfk::StructStorage::isLayoutSupported(structs.particle, rfk::EStructStorageLayout::AoS));
+	EXPECT_TRUE(rfk::StructStorage::isLayoutSupported(structs.named, rfk::EStructStorageLayout::AoS));
+}
+
+TEST(Rfk_StructStorage_isLayoutSupported, SoARequiresTriviallyCopyableStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	EXPECT_TRUE(rfk::StructStorage::isLayoutSupported(structs.particle, rfk::EStructStorageLayout::SoA));
+	EXPECT_FALSE(rfk::StructStorage::isLayoutSupported(structs.named, rfk::EStructStorageLayout::SoA));
+
+	//Unsupported layouts fall back to AoS
+	rfk::StructStorage storage(structs.named, rfk::EStructStorageLayout::SoA);
+
+	EXPECT_EQ(storage.getLayout(), rfk::EStructStorageLayout::AoS);
+}
+
+TEST(Rfk_StructStorage_isLayoutSupported, SoARequiresKnownFieldSizes)
+{
+	struct Referencing
+	{
+		int& reference;
+	};
+
+	rfk::Struct archetype("StoredReferencing", 5800020u, sizeof(Referencing), false);
+	archetype.setTraits(rfk::EStructTraits::TriviallyCopyable);
+	archetype.addField("reference", 5800021u, rfk::getType<int&>(), rfk::EFieldFlags::Public, 0u, &archetype);
+
+	EXPECT_FALSE(rfk::StructStorage::isLayoutSupported(archetype, rfk::EStructStorageLayout::SoA));
+}
+
+//=========================================================
+//=============== StructStorage::emplaceBack ==============
+//=========================================================
+
+TEST(Rfk_StructStorage_emplaceBack, FillsChunks)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	for (rfk::EStructStorageLayout layout : {rfk::EStructStorageLayout::AoS, rfk::EStructStorageLayout::SoA})
+	{
+		rfk::StructStorage storage(structs.particle, layout, 4u);
+
+		for (int i = 0; i < 10; i++)
+		{
+			EXPECT_TRUE(storage.emplaceBack(static_cast<float>(i)));
+		}
+
+		EXPECT_EQ(storage.getLayout(), layout);
+		EXPECT_EQ(storage.getInstancesCount(), 10u);
+		EXPECT_EQ(storage.getChunksCount(), 3u);
+		EXPECT_EQ(storage.getChunkSize(0u), 4u);
+		EXPECT_EQ(storage.getChunkSize(2u), 2u);
+		EXPECT_EQ(storage.getChunkSize(3u), 0u);
+
+		for (std::size_t i = 0u; i < 10u; i++)
+		{
+			EXPECT_EQ(*static_cast<float*>(storage.getFieldAt(*structs.speed, i)), static_cast<float>(i));
+			EXPECT_EQ(*static_cast<int*>(storage.getFieldAt(*structs.lifetime, i)), 100);
+		}
+	}
+}
+
+TEST(Rfk_StructStorage_emplaceBack, InexistantPlacementInstantiator)
+{
+	struct_storage_tests::StoredStructs	structs;
+	rfk::StructStorage					storage(structs.particle);
+
+	EXPECT_FALSE(storage.emplaceBack(1));
+	EXPECT_EQ(storage.getInstancesCount(), 0u);
+}
+
+TEST(Rfk_StructStorage_emplaceBack, NonTrivialStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	{
+		rfk::StructStorage storage(structs.named, rfk::EStructStorageLayout::AoS, 2u);
+
+		for (int i = 0; i < 5; i++)
+		{
+			ASSERT_TRUE(storage.emplaceBack());
+		}
+
+		EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 5);
+		EXPECT_EQ(static_cast<struct_storage_tests::Named*>(storage.getInstanceAt(4u))->name, "default");
+		EXPECT_EQ(*static_cast<std::string*>(storage.getFieldAt(*structs.name, 3u)), "default");
+	}
+
+	//The storage destroys its instances
+	EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 0);
+}
+
+//=========================================================
+//=============== StructStorage::getFieldSpan =============
+//=========================================================
+
+TEST(Rfk_StructStorage_getFieldSpan, SoAFieldsAreContiguous)
+{
+	struct_storage_tests::StoredStructs	structs;
+	rfk::StructStorage					storage(structs.particle, rfk::EStructStorageLayout::SoA, 8u);
+
+	for (int i = 0; i < 6; i++)
+	{
+		storage.emplaceBack(static_cast<float>(i));
+	}
+
+	rfk::StridedSpan<float> speeds = storage.getFieldSpan<float>(*structs.speed, 0u);
+
+	ASSERT_EQ(speeds.size(), 6u);
+	EXPECT_TRUE(speeds.isContiguous());
+
+	rfk::Span<float> contiguousSpeeds = speeds.toSpan();
+
+	for (std::size_t i = 0u; i < contiguousSpeeds.size(); i++)
+	{
+		EXPECT_EQ(contiguousSpeeds[i], static_cast<float>(i));
+	}
+
+	//C-style array fields are stored as a whole
+	rfk::StridedSpan<float[3]> positions = storage.getFieldSpan<float[3]>(*structs.position, 0u);
+
+	EXPECT_EQ(positions.getStride(), sizeof(float[3]));
+	positions[5][2] = 42.0f;
+
+	EXPECT_EQ(static_cast<float*>(storage.getFieldAt(*structs.position, 5u))[2], 42.0f);
+}
+
+TEST(Rfk_StructStorage_getFieldSpan, AoSFieldsAreStrided)
+{
+	struct_storage_tests::StoredStructs	structs;
+	rfk::StructStorage					storage(structs.particle, rfk::EStructStorageLayout::AoS, 8u);
+
+	for (int i = 0; i < 6; i++)
+	{
+		storage.emplaceBack(static_cast<float>(i));
+	}
+
+	rfk::StridedSpan<float> speeds = storage.getFieldSpan<float>(*structs.speed, 0u);
+
+	ASSERT_EQ(speeds.size(), 6u);
+	EXPECT_FALSE(speeds.isContiguous());
+	EXPECT_EQ(speeds.getStride(), sizeof(struct_storage_tests::Particle));
+
+	float expected = 0.0f;
+	for (float speed : speeds)
+	{
+		EXPECT_EQ(speed, expected);
+		expected += 1.0f;
+	}
+
+	EXPECT_EQ(&speeds[3], &static_cast<struct_storage_tests::Particle*>(storage.getInstanceAt(3u))->speed);
+}
+
+TEST(Rfk_StructStorage_getFieldSpan, FieldOfAnotherStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	for (rfk::EStructStorageLayout layout : {rfk::EStructStorageLayout::AoS, rfk::EStructStorageLayout::SoA})
+	{
+		rfk::StructStorage storage(structs.particle, layout);
+
+		storage.emplaceBack();
+
+		EXPECT_TRUE(storage.getFieldSpan<int>(*structs.value, 0u).empty());
+		EXPECT_EQ(storage.getFieldAt(*structs.value, 0u), nullptr);
+	}
+}
+
+TEST(Rfk_StructStorage_foreachFieldSpan, VisitsAllChunks)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	for (rfk::EStructStorageLayout layout : {rfk::EStructStorageLayout::AoS, rfk::EStructStorageLayout::SoA})
+	{
+		rfk::StructStorage storage(structs.particle, layout, 3u);
+
+		for (int i = 0; i < 10; i++)
+		{
+			storage.emplaceBack(static_cast<float>(i));
+		}
+
+		float		speedsSum	= 0.0f;
+		std::size_t	chunksCount	= 0u;
+
+		storage.foreachFieldSpan<float const>(*structs.speed, [&speedsSum, &chunksCount](rfk::StridedSpan<float const> speeds)
+											  {
+												  for (float speed : speeds)
+												  {
+													  speedsSum += speed;
+												  }
+
+												  chunksCount++;
+											  });
+
+		EXPECT_EQ(speedsSum, 45.0f);
+		EXPECT_EQ(chunksCount, 4u);
+	}
+}
+
+//=========================================================
+//============== StructStorage::pushBackCopies ============
+//=========================================================
+
+TEST(Rfk_StructStorage_pushBackCopies, CopiesAcrossChunks)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	std::vector<struct_storage_tests::Particle> prefabs(7u);
+	for (std::size_t i = 0u; i < prefabs.size(); i++)
+	{
+		prefabs[i].lifetime = static_cast<int>(i);
+	}
+
+	for (rfk::EStructStorageLayout layout : {rfk::EStructStorageLayout::AoS, rfk::EStructStorageLayout::SoA})
+	{
+		rfk::StructStorage storage(structs.particle, layout, 4u);
+
+		storage.emplaceBack();
+		ASSERT_TRUE(storage.pushBackCopies(prefabs.data(), prefabs.size()));
+
+		EXPECT_EQ(storage.getInstancesCount(), 8u);
+		EXPECT_EQ(storage.getChunksCount(), 2u);
+
+		for (std::size_t i = 0u; i < prefabs.size(); i++)
+		{
+			EXPECT_EQ(*static_cast<int*>(storage.getFieldAt(*structs.lifetime, i + 1u)), static_cast<int>(i));
+		}
+	}
+}
+
+TEST(Rfk_StructStorage_pushBackCopies, NonTrivialStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	{
+		std::vector<struct_storage_tests::Named> prefabs(3u);
+		prefabs[2].name = "third";
+
+		rfk::StructStorage storage(structs.named, rfk::EStructStorageLayout::AoS, 2u);
+
+		ASSERT_TRUE(storage.pushBackCopies(prefabs.data(), prefabs.size()));
+		EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 6);
+		EXPECT_EQ(static_cast<struct_storage_tests::Named*>(storage.getInstanceAt(2u))->name, "third");
+	}
+
+	EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 0);
+}
+
+TEST(Rfk_StructStorage_pushBackCopies, NonCopyableStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	structs.named.setCopyConstructor(nullptr);
+
+	struct_storage_tests::Named	prefab;
+	rfk::StructStorage			storage(structs.named);
+
+	EXPECT_FALSE(storage.pushBackCopies(&prefab));
+	EXPECT_EQ(storage.getInstancesCount(), 0u);
+}
+
+//=========================================================
+//================ StructStorage::swapRemove ==============
+//=========================================================
+
+TEST(Rfk_StructStorage_swapRemove, RelocatesLastInstance)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	for (rfk::EStructStorageLayout layout : {rfk::EStructStorageLayout::AoS, rfk::EStructStorageLayout::SoA})
+	{
+		rfk::StructStorage storage(structs.particle, layout, 4u);
+
+		for (int i = 0; i < 6; i++)
+		{
+			storage.emplaceBack(static_cast<float>(i));
+		}
+
+		EXPECT_TRUE(storage.swapRemove(1u));
+		EXPECT_TRUE(storage.swapRemove(4u));
+
+		EXPECT_EQ(storage.getInstancesCount(), 4u);
+		EXPECT_EQ(storage.getChunksCount(), 1u);
+		EXPECT_EQ(*static_cast<float*>(storage.getFieldAt(*structs.speed, 1u)), 5.0f);
+		EXPECT_EQ(*static_cast<float*>(storage.getFieldAt(*structs.speed, 3u)), 3.0f);
+	}
+}
+
+TEST(Rfk_StructStorage_swapRemove, NonTrivialStruct)
+{
+	struct_storage_tests::StoredStructs structs;
+
+	{
+		rfk::StructStorage storage(structs.named, rfk::EStructStorageLayout::AoS, 2u);
+
+		for (int i = 0; i < 3; i++)
+		{
+			storage.emplaceBack();
+			static_cast<struct_storage_tests::Named*>(storage.getInstanceAt(static_cast<std::size_t>(i)))->value = i;
+		}
+
+		EXPECT_TRUE(storage.swapRemove(0u));
+
+		EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 2);
+		EXPECT_EQ(static_cast<struct_storage_tests::Named*>(storage.getInstanceAt(0u))->value, 2);
+	}
+
+	EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 0);
+}
+
+//=========================================================
+//================== StructStorage::clear =================
+//=========================================================
+
+TEST(Rfk_StructStorage_clear, DestroysInstancesAndKeepsChunks)
+{
+	struct_storage_tests::StoredStructs	structs;
+	rfk::StructStorage					storage(structs.named, rfk::EStructStorageLayout::AoS, 2u);
+
+	for (int i = 0; i < 3; i++)
+	{
+		storage.emplaceBack();
+	}
+
+	storage.clear();
+
+	EXPECT_EQ(struct_storage_tests::Named::liveInstancesCount, 0);
+	EXPECT_EQ(storage.getInstancesCount(), 0u);
+	EXPECT_EQ(storage.getChunksCount(), 0u);
+
+	EXPECT_TRUE(storage.emplaceBack());
+	EXPECT_EQ(storage.getChunksCount(), 1u);
+}
\ No newline at end of file
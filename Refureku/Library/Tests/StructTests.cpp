@@ -674,6 +674,30 @@ TEST(Rfk_Struct_getFieldByPredicate, NonFindingPredicate)
 	EXPECT_EQ(TestClass::staticGetArchetype().getFieldByPredicate(predicate, &name), nullptr);
 }
 
+
+TEST(Rfk_Struct_getFieldByPredicate, FindingCallable)
+{
+	char const* name = "_intField";
+
+	rfk::Field const* field = TestClass::staticGetArchetype().getFieldByPredicate([name](rfk::Field const& field)
+																				{
+																					return field.hasSameName(name);
+																				});
+
+	ASSERT_NE(field, nullptr);
+	EXPECT_STREQ(field->getName(), name);
+}
+
+TEST(Rfk_Struct_getFieldByPredicate, NonFindingCallable)
+{
+	EXPECT_EQ(TestClass::staticGetArchetype().getFieldByPredicate([](rfk::Field const& field) { return field.hasSameName("inexistantField"); }), nullptr);
+}
+
+TEST(Rfk_Struct_getFieldByPredicate, ThrowingCallable)
+{
+	EXPECT_THROW(TestClass::staticGetArchetype().getFieldByPredicate([](rfk::Field const&) -> bool { throw std::logic_error("Error"); }), std::logic_error);
+}
+
 //=========================================================
 //============= Struct::getFieldsByPredicate ==============
 //=========================================================
@@ -829,6 +853,57 @@ TEST(Rfk_Struct_getFieldsByPredicate, FindingPredicateOrderedFieldsMultipleInher
 	EXPECT_STREQ(fields[11]->getName(), "t");
 }
 
+
+TEST(Rfk_Struct_getFieldsByPredicate, FindingCallable)
+{
+	EXPECT_EQ(TestClass::staticGetArchetype().getFieldsByPredicate([](rfk::Field const& field) { return field.hasSameName("_intField"); }).size(), 1u);
+}
+
+TEST(Rfk_Struct_getFieldsByPredicate, FindingCallableOrderedFieldsMultipleInheritanceClassIncludeInheritedFields)
+{
+	rfk::Vector<rfk::Field const*> fields = TestGetOrderedFieldsMultipleInheritanceChild::staticGetArchetype().getFieldsByPredicate([](rfk::Field const&)
+																																	{
+																																		return true;
+																																	},
+																																	true,
+																																	true);
+
+	ASSERT_EQ(fields.size(), 12u);
+	EXPECT_STREQ(fields[0]->getName(), "i");
+	EXPECT_STREQ(fields[5]->getName(), "n");
+	EXPECT_STREQ(fields[6]->getName(), "o");
+	EXPECT_STREQ(fields[11]->getName(), "t");
+}
+
+TEST(Rfk_Struct_getFieldsByPredicate, FindingCallableOrderedFieldsSingleInheritanceClassExcludeInheritedFields)
+{
+	rfk::Vector<rfk::Field const*> fields = TestGetOrderedFieldsSingleInheritanceChild::staticGetArchetype().getFieldsByPredicate([](rfk::Field const&)
+																																  {
+																																	  return true;
+																																  },
+																																  false,
+																																  true);
+
+	ASSERT_EQ(fields.size(), 3u);
+	EXPECT_STREQ(fields[0]->getName(), "r");
+	EXPECT_STREQ(fields[1]->getName(), "s");
+	EXPECT_STREQ(fields[2]->getName(), "t");
+}
+
+TEST(Rfk_Struct_getFieldsByPredicate, FindingCallableSkipsStaticFields)
+{
+	rfk::Vector<rfk::Field const*> fields = TestClass::staticGetArchetype().getFieldsByPredicate([](rfk::Field const&) { return true; });
+
+	EXPECT_EQ(fields.size(), TestClass::staticGetArchetype().getFieldsCount());
+
+	for (rfk::Field const* field : fields)
+	{
+		EXPECT_EQ(field->getKind(), rfk::EEntityKind::Field);
+	}
+
+	EXPECT_EQ(TestClass::staticGetArchetype().getFieldByPredicate([](rfk::Field const& field) { return field.hasSameName("_intStaticField"); }), nullptr);
+}
+
 //=========================================================
 //================= Struct::foreachField ==================
 //=========================================================
@@ -880,6 +955,70 @@ TEST(Rfk_Struct_foreachField, ThrowingVisitor)
 	EXPECT_THROW(TestClass::staticGetArchetype().foreachField(visitor, nullptr), std::logic_error);
 }
 
+
+TEST(Rfk_Struct_foreachField, CompleteLoopCallable)
+{
+	std::size_t counter = 0u;
+
+	EXPECT_TRUE(TestClass::staticGetArchetype().foreachField([&counter](rfk::Field const&)
+															 {
+																 counter++;
+
+																 return true;
+															 }));
+
+	EXPECT_EQ(counter, TestClass::staticGetArchetype().getFieldsCount());
+}
+
+TEST(Rfk_Struct_foreachField, BreakingLoopCallable)
+{
+	std::size_t counter = 0u;
+
+	EXPECT_FALSE(TestClass::staticGetArchetype().foreachField([&counter](rfk::Field const&)
+															  {
+																  counter++;
+
+																  return false;
+															  }));
+
+	EXPECT_EQ(counter, 1u);
+}
+
+TEST(Rfk_Struct_foreachField, InheritedFieldsCallable)
+{
+	std::size_t counter = 0u;
+	auto		visitor = [&counter](rfk::Field const&)
+	{
+		counter++;
+
+		return true;
+	};
+
+	EXPECT_TRUE(ObjectDerived1::staticGetArchetype().foreachField(visitor));
+	EXPECT_EQ(counter, 1u);
+
+	counter = 0u;
+
+	EXPECT_TRUE(ObjectDerived1::staticGetArchetype().foreachField(visitor, true));
+	EXPECT_EQ(counter, 2u);
+}
+
+TEST(Rfk_Struct_foreachField, StaticFieldsAreNotVisitedCallable)
+{
+	std::size_t counter = 0u;
+
+	EXPECT_TRUE(TestClass::staticGetArchetype().foreachField([&counter](rfk::Field const& field)
+															 {
+																 EXPECT_EQ(field.getKind(), rfk::EEntityKind::Field);
+																 counter++;
+
+																 return true;
+															 }));
+
+	EXPECT_EQ(counter, TestClass::staticGetArchetype().getFieldsCount());
+	EXPECT_GT(TestClass::staticGetArchetype().getStaticFieldsCount(), 0u);
+}
+
 //=========================================================
 //================ Struct::getFieldsCount =================
 //=========================================================
@@ -899,6 +1038,28 @@ TEST(Rfk_Struct_getFieldsCount, SeveralFieldsIncludingInherited)
 	EXPECT_EQ(ObjectDerived1::staticGetArchetype().getFieldsCount(), 2u);	//1 + 1 inherited
 }
 
+
+//=========================================================
+//================ Struct::getFieldsSpan ==================
+//=========================================================
+
+TEST(Rfk_Struct_getFieldsSpan, NoFields)
+{
+	EXPECT_TRUE(rfk::getDatabase().getNamespaceByName("test_namespace")->getStructByName("TestNamespaceNestedStruct")->getFieldsSpan().empty());
+}
+
+TEST(Rfk_Struct_getFieldsSpan, SeveralFieldsIncludingInherited)
+{
+	rfk::Span<rfk::Field const* const> fields = ObjectDerived1::staticGetArchetype().getFieldsSpan();
+
+	EXPECT_EQ(fields.size(), ObjectDerived1::staticGetArchetype().getFieldsCount());
+
+	for (rfk::Field const* field : fields)
+	{
+		EXPECT_EQ(ObjectDerived1::staticGetArchetype().getFieldByName(field->getName(), rfk::EFieldFlags::Default, true), field);
+	}
+}
+
 //=========================================================
 //============= Struct::getStaticFieldByName ==============
 //=========================================================
@@ -1190,6 +1351,15 @@ TEST(Rfk_Struct_getMethodByPredicate, NonFindingPredicate)
 	EXPECT_EQ(TestClass::staticGetArchetype().getMethodByPredicate(predicate, &name), nullptr);
 }
 
+
+TEST(Rfk_Struct_getMethodByPredicate, FindingCallableWithInherited)
+{
+	auto predicate = [](rfk::Method const& method) { return method.hasSameName("getIntField"); };
+
+	EXPECT_EQ(TestClass2::staticGetArchetype().getMethodByPredicate(predicate), nullptr);
+	EXPECT_NE(TestClass2::staticGetArchetype().getMethodByPredicate(predicate, true), nullptr);
+}
+
 //=========================================================
 //============= Struct::getMethodsByPredicate =============
 //=========================================================
@@ -1243,6 +1413,15 @@ TEST(Rfk_Struct_getMethodsByPredicate, NonFindingPredicate)
 	EXPECT_EQ(TestClass::staticGetArchetype().getMethodsByPredicate(predicate, &name).size(), 0u);
 }
 
+
+TEST(Rfk_Struct_getMethodsByPredicate, FindingCallableWithInherited)
+{
+	auto predicate = [](rfk::Method const& method) { return method.hasSameName("getIntField"); };
+
+	EXPECT_EQ(TestClass2::staticGetArchetype().getMethodsByPredicate(predicate).size(), 0u);
+	EXPECT_EQ(TestClass2::staticGetArchetype().getMethodsByPredicate(predicate, true).size(), 2u);
+}
+
 //=========================================================
 //================= Struct::foreachMethod =================
 //=========================================================
@@ -1310,6 +1489,21 @@ TEST(Rfk_Struct_foreachMethod, ThrowingVisitor)
 	EXPECT_THROW(TestClass::staticGetArchetype().foreachMethod(visitor, nullptr), std::logic_error);
 }
 
+
+TEST(Rfk_Struct_foreachMethod, CompleteLoopWithInheritedCallable)
+{
+	std::size_t counter = 0u;
+
+	EXPECT_TRUE(TestClass2::staticGetArchetype().foreachMethod([&counter](rfk::Method const&)
+															   {
+																   counter++;
+
+																   return true;
+															   }, true));
+
+	EXPECT_EQ(counter, TestClass2::staticGetArchetype().getMethodsCount() + TestClass::staticGetArchetype().getMethodsCount());
+}
+
 //=========================================================
 //================ Struct::getMethodsCount ================
 //=========================================================
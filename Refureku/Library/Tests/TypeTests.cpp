@@ -12,6 +12,82 @@ TEST(Rfk_getType, AddressCheck)
 	EXPECT_EQ(&rfk::getType<TestClass>(), &rfk::getType<TestClass>());
 }
 
+TEST(Rfk_getType, CanonicalType)
+{
+	EXPECT_TRUE(rfk::getType<TestClass>().isCanonical());
+	EXPECT_TRUE(rfk::getType<TestClass const*>().isCanonical());
+}
+
+TEST(Rfk_Type_getTypePartsCount, DeeplyNestedType)
+{
+	EXPECT_EQ(rfk::getType<TestClass const* const* volatile** const*>().getTypePartsCount(), 6u);
+	EXPECT_FALSE(rfk::getType<TestClass const* const* volatile** const*>().isConst());
+	EXPECT_TRUE(rfk::getType<TestClass const* const* volatile** const*>().getTypePartAt(1u).isConst());
+	EXPECT_TRUE(rfk::getType<TestClass const* const* volatile** const*>().getTypePartAt(3u).isVolatile());
+	EXPECT_TRUE(rfk::getType<TestClass const* const* volatile** const*>().getTypePartAt(5u).isConst());
+	EXPECT_EQ(rfk::getType<TestClass const* const* volatile** const*>().getArchetype(), rfk::getArchetype<TestClass>());
+}
+
+//=========================================================
+//=============== Type::getCanonicalType ==================
+//=========================================================
+
+TEST(Rfk_Type_getCanonicalType, ManuallyBuiltType)
+{
+	rfk::Type type;
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+	type.setArchetype(rfk::getArchetype<TestClass>());
+
+	EXPECT_FALSE(type.isCanonical());
+	EXPECT_EQ(&type.getCanonicalType(), &rfk::getType<TestClass*>());
+}
+
+TEST(Rfk_Type_getCanonicalType, CanonicalType)
+{
+	EXPECT_EQ(&rfk::getType<TestClass&>().getCanonicalType(), &rfk::getType<TestClass&>());
+}
+
+//=========================================================
+//=================== Type::operator== ====================
+//=========================================================
+
+TEST(Rfk_Type_operatorEqual, CanonicalTypes)
+{
+	EXPECT_TRUE(rfk::getType<TestClass>() == rfk::getType<TestClass>());
+	EXPECT_FALSE(rfk::getType<TestClass>() == rfk::getType<TestClass const>());
+}
+
+TEST(Rfk_Type_operatorEqual, NonCanonicalType)
+{
+	rfk::Type type;
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+	type.setArchetype(rfk::getArchetype<TestClass>());
+
+	EXPECT_TRUE(type == rfk::getType<TestClass>());
+	EXPECT_FALSE(type == rfk::getType<TestClass*>());
+
+	type.setArchetype(rfk::getArchetype<int>());
+
+	EXPECT_TRUE(type == rfk::getType<int>());
+	EXPECT_FALSE(type == rfk::getType<TestClass>());
+}
+
+TEST(Rfk_Type_operatorEqual, DeeplyNestedNonCanonicalType)
+{
+	rfk::Type type;
+	for (int i = 0; i < 6; i++)
+	{
+		type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+	}
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+	type.setArchetype(rfk::getArchetype<int>());
+
+	EXPECT_TRUE(type == rfk::getType<int******>());
+	EXPECT_FALSE(type == rfk::getType<int*****>());
+	EXPECT_EQ(&type.getCanonicalType(), &rfk::getType<int******>());
+}
+
 //=========================================================
 //============== Type::getTypePartsCount ==================
 //=========================================================
@@ -3,6 +3,64 @@
 
 #include "ConstructionTrackedClass.h"
 
+namespace vector_tests
+{
+	/**
+	*	Allocator counting its live allocations. Instances using different counters can't release the memory of one another.
+	*	Also used by the SmallVector tests.
+	*/
+	template <typename T, bool Propagate>
+	struct TrackingAllocator
+	{
+		using value_type								= T;
+		using propagate_on_container_copy_assignment	= std::bool_constant<Propagate>;
+		using propagate_on_container_move_assignment	= std::bool_constant<Propagate>;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = TrackingAllocator<U, Propagate>;
+		};
+
+		int* liveAllocations;
+
+		TrackingAllocator(int& liveAllocationsCounter) noexcept:
+			liveAllocations{&liveAllocationsCounter}
+		{
+		}
+
+		template <typename U>
+		TrackingAllocator(TrackingAllocator<U, Propagate> const& other) noexcept:
+			liveAllocations{other.liveAllocations}
+		{
+		}
+
+		T* allocate(std::size_t count)
+		{
+			(*liveAllocations)++;
+
+			return static_cast<T*>(::operator new(count * sizeof(T)));
+		}
+
+		void deallocate(T* ptr, std::size_t) noexcept
+		{
+			(*liveAllocations)--;
+
+			::operator delete(ptr);
+		}
+
+		bool operator==(TrackingAllocator const& other) const noexcept
+		{
+			return liveAllocations == other.liveAllocations;
+		}
+
+		bool operator!=(TrackingAllocator const& other) const noexcept
+		{
+			return !(*this == other);
+		}
+	};
+}
+
 //=========================================================
 //==================== Vector::ctor =======================
 //=========================================================
@@ -73,6 +131,17 @@ TEST(Rfk_Vector_ctor, MoveDifferentElementTypeCtor)
 	EXPECT_TRUE(vec2[2]->hasSameName("func_noParam"));
 }
 
+TEST(Rfk_Vector_ctor, AllocatorCtor)
+{
+	rfk::MemoryArena arena;
+
+	rfk::Vector<int, rfk::ArenaAllocator<int>> vec(2, rfk::ArenaAllocator<int>(arena));
+
+	EXPECT_EQ(vec.capacity(), 2u);
+	EXPECT_EQ(&vec.get_allocator().getArena(), &arena);
+	EXPECT_GT(arena.getReservedBytes(), 0u);
+}
+
 //=========================================================
 //================== Vector::push_back ====================
 //=========================================================
@@ -594,4 +663,51 @@ TEST(Rfk_Vector_assignmentOperator, MoveAssignment)
 	EXPECT_EQ(vec2.size(), 1u);
 	EXPECT_TRUE(vec2.front().getDefaultConstructed());
 	EXPECT_EQ(vec2.front().getValue(), 1);
+}
+
+TEST(Rfk_Vector_assignmentOperator, MoveAssignmentNonPropagatingAllocator)
+{
+	using Allocator = vector_tests::TrackingAllocator<int, false>;
+
+	int liveAllocations1 = 0;
+	int liveAllocations2 = 0;
+
+	{
+		rfk::Vector<int, Allocator> vec1(2, Allocator(liveAllocations1));
+		rfk::Vector<int, Allocator> vec2(2, Allocator(liveAllocations2));
+
+		vec1.push_back(1);
+
+		vec2 = std::move(vec1);
+
+		//The memory of vec1 can't be stolen since vec2 keeps its own allocator
+		EXPECT_TRUE(vec2.get_allocator() == Allocator(liveAllocations2));
+		ASSERT_EQ(vec2.size(), 1u);
+		EXPECT_EQ(vec2.front(), 1);
+		EXPECT_TRUE(vec1.empty());
+	}
+
+	EXPECT_EQ(liveAllocations1, 0);
+	EXPECT_EQ(liveAllocations2, 0);
+}
+
+TEST(Rfk_Vector_assignmentOperator, CopyAssignmentBiggerVector)
+{
+	rfk::Vector<ConstructionTrackedClass> vec1(4);
+	rfk::Vector<ConstructionTrackedClass> vec2(1);
+
+	for (int i = 0; i < 4; i++)
+	{
+		vec1.emplace_back(i);
+	}
+	vec2.emplace_back(10);
+
+	vec2 = vec1;
+
+	ASSERT_EQ(vec2.size(), 4u);
+	for (std::size_t i = 0u; i < vec2.size(); i++)
+	{
+		EXPECT_TRUE(vec2[i].getCopyConstructed());
+		EXPECT_EQ(vec2[i].getValue(), i);
+	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@ __RFK_DISABLE_WARNING_PUSH
 __RFK_DISABLE_WARNING_UNUSED_RESULT
 
 #include "VectorTests.cpp"
+#include "SmallVectorTests.cpp"
 #include "EntityTests.cpp"
 #include "ArchetypeTests.cpp"
 #include "EnumTests.cpp"
@@ -30,6 +31,17 @@ __RFK_DISABLE_WARNING_UNUSED_RESULT
 #include "InstantiatorTests.cpp"
 #include "NestedClassTests.cpp"
 #include "NestedEnumTests.cpp"
+#include "QueryViewTests.cpp"
+#include "ModuleHandleTests.cpp"
+#include "EntityQueryTests.cpp"
+#include "DatabaseSnapshotTests.cpp"
+#include "MemoryFootprintTests.cpp"
+#include "InstrumentationTests.cpp"
+#include "RegistrationTraceTests.cpp"
+#include "StructPoolTests.cpp"
+#include "StructCopyTests.cpp"
+#include "StructStorageTests.cpp"
+#include "MethodCommandBufferTests.cpp"
 
 __RFK_DISABLE_WARNING_POP
 